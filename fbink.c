@@ -177,7 +177,7 @@ static void
 	size_t pix_offset = (uint32_t)(coords->x << 1U) + (coords->y * fInfo.line_length);
 
 	// write the two bytes at once, much to GCC's dismay...
-	// NOTE: Input pixel *has* to be properly packed to RGB565 first (via pack_rgb565, c.f., put_pixel)!
+	// NOTE: Input pixel *has* to be properly packed to RGB565 first (via pack_rgb565, c.f., put_span)!
 #pragma GCC diagnostic push
 #pragma GCC diagnostic ignored "-Wcast-align"
 	*((uint16_t*) (fbPtr + pix_offset)) = px->rgb565;
@@ -360,64 +360,6 @@ static void
 	// https://github.com/NiLuJe/FBInk/commit/75407d4a44d7bfc7705665ad4ec9ecad0d03a368).
 }
 
-// Handle a few sanity checks...
-// NOTE: If you can, prefer using the right put_pixel_* function directly.
-//       While the bounds checking is generally rather cheap,
-//       (i.e., (*fxpPutPixel) is only marginally faster than put_pixel()),
-//       the overhead of going through the function pointers is rather large
-//       (i.e., put_pixel() can be twice as slow as put_pixel_*()).
-//       On the oldest of our target HW, it's often *slightly* faster than branching or switching, though ;).
-//       But on modern processors, even on our target HW, branching should eventually take the lead, though,
-//       and in this case (ha!) appears to behave *noticeably* better than switching...
-//       Which is why we now branch via an if ladder, as it should offer marginally better performance on newer devices.
-static void
-    put_pixel(FBInkCoordinates coords, const FBInkPixel* restrict px, bool is_rgb565)
-{
-	// Handle rotation now, so we can properly validate if the pixel is off-screen or not ;).
-	// fbink_init() takes care of setting this global pointer to the right function...
-	// NOTE: In this case, going through the function pointer is *noticeably* faster than branching...
-	(*fxpRotateCoords)(&coords);
-
-	// NOTE: Discard off-screen pixels!
-	//       For instance, when we have a halfcell offset in conjunction with a !isPerfectFit pixel offset,
-	//       when we're padding and centering, the final whitespace of right-padding will have its last
-	//       few pixels (the exact amount being half of the dead zone width) pushed off-screen...
-	if (coords.x >= vInfo.xres || coords.y >= vInfo.yres) {
-#ifdef DEBUG
-		// NOTE: This is only enabled in Debug builds because it can be pretty verbose,
-		//       and does not necessarily indicate an actual issue, as we've just explained...
-		LOG("Put: discarding off-screen pixel @ (%hu, %hu) (out of %ux%u bounds)",
-		    coords.x,
-		    coords.y,
-		    vInfo.xres,
-		    vInfo.yres);
-#endif
-		return;
-	}
-
-	// NOTE: Hmm, here, an if ladder appears to be ever so *slightly* faster than going through the function pointer...
-	if (vInfo.bits_per_pixel == 4U) {
-		put_pixel_Gray4(&coords, px);
-	} else if (vInfo.bits_per_pixel == 8U) {
-		put_pixel_Gray8(&coords, px);
-	} else if (vInfo.bits_per_pixel == 16U) {
-		// Do we need to pack the pixel, first?
-		if (is_rgb565) {
-			// Nope :)
-			put_pixel_RGB565(&coords, px);
-		} else {
-			// Yep :(
-			FBInkPixel packed_px;
-			packed_px.rgb565 = pack_rgb565(px->bgra.color.r, px->bgra.color.g, px->bgra.color.b);
-			put_pixel_RGB565(&coords, &packed_px);
-		}
-	} else if (vInfo.bits_per_pixel == 24U) {
-		put_pixel_RGB24(&coords, px);
-	} else if (vInfo.bits_per_pixel == 32U) {
-		put_pixel_RGB32(&coords, px);
-	}
-}
-
 // Helper functions to 'get' a specific pixel's color from the framebuffer
 // c.f., FBGrab convert* functions
 //       (http://trac.ak-team.com/trac/browser/niluje/Configs/trunk/Kindle/Misc/FBGrab/fbgrab.c#L402)
@@ -521,42 +463,250 @@ static void
 	px->bgra.color.b = (uint8_t)((b << 3U) | (b >> 2U));
 }
 
-// Handle a few sanity checks...
+// Resolve an horizontal run of len pixels starting @ coords (pre-rotation) to its on-screen part,
+// in physical fb coordinates. Returns false if nothing is left on-screen.
+// NOTE: We used to rotate & bounds-check every single pixel (via a put_pixel wrapper around the put_pixel_* functions).
+//       Doing it once per run instead makes those checks essentially free,
+//       and lets the blitters below pick the right put_pixel_* codepath once per run, too.
+//       Said checks are still needed: when we have a halfcell offset in conjunction with a !isPerfectFit pixel offset,
+//       when we're padding and centering, the final whitespace of right-padding will have its last
+//       few pixels (the exact amount being half of the dead zone width) pushed off-screen...
+static bool
+    clip_span(FBInkCoordinates coords, unsigned short int len, FBInkSpan* restrict span)
+{
+	// NOTE: Our callers rely on wraparound on underflow to push content off-screen to the left (c.f., draw),
+	//       so, treat anything in the upper half of the range as negative, which is what the bounds checks used to end up doing.
+	const int x = coords.x >= 0x8000u ? (int) coords.x - 0x10000 : (int) coords.x;
+	if (coords.y >= screenHeight) {
+		return false;
+	}
+
+	// Clip it, horizontally, since that's the only axis a span can cross the edge of the screen on...
+	const int start = MAX(0, x);
+	const int end   = MIN((int) screenWidth, x + len);
+	if (end <= start) {
+		return false;
+	}
+	span->skip = (unsigned short int) (start - x);
+	span->len  = (unsigned short int) (end - start);
+
+	// Let the rotation function tell us where the first two pixels land, that gives us the direction of the run.
+	// NOTE: The second pixel may be off-screen, but we only care about the delta, and it's computed w/ wraparound.
+	FBInkCoordinates p0 = { (unsigned short int) start, coords.y };
+	FBInkCoordinates p1 = { (unsigned short int) (start + 1), coords.y };
+	(*fxpRotateCoords)(&p0);
+	(*fxpRotateCoords)(&p1);
+	span->x  = p0.x;
+	span->y  = p0.y;
+	span->dx = (short int) (unsigned short int) (p1.x - p0.x);
+	span->dy = (short int) (unsigned short int) (p1.y - p0.y);
+
+	return true;
+}
+
+// Helper functions to 'plot' a run of grayscale pixels to the framebuffer, in the fb's pixel format.
+// The span has already been clipped & rotated by clip_span.
 static void
-    get_pixel(FBInkCoordinates coords, FBInkPixel* restrict px)
+    put_span_Gray4(const FBInkSpan* restrict span, const uint8_t* restrict v)
 {
-	// Handle rotation now, so we can properly validate if the pixel is off-screen or not ;).
-	// fbink_init() takes care of setting this global pointer to the right function...
-	(*fxpRotateCoords)(&coords);
+	// Nibbles are a pain, so, piggyback on put_pixel_Gray4 (which the compiler will happily inline)...
+	FBInkCoordinates coords = { span->x, span->y };
+	FBInkPixel       px     = { 0U };
+	for (unsigned short int i = 0U; i < span->len; i++) {
+		px.gray8 = v[i];
+		put_pixel_Gray4(&coords, &px);
+		coords.x = (unsigned short int) (coords.x + span->dx);
+		coords.y = (unsigned short int) (coords.y + span->dy);
+	}
+}
 
-	// NOTE: Discard off-screen pixels!
-	//       For instance, when we have a halfcell offset in conjunction with a !isPerfectFit pixel offset,
-	//       when we're padding and centering, the final whitespace of right-padding will have its last
-	//       few pixels (the exact amount being half of the dead zone width) pushed off-screen...
-	if (coords.x >= vInfo.xres || coords.y >= vInfo.yres) {
-#ifdef DEBUG
-		// NOTE: This is only enabled in Debug builds because it can be pretty verbose,
-		//       and does not necessarily indicate an actual issue, as we've just explained...
-		LOG("Put: discarding off-screen pixel @ (%hu, %hu) (out of %ux%u bounds)",
-		    coords.x,
-		    coords.y,
-		    vInfo.xres,
-		    vInfo.yres);
-#endif
+static void
+    put_span_Gray8(const FBInkSpan* restrict span, const uint8_t* restrict v)
+{
+	unsigned char* restrict p = fbPtr + span->x + (span->y * fInfo.line_length);
+
+	if (span->dy == 0 && span->dx == 1) {
+		// Unrotated: the run is contiguous in memory, and already in the right format ;).
+		memcpy(p, v, span->len);
+	} else {
+		const ptrdiff_t step = span->dx + (span->dy * (ptrdiff_t) fInfo.line_length);
+		for (unsigned short int i = 0U; i < span->len; i++) {
+			*p = v[i];
+			p += step;
+		}
+	}
+}
+
+static void
+    put_span_RGB24(const FBInkSpan* restrict span, const uint8_t* restrict v)
+{
+	unsigned char* restrict p    = fbPtr + (span->x * 3U) + (span->y * fInfo.line_length);
+	const ptrdiff_t         step = (span->dx * 3) + (span->dy * (ptrdiff_t) fInfo.line_length);
+
+	for (unsigned short int i = 0U; i < span->len; i++) {
+		p[0] = p[1] = p[2] = v[i];
+		p += step;
+	}
+}
+
+static void
+    put_span_RGB32(const FBInkSpan* restrict span, const uint8_t* restrict v)
+{
+	unsigned char* restrict p    = fbPtr + (uint32_t)(span->x << 2U) + (span->y * fInfo.line_length);
+	const ptrdiff_t         step = (span->dx * 4) + (span->dy * (ptrdiff_t) fInfo.line_length);
+
+	FBInkPixel px;
+	px.bgra.color.a = 0xFFu;
+	for (unsigned short int i = 0U; i < span->len; i++) {
+		px.bgra.color.r = px.bgra.color.g = px.bgra.color.b = v[i];
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wcast-align"
+		*((uint32_t*) p) = px.bgra.p;
+#pragma GCC diagnostic pop
+		p += step;
+	}
+}
+
+static void
+    put_span_RGB565(const FBInkSpan* restrict span, const uint8_t* restrict v)
+{
+	unsigned char* restrict p    = fbPtr + (uint32_t)(span->x << 1U) + (span->y * fInfo.line_length);
+	const ptrdiff_t         step = (span->dx * 2) + (span->dy * (ptrdiff_t) fInfo.line_length);
+
+	for (unsigned short int i = 0U; i < span->len; i++) {
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wcast-align"
+		*((uint16_t*) p) = pack_rgb565(v[i], v[i], v[i]);
+#pragma GCC diagnostic pop
+		p += step;
+	}
+}
+
+// Plot a run of len grayscale pixels starting @ coords, handling rotation & clipping once for the whole run.
+static void
+    put_gray_span(FBInkCoordinates coords, unsigned short int len, const uint8_t* restrict v)
+{
+	FBInkSpan span;
+	if (!clip_span(coords, len, &span)) {
+		return;
+	}
+	v += span.skip;
+
+	// NOTE: On modern processors, even on our target HW, an if ladder behaves *noticeably* better than switching,
+	//       and slightly better than going through the function pointers. And we only go through it once per span ;).
+	if (vInfo.bits_per_pixel == 4U) {
+		put_span_Gray4(&span, v);
+	} else if (vInfo.bits_per_pixel == 8U) {
+		put_span_Gray8(&span, v);
+	} else if (vInfo.bits_per_pixel == 16U) {
+		put_span_RGB565(&span, v);
+	} else if (vInfo.bits_per_pixel == 24U) {
+		put_span_RGB24(&span, v);
+	} else if (vInfo.bits_per_pixel == 32U) {
+		put_span_RGB32(&span, v);
+	}
+}
+
+// Crappy macro to walk a clipped span, one physical pixel at a time, via a put_pixel_* or get_pixel_* function.
+// NOTE: Said functions are static, so the compiler is free to inline them in there ;).
+#define WALK_SPAN(FX, PX)                                                                                                \
+	({                                                                                                               \
+		FBInkCoordinates sc = { span.x, span.y };                                                                \
+		for (unsigned short int si = 0U; si < span.len; si++) {                                                  \
+			FX(&sc, (PX) + si);                                                                              \
+			sc.x = (unsigned short int) (sc.x + span.dx);                                                    \
+			sc.y = (unsigned short int) (sc.y + span.dy);                                                    \
+		}                                                                                                        \
+	})
+
+// Plot a run of len FBInkPixels starting @ coords.
+// NOTE: If !is_rgb565, the pixels will be packed for you on 16bpp fbs.
+static void
+    put_span(FBInkCoordinates coords, unsigned short int len, const FBInkPixel* restrict px, bool is_rgb565)
+{
+	FBInkSpan span;
+	if (!clip_span(coords, len, &span)) {
+		return;
+	}
+	px += span.skip;
+
+	if (vInfo.bits_per_pixel == 4U) {
+		WALK_SPAN(put_pixel_Gray4, px);
+	} else if (vInfo.bits_per_pixel == 8U) {
+		WALK_SPAN(put_pixel_Gray8, px);
+	} else if (vInfo.bits_per_pixel == 16U) {
+		if (is_rgb565) {
+			WALK_SPAN(put_pixel_RGB565, px);
+		} else {
+			FBInkCoordinates sc = { span.x, span.y };
+			FBInkPixel       packed_px;
+			for (unsigned short int si = 0U; si < span.len; si++) {
+				packed_px.rgb565 = pack_rgb565(px[si].bgra.color.r, px[si].bgra.color.g, px[si].bgra.color.b);
+				put_pixel_RGB565(&sc, &packed_px);
+				sc.x = (unsigned short int) (sc.x + span.dx);
+				sc.y = (unsigned short int) (sc.y + span.dy);
+			}
+		}
+	} else if (vInfo.bits_per_pixel == 24U) {
+		WALK_SPAN(put_pixel_RGB24, px);
+	} else if (vInfo.bits_per_pixel == 32U) {
+		WALK_SPAN(put_pixel_RGB32, px);
+	}
+}
+
+// Read back a run of len pixels starting @ coords.
+// NOTE: Off-screen pixels are left untouched in px.
+static void
+    get_span(FBInkCoordinates coords, unsigned short int len, FBInkPixel* restrict px)
+{
+	FBInkSpan span;
+	if (!clip_span(coords, len, &span)) {
 		return;
 	}
+	px += span.skip;
 
-	// NOTE: Hmm, here, an if ladder appears to be ever so *slightly* faster than going through the function pointer...
 	if (vInfo.bits_per_pixel == 4U) {
-		get_pixel_Gray4(&coords, px);
+		WALK_SPAN(get_pixel_Gray4, px);
 	} else if (vInfo.bits_per_pixel == 8U) {
-		get_pixel_Gray8(&coords, px);
+		WALK_SPAN(get_pixel_Gray8, px);
 	} else if (vInfo.bits_per_pixel == 16U) {
-		get_pixel_RGB565(&coords, px);
+		WALK_SPAN(get_pixel_RGB565, px);
 	} else if (vInfo.bits_per_pixel == 24U) {
-		get_pixel_RGB24(&coords, px);
+		WALK_SPAN(get_pixel_RGB24, px);
 	} else if (vInfo.bits_per_pixel == 32U) {
-		get_pixel_RGB32(&coords, px);
+		WALK_SPAN(get_pixel_RGB32, px);
+	}
+}
+#undef WALK_SPAN
+
+// Plot a run of len pixels starting @ coords, that are already in the fb's pixel format (c.f., gray_to_native).
+// NOTE: Except at 4bpp, where we can't pre-pack pixels without knowing their alignment, so those are just plain Y8.
+static void
+    put_native_span(FBInkCoordinates coords, unsigned short int len, const uint8_t* restrict px)
+{
+	FBInkSpan span;
+	if (!clip_span(coords, len, &span)) {
+		return;
+	}
+
+	if (vInfo.bits_per_pixel == 4U) {
+		put_span_Gray4(&span, px + span.skip);
+		return;
+	}
+
+	const uint8_t           bpp = (uint8_t)(vInfo.bits_per_pixel >> 3U);
+	unsigned char* restrict p   = fbPtr + (span.x * bpp) + (span.y * fInfo.line_length);
+	px += span.skip * bpp;
+	if (span.dy == 0 && span.dx == 1) {
+		// Unrotated: it's contiguous on both ends, so that's a single memcpy ;).
+		memcpy(p, px, (size_t) span.len * bpp);
+	} else {
+		const ptrdiff_t step = (span.dx * bpp) + (span.dy * (ptrdiff_t) fInfo.line_length);
+		for (unsigned short int i = 0U; i < span.len; i++) {
+			memcpy(p, px, bpp);
+			p += step;
+			px += bpp;
+		}
 	}
 }
 
@@ -592,12 +742,19 @@ static void
 	}
 
 	if (vInfo.bits_per_pixel < 8U) {
-		// Go with pixel plotting @ 4bpp to keep this simple...
+		// @ 4bpp, plot the odd nibbles on either edge by hand, and memset the full bytes in between...
+		const uint8_t packed = (uint8_t)((px->gray8 & 0xF0u) | (px->gray8 >> 4U));
 		for (unsigned short int cy = 0U; cy < h; cy++) {
-			for (unsigned short int cx = 0U; cx < w; cx++) {
-				FBInkCoordinates coords;
-				coords.x = (unsigned short int) (x + cx);
-				coords.y = (unsigned short int) (y + cy);
+			FBInkCoordinates   coords = { x, (unsigned short int) (y + cy) };
+			unsigned short int cw     = w;
+			if ((coords.x & 0x01u) != 0U) {
+				put_pixel_Gray4(&coords, px);
+				coords.x++;
+				cw--;
+			}
+			memset(fbPtr + (coords.x >> 1U) + (coords.y * fInfo.line_length), packed, cw >> 1U);
+			if ((cw & 0x01u) != 0U) {
+				coords.x = (unsigned short int) (coords.x + (cw - 1U));
 				put_pixel_Gray4(&coords, px);
 			}
 		}
@@ -653,6 +810,13 @@ static void
 static void
     clear_screen(int fbfd UNUSED_BY_NOTKINDLE, uint8_t v, bool is_flashing UNUSED_BY_NOTKINDLE)
 {
+	// NOTE: The back buffer only spans a single (virtual) screen, so don't go anywhere near smem_len,
+	//       and there's obviously no ioctl shortcut to take either (c.f., fbink_get_back_buffer).
+	if (isBackBufferActive) {
+		memset(fbPtr, v, (size_t)(fInfo.line_length * vInfo.yres_virtual));
+		return;
+	}
+
 #ifdef FBINK_FOR_KINDLE
 	// NOTE: einkfb has a dedicated ioctl, so, use that, when it's not doing more harm than good...
 	if (deviceQuirks.isKindleLegacy) {
@@ -833,6 +997,121 @@ static int
 	return 1;
 }
 
+// Drop every glyph cell from the cache, and release the memory backing them
+static void
+    flush_glyph_cache(void)
+{
+	free(glyphCache.cells);
+	glyphCache.cells = NULL;
+	free(glyphCache.codepoints);
+	glyphCache.codepoints = NULL;
+	glyphCache.nslots     = 0U;
+}
+
+// Flush the glyph cache if the font, its scaling factor, or the fb's bitdepth changed since last time.
+// NOTE: This is called by fbink_init & fbink_reinit (via initialize_fbink).
+//       The pen colors are checked by prepare_glyph_cache instead, as is_inverted can change them on a per-call basis.
+static void
+    invalidate_glyph_cache(uint8_t fontname)
+{
+	if (glyphCache.fontname == fontname && glyphCache.fontmult == FONTSIZE_MULT &&
+	    glyphCache.bpp == vInfo.bits_per_pixel) {
+		return;
+	}
+
+	if (glyphCache.cells) {
+		LOG("Flushing glyph cache");
+	}
+	flush_glyph_cache();
+	glyphCache.fontname = fontname;
+	glyphCache.fontmult = FONTSIZE_MULT;
+	glyphCache.bpp      = (uint8_t) vInfo.bits_per_pixel;
+}
+
+// Make sure the glyph cache is allocated, and matches the requested pen colors.
+// Returns false if it's unusable (i.e., on OOM), in which case draw will simply render glyphs the old-fashioned way.
+static bool
+    prepare_glyph_cache(uint8_t fg, uint8_t bg)
+{
+	if (glyphCache.cells) {
+		if (glyphCache.fg == fg && glyphCache.bg == bg) {
+			return true;
+		}
+		LOG("Flushing glyph cache because of a pen color change");
+		flush_glyph_cache();
+	}
+
+	// NOTE: At 4bpp, we store plain Y8 (c.f., put_native_span)
+	glyphCache.row_len  = (size_t) FONTW * (vInfo.bits_per_pixel == 4U ? 1U : (vInfo.bits_per_pixel >> 3U));
+	glyphCache.cell_len = glyphCache.row_len * glyphHeight;
+	// Trade slots for memory if the cells are large...
+	uint16_t nslots = GLYPH_CACHE_MAX_SLOTS;
+	while (nslots > GLYPH_CACHE_MIN_SLOTS && (nslots * glyphCache.cell_len) > GLYPH_CACHE_MAX_SIZE) {
+		nslots = (uint16_t)(nslots >> 1U);
+	}
+
+	glyphCache.cells      = malloc(nslots * glyphCache.cell_len);
+	glyphCache.codepoints = malloc(nslots * sizeof(*glyphCache.codepoints));
+	if (!glyphCache.cells || !glyphCache.codepoints) {
+		WARN("malloc: %m");
+		flush_glyph_cache();
+		return false;
+	}
+	for (uint16_t slot = 0U; slot < nslots; slot++) {
+		glyphCache.codepoints[slot] = GLYPH_CACHE_EMPTY;
+	}
+	glyphCache.nslots = nslots;
+	glyphCache.fg     = fg;
+	glyphCache.bg     = bg;
+	LOG("Allocated a glyph cache of %hu cells of %zu bytes", nslots, glyphCache.cell_len);
+
+	return true;
+}
+
+// Returns the cache cell for that codepoint. If is_cached is false, the cell is now yours, and it's up to you to fill it!
+// NOTE: This is direct-mapped, we simply evict whatever was in that slot before.
+//       Since the cache is sized in powers of two, contiguous codepoints (i.e., a script's block) never collide ;).
+static uint8_t*
+    fetch_cached_glyph(uint32_t codepoint, bool* restrict is_cached)
+{
+	const uint16_t slot = (uint16_t)(codepoint & (glyphCache.nslots - 1U));
+	if (glyphCache.codepoints[slot] == codepoint) {
+		*is_cached = true;
+	} else {
+		glyphCache.codepoints[slot] = codepoint;
+		*is_cached                  = false;
+	}
+	return glyphCache.cells + (slot * glyphCache.cell_len);
+}
+
+// Convert a run of len Y8 pixels to the fb's pixel format (for put_native_span)
+static void
+    gray_to_native(const uint8_t* restrict v, uint8_t* restrict px, unsigned short int len)
+{
+	if (vInfo.bits_per_pixel == 4U || vInfo.bits_per_pixel == 8U) {
+		memcpy(px, v, len);
+	} else if (vInfo.bits_per_pixel == 16U) {
+		for (unsigned short int i = 0U; i < len; i++) {
+			const uint16_t p = pack_rgb565(v[i], v[i], v[i]);
+			memcpy(px, &p, sizeof(p));
+			px += sizeof(p);
+		}
+	} else if (vInfo.bits_per_pixel == 24U) {
+		for (unsigned short int i = 0U; i < len; i++) {
+			*px++ = v[i];
+			*px++ = v[i];
+			*px++ = v[i];
+		}
+	} else if (vInfo.bits_per_pixel == 32U) {
+		for (unsigned short int i = 0U; i < len; i++) {
+			*px++ = v[i];
+			*px++ = v[i];
+			*px++ = v[i];
+			*px++ = 0xFFu;
+		}
+	}
+}
+
 // Helper function for drawing
 static struct mxcfb_rect
     draw(const char* restrict        text,
@@ -847,15 +1126,18 @@ static struct mxcfb_rect
 	    multiline_offset,
 	    (unsigned short int) (row + multiline_offset));
 
+	// NOTE: The glyphs themselves go through the span blitters, which take plain grayscale values...
+	const uint8_t invert  = fbink_cfg->is_inverted ? 0xFFu : 0U;
+	const uint8_t fgcolor = penFGColor ^ invert;
+	const uint8_t bgcolor = penBGColor ^ invert;
+	// ... while fill_rect needs pixels packed in the fb's format.
 	FBInkPixel fgP = penFGPixel;
 	FBInkPixel bgP = penBGPixel;
 	if (fbink_cfg->is_inverted) {
 		// NOTE: And, of course, RGB565 is terrible. Inverting the lossy packed value would be even lossier...
 		if (vInfo.bits_per_pixel == 16U) {
-			const uint8_t fgcolor = penFGColor ^ 0xFFu;
-			const uint8_t bgcolor = penBGColor ^ 0xFFu;
-			fgP.rgb565            = pack_rgb565(fgcolor, fgcolor, fgcolor);
-			bgP.rgb565            = pack_rgb565(bgcolor, bgcolor, bgcolor);
+			fgP.rgb565 = pack_rgb565(fgcolor, fgcolor, fgcolor);
+			bgP.rgb565 = pack_rgb565(bgcolor, bgcolor, bgcolor);
 		} else {
 			fgP.bgra.p ^= 0x00FFFFFFu;
 			bgP.bgra.p ^= 0x00FFFFFFu;
@@ -883,7 +1165,7 @@ static struct mxcfb_rect
 		LOG("Incrementing pixel_offset by %hu pixels to account for a halfcell centering tweak", pixel_offset);
 	}
 	// Do we have a permanent adjustment to make because of dead space on the right edge?
-	if (!deviceQuirks.isPerfectFit) {
+	if (!isPerfectFit) {
 		// We correct by half of said dead space, since we want perfect centering ;).
 		unsigned short int deadzone_offset =
 		    (unsigned short int) (viewWidth - (unsigned short int) (MAXCOLS * FONTW)) / 2U;
@@ -1002,7 +1284,7 @@ static struct mxcfb_rect
 				region.width += pixel_offset;
 				// And make sure it's properly clamped, because we can't necessarily rely on left & width
 				// being entirely acurate either because of the multiline print override,
-				// or because of a bit of subcell placement overshoot trickery (c.f., comment in put_pixel).
+				// or because of a bit of subcell placement overshoot trickery (c.f., comment in clip_span).
 				if (region.width + region.left > screenWidth) {
 					region.width = screenWidth - region.left;
 					LOG("Clamped region.width to %u", region.width);
@@ -1016,7 +1298,7 @@ static struct mxcfb_rect
 		//       This only applies when pixel_offset *only* accounts for the !isPerfectFit adjustment though,
 		//       because in every other case, the halfcell offset handling neatly pushes everything into place ;).
 		// NOTE: Again, skip this in overlay/bgless mode ;).
-		if (charcount == MAXCOLS && !deviceQuirks.isPerfectFit && !halfcell_offset) {
+		if (charcount == MAXCOLS && !isPerfectFit && !halfcell_offset) {
 			// NOTE: !isPerfectFit ensures pixel_offset is non-zero
 			LOG("Painting a background rectangle to fill the dead space on the right edge");
 			// Make sure we don't leave a hoffset sized gap when we have a negative hoffset...
@@ -1061,11 +1343,10 @@ static struct mxcfb_rect
 	size_t           ci    = 0U;
 	uint32_t         ch;
 	FBInkCoordinates coords = { 0U };
-	FBInkPixel*      pxP;
 	// NOTE: We don't do much sanity checking on hoffset/voffset,
 	//       because we want to allow pushing part of the string off-screen
 	//       (we basically only make sure it won't screw up the region rectangle too badly).
-	//       put_pixel is checked, and will discard off-screen pixels safely.
+	//       The span blitters are checked, and will discard off-screen pixels safely.
 	//       Because we store the final position in an unsigned value, this means that, to some extent,
 	//       we rely on wraparound on underflow to still point to (large, but positive) off-screen coordinates.
 	unsigned short int x_base_offs = (unsigned short int) ((col * FONTW) + pixel_offset + hoffset + viewHoriOrigin);
@@ -1073,7 +1354,6 @@ static struct mxcfb_rect
 
 	unsigned short int i;
 	unsigned short int j;
-	unsigned short int cx;
 	unsigned short int cy;
 
 	// We'll also need to compute the amount of zero padding we'll want for logging...
@@ -1081,6 +1361,11 @@ static struct mxcfb_rect
 	// We cap at 5 because that should cover most sane use-cases.
 	int pad_len = zu_print_length(txtlength);
 
+	// In the common case (i.e., every pixel of the cell is painted), glyphs go through the glyph cache,
+	// so that we only have to expand each glyph once, instead of every single time it's printed.
+	const bool is_opaque       = !fbink_cfg->is_overlay && !fbink_cfg->is_bgless && !fbink_cfg->is_fgless;
+	const bool use_glyph_cache = is_opaque && prepare_glyph_cache(fgcolor, bgcolor);
+
 	// NOTE: Extra code duplication because the glyph's bitmap data type depends on the glyph's width,
 	//       so, one way or another, we have to duplicate the inner loops,
 	//       but we want to inline this *and* branch outside the loops,
@@ -1116,72 +1401,84 @@ static struct mxcfb_rect
 			// Crappy macro to avoid repeating myself in each branch...
 #define RENDER_GLYPH()                                                                                                   \
 	/* NOTE: We only need to loop on the base glyph's dimensions (i.e., the bitmap resolution), */                   \
-	/*       and from there compute the extra pixels for that single input pixel given our scaling factor... */      \
-	if (!fbink_cfg->is_overlay && !fbink_cfg->is_bgless && !fbink_cfg->is_fgless) {                                  \
+	/*       each input row is expanded horizontally by our scaling factor into a span of FONTW pixels, */           \
+	/*       which we then blit FONTSIZE_MULT times to handle the vertical scaling ;). */                            \
+	if (is_opaque) {                                                                                                 \
+		/* Every pixel is painted, so that's a single span per output row. */                                    \
+		/* And if the glyph is already in the cache, we can skip the expansion entirely ;). */                   \
+		bool              is_cached = false;                                                                     \
+		uint8_t* restrict cell      = use_glyph_cache ? fetch_cached_glyph(ch, &is_cached) : NULL;               \
 		for (uint8_t y = 0U; y < glyphHeight; y++) {                                                             \
 			/* y: input row, j: first output row after scaling */                                            \
-			j = (unsigned short int) (y * FONTSIZE_MULT);                                                    \
-			for (uint8_t x = 0U; x < glyphWidth; x++) {                                                      \
-				/* x: input column, i: first output column after scaling */                              \
-				i = (unsigned short int) (x * FONTSIZE_MULT);                                            \
-				/* Initial coordinates, before we generate the extra pixels from the scaling factor */   \
-				cx = (unsigned short int) (x_offs + i);                                                  \
-				cy = (unsigned short int) (y_offs + j);                                                  \
-				/* Each element encodes a full row, we access a column's bit in that row by shifting. */ \
-				if (bitmap[y] & 1U << x) {                                                               \
-					/* bit was set, pixel is fg! */                                                  \
-					/* Handle scaling by drawing a FONTSIZE_MULTpx square per pixel ;) */            \
-					fill_rect(cx, cy, FONTSIZE_MULT, FONTSIZE_MULT, &fgP);                           \
+			j  = (unsigned short int) (y * FONTSIZE_MULT);                                                   \
+			cy = (unsigned short int) (y_offs + j);                                                          \
+			if (!is_cached) {                                                                                \
+				for (uint8_t x = 0U; x < glyphWidth; x++) {                                              \
+					/* x: input column, i: first output column after scaling */                      \
+					i = (unsigned short int) (x * FONTSIZE_MULT);                                    \
+					/* Each element encodes a full row, */                                           \
+					/* we access a column's bit in that row by shifting. */                          \
+					/* If the bit was set, pixel is fg, otherwise, it's bg */                        \
+					memset(spanGrayBuff + i,                                                         \
+					       (bitmap[y] & 1U << x) ? fgcolor : bgcolor,                                \
+					       FONTSIZE_MULT);                                                           \
+				}                                                                                        \
+				if (cell) {                                                                              \
+					gray_to_native(spanGrayBuff, cell + (y * glyphCache.row_len), FONTW);            \
+				}                                                                                        \
+			}                                                                                                \
+			for (uint8_t l = 0U; l < FONTSIZE_MULT; l++) {                                                   \
+				coords.x = x_offs;                                                                       \
+				coords.y = (unsigned short int) (cy + l);                                                \
+				if (cell) {                                                                              \
+					put_native_span(coords, FONTW, cell + (y * glyphCache.row_len));                 \
 				} else {                                                                                 \
-					/* bit was unset, pixel is bg */                                                 \
-					fill_rect(cx, cy, FONTSIZE_MULT, FONTSIZE_MULT, &bgP);                           \
+					put_gray_span(coords, FONTW, spanGrayBuff);                                      \
 				}                                                                                        \
 			}                                                                                                \
 		}                                                                                                        \
 	} else {                                                                                                         \
-		FBInkPixel fbP     = { 0U };                                                                             \
-		bool       is_fgpx = false;                                                                              \
 		for (uint8_t y = 0U; y < glyphHeight; y++) {                                                             \
 			/* y: input row, j: first output row after scaling */                                            \
-			j = (unsigned short int) (y * FONTSIZE_MULT);                                                    \
+			j  = (unsigned short int) (y * FONTSIZE_MULT);                                                   \
+			cy = (unsigned short int) (y_offs + j);                                                          \
 			for (uint8_t x = 0U; x < glyphWidth; x++) {                                                      \
 				/* x: input column, i: first output column after scaling */                              \
 				i = (unsigned short int) (x * FONTSIZE_MULT);                                            \
-				/* Each element encodes a full row, we access a column's bit in that row by shifting. */ \
-				if (bitmap[y] & 1U << x) {                                                               \
-					/* bit was set, pixel is fg! */                                                  \
-					pxP     = &fgP;                                                                  \
-					is_fgpx = true;                                                                  \
-				} else {                                                                                 \
-					/* bit was unset, pixel is bg */                                                 \
-					pxP     = &bgP;                                                                  \
-					is_fgpx = false;                                                                 \
+				memset(spanGrayBuff + i, (bitmap[y] & 1U << x) ? fgcolor : bgcolor, FONTSIZE_MULT);      \
+			}                                                                                                \
+			/* Only some of the pixels are painted, so split the row into runs of fg or bg pixels */         \
+			uint8_t x = 0U;                                                                                  \
+			while (x < glyphWidth) {                                                                         \
+				const bool is_fgpx = !!(bitmap[y] & 1U << x);                                            \
+				uint8_t    run     = 1U;                                                                 \
+				while ((x + run) < glyphWidth && !!(bitmap[y] & 1U << (x + run)) == is_fgpx) {           \
+					run++;                                                                           \
 				}                                                                                        \
-				/* Initial coordinates, before we generate the extra pixels from the scaling factor */   \
-				cx = (unsigned short int) (x_offs + i);                                                  \
-				cy = (unsigned short int) (y_offs + j);                                                  \
+				i                                = (unsigned short int) (x * FONTSIZE_MULT);             \
+				const unsigned short int run_len = (unsigned short int) (run * FONTSIZE_MULT);           \
 				/* NOTE: Apply our scaling factor in both dimensions! */                                 \
 				for (uint8_t l = 0U; l < FONTSIZE_MULT; l++) {                                           \
-					for (uint8_t k = 0U; k < FONTSIZE_MULT; k++) {                                   \
-						coords.x = (unsigned short int) (cx + k);                                \
-						coords.y = (unsigned short int) (cy + l);                                \
-						/* In overlay mode, we only print foreground pixels, */                  \
-						/* and we print in the inverse color of the underlying pixel's */        \
-						/* Obviously, the closer we get to GRAY7, the less contrast we get */    \
-						if (is_fgpx && !fbink_cfg->is_fgless) {                                  \
-							if (fbink_cfg->is_overlay) {                                     \
-								get_pixel(coords, &fbP);                                 \
-								fbP.bgra.p ^= 0x00FFFFFFu;                               \
-								pxP = &fbP;                                              \
-								put_pixel(coords, pxP, false);                           \
-							} else {                                                         \
-								put_pixel(coords, pxP, true);                            \
+					coords.x = (unsigned short int) (x_offs + i);                                    \
+					coords.y = (unsigned short int) (cy + l);                                        \
+					/* In overlay mode, we only print foreground pixels, */                          \
+					/* and we print in the inverse color of the underlying pixel's */                \
+					/* Obviously, the closer we get to GRAY7, the less contrast we get */            \
+					if (is_fgpx && !fbink_cfg->is_fgless) {                                          \
+						if (fbink_cfg->is_overlay) {                                             \
+							get_span(coords, run_len, spanPixelBuff);                        \
+							for (unsigned short int k = 0U; k < run_len; k++) {              \
+								spanPixelBuff[k].bgra.p ^= 0x00FFFFFFu;                  \
 							}                                                                \
-						} else if (!is_fgpx && fbink_cfg->is_fgless) {                           \
-							put_pixel(coords, pxP, true);                                    \
+							put_span(coords, run_len, spanPixelBuff, false);                 \
+						} else {                                                                 \
+							put_gray_span(coords, run_len, spanGrayBuff + i);                \
 						}                                                                        \
+					} else if (!is_fgpx && fbink_cfg->is_fgless) {                                   \
+						put_gray_span(coords, run_len, spanGrayBuff + i);                        \
 					}                                                                                \
 				}                                                                                        \
+				x = (uint8_t) (x + run);                                                                 \
 			}                                                                                                \
 		}                                                                                                        \
 	}
@@ -1730,6 +2027,18 @@ static int
 		update.flags |= EPDC_FLAG_ENABLE_INVERSION;
 	}
 
+	// When presenting the back buffer, have the EPDC fetch the pixels straight from it (c.f., fbink_present).
+	// NOTE: Alternate update region dimensions must match screen update region dimensions.
+	//       (Yes, that's a straight quote from the driver :D).
+	// NOTE: virt_addr seems to be unused (in fact, it's gone from newer versions of the struct).
+	if (isPresentingBackBuffer) {
+		update.alt_buffer_data.phys_addr         = backBufferAddr;
+		update.alt_buffer_data.width             = vInfo.xres_virtual;
+		update.alt_buffer_data.height            = vInfo.yres;
+		update.alt_buffer_data.alt_update_region = region;
+		update.flags |= EPDC_FLAG_USE_ALT_BUFFER;
+	}
+
 	int rv = ioctl(fbfd, MXCFB_SEND_UPDATE_V1_NTX, &update);
 
 	if (rv < 0) {
@@ -1847,39 +2156,41 @@ static int
 // NOP when we don't have an eInk screen ;).
 static int
     refresh(int                     fbfd __attribute__((unused)),
-	    const struct mxcfb_rect region __attribute__((unused)),
+	    const struct mxcfb_rect region,
 	    uint32_t                waveform_mode __attribute__((unused)),
 	    int                     dithering_mode __attribute__((unused)),
 	    bool                    is_nightmode __attribute__((unused)),
 	    bool                    is_flashing __attribute__((unused)),
-	    bool                    no_refresh __attribute__((unused)))
+	    bool                    no_refresh)
 {
+	// Drawing to the back buffer doesn't change anything on screen (yet), remember where we drew, though.
+	if (isBackBufferActive) {
+		record_back_buffer_damage(&region);
+		return EXIT_SUCCESS;
+	}
+
+	// Unless we're drawing to a canvas, in which case we keep track of what would have been refreshed.
+	if (isCanvas && !no_refresh) {
+		record_canvas_refresh(&region);
+	}
 	return EXIT_SUCCESS;
 }
 #else
+// Actually send a refresh request to the EPDC
 static int
-    refresh(int fbfd,
-	    const struct mxcfb_rect region,
-	    uint32_t waveform_mode,
-	    int dithering_mode UNUSED_BY_CERVANTES UNUSED_BY_REMARKABLE,
-	    bool is_nightmode,
-	    bool is_flashing,
-	    bool no_refresh)
+    send_refresh(int fbfd,
+		 const struct mxcfb_rect region,
+		 uint32_t waveform_mode,
+		 int dithering_mode UNUSED_BY_CERVANTES UNUSED_BY_REMARKABLE,
+		 bool is_nightmode,
+		 bool is_flashing)
 {
-	// Were we asked to skip refreshes?
-	if (no_refresh) {
-		LOG("Skipping eInk refresh, as requested.");
+	// There's no EPDC behind a canvas, just keep track of what would have been refreshed.
+	if (isCanvas) {
+		record_canvas_refresh(&region);
 		return EXIT_SUCCESS;
 	}
 
-	// NOTE: Discard bogus regions, they can cause a softlock on some devices.
-	//       A 0x0 region is a no go on most devices, while a 1x1 region may only upset some Kindle models.
-	//       Some devices even balk at 1xN or Nx1, so, catch that, too.
-	if (region.width <= 1 || region.height <= 1) {
-		WARN("Discarding bogus empty region (%ux%u) to avoid a softlock", region.width, region.height);
-		return ERRCODE(EXIT_FAILURE);
-	}
-
 	// NOTE: There are also a number of hardware quirks (which got better on newer devices) related to region alignment,
 	//       that the driver should already be taking care of...
 	//       c.f., epdc_process_update @ mxc_epdc_fb.c or mxc_epdc_v2_fb.c
@@ -1941,6 +2252,166 @@ static int
 	}
 #	endif    // FBINK_FOR_KINDLE
 }
+
+// Check if two regions overlap (or, if slack is > 0, are at most slack pixels apart)
+static bool
+    regions_touch(const struct mxcfb_rect* restrict a, const struct mxcfb_rect* restrict b, uint32_t slack)
+{
+	return a->left <= b->left + b->width + slack && b->left <= a->left + a->width + slack &&
+	       a->top <= b->top + b->height + slack && b->top <= a->top + a->height + slack;
+}
+
+// Grow a region to encompass another
+static void
+    merge_regions(struct mxcfb_rect* restrict a, const struct mxcfb_rect* restrict b)
+{
+	const uint32_t right  = MAX(a->left + a->width, b->left + b->width);
+	const uint32_t bottom = MAX(a->top + a->height, b->top + b->height);
+	a->left               = MIN(a->left, b->left);
+	a->top                = MIN(a->top, b->top);
+	a->width              = right - a->left;
+	a->height             = bottom - a->top;
+}
+
+// Can these two requests be sent as a single update?
+static bool
+    are_refreshes_compatible(const FBInkRefreshRequest* restrict a, const FBInkRefreshRequest* restrict b)
+{
+	return a->waveform_mode == b->waveform_mode && a->dithering_mode == b->dithering_mode &&
+	       a->is_nightmode == b->is_nightmode && a->is_flashing == b->is_flashing;
+}
+
+// Drop an entry from the refresh queue, preserving the order of the others
+static void
+    dequeue_refresh(uint8_t idx)
+{
+	memmove(refreshQueue + idx, refreshQueue + idx + 1U, (size_t)(refreshQueueLen - idx - 1U) * sizeof(*refreshQueue));
+	refreshQueueLen--;
+}
+
+// Append a refresh request to the queue, merging it with compatible pending requests whenever possible.
+// NOTE: Updates are sent in queue order, and that order matters where incompatible updates overlap
+//       (i.e., the last one wins as far as the waveform mode goes), so we never let a merge reorder those.
+static int
+    queue_refresh(int                     fbfd,
+		  const struct mxcfb_rect region,
+		  uint32_t                waveform_mode,
+		  int                     dithering_mode,
+		  bool                    is_nightmode,
+		  bool                    is_flashing)
+{
+	FBInkRefreshRequest req = {
+		.region         = region,
+		.waveform_mode  = waveform_mode,
+		.dithering_mode = dithering_mode,
+		.is_nightmode   = is_nightmode,
+		.is_flashing    = is_flashing,
+	};
+
+	// Merge with anything we can, newest first, until we run out of candidates
+	bool merged;
+	do {
+		merged = false;
+		for (int i = refreshQueueLen - 1; i >= 0; i--) {
+			const FBInkRefreshRequest* restrict entry = refreshQueue + i;
+			if (!are_refreshes_compatible(&req, entry)) {
+				// We can't jump over an incompatible update we overlap with
+				if (regions_touch(&req.region, &entry->region, 0U)) {
+					break;
+				}
+				continue;
+			}
+			if (!regions_touch(&req.region, &entry->region, REFRESH_QUEUE_MERGE_SLACK)) {
+				continue;
+			}
+
+			// The merged region will take the place of our request, at the end of the queue,
+			// so make sure it doesn't end up overlapping an incompatible update queued after this entry.
+			struct mxcfb_rect merged_region = req.region;
+			merge_regions(&merged_region, &entry->region);
+			bool is_safe = true;
+			for (uint8_t j = (uint8_t)(i + 1); j < refreshQueueLen; j++) {
+				if (!are_refreshes_compatible(&req, refreshQueue + j) &&
+				    regions_touch(&merged_region, &refreshQueue[j].region, 0U)) {
+					is_safe = false;
+					break;
+				}
+			}
+			if (!is_safe) {
+				continue;
+			}
+
+			LOG("Merging refresh region %ux%u @ (%u, %u) with queued region %ux%u @ (%u, %u)",
+			    req.region.width,
+			    req.region.height,
+			    req.region.left,
+			    req.region.top,
+			    entry->region.width,
+			    entry->region.height,
+			    entry->region.left,
+			    entry->region.top);
+			req.region = merged_region;
+			dequeue_refresh((uint8_t) i);
+			merged = true;
+			break;
+		}
+	} while (merged);
+
+	// If the queue is full, send the oldest request right now to make room
+	int rv = EXIT_SUCCESS;
+	if (refreshQueueLen == REFRESH_QUEUE_SIZE) {
+		LOG("Refresh queue is full, sending the oldest request early");
+		const FBInkRefreshRequest* restrict oldest = refreshQueue;
+		rv = send_refresh(fbfd,
+				  oldest->region,
+				  oldest->waveform_mode,
+				  oldest->dithering_mode,
+				  oldest->is_nightmode,
+				  oldest->is_flashing);
+		dequeue_refresh(0U);
+	}
+
+	refreshQueue[refreshQueueLen++] = req;
+	return rv;
+}
+
+static int
+    refresh(int fbfd,
+	    const struct mxcfb_rect region,
+	    uint32_t waveform_mode,
+	    int dithering_mode UNUSED_BY_CERVANTES UNUSED_BY_REMARKABLE,
+	    bool is_nightmode,
+	    bool is_flashing,
+	    bool no_refresh)
+{
+	// Drawing to the back buffer doesn't change anything on screen (yet), so there's nothing to refresh,
+	// but we'll need to know what to present later on (c.f., fbink_present).
+	if (isBackBufferActive) {
+		record_back_buffer_damage(&region);
+		return EXIT_SUCCESS;
+	}
+
+	// Were we asked to skip refreshes?
+	if (no_refresh) {
+		LOG("Skipping eInk refresh, as requested.");
+		return EXIT_SUCCESS;
+	}
+
+	// NOTE: Discard bogus regions, they can cause a softlock on some devices.
+	//       A 0x0 region is a no go on most devices, while a 1x1 region may only upset some Kindle models.
+	//       Some devices even balk at 1xN or Nx1, so, catch that, too.
+	if (region.width <= 1 || region.height <= 1) {
+		WARN("Discarding bogus empty region (%ux%u) to avoid a softlock", region.width, region.height);
+		return ERRCODE(EXIT_FAILURE);
+	}
+
+	// In deferred mode, this'll only be sent on the next fbink_flush call
+	if (isRefreshDeferred) {
+		return queue_refresh(fbfd, region, waveform_mode, dithering_mode, is_nightmode, is_flashing);
+	}
+
+	return send_refresh(fbfd, region, waveform_mode, dithering_mode, is_nightmode, is_flashing);
+}
 #endif            // FBINK_FOR_LINUX
 
 // Same thing for WAIT_FOR_UPDATE_SUBMISSION requests...
@@ -2006,8 +2477,14 @@ int
 static int
     open_fb_fd(int* restrict fbfd, bool* restrict keep_fd)
 {
-	if (*fbfd == FBFD_AUTO) {
-		// If we're opening a fd now, don't keep it around.
+	// There's nothing to open when drawing to a canvas
+	if (isCanvas) {
+		*fbfd = FBFD_CANVAS;
+		return EXIT_SUCCESS;
+	}
+
+	if (*fbfd == FBFD_AUTO) {
+		// If we're opening a fd now, don't keep it around.
 		*keep_fd = false;
 		if (ERRCODE(EXIT_FAILURE) == (*fbfd = fbink_open())) {
 			WARN("Failed to open the framebuffer character device, aborting");
@@ -2024,6 +2501,11 @@ static int
 static int
     open_fb_fd_nonblock(int* restrict fbfd, bool* restrict keep_fd)
 {
+	if (isCanvas) {
+		*fbfd = FBFD_CANVAS;
+		return EXIT_SUCCESS;
+	}
+
 	if (*fbfd == FBFD_AUTO) {
 		// If we're opening a fd now, don't keep it around.
 		*keep_fd = false;
@@ -2089,10 +2571,12 @@ static int
 
 	// Start with some more generic stuff, not directly related to the framebuffer.
 	// As all this stuff is pretty much set in stone, we'll only query it once.
+	// NOTE: This is process-wide, so, make sure contexts being initialized concurrently don't trip on each other.
+	pthread_mutex_lock(&deviceIdLock);
 	if (!deviceQuirks.skipId) {
 #ifndef FBINK_FOR_LINUX
 		// Identify the device's specific model...
-		identify_device();
+		identify_device_cached(fbfd);
 #	if defined(FBINK_FOR_KINDLE)
 		if (deviceQuirks.isKindleLegacy) {
 			ELOG("Enabled Legacy einkfb Kindle quirks");
@@ -2138,9 +2622,11 @@ static int
 		// And make sure we won't do that again ;).
 		deviceQuirks.skipId = true;
 	}
+	pthread_mutex_unlock(&deviceIdLock);
 
 	// Get variable screen information (unless we were asked to skip it, because we've already populated it elsewhere)
-	if (!skip_vinfo) {
+	// NOTE: A canvas has no fb to query, fbink_open_canvas populated vInfo & fInfo already.
+	if (!skip_vinfo && !isCanvas) {
 		if (ioctl(fbfd, FBIOGET_VSCREENINFO, &vInfo)) {
 			WARN("Error reading variable fb information: %m");
 			rv = ERRCODE(EXIT_FAILURE);
@@ -2165,7 +2651,7 @@ static int
 #if defined(FBINK_FOR_KOBO) || defined(FBINK_FOR_CERVANTES)
 	// NOTE: This applies both to Kobo & Cervantes!
 	// Make sure we default to no rotation shenanigans, to avoid issues on reinit...
-	deviceQuirks.isNTX16bLandscape = false;
+	isNTX16bLandscape = false;
 	// NOTE: But in some very specific circumstances, that doesn't hold true...
 	//       In particular, Kobos boot with a framebuffer in Landscape orientation (i.e., xres > yres),
 	//       but a viewport in Portrait (the boot progress, as well as Nickel itself are presented in Portrait mode),
@@ -2178,7 +2664,8 @@ static int
 	//       In fact, if you manage to run *before* pickel (i.e., before on-animator),
 	//       you'll notice that it's in yet another rotation at very early boot (CCW?)...
 	// NOTE: The Libra finally appears to have put a stop to this madness (it boots UR, with an UR panel).
-	if (vInfo.xres > vInfo.yres) {
+	// NOTE: None of this applies to a canvas, which is always laid out exactly as requested.
+	if (!isCanvas && vInfo.xres > vInfo.yres) {
 		// NOTE: PW2:
 		//         vInfo.rotate == 2 in Landscape (vs. 3 in Portrait mode), w/ the xres/yres switch in Landscape,
 		//         and (0, 0) is always at the top-left of the viewport, so we're always correct.
@@ -2201,9 +2688,9 @@ static int
 		//       https://www.mobileread.com/forums/showthread.php?t=292914&page=16
 		if (vInfo.bits_per_pixel == 16U) {
 			// Correct screenWidth & screenHeight, so we do all our row/column arithmetics on the right values...
-			screenWidth                    = vInfo.yres;
-			screenHeight                   = vInfo.xres;
-			deviceQuirks.isNTX16bLandscape = true;
+			screenWidth       = vInfo.yres;
+			screenHeight      = vInfo.xres;
+			isNTX16bLandscape = true;
 			// NOTE: Here be dragons!
 			//       I'm assuming that most devices follow the same pattern as far as rotation is concerned,
 			//       with a few exceptions hardcoded (c.f., identify_kobo in fbink_device_id.c).
@@ -2256,9 +2743,9 @@ static int
 				//       current unofficial KSM 9 builds for the Forma are doing it wrong:
 				//       they're setting the rota to UR (i.e., like pickel on most !6.8" panels) instead of CCW.
 				// Correct screenWidth & screenHeight, so we do all our row/column arithmetics on the right values...
-				screenWidth                    = vInfo.yres;
-				screenHeight                   = vInfo.xres;
-				deviceQuirks.isNTX16bLandscape = true;
+				screenWidth       = vInfo.yres;
+				screenHeight      = vInfo.xres;
+				isNTX16bLandscape = true;
 				// We only care about the *pickel* state (mainly to avoid false-positives)
 				fxpRotateCoords = &rotate_coordinates_pickel;
 				fxpRotateRegion = &rotate_region_pickel;
@@ -2276,8 +2763,8 @@ static int
 	// Things should generally not be broken-by-design on the horizontal axis...
 	viewWidth      = screenWidth;
 	viewHoriOrigin = 0U;
-	// But on the vertical axis, oh my...
-	if (!fbink_cfg->no_viewport && deviceQuirks.koboVertOffset != 0) {
+	// But on the vertical axis, oh my... (A canvas has no hidden rows, though).
+	if (!fbink_cfg->no_viewport && !isCanvas && deviceQuirks.koboVertOffset != 0) {
 		viewHeight = screenHeight - (uint32_t) abs(deviceQuirks.koboVertOffset);
 		if (deviceQuirks.koboVertOffset > 0) {
 			// Rows of pixels are hidden at the top
@@ -2550,10 +3037,10 @@ static int
 
 	// Mention & remember if we can perfectly fit the final column on screen
 	if ((uint32_t)(FONTW * MAXCOLS) == viewWidth) {
-		deviceQuirks.isPerfectFit = true;
+		isPerfectFit = true;
 		ELOG("Horizontal fit is perfect!");
 	} else {
-		deviceQuirks.isPerfectFit = false;
+		isPerfectFit = false;
 	}
 
 	// In a similar fashion, add a vertical offset to make sure rows are vertically "centered",
@@ -2575,7 +3062,7 @@ static int
 	viewVertOrigin = (uint8_t)(viewVertOrigin + viewVertOffset);
 
 	// Get fixed screen information
-	if (ioctl(fbfd, FBIOGET_FSCREENINFO, &fInfo)) {
+	if (!isCanvas && ioctl(fbfd, FBIOGET_FSCREENINFO, &fInfo)) {
 		WARN("Error reading fixed fb information: %m");
 		rv = ERRCODE(EXIT_FAILURE);
 		goto cleanup;
@@ -2668,6 +3155,41 @@ static int
 			break;
 	}
 
+	// Drop the glyph cache if the cells it holds no longer match our font setup or pixel format
+	invalidate_glyph_cache(fbink_cfg->fontname);
+
+	// (Re)allocate the scratch buffers used by the span blitters, they need to be able to hold a full line of pixels.
+	// NOTE: A single glyph may technically be wider than the screen with silly font multipliers, so, account for that.
+	uint32_t span_len = MAX(screenWidth, FONTW);
+	if (span_len > spanBuffLen) {
+		uint8_t* tmp_gray_buff = realloc(spanGrayBuff, span_len * sizeof(*spanGrayBuff));
+		if (!tmp_gray_buff) {
+			WARN("realloc: %m");
+			rv = ERRCODE(ENOMEM);
+			goto cleanup;
+		}
+		spanGrayBuff = tmp_gray_buff;
+
+		FBInkPixel* tmp_pixel_buff = realloc(spanPixelBuff, span_len * sizeof(*spanPixelBuff));
+		if (!tmp_pixel_buff) {
+			WARN("realloc: %m");
+			rv = ERRCODE(ENOMEM);
+			goto cleanup;
+		}
+		spanPixelBuff = tmp_pixel_buff;
+		spanBuffLen   = span_len;
+	}
+
+#ifndef FBINK_FOR_KINDLE
+	// Let the layout watcher know what we're now expecting (it only tracks the default context's layout)
+	if (currentContext == &defaultContext && isFbWatcherActive && !isCanvas) {
+		pthread_mutex_lock(&fbWatcherLock);
+		fbWatcherBpp  = vInfo.bits_per_pixel;
+		fbWatcherRota = vInfo.rotate;
+		pthread_mutex_unlock(&fbWatcherLock);
+	}
+#endif
+
 	// NOTE: Do we want to keep the fb0 fd open, or simply close it for now?
 	//       Useful because we probably want to close it to keep open fds to a minimum when used as a library,
 	//       while wanting to avoid a useless open/close/open/close cycle when used as a standalone tool.
@@ -2728,49 +3250,62 @@ int
 	}
 
 	otInit = true;
-	// Open font from given path, and load into buffer
-	FILE*                   f    = fopen(filename, "r" STDIO_CLOEXEC);
-	unsigned char* restrict data = NULL;
-	if (!f) {
-		WARN("fopen: %m");
+	// Open font from given path, and map it
+	// NOTE: We map it read-only & private, instead of slurping it into the heap:
+	//       that way, only the tables we actually need get paged in, and they stay reclaimable page cache,
+	//       instead of dirty anonymous memory, which matters with multi-MB CJK fonts ;).
+	int fd = open(filename, O_RDONLY | O_CLOEXEC);
+	if (fd == -1) {
+		WARN("open: %m");
 		otInit = false;
 		return ERRCODE(EXIT_FAILURE);
-	} else {
-		int         fd = fileno(f);
-		struct stat st;
-		if (fstat(fd, &st) == -1) {
-			WARN("fstat: %m");
-			fclose(f);
-			otInit = false;
-			return ERRCODE(EXIT_FAILURE);
-		}
-		data = calloc((size_t) st.st_size, sizeof(*data));
-		if (!data) {
-			WARN("Error allocating font data buffer: %m");
-			fclose(f);
-			otInit = false;
-			return ERRCODE(EXIT_FAILURE);
-		}
-		if (fread(data, 1U, (size_t) st.st_size, f) < (size_t) st.st_size || ferror(f) != 0) {
-			free(data);
-			fclose(f);
-			otInit = false;
-			WARN("Error reading font file");
-			return ERRCODE(EXIT_FAILURE);
+	}
+	struct stat st;
+	if (fstat(fd, &st) == -1) {
+		WARN("fstat: %m");
+		close(fd);
+		otInit = false;
+		return ERRCODE(EXIT_FAILURE);
+	}
+	// mmap would choke on an empty file, and it'd be an invalid font anyway...
+	if (st.st_size <= 0) {
+		WARN("File '%s' is empty", filename);
+		close(fd);
+		otInit = false;
+		return ERRCODE(EXIT_FAILURE);
+	}
+	const size_t            data_len = (size_t) st.st_size;
+	unsigned char* restrict data     = mmap(NULL, data_len, PROT_READ, MAP_PRIVATE, fd, 0);
+	// NOTE: The mapping holds its own reference to the file, we don't need the fd anymore.
+	close(fd);
+	if (data == MAP_FAILED) {
+		WARN("mmap: %m");
+		otInit = false;
+		return ERRCODE(EXIT_FAILURE);
+	}
+	// Glyph lookups jump all over the place, so readahead may mostly be wasted I/O with large fonts.
+	// NOTE: That's storage & font dependent, though (and it disables readahead entirely),
+	//       so it's opt-in (c.f., FBINK_OT_MADV_RANDOM in fbink.h).
+	//       This is just a hint, so we don't really care if it fails.
+	const char* want_random = getenv("FBINK_OT_MADV_RANDOM");
+	if (want_random && *want_random) {
+		if (madvise(data, data_len, MADV_RANDOM) == -1) {
+			LOG("madvise: %m");
 		}
-		fclose(f);
 	}
-	stbtt_fontinfo* font_info = calloc(1U, sizeof(stbtt_fontinfo));
-	if (!font_info) {
+	FBInkOTFont* font = calloc(1U, sizeof(*font));
+	if (!font) {
 		WARN("Error allocating stbtt_fontinfo struct: %m");
-		free(data);
+		munmap(data, data_len);
 		return ERRCODE(EXIT_FAILURE);
 	}
+	font->data_len            = data_len;
+	stbtt_fontinfo* font_info = &font->info;
 	// First, check if we can actually find a recognizable font format in the data...
 	int fontcount = stbtt_GetNumberOfFonts(data);
 	if (fontcount == 0) {
-		free(data);
-		free(font_info);
+		munmap(data, data_len);
+		free(font);
 		WARN("File '%s' doesn't appear to be a valid or supported font", filename);
 		return ERRCODE(EXIT_FAILURE);
 	} else if (fontcount > 1) {
@@ -2781,16 +3316,16 @@ int
 	// Then, get the offset to the first font
 	int fontoffset = stbtt_GetFontOffsetForIndex(data, 0);
 	if (fontoffset == -1) {
-		free(data);
-		free(font_info);
+		munmap(data, data_len);
+		free(font);
 		WARN("File '%s' doesn't appear to contain valid font data at offset %d", filename, fontoffset);
 		return ERRCODE(EXIT_FAILURE);
 	}
 	// And finally, initialize that font
 	// NOTE: We took the long way 'round to try to avoid crashes on invalid data...
 	if (!stbtt_InitFont(font_info, data, fontoffset)) {
-		free(font_info->data);
-		free(font_info);
+		munmap(data, data_len);
+		free(font);
 		WARN("Error initialising font '%s'", filename);
 		return ERRCODE(EXIT_FAILURE);
 	}
@@ -2837,8 +3372,12 @@ static int
     free_ot_font(stbtt_fontinfo** restrict font_info)
 {
 	if (*font_info) {
-		free((*font_info)->data);    // This is the font data we loaded
-		free(*font_info);
+		// Don't leave glyphs rendered with this font in the cache, the pointer might get recycled...
+		ot_cache_drop_font(*font_info);
+		// NOTE: font_info is the first member of an FBInkOTFont, c.f., fbink_add_ot_font
+		FBInkOTFont* font = (FBInkOTFont*) *font_info;
+		munmap(font->info.data, font->data_len);    // This is the font data we mapped
+		free(font);
 		// Don't leave a dangling pointer
 		*font_info = NULL;
 
@@ -2847,6 +3386,259 @@ static int
 		return ERRCODE(EINVAL);
 	}
 }
+
+// Hash a glyph cache key into a bucket index
+static uint32_t
+    ot_cache_hash(const stbtt_fontinfo* font, float sf, int gi)
+{
+	uint32_t sf_bits;
+	memcpy(&sf_bits, &sf, sizeof(sf_bits));
+
+	// NOTE: Plain boost::hash_combine, which is plenty good enough for this...
+	uint32_t h = (uint32_t)((uintptr_t) font >> 4U);
+	h ^= sf_bits + 0x9E3779B9u + (h << 6U) + (h >> 2U);
+	h ^= (uint32_t) gi + 0x9E3779B9u + (h << 6U) + (h >> 2U);
+	return h & (OT_CACHE_BUCKETS - 1U);
+}
+
+// Size of a glyph's coverage mask, in bytes
+static size_t
+    ot_glyph_bitmap_len(const FBInkOTGlyph* restrict glyph)
+{
+	return (size_t)(glyph->x1 - glyph->x0) * (size_t)(glyph->y1 - glyph->y0);
+}
+
+// Unlink a glyph from the LRU list
+#	define OT_CACHE_LRU_UNLINK(glyph)                                                                              \
+		({                                                                                                       \
+			if ((glyph)->lru_prev) {                                                                         \
+				(glyph)->lru_prev->lru_next = (glyph)->lru_next;                                         \
+			} else {                                                                                         \
+				otCache.lru_head = (glyph)->lru_next;                                                    \
+			}                                                                                                \
+			if ((glyph)->lru_next) {                                                                         \
+				(glyph)->lru_next->lru_prev = (glyph)->lru_prev;                                         \
+			} else {                                                                                         \
+				otCache.lru_tail = (glyph)->lru_prev;                                                    \
+			}                                                                                                \
+			(glyph)->lru_prev = (glyph)->lru_next = NULL;                                                    \
+		})
+
+// And push it to the front (i.e., most recently used)
+#	define OT_CACHE_LRU_PUSH(glyph)                                                                                \
+		({                                                                                                       \
+			(glyph)->lru_prev = NULL;                                                                        \
+			(glyph)->lru_next = otCache.lru_head;                                                            \
+			if (otCache.lru_head) {                                                                          \
+				otCache.lru_head->lru_prev = (glyph);                                                    \
+			} else {                                                                                         \
+				otCache.lru_tail = (glyph);                                                              \
+			}                                                                                                \
+			otCache.lru_head = (glyph);                                                                      \
+		})
+
+// Drop a glyph from the cache
+static void
+    ot_cache_evict(FBInkOTGlyph* restrict glyph)
+{
+	// Unlink it from its bucket...
+	FBInkOTGlyph** link = &otCache.buckets[ot_cache_hash(glyph->font, glyph->sf, glyph->gi)];
+	while (*link && *link != glyph) {
+		link = &(*link)->hash_next;
+	}
+	if (*link) {
+		*link = glyph->hash_next;
+	}
+	// ... and from the LRU list
+	OT_CACHE_LRU_UNLINK(glyph);
+
+	otCache.size -= sizeof(*glyph);
+	if (glyph->bitmap) {
+		otCache.size -= ot_glyph_bitmap_len(glyph);
+	}
+	otCache.entries--;
+	free(glyph->bitmap);
+	free(glyph);
+}
+
+// Make sure we can fit size more bytes in the cache, evicting the least recently used glyphs as needed.
+// If keep is set, that glyph is never evicted.
+// Returns false if that's not possible.
+static bool
+    ot_cache_make_room(size_t size, const FBInkOTGlyph* restrict keep)
+{
+	if (size > otCache.max_size) {
+		return false;
+	}
+
+	while (otCache.size + size > otCache.max_size) {
+		FBInkOTGlyph* victim = otCache.lru_tail;
+		if (victim == keep) {
+			victim = victim->lru_prev;
+		}
+		if (!victim) {
+			return false;
+		}
+		ot_cache_evict(victim);
+		otCache.evictions++;
+	}
+
+	return true;
+}
+
+// Drop every glyph rendered with a specific font (i.e., because that font is about to go away)
+static void
+    ot_cache_drop_font(const stbtt_fontinfo* font)
+{
+	FBInkOTGlyph* glyph = otCache.lru_head;
+	while (glyph) {
+		FBInkOTGlyph* next = glyph->lru_next;
+		if (glyph->font == font) {
+			ot_cache_evict(glyph);
+		}
+		glyph = next;
+	}
+}
+
+// Drop everything
+static void
+    ot_cache_flush(void)
+{
+	while (otCache.lru_head) {
+		ot_cache_evict(otCache.lru_head);
+	}
+	free(otCache.buckets);
+	otCache.buckets = NULL;
+
+	free(otCache.scratch_buff);
+	otCache.scratch_buff   = NULL;
+	otCache.scratch_len    = 0U;
+	otCache.scratch.bitmap = NULL;
+}
+
+// Returns the metrics (and, if need_bitmap is true, the coverage mask) for a specific glyph,
+// rendered with a specific font, at a specific scale factor, from the cache if possible.
+// NOTE: The returned glyph is only guaranteed to be valid until the next call.
+//       Returns NULL on OOM.
+static const FBInkOTGlyph*
+    ot_cache_get_glyph(const stbtt_fontinfo* font, float sf, int gi, bool need_bitmap)
+{
+	FBInkOTGlyph* glyph = NULL;
+
+	// Do we already know about this one?
+	if (otCache.buckets) {
+		for (glyph = otCache.buckets[ot_cache_hash(font, sf, gi)]; glyph; glyph = glyph->hash_next) {
+			if (glyph->font == font && glyph->gi == gi && glyph->sf == sf) {
+				break;
+			}
+		}
+	}
+
+	if (glyph) {
+		// Move it to the front of the LRU list
+		OT_CACHE_LRU_UNLINK(glyph);
+		OT_CACHE_LRU_PUSH(glyph);
+
+		// NOTE: Spaces & co have an empty bounding box, so there's nothing to render in the first place.
+		if (!need_bitmap || glyph->bitmap || ot_glyph_bitmap_len(glyph) == 0U) {
+			otCache.hits++;
+			return glyph;
+		}
+
+		// We only have its metrics, render it
+		otCache.misses++;
+		const size_t len = ot_glyph_bitmap_len(glyph);
+		if (ot_cache_make_room(len, glyph)) {
+			glyph->bitmap = malloc(len);
+			if (glyph->bitmap) {
+				const int gw = glyph->x1 - glyph->x0;
+				const int gh = glyph->y1 - glyph->y0;
+				stbtt_MakeGlyphBitmap(font, glyph->bitmap, gw, gh, gw, sf, sf, gi);
+				otCache.size += len;
+				return glyph;
+			}
+		}
+		// That didn't pan out, use the scratch glyph
+		otCache.scratch = *glyph;
+	} else {
+		otCache.misses++;
+
+		otCache.scratch.font = font;
+		otCache.scratch.sf   = sf;
+		otCache.scratch.gi   = gi;
+		stbtt_GetGlyphHMetrics(font, gi, &otCache.scratch.adv, &otCache.scratch.lsb);
+		stbtt_GetGlyphBitmapBox(font,
+					gi,
+					sf,
+					sf,
+					&otCache.scratch.x0,
+					&otCache.scratch.y0,
+					&otCache.scratch.x1,
+					&otCache.scratch.y1);
+
+		// Try to cache it
+		if (!otCache.buckets && otCache.max_size > 0U) {
+			otCache.buckets = calloc(OT_CACHE_BUCKETS, sizeof(*otCache.buckets));
+		}
+		const size_t len = need_bitmap ? ot_glyph_bitmap_len(&otCache.scratch) : 0U;
+		if (otCache.buckets && ot_cache_make_room(sizeof(*glyph) + len, NULL)) {
+			glyph = malloc(sizeof(*glyph));
+			if (glyph) {
+				*glyph         = otCache.scratch;
+				glyph->bitmap  = NULL;
+				bool is_usable = true;
+				if (len > 0U) {
+					glyph->bitmap = malloc(len);
+					if (glyph->bitmap) {
+						const int gw = glyph->x1 - glyph->x0;
+						const int gh = glyph->y1 - glyph->y0;
+						stbtt_MakeGlyphBitmap(font, glyph->bitmap, gw, gh, gw, sf, sf, gi);
+					} else {
+						free(glyph);
+						is_usable = false;
+					}
+				}
+				if (is_usable) {
+					const uint32_t bucket   = ot_cache_hash(font, sf, gi);
+					glyph->hash_next        = otCache.buckets[bucket];
+					otCache.buckets[bucket] = glyph;
+					OT_CACHE_LRU_PUSH(glyph);
+					otCache.size += sizeof(*glyph) + len;
+					otCache.entries++;
+					return glyph;
+				}
+			}
+		}
+		// Couldn't cache it, so it lives in the scratch glyph, which is all set, save for the bitmap
+		if (!need_bitmap) {
+			otCache.scratch.bitmap = NULL;
+			return &otCache.scratch;
+		}
+	}
+
+	// Render it in the scratch glyph's own buffer
+	// NOTE: We've just clobbered the bitmap pointer with the cached glyph's, if any, so, don't trust it!
+	const size_t len       = ot_glyph_bitmap_len(&otCache.scratch);
+	otCache.scratch.bitmap = NULL;
+	if (len > otCache.scratch_len) {
+		unsigned char* tmp_buff = realloc(otCache.scratch_buff, len);
+		if (!tmp_buff) {
+			WARN("realloc: %m");
+			return NULL;
+		}
+		otCache.scratch_buff = tmp_buff;
+		otCache.scratch_len  = len;
+	}
+	if (len > 0U) {
+		const int gw = otCache.scratch.x1 - otCache.scratch.x0;
+		const int gh = otCache.scratch.y1 - otCache.scratch.y0;
+		stbtt_MakeGlyphBitmap(font, otCache.scratch_buff, gw, gh, gw, sf, sf, gi);
+		otCache.scratch.bitmap = otCache.scratch_buff;
+	}
+	return &otCache.scratch;
+}
+#	undef OT_CACHE_LRU_UNLINK
+#	undef OT_CACHE_LRU_PUSH
 #endif    // FBINK_WITH_OPENTYPE
 
 // Free all OpenType fonts
@@ -2866,6 +3658,52 @@ int
 	if (free_ot_font(&otFonts.otBoldItalic) == EXIT_SUCCESS) {
 		LOG("Released Bold Italic font data");
 	}
+	// NOTE: free_ot_font already took care of the glyphs, this just releases the rest of the cache's memory.
+	ot_cache_flush();
+
+	return EXIT_SUCCESS;
+#else
+	WARN("OpenType support is disabled in this FBInk build");
+	return ERRCODE(ENOSYS);
+#endif    // FBINK_WITH_OPENTYPE
+}
+
+// Set the memory budget of the OpenType glyph cache
+int
+    fbink_set_ot_cache_size(size_t max_size UNUSED_BY_MINIMAL)
+{
+#ifdef FBINK_WITH_OPENTYPE
+	otCache.max_size = max_size;
+	// Evict whatever doesn't fit anymore
+	ot_cache_make_room(0U, NULL);
+	if (max_size == 0U) {
+		ot_cache_flush();
+	}
+	LOG("OpenType glyph cache budget set to %zu bytes", max_size);
+
+	return EXIT_SUCCESS;
+#else
+	WARN("OpenType support is disabled in this FBInk build");
+	return ERRCODE(ENOSYS);
+#endif    // FBINK_WITH_OPENTYPE
+}
+
+// Report the OpenType glyph cache's counters
+int
+    fbink_get_ot_cache_stats(FBInkOTCacheStats* restrict stats UNUSED_BY_MINIMAL)
+{
+#ifdef FBINK_WITH_OPENTYPE
+	if (!stats) {
+		WARN("No stats struct to fill");
+		return ERRCODE(EINVAL);
+	}
+
+	stats->hits      = otCache.hits;
+	stats->misses    = otCache.misses;
+	stats->evictions = otCache.evictions;
+	stats->entries   = otCache.entries;
+	stats->size      = otCache.size;
+	stats->max_size  = otCache.max_size;
 
 	return EXIT_SUCCESS;
 #else
@@ -2874,6 +3712,19 @@ int
 #endif    // FBINK_WITH_OPENTYPE
 }
 
+// Release the scratch arena
+size_t
+    fbink_trim_scratch(void)
+{
+	// NOTE: Nothing's ever handed out between API calls, so it's always safe to drop.
+	const size_t size = scratchArena.size;
+	free(scratchArena.base);
+	scratchArena = (FBInkScratchArena){ 0U };
+	LOG("Released %zu bytes of scratch memory", size);
+
+	return size;
+}
+
 // Dump a few of our internal state variables to stdout, for shell script consumption
 void
     fbink_state_dump(const FBInkConfig* fbink_cfg)
@@ -2899,7 +3750,7 @@ void
 	    glyphHeight,
 	    MAXCOLS,
 	    MAXROWS,
-	    deviceQuirks.isPerfectFit,
+	    isPerfectFit,
 	    fInfo.id,
 	    USER_HZ,
 	    penFGColor,
@@ -2911,7 +3762,7 @@ void
 	    deviceQuirks.isKoboNonMT,
 	    deviceQuirks.ntxBootRota,
 	    deviceQuirks.ntxRotaQuirk,
-	    deviceQuirks.isNTX16bLandscape,
+	    isNTX16bLandscape,
 	    vInfo.rotate,
 	    deviceQuirks.canRotate);
 }
@@ -2947,11 +3798,11 @@ void
 		fbink_state->fontsize_mult           = FONTSIZE_MULT;
 		fbink_state->glyph_width             = glyphWidth;
 		fbink_state->glyph_height            = glyphHeight;
-		fbink_state->is_perfect_fit          = deviceQuirks.isPerfectFit;
+		fbink_state->is_perfect_fit          = isPerfectFit;
 		fbink_state->is_kobo_non_mt          = deviceQuirks.isKoboNonMT;
 		fbink_state->ntx_boot_rota           = deviceQuirks.ntxBootRota;
 		fbink_state->ntx_rota_quirk          = deviceQuirks.ntxRotaQuirk;
-		fbink_state->is_ntx_quirky_landscape = deviceQuirks.isNTX16bLandscape;
+		fbink_state->is_ntx_quirky_landscape = isNTX16bLandscape;
 		fbink_state->current_rota            = (uint8_t) vInfo.rotate;
 		fbink_state->can_rotate              = deviceQuirks.canRotate;
 	} else {
@@ -2959,6 +3810,32 @@ void
 	}
 }
 
+// Report a few details about how device identification went
+int
+    fbink_get_device_id_stats(FBInkDeviceIdStats* restrict stats UNUSED_BY_LINUX)
+{
+#ifndef FBINK_FOR_LINUX
+	pthread_mutex_lock(&deviceIdLock);
+	const bool is_identified = deviceQuirks.skipId;
+	pthread_mutex_unlock(&deviceIdLock);
+	if (!is_identified) {
+		WARN("Device identification hasn't happened yet");
+		return ERRCODE(ENODATA);
+	}
+	if (!stats) {
+		WARN("FBInkDeviceIdStats expected. Got NULL pointer instead");
+		return ERRCODE(EINVAL);
+	}
+
+	// NOTE: This is set in stone once identification is done, no need to hold the lock.
+	*stats = deviceIdStats;
+	return EXIT_SUCCESS;
+#else
+	WARN("Device identification is disabled in this FBInk build");
+	return ERRCODE(ENOSYS);
+#endif    // !FBINK_FOR_LINUX
+}
+
 // Memory map the framebuffer
 static int
     memmap_fb(int fbfd)
@@ -2969,6 +3846,12 @@ static int
 	//              but I've yet to see that be an issue with what I'm doing,
 	//              and trusting it is much simpler than trying to outsmart broken fb setup info...
 	//       See also the Cervantes quirk documented in clear_screen...
+	// NOTE: A canvas is already in memory, so, just point to it ;).
+	if (isCanvas) {
+		fbPtr      = canvasBuff;
+		isFbMapped = true;
+		return EXIT_SUCCESS;
+	}
 	fbPtr = (unsigned char*) mmap(NULL, fInfo.smem_len, PROT_READ | PROT_WRITE, MAP_SHARED, fbfd, 0);
 	if (fbPtr == MAP_FAILED) {
 		WARN("mmap: %m");
@@ -2985,6 +3868,17 @@ static int
 static int
     unmap_fb(void)
 {
+	// The back buffer doesn't outlive the mapping (and fbPtr needs to point to the actual mapping again).
+	if (isBackBufferActive) {
+		release_back_buffer();
+	}
+
+	if (isCanvas) {
+		isFbMapped = false;
+		fbPtr      = NULL;
+		return EXIT_SUCCESS;
+	}
+
 	if (munmap(fbPtr, fInfo.smem_len) < 0) {
 		WARN("munmap: %m");
 		return ERRCODE(EXIT_FAILURE);
@@ -3011,7 +3905,15 @@ int
 		}
 	}
 
-	if (fbfd != FBFD_AUTO) {
+	// Closing a canvas means releasing it, and going back to the real framebuffer
+	if (isCanvas) {
+		free(canvasBuff);
+		canvasBuff = NULL;
+		isCanvas   = false;
+	}
+
+	// NOTE: fbfd might still be a real fb fd, opened before the canvas was, so don't skip closing it.
+	if (fbfd != FBFD_AUTO && fbfd != FBFD_CANVAS) {
 		if (close(fbfd) < 0) {
 			WARN("close: %m");
 			return ERRCODE(EXIT_FAILURE);
@@ -3151,31 +4053,216 @@ static void
 	lastRect.height = (unsigned short int) region->height;
 }
 
-// Magic happens here!
+// Keep track of what we would have refreshed, had we not been drawing to a canvas
+static void
+    record_canvas_refresh(const struct mxcfb_rect* restrict region)
+{
+	if (canvasRefreshCount == 0U) {
+		canvasDamage.left   = (unsigned short int) region->left;
+		canvasDamage.top    = (unsigned short int) region->top;
+		canvasDamage.width  = (unsigned short int) region->width;
+		canvasDamage.height = (unsigned short int) region->height;
+	} else {
+		const uint32_t right =
+		    MAX((uint32_t)(canvasDamage.left + canvasDamage.width), region->left + region->width);
+		const uint32_t bottom =
+		    MAX((uint32_t)(canvasDamage.top + canvasDamage.height), region->top + region->height);
+		canvasDamage.left   = (unsigned short int) MIN((uint32_t) canvasDamage.left, region->left);
+		canvasDamage.top    = (unsigned short int) MIN((uint32_t) canvasDamage.top, region->top);
+		canvasDamage.width  = (unsigned short int) (right - canvasDamage.left);
+		canvasDamage.height = (unsigned short int) (bottom - canvasDamage.top);
+	}
+	canvasRefreshCount++;
+	LOG("Recorded canvas refresh of region %ux%u @ (%u, %u)", region->width, region->height, region->left, region->top);
+}
+
+// Switch to an off-screen canvas
 int
-    fbink_print(int fbfd, const char* restrict string, const FBInkConfig* fbink_cfg)
+    fbink_open_canvas(uint32_t width, uint32_t height, uint8_t bpp, uint8_t rota)
 {
-	// Abort if we were passed an empty string
-	if (!*string) {
-		// Unless we just want a clear, in which case, bypass everything and just do that.
-		if (fbink_cfg->is_cleared) {
-			return fbink_cls(fbfd, fbink_cfg, NULL);
-		} else {
-			WARN("Cannot print an empty string");
+	switch (bpp) {
+		case 4U:
+			if (width & 1U) {
+				WARN("Canvas width must be even at 4bpp");
+				return ERRCODE(EINVAL);
+			}
+			break;
+		case 8U:
+		case 16U:
+		case 24U:
+		case 32U:
+			break;
+		default:
+			WARN("Unsupported canvas bitdepth: %hhu", bpp);
 			return ERRCODE(EINVAL);
+	}
+	// NOTE: Our coordinates are unsigned shorts...
+	if (width == 0U || height == 0U || width > UINT16_MAX || height > UINT16_MAX) {
+		WARN("Unsupported canvas size: %ux%u", width, height);
+		return ERRCODE(EINVAL);
+	}
+	// NOTE: vInfo.rotate is purely informational (it's only ever honored by the fb driver itself),
+	//       so we'd have nothing to apply a rotation with. Canvases are always upright.
+	if (rota != FB_ROTATE_UR) {
+		WARN("Unsupported canvas rotation: %hhu (%s)", rota, fb_rotate_to_string(rota));
+		return ERRCODE(EINVAL);
+	}
+
+	// Drop the previous one, if any
+	if (isCanvas) {
+		fbink_close(FBFD_CANVAS);
+	} else if (isFbMapped) {
+		// Don't leak a mapping of the real fb, we won't know how to unmap it anymore
+		unmap_fb();
+	}
+
+	const uint32_t line_length = (width * bpp) >> 3U;
+	unsigned char* buff        = calloc((size_t) line_length * height, sizeof(*buff));
+	if (!buff) {
+		WARN("Error allocating canvas buffer: %m");
+		return ERRCODE(ENOMEM);
+	}
+
+	// Fake what the fb ioctls would have told us
+	memset(&vInfo, 0, sizeof(vInfo));
+	vInfo.xres           = width;
+	vInfo.yres           = height;
+	vInfo.xres_virtual   = width;
+	vInfo.yres_virtual   = height;
+	vInfo.bits_per_pixel = bpp;
+	vInfo.grayscale      = (bpp <= 8U) ? 1U : 0U;
+	vInfo.rotate         = FB_ROTATE_UR;
+	memset(&fInfo, 0, sizeof(fInfo));
+	strncpy(fInfo.id, "FBInk canvas", sizeof(fInfo.id) - 1U);
+	fInfo.smem_len    = line_length * height;
+	fInfo.line_length = line_length;
+
+	canvasBuff         = buff;
+	canvasRefreshCount = 0U;
+	canvasDamage       = (FBInkRect){ 0U };
+	isCanvas           = true;
+	ELOG("Opened a %ux%u @ %hhubpp off-screen canvas", width, height, bpp);
+
+	return FBFD_CANVAS;
+}
+
+// Public getter for the canvas buffer & its refresh bookkeeping
+int
+    fbink_get_canvas_info(FBInkCanvas* restrict canvas, bool reset_damage)
+{
+	if (!isCanvas) {
+		WARN("No canvas is currently open");
+		return ERRCODE(ENODEV);
+	}
+
+	canvas->data          = canvasBuff;
+	canvas->size          = fInfo.smem_len;
+	canvas->width         = vInfo.xres;
+	canvas->height        = vInfo.yres;
+	canvas->stride        = fInfo.line_length;
+	canvas->bpp           = (uint8_t) vInfo.bits_per_pixel;
+	canvas->rota          = (uint8_t) vInfo.rotate;
+	canvas->refresh_count = canvasRefreshCount;
+	canvas->damage        = canvasDamage;
+
+	if (reset_damage) {
+		canvasRefreshCount = 0U;
+		canvasDamage       = (FBInkRect){ 0U };
+	}
+
+	return EXIT_SUCCESS;
+}
+
+// Keep track of what was drawn to the back buffer since the last present
+static void
+    record_back_buffer_damage(const struct mxcfb_rect* restrict region)
+{
+	if (region->width == 0U || region->height == 0U) {
+		return;
+	}
+
+	if (backDamage.width == 0U || backDamage.height == 0U) {
+		backDamage = *region;
+	} else {
+		const uint32_t right  = MAX(backDamage.left + backDamage.width, region->left + region->width);
+		const uint32_t bottom = MAX(backDamage.top + backDamage.height, region->top + region->height);
+		backDamage.left       = MIN(backDamage.left, region->left);
+		backDamage.top        = MIN(backDamage.top, region->top);
+		backDamage.width      = right - backDamage.left;
+		backDamage.height     = bottom - backDamage.top;
+	}
+}
+
+// Go back to drawing to the front buffer, discarding anything that wasn't presented
+static void
+    release_back_buffer(void)
+{
+	if (backBuffFd != -1) {
+		munmap(fbPtr, backBuffLen);
+		close(backBuffFd);
+		backBuffFd  = -1;
+		backBuffLen = 0U;
+	}
+	fbPtr    = frontPtr;
+	frontPtr = NULL;
+	free(backBuff);
+	backBuff   = NULL;
+	backDamage = (struct mxcfb_rect){ 0U };
+#ifdef FBINK_FOR_KOBO
+	backBufferAddr = 0U;
+#endif
+	isBackBufferActive = false;
+}
+
+// Create an anonymous shared memory file of the requested size
+static int
+    create_shared_fd(size_t size)
+{
+	int fd = -1;
+#ifdef SYS_memfd_create
+	// NOTE: We go through syscall, as the glibc wrapper is much too recent for some of our TCs (2.27).
+	fd = (int) syscall(SYS_memfd_create, "fbink-back-buffer", MFD_CLOEXEC | MFD_ALLOW_SEALING);
+#endif
+	const bool is_memfd = (fd != -1);
+	// memfd requires Linux 3.17, so, fall back to an unlinked temporary file on older kernels.
+	if (fd == -1) {
+		char tmpl[] = "/tmp/fbink-back-buffer.XXXXXX";
+		fd          = mkostemp(tmpl, O_CLOEXEC);
+		if (fd == -1) {
+			WARN("mkostemp: %m");
+			return -1;
 		}
+		unlink(tmpl);
 	}
 
-	// Abort if we were passed an invalid UTF-8 sequence
-	size_t len       = strlen(string);    // Flawfinder: ignore
-	size_t charcount = u8_strlen2(string);
-	if (charcount == 0) {
-		WARN("Cannot print an invalid UTF-8 sequence");
-		return ERRCODE(EILSEQ);
+	if (ftruncate(fd, (off_t) size) == -1) {
+		WARN("ftruncate: %m");
+		close(fd);
+		return -1;
 	}
 
-	// If we open a fd now, we'll only keep it open for this single print call!
-	// NOTE: We *expect* to be initialized at this point, though, but that's on the caller's hands!
+	// NOTE: Lock the size down before the fd ever leaves the process:
+	//       whoever we share it with could otherwise truncate it under our mapping, and get us killed by a SIGBUS.
+	//       (That's unfortunately not possible with the tmpfile fallback).
+	if (is_memfd && fcntl(fd, F_ADD_SEALS, F_SEAL_SHRINK | F_SEAL_GROW) == -1) {
+		WARN("fcntl (F_ADD_SEALS): %m");
+		close(fd);
+		return -1;
+	}
+
+	return fd;
+}
+
+// Redirect all drawing to a back buffer (optionally backed by shared memory), until fbink_release_back_buffer
+static int
+    setup_back_buffer(int fbfd, bool is_shared)
+{
+	if (isBackBufferActive && (!is_shared || backBuffFd != -1)) {
+		LOG("Already drawing to the back buffer");
+		return EXIT_SUCCESS;
+	}
+
+	// Open the framebuffer if need be...
 	bool keep_fd = true;
 	if (open_fb_fd(&fbfd, &keep_fd) != EXIT_SUCCESS) {
 		return ERRCODE(EXIT_FAILURE);
@@ -3183,11 +4270,15 @@ int
 
 	// Assume success, until shit happens ;)
 	int rv = EXIT_SUCCESS;
-	// We need to declare this early (& sentinel it to NULL) to make our cleanup jumps safe
-	char* restrict line = NULL;
 
-	// map fb to user mem
-	// NOTE: If we're keeping the fb's fd open, keep this mmap around, too.
+	// NOTE: The back buffer can't outlive the fb mapping, which only survives across calls with a long-lived fd.
+	if (!keep_fd) {
+		WARN("Double-buffering requires a persistent framebuffer fd (c.f., fbink_open)");
+		rv = ERRCODE(ENOTSUP);
+		goto cleanup;
+	}
+
+	// mmap the fb if need be...
 	if (!isFbMapped) {
 		if (memmap_fb(fbfd) != EXIT_SUCCESS) {
 			rv = ERRCODE(EXIT_FAILURE);
@@ -3195,9 +4286,353 @@ int
 		}
 	}
 
-	// NOTE: Make copies of these so we don't wreck our original struct, since we passed it by reference,
-	//       and we *will* heavily mangle these two...
-	short int col = fbink_cfg->col;
+	const size_t   buff_len  = (size_t) fInfo.line_length * vInfo.yres_virtual;
+	unsigned char* back      = NULL;
+	int            shared_fd = -1;
+	if (is_shared) {
+		// NOTE: Even when there's spare fb memory, clients can't get at it, so, this is always a shadow buffer.
+		shared_fd = create_shared_fd(buff_len);
+		if (shared_fd == -1) {
+			rv = ERRCODE(EXIT_FAILURE);
+			goto cleanup;
+		}
+		back = mmap(NULL, buff_len, PROT_READ | PROT_WRITE, MAP_SHARED, shared_fd, 0);
+		if (back == MAP_FAILED) {
+			WARN("mmap: %m");
+			close(shared_fd);
+			rv = ERRCODE(EXIT_FAILURE);
+			goto cleanup;
+		}
+		LOG("Using a %zu bytes shared buffer as the back buffer", buff_len);
+	}
+#ifdef FBINK_FOR_KOBO
+	// NOTE: On Mk. 3 to 6 devices, smem_len may be large enough to fit a second buffer after the first one,
+	//       in which case the EPDC can refresh straight from it (c.f., utils/alt_buffer.c).
+	//       Since yoffset is always 0, it simply starts at yres_virtual * line_length.
+	if (!back && !isCanvas && !deviceQuirks.isKoboMk7 && fInfo.smem_len >= 2U * buff_len) {
+		back           = fbPtr + buff_len;
+		backBufferAddr = (uint32_t)(fInfo.smem_start + buff_len);
+		LOG("Using the spare framebuffer memory @ %#x as the back buffer", backBufferAddr);
+	}
+#endif
+	// Otherwise, we'll just have to make do with a shadow buffer.
+	if (!back) {
+		backBuff = malloc(buff_len);
+		if (!backBuff) {
+			WARN("Error allocating the back buffer: %m");
+			rv = ERRCODE(ENOMEM);
+			goto cleanup;
+		}
+		back = backBuff;
+		LOG("Using a %zu bytes shadow buffer as the back buffer", buff_len);
+	}
+
+	// Start from what's currently on screen, so that drawing only part of a frame makes sense.
+	// (Or from the current back buffer, if we're just moving it to shared memory).
+	memcpy(back, fbPtr, buff_len);
+
+	if (isBackBufferActive) {
+		free(backBuff);
+		backBuff = NULL;
+#ifdef FBINK_FOR_KOBO
+		backBufferAddr = 0U;
+#endif
+	} else {
+		frontPtr   = fbPtr;
+		backDamage = (struct mxcfb_rect){ 0U };
+	}
+	fbPtr              = back;
+	backBuffFd         = shared_fd;
+	backBuffLen        = is_shared ? buff_len : 0U;
+	isBackBufferActive = true;
+
+	// Cleanup
+cleanup:
+	if (isFbMapped && !keep_fd) {
+		unmap_fb();
+	}
+	if (!keep_fd) {
+		close(fbfd);
+	}
+
+	return rv;
+}
+
+// Redirect all drawing to a back buffer, until fbink_release_back_buffer
+int
+    fbink_get_back_buffer(int fbfd)
+{
+	return setup_back_buffer(fbfd, false);
+}
+
+// Same, but in shared memory, so that other processes can draw to it, too
+int
+    fbink_share_back_buffer(int fbfd, FBInkSharedBuffer* restrict shared)
+{
+	const int rv = setup_back_buffer(fbfd, true);
+	if (rv != EXIT_SUCCESS) {
+		return rv;
+	}
+
+	shared->fd     = backBuffFd;
+	shared->size   = backBuffLen;
+	shared->width  = vInfo.xres;
+	shared->height = vInfo.yres;
+	shared->stride = fInfo.line_length;
+	shared->bpp    = (uint8_t) vInfo.bits_per_pixel;
+	shared->rota   = (uint8_t) vInfo.rotate;
+
+	return EXIT_SUCCESS;
+}
+
+// Put (part of) the back buffer on screen
+int
+    fbink_present(int fbfd, const FBInkRect* restrict rect, const FBInkConfig* restrict fbink_cfg)
+{
+	if (!isBackBufferActive) {
+		WARN("Not drawing to a back buffer (c.f., fbink_get_back_buffer)");
+		return ERRCODE(ENOTSUP);
+	}
+
+	// Open the framebuffer if need be...
+	bool keep_fd = true;
+	if (open_fb_fd(&fbfd, &keep_fd) != EXIT_SUCCESS) {
+		return ERRCODE(EXIT_FAILURE);
+	}
+
+	// Assume success, until shit happens ;)
+	int rv = EXIT_SUCCESS;
+
+	// No region means everything we've drawn since the last present
+	struct mxcfb_rect region = backDamage;
+	if (rect && rect->width != 0U && rect->height != 0U) {
+		region.top    = rect->top;
+		region.left   = rect->left;
+		region.width  = rect->width;
+		region.height = rect->height;
+	} else {
+		backDamage = (struct mxcfb_rect){ 0U };
+	}
+	// Clamp it to the screen
+	region.left   = MIN(region.left, vInfo.xres);
+	region.top    = MIN(region.top, vInfo.yres);
+	region.width  = MIN(region.width, vInfo.xres - region.left);
+	region.height = MIN(region.height, vInfo.yres - region.top);
+	if (region.width == 0U || region.height == 0U) {
+		LOG("Nothing to present");
+		goto cleanup;
+	}
+
+	const uint32_t waveform_mode = get_wfm_mode(fbink_cfg->wfm_mode);
+	const int      dithering_mode =
+	    fbink_cfg->is_dithered ? EPDC_FLAG_USE_DITHERING_ORDERED : EPDC_FLAG_USE_DITHERING_PASSTHROUGH;
+	bool is_refreshed = false;
+#ifdef FBINK_FOR_KOBO
+	// If the back buffer lives in fb memory, refresh straight from it *before* touching the front buffer,
+	// so that nothing in-flight can catch it half-copied.
+	// NOTE: The EPDC only fetches the pixels when it actually processes the update, so, don't draw over that region
+	//       before it's done (e.g., fbink_wait_for_complete w/ fbink_get_last_marker) if you want to be *really* safe.
+	// NOTE: This bypasses the deferred refresh queue, as the alt buffer flag only makes sense right now.
+	if (backBufferAddr != 0U && !isRefreshDeferred && !fbink_cfg->no_refresh) {
+		isPresentingBackBuffer = true;
+		rv = send_refresh(fbfd, region, waveform_mode, dithering_mode, fbink_cfg->is_nightmode, fbink_cfg->is_flashing);
+		isPresentingBackBuffer = false;
+		is_refreshed           = true;
+	}
+#endif
+
+	// Sync the front buffer, so that it matches what's on screen
+	// NOTE: At 4bpp, two pixels share a byte, so, round outwards.
+	const size_t start = (region.left * vInfo.bits_per_pixel) >> 3U;
+	const size_t end   = ((region.left + region.width) * vInfo.bits_per_pixel + 7U) >> 3U;
+	for (uint32_t j = region.top; j < region.top + region.height; j++) {
+		const size_t offset = (size_t) fInfo.line_length * j + start;
+		memcpy(frontPtr + offset, fbPtr + offset, end - start);
+	}
+
+	// And refresh it the usual way
+	if (!is_refreshed) {
+		// NOTE: refresh() would only record damage while the back buffer is active ;).
+		isBackBufferActive = false;
+		rv = refresh(fbfd,
+			     region,
+			     waveform_mode,
+			     dithering_mode,
+			     fbink_cfg->is_nightmode,
+			     fbink_cfg->is_flashing,
+			     fbink_cfg->no_refresh);
+		isBackBufferActive = true;
+	}
+	if (rv != EXIT_SUCCESS) {
+		WARN("Failed to refresh the screen");
+		rv = ERRCODE(EXIT_FAILURE);
+		goto cleanup;
+	}
+
+	// Cleanup
+cleanup:
+	if (!keep_fd) {
+		close(fbfd);
+	}
+
+	return rv;
+}
+
+// Go back to drawing directly to the screen
+int
+    fbink_release_back_buffer(int fbfd __attribute__((unused)))
+{
+	if (!isBackBufferActive) {
+		WARN("Not drawing to a back buffer (c.f., fbink_get_back_buffer)");
+		return ERRCODE(ENOTSUP);
+	}
+
+	if (backDamage.width != 0U && backDamage.height != 0U) {
+		LOG("Discarding %ux%u @ (%u, %u) of unpresented back buffer content",
+		    backDamage.width,
+		    backDamage.height,
+		    backDamage.left,
+		    backDamage.top);
+	}
+	release_back_buffer();
+
+	return EXIT_SUCCESS;
+}
+
+// Remember where the scratch arena currently stands
+static FBInkScratchMark
+    scratch_mark(void)
+{
+	return (FBInkScratchMark){ .used         = scratchArena.used,
+				   .overflow     = scratchArena.overflow,
+				   .overflow_len = scratchArena.overflow_len };
+}
+
+// Hand out size bytes of (uninitialized) scratch memory, valid until the matching scratch_release
+static void*
+    scratch_alloc(size_t size)
+{
+	// Keep everything suitably aligned (which also ensures we never hand out the same pointer twice).
+	const size_t align = sizeof(FBInkScratchBlock);
+	if (size > SIZE_MAX - align) {
+		WARN("Scratch allocation of %zu bytes is too large", size);
+		return NULL;
+	}
+	size = ((size + align - 1U) / align) * align;
+	if (size == 0U) {
+		size = align;
+	}
+
+	const size_t total = scratchArena.used + scratchArena.overflow_len + size;
+	if (total > scratchArena.peak) {
+		scratchArena.peak = total;
+	}
+
+	// If nothing's handed out, now's our chance to grow the arena to the largest amount we've ever needed,
+	// so that, from then on, calls of that size never go through the allocator again.
+	if (scratchArena.used == 0U && !scratchArena.overflow && scratchArena.peak > scratchArena.size) {
+		free(scratchArena.base);
+		scratchArena.base = malloc(scratchArena.peak);
+		scratchArena.size = scratchArena.base ? scratchArena.peak : 0U;
+		LOG("Grew the scratch arena to %zu bytes", scratchArena.size);
+	}
+
+	if (size <= scratchArena.size - scratchArena.used) {
+		void* ptr = scratchArena.base + scratchArena.used;
+		scratchArena.used += size;
+		return ptr;
+	}
+
+	// It doesn't fit (we can't move the arena while it's in use), so this one gets its own block, for now.
+	FBInkScratchBlock* block = malloc(sizeof(*block) + size);
+	if (!block) {
+		WARN("malloc: %m");
+		return NULL;
+	}
+	block->next               = scratchArena.overflow;
+	scratchArena.overflow     = block;
+	scratchArena.overflow_len += size;
+	return block + 1;
+}
+
+// Same, but zero-initialized, like calloc
+static void*
+    scratch_calloc(size_t nmemb, size_t size)
+{
+	if (size != 0U && nmemb > SIZE_MAX / size) {
+		WARN("Scratch allocation of %zu * %zu bytes is too large", nmemb, size);
+		return NULL;
+	}
+
+	void* ptr = scratch_alloc(nmemb * size);
+	if (ptr) {
+		memset(ptr, 0, nmemb * size);
+	}
+	return ptr;
+}
+
+// Give back everything that was handed out since mark
+// NOTE: The arena itself is kept around for the next call (c.f., fbink_trim_scratch).
+static void
+    scratch_release(FBInkScratchMark mark)
+{
+	while (scratchArena.overflow != mark.overflow) {
+		FBInkScratchBlock* next = scratchArena.overflow->next;
+		free(scratchArena.overflow);
+		scratchArena.overflow = next;
+	}
+	scratchArena.overflow_len = mark.overflow_len;
+	scratchArena.used         = mark.used;
+}
+
+// Magic happens here!
+int
+    fbink_print(int fbfd, const char* restrict string, const FBInkConfig* fbink_cfg)
+{
+	// Abort if we were passed an empty string
+	if (!*string) {
+		// Unless we just want a clear, in which case, bypass everything and just do that.
+		if (fbink_cfg->is_cleared) {
+			return fbink_cls(fbfd, fbink_cfg, NULL);
+		} else {
+			WARN("Cannot print an empty string");
+			return ERRCODE(EINVAL);
+		}
+	}
+
+	// Abort if we were passed an invalid UTF-8 sequence
+	size_t len       = strlen(string);    // Flawfinder: ignore
+	size_t charcount = u8_strlen2(string);
+	if (charcount == 0) {
+		WARN("Cannot print an invalid UTF-8 sequence");
+		return ERRCODE(EILSEQ);
+	}
+
+	// If we open a fd now, we'll only keep it open for this single print call!
+	// NOTE: We *expect* to be initialized at this point, though, but that's on the caller's hands!
+	bool keep_fd = true;
+	if (open_fb_fd(&fbfd, &keep_fd) != EXIT_SUCCESS) {
+		return ERRCODE(EXIT_FAILURE);
+	}
+
+	// Assume success, until shit happens ;)
+	int rv = EXIT_SUCCESS;
+	// We need to declare this early (& sentinel it to NULL) to make our cleanup jumps safe
+	char* restrict         line    = NULL;
+	const FBInkScratchMark scratch = scratch_mark();
+
+	// map fb to user mem
+	// NOTE: If we're keeping the fb's fd open, keep this mmap around, too.
+	if (!isFbMapped) {
+		if (memmap_fb(fbfd) != EXIT_SUCCESS) {
+			rv = ERRCODE(EXIT_FAILURE);
+			goto cleanup;
+		}
+	}
+
+	// NOTE: Make copies of these so we don't wreck our original struct, since we passed it by reference,
+	//       and we *will* heavily mangle these two...
+	short int col = fbink_cfg->col;
 	short int row = fbink_cfg->row;
 
 	// NOTE: If we asked to print in the middle of the screen, make the specified row an offset from the middle of the screen,
@@ -3267,7 +4702,7 @@ int
 	if (fbink_cfg->is_centered) {
 		// One for the left padding
 		available_cols = (unsigned short int) (available_cols - 1U);
-		if (deviceQuirks.isPerfectFit) {
+		if (isPerfectFit) {
 			// And one for the right padding
 			available_cols = (unsigned short int) (available_cols - 1U);
 			// NOTE: If that makes us fall to 0 (because of high font scaling),
@@ -3308,9 +4743,9 @@ int
 	// NOTE: Store that on the heap, we've had some wacky adventures with automatic VLAs...
 	// NOTE: UTF-8 is at most 4 bytes per sequence, make sure we can fit a full line of UTF-8,
 	//       (+ 1 'wide' NULL, wide to make sure u8_strlen won't skip over it).
-	line = calloc((MAXCOLS + 1U) * 4U, sizeof(*line));
+	line = scratch_calloc((MAXCOLS + 1U) * 4U, sizeof(*line));
 	if (line == NULL) {
-		WARN("line calloc: %m");
+		WARN("line buffer could not be allocated");
 		rv = ERRCODE(EXIT_FAILURE);
 		goto cleanup;
 	}
@@ -3320,8 +4755,7 @@ int
 	//       sequence would trip it into counting bogus characters.
 	//       And as snprintf() only NULL-terminates what it expects to be a non-wide string,
 	//       it's not filling the end of the buffer with NULLs, it just outputs a single one!
-	//       That's why we're also using calloc here.
-	//       Plus, the OS will ensure that'll always be smarter than malloc + memset ;).
+	//       That's why we're also zero-initializing it here.
 	// NOTE: Since we re-use line on each iteration of the loop,
 	//       we do also need to clear it at the end of the loop, in preparation of the next iteration.
 
@@ -3566,7 +5000,7 @@ int
 
 	// Cleanup
 cleanup:
-	free(line);
+	scratch_release(scratch);
 	if (isFbMapped && !keep_fd) {
 		unmap_fb();
 	}
@@ -3648,10 +5082,11 @@ int
 	// Rely on vsnprintf itself to tell us exactly how many bytes it needs ;).
 	// c.f., vsnprintf(3) && stdarg(3) && https://stackoverflow.com/q/10069597
 	// (especially as far as the va_start/va_end bracketing is concerned)
-	int            ret    = -1;
-	size_t         size   = 0;
-	char* restrict buffer = NULL;
-	va_list        args;
+	int                    ret     = -1;
+	size_t                 size    = 0;
+	char* restrict         buffer  = NULL;
+	const FBInkScratchMark scratch = scratch_mark();
+	va_list                args;
 
 	// Initial vsnprintf run on a zero length NULL pointer, just to determine the required buffer size
 	// NOTE: see vsnprintf(3), this is a C99 behavior made canon in POSIX.1-2001, honored since glibc 2.1
@@ -3668,11 +5103,11 @@ int
 
 	// We need enough space for NULL-termination (which we make 'wide' for u8 reasons) :).
 	size = (size_t)(ret + 4);
-	// NOTE: We use calloc to make sure it'll always be zero-initialized,
-	//       and the OS is smart enough to make it fast if we don't use the full space anyway (CoW zeroing).
-	buffer = calloc(size, sizeof(*buffer));
+	// NOTE: Make sure it'll always be zero-initialized, for the sake of that wide NULL.
+	//       This comes from the scratch arena, which the print call we forward it to will simply build on top of.
+	buffer = scratch_calloc(size, sizeof(*buffer));
 	if (buffer == NULL) {
-		WARN("calloc: %m");
+		WARN("Formatted string buffer could not be allocated");
 		rv = ERRCODE(EXIT_FAILURE);
 		goto cleanup;
 	}
@@ -3706,10 +5141,92 @@ int
 
 	// Cleanup
 cleanup:
-	free(buffer);
+	scratch_release(scratch);
 	return rv;
 }
 
+#ifdef FBINK_WITH_OPENTYPE
+// Compute the printable area (in absolute coordinates) defined by an FBInkOTConfig's margins
+static int
+    ot_compute_area(const FBInkOTConfig* restrict cfg, FBInkCoordinates* restrict tl, FBInkCoordinates* restrict br)
+{
+	// Handle negative margins (meaning count backwards from the opposite edge)
+	// NOTE: Obviously makes more sense for top & left than for bottom & right.
+	unsigned short int top_margin = 0U;
+	if (cfg->margins.top >= 0) {
+		top_margin = (unsigned short int) cfg->margins.top;
+	} else {
+		top_margin = (unsigned short int) MAX(0, (int) viewHeight - abs(cfg->margins.top));
+		LOG("Adjusted top margin to %hupx", top_margin);
+	}
+	unsigned short int bottom_margin = 0U;
+	if (cfg->margins.bottom >= 0) {
+		bottom_margin = (unsigned short int) cfg->margins.bottom;
+	} else {
+		bottom_margin = (unsigned short int) MAX(0, (int) viewHeight - abs(cfg->margins.bottom));
+		LOG("Adjusted bottom margin to %hupx", bottom_margin);
+	}
+	unsigned short int left_margin = 0U;
+	if (cfg->margins.left >= 0) {
+		left_margin = (unsigned short int) cfg->margins.left;
+	} else {
+		left_margin = (unsigned short int) MAX(0, (int) viewWidth - abs(cfg->margins.left));
+		LOG("Adjusted left margin to %hupx", left_margin);
+	}
+	unsigned short int right_margin = 0U;
+	if (cfg->margins.right >= 0) {
+		right_margin = (unsigned short int) cfg->margins.right;
+	} else {
+		right_margin = (unsigned short int) MAX(0, (int) viewWidth - abs(cfg->margins.right));
+		LOG("Adjusted right margin to %hupx", right_margin);
+	}
+
+	// Sanity check the provided margins and calculate the printable area.
+	// We'll cap the margin at 100% for each side, and margins for opposing edges should sum to less than 100%
+	if (top_margin >= viewHeight || bottom_margin >= viewHeight || left_margin >= viewWidth ||
+	    right_margin >= viewWidth) {
+		WARN("A margin was out of range (allowed ranges :: Vert < %u  Horiz < %u)", viewHeight, viewWidth);
+		return ERRCODE(ERANGE);
+	}
+	if ((top_margin + bottom_margin) >= viewHeight || (left_margin + right_margin) >= viewWidth) {
+		WARN("Opposing margins sum to greater than the viewport height or width");
+		return ERRCODE(ERANGE);
+	}
+	tl->x = left_margin;
+	tl->y = (unsigned short int) (top_margin + (viewVertOrigin - viewVertOffset));
+	br->x = (unsigned short int) (viewWidth - right_margin);
+	br->y = (unsigned short int) (viewHeight - bottom_margin);
+
+	return EXIT_SUCCESS;
+}
+
+// Compute the font size (in pixels) requested by an FBInkOTConfig
+static unsigned short int
+    ot_get_font_size_px(const FBInkOTConfig* restrict cfg)
+{
+	// Font size can be specified in pixels or in points. Pixels take precedence.
+	unsigned short int font_size_px = cfg->size_px;
+	// If it wasn't specified in pixels, then it was specified in points (which is also how the default is handled).
+	if (font_size_px == 0U) {
+		// Set default font size if required
+		float size_pt = cfg->size_pt;
+		// NOTE: Technically, using the iszero() macro ought to be enough (at least for values coming from our CLI tool),
+		//       but of course, it wasn't yet available in the glibc versions we target (as it's from TS 18661-1:2014)...
+		//       c.f., https://www.gnu.org/software/libc/manual/html_node/Floating-Point-Classes.html#Floating-Point-Classes
+		if (!isnormal(size_pt)) {
+			size_pt = 12.0f;
+		}
+		// We should have a fairly accurate idea of what the screen DPI is...
+		unsigned short int ppi = deviceQuirks.screenDPI;
+		// Given the ppi, convert point height to pixels. Note, 1pt is 1/72th of an inch
+		font_size_px = (unsigned short int) iroundf(ppi / 72.0f * size_pt);
+	}
+
+	return font_size_px;
+}
+
+#endif    // FBINK_WITH_OPENTYPE
+
 int
     fbink_print_ot(int fbfd                              UNUSED_BY_MINIMAL,
 		   const char* restrict string           UNUSED_BY_MINIMAL,
@@ -3759,11 +5276,12 @@ int
 	int rv = EXIT_SUCCESS;
 
 	// Declare buffers early to make cleanup easier
+	// NOTE: They all come from the scratch arena, and are given back in one go on cleanup.
 	FBInkOTLine* restrict   lines      = NULL;
 	char* restrict          brk_buff   = NULL;
 	unsigned char* restrict fmt_buff   = NULL;
 	unsigned char*          line_buff  = NULL;
-	unsigned char*          glyph_buff = NULL;
+	const FBInkScratchMark  scratch    = scratch_mark();
 	// This also needs to be declared early, as we refresh on cleanup.
 	struct mxcfb_rect region       = { 0U };
 	bool              is_flashing  = false;
@@ -3791,79 +5309,19 @@ int
 
 	LOG("Printing OpenType text.");
 
-	// Handle negative margins (meaning count backwards from the opposite edge)
-	// NOTE: Obviously makes more sense for top & left than for bottom & right.
-	unsigned short int top_margin = 0U;
-	if (cfg->margins.top >= 0) {
-		top_margin = (unsigned short int) cfg->margins.top;
-	} else {
-		top_margin = (unsigned short int) MAX(0, (int) viewHeight - abs(cfg->margins.top));
-		LOG("Adjusted top margin to %hupx", top_margin);
-	}
-	unsigned short int bottom_margin = 0U;
-	if (cfg->margins.bottom >= 0) {
-		bottom_margin = (unsigned short int) cfg->margins.bottom;
-	} else {
-		bottom_margin = (unsigned short int) MAX(0, (int) viewHeight - abs(cfg->margins.bottom));
-		LOG("Adjusted bottom margin to %hupx", bottom_margin);
-	}
-	unsigned short int left_margin = 0U;
-	if (cfg->margins.left >= 0) {
-		left_margin = (unsigned short int) cfg->margins.left;
-	} else {
-		left_margin = (unsigned short int) MAX(0, (int) viewWidth - abs(cfg->margins.left));
-		LOG("Adjusted left margin to %hupx", left_margin);
-	}
-	unsigned short int right_margin = 0U;
-	if (cfg->margins.right >= 0) {
-		right_margin = (unsigned short int) cfg->margins.right;
-	} else {
-		right_margin = (unsigned short int) MAX(0, (int) viewWidth - abs(cfg->margins.right));
-		LOG("Adjusted right margin to %hupx", right_margin);
-	}
-
-	// Sanity check the provided margins and calculate the printable area.
-	// We'll cap the margin at 100% for each side, and margins for opposing edges should sum to less than 100%
-	if (top_margin >= viewHeight || bottom_margin >= viewHeight || left_margin >= viewWidth ||
-	    right_margin >= viewWidth) {
-		WARN("A margin was out of range (allowed ranges :: Vert < %u  Horiz < %u)", viewHeight, viewWidth);
-		rv = ERRCODE(ERANGE);
-		goto cleanup;
-	}
-	if ((top_margin + bottom_margin) >= viewHeight || (left_margin + right_margin) >= viewWidth) {
-		WARN("Opposing margins sum to greater than the viewport height or width");
-		rv = ERRCODE(ERANGE);
-		goto cleanup;
-	}
-#	pragma GCC diagnostic push
-#	pragma GCC diagnostic ignored "-Wmissing-braces"
-	struct
-	{
-		FBInkCoordinates tl;
-		FBInkCoordinates br;
-	} area = { 0U };
-#	pragma GCC diagnostic pop
-	area.tl.x = left_margin;
-	area.tl.y = (unsigned short int) (top_margin + (viewVertOrigin - viewVertOffset));
-	area.br.x = (unsigned short int) (viewWidth - right_margin);
-	area.br.y = (unsigned short int) (viewHeight - bottom_margin);
-	// Font size can be specified in pixels or in points. Pixels take precedence.
-	unsigned short int font_size_px = cfg->size_px;
-	// If it wasn't specified in pixels, then it was specified in points (which is also how the default is handled).
-	if (font_size_px == 0U) {
-		// Set default font size if required
-		float size_pt = cfg->size_pt;
-		// NOTE: Technically, using the iszero() macro ought to be enough (at least for values coming from our CLI tool),
-		//       but of course, it wasn't yet available in the glibc versions we target (as it's from TS 18661-1:2014)...
-		//       c.f., https://www.gnu.org/software/libc/manual/html_node/Floating-Point-Classes.html#Floating-Point-Classes
-		if (!isnormal(size_pt)) {
-			size_pt = 12.0f;
-		}
-		// We should have a fairly accurate idea of what the screen DPI is...
-		unsigned short int ppi = deviceQuirks.screenDPI;
-		// Given the ppi, convert point height to pixels. Note, 1pt is 1/72th of an inch
-		font_size_px = (unsigned short int) iroundf(ppi / 72.0f * size_pt);
+#	pragma GCC diagnostic push
+#	pragma GCC diagnostic ignored "-Wmissing-braces"
+	struct
+	{
+		FBInkCoordinates tl;
+		FBInkCoordinates br;
+	} area = { 0U };
+#	pragma GCC diagnostic pop
+	rv = ot_compute_area(cfg, &area.tl, &area.br);
+	if (rv != EXIT_SUCCESS) {
+		goto cleanup;
 	}
+	const unsigned short int font_size_px = ot_get_font_size_px(cfg);
 
 	// This is a pointer to whichever font is currently active. It gets updated for every character in the loop, as needed.
 	stbtt_fontinfo* restrict curr_font = NULL;
@@ -3998,9 +5456,9 @@ int
 	num_lines    = print_height / (unsigned int) max_row_height;
 
 	// And allocate the memory for it...
-	lines = calloc(num_lines, sizeof(FBInkOTLine));
+	lines = scratch_calloc(num_lines, sizeof(FBInkOTLine));
 	if (!lines) {
-		WARN("Lines metadata buffer could not be allocated: %m");
+		WARN("Lines metadata buffer could not be allocated");
 		rv = ERRCODE(EXIT_FAILURE);
 		goto cleanup;
 	}
@@ -4008,9 +5466,10 @@ int
 	// Now, lets use libunibreak to find the possible break opportunities in our string.
 
 	// Note: we only care about the byte length here
-	brk_buff = calloc(str_len_bytes + 1U, sizeof(*brk_buff));
+	// NOTE: libunibreak fills it entirely, so there's no need to clear it.
+	brk_buff = scratch_alloc((str_len_bytes + 1U) * sizeof(*brk_buff));
 	if (!brk_buff) {
-		WARN("Linebreak buffer could not be allocated: %m");
+		WARN("Linebreak buffer could not be allocated");
 		rv = ERRCODE(EXIT_FAILURE);
 		goto cleanup;
 	}
@@ -4020,9 +5479,9 @@ int
 
 	// Parse our string for formatting, if requested
 	if (cfg->is_formatted) {
-		fmt_buff = calloc(str_len_bytes + 1U, sizeof(*fmt_buff));
+		fmt_buff = scratch_calloc(str_len_bytes + 1U, sizeof(*fmt_buff));
 		if (!fmt_buff) {
-			WARN("Formatted text buffer could not be allocated: %m");
+			WARN("Formatted text buffer could not be allocated");
 			rv = ERRCODE(EXIT_FAILURE);
 			goto cleanup;
 		}
@@ -4031,18 +5490,20 @@ int
 	}
 	// Lets find our lines! Nothing fancy, just a simple first fit algorithm, but we do our best not to break inside a word.
 
-	size_t             c_index     = 0U;
-	size_t             tmp_c_index = c_index;
-	uint32_t           c;
-	int                gi;
-	unsigned short int max_lw = (unsigned short int) (area.br.x - area.tl.x);
-	unsigned int       line;
-	int                max_line_height = max_row_height - max_lg;
+	size_t              c_index     = 0U;
+	size_t              tmp_c_index = c_index;
+	uint32_t            c;
+	int                 gi;
+	const FBInkOTGlyph* glyph;
+	unsigned short int  max_lw = (unsigned short int) (area.br.x - area.tl.x);
+	unsigned int        line;
+	int                 max_line_height = max_row_height - max_lg;
 	// adv = advance: the horizontal distance along the baseline to the origin of the next glyph
 	// lsb = left side bearing: The horizontal distance from the origin point to left edge of the glyph
 	// NOTE: We're not doing anything with lsb, we're honoring stbtt_GetGlyphBitmapBox's x0 instead.
 	//       Rounding method aside, they should roughly match.
-	int          adv, lsb, curr_x;
+	//       (The glyph cache still keeps it around, though).
+	int          adv, curr_x;
 	bool         complete_str = false;
 	int          x0, y0, x1, y1, gw, gh, cx, cy;
 	unsigned int lw = 0U;
@@ -4113,11 +5574,20 @@ int
 			c = u8_nextchar2(string, &c_index);
 			// Get the glyph index now, instead of having to look it up each time
 			gi = stbtt_FindGlyphIndex(curr_font, (int) c);
+			// We only need the metrics for now, not the bitmap
+			glyph = ot_cache_get_glyph(curr_font, sf, gi, false);
+			if (!glyph) {
+				rv = ERRCODE(ENOMEM);
+				goto cleanup;
+			}
 			// Note, these metrics are unscaled,
 			// we need to use our previously obtained scale factor (sf) to get the metrics as pixels
-			stbtt_GetGlyphHMetrics(curr_font, gi, &adv, &lsb);
+			adv = glyph->adv;
 			// But these are already scaled
-			stbtt_GetGlyphBitmapBox(curr_font, gi, sf, sf, &x0, &y0, &x1, &y1);
+			x0 = glyph->x0;
+			y0 = glyph->y0;
+			x1 = glyph->x1;
+			y1 = glyph->y1;
 			gw = x1 - x0;
 			// Ensure that curr_x never goes negative
 			cx = curr_x;
@@ -4318,12 +5788,10 @@ int
 	// Create a bitmap buffer to render a single line.
 	// We don't render the glyphs directly to the fb here, as we need to do some simple blending,
 	// and it makes it easier to calculate our centering if required.
-	line_buff = calloc(max_lw * (size_t) max_line_height, sizeof(*line_buff));
-	// We also don't want to be creating a new buffer for every glyph, so make it roomy, just in case...
-	size_t glyph_buffer_dims = font_size_px * (size_t) max_line_height * 2U;
-	glyph_buff               = calloc(glyph_buffer_dims, sizeof(*glyph_buff));
-	if (!line_buff || !glyph_buff) {
-		WARN("Line or glyph buffers could not be allocated: %m");
+	// NOTE: Glyphs themselves are rendered (and kept around) by the glyph cache.
+	line_buff = scratch_calloc(max_lw * (size_t) max_line_height, sizeof(*line_buff));
+	if (!line_buff) {
+		WARN("Line buffer could not be allocated");
 		rv = ERRCODE(EXIT_FAILURE);
 		goto cleanup;
 	}
@@ -4353,15 +5821,12 @@ int
 	const uint8_t   fgcolor    = penFGColor ^ invert;
 	const uint8_t   bgcolor    = penBGColor ^ invert;
 	const short int layer_diff = (short int) (fgcolor - bgcolor);
-	FBInkPixel      fgP        = penFGPixel;
 	FBInkPixel      bgP        = penBGPixel;
 	if (is_inverted) {
 		// NOTE: And, of course, RGB565 is terrible. Inverting the lossy packed value would be even lossier...
 		if (vInfo.bits_per_pixel == 16U) {
-			fgP.rgb565 = pack_rgb565(fgcolor, fgcolor, fgcolor);
 			bgP.rgb565 = pack_rgb565(bgcolor, bgcolor, bgcolor);
 		} else {
-			fgP.bgra.p ^= 0x00FFFFFFu;
 			bgP.bgra.p ^= 0x00FFFFFFu;
 		}
 	}
@@ -4436,24 +5901,19 @@ int
 			curr_point.y = ins_point.y = (unsigned short int) max_baseline;
 			c                          = u8_nextchar2(string, &ci);
 			gi                         = stbtt_FindGlyphIndex(curr_font, (int) c);
-			stbtt_GetGlyphHMetrics(curr_font, gi, &adv, &lsb);
-			stbtt_GetGlyphBitmapBox(curr_font, gi, sf, sf, &x0, &y0, &x1, &y1);
-			gw = x1 - x0;
-			gh = y1 - y0;
-			// Ensure that our glyph size does not exceed the buffer size. Resize the buffer if it does
-			if ((gw * gh) > (int) glyph_buffer_dims) {
-				size_t new_buff_size = (size_t) gw * (size_t) gh * 2U * sizeof(*glyph_buff);
-				LOG("Growing glyph buffer size from %zu to %zu", glyph_buffer_dims, new_buff_size);
-				unsigned char* tmp_g_buff = NULL;
-				tmp_g_buff                = realloc(glyph_buff, new_buff_size);
-				if (!tmp_g_buff) {
-					ELOG("Failure resizing glyph buffer");
-					rv = ERRCODE(EXIT_FAILURE);
-					goto cleanup;
-				}
-				glyph_buff        = tmp_g_buff;
-				glyph_buffer_dims = new_buff_size;
+			// NOTE: No need to render anything if it would be invisible anyway...
+			glyph = ot_cache_get_glyph(curr_font, sf, gi, fgcolor != bgcolor);
+			if (!glyph) {
+				rv = ERRCODE(ENOMEM);
+				goto cleanup;
 			}
+			adv = glyph->adv;
+			x0  = glyph->x0;
+			y0  = glyph->y0;
+			x1  = glyph->x1;
+			y1  = glyph->y1;
+			gw  = x1 - x0;
+			gh  = y1 - y0;
 			// Make sure we don't have an underflow/wrap around
 			cx = (int) curr_point.x;
 			if (cx + x0 < 0) {
@@ -4529,17 +5989,12 @@ int
 				goto cleanup;
 			}
 			if (gw != 0 && fgcolor != bgcolor) {
-				// Because the stbtt_MakeGlyphBitmap documentation is a bit vague on this point,
-				// the parameter 'out_stride' should be the width of the surface in our buffer.
-				// It's designed so that the glyph can be rendered directly to a screen buffer.
-				// For example, if we were rendering directly to a 1080x1440 screen,
-				// out_stride should be set to 1080.
-				// In this case however, we want to render to a 'box' of the dimensions of the glyph,
-				// so we set 'out_stride' to the glyph width.
-				stbtt_MakeGlyphBitmap(curr_font, glyph_buff, gw, gh, gw, sf, sf, gi);
+				// The glyph cache rendered the full glyph box (with a stride of gw),
+				// if we clipped the top of the glyph, we'll just end up using less rows of it,
+				// which is exactly what stbtt_MakeGlyphBitmap would have done with the clipped height ;).
 				// paint our glyph into the line buffer
 				lnPtr = line_buff + ins_point.x + (max_lw * ins_point.y);
-				glPtr = glyph_buff;
+				glPtr = glyph->bitmap;
 				// NOTE: We keep storing it as an alpha coverage mask, we'll blend it in the final rendering stage
 				for (int j = 0; j < gh; j++) {
 					for (int k = 0; k < gw; k++) {
@@ -4628,13 +6083,14 @@ int
 			region.height = print_height;
 		}
 
-		FBInkPixel pixel;
-		pixel.bgra.color.a = 0xFFu;
-		start_x            = paint_point.x;
-		lnPtr              = line_buff;
+		start_x = paint_point.x;
+		lnPtr   = line_buff;
 		// Normal painting to framebuffer. Please forgive the code repetition. Performance...
 		// What we get from stbtt is an alpha coverage mask, hence the need for alpha-blending for anti-aliasing.
 		// As it's obviously expensive, we try to avoid it if possible (on fully opaque & fully transparent pixels).
+		// NOTE: Each row is staged in a scratch buffer, and then handed over to the span blitters in one go.
+		//       When we need to blend with what's already on screen, we read the full row back first,
+		//       and write it back in full: untouched pixels round-trip to the exact same value.
 		if (!is_overlay && !is_fgless && !is_bgless) {
 			if (abs(layer_diff) == 0xFFu) {
 				// If we're painting in B&W, use the mask as-is, it's already B&W ;).
@@ -4650,13 +6106,10 @@ int
 				}
 				for (int j = 0; j < max_line_height; j++) {
 					for (unsigned int k = 0U; k < lw; k++) {
-						pixel.bgra.color.r = pixel.bgra.color.g = pixel.bgra.color.b =
-						    lnPtr[k] ^ ainv;
-						put_pixel(paint_point, &pixel, false);
-						paint_point.x++;
+						spanGrayBuff[k] = lnPtr[k] ^ ainv;
 					}
+					put_gray_span(paint_point, (unsigned short int) lw, spanGrayBuff);
 					lnPtr += max_lw;
-					paint_point.x = start_x;
 					paint_point.y++;
 				}
 			} else {
@@ -4665,166 +6118,147 @@ int
 					for (unsigned int k = 0U; k < lw; k++) {
 						if (lnPtr[k] == 0U) {
 							// No coverage (transparent) -> background
-							put_pixel(paint_point, &bgP, true);
+							spanGrayBuff[k] = bgcolor;
 						} else if (lnPtr[k] == 0xFFu) {
 							// Full coverage (opaque) -> foreground
-							put_pixel(paint_point, &fgP, true);
+							spanGrayBuff[k] = fgcolor;
 						} else {
 							// AA, blend it using the coverage mask as alpha
-							pixel.bgra.color.r = pixel.bgra.color.g = pixel.bgra.color.b =
-							    (uint8_t) DIV255((pmul_bg + (layer_diff * lnPtr[k])));
-							put_pixel(paint_point, &pixel, false);
+							spanGrayBuff[k] = (uint8_t) DIV255((pmul_bg + (layer_diff * lnPtr[k])));
 						}
-						paint_point.x++;
 					}
+					put_gray_span(paint_point, (unsigned short int) lw, spanGrayBuff);
 					lnPtr += max_lw;
-					paint_point.x = start_x;
 					paint_point.y++;
 				}
 			}
 		} else if (is_fgless) {
-			FBInkPixel fb_px   = { 0U };
-			uint16_t   pmul_bg = (uint16_t)(bgcolor * 0xFFu);
+			uint16_t pmul_bg = (uint16_t)(bgcolor * 0xFFu);
 			// NOTE: One more branch needed because 4bpp fbs are terrible...
 			if (vInfo.bits_per_pixel > 4U) {
 				// 8, 16, 24 & 32bpp
 				for (int j = 0; j < max_line_height; j++) {
+					get_span(paint_point, (unsigned short int) lw, spanPixelBuff);
 					for (unsigned int k = 0U; k < lw; k++) {
+						FBInkPixel* restrict px = spanPixelBuff + k;
 						if (lnPtr[k] == 0U) {
 							// No coverage (transparent) -> background
-							put_pixel(paint_point, &bgP, true);
+							px->bgra.color.r = px->bgra.color.g = px->bgra.color.b = bgcolor;
+							px->bgra.color.a                                       = 0xFFu;
 						} else if (lnPtr[k] != 0xFFu) {
 							// AA, blend it using the coverage mask as alpha,
 							// and the underlying pixel as fg
-							get_pixel(paint_point, &fb_px);
-							pixel.bgra.color.r = (uint8_t) DIV255(
-							    (pmul_bg + ((fb_px.bgra.color.r - bgcolor) * lnPtr[k])));
-							pixel.bgra.color.g = (uint8_t) DIV255(
-							    (pmul_bg + ((fb_px.bgra.color.g - bgcolor) * lnPtr[k])));
-							pixel.bgra.color.b = (uint8_t) DIV255(
-							    (pmul_bg + ((fb_px.bgra.color.b - bgcolor) * lnPtr[k])));
-							put_pixel(paint_point, &pixel, false);
+							px->bgra.color.r =
+							    (uint8_t) DIV255((pmul_bg + ((px->bgra.color.r - bgcolor) * lnPtr[k])));
+							px->bgra.color.g =
+							    (uint8_t) DIV255((pmul_bg + ((px->bgra.color.g - bgcolor) * lnPtr[k])));
+							px->bgra.color.b =
+							    (uint8_t) DIV255((pmul_bg + ((px->bgra.color.b - bgcolor) * lnPtr[k])));
+							px->bgra.color.a = 0xFFu;
 						}
-						paint_point.x++;
 					}
+					put_span(paint_point, (unsigned short int) lw, spanPixelBuff, false);
 					lnPtr += max_lw;
-					paint_point.x = start_x;
 					paint_point.y++;
 				}
 			} else {
 				// 4bpp... We'll have to alpha-blend *everything* to avoid clobbering pixels...
 				for (int j = 0; j < max_line_height; j++) {
+					get_span(paint_point, (unsigned short int) lw, spanPixelBuff);
 					for (unsigned int k = 0U; k < lw; k++) {
 						// AA, blend it using the coverage mask as alpha, and the underlying pixel as fg
-						get_pixel(paint_point, &fb_px);
-						pixel.gray8 =
-						    (uint8_t) DIV255((pmul_bg + ((fb_px.gray8 - bgcolor) * lnPtr[k])));
-						put_pixel(paint_point, &pixel, false);
-						paint_point.x++;
+						spanPixelBuff[k].gray8 =
+						    (uint8_t) DIV255((pmul_bg + ((spanPixelBuff[k].gray8 - bgcolor) * lnPtr[k])));
 					}
+					put_span(paint_point, (unsigned short int) lw, spanPixelBuff, false);
 					lnPtr += max_lw;
-					paint_point.x = start_x;
 					paint_point.y++;
 				}
 			}
 		} else if (is_overlay) {
-			FBInkPixel fb_px = { 0U };
 			if (vInfo.bits_per_pixel > 4U) {
 				// 8, 16, 24 & 32bpp
 				for (int j = 0; j < max_line_height; j++) {
+					get_span(paint_point, (unsigned short int) lw, spanPixelBuff);
 					for (unsigned int k = 0U; k < lw; k++) {
+						FBInkPixel* restrict px = spanPixelBuff + k;
 						if (lnPtr[k] == 0xFFu) {
 							// Full coverage (opaque) -> foreground
-							get_pixel(paint_point, &fb_px);
 							// We want our foreground to be the inverse of the underlying pixel...
-							pixel.bgra.p = fb_px.bgra.p ^ 0x00FFFFFFu;
-							put_pixel(paint_point, &pixel, false);
+							px->bgra.p ^= 0x00FFFFFFu;
 						} else if (lnPtr[k] != 0U) {
 							// AA, blend it using the coverage mask as alpha,
 							// and the underlying pixel as bg
 							// Without forgetting our foreground color trickery...
-							get_pixel(paint_point, &fb_px);
-							pixel.bgra.color.r = (uint8_t) DIV255(
-							    (MUL255(fb_px.bgra.color.r) +
-							     (((fb_px.bgra.color.r ^ 0xFF) - fb_px.bgra.color.r) *
-							      lnPtr[k])));
-							pixel.bgra.color.g = (uint8_t) DIV255(
-							    (MUL255(fb_px.bgra.color.g) +
-							     (((fb_px.bgra.color.g ^ 0xFF) - fb_px.bgra.color.g) *
-							      lnPtr[k])));
-							pixel.bgra.color.b = (uint8_t) DIV255(
-							    (MUL255(fb_px.bgra.color.b) +
-							     (((fb_px.bgra.color.b ^ 0xFF) - fb_px.bgra.color.b) *
-							      lnPtr[k])));
-							put_pixel(paint_point, &pixel, false);
+							px->bgra.color.r = (uint8_t) DIV255(
+							    (MUL255(px->bgra.color.r) +
+							     (((px->bgra.color.r ^ 0xFF) - px->bgra.color.r) * lnPtr[k])));
+							px->bgra.color.g = (uint8_t) DIV255(
+							    (MUL255(px->bgra.color.g) +
+							     (((px->bgra.color.g ^ 0xFF) - px->bgra.color.g) * lnPtr[k])));
+							px->bgra.color.b = (uint8_t) DIV255(
+							    (MUL255(px->bgra.color.b) +
+							     (((px->bgra.color.b ^ 0xFF) - px->bgra.color.b) * lnPtr[k])));
+							px->bgra.color.a = 0xFFu;
 						}
-						paint_point.x++;
 					}
+					put_span(paint_point, (unsigned short int) lw, spanPixelBuff, false);
 					lnPtr += max_lw;
-					paint_point.x = start_x;
 					paint_point.y++;
 				}
 			} else {
 				// 4bpp...
 				for (int j = 0; j < max_line_height; j++) {
+					get_span(paint_point, (unsigned short int) lw, spanPixelBuff);
 					for (unsigned int k = 0U; k < lw; k++) {
 						// AA, blend it using the coverage mask as alpha, and the underlying pixel as bg
 						// Without forgetting our foreground color trickery...
-						get_pixel(paint_point, &fb_px);
-						pixel.gray8 =
-						    (uint8_t) DIV255((MUL255(fb_px.gray8) +
-								      (((fb_px.gray8 ^ 0xFF) - fb_px.gray8) * lnPtr[k])));
-						put_pixel(paint_point, &pixel, false);
-						paint_point.x++;
+						const uint8_t v        = spanPixelBuff[k].gray8;
+						spanPixelBuff[k].gray8 = (uint8_t) DIV255((MUL255(v) + (((v ^ 0xFF) - v) * lnPtr[k])));
 					}
+					put_span(paint_point, (unsigned short int) lw, spanPixelBuff, false);
 					lnPtr += max_lw;
-					paint_point.x = start_x;
 					paint_point.y++;
 				}
 			}
 		} else if (is_bgless) {
-			FBInkPixel fb_px = { 0U };
 			if (vInfo.bits_per_pixel > 4U) {
 				// 8, 16, 24 & 32bpp
 				for (int j = 0; j < max_line_height; j++) {
+					get_span(paint_point, (unsigned short int) lw, spanPixelBuff);
 					for (unsigned int k = 0U; k < lw; k++) {
+						FBInkPixel* restrict px = spanPixelBuff + k;
 						if (lnPtr[k] == 0xFFu) {
 							// Full coverage (opaque) -> foreground
-							put_pixel(paint_point, &fgP, true);
+							px->bgra.color.r = px->bgra.color.g = px->bgra.color.b = fgcolor;
+							px->bgra.color.a                                       = 0xFFu;
 						} else if (lnPtr[k] != 0U) {
 							// AA, blend it using the coverage mask as alpha,
 							// and the underlying pixel as bg
-							get_pixel(paint_point, &fb_px);
-							pixel.bgra.color.r = (uint8_t) DIV255(
-							    (MUL255(fb_px.bgra.color.r) +
-							     ((fgcolor - fb_px.bgra.color.r) * lnPtr[k])));
-							pixel.bgra.color.g = (uint8_t) DIV255(
-							    (MUL255(fb_px.bgra.color.g) +
-							     ((fgcolor - fb_px.bgra.color.g) * lnPtr[k])));
-							pixel.bgra.color.b = (uint8_t) DIV255(
-							    (MUL255(fb_px.bgra.color.b) +
-							     ((fgcolor - fb_px.bgra.color.b) * lnPtr[k])));
-							put_pixel(paint_point, &pixel, false);
+							px->bgra.color.r = (uint8_t) DIV255(
+							    (MUL255(px->bgra.color.r) + ((fgcolor - px->bgra.color.r) * lnPtr[k])));
+							px->bgra.color.g = (uint8_t) DIV255(
+							    (MUL255(px->bgra.color.g) + ((fgcolor - px->bgra.color.g) * lnPtr[k])));
+							px->bgra.color.b = (uint8_t) DIV255(
+							    (MUL255(px->bgra.color.b) + ((fgcolor - px->bgra.color.b) * lnPtr[k])));
+							px->bgra.color.a = 0xFFu;
 						}
-						paint_point.x++;
 					}
+					put_span(paint_point, (unsigned short int) lw, spanPixelBuff, false);
 					lnPtr += max_lw;
-					paint_point.x = start_x;
 					paint_point.y++;
 				}
 			} else {
 				// 4bpp...
 				for (int j = 0; j < max_line_height; j++) {
+					get_span(paint_point, (unsigned short int) lw, spanPixelBuff);
 					for (unsigned int k = 0U; k < lw; k++) {
 						// AA, blend it using the coverage mask as alpha, and the underlying pixel as bg
-						get_pixel(paint_point, &fb_px);
-						pixel.gray8 = (uint8_t) DIV255(
-						    (MUL255(fb_px.gray8) + ((fgcolor - fb_px.gray8) * lnPtr[k])));
-						put_pixel(paint_point, &pixel, false);
-						paint_point.x++;
+						const uint8_t v        = spanPixelBuff[k].gray8;
+						spanPixelBuff[k].gray8 = (uint8_t) DIV255((MUL255(v) + ((fgcolor - v) * lnPtr[k])));
 					}
+					put_span(paint_point, (unsigned short int) lw, spanPixelBuff, false);
 					lnPtr += max_lw;
-					paint_point.x = start_x;
 					paint_point.y++;
 				}
 			}
@@ -4930,11 +6364,7 @@ cleanup:
 			is_flashing,
 			no_refresh);
 	}
-	free(lines);
-	free(brk_buff);
-	free(fmt_buff);
-	free(line_buff);
-	free(glyph_buff);
+	scratch_release(scratch);
 	if (isFbMapped && !keep_fd) {
 		unmap_fb();
 	}
@@ -4948,161 +6378,1214 @@ cleanup:
 #endif    // FBINK_WITH_OPENTYPE
 }
 
-// Convert our public WFM_MODE_INDEX_T values to an appropriate mxcfb waveform mode constant for the current device
-static uint32_t
-    get_wfm_mode(uint8_t wfm_mode_index)
+#ifdef FBINK_WITH_OPENTYPE
+// Compute the scale factor of every loaded font (indexed by CHARACTER_FONT_T) at a specific pixel size,
+// as well as the largest scaled baseline, descent & line gap across all of them (c.f., fbink_print_ot).
+// Returns the height of a row according to those metrics.
+static int
+    ot_get_scaled_metrics(unsigned short int font_size_px,
+			  float* restrict    sfs,
+			  int* restrict      max_baseline,
+			  int* restrict      max_lg)
 {
-	uint32_t waveform_mode = WAVEFORM_MODE_AUTO;
+	// Indexed by CHARACTER_FONT_T
+	stbtt_fontinfo* const fonts[] = {
+		NULL, otFonts.otRegular, otFonts.otItalic, otFonts.otBold, otFonts.otBoldItalic
+	};
+	int max_desc  = 0;
+	*max_baseline = 0;
+	*max_lg       = 0;
+	for (uint8_t style = CH_IGNORE; style <= CH_BOLD_ITALIC; style++) {
+		sfs[style] = 0.0f;
+		if (!fonts[style]) {
+			continue;
+		}
+		int asc, desc, lg;
+		sfs[style] = stbtt_ScaleForPixelHeight(fonts[style], (float) font_size_px);
+		stbtt_GetFontVMetrics(fonts[style], &asc, &desc, &lg);
+		*max_baseline = MAX(*max_baseline, iceilf(sfs[style] * (float) asc));
+		max_desc      = MIN(max_desc, iceilf(sfs[style] * (float) desc));
+		*max_lg       = MAX(*max_lg, iceilf(sfs[style] * (float) lg));
+	}
+
+	return *max_baseline + abs(max_desc) + *max_lg;
+}
 
-	// Parse waveform mode...
-#if defined(FBINK_FOR_KINDLE)
-	// Is this a Zelda or a Rex with new waveforms?
-	bool has_new_wfm = false;
-	if (deviceQuirks.isKindleZelda || deviceQuirks.isKindleRex) {
-		has_new_wfm = true;
+// Gather the size-independent metrics of the characters in string, from byte start to byte end (c.f., FBInkOTFitChar)
+static int
+    ot_measure_chars(const char* restrict          string,
+		     size_t                        str_len_bytes,
+		     const unsigned char* restrict fmt_buff,
+		     FBInkOTFitChar* restrict      chars,
+		     size_t                        start,
+		     size_t                        end)
+{
+	// Indexed by CHARACTER_FONT_T
+	stbtt_fontinfo* const fonts[] = {
+		NULL, otFonts.otRegular, otFonts.otItalic, otFonts.otBold, otFonts.otBoldItalic
+	};
+	// Unformatted text uses the first style that was loaded, like fbink_print_ot
+	uint8_t default_style = CH_REGULAR;
+	while (default_style < CH_BOLD_ITALIC && !fonts[default_style]) {
+		default_style++;
 	}
 
-	switch (wfm_mode_index) {
-		case WFM_INIT:
-			waveform_mode = WAVEFORM_MODE_INIT;
-			break;
-		case WFM_AUTO:
-			waveform_mode = WAVEFORM_MODE_AUTO;
-			break;
-		case WFM_DU:
-			waveform_mode = WAVEFORM_MODE_DU;
-			break;
-		case WFM_GC16:
-			waveform_mode = WAVEFORM_MODE_GC16;
-			break;
-		case WFM_GC4:
-			waveform_mode = WAVEFORM_MODE_GC4;
-			break;
-		case WFM_A2:
-			if (has_new_wfm) {
-				waveform_mode = WAVEFORM_MODE_ZELDA_A2;
-			} else {
-				waveform_mode = WAVEFORM_MODE_A2;
-			}
-			break;
-		case WFM_GL16:
-			if (has_new_wfm) {
-				waveform_mode = WAVEFORM_MODE_ZELDA_GL16;
-			} else {
-				waveform_mode = WAVEFORM_MODE_GL16;
-			}
-			break;
-		case WFM_REAGL:
-			if (has_new_wfm) {
-				waveform_mode = WAVEFORM_MODE_ZELDA_REAGL;
-			} else {
-				waveform_mode = WAVEFORM_MODE_REAGL;
-			}
-			break;
-		case WFM_REAGLD:
-			if (has_new_wfm) {
-				waveform_mode = WAVEFORM_MODE_ZELDA_REAGLD;
-			} else {
-				waveform_mode = WAVEFORM_MODE_REAGLD;
-			}
-			break;
-		case WFM_GC16_FAST:
-			if (has_new_wfm) {
-				waveform_mode = WAVEFORM_MODE_ZELDA_GC16_FAST;
-			} else {
-				waveform_mode = WAVEFORM_MODE_GC16_FAST;
-			}
-			break;
-		case WFM_GL16_FAST:
-			if (has_new_wfm) {
-				waveform_mode = WAVEFORM_MODE_ZELDA_GL16_FAST;
-			} else {
-				waveform_mode = WAVEFORM_MODE_GL16_FAST;
-			}
-			break;
-		case WFM_DU4:
-			waveform_mode = WAVEFORM_MODE_DU4;
-			break;
-		case WFM_GL4:
-			if (has_new_wfm) {
-				waveform_mode = WAVEFORM_MODE_ZELDA_GL4;
-			} else {
-				waveform_mode = WAVEFORM_MODE_GL4;
+	for (size_t c_index = start; c_index < end;) {
+		FBInkOTFitChar* restrict ch    = chars + c_index;
+		const uint8_t            style = fmt_buff ? fmt_buff[c_index] : default_style;
+		if (style == CH_IGNORE) {
+			u8_inc(string, &c_index);
+			continue;
+		}
+		const stbtt_fontinfo* font = fonts[style];
+		if (!font) {
+			WARN("The specified font style was not loaded");
+			return ERRCODE(ENOENT);
+		}
+		*ch               = (FBInkOTFitChar){ .style = style };
+		const uint32_t c  = u8_nextchar2(string, &c_index);
+		const int      gi = stbtt_FindGlyphIndex(font, (int) c);
+		stbtt_GetGlyphHMetrics(font, gi, &ch->adv, NULL);
+		// NOTE: Empty glyphs (f.g., spaces) don't have a box,
+		//       and stbtt_GetGlyphBitmapBox returns all zeroes for those.
+		if (!stbtt_GetGlyphBox(font, gi, &ch->x0, &ch->y0, &ch->x1, &ch->y1)) {
+			ch->x0 = ch->y0 = ch->x1 = ch->y1 = 0;
+		}
+		// Same kerning rules as fbink_print_ot (i.e., against the next character, in the current font)
+		if (c_index < str_len_bytes && string[c_index + 1U]) {
+			size_t         tmp_c_index = c_index;
+			const uint32_t c2          = u8_nextchar2(string, &tmp_c_index);
+			ch->kern = stbtt_GetGlyphKernAdvance(font, gi, stbtt_FindGlyphIndex(font, (int) c2));
+		}
+	}
+
+	return EXIT_SUCCESS;
+}
+
+// Replay fbink_print_ot's line-breaking pass for a single line, using the metrics gathered by ot_measure_chars.
+// NOTE: This *has* to stay in sync with fbink_print_ot's own computations!
+// On input, *c_index is the start of the line, and max_baseline, max_line_height & line_gap the current metrics,
+// which are updated in place, like fbink_print_ot does.
+// On output, *c_index is the start of the next line, and *line_end the end of this one (exclusive, a hard break isn't
+// part of the line).
+// Returns false if a single glyph is too wide for the printable area.
+static bool
+    ot_break_line(const char* restrict           string,
+		  size_t                         str_len_bytes,
+		  const char* restrict           brk_buff,
+		  const unsigned char* restrict  fmt_buff,
+		  const FBInkOTFitChar* restrict chars,
+		  const float* restrict          sfs,
+		  unsigned short int             max_lw,
+		  size_t* restrict               c_index,
+		  size_t* restrict               line_end,
+		  int* restrict                  max_baseline,
+		  int* restrict                  max_line_height,
+		  int* restrict                  line_gap)
+{
+	const size_t start_index = *c_index;
+	size_t       ci          = start_index;
+	int          curr_x      = 0;
+	*line_end                = str_len_bytes;
+	while (ci < str_len_bytes) {
+		if (fmt_buff && fmt_buff[ci] == CH_IGNORE) {
+			u8_inc(string, &ci);
+			continue;
+		}
+		if (brk_buff[ci] == LINEBREAK_MUSTBREAK) {
+			*line_end = ci;
+			u8_inc(string, &ci);
+			break;
+		}
+		const FBInkOTFitChar* restrict ch          = chars + ci;
+		const float                    sf          = sfs[ch->style];
+		const size_t                   glyph_index = ci;
+		u8_inc(string, &ci);
+		// Same rounding as stbtt_GetGlyphBitmapBox
+		const int x0 = ifloorf((float) ch->x0 * sf);
+		const int y0 = ifloorf((float) -ch->y1 * sf);
+		const int x1 = iceilf((float) ch->x1 * sf);
+		const int y1 = iceilf((float) -ch->y0 * sf);
+		const int gw = x1 - x0;
+		if (curr_x + x0 < 0) {
+			curr_x += abs(curr_x + x0);
+		}
+		if (*max_baseline + y1 > *max_line_height) {
+			const int height_diff = (*max_baseline + y1) - *max_line_height;
+			*line_gap             = height_diff > *line_gap ? 0 : *line_gap - height_diff;
+			*max_line_height      = *max_baseline + y1;
+		}
+		if (*max_baseline + y0 < 0) {
+			const int height_diff = abs(*max_baseline + y0);
+			*line_gap             = height_diff > *line_gap ? 0 : *line_gap - height_diff;
+			*max_line_height += height_diff;
+			*max_baseline += height_diff;
+		}
+		const unsigned int lw = (unsigned int) (gw != 0 ? curr_x + x0 + gw : curr_x);
+		if (lw > max_lw) {
+			if ((unsigned int) gw >= max_lw) {
+				return false;
 			}
-			break;
-		case WFM_GL16_INV:
-			if (has_new_wfm) {
-				waveform_mode = WAVEFORM_MODE_ZELDA_GL16_INV;
-			} else {
-				waveform_mode = WAVEFORM_MODE_GL16_INV;
+			ci = glyph_index;
+			if (ci > 0U) {
+				if (brk_buff[ci] != LINEBREAK_ALLOWBREAK) {
+					u8_dec(string, &ci);
+					for (size_t tmp_c_index = ci; tmp_c_index > start_index;
+					     u8_dec(string, &tmp_c_index)) {
+						if (brk_buff[tmp_c_index] == LINEBREAK_ALLOWBREAK) {
+							ci = tmp_c_index;
+							break;
+						}
+					}
+				}
+				u8_inc(string, &ci);
 			}
+			*line_end = ci;
 			break;
-		case WFM_GCK16:
-			waveform_mode = WAVEFORM_MODE_ZELDA_GCK16;
-			break;
-		case WFM_GLKW16:
-			waveform_mode = WAVEFORM_MODE_ZELDA_GLKW16;
-			break;
-		default:
-			LOG("Unknown (or unsupported) waveform mode '%s' @ index %hhu, defaulting to AUTO",
-			    wfm_to_string(wfm_mode_index),
-			    wfm_mode_index);
-			waveform_mode = WAVEFORM_MODE_AUTO;
-			break;
+		}
+		curr_x += iroundf(sf * (float) ch->adv);
+		curr_x += iroundf(sf * (float) ch->kern);
 	}
-#elif defined(FBINK_FOR_REMARKABLE)
-	// NOTE: Let's go with a dedicated switch for the reMarkable,
-	//       because we don't actually have sane constant names in the upstream kernel,
-	//       and some of what's detailed in the SDK's <epframebuffer.h> looks slightly weird...
-	// NOTE: See https://github.com/NiLuJe/FBInk/pull/41#issuecomment-579012002 if you want to help make this more accurate!
-	switch (wfm_mode_index) {
-		case WFM_INIT:
-			waveform_mode = WAVEFORM_MODE_INIT;
-			break;
-		case WFM_AUTO:
-			waveform_mode = WAVEFORM_MODE_AUTO;
-			break;
-		case WFM_DU:
-			waveform_mode = WAVEFORM_MODE_DU;
-			break;
-		case WFM_GC16:
-			waveform_mode = WAVEFORM_MODE_GC16;
-			break;
-		case WFM_GL16:
-			waveform_mode = WAVEFORM_MODE_GL16;
-			break;
-		case WFM_REAGL:
-			waveform_mode = WAVEFORM_MODE_GLR16;
-			break;
-		case WFM_REAGLD:
-			waveform_mode = WAVEFORM_MODE_GLD16;
-			break;
-		case WFM_A2:
-			waveform_mode = WAVEFORM_MODE_A2;
-			break;
-		case WFM_DU4:
-			waveform_mode = WAVEFORM_MODE_DU4;
-			break;
-		case WFM_UNKNOWN:
-			waveform_mode = WAVEFORM_MODE_UNKNOWN;
-			break;
-		case WFM_INIT2:
-			waveform_mode = WAVEFORM_MODE_INIT2;
-			break;
-		default:
-			LOG("Unknown (or unsupported) waveform mode '%s' @ index %hhu, defaulting to AUTO",
-			    wfm_to_string(wfm_mode_index),
-			    wfm_mode_index);
-			waveform_mode = WAVEFORM_MODE_AUTO;
+	*c_index = ci;
+
+	return true;
+}
+
+// Replay fbink_print_ot's layout at a specific pixel size, using the metrics gathered by ot_measure_chars.
+// Returns the amount of lines needed, or -1 if string doesn't fit in the printable area at that size.
+static int
+    ot_fit_probe(const char* restrict           string,
+		 size_t                         str_len_bytes,
+		 const char* restrict           brk_buff,
+		 const unsigned char* restrict  fmt_buff,
+		 const FBInkOTFitChar* restrict chars,
+		 unsigned short int             font_size_px,
+		 unsigned short int             max_lw,
+		 unsigned int                   print_height)
+{
+	float     sfs[CH_BOLD_ITALIC + 1];
+	int       max_baseline;
+	int       max_lg;
+	const int max_row_height = ot_get_scaled_metrics(font_size_px, sfs, &max_baseline, &max_lg);
+	if (max_row_height <= 0) {
+		return -1;
+	}
+	const unsigned int num_lines = print_height / (unsigned int) max_row_height;
+	if (num_lines == 0U) {
+		return -1;
+	}
+
+	// We only need to remember the line gap of each line, for the final height computation.
+	const FBInkScratchMark scratch   = scratch_mark();
+	int*                   line_gaps = scratch_alloc(num_lines * sizeof(*line_gaps));
+	if (!line_gaps) {
+		return -1;
+	}
+
+	int          rv              = -1;
+	int          max_line_height = max_row_height - max_lg;
+	size_t       c_index         = 0U;
+	bool         complete_str    = false;
+	unsigned int line;
+	for (line = 0U; line < num_lines; line++) {
+		size_t line_end;
+		line_gaps[line] = max_lg;
+		if (!ot_break_line(string,
+				   str_len_bytes,
+				   brk_buff,
+				   fmt_buff,
+				   chars,
+				   sfs,
+				   max_lw,
+				   &c_index,
+				   &line_end,
+				   &max_baseline,
+				   &max_line_height,
+				   &line_gaps[line])) {
+			goto cleanup;
+		}
+		if (c_index >= str_len_bytes) {
+			complete_str = true;
 			break;
+		}
 	}
-#else
-	switch (wfm_mode_index) {
-		case WFM_INIT:
-			waveform_mode = WAVEFORM_MODE_INIT;
+	if (!complete_str) {
+		goto cleanup;
+	}
+
+	// Make sure every line actually fits vertically, now that we know the final line height
+	const unsigned int computed_lines    = line + 1U;
+	unsigned int       curr_print_height = 0U;
+	for (line = 0U; line < computed_lines; line++) {
+		if (curr_print_height + (unsigned int) max_line_height > print_height) {
+			goto cleanup;
+		}
+		curr_print_height += (unsigned int) max_line_height;
+		if (line == computed_lines - 1U) {
 			break;
-		case WFM_AUTO:
-			waveform_mode = WAVEFORM_MODE_AUTO;
+		}
+		if (!(curr_print_height + (unsigned int) line_gaps[line] > print_height)) {
+			curr_print_height += (unsigned int) line_gaps[line];
+		}
+	}
+	rv = (int) computed_lines;
+
+	// Cleanup
+cleanup:
+	scratch_release(scratch);
+	return rv;
+}
+#endif    // FBINK_WITH_OPENTYPE
+
+// Find the largest font size at which a string fits in a specific area, and optionally print it
+int
+    fbink_fit_ot(int fbfd                              UNUSED_BY_MINIMAL,
+		 const char* restrict string           UNUSED_BY_MINIMAL,
+		 const FBInkOTConfig* restrict cfg     UNUSED_BY_MINIMAL,
+		 const FBInkConfig* restrict fbink_cfg UNUSED_BY_MINIMAL,
+		 unsigned short int max_lines          UNUSED_BY_MINIMAL,
+		 unsigned short int min_size_px        UNUSED_BY_MINIMAL,
+		 unsigned short int max_size_px        UNUSED_BY_MINIMAL,
+		 FBInkOTFit* restrict fit              UNUSED_BY_MINIMAL)
+{
+#ifdef FBINK_WITH_OPENTYPE
+	if (!*string) {
+		WARN("Cannot fit an empty string");
+		return ERRCODE(EINVAL);
+	}
+	if (!u8_isvalid2(string)) {
+		WARN("Cannot fit an invalid UTF-8 sequence");
+		return ERRCODE(EILSEQ);
+	}
+	if (!otInit) {
+		WARN("No fonts have been loaded");
+		return ERRCODE(ENODATA);
+	}
+	if (!cfg) {
+		WARN("FBInkOTConfig expected. Got NULL pointer instead");
+		return ERRCODE(EXIT_FAILURE);
+	}
+
+	FBInkCoordinates tl = { 0U, 0U };
+	FBInkCoordinates br = { 0U, 0U };
+	int              rv = ot_compute_area(cfg, &tl, &br);
+	if (rv != EXIT_SUCCESS) {
+		return rv;
+	}
+	const unsigned short int max_lw       = (unsigned short int) (br.x - tl.x);
+	const unsigned int       print_height = (unsigned int) (br.y - tl.y + (viewVertOrigin - viewVertOffset));
+
+	// Sanitize the range: a glyph can't be taller than the area anyway
+	if (min_size_px == 0U) {
+		min_size_px = 1U;
+	}
+	if (max_size_px == 0U || max_size_px > print_height) {
+		max_size_px = (unsigned short int) (print_height > UINT16_MAX ? UINT16_MAX : print_height);
+	}
+	if (min_size_px > max_size_px) {
+		WARN("Invalid font size range (%hupx to %hupx)", min_size_px, max_size_px);
+		return ERRCODE(EINVAL);
+	}
+
+	// Do everything that doesn't depend on the font size once and for all:
+	// linebreaks, formatting, glyph lookups, and unscaled metrics & kerning.
+	const size_t           str_len_bytes = strlen(string);    // Flawfinder: ignore
+	const FBInkScratchMark scratch       = scratch_mark();
+	char* restrict         brk_buff      = scratch_alloc(str_len_bytes + 1U);
+	unsigned char*         fmt_buff      = NULL;
+	FBInkOTFitChar*        chars         = scratch_calloc(str_len_bytes, sizeof(*chars));
+	if (!brk_buff || !chars) {
+		WARN("Fit buffers could not be allocated");
+		rv = ERRCODE(EXIT_FAILURE);
+		goto cleanup;
+	}
+	set_linebreaks_utf8((const utf8_t*) string, str_len_bytes + 1U, "en", brk_buff);
+	if (cfg->is_formatted) {
+		fmt_buff = scratch_calloc(str_len_bytes + 1U, sizeof(*fmt_buff));
+		if (!fmt_buff) {
+			WARN("Formatted text buffer could not be allocated");
+			rv = ERRCODE(EXIT_FAILURE);
+			goto cleanup;
+		}
+		parse_simple_md(string, str_len_bytes, fmt_buff);
+	}
+
+	rv = ot_measure_chars(string, str_len_bytes, fmt_buff, chars, 0U, str_len_bytes);
+	if (rv != EXIT_SUCCESS) {
+		goto cleanup;
+	}
+
+	// Binary search for the largest size that fits
+	// NOTE: This assumes that if a size fits, every smaller one does, too, which is true for any sane font.
+	unsigned short int best_size  = 0U;
+	int                best_lines = 0;
+	unsigned short int lo         = min_size_px;
+	unsigned short int hi         = max_size_px;
+	while (lo <= hi) {
+		const unsigned short int mid = (unsigned short int) (lo + ((hi - lo) >> 1U));
+		const int                n =
+		    ot_fit_probe(string, str_len_bytes, brk_buff, fmt_buff, chars, mid, max_lw, print_height);
+		LOG("Fit probe @ %hupx: %d lines", mid, n);
+		if (n > 0 && (max_lines == 0U || n <= max_lines)) {
+			best_size  = mid;
+			best_lines = n;
+			if (mid == UINT16_MAX) {
+				break;
+			}
+			lo = (unsigned short int) (mid + 1U);
+		} else {
+			if (mid == 0U) {
+				break;
+			}
+			hi = (unsigned short int) (mid - 1U);
+		}
+	}
+	if (best_size == 0U) {
+		WARN("String doesn't fit at any size between %hupx and %hupx", min_size_px, max_size_px);
+		rv = ERRCODE(ENOSPC);
+		goto cleanup;
+	}
+	LOG("Best fit: %hupx over %d lines", best_size, best_lines);
+	rv = best_size;
+
+	if (fit) {
+		fit->computed_lines = (unsigned short int) best_lines;
+		fit->rendered_lines = 0U;
+		fit->truncated      = false;
+	}
+
+	// Print it at that size, unless we were only asked to compute it
+	if (!cfg->compute_only) {
+		// Make sure we don't keep anything around during the actual print, it'll need its own buffers.
+		scratch_release(scratch);
+		FBInkOTConfig best_cfg = *cfg;
+		best_cfg.size_px       = best_size;
+		const int ret          = fbink_print_ot(fbfd, string, &best_cfg, fbink_cfg, fit);
+		return ret < 0 ? ret : best_size;
+	}
+
+	// Cleanup
+cleanup:
+	scratch_release(scratch);
+	return rv;
+#else
+	WARN("OpenType support is disabled in this FBInk build");
+	return ERRCODE(ENOSYS);
+#endif    // FBINK_WITH_OPENTYPE
+}
+
+
+#ifdef FBINK_WITH_OPENTYPE
+// Make sure the per-byte buffers of a layout can hold len bytes of text (plus a NUL)
+static int
+    ot_layout_reserve(FBInkOTLayout* restrict layout, size_t len)
+{
+	if (len < layout->capacity) {
+		return EXIT_SUCCESS;
+	}
+	size_t capacity = layout->capacity ? layout->capacity : 256U;
+	while (capacity <= len) {
+		capacity <<= 1U;
+	}
+
+	// NOTE: Buffers are swapped in one by one, so a failure midway doesn't leave anything dangling.
+	char* text = realloc(layout->text, capacity);
+	if (!text) {
+		WARN("realloc: %m");
+		return ERRCODE(ENOMEM);
+	}
+	layout->text   = text;
+	char* brk_buff = realloc(layout->brk_buff, capacity);
+	if (!brk_buff) {
+		WARN("realloc: %m");
+		return ERRCODE(ENOMEM);
+	}
+	layout->brk_buff = brk_buff;
+	if (layout->cfg.is_formatted) {
+		unsigned char* fmt_buff = realloc(layout->fmt_buff, capacity);
+		if (!fmt_buff) {
+			WARN("realloc: %m");
+			return ERRCODE(ENOMEM);
+		}
+		layout->fmt_buff = fmt_buff;
+	}
+	FBInkOTFitChar* chars = realloc(layout->chars, capacity * sizeof(*chars));
+	if (!chars) {
+		WARN("realloc: %m");
+		return ERRCODE(ENOMEM);
+	}
+	layout->chars    = chars;
+	layout->capacity = capacity;
+
+	return EXIT_SUCCESS;
+}
+
+// Make sure a layout can hold count lines
+static int
+    ot_layout_reserve_lines(FBInkOTLayout* restrict layout, size_t count)
+{
+	if (count <= layout->lines_capacity) {
+		return EXIT_SUCCESS;
+	}
+	size_t capacity = layout->lines_capacity ? layout->lines_capacity << 1U : 16U;
+	while (capacity < count) {
+		capacity <<= 1U;
+	}
+	FBInkOTLayoutLine* lines = realloc(layout->lines, capacity * sizeof(*lines));
+	if (!lines) {
+		WARN("realloc: %m");
+		return ERRCODE(ENOMEM);
+	}
+	layout->lines          = lines;
+	layout->lines_capacity = capacity;
+
+	return EXIT_SUCCESS;
+}
+
+// Replace the text of a layout, and relayout what needs to be
+static int
+    ot_layout_update(FBInkOTLayout* restrict layout, const char* restrict string, size_t len, FBInkOTFit* restrict fit)
+{
+	// How much of the text didn't change, at either end?
+	const size_t old_len = layout->len;
+	const size_t min_len = MIN(old_len, len);
+	size_t       prefix  = 0U;
+	while (prefix < min_len && layout->text[prefix] == string[prefix]) {
+		prefix++;
+	}
+	size_t suffix = 0U;
+	while (suffix < min_len - prefix && layout->text[old_len - suffix - 1U] == string[len - suffix - 1U]) {
+		suffix++;
+	}
+
+	int                    rv        = EXIT_SUCCESS;
+	const FBInkScratchMark scratch   = scratch_mark();
+	unsigned char*         fmt_buff  = NULL;
+	FBInkOTLayoutLine*     old_lines = NULL;
+	if (layout->cfg.is_formatted) {
+		fmt_buff = scratch_calloc(len + 1U, sizeof(*fmt_buff));
+		if (!fmt_buff) {
+			WARN("Formatted text buffer could not be allocated");
+			rv = ERRCODE(EXIT_FAILURE);
+			goto cleanup;
+		}
+		parse_simple_md(string, len, fmt_buff);
+		// Markup may have changed the style of text that didn't change itself
+		for (size_t i = 0U; i < prefix; i++) {
+			if (fmt_buff[i] != layout->fmt_buff[i]) {
+				prefix = i;
+				break;
+			}
+		}
+		for (size_t i = len - suffix; i < len; i++) {
+			if (fmt_buff[i] != layout->fmt_buff[old_len - (len - i)]) {
+				suffix = len - i - 1U;
+			}
+		}
+	}
+	// Make sure both land on a character boundary
+	while (prefix > 0U && ((unsigned char) string[prefix] & 0xC0u) == 0x80u) {
+		prefix--;
+	}
+	while (suffix > 0U && ((unsigned char) string[len - suffix] & 0xC0u) == 0x80u) {
+		suffix--;
+	}
+	const size_t suffix_start = len - suffix;
+
+	// Kerning (and fbink_print_ot's lookahead for it) reaches a couple of characters back,
+	// and the line before the first affected one might be able to fit the start of that one, now.
+	size_t first = prefix;
+	for (uint8_t i = 0U; i < 2U && first > 0U; i++) {
+		u8_dec(string, &first);
+	}
+	size_t first_line = 0U;
+	while (first_line + 1U < layout->lines_count && layout->lines[first_line + 1U].start <= first) {
+		first_line++;
+	}
+	if (first_line > 0U) {
+		first_line--;
+	}
+	const size_t relayout_start = first_line < layout->lines_count ? layout->lines[first_line].start : 0U;
+
+	// Keep the previous layout around, we may be able to reuse the end of it.
+	const size_t old_count = layout->lines_count > first_line ? layout->lines_count - first_line : 0U;
+	if (old_count > 0U) {
+		old_lines = scratch_alloc(old_count * sizeof(*old_lines));
+		if (!old_lines) {
+			WARN("Lines metadata buffer could not be allocated");
+			rv = ERRCODE(EXIT_FAILURE);
+			goto cleanup;
+		}
+		memcpy(old_lines, layout->lines + first_line, old_count * sizeof(*old_lines));
+	}
+
+	rv = ot_layout_reserve(layout, len);
+	if (rv != EXIT_SUCCESS) {
+		goto cleanup;
+	}
+	// The metrics of the characters that didn't change are still valid, they just have to move along.
+	memmove(layout->chars + suffix_start, layout->chars + (old_len - suffix), suffix * sizeof(*layout->chars));
+	memcpy(layout->text, string, len + 1U);
+	if (fmt_buff) {
+		memcpy(layout->fmt_buff, fmt_buff, len + 1U);
+	}
+	layout->len = len;
+	rv          = ot_measure_chars(layout->text, len, layout->fmt_buff, layout->chars, relayout_start, suffix_start);
+	if (rv != EXIT_SUCCESS) {
+		// Leave it empty, rather than inconsistent
+		layout->text[0U]     = '\0';
+		layout->len          = 0U;
+		layout->lines_count  = 0U;
+		layout->is_truncated = false;
+		goto cleanup;
+	}
+	// NOTE: This is cheap enough that we don't bother trying to salvage the break opportunities of the suffix.
+	set_linebreaks_utf8((const utf8_t*) layout->text + relayout_start,
+			    len - relayout_start + 1U,
+			    "en",
+			    layout->brk_buff + relayout_start);
+
+	// Where does the first line we have to recompute start?
+	unsigned int y = 0U;
+	for (size_t i = 0U; i < first_line; i++) {
+		y += (unsigned int) (layout->lines[i].height + layout->lines[i].line_gap);
+	}
+
+	size_t count        = first_line;
+	size_t reused       = 0U;
+	size_t c_index      = relayout_start;
+	size_t old_i        = 0U;
+	bool   is_truncated = false;
+	while (c_index < len) {
+		rv = ot_layout_reserve_lines(layout, count + 1U);
+		if (rv != EXIT_SUCCESS) {
+			// Keep what we've got
+			break;
+		}
+		FBInkOTLayoutLine* restrict line = layout->lines + count;
+		int                         max_baseline    = layout->max_baseline;
+		int                         max_line_height = layout->max_row_height - layout->max_lg;
+		int                         line_gap        = layout->max_lg;
+		line->start                                 = c_index;
+		if (!ot_break_line(layout->text,
+				   len,
+				   layout->brk_buff,
+				   layout->fmt_buff,
+				   layout->chars,
+				   layout->sfs,
+				   layout->max_lw,
+				   &c_index,
+				   &line->end,
+				   &max_baseline,
+				   &max_line_height,
+				   &line_gap) ||
+		    c_index == line->start) {
+			LOG("A glyph is too wide for the printable area");
+			break;
+		}
+		// NOTE: Unlike in fbink_print_ot, every line has its own height (previous ones are never updated).
+		//       But it's still rendered via fbink_print_ot, which needs room for at least a full row,
+		//       so that's what has to fit (c.f., fbink_render_ot_layout).
+		if (y + (unsigned int) MAX(max_line_height + line_gap, layout->max_row_height) > layout->print_height) {
+			break;
+		}
+		line->next     = c_index;
+		line->height   = max_line_height;
+		line->line_gap = line_gap;
+		y += (unsigned int) (max_line_height + line_gap);
+		count++;
+
+		// If we just landed on the start of a line of the previous layout, in the part of the text that didn't
+		// change, the rest of that layout is still valid.
+		if (c_index >= suffix_start && c_index < len) {
+			const size_t old_c_index = old_len - (len - c_index);
+			while (old_i < old_count && old_lines[old_i].start < old_c_index) {
+				old_i++;
+			}
+			if (old_i < old_count && old_lines[old_i].start == old_c_index) {
+				while (old_i < old_count) {
+					const int box_height = MAX(old_lines[old_i].height + old_lines[old_i].line_gap,
+								   layout->max_row_height);
+					if (y + (unsigned int) box_height > layout->print_height) {
+						break;
+					}
+					rv = ot_layout_reserve_lines(layout, count + 1U);
+					if (rv != EXIT_SUCCESS) {
+						break;
+					}
+					FBInkOTLayoutLine* restrict reused_line = layout->lines + count;
+					*reused_line                            = old_lines[old_i];
+					reused_line->start = len - (old_len - reused_line->start);
+					reused_line->end   = len - (old_len - reused_line->end);
+					reused_line->next  = len - (old_len - reused_line->next);
+					y += (unsigned int) (reused_line->height + reused_line->line_gap);
+					c_index = reused_line->next;
+					count++;
+					old_i++;
+					reused++;
+				}
+				if (rv != EXIT_SUCCESS) {
+					break;
+				}
+			}
+		}
+	}
+	if (c_index < len) {
+		LOG("Text too long. Truncated to ~%zu characters", c_index);
+		is_truncated = true;
+	}
+	layout->lines_count  = count;
+	layout->is_truncated = is_truncated;
+	LOG("Laid out %zu lines (from line %zu, reused %zu)", count, first_line, reused);
+
+	if (fit) {
+		fit->computed_lines = (unsigned short int) count;
+		fit->rendered_lines = 0U;
+		fit->truncated      = is_truncated;
+	}
+
+	if (rv == EXIT_SUCCESS) {
+		rv = (layout->cfg.no_truncation && is_truncated) ? ERRCODE(ENOSPC) : (int) count;
+	}
+
+	// Cleanup
+cleanup:
+	scratch_release(scratch);
+	return rv;
+}
+
+// Build the text of a line of a layout, as it should be printed on its own
+// NOTE: Formatted text gets its markup regenerated, so that the line's styles don't depend on the previous lines.
+static char*
+    ot_layout_line_text(const FBInkOTLayout* restrict layout, const FBInkOTLayoutLine* restrict line)
+{
+	const size_t line_len = line->end - line->start;
+	// Worst case, every character needs its own bold & italic markup
+	char* restrict text = scratch_alloc(layout->fmt_buff ? (line_len * 4U) + 1U : line_len + 1U);
+	if (!text) {
+		return NULL;
+	}
+	if (!layout->fmt_buff) {
+		memcpy(text, layout->text + line->start, line_len);
+		text[line_len] = '\0';
+		return text;
+	}
+
+	size_t len       = 0U;
+	bool   is_bold   = false;
+	bool   is_italic = false;
+	for (size_t ci = line->start; ci < line->end;) {
+		const uint8_t style = layout->fmt_buff[ci];
+		const size_t  start = ci;
+		u8_inc(layout->text, &ci);
+		if (style == CH_IGNORE) {
+			continue;
+		}
+		const bool bold   = (style == CH_BOLD || style == CH_BOLD_ITALIC);
+		const bool italic = (style == CH_ITALIC || style == CH_BOLD_ITALIC);
+		if (bold != is_bold) {
+			text[len++] = '*';
+			text[len++] = '*';
+			is_bold     = bold;
+		}
+		if (italic != is_italic) {
+			text[len++] = '*';
+			is_italic   = italic;
+		}
+		memcpy(text + len, layout->text + start, ci - start);
+		len += ci - start;
+	}
+	text[len] = '\0';
+
+	return text;
+}
+#endif    // FBINK_WITH_OPENTYPE
+
+// Create a new, empty OT layout
+int
+    fbink_new_ot_layout(const FBInkOTConfig* restrict cfg UNUSED_BY_MINIMAL,
+			FBInkOTLayout** restrict layout       UNUSED_BY_MINIMAL)
+{
+#ifdef FBINK_WITH_OPENTYPE
+	if (!otInit) {
+		WARN("No fonts have been loaded");
+		return ERRCODE(ENODATA);
+	}
+	if (!cfg || !layout) {
+		WARN("FBInkOTConfig & FBInkOTLayout pointers expected. Got NULL pointer instead");
+		return ERRCODE(EINVAL);
+	}
+
+	FBInkOTLayout* l = calloc(1U, sizeof(*l));
+	if (!l) {
+		WARN("calloc: %m");
+		return ERRCODE(ENOMEM);
+	}
+	l->cfg = *cfg;
+	int rv = ot_compute_area(cfg, &l->tl, &l->br);
+	if (rv != EXIT_SUCCESS) {
+		goto cleanup;
+	}
+	l->max_lw         = (unsigned short int) (l->br.x - l->tl.x);
+	l->print_height   = (unsigned int) (l->br.y - l->tl.y + (viewVertOrigin - viewVertOffset));
+	l->font_size_px   = ot_get_font_size_px(cfg);
+	l->max_row_height = ot_get_scaled_metrics(l->font_size_px, l->sfs, &l->max_baseline, &l->max_lg);
+	if (l->max_row_height <= 0) {
+		WARN("Max line height not set");
+		rv = ERRCODE(EXIT_FAILURE);
+		goto cleanup;
+	}
+	rv = ot_layout_reserve(l, 0U);
+	if (rv != EXIT_SUCCESS) {
+		goto cleanup;
+	}
+	l->text[0U] = '\0';
+	LOG("New %hupx layout in a %hux%u area @ (%hu, %hu)",
+	    l->font_size_px,
+	    l->max_lw,
+	    l->print_height,
+	    l->tl.x,
+	    l->tl.y);
+
+	*layout = l;
+	return EXIT_SUCCESS;
+
+	// Cleanup
+cleanup:
+	fbink_free_ot_layout(l);
+	return rv;
+#else
+	WARN("OpenType support is disabled in this FBInk build");
+	return ERRCODE(ENOSYS);
+#endif    // FBINK_WITH_OPENTYPE
+}
+
+// Replace the text of an OT layout
+int
+    fbink_set_ot_layout_text(FBInkOTLayout* restrict layout UNUSED_BY_MINIMAL,
+			     const char* restrict string    UNUSED_BY_MINIMAL,
+			     FBInkOTFit* restrict fit       UNUSED_BY_MINIMAL)
+{
+#ifdef FBINK_WITH_OPENTYPE
+	if (!layout || !string) {
+		WARN("FBInkOTLayout & string pointers expected. Got NULL pointer instead");
+		return ERRCODE(EINVAL);
+	}
+	if (!u8_isvalid2(string)) {
+		WARN("Cannot print an invalid UTF-8 sequence");
+		return ERRCODE(EILSEQ);
+	}
+
+	return ot_layout_update(layout, string, strlen(string), fit);    // Flawfinder: ignore
+#else
+	WARN("OpenType support is disabled in this FBInk build");
+	return ERRCODE(ENOSYS);
+#endif    // FBINK_WITH_OPENTYPE
+}
+
+// Append text to an OT layout
+int
+    fbink_append_ot_layout_text(FBInkOTLayout* restrict layout UNUSED_BY_MINIMAL,
+				const char* restrict string    UNUSED_BY_MINIMAL,
+				FBInkOTFit* restrict fit       UNUSED_BY_MINIMAL)
+{
+#ifdef FBINK_WITH_OPENTYPE
+	if (!layout || !string) {
+		WARN("FBInkOTLayout & string pointers expected. Got NULL pointer instead");
+		return ERRCODE(EINVAL);
+	}
+	if (!u8_isvalid2(string)) {
+		WARN("Cannot print an invalid UTF-8 sequence");
+		return ERRCODE(EILSEQ);
+	}
+
+	const size_t           len     = strlen(string);    // Flawfinder: ignore
+	const FBInkScratchMark scratch = scratch_mark();
+	char*                  text    = scratch_alloc(layout->len + len + 1U);
+	if (!text) {
+		WARN("Text buffer could not be allocated");
+		return ERRCODE(EXIT_FAILURE);
+	}
+	memcpy(text, layout->text, layout->len);
+	memcpy(text + layout->len, string, len + 1U);
+	const int rv = ot_layout_update(layout, text, layout->len + len, fit);
+	scratch_release(scratch);
+
+	return rv;
+#else
+	WARN("OpenType support is disabled in this FBInk build");
+	return ERRCODE(ENOSYS);
+#endif    // FBINK_WITH_OPENTYPE
+}
+
+// Render an OT layout, only drawing what changed since the previous render
+int
+    fbink_render_ot_layout(int fbfd                              UNUSED_BY_MINIMAL,
+			   FBInkOTLayout* restrict layout        UNUSED_BY_MINIMAL,
+			   const FBInkConfig* restrict fbink_cfg UNUSED_BY_MINIMAL)
+{
+#ifdef FBINK_WITH_OPENTYPE
+	if (!layout) {
+		WARN("FBInkOTLayout expected. Got NULL pointer instead");
+		return ERRCODE(EINVAL);
+	}
+
+	// Open the framebuffer if need be...
+	// NOTE: Do it once and for all, instead of once per line.
+	bool keep_fd = true;
+	if (open_fb_fd(&fbfd, &keep_fd) != EXIT_SUCCESS) {
+		return ERRCODE(EXIT_FAILURE);
+	}
+
+	// Assume success, until shit happens ;)
+	int                    rv      = EXIT_SUCCESS;
+	int                    redrawn = 0;
+	const FBInkScratchMark scratch = scratch_mark();
+
+	// mmap fb to user mem
+	if (!isFbMapped) {
+		if (memmap_fb(fbfd) != EXIT_SUCCESS) {
+			rv = ERRCODE(EXIT_FAILURE);
+			goto cleanup;
+		}
+	}
+
+	// Every line is printed on its own, and we'll handle the refresh ourselves
+	FBInkConfig cfg = { 0 };
+	if (fbink_cfg) {
+		cfg = *fbink_cfg;
+	}
+	FBInkConfig line_cfg = cfg;
+	line_cfg.valign      = NONE;
+	line_cfg.is_cleared  = false;
+	line_cfg.no_refresh  = true;
+	FBInkOTConfig ot_cfg = layout->cfg;
+	ot_cfg.size_px       = layout->font_size_px;
+	ot_cfg.compute_only  = false;
+	ot_cfg.no_truncation = false;
+	ot_cfg.margins.left  = (short int) layout->tl.x;
+	ot_cfg.margins.right = (short int) (viewWidth - layout->br.x);
+
+	// Compare what we want to draw with what we've drawn last time
+	const size_t nb_lines = MAX(layout->lines_count, layout->drawn_count);
+	if (nb_lines > layout->drawn_capacity) {
+		FBInkOTDrawnLine* drawn = realloc(layout->drawn, nb_lines * sizeof(*drawn));
+		if (!drawn) {
+			WARN("realloc: %m");
+			rv = ERRCODE(ENOMEM);
+			goto cleanup;
+		}
+		memset(drawn + layout->drawn_capacity, 0, (nb_lines - layout->drawn_capacity) * sizeof(*drawn));
+		layout->drawn          = drawn;
+		layout->drawn_capacity = nb_lines;
+	}
+	FBInkOTDrawnLine* wanted   = scratch_calloc(nb_lines, sizeof(*wanted));
+	bool*             is_dirty = scratch_calloc(nb_lines, sizeof(*is_dirty));
+	if (!wanted || !is_dirty) {
+		WARN("Lines metadata buffer could not be allocated");
+		rv = ERRCODE(EXIT_FAILURE);
+		goto cleanup;
+	}
+	unsigned int y            = 0U;
+	unsigned int dirty_top    = layout->print_height;
+	unsigned int dirty_bottom = 0U;
+	for (size_t i = 0U; i < nb_lines; i++) {
+		if (i < layout->lines_count) {
+			const FBInkOTLayoutLine* restrict line = layout->lines + i;
+			wanted[i].text                         = ot_layout_line_text(layout, line);
+			if (!wanted[i].text) {
+				WARN("Line buffer could not be allocated");
+				rv = ERRCODE(EXIT_FAILURE);
+				goto cleanup;
+			}
+			// NOTE: ot_layout_update already made sure its render box fits (see below).
+			const unsigned int height = (unsigned int) (line->height + line->line_gap);
+			wanted[i].y               = (unsigned short int) y;
+			wanted[i].height          = (unsigned short int) height;
+			y += height;
+		}
+
+		const FBInkOTDrawnLine* restrict drawn = layout->drawn + i;
+		if (drawn->y == wanted[i].y && drawn->height == wanted[i].height &&
+		    ((!drawn->text && !wanted[i].text) ||
+		     (drawn->text && wanted[i].text && strcmp(drawn->text, wanted[i].text) == 0))) {
+			continue;
+		}
+		is_dirty[i] = true;
+
+		// Clear both where it was, and where it'll be.
+		// NOTE: Lines never overlap, and unchanged lines haven't moved, so this only clears what we'll redraw.
+		const FBInkOTDrawnLine* const clears[] = { drawn, wanted + i };
+		for (uint8_t j = 0U; j < 2U; j++) {
+			if (clears[j]->height == 0U) {
+				continue;
+			}
+			const FBInkRect rect = {
+				.left   = layout->tl.x,
+				.top    = (unsigned short int) (layout->tl.y + clears[j]->y),
+				.width  = layout->max_lw,
+				.height = clears[j]->height,
+			};
+			fbink_cls(fbfd, &line_cfg, &rect);
+			dirty_top    = MIN(dirty_top, (unsigned int) clears[j]->y);
+			dirty_bottom = MAX(dirty_bottom, (unsigned int) (clears[j]->y + clears[j]->height));
+		}
+	}
+
+	// Now that everything that needs to be is cleared, draw
+	const int top_margin = layout->tl.y - (viewVertOrigin - viewVertOffset);
+	for (size_t i = 0U; i < nb_lines; i++) {
+		if (!is_dirty[i]) {
+			continue;
+		}
+		FBInkOTDrawnLine* restrict drawn = layout->drawn + i;
+		free(drawn->text);
+		*drawn = (FBInkOTDrawnLine){ .y = wanted[i].y, .height = wanted[i].height };
+		if (!wanted[i].text) {
+			continue;
+		}
+		redrawn++;
+
+		// fbink_print_ot needs room for at least a full row, even if this line ends up being shorter
+		// NOTE: ot_layout_update only keeps lines for which that fits in the layout's area,
+		//       so this box is never clamped (which would leave fbink_print_ot no room for a single line).
+		if (*wanted[i].text) {
+			const int box_height = MAX((int) wanted[i].height, layout->max_row_height);
+			ot_cfg.margins.top    = (short int) (top_margin + wanted[i].y);
+			const int bottom_edge = top_margin + wanted[i].y + box_height;
+			ot_cfg.margins.bottom = (short int) MAX(0, (int) viewHeight - bottom_edge);
+			const int ret         = fbink_print_ot(fbfd, wanted[i].text, &ot_cfg, &line_cfg, NULL);
+			if (ret < 0) {
+				// NOTE: Leaving text NULL ensures we'll try again next time.
+				WARN("Failed to render line %zu", i);
+				rv = ret;
+				continue;
+			}
+		}
+		drawn->text = strdup(wanted[i].text);
+	}
+	layout->drawn_count = layout->lines_count;
+
+	// Refresh everything we've touched at once
+	if (dirty_bottom > dirty_top) {
+		struct mxcfb_rect region = {
+			.top    = layout->tl.y + dirty_top,
+			.left   = layout->tl.x,
+			.width  = layout->max_lw,
+			.height = dirty_bottom - dirty_top,
+		};
+		set_last_rect(&region);
+		if (refresh(fbfd,
+			    region,
+			    get_wfm_mode(cfg.wfm_mode),
+			    cfg.is_dithered ? EPDC_FLAG_USE_DITHERING_ORDERED : EPDC_FLAG_USE_DITHERING_PASSTHROUGH,
+			    cfg.is_nightmode,
+			    cfg.is_flashing,
+			    cfg.no_refresh) != EXIT_SUCCESS) {
+			WARN("Failed to refresh the screen");
+			rv = ERRCODE(EXIT_FAILURE);
+		}
+	}
+
+	// Cleanup
+cleanup:
+	scratch_release(scratch);
+	if (isFbMapped && !keep_fd) {
+		unmap_fb();
+	}
+	if (!keep_fd) {
+		close(fbfd);
+	}
+
+	return rv == EXIT_SUCCESS ? redrawn : rv;
+#else
+	WARN("OpenType support is disabled in this FBInk build");
+	return ERRCODE(ENOSYS);
+#endif    // FBINK_WITH_OPENTYPE
+}
+
+// Free an OT layout
+int
+    fbink_free_ot_layout(FBInkOTLayout* restrict layout UNUSED_BY_MINIMAL)
+{
+#ifdef FBINK_WITH_OPENTYPE
+	if (!layout) {
+		return ERRCODE(EINVAL);
+	}
+
+	for (size_t i = 0U; i < layout->drawn_capacity; i++) {
+		free(layout->drawn[i].text);
+	}
+	free(layout->drawn);
+	free(layout->lines);
+	free(layout->chars);
+	free(layout->fmt_buff);
+	free(layout->brk_buff);
+	free(layout->text);
+	free(layout);
+
+	return EXIT_SUCCESS;
+#else
+	WARN("OpenType support is disabled in this FBInk build");
+	return ERRCODE(ENOSYS);
+#endif    // FBINK_WITH_OPENTYPE
+}
+
+// Convert our public WFM_MODE_INDEX_T values to an appropriate mxcfb waveform mode constant for the current device
+static uint32_t
+    get_wfm_mode(uint8_t wfm_mode_index)
+{
+	uint32_t waveform_mode = WAVEFORM_MODE_AUTO;
+
+	// Parse waveform mode...
+#if defined(FBINK_FOR_KINDLE)
+	// Is this a Zelda or a Rex with new waveforms?
+	bool has_new_wfm = false;
+	if (deviceQuirks.isKindleZelda || deviceQuirks.isKindleRex) {
+		has_new_wfm = true;
+	}
+
+	switch (wfm_mode_index) {
+		case WFM_INIT:
+			waveform_mode = WAVEFORM_MODE_INIT;
+			break;
+		case WFM_AUTO:
+			waveform_mode = WAVEFORM_MODE_AUTO;
+			break;
+		case WFM_DU:
+			waveform_mode = WAVEFORM_MODE_DU;
+			break;
+		case WFM_GC16:
+			waveform_mode = WAVEFORM_MODE_GC16;
+			break;
+		case WFM_GC4:
+			waveform_mode = WAVEFORM_MODE_GC4;
+			break;
+		case WFM_A2:
+			if (has_new_wfm) {
+				waveform_mode = WAVEFORM_MODE_ZELDA_A2;
+			} else {
+				waveform_mode = WAVEFORM_MODE_A2;
+			}
+			break;
+		case WFM_GL16:
+			if (has_new_wfm) {
+				waveform_mode = WAVEFORM_MODE_ZELDA_GL16;
+			} else {
+				waveform_mode = WAVEFORM_MODE_GL16;
+			}
+			break;
+		case WFM_REAGL:
+			if (has_new_wfm) {
+				waveform_mode = WAVEFORM_MODE_ZELDA_REAGL;
+			} else {
+				waveform_mode = WAVEFORM_MODE_REAGL;
+			}
+			break;
+		case WFM_REAGLD:
+			if (has_new_wfm) {
+				waveform_mode = WAVEFORM_MODE_ZELDA_REAGLD;
+			} else {
+				waveform_mode = WAVEFORM_MODE_REAGLD;
+			}
+			break;
+		case WFM_GC16_FAST:
+			if (has_new_wfm) {
+				waveform_mode = WAVEFORM_MODE_ZELDA_GC16_FAST;
+			} else {
+				waveform_mode = WAVEFORM_MODE_GC16_FAST;
+			}
+			break;
+		case WFM_GL16_FAST:
+			if (has_new_wfm) {
+				waveform_mode = WAVEFORM_MODE_ZELDA_GL16_FAST;
+			} else {
+				waveform_mode = WAVEFORM_MODE_GL16_FAST;
+			}
+			break;
+		case WFM_DU4:
+			waveform_mode = WAVEFORM_MODE_DU4;
+			break;
+		case WFM_GL4:
+			if (has_new_wfm) {
+				waveform_mode = WAVEFORM_MODE_ZELDA_GL4;
+			} else {
+				waveform_mode = WAVEFORM_MODE_GL4;
+			}
+			break;
+		case WFM_GL16_INV:
+			if (has_new_wfm) {
+				waveform_mode = WAVEFORM_MODE_ZELDA_GL16_INV;
+			} else {
+				waveform_mode = WAVEFORM_MODE_GL16_INV;
+			}
+			break;
+		case WFM_GCK16:
+			waveform_mode = WAVEFORM_MODE_ZELDA_GCK16;
+			break;
+		case WFM_GLKW16:
+			waveform_mode = WAVEFORM_MODE_ZELDA_GLKW16;
+			break;
+		default:
+			LOG("Unknown (or unsupported) waveform mode '%s' @ index %hhu, defaulting to AUTO",
+			    wfm_to_string(wfm_mode_index),
+			    wfm_mode_index);
+			waveform_mode = WAVEFORM_MODE_AUTO;
+			break;
+	}
+#elif defined(FBINK_FOR_REMARKABLE)
+	// NOTE: Let's go with a dedicated switch for the reMarkable,
+	//       because we don't actually have sane constant names in the upstream kernel,
+	//       and some of what's detailed in the SDK's <epframebuffer.h> looks slightly weird...
+	// NOTE: See https://github.com/NiLuJe/FBInk/pull/41#issuecomment-579012002 if you want to help make this more accurate!
+	switch (wfm_mode_index) {
+		case WFM_INIT:
+			waveform_mode = WAVEFORM_MODE_INIT;
+			break;
+		case WFM_AUTO:
+			waveform_mode = WAVEFORM_MODE_AUTO;
+			break;
+		case WFM_DU:
+			waveform_mode = WAVEFORM_MODE_DU;
+			break;
+		case WFM_GC16:
+			waveform_mode = WAVEFORM_MODE_GC16;
+			break;
+		case WFM_GL16:
+			waveform_mode = WAVEFORM_MODE_GL16;
+			break;
+		case WFM_REAGL:
+			waveform_mode = WAVEFORM_MODE_GLR16;
+			break;
+		case WFM_REAGLD:
+			waveform_mode = WAVEFORM_MODE_GLD16;
+			break;
+		case WFM_A2:
+			waveform_mode = WAVEFORM_MODE_A2;
+			break;
+		case WFM_DU4:
+			waveform_mode = WAVEFORM_MODE_DU4;
+			break;
+		case WFM_UNKNOWN:
+			waveform_mode = WAVEFORM_MODE_UNKNOWN;
+			break;
+		case WFM_INIT2:
+			waveform_mode = WAVEFORM_MODE_INIT2;
+			break;
+		default:
+			LOG("Unknown (or unsupported) waveform mode '%s' @ index %hhu, defaulting to AUTO",
+			    wfm_to_string(wfm_mode_index),
+			    wfm_mode_index);
+			waveform_mode = WAVEFORM_MODE_AUTO;
+			break;
+	}
+#else
+	switch (wfm_mode_index) {
+		case WFM_INIT:
+			waveform_mode = WAVEFORM_MODE_INIT;
+			break;
+		case WFM_AUTO:
+			waveform_mode = WAVEFORM_MODE_AUTO;
 			break;
 		case WFM_DU:
 			waveform_mode = WAVEFORM_MODE_DU;
@@ -5307,6 +7790,11 @@ int
     fbink_wait_for_submission(int fbfd UNUSED_BY_NOTKINDLE, uint32_t marker UNUSED_BY_NOTKINDLE)
 {
 #ifdef FBINK_FOR_KINDLE
+	// Nothing to wait for on a canvas, refreshes are instantaneous ;).
+	if (isCanvas) {
+		return EXIT_SUCCESS;
+	}
+
 	// Open the framebuffer if need be (nonblock, we'll only do ioctls)...
 	bool keep_fd = true;
 	if (open_fb_fd_nonblock(&fbfd, &keep_fd) != EXIT_SUCCESS) {
@@ -5349,6 +7837,11 @@ int
     fbink_wait_for_complete(int fbfd UNUSED_BY_LINUX, uint32_t marker UNUSED_BY_LINUX)
 {
 #ifndef FBINK_FOR_LINUX
+	// Nothing to wait for on a canvas, refreshes are instantaneous ;).
+	if (isCanvas) {
+		return EXIT_SUCCESS;
+	}
+
 	// Open the framebuffer if need be (nonblock, we'll only do ioctls)...
 	bool keep_fd = true;
 	if (open_fb_fd_nonblock(&fbfd, &keep_fd) != EXIT_SUCCESS) {
@@ -5398,13 +7891,322 @@ uint32_t
 #endif    // !FBINK_FOR_LINUX
 }
 
+// Send all the refresh requests queued in deferred mode
+int
+    fbink_flush(int fbfd UNUSED_BY_LINUX)
+{
+#ifndef FBINK_FOR_LINUX
+	// Nothing to do?
+	if (refreshQueueLen == 0U) {
+		return 0;
+	}
+
+	// Open the framebuffer if need be (nonblock, we'll only do ioctls)...
+	bool keep_fd = true;
+	if (open_fb_fd_nonblock(&fbfd, &keep_fd) != EXIT_SUCCESS) {
+		return ERRCODE(EXIT_FAILURE);
+	}
+
+	// NOTE: We keep going on failure, there's no sense in leaving the rest of the screen stale...
+	int rv   = EXIT_SUCCESS;
+	int sent = 0;
+	for (uint8_t i = 0U; i < refreshQueueLen; i++) {
+		const FBInkRefreshRequest* restrict req = refreshQueue + i;
+		if (send_refresh(fbfd,
+				 req->region,
+				 req->waveform_mode,
+				 req->dithering_mode,
+				 req->is_nightmode,
+				 req->is_flashing) != EXIT_SUCCESS) {
+			WARN("Failed to refresh the screen");
+			rv = ERRCODE(EXIT_FAILURE);
+		} else {
+			sent++;
+		}
+	}
+	LOG("Flushed %d queued refresh requests", sent);
+	refreshQueueLen = 0U;
+
+	if (!keep_fd) {
+		close(fbfd);
+	}
+
+	return (rv == EXIT_SUCCESS) ? sent : rv;
+#else
+	return 0;
+#endif    // !FBINK_FOR_LINUX
+}
+
+// Toggle deferred refresh mode (c.f., fbink_flush)
+int
+    fbink_set_deferred_refresh(int fbfd UNUSED_BY_LINUX, bool enable UNUSED_BY_LINUX)
+{
+#ifndef FBINK_FOR_LINUX
+	isRefreshDeferred = enable;
+	// Don't leave anything behind when going back to immediate refreshes
+	if (!enable) {
+		const int rv = fbink_flush(fbfd);
+		return (rv < 0) ? rv : EXIT_SUCCESS;
+	}
+#endif    // !FBINK_FOR_LINUX
+	return EXIT_SUCCESS;
+}
+
+#ifndef FBINK_FOR_LINUX
+// The async refresh worker's main loop: wait for in-flight updates to complete, in order, and report back
+static void*
+    async_refresh_worker(void* arg __attribute__((unused)))
+{
+	pthread_mutex_lock(&asyncRefreshLock);
+	while (true) {
+		while (asyncRefreshLen == 0U && !isAsyncRefreshDying) {
+			pthread_cond_wait(&asyncRefreshCond, &asyncRefreshLock);
+		}
+		// NOTE: We only honor a stop request once everything in flight has been taken care of.
+		if (asyncRefreshLen == 0U) {
+			break;
+		}
+		const FBInkAsyncRefresh req = asyncRefreshQueue[asyncRefreshHead];
+		const int               evfd = asyncRefreshEventFd;
+		pthread_mutex_unlock(&asyncRefreshLock);
+
+		// This is the part that blocks, hence the whole thread business ;).
+		int status = wait_for_complete(asyncRefreshFd, req.marker);
+		if (status != EXIT_SUCCESS) {
+			WARN("Failed to wait for completion of update %u", req.marker);
+		}
+
+		pthread_mutex_lock(&asyncRefreshLock);
+		asyncRefreshHead = (uint8_t)((asyncRefreshHead + 1U) % ASYNC_REFRESH_QUEUE_SIZE);
+		asyncRefreshLen--;
+		lastCompletedMarker = req.marker;
+		// Wake up fbink_refresh_async if it was waiting for a free slot
+		pthread_cond_broadcast(&asyncRefreshCond);
+		pthread_mutex_unlock(&asyncRefreshLock);
+
+		if (req.callback) {
+			req.callback(req.marker, status, req.userdata);
+		}
+		if (evfd != -1) {
+			eventfd_write(evfd, 1U);
+		}
+
+		pthread_mutex_lock(&asyncRefreshLock);
+	}
+	pthread_mutex_unlock(&asyncRefreshLock);
+
+	return NULL;
+}
+
+// Spin up the async refresh worker, if it isn't running already
+static int
+    start_async_refresh_worker(void)
+{
+	if (isAsyncRefreshActive) {
+		return EXIT_SUCCESS;
+	}
+
+	// NOTE: The worker gets its own fd, so it doesn't depend on the lifetime of the caller's.
+	asyncRefreshFd = open("/dev/fb0", O_RDONLY | O_NONBLOCK | O_CLOEXEC);
+	if (asyncRefreshFd == -1) {
+		WARN("Cannot open framebuffer character device: %m");
+		return ERRCODE(EXIT_FAILURE);
+	}
+
+	asyncRefreshHead    = 0U;
+	asyncRefreshLen     = 0U;
+	isAsyncRefreshDying = false;
+	int ret             = pthread_create(&asyncRefreshThread, NULL, &async_refresh_worker, NULL);
+	if (ret != 0) {
+		WARN("pthread_create: %s", strerror(ret));
+		close(asyncRefreshFd);
+		asyncRefreshFd = -1;
+		return ERRCODE(EXIT_FAILURE);
+	}
+	isAsyncRefreshActive = true;
+	LOG("Started the async refresh worker");
+
+	return EXIT_SUCCESS;
+}
+#endif    // !FBINK_FOR_LINUX
+
+// Send a refresh, and let the async refresh worker wait for it
+uint32_t
+    fbink_refresh_async(int fbfd                              UNUSED_BY_LINUX,
+			uint32_t region_top                   UNUSED_BY_LINUX,
+			uint32_t region_left                  UNUSED_BY_LINUX,
+			uint32_t region_width                 UNUSED_BY_LINUX,
+			uint32_t region_height                UNUSED_BY_LINUX,
+			uint8_t dithering_mode                UNUSED_BY_LINUX,
+			const FBInkConfig* restrict fbink_cfg UNUSED_BY_LINUX,
+			FBInkRefreshCallback callback         UNUSED_BY_LINUX,
+			void* userdata                        UNUSED_BY_LINUX)
+{
+#ifndef FBINK_FOR_LINUX
+#	ifdef FBINK_FOR_KINDLE
+	// There's no such thing as an update marker with einkfb...
+	if (deviceQuirks.isKindleLegacy) {
+		WARN("Async refreshes are not supported on legacy einkfb devices");
+		return LAST_MARKER;
+	}
+#	endif
+
+	// There's no EPDC to wait for behind a canvas
+	if (isCanvas) {
+		WARN("Async refreshes are not supported on a canvas");
+		return LAST_MARKER;
+	}
+
+	if (start_async_refresh_worker() != EXIT_SUCCESS) {
+		return LAST_MARKER;
+	}
+
+	// Open the framebuffer if need be (nonblock, we'll only do ioctls)...
+	bool keep_fd = true;
+	if (open_fb_fd_nonblock(&fbfd, &keep_fd) != EXIT_SUCCESS) {
+		return LAST_MARKER;
+	}
+
+	uint32_t marker = LAST_MARKER;
+
+	// Same for the dithering mode, if we actually requested dithering...
+	int region_dither = EPDC_FLAG_USE_DITHERING_PASSTHROUGH;
+	if (dithering_mode > 0U) {
+		region_dither = get_hwd_mode(dithering_mode);
+	} else {
+		LOG("No hardware dithering requested");
+	}
+
+	struct mxcfb_rect region = {
+		.top    = region_top,
+		.left   = region_left,
+		.width  = region_width,
+		.height = region_height,
+	};
+
+	// If region is empty, do a full-screen refresh!
+	if (region.top == 0U && region.left == 0U && region.width == 0U && region.height == 0U) {
+		fullscreen_region(&region);
+	}
+
+	// NOTE: Same sanity check as in refresh(), since we're bypassing it (and the deferred queue with it).
+	if (region.width <= 1 || region.height <= 1) {
+		WARN("Discarding bogus empty region (%ux%u) to avoid a softlock", region.width, region.height);
+		goto cleanup;
+	}
+
+	// Make sure we have room to track it *before* sending it
+	pthread_mutex_lock(&asyncRefreshLock);
+	while (asyncRefreshLen == ASYNC_REFRESH_QUEUE_SIZE) {
+		LOG("Too many async refreshes in flight, waiting for the oldest one to complete");
+		pthread_cond_wait(&asyncRefreshCond, &asyncRefreshLock);
+	}
+	if (send_refresh(fbfd,
+			 region,
+			 get_wfm_mode(fbink_cfg->wfm_mode),
+			 region_dither,
+			 fbink_cfg->is_nightmode,
+			 fbink_cfg->is_flashing) != EXIT_SUCCESS) {
+		pthread_mutex_unlock(&asyncRefreshLock);
+		WARN("Failed to refresh the screen");
+		goto cleanup;
+	}
+	marker = lastMarker;
+	asyncRefreshQueue[(asyncRefreshHead + asyncRefreshLen) % ASYNC_REFRESH_QUEUE_SIZE] = (FBInkAsyncRefresh){
+		.marker   = marker,
+		.callback = callback,
+		.userdata = userdata,
+	};
+	asyncRefreshLen++;
+	pthread_cond_broadcast(&asyncRefreshCond);
+	pthread_mutex_unlock(&asyncRefreshLock);
+
+cleanup:
+	if (!keep_fd) {
+		close(fbfd);
+	}
+
+	return marker;
+#else
+	WARN("e-Ink screen refreshes require an e-Ink device");
+	return LAST_MARKER;
+#endif    // !FBINK_FOR_LINUX
+}
+
+// Simple public getter for the async refresh worker's eventfd (created on demand)
+int
+    fbink_get_refresh_eventfd(void)
+{
+#ifndef FBINK_FOR_LINUX
+	pthread_mutex_lock(&asyncRefreshLock);
+	if (asyncRefreshEventFd == -1) {
+		asyncRefreshEventFd = eventfd(0U, EFD_CLOEXEC | EFD_NONBLOCK | EFD_SEMAPHORE);
+		if (asyncRefreshEventFd == -1) {
+			WARN("eventfd: %m");
+		}
+	}
+	const int evfd = asyncRefreshEventFd;
+	pthread_mutex_unlock(&asyncRefreshLock);
+
+	return (evfd == -1) ? ERRCODE(EXIT_FAILURE) : evfd;
+#else
+	WARN("e-Ink screen refreshes require an e-Ink device");
+	return ERRCODE(ENOSYS);
+#endif    // !FBINK_FOR_LINUX
+}
+
+// Simple public getter for lastCompletedMarker
+uint32_t
+    fbink_get_last_completed_marker(void)
+{
+#ifndef FBINK_FOR_LINUX
+	pthread_mutex_lock(&asyncRefreshLock);
+	const uint32_t marker = lastCompletedMarker;
+	pthread_mutex_unlock(&asyncRefreshLock);
+
+	return marker;
+#else
+	return LAST_MARKER;
+#endif    // !FBINK_FOR_LINUX
+}
+
+// Drain & stop the async refresh worker
+int
+    fbink_stop_refresh_worker(void)
+{
+#ifndef FBINK_FOR_LINUX
+	if (isAsyncRefreshActive) {
+		pthread_mutex_lock(&asyncRefreshLock);
+		isAsyncRefreshDying = true;
+		pthread_cond_broadcast(&asyncRefreshCond);
+		pthread_mutex_unlock(&asyncRefreshLock);
+
+		int ret = pthread_join(asyncRefreshThread, NULL);
+		if (ret != 0) {
+			WARN("pthread_join: %s", strerror(ret));
+			return ERRCODE(EXIT_FAILURE);
+		}
+		isAsyncRefreshActive = false;
+		close(asyncRefreshFd);
+		asyncRefreshFd = -1;
+		LOG("Stopped the async refresh worker");
+	}
+
+	if (asyncRefreshEventFd != -1) {
+		close(asyncRefreshEventFd);
+		asyncRefreshEventFd = -1;
+	}
+#endif    // !FBINK_FOR_LINUX
+	return EXIT_SUCCESS;
+}
+
 // Simple public getter for temporary Device Quirks
 // NOTE: Deprecated, see fbink_reinit instead!
 bool
     fbink_is_fb_quirky(void)
 {
 	// NOTE: For now, that's easy enough, we only have one ;).
-	return deviceQuirks.isNTX16bLandscape;
+	return isNTX16bLandscape;
 }
 
 // Reinitialize FBInk in case the framebuffer state has changed
@@ -5422,49 +8224,266 @@ int
     fbink_reinit(int fbfd UNUSED_BY_KINDLE, const FBInkConfig* restrict fbink_cfg UNUSED_BY_KINDLE)
 {
 #ifndef FBINK_FOR_KINDLE
+	// A canvas can't change behind our back ;).
+	if (isCanvas) {
+		return EXIT_SUCCESS;
+	}
+
+	// If the layout watcher is running, it'll have told us about any change, so we can skip the ioctl entirely.
+	// NOTE: It only tracks the default context's layout.
+	if (currentContext == &defaultContext && isFbWatcherActive) {
+		pthread_mutex_lock(&fbWatcherLock);
+		const bool is_dirty = isFbLayoutDirty;
+		isFbLayoutDirty     = false;
+		if (is_dirty) {
+			// Ack it, so that a caller polling the eventfd doesn't keep waking up
+			eventfd_t val;
+			eventfd_read(fbWatcherEventFd, &val);
+		}
+		pthread_mutex_unlock(&fbWatcherLock);
+		if (!is_dirty) {
+			return EXIT_SUCCESS;
+		}
+	}
+
 	// So, we're concerned with stuff that affects the logical & physical layout, namely, bitdepth & rotation.
 	uint32_t old_bpp  = vInfo.bits_per_pixel;
 	uint32_t old_rota = vInfo.rotate;
 
-	// Open the framebuffer if need be (nonblock, we'll only do ioctls)...
-	bool keep_fd = true;
-	if (open_fb_fd_nonblock(&fbfd, &keep_fd) != EXIT_SUCCESS) {
-		return ERRCODE(EXIT_FAILURE);
+	// Open the framebuffer if need be (nonblock, we'll only do ioctls)...
+	bool keep_fd = true;
+	if (open_fb_fd_nonblock(&fbfd, &keep_fd) != EXIT_SUCCESS) {
+		return ERRCODE(EXIT_FAILURE);
+	}
+
+	// Assume success, until shit happens ;)
+	int rv = EXIT_SUCCESS;
+
+	// Now that we've stored the relevant bits of the previous state, query the current one...
+	if (ioctl(fbfd, FBIOGET_VSCREENINFO, &vInfo)) {
+		WARN("Error reading variable fb information: %m");
+		rv = ERRCODE(EXIT_FAILURE);
+		goto cleanup;
+	}
+
+	// A layout change invalidates the back buffer's content (and possibly its size), so, drop it.
+	if (isBackBufferActive && (old_bpp != vInfo.bits_per_pixel || old_rota != vInfo.rotate)) {
+		ELOG("Dropping the back buffer because of a framebuffer layout change");
+		release_back_buffer();
+	}
+
+	// Start with the more drastic change: bitdepth, before checking rotation
+	if (old_bpp != vInfo.bits_per_pixel) {
+		// It's a reinit, so ask to skip the vinfo ioctl we just did
+		ELOG("Detected a change in framebuffer bitdepth, reinitializing...");
+		rv = initialize_fbink(fbfd, fbink_cfg, true);
+	} else if (old_rota != vInfo.rotate) {
+		// It's a reinit, so ask to skip the vinfo ioctl we just did
+		ELOG("Detected a change in framebuffer rotation, reinitializing...");
+		rv = initialize_fbink(fbfd, fbink_cfg, true);
+	}
+
+	// And we're done!
+	// We keep silent when we do nothing, to avoid flooding logs (mainly, KFMon's ;)).
+
+cleanup:
+	if (!keep_fd) {
+		close(fbfd);
+	}
+
+	return rv;
+#else
+	// NOTE: I currently haven't found the need for any shenanigans like that on Kindle, so, make this a NOP there ;).
+	// NOTE: That said, we technically could make use of the canRotate quirk if we had an API user on Kindle that cared...
+	WARN("Reinitilization is not needed on Kindle devices :)");
+	return ERRCODE(ENOSYS);
+#endif    // !FBINK_FOR_KINDLE
+}
+
+#ifndef FBINK_FOR_KINDLE
+// The layout watcher's main loop: check the fb's layout whenever we get a uevent about it, or every interval,
+// and flag it as dirty if it no longer matches what our last (re)init saw.
+static void*
+    fb_watcher(void* arg __attribute__((unused)))
+{
+	// NOTE: uevents are only a hint: mainline fbdev doesn't send any on mode changes,
+	//       but some vendor kernels do on rotation, so, it's worth listening for them.
+	int uevfd = socket(AF_NETLINK, SOCK_DGRAM | SOCK_NONBLOCK | SOCK_CLOEXEC, NETLINK_KOBJECT_UEVENT);
+	if (uevfd == -1) {
+		LOG("Failed to open a uevent socket, the layout watcher will only poll: %m");
+	} else {
+		const struct sockaddr_nl addr = { .nl_family = AF_NETLINK, .nl_groups = 1U };
+		if (bind(uevfd, (const struct sockaddr*) &addr, sizeof(addr)) == -1) {
+			LOG("Failed to bind the uevent socket, the layout watcher will only poll: %m");
+			close(uevfd);
+			uevfd = -1;
+		}
+	}
+
+	// NOTE: poll ignores negative fds, so a missing uevent socket is fine.
+	struct pollfd pfds[2] = {
+		{ .fd = fbWatcherStopFd, .events = POLLIN },
+		{ .fd = uevfd, .events = POLLIN },
+	};
+	while (true) {
+		int pn = poll(pfds, 2U, fbWatcherIntervalMs);
+		if (pn == -1) {
+			if (errno == EINTR) {
+				continue;
+			}
+			WARN("poll: %m");
+			break;
+		}
+		if (pfds[0].revents & POLLIN) {
+			break;
+		}
+		if (pn > 0) {
+			// Drain the socket, and only bother checking if one of those was about a framebuffer
+			// NOTE: A uevent is a list of NUL-separated strings, the first one being action@devpath.
+			bool    is_fb = false;
+			char    buf[FB_WATCHER_UEVENT_SIZE];
+			ssize_t len;
+			while ((len = recv(uevfd, buf, sizeof(buf) - 1U, 0)) > 0) {
+				buf[len] = '\0';
+				if (strstr(buf, "/graphics/fb")) {
+					is_fb = true;
+				}
+			}
+			if (!is_fb) {
+				continue;
+			}
+		}
+
+		struct fb_var_screeninfo var_info;
+		if (ioctl(fbWatcherFd, FBIOGET_VSCREENINFO, &var_info)) {
+			WARN("Error reading variable fb information: %m");
+			continue;
+		}
+		pthread_mutex_lock(&fbWatcherLock);
+		if (!isFbLayoutDirty && (var_info.bits_per_pixel != fbWatcherBpp || var_info.rotate != fbWatcherRota)) {
+			LOG("Framebuffer layout changed (%ubpp @ rota %u => %ubpp @ rota %u)",
+			    fbWatcherBpp,
+			    fbWatcherRota,
+			    var_info.bits_per_pixel,
+			    var_info.rotate);
+			isFbLayoutDirty = true;
+			eventfd_write(fbWatcherEventFd, 1U);
+		}
+		pthread_mutex_unlock(&fbWatcherLock);
+	}
+
+	if (uevfd != -1) {
+		close(uevfd);
 	}
 
-	// Assume success, until shit happens ;)
-	int rv = EXIT_SUCCESS;
+	return NULL;
+}
+#endif    // !FBINK_FOR_KINDLE
 
-	// Now that we've stored the relevant bits of the previous state, query the current one...
-	if (ioctl(fbfd, FBIOGET_VSCREENINFO, &vInfo)) {
-		WARN("Error reading variable fb information: %m");
-		rv = ERRCODE(EXIT_FAILURE);
-		goto cleanup;
+// Start watching the framebuffer for layout changes, so that fbink_reinit can be a NOP when nothing changed
+int
+    fbink_start_fb_watcher(int interval_ms UNUSED_BY_KINDLE)
+{
+#ifndef FBINK_FOR_KINDLE
+	if (isCanvas) {
+		WARN("A canvas can't change behind our back, there's nothing to watch");
+		return ERRCODE(ENOTSUP);
+	}
+	// We need a reference layout to compare against
+	if (vInfo.bits_per_pixel == 0U) {
+		WARN("The layout watcher requires a prior fbink_init call");
+		return ERRCODE(ENODATA);
+	}
+	// NOTE: Most kernels never send a uevent on a mode change, so we can't rely on those alone:
+	//       without a periodic check, fbink_reinit would end up trusting a stale layout forever.
+	if (interval_ms < 0) {
+		WARN("Invalid layout watcher interval: %dms", interval_ms);
+		return ERRCODE(EINVAL);
+	}
+	if (isFbWatcherActive) {
+		return fbWatcherEventFd;
 	}
 
-	// Start with the more drastic change: bitdepth, before checking rotation
-	if (old_bpp != vInfo.bits_per_pixel) {
-		// It's a reinit, so ask to skip the vinfo ioctl we just did
-		ELOG("Detected a change in framebuffer bitdepth, reinitializing...");
-		rv = initialize_fbink(fbfd, fbink_cfg, true);
-	} else if (old_rota != vInfo.rotate) {
-		// It's a reinit, so ask to skip the vinfo ioctl we just did
-		ELOG("Detected a change in framebuffer rotation, reinitializing...");
-		rv = initialize_fbink(fbfd, fbink_cfg, true);
+	// NOTE: The watcher gets its own fd, so it doesn't depend on the lifetime of the caller's.
+	fbWatcherFd = open("/dev/fb0", O_RDONLY | O_NONBLOCK | O_CLOEXEC);
+	if (fbWatcherFd == -1) {
+		WARN("Cannot open framebuffer character device: %m");
+		return ERRCODE(EXIT_FAILURE);
 	}
+	fbWatcherEventFd = eventfd(0U, EFD_CLOEXEC | EFD_NONBLOCK);
+	fbWatcherStopFd  = eventfd(0U, EFD_CLOEXEC | EFD_NONBLOCK);
+	if (fbWatcherEventFd == -1 || fbWatcherStopFd == -1) {
+		WARN("eventfd: %m");
+		goto failure;
+	}
+
+	fbWatcherIntervalMs = (interval_ms == 0) ? FB_WATCHER_DEFAULT_INTERVAL_MS : interval_ms;
+	fbWatcherBpp        = vInfo.bits_per_pixel;
+	fbWatcherRota       = vInfo.rotate;
+	isFbLayoutDirty     = false;
+
+	// NOTE: Keep signals out of the watcher's way, they're the application's business,
+	//       and we'd rather not steal an EINTR from its own event loop.
+	sigset_t all_signals;
+	sigset_t old_signals;
+	sigfillset(&all_signals);
+	pthread_sigmask(SIG_SETMASK, &all_signals, &old_signals);
+	int ret = pthread_create(&fbWatcherThread, NULL, &fb_watcher, NULL);
+	pthread_sigmask(SIG_SETMASK, &old_signals, NULL);
+	if (ret != 0) {
+		WARN("pthread_create: %s", strerror(ret));
+		goto failure;
+	}
+	isFbWatcherActive = true;
+	LOG("Started the framebuffer layout watcher");
+
+	return fbWatcherEventFd;
+
+failure:
+	if (fbWatcherStopFd != -1) {
+		close(fbWatcherStopFd);
+		fbWatcherStopFd = -1;
+	}
+	if (fbWatcherEventFd != -1) {
+		close(fbWatcherEventFd);
+		fbWatcherEventFd = -1;
+	}
+	close(fbWatcherFd);
+	fbWatcherFd = -1;
+	return ERRCODE(EXIT_FAILURE);
+#else
+	WARN("Reinitilization is not needed on Kindle devices :)");
+	return ERRCODE(ENOSYS);
+#endif    // !FBINK_FOR_KINDLE
+}
 
-	// And we're done!
-	// We keep silent when we do nothing, to avoid flooding logs (mainly, KFMon's ;)).
+// Stop the layout watcher, and release its resources
+int
+    fbink_stop_fb_watcher(void)
+{
+#ifndef FBINK_FOR_KINDLE
+	if (!isFbWatcherActive) {
+		return EXIT_SUCCESS;
+	}
 
-cleanup:
-	if (!keep_fd) {
-		close(fbfd);
+	eventfd_write(fbWatcherStopFd, 1U);
+	int ret = pthread_join(fbWatcherThread, NULL);
+	if (ret != 0) {
+		WARN("pthread_join: %s", strerror(ret));
+		return ERRCODE(EXIT_FAILURE);
 	}
+	isFbWatcherActive = false;
+	isFbLayoutDirty   = false;
+	close(fbWatcherStopFd);
+	fbWatcherStopFd = -1;
+	close(fbWatcherEventFd);
+	fbWatcherEventFd = -1;
+	close(fbWatcherFd);
+	fbWatcherFd = -1;
+	LOG("Stopped the framebuffer layout watcher");
 
-	return rv;
+	return EXIT_SUCCESS;
 #else
-	// NOTE: I currently haven't found the need for any shenanigans like that on Kindle, so, make this a NOP there ;).
-	// NOTE: That said, we technically could make use of the canRotate quirk if we had an API user on Kindle that cared...
 	WARN("Reinitilization is not needed on Kindle devices :)");
 	return ERRCODE(ENOSYS);
 #endif    // !FBINK_FOR_KINDLE
@@ -5843,6 +8862,37 @@ cleanup:
 }
 
 #ifdef FBINK_WITH_IMAGE
+// stbi I/O callbacks, so we can decode stdin as it comes in, instead of slurping it all in memory first
+static int
+    stdin_read_cb(void* user, char* data, int size)
+{
+	FILE* f = (FILE*) user;
+	return (int) fread(data, 1U, (size_t) size, f);
+}
+
+static void
+    stdin_skip_cb(void* user, int n)
+{
+	FILE* f = (FILE*) user;
+	// NOTE: stdin may very well be a pipe, so, we can't seek: read & discard instead.
+	char   buf[4096];
+	size_t left = (size_t) MAX(n, 0);
+	while (left > 0U) {
+		size_t nread = fread(buf, 1U, MIN(left, sizeof(buf)), f);
+		if (nread == 0U) {
+			break;
+		}
+		left -= nread;
+	}
+}
+
+static int
+    stdin_eof_cb(void* user)
+{
+	FILE* f = (FILE*) user;
+	return feof(f) || ferror(f);
+}
+
 // Load & decode image data from a file or stdin, via stbi
 static unsigned char*
     img_load_from_file(const char* filename, int* w, int* h, int* n, int req_n)
@@ -5851,73 +8901,29 @@ static unsigned char*
 
 	// Read image either from stdin (provided we're not running from a terminal), or a file
 	if (strcmp(filename, "-") == 0 && !isatty(fileno(stdin))) {
-		// NOTE: Ideally, we'd simply feed stdin to stbi_load_from_file, but that doesn't work because it relies on fseek,
-		//       so read stdin ourselves...
-		//       c.f., https://stackoverflow.com/a/44894946
-		unsigned char* imgdata = NULL;
-		unsigned char* temp    = NULL;
-		size_t         size    = 0U;
-		size_t         used    = 0U;
-
+		// NOTE: Ideally, we'd simply feed stdin to stbi_load_from_file, but that doesn't work because it relies on fseek
+		//       (to give back what it over-read once it's done).
+		//       We used to slurp the whole of stdin in a growing buffer first, and decode that from memory,
+		//       but that meant holding the full encoded image *and* the decoded one at the same time...
+		//       Instead, feed stbi from stdin via a set of I/O callbacks, which only requires forward reads & skips.
+		//       (stbi only ever rewinds inside its own 128 bytes read-ahead buffer, while sniffing the format).
 		if (ferror(stdin)) {
 			WARN("Failed to read image data from stdin");
 			return NULL;
 		}
 
-#	define CHUNK (256 * 1024)
-		while (1) {
-			if (used + CHUNK + 1U > size) {
-				size = used + CHUNK + 1U;
-
-				// Overflow check
-				if (size <= used) {
-					free(imgdata);
-					WARN("Too much input data");
-					return NULL;
-				}
-
-				// OOM check
-				temp = realloc(imgdata, size);
-				if (temp == NULL) {
-					WARN("realloc: %m");
-					free(imgdata);
-					return NULL;
-				}
-				imgdata = temp;
-				temp    = NULL;
-			}
-
-			// cppcheck-suppress nullPointerArithmetic ; imgdata can't be NULL
-			size_t nread = fread(imgdata + used, 1U, CHUNK, stdin);
-			if (nread == 0U) {
-				break;
-			}
-			used += nread;
-		}
+		const stbi_io_callbacks callbacks = {
+			.read = &stdin_read_cb,
+			.skip = &stdin_skip_cb,
+			.eof  = &stdin_eof_cb,
+		};
+		data = stbi_load_from_callbacks(&callbacks, stdin, w, h, n, req_n);
 
 		if (ferror(stdin)) {
-			free(imgdata);
 			WARN("Failed to read image data from stdin");
+			stbi_image_free(data);
 			return NULL;
 		}
-
-		// Shrink & NULL terminate
-		// NOTE: We're not buffering C strings, and we're discarding the buffer very very soon, so skip that ;).
-		/*
-		temp = realloc(imgdata, used + 1U);
-		if (temp == NULL) {
-			WARN("realloc: %m");
-			free(imgdata);
-			return NULL;
-		}
-		imgdata       = temp;
-		temp          = NULL;
-		imgdata[used] = '\0';
-		*/
-
-		// Finally, load the image from that buffer, and discard it once we're done.
-		data = stbi_load_from_memory(imgdata, (int) used, w, h, n, req_n);
-		free(imgdata);
 	} else {
 		// With a filepath, we can just let stbi handle it ;).
 		data = stbi_load(filename, w, h, n, req_n);
@@ -6084,214 +9090,180 @@ static uint8_t
 	return (q > UINT8_MAX ? UINT8_MAX : (uint8_t) q);
 }
 
-// Draw image data on screen (we inherit a few of the variable types/names from stbi ;))
-static int
-    draw_image(int                           fbfd,
-	       const unsigned char* restrict data,
-	       const int                     w,
-	       const int                     h,
-	       const int                     n,
-	       const int                     req_n,
-	       short int                     x_off,
-	       short int                     y_off,
-	       const FBInkConfig* restrict   fbink_cfg)
+// The band workers' main loop: wait for a job, and help with its bands
+static void*
+    band_worker(void* arg __attribute__((unused)))
 {
-	// Open the framebuffer if need be...
-	// NOTE: As usual, we *expect* to be initialized at this point!
-	bool keep_fd = true;
-	if (open_fb_fd(&fbfd, &keep_fd) != EXIT_SUCCESS) {
-		return ERRCODE(EXIT_FAILURE);
-	}
-
-	// Assume success, until shit happens ;)
-	int rv = EXIT_SUCCESS;
-
-	// mmap the fb if need be...
-	if (!isFbMapped) {
-		if (memmap_fb(fbfd) != EXIT_SUCCESS) {
-			rv = ERRCODE(EXIT_FAILURE);
-			goto cleanup;
+	pthread_mutex_lock(&bandLock);
+	uint32_t gen = bandJobGen;
+	while (true) {
+		while (gen == bandJobGen && !isBandPoolDying) {
+			pthread_cond_wait(&bandJobCond, &bandLock);
 		}
+		if (isBandPoolDying) {
+			break;
+		}
+		gen = bandJobGen;
+		process_bands();
 	}
+	pthread_mutex_unlock(&bandLock);
 
-	// Clear screen?
-	if (fbink_cfg->is_cleared) {
-		clear_screen(fbfd, fbink_cfg->is_inverted ? penBGColor ^ 0xFFu : penBGColor, fbink_cfg->is_flashing);
-	}
+	return NULL;
+}
 
-	// NOTE: We compute initial offsets from row/col, to help aligning images with text.
-	if (fbink_cfg->col < 0) {
-		x_off = (short int) (viewHoriOrigin + x_off + (MAX(MAXCOLS + fbink_cfg->col, 0) * FONTW));
-	} else {
-		x_off = (short int) (viewHoriOrigin + x_off + (fbink_cfg->col * FONTW));
-	}
-	// NOTE: Unless we *actually* specified a row, ignore viewVertOffset
-	//       The rationale being we want to keep being aligned to text rows when we do specify a row,
-	//       but we don't want the extra offset when we don't (in particular, when printing full-screen images).
-	// NOTE: This means that row 0 and row -MAXROWS *will* behave differently, but so be it...
-	if (fbink_cfg->row < 0) {
-		y_off = (short int) (viewVertOrigin + y_off + (MAX(MAXROWS + fbink_cfg->row, 0) * FONTH));
-	} else if (fbink_cfg->row == 0) {
-		y_off = (short int) (viewVertOrigin - viewVertOffset + y_off + (fbink_cfg->row * FONTH));
-		// This of course means that row 0 effectively breaks that "align with text" contract if viewVertOffset != 0,
-		// on the off-chance we do explicitly really want to align something to row 0, so, warn about it...
-		// The "print full-screen images" use-case is greatly more prevalent than "actually rely on row 0 alignment" ;).
-		// And in case that's *really* needed, using -MAXROWS instead of 0 will honor alignment anyway.
-		if (viewVertOffset != 0U) {
-			LOG("Ignoring the %hhupx row offset because row is 0!", viewVertOffset);
-		}
-	} else {
-		y_off = (short int) (viewVertOrigin + y_off + (fbink_cfg->row * FONTH));
-	}
-	LOG("Adjusted image display coordinates to (%hd, %hd), after column %hd & row %hd",
-	    x_off,
-	    y_off,
-	    fbink_cfg->col,
-	    fbink_cfg->row);
+// Process the bands of the current job until there's none left to grab
+// NOTE: Must be called with bandLock held.
+static void
+    process_bands(void)
+{
+	while (bandJob.next < bandJob.bands) {
+		const uint8_t            band  = bandJob.next++;
+		const FBInkBandFn        fn    = bandJob.fn;
+		const void*              arg   = bandJob.arg;
+		const unsigned short int start = (unsigned short int) (bandJob.start + band * bandJob.band_rows);
+		const unsigned short int end   = (unsigned short int) MIN(start + bandJob.band_rows, bandJob.end);
+		currentContext                 = bandJob.ctx;
+		pthread_mutex_unlock(&bandLock);
 
-	bool       fb_is_grayscale = false;
-	bool       fb_is_legacy    = false;
-	bool       fb_is_24bpp     = false;
-	bool       fb_is_true_bgr  = false;
-	bool       img_has_alpha   = false;
-	FBInkPixel pixel           = { 0U };
-	// Use boolean flags to make the mess of branching slightly more human-readable later...
-	switch (vInfo.bits_per_pixel) {
-		case 4U:
-			fb_is_grayscale = true;
-			fb_is_legacy    = true;
-			break;
-		case 8U:
-			fb_is_grayscale = true;
-			break;
-		case 16U:
-			break;
-		case 24U:
-			fb_is_24bpp    = true;
-			fb_is_true_bgr = true;
-			break;
-		case 32U:
-		default:
-			fb_is_true_bgr = true;
-			break;
-	}
+		fn(arg, start, end);
 
-	// Handle horizontal alignment...
-	switch (fbink_cfg->halign) {
-		case CENTER:
-			x_off = (short int) (x_off + (int) (viewWidth / 2U));
-			x_off = (short int) (x_off - (w / 2));
-			break;
-		case EDGE:
-			x_off = (short int) (x_off + (int) (viewWidth - (uint32_t) w));
-			break;
-		case NONE:
-		default:
-			break;
-	}
-	if (fbink_cfg->halign != NONE) {
-		LOG("Adjusted image display coordinates to (%hd, %hd) after horizontal alignment", x_off, y_off);
+		pthread_mutex_lock(&bandLock);
+		bandJob.done++;
+		if (bandJob.done == bandJob.bands) {
+			pthread_cond_broadcast(&bandDoneCond);
+		}
 	}
+}
 
-	// Handle vertical alignment...
-	switch (fbink_cfg->valign) {
-		case CENTER:
-			y_off = (short int) (y_off + (int) (viewHeight / 2U));
-			y_off = (short int) (y_off - (h / 2));
-			break;
-		case EDGE:
-			y_off = (short int) (y_off + (int) (viewHeight - (uint32_t) h));
-			break;
-		case NONE:
-		default:
-			break;
-	}
-	if (fbink_cfg->valign != NONE) {
-		LOG("Adjusted image display coordinates to (%hd, %hd) after vertical alignment", x_off, y_off);
+// How many threads (including the caller's) we want to throw at a job
+static uint8_t
+    get_band_threads(void)
+{
+	if (bandThreads != 0U) {
+		return (uint8_t) MIN(bandThreads, BAND_WORKERS_MAX + 1U);
 	}
 
-	// Clamp everything to a safe range, because we can't have *anything* going off-screen here.
-	struct mxcfb_rect region;
-	// NOTE: Assign each field individually to avoid a false-positive with Clang's SA...
-	if (fbink_cfg->row == 0) {
-		region.top = MIN(screenHeight, (uint32_t) MAX((viewVertOrigin - viewVertOffset), y_off));
-	} else {
-		region.top = MIN(screenHeight, (uint32_t) MAX(viewVertOrigin, y_off));
+	long int cpus = sysconf(_SC_NPROCESSORS_ONLN);
+	if (cpus < 1) {
+		cpus = 1;
 	}
-	region.left   = MIN(screenWidth, (uint32_t) MAX(viewHoriOrigin, x_off));
-	region.width  = MIN(screenWidth - region.left, (uint32_t) w);
-	region.height = MIN(screenHeight - region.top, (uint32_t) h);
+	return (uint8_t) MIN(cpus, BAND_WORKERS_MAX + 1);
+}
 
-	// NOTE: If we ended up with negative display offsets, we should shave those off region.width & region.height,
-	//       when it makes sense to do so,
-	//       but we need to remember the unshaven value for the pixel loop condition,
-	//       to avoid looping on only part of the image.
-	unsigned short int max_width  = (unsigned short int) region.width;
-	unsigned short int max_height = (unsigned short int) region.height;
-	// NOTE: We also need to decide if we start looping at the top left of the image, or if we start later, to
-	//       avoid plotting off-screen pixels when using negative display offsets...
-	unsigned short int img_x_off = 0;
-	unsigned short int img_y_off = 0;
-	if (x_off < 0) {
-		// We'll start plotting from the beginning of the *visible* part of the image ;)
-		img_x_off = (unsigned short int) (abs(x_off) + viewHoriOrigin);
-		max_width = (unsigned short int) (max_width + img_x_off);
-		// Make sure we're not trying to loop past the actual width of the image!
-		max_width = (unsigned short int) MIN(w, max_width);
-		// Only if the visible section of the image's width is smaller than our screen's width...
-		if ((uint32_t)(w - img_x_off) < viewWidth) {
-			region.width -= img_x_off;
-		}
+// Make sure we have (up to) count band workers running
+// NOTE: Must be called with bandLock held.
+static void
+    start_band_workers(uint8_t count)
+{
+	if (bandWorkersCount >= count) {
+		return;
 	}
-	if (y_off < 0) {
-		// We'll start plotting from the beginning of the *visible* part of the image ;)
-		if (fbink_cfg->row == 0) {
-			img_y_off = (unsigned short int) (abs(y_off) + viewVertOrigin - viewVertOffset);
-		} else {
-			img_y_off = (unsigned short int) (abs(y_off) + viewVertOrigin);
-		}
-		max_height = (unsigned short int) (max_height + img_y_off);
-		// Make sure we're not trying to loop past the actual height of the image!
-		max_height = (unsigned short int) MIN(h, max_height);
-		// Only if the visible section of the image's height is smaller than our screen's height...
-		if ((uint32_t)(h - img_y_off) < viewHeight) {
-			region.height -= img_y_off;
+
+	// NOTE: Keep signals out of the workers' way, they're the application's business.
+	sigset_t all_signals;
+	sigset_t old_signals;
+	sigfillset(&all_signals);
+	pthread_sigmask(SIG_SETMASK, &all_signals, &old_signals);
+	while (bandWorkersCount < count) {
+		int ret = pthread_create(&bandWorkers[bandWorkersCount], NULL, &band_worker, NULL);
+		if (ret != 0) {
+			// Just make do with what we've got
+			WARN("pthread_create: %s", strerror(ret));
+			break;
 		}
+		bandWorkersCount++;
 	}
-	LOG("Region: top=%u, left=%u, width=%u, height=%u", region.top, region.left, region.width, region.height);
-	LOG("Image becomes visible @ (%hu, %hu), looping 'til (%hu, %hu) out of %dx%d pixels",
-	    img_x_off,
-	    img_y_off,
-	    max_width,
-	    max_height,
-	    w,
-	    h);
-	// Warn if there's an alpha channel, because it's usually a bit more expensive to handle...
-	if (n == 2 || n == 4) {
-		img_has_alpha = true;
-		if (fbink_cfg->ignore_alpha) {
-			LOG("Ignoring the image's alpha channel.");
-		} else {
-			LOG("Image has an alpha channel, we'll have to do alpha blending.");
+	pthread_sigmask(SIG_SETMASK, &old_signals, NULL);
+	LOG("Running %hhu band workers", bandWorkersCount);
+}
+
+// Stop all the band workers
+static void
+    stop_band_workers(void)
+{
+	pthread_mutex_lock(&bandLock);
+	isBandPoolDying = true;
+	pthread_cond_broadcast(&bandJobCond);
+	pthread_mutex_unlock(&bandLock);
+
+	for (uint8_t i = 0U; i < bandWorkersCount; i++) {
+		int ret = pthread_join(bandWorkers[i], NULL);
+		if (ret != 0) {
+			WARN("pthread_join: %s", strerror(ret));
 		}
 	}
 
-	// Handle inversion if requested, in a way that avoids branching in the loop ;).
-	// And, as an added bonus, plays well with the fact that legacy devices have an inverted color map...
-	uint8_t  inv     = 0U;
-	uint32_t inv_rgb = 0U;
-#	ifdef FBINK_FOR_KINDLE
-	if ((deviceQuirks.isKindleLegacy && !fbink_cfg->is_inverted) ||
-	    (!deviceQuirks.isKindleLegacy && fbink_cfg->is_inverted)) {
-#	else
-	if (fbink_cfg->is_inverted) {
-#	endif
-		inv     = 0xFFu;
-		inv_rgb = 0x00FFFFFFu;
+	pthread_mutex_lock(&bandLock);
+	bandWorkersCount = 0U;
+	isBandPoolDying  = false;
+	pthread_mutex_unlock(&bandLock);
+}
+
+// Run fn over the [start, end) rows, split in bands processed in parallel by the band workers & the caller
+static void
+    run_bands(FBInkBandFn fn, const void* arg, unsigned short int start, unsigned short int end)
+{
+	const unsigned short int rows    = (unsigned short int) (end - start);
+	const uint8_t            threads = get_band_threads();
+	uint8_t                  bands   = (uint8_t) MIN(threads, rows / BAND_MIN_ROWS);
+	if (bands <= 1U) {
+		fn(arg, start, end);
+		return;
+	}
+
+	pthread_mutex_lock(&bandLock);
+	// NOTE: If another thread is already using the workers, don't wait for it, just do it ourselves.
+	if (bandJob.done != bandJob.bands) {
+		pthread_mutex_unlock(&bandLock);
+		fn(arg, start, end);
+		return;
 	}
+	start_band_workers((uint8_t) (bands - 1U));
+	bands = (uint8_t) MIN(bands, bandWorkersCount + 1U);
+
+	bandJob = (FBInkBandJob){
+		.fn        = fn,
+		.arg       = arg,
+		.ctx       = currentContext,
+		.start     = start,
+		.end       = end,
+		.band_rows = (unsigned short int) ((rows + bands - 1U) / bands),
+		.bands     = bands,
+	};
+	bandJobGen++;
+	pthread_cond_broadcast(&bandJobCond);
+	// Don't just sit there, help!
+	process_bands();
+	while (bandJob.done != bandJob.bands) {
+		pthread_cond_wait(&bandDoneCond, &bandLock);
+	}
+	pthread_mutex_unlock(&bandLock);
+}
+
+// Blit the [j_start, j_end) rows of an image (c.f., draw_image, which computes everything in blit)
+static void
+    draw_image_band(const void* arg, unsigned short int j_start, unsigned short int j_end)
+{
+	const FBInkImageBlit* restrict blit            = arg;
+	const unsigned char* restrict  data            = blit->data;
+	const int                      w               = blit->w;
+	const int                      req_n           = blit->req_n;
+	const short int                x_off           = blit->x_off;
+	const short int                y_off           = blit->y_off;
+	const unsigned short int       img_x_off       = blit->img_x_off;
+	const unsigned short int       max_width       = blit->max_width;
+	const bool                     fb_is_grayscale = blit->fb_is_grayscale;
+	const bool                     fb_is_legacy    = blit->fb_is_legacy;
+	const bool                     fb_is_24bpp     = blit->fb_is_24bpp;
+	const bool                     fb_is_true_bgr  = blit->fb_is_true_bgr;
+	const bool                     img_has_alpha   = blit->img_has_alpha;
+	const FBInkConfig* restrict    fbink_cfg       = blit->fbink_cfg;
+	FBInkPixel                     pixel           = { 0U };
+
 	// And we'll make 'em constants to eke out a tiny bit of performance...
-	const uint8_t  invert     = inv;
-	const uint32_t invert_rgb = inv_rgb;
+	const uint8_t  invert     = blit->invert;
+	const uint32_t invert_rgb = blit->invert_rgb;
+
 	// NOTE: The *slight* duplication is on purpose, to move the branching outside the loop,
 	//       and make use of a few different blitting tweaks depending on the situation...
 	//       And since we can easily do so from here,
@@ -6306,7 +9278,7 @@ static int
 				//       https://blogs.msdn.microsoft.com/shawnhar/2009/11/06/premultiplied-alpha/
 				FBInkCoordinates coords;
 				FBInkPixelG8A    img_px;
-				for (unsigned short int j = img_y_off; j < max_height; j++) {
+				for (unsigned short int j = j_start; j < j_end; j++) {
 					for (unsigned short int i = img_x_off; i < max_width; i++) {
 						// NOTE: In this branch, req_n == 2, so we can do << 1 instead of * 2 ;).
 						size_t pix_offset = (size_t)(((j << 1U) * w) + (i << 1U));
@@ -6366,7 +9338,7 @@ static int
 				// NOTE: The fact that the fb stores two pixels per byte means we can't take any shortcut,
 				//       because they may only apply to one of those two pixels...
 				FBInkPixel bg_px = { 0U };
-				for (unsigned short int j = img_y_off; j < max_height; j++) {
+				for (unsigned short int j = j_start; j < j_end; j++) {
 					for (unsigned short int i = img_x_off; i < max_width; i++) {
 						// We need to know what this pixel currently looks like in the framebuffer...
 						FBInkCoordinates coords;
@@ -6407,15 +9379,16 @@ static int
 			// and we don't dither.
 			if (!fb_is_legacy && req_n == 1 && invert == 0U && !fbink_cfg->sw_dithering) {
 				// Scanline by scanline, as we usually have input/output x offsets to honor
-				for (unsigned short int j = img_y_off; j < max_height; j++) {
+				for (unsigned short int j = j_start; j < j_end; j++) {
 					// NOTE: Again, assume the fb origin is @ (0, 0), which should hold true at that bitdepth.
 					size_t pix_offset = (size_t)((j * w) + img_x_off);
 					size_t fb_offset  = ((uint32_t)(j + y_off) * fInfo.line_length) +
 							   (unsigned int) (img_x_off + x_off);
-					memcpy(fbPtr + fb_offset, data + pix_offset, max_width);
+					// NOTE: max_width is where we stop, not how much we copy.
+					memcpy(fbPtr + fb_offset, data + pix_offset, (size_t) (max_width - img_x_off));
 				}
 			} else {
-				for (unsigned short int j = img_y_off; j < max_height; j++) {
+				for (unsigned short int j = j_start; j < j_end; j++) {
 					for (unsigned short int i = img_x_off; i < max_width; i++) {
 						// NOTE: Here, req_n is either 2, or 1 if ignore_alpha, so, no shift trickery ;)
 						size_t pix_offset = (size_t)((j * req_n * w) + (i * req_n));
@@ -6453,7 +9426,7 @@ static int
 				// This is essentially a constant in our case... (c.f., put_pixel_RGB32)
 				// cppcheck-suppress unreadVariable ; false-positive (union)
 				fb_px.color.a = 0xFFu;
-				for (unsigned short int j = img_y_off; j < max_height; j++) {
+				for (unsigned short int j = j_start; j < j_end; j++) {
 					for (unsigned short int i = img_x_off; i < max_width; i++) {
 						// NOTE: We should be able to skip rotation hacks at this bpp...
 
@@ -6537,7 +9510,7 @@ static int
 			} else {
 				// 24bpp
 				FBInkPixelBGR fb_px;
-				for (unsigned short int j = img_y_off; j < max_height; j++) {
+				for (unsigned short int j = j_start; j < j_end; j++) {
 					for (unsigned short int i = img_x_off; i < max_width; i++) {
 						// NOTE: We should be able to skip rotation hacks at this bpp...
 
@@ -6569,7 +9542,7 @@ static int
 							}
 
 							pix_offset =
-							    (uint32_t)((unsigned short int) (i + x_off) << 2U) +
+							    (uint32_t)((unsigned short int) (i + x_off) * 3U) +
 							    ((unsigned short int) (j + y_off) * fInfo.line_length);
 							// And we write the full pixel to the fb (all 3 bytes)
 							*((uint24_t*) (fbPtr + pix_offset)) = fb_px.p;
@@ -6580,7 +9553,7 @@ static int
 							uint8_t ainv = img_px.color.a ^ 0xFFu;
 
 							pix_offset =
-							    (uint32_t)((unsigned short int) (i + x_off) << 2U) +
+							    (uint32_t)((unsigned short int) (i + x_off) * 3U) +
 							    ((unsigned short int) (j + y_off) * fInfo.line_length);
 							// Again, read the full pixel from the framebuffer (all 3 bytes)
 							FBInkPixelBGR bg_px;
@@ -6618,7 +9591,7 @@ static int
 				// This is essentially a constant in our case...
 				// cppcheck-suppress unreadVariable ; false-positive (union)
 				fb_px.color.a = 0xFFu;
-				for (unsigned short int j = img_y_off; j < max_height; j++) {
+				for (unsigned short int j = j_start; j < j_end; j++) {
 					for (unsigned short int i = img_x_off; i < max_width; i++) {
 						// NOTE: Here, req_n is either 4, or 3 if ignore_alpha, so, no shift trickery ;)
 						size_t pix_offset = (size_t)((j * req_n * w) + (i * req_n));
@@ -6663,7 +9636,7 @@ static int
 				}
 			} else {
 				// 24bpp
-				for (unsigned short int j = img_y_off; j < max_height; j++) {
+				for (unsigned short int j = j_start; j < j_end; j++) {
 					for (unsigned short int i = img_x_off; i < max_width; i++) {
 						// NOTE: Here, req_n is either 4, or 3 if ignore_alpha, so, no shift trickery ;)
 						size_t pix_offset = (size_t)((j * req_n * w) + (i * req_n));
@@ -6686,7 +9659,7 @@ static int
 						}
 
 						// NOTE: Again, assume we can safely skip rotation tweaks
-						pix_offset = (uint32_t)((unsigned short int) (i + x_off) << 2U) +
+						pix_offset = (uint32_t)((unsigned short int) (i + x_off) * 3U) +
 							     ((unsigned short int) (j + y_off) * fInfo.line_length);
 						// Write the full pixel to the fb (all 3 bytes)
 						*((uint24_t*) (fbPtr + pix_offset)) = fb_px.p;
@@ -6701,7 +9674,7 @@ static int
 		// 16bpp
 		if (!fbink_cfg->ignore_alpha && img_has_alpha) {
 			FBInkCoordinates coords;
-			for (unsigned short int j = img_y_off; j < max_height; j++) {
+			for (unsigned short int j = j_start; j < j_end; j++) {
 				for (unsigned short int i = img_x_off; i < max_width; i++) {
 					// NOTE: Same general idea as the fb_is_grayscale case,
 					//       except at this bpp we then have to handle rotation ourselves...
@@ -6775,7 +9748,7 @@ static int
 		} else {
 			// No alpha in image, or ignored
 			// NOTE: For some reason, reading the image 3 or 4 bytes at once doesn't win us anything, here...
-			for (unsigned short int j = img_y_off; j < max_height; j++) {
+			for (unsigned short int j = j_start; j < j_end; j++) {
 				for (unsigned short int i = img_x_off; i < max_width; i++) {
 					// NOTE: Here, req_n is either 4, or 3 if ignore_alpha, so, no shift trickery ;)
 					size_t pix_offset = (size_t)((j * req_n * w) + (i * req_n));
@@ -6803,6 +9776,234 @@ static int
 			}
 		}
 	}
+}
+
+// Draw image data on screen (we inherit a few of the variable types/names from stbi ;))
+static int
+    draw_image(int                           fbfd,
+	       const unsigned char* restrict data,
+	       const int                     w,
+	       const int                     h,
+	       const int                     n,
+	       const int                     req_n,
+	       short int                     x_off,
+	       short int                     y_off,
+	       const FBInkConfig* restrict   fbink_cfg)
+{
+	// Open the framebuffer if need be...
+	// NOTE: As usual, we *expect* to be initialized at this point!
+	bool keep_fd = true;
+	if (open_fb_fd(&fbfd, &keep_fd) != EXIT_SUCCESS) {
+		return ERRCODE(EXIT_FAILURE);
+	}
+
+	// Assume success, until shit happens ;)
+	int rv = EXIT_SUCCESS;
+
+	// mmap the fb if need be...
+	if (!isFbMapped) {
+		if (memmap_fb(fbfd) != EXIT_SUCCESS) {
+			rv = ERRCODE(EXIT_FAILURE);
+			goto cleanup;
+		}
+	}
+
+	// Clear screen?
+	if (fbink_cfg->is_cleared) {
+		clear_screen(fbfd, fbink_cfg->is_inverted ? penBGColor ^ 0xFFu : penBGColor, fbink_cfg->is_flashing);
+	}
+
+	// NOTE: We compute initial offsets from row/col, to help aligning images with text.
+	if (fbink_cfg->col < 0) {
+		x_off = (short int) (viewHoriOrigin + x_off + (MAX(MAXCOLS + fbink_cfg->col, 0) * FONTW));
+	} else {
+		x_off = (short int) (viewHoriOrigin + x_off + (fbink_cfg->col * FONTW));
+	}
+	// NOTE: Unless we *actually* specified a row, ignore viewVertOffset
+	//       The rationale being we want to keep being aligned to text rows when we do specify a row,
+	//       but we don't want the extra offset when we don't (in particular, when printing full-screen images).
+	// NOTE: This means that row 0 and row -MAXROWS *will* behave differently, but so be it...
+	if (fbink_cfg->row < 0) {
+		y_off = (short int) (viewVertOrigin + y_off + (MAX(MAXROWS + fbink_cfg->row, 0) * FONTH));
+	} else if (fbink_cfg->row == 0) {
+		y_off = (short int) (viewVertOrigin - viewVertOffset + y_off + (fbink_cfg->row * FONTH));
+		// This of course means that row 0 effectively breaks that "align with text" contract if viewVertOffset != 0,
+		// on the off-chance we do explicitly really want to align something to row 0, so, warn about it...
+		// The "print full-screen images" use-case is greatly more prevalent than "actually rely on row 0 alignment" ;).
+		// And in case that's *really* needed, using -MAXROWS instead of 0 will honor alignment anyway.
+		if (viewVertOffset != 0U) {
+			LOG("Ignoring the %hhupx row offset because row is 0!", viewVertOffset);
+		}
+	} else {
+		y_off = (short int) (viewVertOrigin + y_off + (fbink_cfg->row * FONTH));
+	}
+	LOG("Adjusted image display coordinates to (%hd, %hd), after column %hd & row %hd",
+	    x_off,
+	    y_off,
+	    fbink_cfg->col,
+	    fbink_cfg->row);
+
+	bool       fb_is_grayscale = false;
+	bool       fb_is_legacy    = false;
+	bool       fb_is_24bpp     = false;
+	bool       fb_is_true_bgr  = false;
+	bool       img_has_alpha   = false;
+	// Use boolean flags to make the mess of branching slightly more human-readable later...
+	switch (vInfo.bits_per_pixel) {
+		case 4U:
+			fb_is_grayscale = true;
+			fb_is_legacy    = true;
+			break;
+		case 8U:
+			fb_is_grayscale = true;
+			break;
+		case 16U:
+			break;
+		case 24U:
+			fb_is_24bpp    = true;
+			fb_is_true_bgr = true;
+			break;
+		case 32U:
+		default:
+			fb_is_true_bgr = true;
+			break;
+	}
+
+	// Handle horizontal alignment...
+	switch (fbink_cfg->halign) {
+		case CENTER:
+			x_off = (short int) (x_off + (int) (viewWidth / 2U));
+			x_off = (short int) (x_off - (w / 2));
+			break;
+		case EDGE:
+			x_off = (short int) (x_off + (int) (viewWidth - (uint32_t) w));
+			break;
+		case NONE:
+		default:
+			break;
+	}
+	if (fbink_cfg->halign != NONE) {
+		LOG("Adjusted image display coordinates to (%hd, %hd) after horizontal alignment", x_off, y_off);
+	}
+
+	// Handle vertical alignment...
+	switch (fbink_cfg->valign) {
+		case CENTER:
+			y_off = (short int) (y_off + (int) (viewHeight / 2U));
+			y_off = (short int) (y_off - (h / 2));
+			break;
+		case EDGE:
+			y_off = (short int) (y_off + (int) (viewHeight - (uint32_t) h));
+			break;
+		case NONE:
+		default:
+			break;
+	}
+	if (fbink_cfg->valign != NONE) {
+		LOG("Adjusted image display coordinates to (%hd, %hd) after vertical alignment", x_off, y_off);
+	}
+
+	// Clamp everything to a safe range, because we can't have *anything* going off-screen here.
+	struct mxcfb_rect region;
+	// NOTE: Assign each field individually to avoid a false-positive with Clang's SA...
+	if (fbink_cfg->row == 0) {
+		region.top = MIN(screenHeight, (uint32_t) MAX((viewVertOrigin - viewVertOffset), y_off));
+	} else {
+		region.top = MIN(screenHeight, (uint32_t) MAX(viewVertOrigin, y_off));
+	}
+	region.left   = MIN(screenWidth, (uint32_t) MAX(viewHoriOrigin, x_off));
+	region.width  = MIN(screenWidth - region.left, (uint32_t) w);
+	region.height = MIN(screenHeight - region.top, (uint32_t) h);
+
+	// NOTE: If we ended up with negative display offsets, we should shave those off region.width & region.height,
+	//       when it makes sense to do so,
+	//       but we need to remember the unshaven value for the pixel loop condition,
+	//       to avoid looping on only part of the image.
+	unsigned short int max_width  = (unsigned short int) region.width;
+	unsigned short int max_height = (unsigned short int) region.height;
+	// NOTE: We also need to decide if we start looping at the top left of the image, or if we start later, to
+	//       avoid plotting off-screen pixels when using negative display offsets...
+	unsigned short int img_x_off = 0;
+	unsigned short int img_y_off = 0;
+	if (x_off < 0) {
+		// We'll start plotting from the beginning of the *visible* part of the image ;)
+		img_x_off = (unsigned short int) (abs(x_off) + viewHoriOrigin);
+		max_width = (unsigned short int) (max_width + img_x_off);
+		// Make sure we're not trying to loop past the actual width of the image!
+		max_width = (unsigned short int) MIN(w, max_width);
+		// Only if the visible section of the image's width is smaller than our screen's width...
+		if ((uint32_t)(w - img_x_off) < viewWidth) {
+			region.width -= img_x_off;
+		}
+	}
+	if (y_off < 0) {
+		// We'll start plotting from the beginning of the *visible* part of the image ;)
+		if (fbink_cfg->row == 0) {
+			img_y_off = (unsigned short int) (abs(y_off) + viewVertOrigin - viewVertOffset);
+		} else {
+			img_y_off = (unsigned short int) (abs(y_off) + viewVertOrigin);
+		}
+		max_height = (unsigned short int) (max_height + img_y_off);
+		// Make sure we're not trying to loop past the actual height of the image!
+		max_height = (unsigned short int) MIN(h, max_height);
+		// Only if the visible section of the image's height is smaller than our screen's height...
+		if ((uint32_t)(h - img_y_off) < viewHeight) {
+			region.height -= img_y_off;
+		}
+	}
+	LOG("Region: top=%u, left=%u, width=%u, height=%u", region.top, region.left, region.width, region.height);
+	LOG("Image becomes visible @ (%hu, %hu), looping 'til (%hu, %hu) out of %dx%d pixels",
+	    img_x_off,
+	    img_y_off,
+	    max_width,
+	    max_height,
+	    w,
+	    h);
+	// Warn if there's an alpha channel, because it's usually a bit more expensive to handle...
+	if (n == 2 || n == 4) {
+		img_has_alpha = true;
+		if (fbink_cfg->ignore_alpha) {
+			LOG("Ignoring the image's alpha channel.");
+		} else {
+			LOG("Image has an alpha channel, we'll have to do alpha blending.");
+		}
+	}
+
+	// Handle inversion if requested, in a way that avoids branching in the loop ;).
+	// And, as an added bonus, plays well with the fact that legacy devices have an inverted color map...
+	uint8_t  inv     = 0U;
+	uint32_t inv_rgb = 0U;
+#	ifdef FBINK_FOR_KINDLE
+	if ((deviceQuirks.isKindleLegacy && !fbink_cfg->is_inverted) ||
+	    (!deviceQuirks.isKindleLegacy && fbink_cfg->is_inverted)) {
+#	else
+	if (fbink_cfg->is_inverted) {
+#	endif
+		inv     = 0xFFu;
+		inv_rgb = 0x00FFFFFFu;
+	}
+
+	// Then, blit it!
+	const FBInkImageBlit blit = {
+		.data            = data,
+		.w               = w,
+		.req_n           = req_n,
+		.x_off           = x_off,
+		.y_off           = y_off,
+		.img_x_off       = img_x_off,
+		.max_width       = max_width,
+		.invert          = inv,
+		.invert_rgb      = inv_rgb,
+		.fb_is_grayscale = fb_is_grayscale,
+		.fb_is_legacy    = fb_is_legacy,
+		.fb_is_24bpp     = fb_is_24bpp,
+		.fb_is_true_bgr  = fb_is_true_bgr,
+		.img_has_alpha   = img_has_alpha,
+		.fbink_cfg       = fbink_cfg,
+	};
+	// NOTE: Each pixel only depends on its own source & destination,
+	//       so, bands of rows can safely be blitted in parallel, with the exact same results.
+	run_bands(&draw_image_band, &blit, img_y_off, max_height);
 
 	// Rotate the region if need be...
 	(*fxpRotateRegion)(&region);
@@ -6960,11 +10161,17 @@ int
 
 		LOG("Scaling image from %dx%d to %hux%hu . . .", w, h, scaled_width, scaled_height);
 
-		sdata = qSmoothScaleImage(data, w, h, req_n, fbink_cfg->ignore_alpha, scaled_width, scaled_height);
+		sdata = qSmoothScaleImage(
+		    data, w, h, req_n, fbink_cfg->ignore_alpha, scaled_width, scaled_height, get_band_threads());
 		if (sdata == NULL) {
 			WARN("Failed to resize image");
-			return ERRCODE(EXIT_FAILURE);
+			rv = ERRCODE(EXIT_FAILURE);
+			goto cleanup;
 		}
+		// NOTE: We won't need the unscaled data anymore, so, release it *before* blitting,
+		//       so that we only ever hold a single full-size copy of the image while we draw it.
+		stbi_image_free(data);
+		data = NULL;
 
 		// We're drawing the scaled data, at the requested scaled resolution
 		if (draw_image(fbfd, sdata, scaled_width, scaled_height, n, req_n, x_off, y_off, fbink_cfg) !=
@@ -7131,10 +10338,17 @@ int
 
 		LOG("Scaling image data from %dx%d to %hux%hu . . .", w, h, scaled_width, scaled_height);
 
-		sdata = qSmoothScaleImage(imgdata, w, h, req_n, fbink_cfg->ignore_alpha, scaled_width, scaled_height);
+		sdata = qSmoothScaleImage(
+		    imgdata, w, h, req_n, fbink_cfg->ignore_alpha, scaled_width, scaled_height, get_band_threads());
 		if (sdata == NULL) {
 			WARN("Failed to resize image");
-			return ERRCODE(EXIT_FAILURE);
+			rv = ERRCODE(EXIT_FAILURE);
+			goto cleanup;
+		}
+		// NOTE: Same as in fbink_print_image, if we made an intermediary copy, we won't need it anymore.
+		if (req_n != n) {
+			stbi_image_free(imgdata);
+			imgdata = NULL;
 		}
 
 		// We're drawing the scaled data, at the requested scaled resolution
@@ -7169,6 +10383,22 @@ cleanup:
 #endif    // FBINK_WITH_IMAGE
 }
 
+// Set how many threads image blitting may use
+int
+    fbink_set_image_threads(uint8_t threads UNUSED_BY_MINIMAL)
+{
+#ifdef FBINK_WITH_IMAGE
+	// NOTE: The workers are (re)started on demand, so, just get rid of the current ones.
+	stop_band_workers();
+	bandThreads = threads;
+
+	return EXIT_SUCCESS;
+#else
+	WARN("Image support is disabled in this FBInk build");
+	return ERRCODE(ENOSYS);
+#endif    // FBINK_WITH_IMAGE
+}
+
 // Dump the full fb (first visible screen)
 int
     fbink_dump(int fbfd UNUSED_BY_MINIMAL, FBInkDump* restrict dump UNUSED_BY_MINIMAL)
@@ -7201,15 +10431,7 @@ int
 		// Reset the crop settings
 		dump->clip = (const FBInkRect){ 0U };
 	}
-	// Start by allocating enough memory for a full dump of the visible screen...
-	dump->data = calloc((size_t)(fInfo.line_length * vInfo.yres), sizeof(*dump->data));
-	if (dump->data == NULL) {
-		WARN("dump->data calloc: %m");
-		rv = ERRCODE(EXIT_FAILURE);
-		goto cleanup;
-	}
 	// Store the current fb state for that dump
-	dump->size        = (size_t)(fInfo.line_length * vInfo.yres);
 	dump->area.left   = 0U;
 	dump->area.top    = 0U;
 	dump->area.width  = (unsigned short int) vInfo.xres_virtual;
@@ -7217,6 +10439,19 @@ int
 	dump->rota        = (uint8_t) vInfo.rotate;
 	dump->bpp         = (uint8_t) vInfo.bits_per_pixel;
 	dump->is_full     = true;
+	// If we were asked for a compressed dump, encode it row by row, skipping the scanline padding, if any.
+	if (dump->is_compressed) {
+		rv = rle_dump_rows(dump, 0U, ((size_t) vInfo.xres_virtual * vInfo.bits_per_pixel) >> 3U);
+		goto cleanup;
+	}
+	// Start by allocating enough memory for a full dump of the visible screen...
+	dump->data = calloc((size_t)(fInfo.line_length * vInfo.yres), sizeof(*dump->data));
+	if (dump->data == NULL) {
+		WARN("dump->data calloc: %m");
+		rv = ERRCODE(EXIT_FAILURE);
+		goto cleanup;
+	}
+	dump->size = (size_t)(fInfo.line_length * vInfo.yres);
 	// And finally, the fb data itself
 	memcpy(dump->data, fbPtr, (size_t)(fInfo.line_length * vInfo.yres));
 
@@ -7403,6 +10638,23 @@ int
 			region.width = (region.width + 1) & ~0x01u;
 			LOG("Updated region.width to %u because of alignment constraints", region.width);
 		}
+	}
+	// Store the current fb state for that dump
+	dump->area.left   = (unsigned short int) region.left;
+	dump->area.top    = (unsigned short int) region.top;
+	dump->area.width  = (unsigned short int) region.width;
+	dump->area.height = (unsigned short int) region.height;
+	dump->rota        = (uint8_t) vInfo.rotate;
+	dump->bpp         = (uint8_t) vInfo.bits_per_pixel;
+	dump->is_full     = false;
+	// If we were asked for a compressed dump, encode it row by row
+	if (dump->is_compressed) {
+		const size_t fb_offset =
+		    (((size_t) region.left * vInfo.bits_per_pixel) >> 3U) + ((size_t) region.top * fInfo.line_length);
+		rv = rle_dump_rows(dump, fb_offset, ((size_t) region.width * vInfo.bits_per_pixel) >> 3U);
+		goto cleanup;
+	}
+	if (vInfo.bits_per_pixel == 4U) {
 		// Two pixels per byte, and we've just ensured to never end up with a decimal when dividing by two ;).
 		dump->data = calloc((size_t)((region.width >> 1) * region.height), sizeof(*dump->data));
 	} else {
@@ -7413,14 +10665,6 @@ int
 		rv = ERRCODE(EXIT_FAILURE);
 		goto cleanup;
 	}
-	// Store the current fb state for that dump
-	dump->area.left   = (unsigned short int) region.left;
-	dump->area.top    = (unsigned short int) region.top;
-	dump->area.width  = (unsigned short int) region.width;
-	dump->area.height = (unsigned short int) region.height;
-	dump->rota        = (uint8_t) vInfo.rotate;
-	dump->bpp         = (uint8_t) vInfo.bits_per_pixel;
-	dump->is_full     = false;
 	// And finally, the fb data itself, scanline per scanline
 	if (dump->bpp == 4U) {
 		dump->size = (size_t)((dump->area.width >> 1) * dump->area.height);
@@ -7454,6 +10698,403 @@ cleanup:
 #endif    // FBINK_WITH_IMAGE
 }
 
+#ifdef FBINK_WITH_IMAGE
+// Find the first & last differing bytes between two buffers.
+// Returns false if they're identical.
+static bool
+    find_diff_span(const unsigned char* restrict a,
+		   const unsigned char* restrict b,
+		   size_t                        len,
+		   size_t* restrict              first,
+		   size_t* restrict              last)
+{
+	// NOTE: memcmp is vectorized in any libc worth its salt, and identical rows are by far the most common case.
+	if (memcmp(a, b, len) == 0) {
+		return false;
+	}
+
+	// Otherwise, narrow it down from both ends, a word at a time, then a byte at a time.
+	// NOTE: memcpy to sidestep alignment concerns, the compiler will turn those into plain loads.
+	size_t   i = 0U;
+	uint64_t wa;
+	uint64_t wb;
+	while (i + sizeof(wa) <= len) {
+		memcpy(&wa, a + i, sizeof(wa));
+		memcpy(&wb, b + i, sizeof(wb));
+		if (wa != wb) {
+			break;
+		}
+		i += sizeof(wa);
+	}
+	while (a[i] == b[i]) {
+		i++;
+	}
+	*first = i;
+
+	size_t j = len;
+	while (j - i >= sizeof(wa)) {
+		memcpy(&wa, a + j - sizeof(wa), sizeof(wa));
+		memcpy(&wb, b + j - sizeof(wb), sizeof(wb));
+		if (wa != wb) {
+			break;
+		}
+		j -= sizeof(wa);
+	}
+	while (a[j - 1U] == b[j - 1U]) {
+		j--;
+	}
+	*last = j - 1U;
+
+	return true;
+}
+
+// Refresh a band of rows we've just restored (only the [b0, b1] byte span of rows r0 to r1)
+static int
+    refresh_diff_band(int                         fbfd,
+		      const FBInkConfig* restrict fbink_cfg,
+		      unsigned short int          x,
+		      unsigned short int          y,
+		      unsigned short int          r0,
+		      unsigned short int          r1,
+		      size_t                      b0,
+		      size_t                      b1)
+{
+	// Back to pixels
+	struct mxcfb_rect region;
+	if (vInfo.bits_per_pixel == 4U) {
+		region.left  = (uint32_t)(x + (b0 << 1U));
+		region.width = (uint32_t)((b1 - b0 + 1U) << 1U);
+	} else {
+		const size_t bpp = vInfo.bits_per_pixel >> 3U;
+		region.left      = (uint32_t)(x + (b0 / bpp));
+		region.width     = (uint32_t)((b1 / bpp) - (b0 / bpp) + 1U);
+	}
+	region.top    = (uint32_t)(y + r0);
+	region.height = (uint32_t)(r1 - r0 + 1U);
+	// NOTE: refresh() rightly refuses regions that are a single pixel wide or tall, so, pad those.
+	if (region.width < 2U) {
+		region.left  = (region.left + 2U > vInfo.xres) ? vInfo.xres - 2U : region.left;
+		region.width = 2U;
+	}
+	if (region.height < 2U) {
+		region.top    = (region.top + 2U > vInfo.yres) ? vInfo.yres - 2U : region.top;
+		region.height = 2U;
+	}
+	LOG("Restoring changed region %ux%u @ (%u, %u)", region.width, region.height, region.left, region.top);
+
+	return refresh(fbfd,
+		       region,
+		       get_wfm_mode(fbink_cfg->wfm_mode),
+		       fbink_cfg->is_dithered ? EPDC_FLAG_USE_DITHERING_ORDERED : EPDC_FLAG_USE_DITHERING_PASSTHROUGH,
+		       fbink_cfg->is_nightmode,
+		       fbink_cfg->is_flashing,
+		       fbink_cfg->no_refresh);
+}
+
+// Restore only what differs between a dump and the screen, refreshing only the bands of rows that actually changed.
+// NOTE: x, y, w & h describe the on-screen rectangle to restore (i.e., the intersection of the dump's area & clip).
+static int
+    restore_diff(int                         fbfd,
+		 const FBInkConfig* restrict fbink_cfg,
+		 const FBInkDump* restrict   dump,
+		 unsigned short int          x,
+		 unsigned short int          y,
+		 unsigned short int          w,
+		 unsigned short int          h)
+{
+	const size_t x_bytes   = ((size_t) x * vInfo.bits_per_pixel) >> 3U;
+	const size_t row_bytes = ((size_t) w * vInfo.bits_per_pixel) >> 3U;
+	// Where our rectangle starts in each of the dump's rows, in bytes
+	const size_t src_skip = ((size_t)(x - dump->area.left) * dump->bpp) >> 3U;
+
+	// Compressed dumps are decoded one row at a time in a scratch buffer, raw ones are used as-is.
+	const unsigned char* src      = NULL;
+	size_t               src_step = 0U;
+	unsigned char*       row_buf  = NULL;
+	const size_t         unit     = RLE_UNIT_SIZE(dump->bpp);
+	const size_t         units    = (((size_t) dump->area.width * dump->bpp) >> 3U) / unit;
+	const unsigned char* rle_end  = dump->data + dump->size;
+	if (dump->is_compressed) {
+		row_buf = malloc(row_bytes);
+		if (row_buf == NULL) {
+			WARN("malloc: %m");
+			return ERRCODE(EXIT_FAILURE);
+		}
+		// Skip the rows above our rectangle
+		src = dump->data;
+		for (unsigned short int l = dump->area.top; l < y && src; l++) {
+			src = rle_unpack_row(src, rle_end, units, unit, 0U, 0U, NULL);
+		}
+	} else {
+		src_step = dump->is_full ? fInfo.line_length : (((size_t) dump->area.width * dump->bpp) >> 3U);
+		src      = dump->data + ((size_t)(y - dump->area.top) * src_step) + src_skip;
+	}
+
+	// Current band of changed rows (r0 to r1), and the union of their changed bytes (b0 to b1)
+	int                rv        = EXIT_SUCCESS;
+	bool               in_band   = false;
+	unsigned short int r0        = 0U;
+	unsigned short int r1        = 0U;
+	size_t             b0        = 0U;
+	size_t             b1        = 0U;
+	uint8_t            nregions  = 0U;
+	bool               refreshed = true;
+	for (unsigned short int l = 0U; l < h; l++) {
+		const unsigned char* src_row = src;
+		if (dump->is_compressed) {
+			src = rle_unpack_row(src, rle_end, units, unit, src_skip / unit, row_bytes / unit, row_buf);
+			src_row = row_buf;
+		} else {
+			src += src_step;
+		}
+		if (src == NULL) {
+			WARN("Compressed dump data is corrupted");
+			rv = ERRCODE(EILSEQ);
+			break;
+		}
+
+		unsigned char* fb_row = fbPtr + x_bytes + ((size_t)(y + l) * fInfo.line_length);
+		size_t         first;
+		size_t         last;
+		if (!find_diff_span(src_row, fb_row, row_bytes, &first, &last)) {
+			continue;
+		}
+		memcpy(fb_row + first, src_row + first, last - first + 1U);
+
+		// Close enough to the current band (or we've run out of regions)? Grow it.
+		if (in_band &&
+		    ((uint32_t)(l - r1) <= DIFF_RESTORE_MERGE_GAP || nregions == DIFF_RESTORE_MAX_REGIONS - 1U)) {
+			r1 = l;
+			b0 = MIN(b0, first);
+			b1 = MAX(b1, last);
+			continue;
+		}
+
+		// Otherwise, flush it, and start a new one.
+		if (in_band) {
+			if (refresh_diff_band(fbfd, fbink_cfg, x, y, r0, r1, b0, b1) != EXIT_SUCCESS) {
+				refreshed = false;
+			}
+			nregions++;
+		}
+		in_band = true;
+		r0      = l;
+		r1      = l;
+		b0      = first;
+		b1      = last;
+	}
+	// NOTE: Even if we bailed early, what we did write still has to make it to the screen.
+	if (in_band) {
+		if (refresh_diff_band(fbfd, fbink_cfg, x, y, r0, r1, b0, b1) != EXIT_SUCCESS) {
+			refreshed = false;
+		}
+		nregions++;
+	}
+	LOG("Restored %hhu changed region(s) out of a %hux%hu area", nregions, w, h);
+
+	if (!refreshed) {
+		WARN("Failed to refresh the screen");
+	}
+
+	free(row_buf);
+	return rv;
+}
+
+// Run-length encode a row of pixels, PackBits-style, with pixel-sized (or byte-sized, at 4bpp) units.
+// A header byte with the top bit set is followed by a single unit, repeated (h & 0x7F) + 1 times,
+// otherwise, it's followed by h + 1 literal units.
+// Returns the amount of bytes written to dst, which must be able to hold at least RLE_ROW_MAX_LEN bytes.
+static size_t
+    rle_pack_row(const unsigned char* restrict src, size_t units, size_t unit, unsigned char* restrict dst)
+{
+	// NOTE: A two byte run isn't worth breaking a literal over when our units *are* bytes...
+	const size_t   min_run = unit == 1U ? 3U : 2U;
+	unsigned char* p       = dst;
+	size_t         i       = 0U;
+	while (i < units) {
+		const size_t run = rle_run_length(src, i, units, unit);
+		if (run >= min_run) {
+			*p++ = (unsigned char) (0x80U | (run - 1U));
+			memcpy(p, src + (i * unit), unit);
+			p += unit;
+			i += run;
+			continue;
+		}
+
+		// Otherwise, gather literals until the next worthwhile run
+		size_t lit = run;
+		while (i + lit < units && lit < RLE_MAX_PACKET_UNITS &&
+		       rle_run_length(src, i + lit, units, unit) < min_run) {
+			lit++;
+		}
+		*p++ = (unsigned char) (lit - 1U);
+		memcpy(p, src + (i * unit), lit * unit);
+		p += lit * unit;
+		i += lit;
+	}
+
+	return (size_t)(p - dst);
+}
+
+// How many identical units in a row, starting at unit i (capped to a single packet)
+static size_t
+    rle_run_length(const unsigned char* restrict src, size_t i, size_t units, size_t unit)
+{
+	const unsigned char* first = src + (i * unit);
+	const size_t         max   = MIN(units - i, RLE_MAX_PACKET_UNITS);
+	size_t               n     = 1U;
+	// NOTE: Spell out the common unit sizes, so that the compiler can turn the memcmp into a plain load & compare.
+	switch (unit) {
+		case 1U:
+			while (n < max && first[n] == *first) {
+				n++;
+			}
+			break;
+		case 2U:
+			while (n < max && memcmp(first + (n * 2U), first, 2U) == 0) {
+				n++;
+			}
+			break;
+		case 4U:
+			while (n < max && memcmp(first + (n * 4U), first, 4U) == 0) {
+				n++;
+			}
+			break;
+		default:
+			while (n < max && memcmp(first + (n * unit), first, unit) == 0) {
+				n++;
+			}
+			break;
+	}
+
+	return n;
+}
+
+// Decode a row packed by rle_pack_row, only keeping units [first, first + count) (in dst, if it isn't NULL).
+// Returns a pointer to the next row's packets, or NULL if the data is corrupted (i.e., if it would overrun end).
+static const unsigned char*
+    rle_unpack_row(const unsigned char* restrict src,
+		   const unsigned char*          end,
+		   size_t                        units,
+		   size_t                        unit,
+		   size_t                        first,
+		   size_t                        count,
+		   unsigned char* restrict       dst)
+{
+	const size_t last = first + count;
+	size_t       i    = 0U;
+	while (i < units) {
+		if (src >= end) {
+			return NULL;
+		}
+		const uint8_t h = *src++;
+		const size_t  n = (h & 0x7Fu) + 1U;
+		if (i + n > units) {
+			return NULL;
+		}
+		const size_t len = (h & 0x80u) ? unit : n * unit;
+		if ((size_t)(end - src) < len) {
+			return NULL;
+		}
+
+		// Only bother with the part of the packet that intersects with what we're after
+		const size_t lo = MAX(i, first);
+		const size_t hi = MIN(i + n, last);
+		if (dst && lo < hi) {
+			unsigned char* out = dst + ((lo - first) * unit);
+			if (!(h & 0x80u)) {
+				memcpy(out, src + ((lo - i) * unit), (hi - lo) * unit);
+			} else if (unit == 1U) {
+				memset(out, *src, hi - lo);
+			} else {
+				// Copy the first unit, then keep doubling what we've got
+				const size_t total = (hi - lo) * unit;
+				size_t       done  = unit;
+				memcpy(out, src, unit);
+				while (done < total) {
+					const size_t chunk = MIN(done, total - done);
+					memcpy(out + done, out, chunk);
+					done += chunk;
+				}
+			}
+		}
+		src += len;
+		i += n;
+	}
+
+	return src;
+}
+
+// Run-length encode the dump->area.height rows of row_bytes bytes starting at fb_offset in the fb into dump->data
+static int
+    rle_dump_rows(FBInkDump* restrict dump, size_t fb_offset, size_t row_bytes)
+{
+	const size_t unit    = RLE_UNIT_SIZE(vInfo.bits_per_pixel);
+	const size_t units   = row_bytes / unit;
+	const size_t row_max = RLE_ROW_MAX_LEN(units, unit);
+
+	// Start small, e-ink content *usually* compresses extremely well, and grow as needed.
+	size_t         capacity = row_max * MIN(dump->area.height, 32U);
+	size_t         used     = 0U;
+	unsigned char* packed   = malloc(capacity);
+	if (packed == NULL) {
+		WARN("malloc: %m");
+		return ERRCODE(EXIT_FAILURE);
+	}
+	for (unsigned short int l = 0U; l < dump->area.height; l++) {
+		if (capacity - used < row_max) {
+			capacity            = MAX(capacity << 1U, used + row_max);
+			unsigned char* tmp = realloc(packed, capacity);
+			if (tmp == NULL) {
+				WARN("realloc: %m");
+				free(packed);
+				return ERRCODE(EXIT_FAILURE);
+			}
+			packed = tmp;
+		}
+		used += rle_pack_row(fbPtr + fb_offset + ((size_t) l * fInfo.line_length), units, unit, packed + used);
+	}
+	// Give back what we didn't use
+	unsigned char* tmp = realloc(packed, used);
+	if (tmp) {
+		packed = tmp;
+	}
+	LOG("Compressed a %zu bytes dump down to %zu bytes", row_bytes * dump->area.height, used);
+
+	dump->data = packed;
+	dump->size = used;
+	return EXIT_SUCCESS;
+}
+
+// Decode the on-screen rectangle x, y, w, h of a compressed dump straight into the fb
+static int
+    rle_restore(const FBInkDump* restrict dump,
+		unsigned short int        x,
+		unsigned short int        y,
+		unsigned short int        w,
+		unsigned short int        h)
+{
+	const size_t         unit    = RLE_UNIT_SIZE(dump->bpp);
+	const size_t         units   = (((size_t) dump->area.width * dump->bpp) >> 3U) / unit;
+	const size_t         first   = (((size_t)(x - dump->area.left) * dump->bpp) >> 3U) / unit;
+	const size_t         count   = (((size_t) w * dump->bpp) >> 3U) / unit;
+	const size_t         x_bytes = ((size_t) x * dump->bpp) >> 3U;
+	const unsigned char* src     = dump->data;
+	const unsigned char* end     = dump->data + dump->size;
+	for (unsigned short int j = dump->area.top; j < y + h && src; j++) {
+		// Rows above our rectangle are just skipped over
+		unsigned char* dst = j < y ? NULL : fbPtr + x_bytes + ((size_t) j * fInfo.line_length);
+		src                = rle_unpack_row(src, end, units, unit, first, count, dst);
+	}
+	if (src == NULL) {
+		WARN("Compressed dump data is corrupted");
+		return ERRCODE(EILSEQ);
+	}
+
+	return EXIT_SUCCESS;
+}
+#endif    // FBINK_WITH_IMAGE
+
 // Restore a fb dump
 int
     fbink_restore(int fbfd                              UNUSED_BY_MINIMAL,
@@ -7522,6 +11163,43 @@ int
 		rv = ERRCODE(ENOTSUP);
 		goto cleanup;
 	}
+	// NOTE: Dumps can come from anywhere (e.g., a file, via fbink_restore_from_file),
+	//       so make sure we'll never write outside the screen, or read outside the dump.
+	if (dump->area.left + dump->area.width > vInfo.xres_virtual ||
+	    dump->area.top + dump->area.height > vInfo.yres) {
+		WARN("Can't restore the dump because it extends past the screen! dump: (%hu, %hu) %hux%hu vs. fb: %ux%u",
+		     dump->area.left,
+		     dump->area.top,
+		     dump->area.width,
+		     dump->area.height,
+		     vInfo.xres_virtual,
+		     vInfo.yres);
+		rv = ERRCODE(ENOTSUP);
+		goto cleanup;
+	}
+	if (dump->is_full && (dump->area.width != vInfo.xres_virtual || dump->area.height != vInfo.yres)) {
+		WARN("Can't restore the full-screen dump because of a layout mismatch! dump: %hux%hu vs. fb: %ux%u",
+		     dump->area.width,
+		     dump->area.height,
+		     vInfo.xres_virtual,
+		     vInfo.yres);
+		rv = ERRCODE(ENOTSUP);
+		goto cleanup;
+	}
+	// NOTE: Compressed dumps are bounds-checked as they're decoded.
+	if (!dump->is_compressed) {
+		size_t needed = (((size_t) dump->area.width * dump->bpp) >> 3U) * dump->area.height;
+		if (dump->is_full) {
+			needed = (size_t) fInfo.line_length * vInfo.yres;
+		}
+		if (dump->size < needed) {
+			WARN("Can't restore the dump because it's truncated! dump: %zu vs. expected: %zu bytes",
+			     dump->size,
+			     needed);
+			rv = ERRCODE(ENOTSUP);
+			goto cleanup;
+		}
+	}
 	// Cropping related sanity checks...
 	if (dump->clip.width != 0U || dump->clip.height != 0U) {
 		if (dump->is_full) {
@@ -7589,7 +11267,42 @@ int
 	// We'll need a region...
 	struct mxcfb_rect region;
 
-	if (dump->is_full) {
+	// Diff mode & compressed dumps both work on the on-screen rectangle we're restoring,
+	// i.e., where the area & clip rectangles intersect.
+	if (dump->diff_only || dump->is_compressed) {
+		unsigned short int x1 = dump->area.left;
+		unsigned short int y1 = dump->area.top;
+		unsigned short int x2 = (unsigned short int) (dump->area.left + dump->area.width);
+		unsigned short int y2 = (unsigned short int) (dump->area.top + dump->area.height);
+		if (dump->is_full) {
+			// Don't bother with the invisible padding columns, if any
+			x2 = (unsigned short int) MIN(x2, vInfo.xres);
+		}
+		if (dump->clip.width != 0U || dump->clip.height != 0U) {
+			x1 = (unsigned short int) MAX(x1, dump->clip.left);
+			y1 = (unsigned short int) MAX(y1, dump->clip.top);
+			x2 = (unsigned short int) MIN(x2, dump->clip.left + dump->clip.width);
+			y2 = (unsigned short int) MIN(y2, dump->clip.top + dump->clip.height);
+		}
+		const unsigned short int w = (unsigned short int) (x2 - x1);
+		const unsigned short int h = (unsigned short int) (y2 - y1);
+
+		// Diff mode: only write & refresh what actually changed
+		if (dump->diff_only) {
+			rv = restore_diff(fbfd, fbink_cfg, dump, x1, y1, w, h);
+			goto cleanup;
+		}
+
+		// Otherwise, decode the whole thing straight into the fb
+		rv = rle_restore(dump, x1, y1, w, h);
+		if (rv != EXIT_SUCCESS) {
+			goto cleanup;
+		}
+		region.left   = x1;
+		region.top    = y1;
+		region.width  = w;
+		region.height = h;
+	} else if (dump->is_full) {
 		// Full dump, easy enough
 		memcpy(fbPtr, dump->data, (size_t)(fInfo.line_length * vInfo.yres));
 		fullscreen_region(&region);
@@ -7728,6 +11441,158 @@ int
 #endif    // FBINK_WITH_IMAGE
 }
 
+// Save a fb dump to a file
+int
+    fbink_dump_to_file(const FBInkDump* restrict dump   UNUSED_BY_MINIMAL,
+		       const char* restrict filename UNUSED_BY_MINIMAL)
+{
+#ifdef FBINK_WITH_IMAGE
+	if (!dump->data) {
+		WARN("No dump data to save!");
+		return ERRCODE(EINVAL);
+	}
+
+	FBInkDumpFileHeader header = { 0 };
+	memcpy(header.magic, FBINK_DUMP_MAGIC, sizeof(header.magic));
+	header.version = FBINK_DUMP_VERSION;
+	// NOTE: Full dumps use the fb's own scanline stride (padding included), region dumps are packed.
+	if (dump->is_compressed) {
+		header.stride = 0U;
+	} else if (dump->is_full) {
+		header.stride = (uint32_t)(dump->size / dump->area.height);
+	} else {
+		header.stride = ((uint32_t) dump->area.width * dump->bpp) >> 3U;
+	}
+	header.size          = dump->size;
+	header.left          = dump->area.left;
+	header.top           = dump->area.top;
+	header.width         = dump->area.width;
+	header.height        = dump->area.height;
+	header.rota          = dump->rota;
+	header.bpp           = dump->bpp;
+	header.is_full       = dump->is_full;
+	header.is_compressed = dump->is_compressed;
+
+	FILE* fp = fopen(filename, "w" STDIO_CLOEXEC);
+	if (!fp) {
+		WARN("fopen(%s): %m", filename);
+		return ERRCODE(EXIT_FAILURE);
+	}
+	int rv = EXIT_SUCCESS;
+	if (fwrite(&header, sizeof(header), 1U, fp) != 1U || fwrite(dump->data, dump->size, 1U, fp) != 1U) {
+		WARN("fwrite(%s): %m", filename);
+		rv = ERRCODE(EXIT_FAILURE);
+	}
+	// NOTE: Buffered data is flushed on close, so this is where ENOSPC & co would show up.
+	if (fclose(fp) != 0 && rv == EXIT_SUCCESS) {
+		WARN("fclose(%s): %m", filename);
+		rv = ERRCODE(EXIT_FAILURE);
+	}
+
+	return rv;
+#else
+	WARN("Image support is disabled in this FBInk build");
+	return ERRCODE(ENOSYS);
+#endif    // FBINK_WITH_IMAGE
+}
+
+// Restore a fb dump from a file
+int
+    fbink_restore_from_file(int fbfd                              UNUSED_BY_MINIMAL,
+			    const FBInkConfig* restrict fbink_cfg UNUSED_BY_MINIMAL,
+			    const char* restrict filename         UNUSED_BY_MINIMAL)
+{
+#ifdef FBINK_WITH_IMAGE
+	// NOTE: We map it read-only & private, so that rows can be copied straight from the page cache to the fb.
+	int fd = open(filename, O_RDONLY | O_CLOEXEC);
+	if (fd == -1) {
+		WARN("open(%s): %m", filename);
+		return ERRCODE(EXIT_FAILURE);
+	}
+	struct stat st;
+	if (fstat(fd, &st) == -1) {
+		WARN("fstat: %m");
+		close(fd);
+		return ERRCODE(EXIT_FAILURE);
+	}
+	if (st.st_size <= (off_t) sizeof(FBInkDumpFileHeader)) {
+		WARN("File '%s' is too small to be an FBInk dump", filename);
+		close(fd);
+		return ERRCODE(EINVAL);
+	}
+	const size_t   file_len = (size_t) st.st_size;
+	unsigned char* map      = mmap(NULL, file_len, PROT_READ, MAP_PRIVATE, fd, 0);
+	// NOTE: The mapping holds its own reference to the file, we don't need the fd anymore.
+	close(fd);
+	if (map == MAP_FAILED) {
+		WARN("mmap: %m");
+		return ERRCODE(EXIT_FAILURE);
+	}
+	// We'll go through it front to back, exactly once.
+	// NOTE: This is just a hint, so we don't really care if it fails.
+	if (madvise(map, file_len, MADV_SEQUENTIAL) == -1) {
+		LOG("madvise: %m");
+	}
+
+	int                 rv = EXIT_SUCCESS;
+	FBInkDumpFileHeader header;
+	memcpy(&header, map, sizeof(header));
+	if (memcmp(header.magic, FBINK_DUMP_MAGIC, sizeof(header.magic)) != 0) {
+		WARN("File '%s' isn't an FBInk dump", filename);
+		rv = ERRCODE(EINVAL);
+		goto cleanup;
+	}
+	if (header.version != FBINK_DUMP_VERSION) {
+		WARN("Unsupported FBInk dump version: %u (expected %u)", header.version, FBINK_DUMP_VERSION);
+		rv = ERRCODE(EINVAL);
+		goto cleanup;
+	}
+	if (header.size != file_len - sizeof(header) || header.width == 0U || header.height == 0U) {
+		WARN("FBInk dump '%s' is truncated or corrupted", filename);
+		rv = ERRCODE(EINVAL);
+		goto cleanup;
+	}
+	// Make sure raw rows are where fbink_restore expects them to be.
+	// NOTE: Compressed rows are bounds-checked as they're decoded.
+	if (!header.is_compressed) {
+		const uint32_t stride =
+		    header.is_full ? fInfo.line_length : (((uint32_t) header.width * header.bpp) >> 3U);
+		if (header.stride != stride) {
+			WARN("Can't restore the dump because of a scanline stride mismatch! dump: %u vs. expected: %u",
+			     header.stride,
+			     stride);
+			rv = ERRCODE(ENOTSUP);
+			goto cleanup;
+		}
+		if (header.size != (uint64_t) header.stride * header.height) {
+			WARN("FBInk dump '%s' is truncated or corrupted", filename);
+			rv = ERRCODE(EINVAL);
+			goto cleanup;
+		}
+	}
+
+	// NOTE: fbink_restore never writes to the dump's data, so we can safely point it at our read-only mapping.
+	const FBInkDump dump = {
+		.data          = map + sizeof(header),
+		.size          = (size_t) header.size,
+		.area          = { header.left, header.top, header.width, header.height },
+		.rota          = header.rota,
+		.bpp           = header.bpp,
+		.is_full       = header.is_full,
+		.is_compressed = header.is_compressed,
+	};
+	rv = fbink_restore(fbfd, fbink_cfg, &dump);
+
+cleanup:
+	munmap(map, file_len);
+
+	return rv;
+#else
+	WARN("Image support is disabled in this FBInk build");
+	return ERRCODE(ENOSYS);
+#endif    // FBINK_WITH_IMAGE
+}
+
 // Return a copy of the last drawn rectangle coordinates/dimensions
 FBInkRect
     fbink_get_last_rect(void)
@@ -7774,3 +11639,5 @@ FBInkRect
 #endif
 // Contains fbink_button_scan's implementation, Kobo only, and has a bit of Linux MT input thrown in ;).
 #include "fbink_button_scan.c"
+// Contexts, i.e., swapping our global state in & out for the *_ctx API
+#include "fbink_context.c"
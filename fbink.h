@@ -56,6 +56,8 @@
 //
 // Magic number for automatic fbfd handling
 #define FBFD_AUTO -1
+// Magic number standing in for the fbfd of an off-screen canvas (c.f., fbink_open_canvas)
+#define FBFD_CANVAS -2
 // As 0 is an invalid marker value, we can coopt it to try to retrieve our own last sent marker
 #define LAST_MARKER 0U
 
@@ -238,11 +240,11 @@ typedef struct
 	uint8_t fontsize_mult;       // FONTSIZE_MULT (current cell scaling multiplier)
 	uint8_t glyph_width;         // glyphWidth (native width of a glyph cell, i.e. unscaled)
 	uint8_t glyph_height;        // glyphHeight (native height of a glyph cell, i.e. unscaled)
-	bool    is_perfect_fit;      // deviceQuirks.isPerfectFit (horizontal column balance is perfect over viewWidth)
+	bool    is_perfect_fit;      // isPerfectFit (horizontal column balance is perfect over viewWidth)
 	bool    is_kobo_non_mt;      // deviceQuirks.isKoboNonMT (device is a Kobo with no MultiTouch input support)
 	uint8_t ntx_boot_rota;       // deviceQuirks.ntxBootRota (Native rotation at boot)
 	uint8_t ntx_rota_quirk;      // deviceQuirks.ntxRotaQuirk (c.f., NTX_ROTA_INDEX_T & utils/dump.c)
-	bool    is_ntx_quirky_landscape;    // deviceQuirks.isNTX16bLandscape (rotation compensation is in effect)
+	bool    is_ntx_quirky_landscape;    // isNTX16bLandscape (rotation compensation is in effect)
 	uint8_t current_rota;               // vInfo.rotate (current rotation, c.f., <linux/fb.h>)
 	bool    can_rotate;                 // deviceQuirks.canRotate (device has a gyro)
 } FBInkState;
@@ -330,6 +332,25 @@ typedef struct
 	bool truncated;    // true if the string was truncated (at computation or rendering time).
 } FBInkOTFit;
 
+// A set of per-target state (fb mapping, init data, fonts, ...), c.f., fbink_new_context
+// NOTE: This is an opaque type, only ever handled via a pointer.
+typedef struct FBInkContext FBInkContext;
+
+// An OpenType text layout that can be updated incrementally, c.f., fbink_new_ot_layout
+// NOTE: This is an opaque type, only ever handled via a pointer.
+typedef struct FBInkOTLayout FBInkOTLayout;
+
+// Used with fbink_get_ot_cache_stats, to keep an eye on the OpenType glyph cache.
+typedef struct
+{
+	uint64_t hits;         // Glyph lookups that were served from the cache.
+	uint64_t misses;       // Glyph lookups that had to go through the rasterizer.
+	uint64_t evictions;    // Glyphs dropped to honor the memory budget.
+	size_t   entries;      // Amount of glyphs currently cached.
+	size_t   size;         // Current memory usage, in bytes.
+	size_t   max_size;     // Memory budget, in bytes (c.f., fbink_set_ot_cache_size).
+} FBInkOTCacheStats;
+
 // This maps to an mxcfb rectangle, used for fbink_get_last_rect, as well as in FBInkDump
 // NOTE: Unlike an mxcfb rectangle, left (x) comes *before* top (y)!
 typedef struct
@@ -350,8 +371,49 @@ typedef struct
 	uint8_t   rota;
 	uint8_t   bpp;
 	bool      is_full;
+	bool      diff_only;        // Only write & refresh what differs from the screen (c.f., fbink_restore)
+	bool      is_compressed;    // Run-length encode the pixel data (c.f., fbink_dump)
 } FBInkDump;
 
+// For use with fbink_get_canvas_info
+typedef struct
+{
+	const unsigned char* data;    // Pixel data, in the exact same format a framebuffer of that bitdepth would use
+	size_t               size;
+	uint32_t             width;
+	uint32_t             height;
+	uint32_t             stride;    // Length of a line, in bytes
+	uint8_t              bpp;
+	uint8_t              rota;
+	uint32_t             refresh_count;    // Amount of refreshes recorded (instead of sent) since the last reset
+	FBInkRect            damage;           // Bounding box of those refreshes
+} FBInkCanvas;
+
+// For use with fbink_share_back_buffer
+typedef struct
+{
+	int      fd;    // Shared memory backing the back buffer, mmap it (MAP_SHARED) to draw to it directly
+	size_t   size;
+	uint32_t width;
+	uint32_t height;
+	uint32_t stride;    // Length of a line, in bytes
+	uint8_t  bpp;
+	uint8_t  rota;
+} FBInkSharedBuffer;
+
+// For use with fbink_get_device_id_stats
+typedef struct
+{
+	uint64_t elapsed_ns;    // How long device identification took during the first fbink_init
+	bool     is_cached;     // Whether it was restored from the device cache (c.f., FBINK_DEVICE_CACHE)
+} FBInkDeviceIdStats;
+
+// Called by the async refresh worker when an update sent via fbink_refresh_async has completed
+// marker:		The update marker of that update (i.e., the ticket returned by fbink_refresh_async).
+// status:		EXIT_SUCCESS if we successfully waited for its completion, a negative value otherwise.
+// userdata:		The pointer passed to fbink_refresh_async.
+typedef void (*FBInkRefreshCallback)(uint32_t marker, int status, void* userdata);
+
 //
 ////
 //
@@ -407,6 +469,18 @@ FBINK_API void fbink_state_dump(const FBInkConfig* restrict fbink_cfg);
 //       You can also peek at the output of fbink -e to get a hint of what the data actually looks like.
 FBINK_API void fbink_get_state(const FBInkConfig* restrict fbink_cfg, FBInkState* restrict fbink_state);
 
+// Report how long device identification took, and whether it was served from the device cache.
+// NOTE: Device identification only ever happens once per process, during the first fbink_init call.
+//       Since it may involve a bit of I/O (f.g., reading the NTX HWConfig block on Kobo, or the serial on Kindle),
+//       processes that are started often can instead cache its results in a file:
+//       just point FBINK_DEVICE_CACHE to a path in your environment (preferably on a tmpfs, f.g., /tmp/fbink-device).
+//       The cache is keyed on the framebuffer's id & memory size, the kernel's release & build stamp,
+//       as well as FBInk's version, and is simply refreshed when any of those change.
+// Returns -(ENODATA) if no device identification has taken place yet.
+// Returns -(ENOSYS) on pure Linux builds, where no device identification takes place.
+// stats:		Pointer to an FBInkDeviceIdStats struct.
+FBINK_API int fbink_get_device_id_stats(FBInkDeviceIdStats* restrict stats);
+
 //
 // Print a string on screen.
 // NOTE: The string is expected to be encoded in valid UTF-8:
@@ -431,6 +505,11 @@ FBINK_API int fbink_print(int fbfd, const char* restrict string, const FBInkConf
 // style:		Defines the specific style of the specified font (FNT_REGULAR, FNT_ITALIC, FNT_BOLD or FNT_BOLD_ITALIC).
 // NOTE: You MUST free the fonts loaded when you are done with all of them by calling fbink_free_ot_fonts().
 // NOTE: You MAY replace a font without first calling fbink_free_ot_fonts().
+// NOTE: The font file is memory-mapped (read-only), not copied, until it's freed.
+//       As such, do NOT modify or truncate it in the meantime, or you'll be greeted by a SIGBUS!
+// NOTE: If FBINK_OT_MADV_RANDOM is set (to anything) in your environment, the mapping is flagged with MADV_RANDOM,
+//       which disables readahead. That may save some I/O with large (f.g., CJK) fonts on slow storage, but
+//       the kernel's default is usually the better bet, so measure first.
 // NOTE: Default fonts are secreted away in /usr/java/lib/fonts on Kindle,
 //       and in /usr/local/Trolltech/QtEmbedded-4.6.2-arm/lib/fonts on Kobo,
 //       but you can't use the Kobo ones because they're obfuscated...
@@ -439,8 +518,60 @@ FBINK_API int fbink_print(int fbfd, const char* restrict string, const FBInkConf
 FBINK_API int fbink_add_ot_font(const char* filename, FONT_STYLE_T style);
 
 // Free all loaded OpenType fonts. You MUST call this when you have finished all OT printing.
+// NOTE: This also flushes the glyph cache.
 FBINK_API int fbink_free_ot_fonts(void);
 
+// Set the memory budget of the glyph cache used by fbink_print_ot(), in bytes.
+// NOTE: Rasterized glyphs (and their metrics) are cached across calls, per font style, size & glyph.
+//       When the budget is exceeded, the least recently used glyphs are evicted first.
+//       The default budget is 2MB. Setting it to 0 disables the cache entirely.
+//       Shrinking it below the current usage evicts glyphs right away.
+// Returns -(ENOSYS) when OT support is disabled (MINIMAL build).
+// max_size:		Memory budget, in bytes.
+FBINK_API int fbink_set_ot_cache_size(size_t max_size);
+
+// Fill the FBInkOTCacheStats struct pointed to by stats with the glyph cache's current counters.
+// NOTE: Counters are cumulative over the lifetime of the context, they're not reset by fbink_free_ot_fonts().
+// Returns -(EINVAL) if stats is NULL.
+// Returns -(ENOSYS) when OT support is disabled (MINIMAL build).
+FBINK_API int fbink_get_ot_cache_stats(FBInkOTCacheStats* restrict stats);
+
+// Release the scratch memory used by fbink_print, fbink_printf & fbink_print_ot.
+// NOTE: Those keep their temporary buffers in a single arena that is reused across calls instead of being freed,
+//       and that grows to the largest amount of memory a single call ever needed.
+//       Call this if a one-off large print left it bigger than you'd like, or once you're done printing for a while.
+// Returns the amount of memory that was released, in bytes.
+FBINK_API size_t fbink_trim_scratch(void);
+
+//
+// Switch FBInk to an off-screen canvas backend: a memory-backed virtual framebuffer of the requested size & bitdepth.
+// Every drawing function will then render to that instead of /dev/fb0, via the exact same code paths,
+// and refreshes will be recorded (c.f., fbink_get_canvas_info) instead of being sent to the EPDC.
+// This is useful to compose a frame off-screen, or to run the renderers on a machine without a framebuffer.
+// Returns FBFD_CANVAS on success, which you then pass to fbink_init (and, optionally, to every other call).
+// NOTE: FBFD_AUTO keeps working as usual, it'll simply resolve to the canvas, too.
+// NOTE: Call fbink_close(FBFD_CANVAS) to release it, and switch back to the real framebuffer (which will need an fbink_init).
+// NOTE: To blit it on screen, fbink_dump it, close it, fbink_init the real framebuffer, and fbink_restore the dump
+//       (which obviously requires a canvas of the same bitdepth).
+// NOTE: Device quirks (e.g., the Kobo boot rotation & hidden rows) are *not* applied to a canvas.
+// NOTE: The buffer is sized exactly (i.e., a stride of width * bpp / 8, no padding, no slack),
+//       unlike most real framebuffers. Every renderer clips to it at every supported bitdepth, 24bpp included.
+// Returns -(EINVAL) on an unsupported bitdepth (i.e., not one of 4, 8, 16, 24 or 32), a nonsensical size,
+//                   or a rotation other than FB_ROTATE_UR.
+// width:		Width of the canvas, in pixels. Must be even at 4bpp.
+// height:		Height of the canvas, in pixels.
+// bpp:			Bitdepth of the canvas.
+// rota:		Rotation of the canvas. Only FB_ROTATE_UR (0) is supported: to render in Landscape,
+//			simply swap width & height.
+FBINK_API int fbink_open_canvas(uint32_t width, uint32_t height, uint8_t bpp, uint8_t rota);
+
+// Fill the FBInkCanvas struct pointed to by canvas with the current state of the off-screen canvas.
+// NOTE: data points to FBInk's own buffer, which is only valid until fbink_close.
+// Returns -(ENODEV) if no canvas is currently open.
+// canvas:		Pointer to an FBInkCanvas struct.
+// reset_damage:	If true, reset the refresh counter & the damage rectangle *after* filling canvas.
+FBINK_API int fbink_get_canvas_info(FBInkCanvas* restrict canvas, bool reset_damage);
+
 // Print a string using an OpenType font.
 // NOTE: The caller MUST have loaded at least one font via fbink_add_ot_font() FIRST.
 // This function uses margins (in pixels) instead of rows/columns for positioning and setting the printable area.
@@ -480,6 +611,93 @@ FBINK_API int fbink_print_ot(int                           fbfd,
 			     const FBInkConfig* restrict   fbink_cfg,
 			     FBInkOTFit* restrict          fit);
 
+//
+// Find the largest font size at which string fits in the printable area defined by cfg's margins,
+// and print it at that size.
+// NOTE: Same requirements as fbink_print_ot (i.e., fbink_init & at least one fbink_add_ot_font call first).
+// NOTE: Line-breaking & glyph metrics are computed only once, and then simply scaled for each probed size,
+//       so this is *much* cheaper than a loop of compute_only fbink_print_ot calls.
+//       It assumes that if a size fits, every smaller one does, too, which is true for any sane font.
+// Returns the font size (in pixels) that was picked, if the return value is positive.
+// Returns -(ENOSPC) if string doesn't fit even at min_size_px.
+// Returns -(EINVAL) if string is empty, or if the size range is invalid.
+// Otherwise, same return values as fbink_print_ot.
+// fbfd:		Open file descriptor to the framebuffer character device,
+//				if set to FBFD_AUTO, the fb is opened & mmap'ed for the duration of this call.
+// string:		UTF-8 encoded string to print.
+// cfg:			Pointer to an FBInkOTConfig struct. size_px & size_pt are ignored.
+//				If compute_only is set, the best size is returned, but nothing is printed.
+// fbink_cfg:		Optional pointer to an FBInkConfig struct (c.f., fbink_print_ot).
+// max_lines:		Maximum amount of lines the string may be broken into. 0 means as many as fit.
+// min_size_px:		Smallest font size to consider, in pixels. 0 means 1px.
+// max_size_px:		Largest font size to consider, in pixels. 0 means the height of the printable area.
+// fit:			Optional pointer to an FBInkOTFit struct, filled in by the final print
+//				(c.f., fbink_print_ot).
+//				If compute_only is set, only computed_lines is meaningful.
+FBINK_API int fbink_fit_ot(int                           fbfd,
+			   const char* restrict          string,
+			   const FBInkOTConfig* restrict cfg,
+			   const FBInkConfig* restrict   fbink_cfg,
+			   unsigned short int            max_lines,
+			   unsigned short int            min_size_px,
+			   unsigned short int            max_size_px,
+			   FBInkOTFit* restrict          fit);
+
+//
+// Create a persistent OpenType text layout, for text that gets updated often (e.g., live notes, chat views, logs).
+// It remembers the line-break opportunities, glyph metrics & line boundaries of its text,
+// so that updating that text only re-computes what follows the first affected line,
+// and rendering it only redraws the lines that actually changed since the last render.
+// NOTE: Same requirements as fbink_print_ot (i.e., fbink_init & at least one fbink_add_ot_font call first).
+//       The printable area & font size are computed once and for all, here.
+//       As such, the layout has to be re-created after a fbink_reinit, or if the fonts were changed.
+// Returns -(ENOSYS) when OT support is disabled (MINIMAL build).
+// Returns -(ENODATA) if fbink_add_ot_font() hasn't been called yet.
+// Returns -(ERANGE) if the provided margins are out of range, or sum to < view height or width.
+// cfg:			Pointer to an FBInkOTConfig struct. compute_only is ignored,
+//				no_truncation makes updates that don't fit in the printable area fail with -(ENOSPC)
+//				(the layout is updated regardless).
+// layout:		Pointer to an FBInkOTLayout pointer, set to the new layout on success.
+//				It has to be released via fbink_free_ot_layout.
+// NOTE: A new layout is empty, set its text with fbink_set_ot_layout_text or fbink_append_ot_layout_text.
+FBINK_API int fbink_new_ot_layout(const FBInkOTConfig* restrict cfg, FBInkOTLayout** restrict layout);
+
+// Replace the text of a layout.
+// Only the lines from the one preceding the first change onwards are re-computed,
+// and computations stop early if that leads to lines identical to the ones that followed the change before.
+// Returns the amount of lines the text was laid out in, if the return value is positive (or zero).
+// Returns -(EILSEQ) if string is not a valid UTF-8 sequence.
+// Returns -(ENOENT) if string uses a formatting style that wasn't loaded (the layout is then left empty).
+// Returns -(ENOSPC) if no_truncation was set, and string needs to be truncated to fit in the printable area.
+// layout:		Pointer to an FBInkOTLayout, as created by fbink_new_ot_layout.
+// string:		UTF-8 encoded string (may be empty).
+// fit:			Optional pointer to an FBInkOTFit struct (computed_lines & truncated are set).
+FBINK_API int fbink_set_ot_layout_text(FBInkOTLayout* restrict layout,
+				       const char* restrict    string,
+				       FBInkOTFit* restrict    fit);
+
+// Append text to a layout. Same as fbink_set_ot_layout_text, but only the last line (or two) have to be re-computed.
+FBINK_API int fbink_append_ot_layout_text(FBInkOTLayout* restrict layout,
+					  const char* restrict    string,
+					  FBInkOTFit* restrict    fit);
+
+// Render a layout, only (re-)drawing the lines whose content or position changed since the previous render.
+// Returns the amount of lines that were (re-)drawn, if the return value is positive (or zero).
+// Otherwise, same return values as fbink_print_ot.
+// fbfd:		Open file descriptor to the framebuffer character device,
+//				if set to FBFD_AUTO, the fb is opened & mmap'ed for the duration of this call.
+// layout:		Pointer to an FBInkOTLayout, as created by fbink_new_ot_layout.
+// fbink_cfg:		Optional pointer to an FBInkConfig struct (c.f., fbink_print_ot).
+//				valign & is_cleared are ignored, halign applies to each line.
+// NOTE: The layout owns its printable area: (re-)drawn lines are cleared to the background color first,
+//       and so are the lines that were drawn before, but no longer exist.
+// NOTE: Everything that was (re-)drawn is refreshed in a single update (unless no_refresh is set).
+FBINK_API int fbink_render_ot_layout(int fbfd, FBInkOTLayout* restrict layout, const FBInkConfig* restrict fbink_cfg);
+
+// Free a layout created by fbink_new_ot_layout.
+// NOTE: This does not clear it from the screen.
+FBINK_API int fbink_free_ot_layout(FBInkOTLayout* restrict layout);
+
 //
 // Brings printf formatting to fbink_print and fbink_print_ot ;).
 // fbfd:		Open file descriptor to the framebuffer character device,
@@ -514,6 +732,7 @@ FBINK_API int fbink_printf(int                           fbfd,
 // fbink_cfg:		Pointer to an FBInkConfig struct. Honors wfm_mode, is_nightmode, is_flashing.
 // NOTE: If you request an empty region (0x0 @ (0, 0), a full-screen refresh will be performed!
 // NOTE: This *ignores* is_dithered & no_refresh ;).
+// NOTE: In deferred refresh mode, this is queued like any other refresh (c.f., fbink_set_deferred_refresh).
 // NOTE: If you do NOT want to request hardware dithering, set dithering_mode to HWD_PASSTHROUGH (i.e., 0).
 //       This is also the fallback value.
 FBINK_API int fbink_refresh(int                         fbfd,
@@ -581,6 +800,69 @@ FBINK_API int fbink_wait_for_complete(int fbfd, uint32_t marker);
 //       otherwise, simply passing LAST_MARKER to 'em should do the trick.
 FBINK_API uint32_t fbink_get_last_marker(void);
 
+//
+// Toggle deferred refresh mode.
+// When enabled, the refreshes implied by every drawing call (as well as explicit fbink_refresh calls)
+// are queued instead of being sent to the EPDC right away, until the next fbink_flush call.
+// Queued requests with matching settings (waveform mode, dithering, nightmode & flashing) are merged together
+// when their regions overlap or are adjacent, in order to send as few updates as possible.
+// NOTE: This is a NOP on non-eInk devices (i.e., pure Linux builds).
+// NOTE: The queue is bounded, so, if it fills up, the oldest request will be sent early.
+// NOTE: Disabling it flushes any pending requests.
+// NOTE: Until the queue is flushed, fbink_get_last_marker will keep returning the marker of the last update actually sent.
+// fbfd:		Open file descriptor to the framebuffer character device,
+//				if set to FBFD_AUTO, the fb is opened for the duration of this call.
+//				(Only used to flush pending requests when disabling deferred mode).
+// enable:		true to queue refreshes, false to go back to sending them immediately (the default).
+FBINK_API int fbink_set_deferred_refresh(int fbfd, bool enable);
+
+// Send all the refresh requests queued in deferred refresh mode.
+// Returns the amount of updates sent (which may be zero), or a negative value on failure.
+// NOTE: All requests are sent (and dequeued) even if one of them fails.
+// fbfd:		Open file descriptor to the framebuffer character device,
+//				if set to FBFD_AUTO, the fb is opened for the duration of this call.
+FBINK_API int fbink_flush(int fbfd);
+
+//
+// Asynchronous variant of fbink_refresh: the update is sent right away,
+// but waiting for its completion is left to a background worker thread,
+// which will then call callback (if it's not NULL), and signal the eventfd returned by fbink_get_refresh_eventfd (if any).
+// This allows rendering the next frame while the EPDC is still busy with the previous one.
+// Returns the update marker of this refresh, which doubles as a ticket identifying it, or LAST_MARKER (0U) on failure.
+// NOTE: Same arguments as fbink_refresh, plus:
+// callback:		Function to call once the update has completed. May be NULL.
+//				NOTE: It runs on the worker thread, so keep it short, and do NOT call back into FBInk from it!
+// userdata:		Passed as-is to callback.
+// NOTE: The worker is started on the first call, and waits for updates in the order they were sent.
+//       If too many updates are already in flight, this blocks until the oldest one completes.
+// NOTE: This bypasses the deferred refresh queue (c.f., fbink_set_deferred_refresh).
+// NOTE: Not supported on non-eInk devices (i.e., pure Linux builds), nor on legacy einkfb Kindles.
+FBINK_API uint32_t fbink_refresh_async(int                         fbfd,
+				       uint32_t                    region_top,
+				       uint32_t                    region_left,
+				       uint32_t                    region_width,
+				       uint32_t                    region_height,
+				       uint8_t                     dithering_mode,
+				       const FBInkConfig* restrict fbink_cfg,
+				       FBInkRefreshCallback        callback,
+				       void*                       userdata);
+
+// Returns an eventfd (non-blocking, in semaphore mode) that the async refresh worker signals once per completed update,
+// so you can poll for completions in your own event loop instead of (or on top of) using a callback.
+// NOTE: Created on the first call, and owned by FBInk: do NOT close it yourself, fbink_stop_refresh_worker will.
+// Returns -(ENOSYS) on non-eInk devices (i.e., pure Linux builds).
+FBINK_API int fbink_get_refresh_eventfd(void);
+
+// Returns the update marker of the last update that the async refresh worker saw complete.
+// NOTE: Returns LAST_MARKER (0U) if there wasn't any.
+FBINK_API uint32_t fbink_get_last_completed_marker(void);
+
+// Wait for all in-flight async updates to complete, then stop the async refresh worker, and release its resources,
+// including the eventfd returned by fbink_get_refresh_eventfd.
+// NOTE: You MUST call this before unloading FBInk if you've used fbink_refresh_async.
+// NOTE: It's fine to call fbink_refresh_async again afterwards, the worker will simply be restarted.
+FBINK_API int fbink_stop_refresh_worker(void);
+
 //
 // Returns true if the device appears to be in a quirky framebuffer state that *may* require a reinit to produce sane results.
 // NOTE: The intended use-case is for long running apps which may trigger prints across different framebuffer states,
@@ -612,6 +894,30 @@ FBINK_API bool fbink_is_fb_quirky(void) __attribute__((pure, deprecated));
 // fbink_cfg:		Pointer to an FBInkConfig struct.
 FBINK_API int fbink_reinit(int fbfd, const FBInkConfig* restrict fbink_cfg);
 
+// Start a background thread that watches the framebuffer for layout changes (i.e., bitdepth & rotation),
+// so that fbink_reinit can skip its ioctl entirely (and return immediately) as long as nothing actually changed.
+// This is of interest to long running apps that print often, and would otherwise call fbink_reinit before every print.
+// Returns an eventfd (non-blocking) that the watcher signals whenever it detects a change,
+// so you can add it to your own event loop, and react to changes by calling fbink_reinit (which acks it).
+// NOTE: The watcher checks the layout whenever the kernel sends a uevent about a framebuffer,
+//       and otherwise every interval_ms, because most kernels do *not* send uevents on mode changes.
+//       This means a change may go unnoticed for up to interval_ms.
+// NOTE: Owned by FBInk: do NOT close the eventfd yourself, fbink_stop_fb_watcher will.
+// NOTE: Requires a prior fbink_init call.
+//       Calling it again while the watcher is running simply returns the same eventfd.
+// Returns -(EINVAL) on a negative interval_ms.
+// Returns -(ENOTSUP) on a canvas, which can't change behind our back.
+// Returns -(ENOSYS) on Kindle, where fbink_reinit is not needed.
+// interval_ms:		How often to check the layout, in ms, if the kernel stays quiet.
+//				0 means the default (500ms). Must not be negative:
+//				there is no uevent-only mode, as mode changes usually do not send any.
+FBINK_API int fbink_start_fb_watcher(int interval_ms);
+
+// Stop the framebuffer layout watcher, and release its resources, including its eventfd.
+// NOTE: fbink_reinit goes back to checking the layout itself afterwards.
+// NOTE: You MUST call this before unloading FBInk if you've used fbink_start_fb_watcher.
+FBINK_API int fbink_stop_fb_watcher(void);
+
 //
 // Print a full-width progress bar on screen.
 // fbfd:		Open file descriptor to the framebuffer character device,
@@ -695,6 +1001,19 @@ FBINK_API int fbink_print_raw_data(int                         fbfd,
 				   short int                   y_off,
 				   const FBInkConfig* restrict fbink_cfg);
 
+// Set how many threads (including the caller's) fbink_print_image & fbink_print_raw_data may use
+// to scale & blit the image.
+// The image is split in horizontal bands, blitted in parallel by a small pool of persistent worker threads.
+// Scaling (c.f., scaled_width & scaled_height in FBInkConfig) is split the same way, with short-lived threads.
+// The results are identical to a single-threaded scale & blit (i.e., when threads is 1).
+// NOTE: Defaults to one thread per online CPU (that's also what 0 means).
+//       Small images, as well as text rendering, are never split, and the pool is only spun up on the first large blit.
+// NOTE: Setting it again stops the current workers (they'll be restarted on demand).
+//       You MUST call fbink_set_image_threads(1) before unloading FBInk if you've printed images.
+// Returns -(ENOSYS) when image support is disabled (MINIMAL build).
+// threads:		How many threads to use, 1 means single-threaded, 0 means one per online CPU (capped at 16).
+FBINK_API int fbink_set_image_threads(uint8_t threads);
+
 //
 // Just clear the screen (or a region of it), eInk refresh included (or not ;)).
 // fbfd:		Open file descriptor to the framebuffer character device,
@@ -725,6 +1044,11 @@ FBINK_API int fbink_cls(int fbfd, const FBInkConfig* restrict fbink_cfg, const F
 // NOTE: On *most* devices (the exceptions being 4bpp & 16bpp fbs),
 //       the data being dumped is perfectly valid input for fbink_print_raw_data,
 //       in case you'd ever want to do some more exotic things with it...
+// NOTE: If you set the is_compressed field of the FBInkDump struct first, the dump will instead be run-length encoded,
+//       row by row, which is usually a *massive* win on eInk content (i.e., mostly large runs of white & black).
+//       fbink_restore decodes it straight into the framebuffer, and honors clip & diff_only just the same.
+//       Like clip, you're expected to set it yourself (neither a recycling nor fbink_free_dump_data clear it).
+//       Obviously, that data is then *NOT* valid input for fbink_print_raw_data, and size is the *encoded* size.
 FBINK_API int fbink_dump(int fbfd, FBInkDump* restrict dump);
 
 // Dump a specific region of the screen.
@@ -751,7 +1075,10 @@ FBINK_API int fbink_region_dump(int                         fbfd,
 // Otherwise, returns a few different things on failure:
 //	-(ENOTSUP)	when the dump cannot be restored because it wasn't taken at the current bitdepth and/or rotation,
 //			or because it's wider/taller/larger than the current framebuffer, or if the crop is invalid (OOB).
+//			Likewise if its area extends past the screen, if it's a full dump that doesn't match the screen's
+//			exact layout, or if its data is too short for its area.
 //	-(EINVAL)	when there's no data to restore.
+//	-(EILSEQ)	when the data of a compressed dump is corrupted.
 // fbfd:		Open file descriptor to the framebuffer character device,
 //				if set to FBFD_AUTO, the fb is opened & mmap'ed for the duration of this call.
 // fbink_cfg:		Pointer to an FBInkConfig struct (honors wfm_mode, is_dithered, is_nightmode, is_flashing & no_refresh).
@@ -773,6 +1100,12 @@ FBINK_API int fbink_region_dump(int                         fbfd,
 //       And while it can safely completely overlap the dump's area, it still needs to be constrained to the screen's dimension.
 //       Of course, only the intersection of this rectangle with the dump's area will be restored.
 //       Be aware that you'll also need to flip the is_full field yourself first if you ever need to crop a full dump.
+// NOTE: If you set the diff_only field of the FBInkDump struct, the dump is first compared to what's on screen,
+//       and only the bands of rows that actually differ are written back, and refreshed (each as its own update,
+//       clamped to the columns that changed, with nearby bands merged together).
+//       This is much cheaper than a full restore when only a small part of the dumped area was drawn over
+//       (e.g., restoring a page after having shown a short-lived popup on top of it).
+//       Like clip, this is a field you're expected to set yourself.
 // NOTE: This does *NOT* free data.dump!
 FBINK_API int fbink_restore(int fbfd, const FBInkConfig* restrict fbink_cfg, const FBInkDump* restrict dump);
 
@@ -786,6 +1119,83 @@ FBINK_API int fbink_restore(int fbfd, const FBInkConfig* restrict fbink_cfg, con
 //       as dump() will implicitly free a dirty struct in order to recycle it.
 FBINK_API int fbink_free_dump_data(FBInkDump* restrict dump);
 
+// Save a dump made by fbink_dump/fbink_region_dump to a file, so that it can be restored by another process.
+// Returns -(ENOSYS) when image support is disabled (MINIMAL build).
+// Otherwise, returns a few different things on failure:
+//	-(EINVAL)	when there's no data to save.
+//	-(EXIT_FAILURE)	when the file couldn't be written.
+// dump:		Pointer to an FBInkDump struct, as setup by fbink_dump or fbink_region_dump.
+// filename:		Path to the file to create (or truncate).
+// NOTE: The file is made of a small header describing the dump (area, rotation, bitdepth, row stride...),
+//       followed by its data, as-is (i.e., in the framebuffer's pixel format, or RLE packed if is_compressed was set).
+//       It's *not* meant to be portable: it can only be restored on a device with the exact same framebuffer setup.
+// NOTE: This does *NOT* free data.dump!
+FBINK_API int fbink_dump_to_file(const FBInkDump* restrict dump, const char* restrict filename);
+
+// Restore a dump file saved by fbink_dump_to_file.
+// Returns -(ENOSYS) when image support is disabled (MINIMAL build).
+// Otherwise, returns a few different things on failure:
+//	-(EINVAL)	when the file doesn't look like a valid dump.
+//	-(ENOTSUP)	when the dump cannot be restored on the current framebuffer (c.f., fbink_restore).
+//	-(EXIT_FAILURE)	when the file couldn't be opened or mapped.
+// fbfd:		Open file descriptor to the framebuffer character device,
+//				if set to FBFD_AUTO, the fb is opened & mmap'ed for the duration of this call.
+// fbink_cfg:		Pointer to an FBInkConfig struct (honors wfm_mode, is_dithered, is_nightmode, is_flashing & no_refresh).
+// filename:		Path to the dump file.
+// NOTE: The file is mapped, and its rows are copied (or decoded) straight into the framebuffer,
+//       without ever going through an intermediate buffer on the heap.
+// NOTE: The same caveats as fbink_restore apply, since this is exactly what it ends up calling.
+FBINK_API int fbink_restore_from_file(int fbfd, const FBInkConfig* restrict fbink_cfg, const char* restrict filename);
+
+//
+// Redirect *every* subsequent drawing call to a back buffer, so that frames can be built off-screen,
+// and put on screen in one go with fbink_present, without a round-trip through fbink_dump & fbink_restore.
+// The back buffer starts out as a copy of what's currently on screen.
+// While it's active, refreshes are *not* sent: their regions are accumulated instead (c.f., fbink_present).
+// Returns -(ENOTSUP) if fbfd is FBFD_AUTO, as the back buffer can't outlive the framebuffer mapping.
+// Returns -(ENOMEM) if we failed to allocate a shadow buffer.
+// fbfd:		Open file descriptor to the framebuffer character device, as returned by fbink_open().
+//			*All* the drawing calls meant for the back buffer MUST be passed this same fd.
+// NOTE: On Kobo Mk. 3 to 6, if the framebuffer memory is large enough to hold a second buffer,
+//       the back buffer lives there, and fbink_present can refresh straight from it (c.f., utils/alt_buffer.c).
+//       Everywhere else, it's a shadow buffer in regular memory, and fbink_present copies from it.
+// NOTE: Calling this when the back buffer is already active is a NOP.
+// NOTE: The back buffer is dropped by fbink_close, as well as by fbink_reinit if the bitdepth or rotation changed.
+FBINK_API int fbink_get_back_buffer(int fbfd);
+
+// Same as fbink_get_back_buffer, but the back buffer lives in shared memory (a memfd, when the kernel supports it),
+// so that other processes can draw to it directly, without having to copy their pixels through FBInk.
+// Once they're done, a simple fbink_present of the region they touched puts it on screen.
+// (This is what the CLI tool's socket server mode offers its clients, c.f., SOCK_SHARE_BACK_BUFFER in fbink_socket.h).
+// Returns -(ENOTSUP) if fbfd is FBFD_AUTO, as the back buffer can't outlive the framebuffer mapping.
+// fbfd:		Open file descriptor to the framebuffer character device, as returned by fbink_open().
+// shared:		Pointer to an FBInkSharedBuffer struct, which will be filled with the details of the buffer.
+//			Its content is laid out *exactly* like the framebuffer's
+//			(i.e., framebuffer coordinates, native pixel format).
+// NOTE: If the back buffer was already active, it's moved to shared memory, content & pending damage included.
+// NOTE: When it's a memfd, it's sealed against resizing (F_SEAL_SHRINK | F_SEAL_GROW).
+// NOTE: The fd belongs to FBInk, and is closed by fbink_release_back_buffer: dup it if you need to keep it around.
+//       Existing mappings of it stay valid, but the buffer is no longer on FBInk's side.
+// NOTE: Since FBInk can't know what other processes drew, pass an explicit rect to fbink_present.
+FBINK_API int fbink_share_back_buffer(int fbfd, FBInkSharedBuffer* restrict shared);
+
+// Put (part of) the back buffer on screen.
+// Returns -(ENOTSUP) if the back buffer isn't active.
+// fbfd:		Open file descriptor to the framebuffer character device, as returned by fbink_open().
+// rect:		Optional pointer to an FBInkRect rectangle, in the same coordinates as fbink_get_last_rect.
+//			If NULL (or empty), present everything that was drawn since the last present.
+// fbink_cfg:		Pointer to an FBInkConfig struct (honors wfm_mode, is_dithered, is_nightmode, is_flashing, no_refresh).
+// NOTE: The back buffer stays active, and keeps its content, so you can keep drawing the next frame over this one.
+// NOTE: When refreshing straight from the back buffer, the EPDC only fetches the pixels when it actually processes the update,
+//       so if you want to be sure not to leak bits of the next frame on screen, wait for completion first
+//       (i.e., fbink_wait_for_complete(fbfd, LAST_MARKER)).
+FBINK_API int fbink_present(int fbfd, const FBInkRect* restrict rect, const FBInkConfig* restrict fbink_cfg);
+
+// Go back to drawing directly to the screen, discarding anything that wasn't presented.
+// Returns -(ENOTSUP) if the back buffer isn't active.
+// fbfd:		Open file descriptor to the framebuffer character device, as returned by fbink_open().
+FBINK_API int fbink_release_back_buffer(int fbfd);
+
 //
 // Return the coordinates & dimensions of the last thing that was *drawn*.
 // Returns an empty (i.e., {0, 0, 0, 0}) rectangle if nothing was drawn.
@@ -801,6 +1211,160 @@ FBINK_API int fbink_free_dump_data(FBInkDump* restrict dump);
 //       i.e., they *will* match with what we actually send to mxcfb (and where we actually drew on the fb)!
 FBINK_API FBInkRect fbink_get_last_rect(void);
 
+//
+// Contexts allow driving several targets (f.g., the framebuffer *and* an off-screen canvas) from the same process.
+// Each context holds its own, independent copy of every piece of per-target state:
+// the fb mapping & the results of fbink_init, the logging flags, the canvas, the back buffer,
+// the deferred refresh queue, the OpenType fonts, the glyph caches, the scratch memory,
+// the last marker & the last rect.
+// Only device identification, the async refresh worker, the image band workers & the layout watcher are shared.
+// NOTE: Every *_ctx function behaves exactly like its regular counterpart, but acts on ctx instead.
+//       The regular API always acts on the default context, which is what passing NULL as ctx means.
+// NOTE: Different contexts can be used from different threads in parallel, including alongside the regular API.
+//       A given context, on the other hand, must only be used by one thread at a time:
+//       *_ctx calls enforce that on their own (they serialize on a per-context lock),
+//       but the regular API does not take the default context's lock, so, don't mix it with *_ctx calls on NULL.
+// NOTE: The layout watcher only ever tracks the default context (c.f., fbink_start_fb_watcher).
+// NOTE: An OpenType layout is tied to the context it was created on, only use it with that one.
+//       fbink_free_ot_layout, fbink_free_dump_data & fbink_dump_to_file don't depend on a context at all.
+// NOTE: A new context is in the same state as the default one before its first fbink_init,
+//       i.e., you'll need to call fbink_init_ctx (or fbink_open_canvas_ctx, then fbink_init_ctx) on it.
+// Returns NULL on failure.
+FBINK_API FBInkContext* fbink_new_context(void);
+
+// Release everything held by ctx (c.f., fbink_close, fbink_free_ot_fonts & fbink_trim_scratch), and ctx itself.
+// NOTE: This does *not* close the fb fd you may have passed to fbink_init_ctx, that's still your job.
+// Returns -(EINVAL) if ctx is NULL, as the default context cannot be freed.
+FBINK_API int fbink_free_context(FBInkContext* ctx);
+
+FBINK_API int       fbink_init_ctx(FBInkContext* ctx, int fbfd, const FBInkConfig* restrict fbink_cfg);
+FBINK_API int       fbink_reinit_ctx(FBInkContext* ctx, int fbfd, const FBInkConfig* restrict fbink_cfg);
+FBINK_API int       fbink_open_canvas_ctx(FBInkContext* ctx,
+					  uint32_t      width,
+					  uint32_t      height,
+					  uint8_t       bpp,
+					  uint8_t       rota);
+FBINK_API int       fbink_get_canvas_info_ctx(FBInkContext* ctx, FBInkCanvas* restrict canvas, bool reset_damage);
+FBINK_API int       fbink_close_ctx(FBInkContext* ctx, int fbfd);
+FBINK_API void      fbink_state_dump_ctx(FBInkContext* ctx, const FBInkConfig* restrict fbink_cfg);
+FBINK_API void      fbink_get_state_ctx(FBInkContext*               ctx,
+					const FBInkConfig* restrict fbink_cfg,
+					FBInkState* restrict        fbink_state);
+FBINK_API int       fbink_add_ot_font_ctx(FBInkContext* ctx, const char* filename, FONT_STYLE_T style);
+FBINK_API int       fbink_free_ot_fonts_ctx(FBInkContext* ctx);
+FBINK_API int       fbink_set_ot_cache_size_ctx(FBInkContext* ctx, size_t max_size);
+FBINK_API int       fbink_get_ot_cache_stats_ctx(FBInkContext* ctx, FBInkOTCacheStats* restrict stats);
+FBINK_API size_t    fbink_trim_scratch_ctx(FBInkContext* ctx);
+FBINK_API int       fbink_print_ctx(FBInkContext*        ctx,
+				    int                  fbfd,
+				    const char* restrict string,
+				    const FBInkConfig*   fbink_cfg);
+FBINK_API int       fbink_print_ot_ctx(FBInkContext*                 ctx,
+				       int                           fbfd,
+				       const char* restrict          string,
+				       const FBInkOTConfig* restrict cfg,
+				       const FBInkConfig* restrict   fbink_cfg,
+				       FBInkOTFit* restrict          fit);
+FBINK_API int       fbink_fit_ot_ctx(FBInkContext*                 ctx,
+				     int                           fbfd,
+				     const char* restrict          string,
+				     const FBInkOTConfig* restrict cfg,
+				     const FBInkConfig* restrict   fbink_cfg,
+				     unsigned short int            max_lines,
+				     unsigned short int            min_size_px,
+				     unsigned short int            max_size_px,
+				     FBInkOTFit* restrict          fit);
+FBINK_API int       fbink_new_ot_layout_ctx(FBInkContext*                 ctx,
+					    const FBInkOTConfig* restrict cfg,
+					    FBInkOTLayout** restrict      layout);
+FBINK_API int       fbink_set_ot_layout_text_ctx(FBInkContext*           ctx,
+						 FBInkOTLayout* restrict layout,
+						 const char* restrict    string,
+						 FBInkOTFit* restrict    fit);
+FBINK_API int       fbink_append_ot_layout_text_ctx(FBInkContext*           ctx,
+						    FBInkOTLayout* restrict layout,
+						    const char* restrict    string,
+						    FBInkOTFit* restrict    fit);
+FBINK_API int       fbink_render_ot_layout_ctx(FBInkContext*               ctx,
+					       int                         fbfd,
+					       FBInkOTLayout* restrict     layout,
+					       const FBInkConfig* restrict fbink_cfg);
+FBINK_API int       fbink_refresh_ctx(FBInkContext*               ctx,
+				      int                         fbfd,
+				      uint32_t                    region_top,
+				      uint32_t                    region_left,
+				      uint32_t                    region_width,
+				      uint32_t                    region_height,
+				      uint8_t                     dithering_mode,
+				      const FBInkConfig* restrict fbink_cfg);
+FBINK_API int       fbink_wait_for_submission_ctx(FBInkContext* ctx, int fbfd, uint32_t marker);
+FBINK_API int       fbink_wait_for_complete_ctx(FBInkContext* ctx, int fbfd, uint32_t marker);
+FBINK_API uint32_t  fbink_get_last_marker_ctx(FBInkContext* ctx);
+FBINK_API int       fbink_set_deferred_refresh_ctx(FBInkContext* ctx, int fbfd, bool enable);
+FBINK_API int       fbink_flush_ctx(FBInkContext* ctx, int fbfd);
+FBINK_API uint32_t  fbink_refresh_async_ctx(FBInkContext*               ctx,
+					    int                         fbfd,
+					    uint32_t                    region_top,
+					    uint32_t                    region_left,
+					    uint32_t                    region_width,
+					    uint32_t                    region_height,
+					    uint8_t                     dithering_mode,
+					    const FBInkConfig* restrict fbink_cfg,
+					    FBInkRefreshCallback        callback,
+					    void*                       userdata);
+FBINK_API int       fbink_print_progress_bar_ctx(FBInkContext*               ctx,
+						 int                         fbfd,
+						 uint8_t                     percentage,
+						 const FBInkConfig* restrict fbink_cfg);
+FBINK_API int       fbink_print_activity_bar_ctx(FBInkContext*               ctx,
+						 int                         fbfd,
+						 uint8_t                     progress,
+						 const FBInkConfig* restrict fbink_cfg);
+FBINK_API int       fbink_print_image_ctx(FBInkContext*               ctx,
+					  int                         fbfd,
+					  const char*                 filename,
+					  short int                   x_off,
+					  short int                   y_off,
+					  const FBInkConfig* restrict fbink_cfg);
+FBINK_API int       fbink_print_raw_data_ctx(FBInkContext*               ctx,
+					     int                         fbfd,
+					     unsigned char*              data,
+					     const int                   w,
+					     const int                   h,
+					     const size_t                len,
+					     short int                   x_off,
+					     short int                   y_off,
+					     const FBInkConfig* restrict fbink_cfg);
+FBINK_API int       fbink_cls_ctx(FBInkContext*               ctx,
+				  int                         fbfd,
+				  const FBInkConfig* restrict fbink_cfg,
+				  const FBInkRect* restrict   rect);
+FBINK_API int       fbink_dump_ctx(FBInkContext* ctx, int fbfd, FBInkDump* restrict dump);
+FBINK_API int       fbink_region_dump_ctx(FBInkContext*               ctx,
+					  int                         fbfd,
+					  short int                   x_off,
+					  short int                   y_off,
+					  unsigned short int          w,
+					  unsigned short int          h,
+					  const FBInkConfig* restrict fbink_cfg,
+					  FBInkDump* restrict         dump);
+FBINK_API int       fbink_restore_ctx(FBInkContext*               ctx,
+				      int                         fbfd,
+				      const FBInkConfig* restrict fbink_cfg,
+				      const FBInkDump* restrict   dump);
+FBINK_API int       fbink_restore_from_file_ctx(FBInkContext*               ctx,
+						int                         fbfd,
+						const FBInkConfig* restrict fbink_cfg,
+						const char* restrict        filename);
+FBINK_API int       fbink_get_back_buffer_ctx(FBInkContext* ctx, int fbfd);
+FBINK_API int       fbink_share_back_buffer_ctx(FBInkContext* ctx, int fbfd, FBInkSharedBuffer* restrict shared);
+FBINK_API int       fbink_present_ctx(FBInkContext*               ctx,
+				      int                         fbfd,
+				      const FBInkRect* restrict   rect,
+				      const FBInkConfig* restrict fbink_cfg);
+FBINK_API int       fbink_release_back_buffer_ctx(FBInkContext* ctx, int fbfd);
+FBINK_API FBInkRect fbink_get_last_rect_ctx(FBInkContext* ctx);
+
 //
 // Scan the screen for Kobo's "Connect" button in the "USB plugged in" popup,
 // and optionally generate an input event to press that button.
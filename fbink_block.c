@@ -24,10 +24,15 @@
 static const uint32_t*
     block_get_bitmap(uint32_t codepoint)
 {
-	if (codepoint >= 0x20u && codepoint <= 0x7eu) {
-		return block_block1[codepoint - 0x20u];
-	} else {
+	const uint32_t page = codepoint >> 8U;
+	const uint8_t  slot = page <= 0x00u ? block_page_index[page] : 0U;
+	const uint32_t word = (codepoint >> 5U) & 0x07U;
+	const uint32_t bit  = 1U << (codepoint & 0x1FU);
+	const uint32_t bits = block_page_bits[slot][word];
+	if (!(bits & bit)) {
 		WARN("Codepoint U+%04X (%s) is not covered by this font", codepoint, u8_cp_to_utf8(codepoint));
-		return block_block1[0];
+		return block_glyphs[0];
 	}
+	const uint32_t glyph = block_page_base[slot][word] + (uint32_t) __builtin_popcount(bits & (bit - 1U));
+	return block_glyphs[glyph];
 }
@@ -346,7 +346,7 @@ int
 	// NOTE: RGB565 conversions are complex and potentially slightly lossy,
 	//       with slight rounding/truncation errors that can be different depending on how exactly the conversions were done.
 	//       This matches with what *we* do, hopefully that'll be close enough to what Nickel actually does...
-	if (deviceQuirks.isNTX16bLandscape) {
+	if (isNTX16bLandscape) {
 		button_color.r = 0xDEu;
 		button_color.g = 0xDBu;
 		button_color.b = 0xDEu;
@@ -304,6 +304,25 @@ static void
 	    "\t\tAnd to make pixel-perfect adjustments, you can also specifiy negative values for x & y.\n"
 	    "\tSpecifying one or more STRING takes precedence over this mode.\n"
 	    "\t--refresh also takes precedence over this mode.\n"
+	    "\n"
+	    "\n"
+	    "\n"
+	    "\n"
+	    "You can also save what's currently on screen to a file, and put it back on screen later, from another invocation:\n"
+	    "\t-j, --dump FILE\t\tDump the full screen to FILE, and abort early.\n"
+	    "\t-J, --restore FILE\tRestore a dump saved in FILE by -j, --dump, and abort early.\n"
+	    "\t\t\t\tHonors -W, --waveform; -D, --dither; -H, --nightmode; -f, --flash; -b, --norefresh & -w, --wait.\n"
+	    "\n"
+	    "EXAMPLES:\n"
+	    "\tfbink -j /tmp/screen.dump\n"
+	    "\t\tSaves the current content of the screen to /tmp/screen.dump.\n"
+	    "\tfbink -J /tmp/screen.dump -f\n"
+	    "\t\tPuts it back on screen, with a flashing refresh.\n"
+	    "\n"
+	    "NOTES:\n"
+	    "\tA dump can only be restored on the same device, at the same bitdepth & rotation.\n"
+	    "\tRestoring a dump is just a matter of copying it to the framebuffer, which is much faster than decoding an image.\n"
+	    "\tLike -k, --cls, these take precedence over *everything* (with -k, --cls first, then -j, --dump, then -J, --restore).\n"
 #endif
 	    "\n"
 	    "\n"
@@ -332,9 +351,29 @@ static void
 	    "\tf.g., echo -n 'Hello World!' > " FBINK_PIPE
 	    "\n"
 	    "\tRemember that LFs are honored!\n"
+	    "\tEach write is rendered as a single message, unless you terminate your messages with a NUL byte, f.g., printf 'Hello\\0World\\0' > " FBINK_PIPE
+	    "\n"
+	    "\t(Once a NUL has been seen, unterminated input is kept around until the rest of the message shows up, which makes writes larger than PIPE_BUF safe).\n"
+	    "\tIn bar mode, LFs terminate messages, too.\n"
+	    "\tEverything that's pending in the pipe is drawn in one go, followed by a single screen refresh.\n"
+	    "\tYou can also set FBINK_BATCH_MS in your environment to wait up to that many milliseconds for more input before refreshing.\n"
+	    "\tBefore each batch, FBInk checks whether the framebuffer's bitdepth or rotation changed, which costs an ioctl.\n"
+	    "\tPass -K, --watch to leave that to a background watcher instead, which only does it every 500ms (and on fb uevents),\n"
+	    "\tat the cost of noticing a change up to 500ms late, and of waking up that often even when idle. This also applies to the socket server.\n"
 	    "\tAlso, the daemon will NOT abort on FBInk errors, and it redirects stdout & stderr to /dev/null, so errors & bogus input will be silently ignored!\n"
 	    "\tIt can abort on early setup errors, though, before *or* after having redirected stderr...\n"
 	    "\tIt does enforce logging to the syslog, though, but, again, early commandline parsing errors may still be sent to stderr...\n"
+	    "\n"
+	    "NOTES:\n"
+	    "\tIf you need to drive FBInk from multiple processes, or need more than text, you can instead switch to socket server mode, via -U, --socket\n"
+	    "\tIt daemonizes exactly like daemon mode (see above), but listens on a UNIX stream socket: " FBINK_SOCKET
+	    " (set FBINK_SOCKET_PATH to an absolute path in your environment to use a custom one).\n"
+	    "\tAs with the named pipe, if the file already exists, FBInk will abort, and it will remove it on exit.\n"
+	    "\tClients speak a compact binary protocol (see fbink_socket.h), that maps requests to API calls, and replies with their return code, the last rect & the last marker.\n"
+	    "\tImages can be sent straight from a client's memory: pass a memfd alongside the request (via SCM_RIGHTS).\n"
+	    "\tSeal it with F_SEAL_SHRINK to spare the server a copy.\n"
+	    "\tClients can also ask for a shared back buffer, draw to it directly, and then just ask for the region they touched to be presented.\n"
+	    "\tIt can be combined with -t, --truetype to preload fonts, but with no other modes.\n"
 	    "\n",
 	    fbink_version());
 
@@ -418,6 +457,82 @@ static int
 	return 0;
 }
 
+// Read everything that's currently pending in the pipe, appending it to buf (which holds len bytes already).
+// NOTE: buf is FBINK_DAEMON_BUF_SIZE bytes large, and we always keep a spare byte to NUL-terminate a leftover message.
+// Flags is_framed as soon as a writer sends a NUL, i.e., once we can rely on messages being explicitly terminated.
+// Returns the amount of bytes read, or -1 on failure.
+static ssize_t
+    daemon_drain(int fd, char* buf, size_t* len, bool* is_framed)
+{
+	ssize_t total = 0;
+	while (*len < FBINK_DAEMON_BUF_SIZE - 1U) {
+		// Flawfinder: ignore
+		ssize_t bytes_read = read(fd, buf + *len, FBINK_DAEMON_BUF_SIZE - 1U - *len);
+		if (bytes_read == -1) {
+			if (errno == EINTR) {
+				continue;
+			}
+			if (errno == EAGAIN) {
+				break;
+			}
+			WARN("read: %m");
+			return -1;
+		}
+		if (bytes_read == 0) {
+			break;
+		}
+		if (!*is_framed && memchr(buf + *len, '\0', (size_t) bytes_read)) {
+			*is_framed = true;
+		}
+		*len += (size_t) bytes_read;
+		total += bytes_read;
+	}
+
+	return total;
+}
+
+// Split the next complete message out of buf, starting at pos.
+// Messages are NUL-terminated (and, in bar mode, LF-terminated, too), empty ones are skipped.
+// If want_leftover is set, whatever's left unterminated at the end of buf is considered a complete message, too.
+// Returns the message (NUL-terminated, in-place), or NULL once there aren't any left,
+// in which case whatever remains unconsumed is moved to the front of buf, and len & pos are updated accordingly.
+static char*
+    daemon_next_msg(char* buf, size_t* len, size_t* pos, bool is_bar, bool want_leftover)
+{
+	while (*pos < *len) {
+		char*        msg   = buf + *pos;
+		const size_t avail = *len - *pos;
+		char*        end   = memchr(msg, '\0', avail);
+		if (is_bar) {
+			char* lf = memchr(msg, '\n', end ? (size_t)(end - msg) : avail);
+			if (lf) {
+				end = lf;
+			}
+		}
+		if (!end) {
+			if (!want_leftover) {
+				break;
+			}
+			// NOTE: That's the spare byte daemon_drain kept for us ;).
+			end = buf + *len;
+		}
+		*end = '\0';
+		*pos = (size_t)(end - buf) + 1U;
+		if (*msg != '\0') {
+			return msg;
+		}
+	}
+
+	if (*pos < *len) {
+		memmove(buf, buf + *pos, *len - *pos);
+		*len -= *pos;
+	} else {
+		*len = 0U;
+	}
+	*pos = 0U;
+	return NULL;
+}
+
 // Truly infinite progress bar
 // NOTE: Punted off to a dedicated function to workaround an amazingly weird & obscure performance issue:
 //       keeping this inlined in main massively tanks *image* processing performance (by ~50%!),
@@ -543,6 +658,666 @@ static void
 	       last_rect.height);
 }
 
+// Socket server mode (c.f., fbink_socket.h)
+// Forget about a client (and whatever it might have left in flight)
+static void
+    socket_drop_client(FBInkSocketClient* client)
+{
+	if (client->fd != -1) {
+		close(client->fd);
+	}
+	if (client->data_fd != -1) {
+		close(client->data_fd);
+	}
+	free(client->payload);
+	for (uint8_t i = 0U; i < FBINK_SOCKET_MAX_LAYOUTS; i++) {
+		if (client->layouts[i]) {
+			fbink_free_ot_layout(client->layouts[i]);
+		}
+	}
+	*client = (FBInkSocketClient){ .fd = -1, .data_fd = -1 };
+}
+
+// Receive (part of) a client's current request.
+// Returns 1 once it's complete, 0 if we're still waiting for more, or a negative value if the client should be dropped.
+static int
+    socket_recv(FBInkSocketClient* client)
+{
+	const size_t   hdr_len = sizeof(client->req);
+	unsigned char* dst;
+	size_t         want;
+	if (client->got < hdr_len) {
+		dst  = (unsigned char*) &client->req + client->got;
+		want = hdr_len - client->got;
+	} else {
+		dst  = client->payload + (client->got - hdr_len);
+		want = hdr_len + client->req.len - client->got;
+	}
+
+	// NOTE: Only ask for what's left of the current request,
+	//       so that the next one stays in the socket's buffer for now.
+	struct iovec iov = { .iov_base = dst, .iov_len = want };
+	union
+	{
+		char           buf[CMSG_SPACE(sizeof(int))];
+		struct cmsghdr align;
+	} ctrl;
+	struct msghdr msg = {
+		.msg_iov        = &iov,
+		.msg_iovlen     = 1,
+		.msg_control    = ctrl.buf,
+		.msg_controllen = sizeof(ctrl.buf),
+	};
+	ssize_t bytes_read = recvmsg(client->fd, &msg, MSG_CMSG_CLOEXEC);
+	if (bytes_read == -1) {
+		if (errno == EAGAIN || errno == EINTR) {
+			return 0;
+		}
+		WARN("recvmsg: %m");
+		return -1;
+	}
+	// The client hung up
+	if (bytes_read == 0) {
+		return -1;
+	}
+	client->got += (size_t) bytes_read;
+
+	// Hang on to the fd that came along with the request, if any
+	for (struct cmsghdr* cmsg = CMSG_FIRSTHDR(&msg); cmsg != NULL; cmsg = CMSG_NXTHDR(&msg, cmsg)) {
+		if (cmsg->cmsg_level == SOL_SOCKET && cmsg->cmsg_type == SCM_RIGHTS) {
+			if (client->data_fd != -1) {
+				close(client->data_fd);
+			}
+			memcpy(&client->data_fd, CMSG_DATA(cmsg), sizeof(client->data_fd));
+		}
+	}
+
+	if (client->got < hdr_len) {
+		return 0;
+	}
+	// We've just got the full header, make sure it's sane, and make room for the payload
+	if (!client->payload) {
+		if (client->req.version != FBINK_SOCKET_VERSION) {
+			WARN("Client speaks protocol version %hu, but we only speak version %u",
+			     client->req.version,
+			     FBINK_SOCKET_VERSION);
+			return -1;
+		}
+		if (client->req.len > FBINK_SOCKET_MAX_PAYLOAD) {
+			WARN("Request payload is too large (%u bytes, max: %u)",
+			     client->req.len,
+			     FBINK_SOCKET_MAX_PAYLOAD);
+			return -1;
+		}
+		client->payload = calloc((size_t) client->req.len + 1U, sizeof(*client->payload));
+		if (!client->payload) {
+			WARN("calloc: %m");
+			return -1;
+		}
+	}
+
+	return client->got == hdr_len + client->req.len ? 1 : 0;
+}
+
+// Get at the pixel data a client sent alongside a SOCK_PRINT_RAW_DATA request
+// NOTE: We only map it if it's sealed against shrinking, as the client could otherwise truncate it while we read it,
+//       which would get us killed by a SIGBUS. If it isn't, we read a private copy of it instead.
+//       Either way, the buffer is ours to modify, since fbink_print_raw_data takes a non-const pointer.
+static unsigned char*
+    socket_get_raw_data(int fd, size_t len, bool* is_mapped)
+{
+	*is_mapped      = false;
+	const int seals = fcntl(fd, F_GET_SEALS);
+	if (seals != -1 && (seals & F_SEAL_SHRINK)) {
+		// NOTE: Copy-on-write ensures the client's data can never be modified behind its back.
+		unsigned char* data = mmap(NULL, len, PROT_READ | PROT_WRITE, MAP_PRIVATE, fd, 0);
+		if (data == MAP_FAILED) {
+			WARN("mmap: %m");
+			return NULL;
+		}
+		*is_mapped = true;
+		return data;
+	}
+
+	unsigned char* data = malloc(len);
+	if (!data) {
+		WARN("malloc: %m");
+		return NULL;
+	}
+	size_t got = 0U;
+	while (got < len) {
+		const ssize_t rc = pread(fd, data + got, len - got, (off_t) got);
+		if (rc == -1) {
+			if (errno == EINTR) {
+				continue;
+			}
+			WARN("pread: %m");
+			free(data);
+			return NULL;
+		}
+		if (rc == 0) {
+			WARN("Raw data fd was truncated (got %zu of %zu bytes)", got, len);
+			free(data);
+			return NULL;
+		}
+		got += (size_t) rc;
+	}
+	return data;
+}
+
+// Resolve the layout handle at the start of a client's current request (c.f., SOCK_SET_OT_LAYOUT_TEXT)
+// Returns a pointer to its slot, or NULL if it's not one of this client's.
+static FBInkOTLayout**
+    socket_get_layout(FBInkSocketClient* client)
+{
+	uint32_t handle;
+	if (client->req.len < sizeof(handle)) {
+		return NULL;
+	}
+	memcpy(&handle, client->payload, sizeof(handle));
+	if (handle == 0U || handle > FBINK_SOCKET_MAX_LAYOUTS || !client->layouts[handle - 1U]) {
+		WARN("Invalid OT layout handle %u", handle);
+		return NULL;
+	}
+	return &client->layouts[handle - 1U];
+}
+
+// Make the API call a client asked for, and reply with the results.
+// NOTE: fbink_cfg is what the server last used to init FBInk.
+static int
+    socket_handle_request(int fbfd, FBInkConfig* fbink_cfg, FBInkSocketClient* client)
+{
+	FBInkConfig*         cfg     = &client->req.fbink_cfg;
+	const size_t         len     = client->req.len;
+	const unsigned char* payload = client->payload;
+
+	// Logging is the server's business
+	cfg->is_verbose = fbink_cfg->is_verbose;
+	cfg->is_quiet   = fbink_cfg->is_quiet;
+	cfg->to_syslog  = fbink_cfg->to_syslog;
+	// Only do a full init if the client changed one of the fields that require it (c.f., fbink_init),
+	// otherwise, just make sure we're still up to date, as we might have been running for a while.
+	if (cfg->is_centered != fbink_cfg->is_centered || cfg->fontmult != fbink_cfg->fontmult ||
+	    cfg->fontname != fbink_cfg->fontname || cfg->fg_color != fbink_cfg->fg_color ||
+	    cfg->bg_color != fbink_cfg->bg_color || cfg->no_viewport != fbink_cfg->no_viewport) {
+		fbink_init(fbfd, cfg);
+		*fbink_cfg = *cfg;
+	} else {
+		fbink_reinit(fbfd, cfg);
+	}
+
+	FBInkSocketReply reply = { 0 };
+	union
+	{
+		FBInkOTFit        fit;
+		FBInkState        state;
+		FBInkSharedBuffer shared;
+		uint64_t          released;
+		uint32_t          handle;
+	} out           = { 0 };
+	size_t out_len  = 0U;
+	int    reply_fd = -1;
+	// NOTE: Payloads are NUL-terminated, so strings are safe to use as-is,
+	//       but structs are copied out, as the payload offers no alignment guarantees past its first byte.
+	switch (client->req.op) {
+		case SOCK_PRINT:
+			reply.rv = fbink_print(fbfd, (const char*) payload, cfg);
+			break;
+		case SOCK_PRINT_OT: {
+			FBInkOTConfig ot_cfg;
+			if (len < sizeof(ot_cfg)) {
+				reply.rv = ERRCODE(EINVAL);
+				break;
+			}
+			memcpy(&ot_cfg, payload, sizeof(ot_cfg));
+			reply.rv = fbink_print_ot(fbfd, (const char*) payload + sizeof(ot_cfg), &ot_cfg, cfg, &out.fit);
+			out_len  = sizeof(out.fit);
+			break;
+		}
+		case SOCK_PRINT_PROGRESS_BAR:
+		case SOCK_PRINT_ACTIVITY_BAR:
+			if (len < sizeof(uint8_t)) {
+				reply.rv = ERRCODE(EINVAL);
+				break;
+			}
+			if (client->req.op == SOCK_PRINT_PROGRESS_BAR) {
+				reply.rv = fbink_print_progress_bar(fbfd, *payload, cfg);
+			} else {
+				reply.rv = fbink_print_activity_bar(fbfd, *payload, cfg);
+			}
+			break;
+		case SOCK_PRINT_IMAGE: {
+			FBInkSocketImage img;
+			if (len < sizeof(img)) {
+				reply.rv = ERRCODE(EINVAL);
+				break;
+			}
+			memcpy(&img, payload, sizeof(img));
+			reply.rv =
+			    fbink_print_image(fbfd, (const char*) payload + sizeof(img), img.x_off, img.y_off, cfg);
+			break;
+		}
+		case SOCK_PRINT_RAW_DATA: {
+			FBInkSocketImage img;
+			struct stat      st;
+			if (len < sizeof(img) || client->data_fd == -1) {
+				reply.rv = ERRCODE(EINVAL);
+				break;
+			}
+			memcpy(&img, payload, sizeof(img));
+			// NOTE: fbink_print_raw_data divides len by w & h to figure out the amount of components,
+			//       (in an int), so make sure that'll be sane.
+			if (img.w <= 0 || img.h <= 0 || img.len < (uint64_t) img.w * (uint64_t) img.h ||
+			    img.len > INT_MAX) {
+				WARN("Invalid raw data geometry (%dx%d for %llu bytes)",
+				     img.w,
+				     img.h,
+				     (unsigned long long int) img.len);
+				reply.rv = ERRCODE(EINVAL);
+				break;
+			}
+			if (fstat(client->data_fd, &st) == -1 || (uint64_t) st.st_size < img.len) {
+				WARN("Raw data fd is too small (or unusable) for the requested %llu bytes",
+				     (unsigned long long int) img.len);
+				reply.rv = ERRCODE(EINVAL);
+				break;
+			}
+			bool           is_mapped;
+			unsigned char* data = socket_get_raw_data(client->data_fd, (size_t) img.len, &is_mapped);
+			if (!data) {
+				reply.rv = ERRCODE(EXIT_FAILURE);
+				break;
+			}
+			reply.rv =
+			    fbink_print_raw_data(fbfd, data, img.w, img.h, (size_t) img.len, img.x_off, img.y_off, cfg);
+			if (is_mapped) {
+				munmap(data, (size_t) img.len);
+			} else {
+				free(data);
+			}
+			break;
+		}
+		case SOCK_CLS:
+		case SOCK_PRESENT: {
+			FBInkRect rect;
+			if (len < sizeof(rect)) {
+				reply.rv = ERRCODE(EINVAL);
+				break;
+			}
+			memcpy(&rect, payload, sizeof(rect));
+			if (client->req.op == SOCK_CLS) {
+				reply.rv = fbink_cls(fbfd, cfg, &rect);
+			} else {
+				reply.rv = fbink_present(fbfd, &rect, cfg);
+			}
+			break;
+		}
+		case SOCK_REFRESH: {
+			FBInkSocketRefresh refresh;
+			if (len < sizeof(refresh)) {
+				reply.rv = ERRCODE(EINVAL);
+				break;
+			}
+			memcpy(&refresh, payload, sizeof(refresh));
+			reply.rv = fbink_refresh(fbfd,
+						 refresh.region_top,
+						 refresh.region_left,
+						 refresh.region_width,
+						 refresh.region_height,
+						 refresh.dithering_mode,
+						 cfg);
+			break;
+		}
+		case SOCK_WAIT_FOR_SUBMISSION:
+		case SOCK_WAIT_FOR_COMPLETE: {
+			uint32_t marker;
+			if (len < sizeof(marker)) {
+				reply.rv = ERRCODE(EINVAL);
+				break;
+			}
+			memcpy(&marker, payload, sizeof(marker));
+			if (client->req.op == SOCK_WAIT_FOR_SUBMISSION) {
+				reply.rv = fbink_wait_for_submission(fbfd, marker);
+			} else {
+				reply.rv = fbink_wait_for_complete(fbfd, marker);
+			}
+			break;
+		}
+		case SOCK_SET_DEFERRED_REFRESH:
+			if (len < sizeof(bool)) {
+				reply.rv = ERRCODE(EINVAL);
+				break;
+			}
+			reply.rv = fbink_set_deferred_refresh(fbfd, *payload != 0U);
+			break;
+		case SOCK_FLUSH:
+			reply.rv = fbink_flush(fbfd);
+			break;
+		case SOCK_REINIT:
+			// NOTE: We've already done that above ;).
+			reply.rv = EXIT_SUCCESS;
+			break;
+		case SOCK_GET_STATE:
+			fbink_get_state(cfg, &out.state);
+			reply.rv = EXIT_SUCCESS;
+			out_len  = sizeof(out.state);
+			break;
+		case SOCK_ADD_OT_FONT:
+			if (len < sizeof(uint8_t)) {
+				reply.rv = ERRCODE(EINVAL);
+				break;
+			}
+			reply.rv = fbink_add_ot_font((const char*) payload + sizeof(uint8_t), (FONT_STYLE_T) *payload);
+			break;
+		case SOCK_FREE_OT_FONTS:
+			reply.rv = fbink_free_ot_fonts();
+			break;
+		case SOCK_DUMP_TO_FILE: {
+			FBInkSocketDump req_dump;
+			if (len < sizeof(req_dump)) {
+				reply.rv = ERRCODE(EINVAL);
+				break;
+			}
+			memcpy(&req_dump, payload, sizeof(req_dump));
+			FBInkDump dump     = { 0 };
+			dump.is_compressed = req_dump.is_compressed;
+			if (req_dump.w == 0U || req_dump.h == 0U) {
+				reply.rv = fbink_dump(fbfd, &dump);
+			} else {
+				reply.rv = fbink_region_dump(
+				    fbfd, req_dump.x_off, req_dump.y_off, req_dump.w, req_dump.h, cfg, &dump);
+			}
+			if (reply.rv == EXIT_SUCCESS) {
+				reply.rv = fbink_dump_to_file(&dump, (const char*) payload + sizeof(req_dump));
+				fbink_free_dump_data(&dump);
+			}
+			break;
+		}
+		case SOCK_RESTORE_FROM_FILE:
+			reply.rv = fbink_restore_from_file(fbfd, cfg, (const char*) payload);
+			break;
+		case SOCK_GET_BACK_BUFFER:
+			reply.rv = fbink_get_back_buffer(fbfd);
+			break;
+		case SOCK_RELEASE_BACK_BUFFER:
+			reply.rv = fbink_release_back_buffer(fbfd);
+			break;
+		case SOCK_SHARE_BACK_BUFFER:
+			reply.rv = fbink_share_back_buffer(fbfd, &out.shared);
+			if (reply.rv == EXIT_SUCCESS) {
+				out_len  = sizeof(out.shared);
+				reply_fd = out.shared.fd;
+			}
+			break;
+		case SOCK_REFRESH_ASYNC: {
+			FBInkSocketRefresh refresh;
+			if (len < sizeof(refresh)) {
+				reply.rv = ERRCODE(EINVAL);
+				break;
+			}
+			memcpy(&refresh, payload, sizeof(refresh));
+			const uint32_t marker = fbink_refresh_async(fbfd,
+								    refresh.region_top,
+								    refresh.region_left,
+								    refresh.region_width,
+								    refresh.region_height,
+								    refresh.dithering_mode,
+								    cfg,
+								    NULL,
+								    NULL);
+			reply.rv              = (marker != LAST_MARKER) ? EXIT_SUCCESS : ERRCODE(EXIT_FAILURE);
+			break;
+		}
+		case SOCK_FIT_OT: {
+			FBInkSocketFitOT fit_req;
+			if (len < sizeof(fit_req)) {
+				reply.rv = ERRCODE(EINVAL);
+				break;
+			}
+			memcpy(&fit_req, payload, sizeof(fit_req));
+			reply.rv = fbink_fit_ot(fbfd,
+						(const char*) payload + sizeof(fit_req),
+						&fit_req.cfg,
+						cfg,
+						fit_req.max_lines,
+						fit_req.min_size_px,
+						fit_req.max_size_px,
+						&out.fit);
+			out_len  = sizeof(out.fit);
+			break;
+		}
+		case SOCK_SET_OT_CACHE_SIZE: {
+			uint64_t max_size;
+			if (len < sizeof(max_size)) {
+				reply.rv = ERRCODE(EINVAL);
+				break;
+			}
+			memcpy(&max_size, payload, sizeof(max_size));
+			// NOTE: It's a budget, so clamping it on 32-bit platforms is close enough to what was asked.
+			reply.rv = fbink_set_ot_cache_size(max_size > SIZE_MAX ? SIZE_MAX : (size_t) max_size);
+			break;
+		}
+		case SOCK_TRIM_SCRATCH:
+			out.released = (uint64_t) fbink_trim_scratch();
+			reply.rv     = EXIT_SUCCESS;
+			out_len      = sizeof(out.released);
+			break;
+		case SOCK_SET_IMAGE_THREADS:
+			if (len < sizeof(uint8_t)) {
+				reply.rv = ERRCODE(EINVAL);
+				break;
+			}
+			reply.rv = fbink_set_image_threads(*payload);
+			break;
+		case SOCK_NEW_OT_LAYOUT: {
+			FBInkOTConfig ot_cfg;
+			if (len < sizeof(ot_cfg)) {
+				reply.rv = ERRCODE(EINVAL);
+				break;
+			}
+			memcpy(&ot_cfg, payload, sizeof(ot_cfg));
+			uint32_t slot = 0U;
+			while (slot < FBINK_SOCKET_MAX_LAYOUTS && client->layouts[slot]) {
+				slot++;
+			}
+			if (slot == FBINK_SOCKET_MAX_LAYOUTS) {
+				WARN("Too many OT layouts for a single client (max: %u)", FBINK_SOCKET_MAX_LAYOUTS);
+				reply.rv = ERRCODE(ENOSPC);
+				break;
+			}
+			FBInkOTLayout* layout = NULL;
+			reply.rv              = fbink_new_ot_layout(&ot_cfg, &layout);
+			if (reply.rv == EXIT_SUCCESS) {
+				client->layouts[slot] = layout;
+				out.handle            = slot + 1U;
+				out_len               = sizeof(out.handle);
+			}
+			break;
+		}
+		case SOCK_SET_OT_LAYOUT_TEXT:
+		case SOCK_APPEND_OT_LAYOUT_TEXT:
+		case SOCK_RENDER_OT_LAYOUT:
+		case SOCK_FREE_OT_LAYOUT: {
+			FBInkOTLayout** layout = socket_get_layout(client);
+			if (!layout) {
+				reply.rv = ERRCODE(EINVAL);
+				break;
+			}
+			const char* string = (const char*) payload + sizeof(uint32_t);
+			if (client->req.op == SOCK_SET_OT_LAYOUT_TEXT) {
+				reply.rv = fbink_set_ot_layout_text(*layout, string, &out.fit);
+				out_len  = sizeof(out.fit);
+			} else if (client->req.op == SOCK_APPEND_OT_LAYOUT_TEXT) {
+				reply.rv = fbink_append_ot_layout_text(*layout, string, &out.fit);
+				out_len  = sizeof(out.fit);
+			} else if (client->req.op == SOCK_RENDER_OT_LAYOUT) {
+				reply.rv = fbink_render_ot_layout(fbfd, *layout, cfg);
+			} else {
+				reply.rv = fbink_free_ot_layout(*layout);
+				*layout  = NULL;
+			}
+			break;
+		}
+		default:
+			WARN("Unknown request op %hu", client->req.op);
+			reply.rv = ERRCODE(ENOTSUP);
+			break;
+	}
+	reply.marker    = fbink_get_last_marker();
+	reply.last_rect = fbink_get_last_rect();
+	reply.len       = (uint32_t) out_len;
+
+	// We're done with this request, make room for the next one
+	free(client->payload);
+	client->payload = NULL;
+	client->got     = 0U;
+	if (client->data_fd != -1) {
+		close(client->data_fd);
+		client->data_fd = -1;
+	}
+
+	// NOTE: Replies are tiny, so, unless a client stopped reading them altogether, they'll fit in the socket buffer.
+	//       If they don't, we drop the client instead of blocking everyone else.
+	struct iovec  iov[2] = { { .iov_base = &reply, .iov_len = sizeof(reply) },
+				 { .iov_base = &out, .iov_len = out_len } };
+	struct msghdr msg    = { .msg_iov = iov, .msg_iovlen = out_len ? 2 : 1 };
+	union
+	{
+		char           buf[CMSG_SPACE(sizeof(int))];
+		struct cmsghdr align;
+	} ctrl;
+	// Pass the fd along, if there's one (c.f., SOCK_SHARE_BACK_BUFFER)
+	if (reply_fd != -1) {
+		msg.msg_control      = ctrl.buf;
+		msg.msg_controllen   = sizeof(ctrl.buf);
+		struct cmsghdr* cmsg = CMSG_FIRSTHDR(&msg);
+		cmsg->cmsg_level     = SOL_SOCKET;
+		cmsg->cmsg_type      = SCM_RIGHTS;
+		cmsg->cmsg_len       = CMSG_LEN(sizeof(reply_fd));
+		memcpy(CMSG_DATA(cmsg), &reply_fd, sizeof(reply_fd));
+	}
+	ssize_t sent = sendmsg(client->fd, &msg, MSG_NOSIGNAL);
+	if (sent != (ssize_t)(sizeof(reply) + out_len)) {
+		if (sent == -1) {
+			WARN("sendmsg: %m");
+		} else {
+			WARN("Short write on a reply (%zd bytes out of %zu)", sent, sizeof(reply) + out_len);
+		}
+		return ERRCODE(EXIT_FAILURE);
+	}
+
+	return EXIT_SUCCESS;
+}
+
+// Serve API calls over a UNIX socket, until we're asked to die
+static int
+    socket_server(int fbfd, FBInkConfig* fbink_cfg, const char* socket_path)
+{
+	struct sockaddr_un addr = { .sun_family = AF_UNIX };
+	if (strlen(socket_path) >= sizeof(addr.sun_path)) {
+		WARN("Socket path '%s' is too long", socket_path);
+		return ERRCODE(ENAMETOOLONG);
+	}
+	strcpy(addr.sun_path, socket_path);    // Flawfinder: ignore
+
+	int sockfd = socket(AF_UNIX, SOCK_STREAM | SOCK_NONBLOCK | SOCK_CLOEXEC, 0);
+	if (sockfd == -1) {
+		WARN("socket: %m");
+		return ERRCODE(EXIT_FAILURE);
+	}
+	// NOTE: Like with the named pipe, we refuse to reuse an existing file, since it might not be ours...
+	if (bind(sockfd, (const struct sockaddr*) &addr, sizeof(addr)) == -1) {
+		WARN("bind(%s): %m", socket_path);
+		close(sockfd);
+		return ERRCODE(EXIT_FAILURE);
+	}
+
+	int                rv = EXIT_SUCCESS;
+	FBInkSocketClient  clients[FBINK_SOCKET_MAX_CLIENTS];
+	struct pollfd      pfds[FBINK_SOCKET_MAX_CLIENTS + 1U];
+	for (uint8_t i = 0U; i < FBINK_SOCKET_MAX_CLIENTS; i++) {
+		clients[i] = (FBInkSocketClient){ .fd = -1, .data_fd = -1 };
+	}
+	if (listen(sockfd, SOMAXCONN) == -1) {
+		WARN("listen: %m");
+		rv = ERRCODE(EXIT_FAILURE);
+		goto cleanup;
+	}
+
+	// Forevah'!
+	while (1) {
+		// If we caught one of the signals we setup earlier, it's time to die ;).
+		if (g_timeToDie != 0) {
+			ELOG("Caught a cleanup signal (%s by UID: %ld, PID: %ld), winding down . . .",
+			     strsignal(g_sigCaught.signo),
+			     (long int) g_sigCaught.uid,
+			     (long int) g_sigCaught.pid);
+			break;
+		}
+
+		// NOTE: poll simply ignores negative fds, i.e., free client slots.
+		pfds[0] = (struct pollfd){ .fd = sockfd, .events = POLLIN };
+		for (uint8_t i = 0U; i < FBINK_SOCKET_MAX_CLIENTS; i++) {
+			pfds[i + 1U] = (struct pollfd){ .fd = clients[i].fd, .events = POLLIN };
+		}
+		int pn = poll(pfds, FBINK_SOCKET_MAX_CLIENTS + 1U, -1);
+		if (pn == -1) {
+			if (errno == EINTR) {
+				continue;
+			}
+			WARN("poll: %m");
+			rv = ERRCODE(EXIT_FAILURE);
+			break;
+		}
+
+		// New client?
+		if (pfds[0].revents & POLLIN) {
+			int client_fd = accept4(sockfd, NULL, NULL, SOCK_NONBLOCK | SOCK_CLOEXEC);
+			if (client_fd == -1) {
+				if (errno != EAGAIN && errno != EINTR) {
+					WARN("accept4: %m");
+				}
+			} else {
+				uint8_t i = 0U;
+				while (i < FBINK_SOCKET_MAX_CLIENTS && clients[i].fd != -1) {
+					i++;
+				}
+				if (i == FBINK_SOCKET_MAX_CLIENTS) {
+					WARN("Too many clients, rejecting a new connection");
+					close(client_fd);
+				} else {
+					clients[i].fd = client_fd;
+				}
+			}
+		}
+
+		for (uint8_t i = 0U; i < FBINK_SOCKET_MAX_CLIENTS; i++) {
+			if (!(pfds[i + 1U].revents & (POLLIN | POLLHUP | POLLERR))) {
+				continue;
+			}
+			// NOTE: On POLLHUP, the read will flush what's left, and then see the EOF.
+			int ready = socket_recv(&clients[i]);
+			if (ready < 0 ||
+			    (ready > 0 && socket_handle_request(fbfd, fbink_cfg, &clients[i]) != EXIT_SUCCESS)) {
+				socket_drop_client(&clients[i]);
+			}
+		}
+	}
+
+cleanup:
+	for (uint8_t i = 0U; i < FBINK_SOCKET_MAX_CLIENTS; i++) {
+		socket_drop_client(&clients[i]);
+	}
+	// Let the updates clients sent via SOCK_REFRESH_ASYNC complete (this is a no-op if there weren't any)
+	fbink_stop_refresh_worker();
+	close(sockfd);
+	if (unlink(socket_path) != 0) {
+		WARN("unlink(%s): %m", socket_path);
+	}
+
+	return rv;
+}
+
 // Input validation via strtoul, for an uint32_t
 // Adapted from the same in KFMon ;).
 static int
@@ -636,6 +1411,10 @@ int
                                               { "wait", no_argument, NULL, 'w' },
                                               { "daemon", required_argument, NULL, 'd' },
                                               { "syslog", no_argument, NULL, 'G' },
+                                              { "dump", required_argument, NULL, 'j' },
+                                              { "restore", required_argument, NULL, 'J' },
+                                              { "socket", no_argument, NULL, 'U' },
+                                              { "watch", no_argument, NULL, 'K' },
                                               { NULL, 0, NULL, 0 } };
 
 	FBInkConfig fbink_cfg = { 0 };
@@ -736,8 +1515,12 @@ int
 	bool        is_infinite    = false;
 	bool        is_mimic       = false;
 	bool        is_cls         = false;
+	const char* dump_file      = NULL;
+	const char* restore_file   = NULL;
 	const char* pipe_path      = NULL;
 	bool        is_daemon      = false;
+	bool        is_socket      = false;
+	bool        want_watcher   = false;
 	uint8_t     daemon_lines   = 0U;
 	bool        wait_for       = false;
 	uint8_t     progress       = 0;
@@ -749,9 +1532,11 @@ int
 	bool        errfnd         = false;
 
 	// NOTE: c.f., https://codegolf.stackexchange.com/q/148228 to sort this mess when I need to find an available letter ;p
-	while ((opt = getopt_long(
-		    argc, argv, "y:x:Y:X:hfcmMprs::S:F:vqg:i:aeIC:B:LlP:A:oOTVt:bDW:HEZk::wd:G", opts, &opt_index)) !=
-	       -1) {
+	while ((opt = getopt_long(argc,
+				  argv,
+				  "y:x:Y:X:hfcmMprs::S:F:vqg:i:aeIC:B:LlP:A:oOTVt:bDW:HEZk::wd:Gj:J:UK",
+				  opts,
+				  &opt_index)) != -1) {
 		switch (opt) {
 			case 'y':
 				if (strtol_hi(opt, NULL, optarg, &fbink_cfg.row) < 0) {
@@ -1732,6 +2517,18 @@ int
 				fbink_cfg.to_syslog = !fbink_cfg.to_syslog;
 				toSysLog            = fbink_cfg.to_syslog;
 				break;
+			case 'j':
+				dump_file = optarg;
+				break;
+			case 'J':
+				restore_file = optarg;
+				break;
+			case 'U':
+				is_socket = true;
+				break;
+			case 'K':
+				want_watcher = true;
+				break;
 			default:
 				ELOG("?? Unknown option code 0%o ??", (unsigned int) opt);
 				errfnd = true;
@@ -1741,8 +2538,8 @@ int
 		opt_index = -1;
 	}
 
-	// Enforce logging to syslog for is_daemon
-	if (is_daemon) {
+	// Enforce logging to syslog for is_daemon & is_socket
+	if (is_daemon || is_socket) {
 		fbink_cfg.to_syslog = true;
 		toSysLog            = true;
 	}
@@ -1769,15 +2566,31 @@ int
 
 	// Error out if daemon mode is enabled with incompatible options
 	// (basically anything that isn't is_truetype, is_*bar or nothing).
-	if (is_daemon &&
-	    (is_image || want_linecode || want_linecount || want_lastrect || is_eval || is_interactive || is_cls)) {
+	if (is_daemon && (is_image || want_linecode || want_linecount || want_lastrect || is_eval || is_interactive ||
+			  is_cls || dump_file || restore_file)) {
 		WARN("Incompatible options: -d, --daemon can only be used for simple text or bar only workflows");
 		errfnd = true;
 	}
 
-	// Enforce quiet output when asking for is_daemon, is_mimic, is_eval, want_linecount or want_lastrect,
+	// Same idea for the socket server, which only takes its orders from its clients
+	// (only is_truetype makes sense, to preload fonts).
+	if (is_socket && (is_daemon || is_image || is_progressbar || is_activitybar || want_linecode ||
+			  want_linecount || want_lastrect || is_eval || is_interactive || is_mimic || is_cls ||
+			  dump_file || restore_file)) {
+		WARN("Incompatible options: -U, --socket cannot be used in conjunction with any other mode");
+		errfnd = true;
+	}
+
+	// The layout watcher only makes sense for long-running modes.
+	if (want_watcher && !is_daemon && !is_socket) {
+		WARN(
+		    "Incompatible options: -K, --watch can only be used in conjunction with -d, --daemon or -U, --socket");
+		errfnd = true;
+	}
+
+	// Enforce quiet output when asking for is_daemon, is_socket, is_mimic, is_eval, want_linecount or want_lastrect,
 	// to avoid polluting the output...
-	if (is_daemon | is_mimic || is_eval || want_linecount || want_lastrect) {
+	if (is_daemon || is_socket || is_mimic || is_eval || want_linecount || want_lastrect) {
 		fbink_cfg.is_quiet   = true;
 		fbink_cfg.is_verbose = false;
 	}
@@ -1787,8 +2600,9 @@ int
 	// Declare it a tiny bit early to make cleanup handling safe
 	// (fbink_close is safe to call with fbfd set to -1 and/or the mmap not actually done).
 	int fbfd = -1;
-	// Same idea for the pipe fd in daemon mode
-	int pipefd = -1;
+	// Same idea for the pipe fd & input buffer in daemon mode
+	int   pipefd     = -1;
+	char* daemon_buf = NULL;
 
 	// Don't abort if we piped something without passing any arguments!
 	if (errfnd || (argc == 1 && isatty(fileno(stdin)))) {
@@ -1874,6 +2688,30 @@ int
 		goto cleanup;
 	}
 
+	// Same idea for dumping the screen to a file...
+	if (dump_file) {
+		FBInkDump dump = { 0 };
+		rv             = fbink_dump(fbfd, &dump);
+		if (rv == EXIT_SUCCESS) {
+			rv = fbink_dump_to_file(&dump, dump_file);
+			fbink_free_dump_data(&dump);
+		}
+		goto cleanup;
+	}
+
+	// ... or restoring one.
+	if (restore_file) {
+		rv = fbink_restore_from_file(fbfd, &fbink_cfg, restore_file);
+
+		if (wait_for) {
+#ifdef FBINK_FOR_KINDLE
+			rv = fbink_wait_for_submission(fbfd, LAST_MARKER);
+#endif
+			rv = fbink_wait_for_complete(fbfd, LAST_MARKER);
+		}
+		goto cleanup;
+	}
+
 	// If we're asking to mimic on-animator, set the relevant options...
 	if (is_mimic) {
 		// We'll need to know a few things about the current device...
@@ -1894,8 +2732,8 @@ int
 		is_infinite    = true;
 	}
 
-	// If we're asking to run in daemon mode, that takes precedence over nearly everything.
-	if (is_daemon) {
+	// If we're asking to run in daemon or socket mode, that takes precedence over nearly everything.
+	if (is_daemon || is_socket) {
 		// Fly, little daemon!
 		if (daemonize() != 0) {
 			WARN("Failed to daemonize, aborting");
@@ -1921,6 +2759,33 @@ int
 			goto cleanup;
 		}
 
+#ifndef FBINK_FOR_KINDLE
+		// We call fbink_reinit before every batch, let a watcher tell us when it actually needs to do anything,
+		// if we were asked to.
+		// NOTE: It's opt-in, because it trades the ioctl for up to 500ms of latency on a layout change,
+		//       and for regular wakeups when we're otherwise idle.
+		// NOTE: If that fails, fbink_reinit simply keeps checking by itself.
+		if (want_watcher) {
+			fbink_start_fb_watcher(0);
+		}
+#endif
+
+		// The socket server has its own event loop, everything happens in there.
+		if (is_socket) {
+			// Make sure we only load fonts once...
+			if (is_truetype) {
+				load_ot_fonts(reg_ot_file, bd_ot_file, it_ot_file, bdit_ot_file, &fbink_cfg);
+			}
+
+			// If we want to use a custom socket path, honor that...
+			const char* socket_path = getenv("FBINK_SOCKET_PATH");
+			if (!socket_path) {
+				socket_path = FBINK_SOCKET;
+			}
+			rv = socket_server(fbfd, &fbink_cfg, socket_path);
+			goto cleanup;
+		}
+
 		// If we want to use a custom pipe name, honor that...
 		const char* custom_pipe = getenv("FBINK_NAMED_PIPE");
 		if (custom_pipe) {
@@ -1962,6 +2827,31 @@ int
 		short int          initial_row = fbink_cfg.row;
 		short int          initial_top = ot_config.margins.top;
 
+		// Pending input, until we've got complete messages to render (c.f., daemon_next_msg)
+		daemon_buf = malloc(FBINK_DAEMON_BUF_SIZE);
+		if (!daemon_buf) {
+			WARN("malloc: %m");
+			rv = ERRCODE(EXIT_FAILURE);
+			goto cleanup;
+		}
+		size_t daemon_len = 0U;
+		bool   is_framed  = false;
+
+		// Batch window: how long we're willing to keep waiting for more input before refreshing, in ms.
+		uint32_t    batch_ms  = 0U;
+		const char* batch_env = getenv("FBINK_BATCH_MS");
+		if (batch_env && strtoul_u('d', NULL, batch_env, &batch_ms) < 0) {
+			WARN("Ignoring invalid FBINK_BATCH_MS value");
+			batch_ms = 0U;
+		}
+		// poll takes an int ;).
+		if (batch_ms > INT_MAX) {
+			batch_ms = INT_MAX;
+		}
+
+		// Refreshes are only sent once per batch (c.f., fbink_flush below).
+		fbink_set_deferred_refresh(fbfd, true);
+
 		struct pollfd pfd;
 		pfd.fd     = pipefd;
 		pfd.events = POLLIN;
@@ -1986,34 +2876,58 @@ int
 				goto cleanup;
 			}
 
-			if (pn > 0) {
-				if (pfd.revents & POLLIN) {
-					// We've got data to read, do it!
-					char buf[PIPE_BUF] = { 0 };
-					// Flawfinder: ignore
-					ssize_t bytes_read = read(pfd.fd, buf, sizeof(buf));
-					if (bytes_read == -1 && errno != EAGAIN) {
-						if (errno == EINTR) {
-							continue;
-						}
-						WARN("read: %m");
-						rv = ERRCODE(EXIT_FAILURE);
-						goto cleanup;
-					}
-
-					// The poll should have ensured we have something to read, but, just in case...
-					if (bytes_read <= 0) {
-						continue;
-					}
+			// NOTE: The first writer will invariably end up closing its end of the pipe.
+			//       This means POLLHUP will be set from that point on,
+			//       and the only way to clear it would be to close our reader...
+			//       We don't want to do that, so, just ignore POLLHUP,
+			//       and prevent it from ever happening in the first place,
+			//       by ensuring we ourselves are considered as a writer (by opening the pipe RDWR) ;).
+			if (pn == 0 || !(pfd.revents & POLLIN)) {
+				continue;
+			}
 
-					// First things first, do an explicit reinit, as we might have been running for a while.
-					fbink_reinit(fbfd, &fbink_cfg);
+			// First things first, do an explicit reinit, as we might have been running for a while.
+			// NOTE: Once per batch is plenty.
+			fbink_reinit(fbfd, &fbink_cfg);
+
+			// Then, render everything that comes in until the pipe goes quiet, or the batch window closes,
+			// and only refresh the screen once we're done.
+			struct timespec batch_start;
+			clock_gettime(CLOCK_MONOTONIC, &batch_start);
+			bool is_batch_done = false;
+			while (!is_batch_done) {
+				if (daemon_drain(pipefd, daemon_buf, &daemon_len, &is_framed) == -1) {
+					rv = ERRCODE(EXIT_FAILURE);
+					goto cleanup;
+				}
 
+				// Is it time to close the batch?
+				struct timespec now;
+				clock_gettime(CLOCK_MONOTONIC, &now);
+				const long int elapsed_ms = (now.tv_sec - batch_start.tv_sec) * 1000L +
+							    (now.tv_nsec - batch_start.tv_nsec) / 1000000L;
+				const long int left_ms = (long int) batch_ms - elapsed_ms;
+				is_batch_done          = left_ms <= 0 || poll(&pfd, 1, (int) left_ms) <= 0;
+
+				// Render every complete message we've got so far.
+				// NOTE: Once the batch is done, an unterminated leftover counts as complete,
+				//       unless writers have shown they're using NUL-terminated messages,
+				//       in which case it's most likely the first half of a write larger than PIPE_BUF...
+				//       (Unless it filled the buffer, as no terminator will ever fit anymore).
+				const bool want_leftover = (is_batch_done && !is_framed) ||
+							   daemon_len >= FBINK_DAEMON_BUF_SIZE - 1U;
+				size_t     daemon_pos    = 0U;
+				char*      msg;
+				while ((msg = daemon_next_msg(daemon_buf,
+							      &daemon_len,
+							      &daemon_pos,
+							      is_progressbar || is_activitybar,
+							      want_leftover)) != NULL) {
 					// NOTE: In every case, we *ignore* errors in order not to silently die on bogus input...
 					// If we're drawing a bar, make sure we were fed vaguely valid input...
 					if (is_progressbar || is_activitybar) {
 						uint8_t bar_val = 0U;
-						if (strtoul_hhu('d', NULL, buf, &bar_val) == 0) {
+						if (strtoul_hhu('d', NULL, msg, &bar_val) == 0) {
 							// It's a number, let the API deal with OOB values.
 							if (is_progressbar) {
 								fbink_print_progress_bar(fbfd, bar_val, &fbink_cfg);
@@ -2022,7 +2936,7 @@ int
 							}
 						}
 					} else if (is_truetype) {
-						linecount = fbink_print_ot(fbfd, buf, &ot_config, &fbink_cfg, &ot_fit);
+						linecount = fbink_print_ot(fbfd, msg, &ot_config, &fbink_cfg, &ot_fit);
 
 						// Move to the next line, unless it'd make us blow past daemon_lines...
 						total_lines = (unsigned short int) (total_lines + ot_fit.rendered_lines);
@@ -2035,7 +2949,7 @@ int
 							ot_config.margins.top = (short int) initial_top;
 						}
 					} else {
-						linecount = fbink_print(fbfd, buf, &fbink_cfg);
+						linecount = fbink_print(fbfd, msg, &fbink_cfg);
 
 						// Move to the next line, unless it'd make us blow past daemon_lines...
 						if (linecount > 0) {
@@ -2051,13 +2965,10 @@ int
 						}
 					}
 				}
-				// NOTE: The first writer will invariably end up closing its end of the pipe.
-				//       This means POLLHUP will be set from that point on,
-				//       and the only way to clear it would be to close our reader...
-				//       We don't want to do that, so, just ignore POLLHUP,
-				//       and prevent it from ever happening in the first place,
-				//       by ensuring we ourselves are considered as a writer (by opening the pipe RDWR) ;).
 			}
+
+			// Refresh everything we've drawn in one go (the deferred queue merges adjacent regions).
+			fbink_flush(fbfd);
 		}
 
 		// Unreachable ;).
@@ -2596,6 +3507,12 @@ cleanup:
 				WARN("unlink(%s): %m", pipe_path);
 			}
 		}
+		free(daemon_buf);
+#ifndef FBINK_FOR_KINDLE
+		if (want_watcher) {
+			fbink_stop_fb_watcher();
+		}
+#endif
 	}
 
 	if (fbink_close(fbfd) == ERRCODE(EXIT_FAILURE)) {
@@ -23,6 +23,7 @@
 #define __FBINK_CMD_H
 
 #include "fbink.h"
+#include "fbink_socket.h"
 
 #include <alloca.h>
 #include <errno.h>
@@ -37,8 +38,11 @@
 #include <string.h>
 #include <strings.h>
 #include <sys/ioctl.h>
+#include <sys/mman.h>
+#include <sys/socket.h>
 #include <sys/stat.h>
 #include <sys/types.h>
+#include <sys/un.h>
 #include <syslog.h>
 #include <time.h>
 #include <unistd.h>
@@ -116,8 +120,41 @@ FBInkSigInfo g_sigCaught = { 0 };
 static void  cleanup_handler(int __attribute__((unused)), siginfo_t*, void* __attribute__((unused)));
 static int   daemonize(void);
 
+// Daemon mode input handling
+// How much pending input we're willing to buffer (i.e., the largest message we can handle)
+#define FBINK_DAEMON_BUF_SIZE (64U * 1024U)
+static ssize_t daemon_drain(int, char*, size_t*, bool*);
+static char*   daemon_next_msg(char*, size_t*, size_t*, bool, bool);
+
 static int do_infinite_progress_bar(int, const FBInkConfig*);
 
+// Socket server mode (c.f., fbink_socket.h)
+// How many clients can be connected at the same time
+#define FBINK_SOCKET_MAX_CLIENTS 8U
+// Where we are in the reception of a client's current request
+typedef struct
+{
+	int                fd;
+	int                data_fd;    // fd received alongside the current request (via SCM_RIGHTS), if any
+	FBInkSocketRequest req;
+	unsigned char*     payload;    // req.len bytes, plus a NUL, so that string payloads are always terminated
+	size_t             got;        // How much of the request (header, then payload) we've received so far
+	FBInkOTLayout*     layouts[FBINK_SOCKET_MAX_LAYOUTS];    // The ones it created, indexed by handle - 1
+} FBInkSocketClient;
+// For TCs whose headers predate memfd sealing (Linux 3.17)
+#ifndef F_GET_SEALS
+#	define F_GET_SEALS (1024 + 10)
+#endif
+#ifndef F_SEAL_SHRINK
+#	define F_SEAL_SHRINK 0x0002
+#endif
+static void           socket_drop_client(FBInkSocketClient*);
+static int            socket_recv(FBInkSocketClient*);
+static unsigned char* socket_get_raw_data(int, size_t, bool*);
+static FBInkOTLayout** socket_get_layout(FBInkSocketClient*);
+static int            socket_handle_request(int, FBInkConfig*, FBInkSocketClient*);
+static int            socket_server(int, FBInkConfig*, const char*);
+
 static void load_ot_fonts(const char*, const char*, const char*, const char*, const FBInkConfig*);
 
 FBInkRect   totalRect = { 0U };
@@ -0,0 +1,555 @@
+/*
+	FBInk: FrameBuffer eInker, a tool to print text & images on eInk devices (Kobo/Kindle)
+	Copyright (C) 2018-2020 NiLuJe <ninuje@gmail.com>
+	SPDX-License-Identifier: GPL-3.0-or-later
+
+	----
+
+	This program is free software: you can redistribute it and/or modify
+	it under the terms of the GNU General Public License as published by
+	the Free Software Foundation, either version 3 of the License, or
+	(at your option) any later version.
+
+	This program is distributed in the hope that it will be useful,
+	but WITHOUT ANY WARRANTY; without even the implied warranty of
+	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+	GNU General Public License for more details.
+
+	You should have received a copy of the GNU General Public License
+	along with this program.  If not, see <https://www.gnu.org/licenses/>.
+*/
+
+#include "fbink_context.h"
+
+// Make ctx (NULL being the default one) the current context of the calling thread, for the duration of an API call
+// NOTE: Returns the previous one, to be passed to leave_context.
+static FBInkContext*
+    enter_context(FBInkContext* ctx)
+{
+	if (!ctx) {
+		ctx = &defaultContext;
+	}
+
+	pthread_mutex_lock(&ctx->lock);
+	FBInkContext* prev = currentContext;
+	currentContext     = ctx;
+
+	return prev;
+}
+
+// And put the previous one back afterwards
+static void
+    leave_context(FBInkContext* prev)
+{
+	FBInkContext* ctx = currentContext;
+	currentContext    = prev;
+	pthread_mutex_unlock(&ctx->lock);
+}
+
+// Allocate a new context, in the same state as the default one before its first fbink_init
+FBInkContext*
+    fbink_new_context(void)
+{
+	FBInkContext* ctx = malloc(sizeof(*ctx));
+	if (!ctx) {
+		WARN("malloc: %m");
+		return NULL;
+	}
+
+	*ctx = pristineContext;
+	pthread_mutex_init(&ctx->lock, NULL);
+
+	return ctx;
+}
+
+// Release everything a context holds, and the context itself
+int
+    fbink_free_context(FBInkContext* ctx)
+{
+	if (!ctx || ctx == &defaultContext) {
+		WARN("Cannot free the default context");
+		return ERRCODE(EINVAL);
+	}
+
+	FBInkContext* prev = enter_context(ctx);
+	// That takes care of the fb mapping, the back buffer, and the canvas
+	int rv = fbink_close(FBFD_AUTO);
+	flush_glyph_cache();
+#ifdef FBINK_WITH_OPENTYPE
+	fbink_free_ot_fonts();
+#endif
+	fbink_trim_scratch();
+	free(spanGrayBuff);
+	free(spanPixelBuff);
+	leave_context(prev);
+
+	pthread_mutex_destroy(&ctx->lock);
+	free(ctx);
+	return rv;
+}
+
+// And now, the actual API, on the requested context...
+int
+    fbink_init_ctx(FBInkContext* ctx, int fbfd, const FBInkConfig* restrict fbink_cfg)
+{
+	FBInkContext* prev = enter_context(ctx);
+	const int     rv   = fbink_init(fbfd, fbink_cfg);
+	leave_context(prev);
+
+	return rv;
+}
+
+int
+    fbink_reinit_ctx(FBInkContext* ctx, int fbfd, const FBInkConfig* restrict fbink_cfg)
+{
+	FBInkContext* prev = enter_context(ctx);
+	const int     rv   = fbink_reinit(fbfd, fbink_cfg);
+	leave_context(prev);
+
+	return rv;
+}
+
+int
+    fbink_open_canvas_ctx(FBInkContext* ctx, uint32_t width, uint32_t height, uint8_t bpp, uint8_t rota)
+{
+	FBInkContext* prev = enter_context(ctx);
+	const int     rv   = fbink_open_canvas(width, height, bpp, rota);
+	leave_context(prev);
+
+	return rv;
+}
+
+int
+    fbink_get_canvas_info_ctx(FBInkContext* ctx, FBInkCanvas* restrict canvas, bool reset_damage)
+{
+	FBInkContext* prev = enter_context(ctx);
+	const int     rv   = fbink_get_canvas_info(canvas, reset_damage);
+	leave_context(prev);
+
+	return rv;
+}
+
+int
+    fbink_close_ctx(FBInkContext* ctx, int fbfd)
+{
+	FBInkContext* prev = enter_context(ctx);
+	const int     rv   = fbink_close(fbfd);
+	leave_context(prev);
+
+	return rv;
+}
+
+void
+    fbink_state_dump_ctx(FBInkContext* ctx, const FBInkConfig* restrict fbink_cfg)
+{
+	FBInkContext* prev = enter_context(ctx);
+	fbink_state_dump(fbink_cfg);
+	leave_context(prev);
+}
+
+void
+    fbink_get_state_ctx(FBInkContext* ctx, const FBInkConfig* restrict fbink_cfg, FBInkState* restrict fbink_state)
+{
+	FBInkContext* prev = enter_context(ctx);
+	fbink_get_state(fbink_cfg, fbink_state);
+	leave_context(prev);
+}
+
+int
+    fbink_add_ot_font_ctx(FBInkContext* ctx, const char* filename, FONT_STYLE_T style)
+{
+	FBInkContext* prev = enter_context(ctx);
+	const int     rv   = fbink_add_ot_font(filename, style);
+	leave_context(prev);
+
+	return rv;
+}
+
+int
+    fbink_free_ot_fonts_ctx(FBInkContext* ctx)
+{
+	FBInkContext* prev = enter_context(ctx);
+	const int     rv   = fbink_free_ot_fonts();
+	leave_context(prev);
+
+	return rv;
+}
+
+int
+    fbink_set_ot_cache_size_ctx(FBInkContext* ctx, size_t max_size)
+{
+	FBInkContext* prev = enter_context(ctx);
+	const int     rv   = fbink_set_ot_cache_size(max_size);
+	leave_context(prev);
+
+	return rv;
+}
+
+int
+    fbink_get_ot_cache_stats_ctx(FBInkContext* ctx, FBInkOTCacheStats* restrict stats)
+{
+	FBInkContext* prev = enter_context(ctx);
+	const int     rv   = fbink_get_ot_cache_stats(stats);
+	leave_context(prev);
+
+	return rv;
+}
+
+size_t
+    fbink_trim_scratch_ctx(FBInkContext* ctx)
+{
+	FBInkContext* prev = enter_context(ctx);
+	const size_t  len  = fbink_trim_scratch();
+	leave_context(prev);
+
+	return len;
+}
+
+int
+    fbink_print_ctx(FBInkContext* ctx, int fbfd, const char* restrict string, const FBInkConfig* fbink_cfg)
+{
+	FBInkContext* prev = enter_context(ctx);
+	const int     rv   = fbink_print(fbfd, string, fbink_cfg);
+	leave_context(prev);
+
+	return rv;
+}
+
+int
+    fbink_print_ot_ctx(FBInkContext*                 ctx,
+		       int                           fbfd,
+		       const char* restrict          string,
+		       const FBInkOTConfig* restrict cfg,
+		       const FBInkConfig* restrict   fbink_cfg,
+		       FBInkOTFit* restrict          fit)
+{
+	FBInkContext* prev = enter_context(ctx);
+	const int     rv   = fbink_print_ot(fbfd, string, cfg, fbink_cfg, fit);
+	leave_context(prev);
+
+	return rv;
+}
+
+int
+    fbink_fit_ot_ctx(FBInkContext*                 ctx,
+		     int                           fbfd,
+		     const char* restrict          string,
+		     const FBInkOTConfig* restrict cfg,
+		     const FBInkConfig* restrict   fbink_cfg,
+		     unsigned short int            max_lines,
+		     unsigned short int            min_size_px,
+		     unsigned short int            max_size_px,
+		     FBInkOTFit* restrict          fit)
+{
+	FBInkContext* prev = enter_context(ctx);
+	const int     rv   = fbink_fit_ot(fbfd, string, cfg, fbink_cfg, max_lines, min_size_px, max_size_px, fit);
+	leave_context(prev);
+
+	return rv;
+}
+
+int
+    fbink_new_ot_layout_ctx(FBInkContext* ctx, const FBInkOTConfig* restrict cfg, FBInkOTLayout** restrict layout)
+{
+	FBInkContext* prev = enter_context(ctx);
+	const int     rv   = fbink_new_ot_layout(cfg, layout);
+	leave_context(prev);
+
+	return rv;
+}
+
+int
+    fbink_set_ot_layout_text_ctx(FBInkContext*           ctx,
+				 FBInkOTLayout* restrict layout,
+				 const char* restrict    string,
+				 FBInkOTFit* restrict    fit)
+{
+	FBInkContext* prev = enter_context(ctx);
+	const int     rv   = fbink_set_ot_layout_text(layout, string, fit);
+	leave_context(prev);
+
+	return rv;
+}
+
+int
+    fbink_append_ot_layout_text_ctx(FBInkContext*           ctx,
+				    FBInkOTLayout* restrict layout,
+				    const char* restrict    string,
+				    FBInkOTFit* restrict    fit)
+{
+	FBInkContext* prev = enter_context(ctx);
+	const int     rv   = fbink_append_ot_layout_text(layout, string, fit);
+	leave_context(prev);
+
+	return rv;
+}
+
+int
+    fbink_render_ot_layout_ctx(FBInkContext*               ctx,
+			       int                         fbfd,
+			       FBInkOTLayout* restrict     layout,
+			       const FBInkConfig* restrict fbink_cfg)
+{
+	FBInkContext* prev = enter_context(ctx);
+	const int     rv   = fbink_render_ot_layout(fbfd, layout, fbink_cfg);
+	leave_context(prev);
+
+	return rv;
+}
+
+int
+    fbink_refresh_ctx(FBInkContext*               ctx,
+		      int                         fbfd,
+		      uint32_t                    region_top,
+		      uint32_t                    region_left,
+		      uint32_t                    region_width,
+		      uint32_t                    region_height,
+		      uint8_t                     dithering_mode,
+		      const FBInkConfig* restrict fbink_cfg)
+{
+	FBInkContext* prev = enter_context(ctx);
+	const int     rv =
+	    fbink_refresh(fbfd, region_top, region_left, region_width, region_height, dithering_mode, fbink_cfg);
+	leave_context(prev);
+
+	return rv;
+}
+
+int
+    fbink_wait_for_submission_ctx(FBInkContext* ctx, int fbfd, uint32_t marker)
+{
+	FBInkContext* prev = enter_context(ctx);
+	const int     rv   = fbink_wait_for_submission(fbfd, marker);
+	leave_context(prev);
+
+	return rv;
+}
+
+int
+    fbink_wait_for_complete_ctx(FBInkContext* ctx, int fbfd, uint32_t marker)
+{
+	FBInkContext* prev = enter_context(ctx);
+	const int     rv   = fbink_wait_for_complete(fbfd, marker);
+	leave_context(prev);
+
+	return rv;
+}
+
+uint32_t
+    fbink_get_last_marker_ctx(FBInkContext* ctx)
+{
+	FBInkContext*  prev   = enter_context(ctx);
+	const uint32_t marker = fbink_get_last_marker();
+	leave_context(prev);
+
+	return marker;
+}
+
+int
+    fbink_set_deferred_refresh_ctx(FBInkContext* ctx, int fbfd, bool enable)
+{
+	FBInkContext* prev = enter_context(ctx);
+	const int     rv   = fbink_set_deferred_refresh(fbfd, enable);
+	leave_context(prev);
+
+	return rv;
+}
+
+int
+    fbink_flush_ctx(FBInkContext* ctx, int fbfd)
+{
+	FBInkContext* prev = enter_context(ctx);
+	const int     rv   = fbink_flush(fbfd);
+	leave_context(prev);
+
+	return rv;
+}
+
+uint32_t
+    fbink_refresh_async_ctx(FBInkContext*               ctx,
+			    int                         fbfd,
+			    uint32_t                    region_top,
+			    uint32_t                    region_left,
+			    uint32_t                    region_width,
+			    uint32_t                    region_height,
+			    uint8_t                     dithering_mode,
+			    const FBInkConfig* restrict fbink_cfg,
+			    FBInkRefreshCallback        callback,
+			    void*                       userdata)
+{
+	FBInkContext*  prev   = enter_context(ctx);
+	const uint32_t marker = fbink_refresh_async(
+	    fbfd, region_top, region_left, region_width, region_height, dithering_mode, fbink_cfg, callback, userdata);
+	leave_context(prev);
+
+	return marker;
+}
+
+int
+    fbink_print_progress_bar_ctx(FBInkContext* ctx, int fbfd, uint8_t percentage, const FBInkConfig* restrict fbink_cfg)
+{
+	FBInkContext* prev = enter_context(ctx);
+	const int     rv   = fbink_print_progress_bar(fbfd, percentage, fbink_cfg);
+	leave_context(prev);
+
+	return rv;
+}
+
+int
+    fbink_print_activity_bar_ctx(FBInkContext* ctx, int fbfd, uint8_t progress, const FBInkConfig* restrict fbink_cfg)
+{
+	FBInkContext* prev = enter_context(ctx);
+	const int     rv   = fbink_print_activity_bar(fbfd, progress, fbink_cfg);
+	leave_context(prev);
+
+	return rv;
+}
+
+int
+    fbink_print_image_ctx(FBInkContext*               ctx,
+			  int                         fbfd,
+			  const char*                 filename,
+			  short int                   x_off,
+			  short int                   y_off,
+			  const FBInkConfig* restrict fbink_cfg)
+{
+	FBInkContext* prev = enter_context(ctx);
+	const int     rv   = fbink_print_image(fbfd, filename, x_off, y_off, fbink_cfg);
+	leave_context(prev);
+
+	return rv;
+}
+
+int
+    fbink_print_raw_data_ctx(FBInkContext*               ctx,
+			     int                         fbfd,
+			     unsigned char*              data,
+			     const int                   w,
+			     const int                   h,
+			     const size_t                len,
+			     short int                   x_off,
+			     short int                   y_off,
+			     const FBInkConfig* restrict fbink_cfg)
+{
+	FBInkContext* prev = enter_context(ctx);
+	const int     rv   = fbink_print_raw_data(fbfd, data, w, h, len, x_off, y_off, fbink_cfg);
+	leave_context(prev);
+
+	return rv;
+}
+
+int
+    fbink_cls_ctx(FBInkContext* ctx, int fbfd, const FBInkConfig* restrict fbink_cfg, const FBInkRect* restrict rect)
+{
+	FBInkContext* prev = enter_context(ctx);
+	const int     rv   = fbink_cls(fbfd, fbink_cfg, rect);
+	leave_context(prev);
+
+	return rv;
+}
+
+int
+    fbink_dump_ctx(FBInkContext* ctx, int fbfd, FBInkDump* restrict dump)
+{
+	FBInkContext* prev = enter_context(ctx);
+	const int     rv   = fbink_dump(fbfd, dump);
+	leave_context(prev);
+
+	return rv;
+}
+
+int
+    fbink_region_dump_ctx(FBInkContext*               ctx,
+			  int                         fbfd,
+			  short int                   x_off,
+			  short int                   y_off,
+			  unsigned short int          w,
+			  unsigned short int          h,
+			  const FBInkConfig* restrict fbink_cfg,
+			  FBInkDump* restrict         dump)
+{
+	FBInkContext* prev = enter_context(ctx);
+	const int     rv   = fbink_region_dump(fbfd, x_off, y_off, w, h, fbink_cfg, dump);
+	leave_context(prev);
+
+	return rv;
+}
+
+int
+    fbink_restore_ctx(FBInkContext*               ctx,
+		      int                         fbfd,
+		      const FBInkConfig* restrict fbink_cfg,
+		      const FBInkDump* restrict   dump)
+{
+	FBInkContext* prev = enter_context(ctx);
+	const int     rv   = fbink_restore(fbfd, fbink_cfg, dump);
+	leave_context(prev);
+
+	return rv;
+}
+
+int
+    fbink_restore_from_file_ctx(FBInkContext*               ctx,
+				int                         fbfd,
+				const FBInkConfig* restrict fbink_cfg,
+				const char* restrict        filename)
+{
+	FBInkContext* prev = enter_context(ctx);
+	const int     rv   = fbink_restore_from_file(fbfd, fbink_cfg, filename);
+	leave_context(prev);
+
+	return rv;
+}
+
+int
+    fbink_get_back_buffer_ctx(FBInkContext* ctx, int fbfd)
+{
+	FBInkContext* prev = enter_context(ctx);
+	const int     rv   = fbink_get_back_buffer(fbfd);
+	leave_context(prev);
+
+	return rv;
+}
+
+int
+    fbink_share_back_buffer_ctx(FBInkContext* ctx, int fbfd, FBInkSharedBuffer* restrict shared)
+{
+	FBInkContext* prev = enter_context(ctx);
+	const int     rv   = fbink_share_back_buffer(fbfd, shared);
+	leave_context(prev);
+
+	return rv;
+}
+
+int
+    fbink_present_ctx(FBInkContext*               ctx,
+		      int                         fbfd,
+		      const FBInkRect* restrict   rect,
+		      const FBInkConfig* restrict fbink_cfg)
+{
+	FBInkContext* prev = enter_context(ctx);
+	const int     rv   = fbink_present(fbfd, rect, fbink_cfg);
+	leave_context(prev);
+
+	return rv;
+}
+
+int
+    fbink_release_back_buffer_ctx(FBInkContext* ctx, int fbfd)
+{
+	FBInkContext* prev = enter_context(ctx);
+	const int     rv   = fbink_release_back_buffer(fbfd);
+	leave_context(prev);
+
+	return rv;
+}
+
+FBInkRect
+    fbink_get_last_rect_ctx(FBInkContext* ctx)
+{
+	FBInkContext*   prev = enter_context(ctx);
+	const FBInkRect rect = fbink_get_last_rect();
+	leave_context(prev);
+
+	return rect;
+}
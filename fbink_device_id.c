@@ -988,4 +988,161 @@ static void
 		ELOG("This device does not support HW inversion");
 	}
 }
+
+// Compute the key of our device cache entry
+static int
+    set_device_cache_key(int fbfd, FBInkDeviceCacheKey* restrict key)
+{
+	memset(key, 0, sizeof(*key));
+	memcpy(key->magic, FBINK_DEVICE_CACHE_MAGIC, sizeof(key->magic));
+	// Flawfinder: ignore
+	strncpy(key->version, fbink_version(), sizeof(key->version) - 1U);
+	key->quirks_size = (uint32_t) sizeof(FBInkDeviceQuirks);
+
+	// NOTE: We haven't queried fInfo yet at this point (unless we're a canvas, in which case it's already setup).
+	struct fb_fix_screeninfo finfo = fInfo;
+	if (!isCanvas) {
+		if (ioctl(fbfd, FBIOGET_FSCREENINFO, &finfo)) {
+			LOG("Error reading fixed fb information: %m");
+			return ERRCODE(EXIT_FAILURE);
+		}
+	}
+	// NOTE: fb_id isn't necessarily NUL-terminated.
+	memcpy(key->fb_id, finfo.id, MIN(sizeof(key->fb_id), sizeof(finfo.id)));
+	key->smem_len = finfo.smem_len;
+
+	struct utsname uts;
+	if (uname(&uts) != 0) {
+		LOG("uname: %m");
+		return ERRCODE(EXIT_FAILURE);
+	}
+	// Flawfinder: ignore
+	strncpy(key->kernel_release, uts.release, sizeof(key->kernel_release) - 1U);
+	// Flawfinder: ignore
+	strncpy(key->kernel_version, uts.version, sizeof(key->kernel_version) - 1U);
+
+	return EXIT_SUCCESS;
+}
+
+// Restore deviceQuirks from our device cache, if it's valid for this key
+static bool
+    load_device_cache(const char* restrict path, const FBInkDeviceCacheKey* restrict key)
+{
+	int fd = open(path, O_RDONLY | O_CLOEXEC);
+	if (fd == -1) {
+		LOG("No device cache @ %s (%m)", path);
+		return false;
+	}
+
+	FBInkDeviceCache entry;
+	const ssize_t    nread = read(fd, &entry, sizeof(entry));
+	close(fd);
+	if (nread != (ssize_t) sizeof(entry)) {
+		LOG("Ignoring truncated device cache @ %s", path);
+		return false;
+	}
+	if (memcmp(&entry.key, key, sizeof(*key)) != 0) {
+		LOG("Ignoring stale device cache @ %s", path);
+		return false;
+	}
+	// NOTE: The path comes from the env, so don't trust the contents blindly:
+	//       anything but a 0 or a 1 in a bool is UB as soon as it's read as one, so check the raw bytes.
+	const size_t bool_offsets[] = {
+		offsetof(FBInkDeviceQuirks, isKindleLegacy),
+		offsetof(FBInkDeviceQuirks, isKindlePearlScreen),
+		offsetof(FBInkDeviceQuirks, isKindleZelda),
+		offsetof(FBInkDeviceQuirks, isKindleRex),
+		offsetof(FBInkDeviceQuirks, isKoboNonMT),
+		offsetof(FBInkDeviceQuirks, isKoboMk7),
+		offsetof(FBInkDeviceQuirks, canRotate),
+		offsetof(FBInkDeviceQuirks, canHWInvert),
+		offsetof(FBInkDeviceQuirks, skipId),
+	};
+	const unsigned char* raw = (const unsigned char*) &entry.quirks;
+	for (size_t i = 0U; i < sizeof(bool_offsets) / sizeof(*bool_offsets); i++) {
+		if (raw[bool_offsets[i]] > 1U) {
+			LOG("Ignoring corrupted device cache @ %s", path);
+			return false;
+		}
+	}
+
+	deviceQuirks        = entry.quirks;
+	deviceQuirks.skipId = false;
+	// And make sure our strings are always NUL-terminated
+	deviceQuirks.deviceName[sizeof(deviceQuirks.deviceName) - 1U]         = '\0';
+	deviceQuirks.deviceCodename[sizeof(deviceQuirks.deviceCodename) - 1U] = '\0';
+	deviceQuirks.devicePlatform[sizeof(deviceQuirks.devicePlatform) - 1U] = '\0';
+	return true;
+}
+
+// Save deviceQuirks to our device cache
+static void
+    store_device_cache(const char* restrict path, const FBInkDeviceCacheKey* restrict key)
+{
+	FBInkDeviceCache entry = { 0 };
+	entry.key              = *key;
+	entry.quirks           = deviceQuirks;
+
+	// Write to a temporary file, and rename it over the actual cache,
+	// so that concurrent inits never see a partial file.
+	char tmp_path[PATH_MAX];
+	if (snprintf(tmp_path, sizeof(tmp_path), "%s.XXXXXX", path) >= (int) sizeof(tmp_path)) {
+		LOG("Device cache path is too long");
+		return;
+	}
+	int fd = mkostemp(tmp_path, O_CLOEXEC);
+	if (fd == -1) {
+		LOG("Failed to create a temporary device cache file @ %s: %m", tmp_path);
+		return;
+	}
+	const bool ok = (write(fd, &entry, sizeof(entry)) == (ssize_t) sizeof(entry)) && (fchmod(fd, 0644) == 0);
+	if (close(fd) != 0 || !ok || rename(tmp_path, path) != 0) {
+		LOG("Failed to write the device cache @ %s: %m", path);
+		unlink(tmp_path);
+		return;
+	}
+	LOG("Saved device cache @ %s", path);
+}
+
+// Identify the device, via our on-disk cache if it was enabled (c.f., FBINK_DEVICE_CACHE)
+static void
+    identify_device_cached(int fbfd)
+{
+	struct timespec start;
+	clock_gettime(CLOCK_MONOTONIC, &start);
+
+	const char*         path      = getenv("FBINK_DEVICE_CACHE");
+	bool                is_cached = false;
+	FBInkDeviceCacheKey key;
+	if (path && *path) {
+		if (set_device_cache_key(fbfd, &key) == EXIT_SUCCESS) {
+			is_cached = load_device_cache(path, &key);
+		} else {
+			// Couldn't compute a key, so don't even try to store anything
+			path = NULL;
+		}
+	}
+
+	if (is_cached) {
+		ELOG("Restored a %s (%hu => %s on %s) from the device cache",
+		     deviceQuirks.deviceName,
+		     deviceQuirks.deviceId,
+		     deviceQuirks.deviceCodename,
+		     deviceQuirks.devicePlatform);
+	} else {
+		identify_device();
+		if (path && *path) {
+			store_device_cache(path, &key);
+		}
+	}
+
+	struct timespec end;
+	clock_gettime(CLOCK_MONOTONIC, &end);
+	deviceIdStats.elapsed_ns =
+	    (uint64_t) ((end.tv_sec - start.tv_sec) * 1000000000LL + (end.tv_nsec - start.tv_nsec));
+	deviceIdStats.is_cached  = is_cached;
+	LOG("Device identification took %.3f ms (%s)",
+	    (double) deviceIdStats.elapsed_ns / 1000000.0,
+	    is_cached ? "cached" : "uncached");
+}
 #endif    // !FBINK_FOR_LINUX
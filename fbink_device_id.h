@@ -27,6 +27,8 @@
 #include "fbink_internal.h"
 
 #include <linux/fs.h>
+#include <sys/utsname.h>
+#include <time.h>
 
 #ifndef FBINK_FOR_LINUX
 #	if defined(FBINK_FOR_KOBO) || defined(FBINK_FOR_CERVANTES)
@@ -146,7 +148,33 @@ static void identify_kobo(void);
 static void identify_remarkable(void);
 #        endif    // FBINK_FOR_KINDLE
 
+// Opt-in on-disk cache of what identify_device came up with (c.f., FBINK_DEVICE_CACHE in fbink.h)
+#	define FBINK_DEVICE_CACHE_MAGIC "FBInkDID"
+// What a cache entry is keyed on: cheap invariants of the device, and of our own build.
+// NOTE: Zero-initialized (padding included), as we memcmp it.
+typedef struct
+{
+	char     magic[8];
+	char     version[64];           // fbink_version(), as quirks may change between releases
+	char     fb_id[16];             // fInfo.id
+	char     kernel_release[65];    // uname -r
+	char     kernel_version[65];    // uname -v (i.e., the kernel's build stamp)
+	uint32_t smem_len;              // fInfo.smem_len
+	uint32_t quirks_size;           // sizeof(FBInkDeviceQuirks)
+} FBInkDeviceCacheKey;
+
+// The cache file itself
+typedef struct
+{
+	FBInkDeviceCacheKey key;
+	FBInkDeviceQuirks   quirks;
+} FBInkDeviceCache;
+
 static void identify_device(void);
+static int  set_device_cache_key(int, FBInkDeviceCacheKey* restrict);
+static bool load_device_cache(const char* restrict, const FBInkDeviceCacheKey* restrict);
+static void store_device_cache(const char* restrict, const FBInkDeviceCacheKey* restrict);
+static void identify_device_cached(int);
 #endif    // !FBINK_FOR_LINUX
 
 #endif
@@ -122,11 +122,19 @@
 #include <fcntl.h>
 #include <linux/fb.h>
 #include <linux/kd.h>
+#include <stddef.h>
 #include <stdlib.h>
 #include <string.h>
 #include <sys/ioctl.h>
+#include <linux/netlink.h>
+#include <poll.h>
+#include <pthread.h>
+#include <signal.h>
+#include <sys/eventfd.h>
 #include <sys/mman.h>
+#include <sys/socket.h>
 #include <sys/stat.h>
+#include <sys/syscall.h>
 #include <sys/types.h>
 #include <syslog.h>
 #include <unistd.h>
@@ -380,63 +388,310 @@ static const uint8_t eInkBGCMap[16] = { 0xFF, 0xEE, 0xDD, 0xCC, 0xBB, 0xAA, 0x99
 //       is not noticeably faster than pack_rgb565() in our use-cases ;).
 //#include "fbink_rgb565.h"
 
-// Global variables to store fb/screen info
-unsigned char* restrict  fbPtr      = NULL;
-bool                     isFbMapped = false;
-struct fb_var_screeninfo vInfo;
-struct fb_fix_screeninfo fInfo;
-uint32_t                 viewWidth;
-uint32_t                 viewHeight;
-uint32_t                 screenWidth;
-uint32_t                 screenHeight;
-uint8_t                  viewHoriOrigin = 0U;
-uint8_t                  viewVertOrigin = 0U;
-uint8_t                  viewVertOffset = 0U;
-uint8_t                  glyphWidth     = 8U;
-uint8_t                  glyphHeight    = 8U;
-unsigned short int       FONTW          = 8U;
-unsigned short int       FONTH          = 8U;
-uint8_t                  FONTSIZE_MULT  = 1U;
-uint8_t                  penFGColor     = 0x00;
-uint8_t                  penBGColor     = 0xFF;
-FBInkPixel               penFGPixel;
-FBInkPixel               penBGPixel;
-uint32_t                 lastMarker = 0U;
-// Slightly arbitrary-ish fallback values
-unsigned short int MAXROWS = 45U;
-unsigned short int MAXCOLS = 32U;
-// Verbose is for diagnostic/debug info in general
-bool g_isVerbose = false;
-// Quiet is for fbink_init's hardware setup info
-bool g_isQuiet = false;
-// Whether we log to stdout/stderr or the syslog
-bool g_toSysLog = false;
+// Where we track device/screen-specific quirks
+FBInkDeviceQuirks deviceQuirks = { 0 };
+// And how long it took us to figure them out (c.f., fbink_get_device_id_stats)
+FBInkDeviceIdStats deviceIdStats = { 0 };
 // This should be a pretty accurate fallback...
 long int USER_HZ = 100;
-// Pointers to the appropriate put_pixel/get_pixel functions for the fb's bpp
-//void (*fxpPutPixel)(const FBInkCoordinates* restrict, const FBInkPixel* restrict) = NULL;
-void (*fxpGetPixel)(const FBInkCoordinates* restrict, FBInkPixel* restrict) = NULL;
-// As well as the appropriate coordinates rotation functions...
-void (*fxpRotateCoords)(FBInkCoordinates* restrict)  = NULL;
-void (*fxpRotateRegion)(struct mxcfb_rect* restrict) = NULL;
-// And the font bitmap getter...
-const unsigned char* (*fxpFont8xGetBitmap)(uint32_t) = NULL;
-#ifdef FBINK_WITH_FONTS
-const uint16_t* (*fxpFont16xGetBitmap)(uint32_t) = NULL;
-const uint32_t* (*fxpFont32xGetBitmap)(uint32_t) = NULL;
-//const uint64_t* (*fxpFont64xGetBitmap)(uint32_t) = NULL;
+// NOTE: The above is process-wide, and only ever written once, by the first initialize_fbink call, under deviceIdLock.
+pthread_mutex_t deviceIdLock = PTHREAD_MUTEX_INITIALIZER;
+
+// Pre-scaled glyph cells for the fixed-cell renderer (c.f., draw)
+// NOTE: Memory usage is capped at GLYPH_CACHE_MAX_SIZE, which caps the amount of slots for large cells.
+//       We never need less than GLYPH_CACHE_MIN_SLOTS, though, even if that means going over budget.
+#define GLYPH_CACHE_MAX_SLOTS 256U
+#define GLYPH_CACHE_MIN_SLOTS 16U
+#define GLYPH_CACHE_MAX_SIZE  (1U * 1024U * 1024U)
+#define GLYPH_CACHE_EMPTY     UINT32_MAX
+
+// Diff-mode restores (c.f., FBInkDump's diff_only)
+// NOTE: Bands of changed rows at most DIFF_RESTORE_MERGE_GAP rows apart are merged,
+//       and once we've sent DIFF_RESTORE_MAX_REGIONS - 1 updates, everything else is merged in the last one.
+#define DIFF_RESTORE_MERGE_GAP   8U
+#define DIFF_RESTORE_MAX_REGIONS 8U
+
+// Compressed dumps (c.f., FBInkDump's is_compressed)
+// NOTE: Packets are made of pixel-sized units (bytes at 4bpp), and never straddle rows.
+//       Literals cost a header byte every RLE_MAX_PACKET_UNITS units,
+//       and runs never end up larger than what they encode, which gives us the worst case size of a packed row.
+#define RLE_MAX_PACKET_UNITS      128U
+#define RLE_UNIT_SIZE(bpp)        ((bpp) == 4U ? 1U : (size_t)(bpp) >> 3U)
+#define RLE_ROW_MAX_LEN(units, u) (((units) * (u)) + ((units) / RLE_MAX_PACKET_UNITS) + 1U)
+
+// Dump files (c.f., fbink_dump_to_file & FBInkDumpFileHeader)
+#define FBINK_DUMP_MAGIC   "FBInkDmp"
+#define FBINK_DUMP_VERSION 1U
+
+// Double-buffering (c.f., fbink_get_back_buffer & fbink_present)
+#ifndef MFD_CLOEXEC
+#	define MFD_CLOEXEC 0x0001U
+#endif
+#ifndef MFD_ALLOW_SEALING
+#	define MFD_ALLOW_SEALING 0x0002U
+#endif
+#ifndef F_ADD_SEALS
+#	define F_ADD_SEALS (1024 + 9)
+#endif
+#ifndef F_SEAL_SHRINK
+#	define F_SEAL_SHRINK 0x0002
+#endif
+#ifndef F_SEAL_GROW
+#	define F_SEAL_GROW 0x0004
 #endif
 
-// Where we track device/screen-specific quirks
-FBInkDeviceQuirks deviceQuirks = { 0 };
+#ifndef FBINK_FOR_LINUX
+// Deferred refresh mode (c.f., fbink_set_deferred_refresh & fbink_flush)
+// NOTE: Compatible requests that overlap, or that are at most REFRESH_QUEUE_MERGE_SLACK pixels apart, are merged.
+#	define REFRESH_QUEUE_SIZE        16U
+#	define REFRESH_QUEUE_MERGE_SLACK 8U
+#endif
+
+#ifdef FBINK_WITH_OPENTYPE
+// The OpenType glyph cache (c.f., fbink_set_ot_cache_size)
+// NOTE: The default budget should comfortably hold a few thousand glyphs at common text sizes.
+#	define OT_CACHE_BUCKETS      1024U
+#	define OT_CACHE_DEFAULT_SIZE (2U * 1024U * 1024U)
+#endif
 
-// Where we track the last drawn rectangle
-FBInkRect lastRect = { 0 };
+// Everything that's tied to a specific target (i.e., the fb, or a canvas), a.k.a., a context (c.f., fbink_new_context)
+// NOTE: The code never accesses it directly, but via the current context of the calling thread (c.f., currentContext),
+//       through the macros below, which is why the fields are named like the globals they used to be.
+struct FBInkContext
+{
+	// Info about the fb/screen
+	unsigned char* restrict  fbPtr;
+	bool                     isFbMapped;
+	struct fb_var_screeninfo vInfo;
+	struct fb_fix_screeninfo fInfo;
+	uint32_t                 viewWidth;
+	uint32_t                 viewHeight;
+	uint32_t                 screenWidth;
+	uint32_t                 screenHeight;
+	uint8_t                  viewHoriOrigin;
+	uint8_t                  viewVertOrigin;
+	uint8_t                  viewVertOffset;
+	uint8_t                  glyphWidth;
+	uint8_t                  glyphHeight;
+	unsigned short int       FONTW;
+	unsigned short int       FONTH;
+	uint8_t                  FONTSIZE_MULT;
+	uint8_t                  penFGColor;
+	uint8_t                  penBGColor;
+	FBInkPixel               penFGPixel;
+	FBInkPixel               penBGPixel;
+	uint32_t                 lastMarker;
+	// Scratch buffers used to stage a full line of pixels for the span blitters (sized to screenWidth)
+	uint8_t*    spanGrayBuff;
+	FBInkPixel* spanPixelBuff;
+	uint32_t    spanBuffLen;
+	// Pre-scaled glyph cells for the fixed-cell renderer (c.f., draw)
+	FBInkGlyphCache glyphCache;
+	// Slightly arbitrary-ish fallback values
+	unsigned short int MAXROWS;
+	unsigned short int MAXCOLS;
+	// Verbose is for diagnostic/debug info in general
+	bool g_isVerbose;
+	// Quiet is for fbink_init's hardware setup info
+	bool g_isQuiet;
+	// Whether we log to stdout/stderr or the syslog
+	bool g_toSysLog;
+	// Pointers to the appropriate put_pixel_*/get_pixel_* functions for the fb's bpp
+	//void (*fxpPutPixel)(const FBInkCoordinates* restrict, const FBInkPixel* restrict);
+	void (*fxpGetPixel)(const FBInkCoordinates* restrict, FBInkPixel* restrict);
+	// As well as the appropriate coordinates rotation functions...
+	void (*fxpRotateCoords)(FBInkCoordinates* restrict);
+	void (*fxpRotateRegion)(struct mxcfb_rect* restrict);
+	// And the font bitmap getter...
+	const unsigned char* (*fxpFont8xGetBitmap)(uint32_t);
+#ifdef FBINK_WITH_FONTS
+	const uint16_t* (*fxpFont16xGetBitmap)(uint32_t);
+	const uint32_t* (*fxpFont32xGetBitmap)(uint32_t);
+	//const uint64_t* (*fxpFont64xGetBitmap)(uint32_t);
+#endif
+	// The only screen quirks that depend on the fb's state, rather than on the device (c.f., initialize_fbink)
+	bool isNTX16bLandscape;
+	bool isPerfectFit;
+	// Where we track the last drawn rectangle
+	FBInkRect lastRect;
+	// Off-screen canvas backend (c.f., fbink_open_canvas)
+	bool           isCanvas;
+	unsigned char* canvasBuff;
+	uint32_t       canvasRefreshCount;
+	FBInkRect      canvasDamage;
+	// Scratch memory of the print functions (c.f., scratch_alloc & fbink_trim_scratch)
+	FBInkScratchArena scratchArena;
+	// Double-buffering (c.f., fbink_get_back_buffer & fbink_present)
+	// NOTE: While the back buffer is active, fbPtr points to it, and frontPtr to the actual fb mapping.
+	bool              isBackBufferActive;
+	unsigned char*    frontPtr;
+	unsigned char*    backBuff;       // Only set when the back buffer is a shadow buffer we allocated
+	int               backBuffFd;     // Only set for a shared back buffer (c.f., fbink_share_back_buffer)
+	size_t            backBuffLen;    // Size of that shared mapping
+	struct mxcfb_rect backDamage;     // What was drawn to the back buffer since the last present
+#ifdef FBINK_FOR_KOBO
+	uint32_t backBufferAddr;    // Physical address of the back buffer, when it lives in fb memory
+	bool     isPresentingBackBuffer;
+#endif
+#ifndef FBINK_FOR_LINUX
+	// Pending refresh requests, when in deferred refresh mode
+	bool                isRefreshDeferred;
+	FBInkRefreshRequest refreshQueue[REFRESH_QUEUE_SIZE];
+	uint8_t             refreshQueueLen;
+#endif
+#ifdef FBINK_WITH_OPENTYPE
+	// Information about the currently loaded OpenType font
+	bool         otInit;
+	FBInkOTFonts otFonts;
+	// Rasterized glyphs, shared across fbink_print_ot calls, flushed by fbink_free_ot_fonts
+	FBInkOTGlyphCache otCache;
+#endif
+	// Serializes the *_ctx calls made on this context (c.f., enter_context)
+	pthread_mutex_t lock;
+};
 
+// What a context looks like before its first fbink_init
+#ifdef FBINK_WITH_OPENTYPE
+#	define OT_CONTEXT_INITIALIZER .otCache = { .max_size = OT_CACHE_DEFAULT_SIZE },
+#else
+#	define OT_CONTEXT_INITIALIZER
+#endif
+#define FBINK_CONTEXT_INITIALIZER                                                                                        \
+	{                                                                                                                \
+		.glyphWidth = 8U, .glyphHeight = 8U, .FONTW = 8U, .FONTH = 8U, .FONTSIZE_MULT = 1U, .penFGColor = 0x00,  \
+		.penBGColor = 0xFF, .MAXROWS = 45U, .MAXCOLS = 32U, .backBuffFd = -1, OT_CONTEXT_INITIALIZER             \
+		.lock = PTHREAD_MUTEX_INITIALIZER                                                                        \
+	}
+// The default context, i.e., the one the regular API acts on
+FBInkContext defaultContext = FBINK_CONTEXT_INITIALIZER;
+// What fbink_new_context starts from
+static const FBInkContext pristineContext = FBINK_CONTEXT_INITIALIZER;
+#undef FBINK_CONTEXT_INITIALIZER
+#undef OT_CONTEXT_INITIALIZER
+
+// The context the calling thread is working on (c.f., enter_context)
+// NOTE: This is accessed all over the place, pixel-level hot paths included,
+//       so use the initial-exec model, to avoid going through __tls_get_addr every time in shared builds.
+__thread FBInkContext* currentContext __attribute__((tls_model("initial-exec"))) = &defaultContext;
+
+// And now, the state itself, under the names the code has always known it by...
+#define fbPtr              (currentContext->fbPtr)
+#define isFbMapped         (currentContext->isFbMapped)
+#define vInfo              (currentContext->vInfo)
+#define fInfo              (currentContext->fInfo)
+#define viewWidth          (currentContext->viewWidth)
+#define viewHeight         (currentContext->viewHeight)
+#define screenWidth        (currentContext->screenWidth)
+#define screenHeight       (currentContext->screenHeight)
+#define viewHoriOrigin     (currentContext->viewHoriOrigin)
+#define viewVertOrigin     (currentContext->viewVertOrigin)
+#define viewVertOffset     (currentContext->viewVertOffset)
+#define glyphWidth         (currentContext->glyphWidth)
+#define glyphHeight        (currentContext->glyphHeight)
+#define FONTW              (currentContext->FONTW)
+#define FONTH              (currentContext->FONTH)
+#define FONTSIZE_MULT      (currentContext->FONTSIZE_MULT)
+#define penFGColor         (currentContext->penFGColor)
+#define penBGColor         (currentContext->penBGColor)
+#define penFGPixel         (currentContext->penFGPixel)
+#define penBGPixel         (currentContext->penBGPixel)
+#define lastMarker         (currentContext->lastMarker)
+#define spanGrayBuff       (currentContext->spanGrayBuff)
+#define spanPixelBuff      (currentContext->spanPixelBuff)
+#define spanBuffLen        (currentContext->spanBuffLen)
+#define glyphCache         (currentContext->glyphCache)
+#define MAXROWS            (currentContext->MAXROWS)
+#define MAXCOLS            (currentContext->MAXCOLS)
+#define g_isVerbose        (currentContext->g_isVerbose)
+#define g_isQuiet          (currentContext->g_isQuiet)
+#define g_toSysLog         (currentContext->g_toSysLog)
+#define fxpGetPixel        (currentContext->fxpGetPixel)
+#define fxpRotateCoords    (currentContext->fxpRotateCoords)
+#define fxpRotateRegion    (currentContext->fxpRotateRegion)
+#define fxpFont8xGetBitmap (currentContext->fxpFont8xGetBitmap)
+#ifdef FBINK_WITH_FONTS
+#	define fxpFont16xGetBitmap (currentContext->fxpFont16xGetBitmap)
+#	define fxpFont32xGetBitmap (currentContext->fxpFont32xGetBitmap)
+#endif
+#define isNTX16bLandscape  (currentContext->isNTX16bLandscape)
+#define isPerfectFit       (currentContext->isPerfectFit)
+#define lastRect           (currentContext->lastRect)
+#define isCanvas           (currentContext->isCanvas)
+#define canvasBuff         (currentContext->canvasBuff)
+#define canvasRefreshCount (currentContext->canvasRefreshCount)
+#define canvasDamage       (currentContext->canvasDamage)
+#define scratchArena       (currentContext->scratchArena)
+#define isBackBufferActive (currentContext->isBackBufferActive)
+#define frontPtr           (currentContext->frontPtr)
+#define backBuff           (currentContext->backBuff)
+#define backBuffFd         (currentContext->backBuffFd)
+#define backBuffLen        (currentContext->backBuffLen)
+#define backDamage         (currentContext->backDamage)
+#ifdef FBINK_FOR_KOBO
+#	define backBufferAddr         (currentContext->backBufferAddr)
+#	define isPresentingBackBuffer (currentContext->isPresentingBackBuffer)
+#endif
+#ifndef FBINK_FOR_LINUX
+#	define isRefreshDeferred (currentContext->isRefreshDeferred)
+#	define refreshQueue      (currentContext->refreshQueue)
+#	define refreshQueueLen   (currentContext->refreshQueueLen)
+#endif
 #ifdef FBINK_WITH_OPENTYPE
-// Information about the currently loaded OpenType font
-bool         otInit  = false;
-FBInkOTFonts otFonts = { NULL, NULL, NULL, NULL };
+#	define otInit  (currentContext->otInit)
+#	define otFonts (currentContext->otFonts)
+#	define otCache (currentContext->otCache)
+#endif
+
+#ifndef FBINK_FOR_LINUX
+// The async refresh worker (c.f., fbink_refresh_async)
+// NOTE: asyncRefreshQueue is a ring buffer of in-flight updates, protected by asyncRefreshLock.
+//       It's process-wide, and serves every context.
+#	define ASYNC_REFRESH_QUEUE_SIZE 64U
+pthread_t         asyncRefreshThread;
+pthread_mutex_t   asyncRefreshLock = PTHREAD_MUTEX_INITIALIZER;
+pthread_cond_t    asyncRefreshCond = PTHREAD_COND_INITIALIZER;
+FBInkAsyncRefresh asyncRefreshQueue[ASYNC_REFRESH_QUEUE_SIZE];
+uint8_t           asyncRefreshHead     = 0U;
+uint8_t           asyncRefreshLen      = 0U;
+int               asyncRefreshFd       = -1;    // The worker's own fb fd
+int               asyncRefreshEventFd  = -1;
+uint32_t          lastCompletedMarker  = 0U;
+bool              isAsyncRefreshActive = false;
+bool              isAsyncRefreshDying  = false;
+#endif
+
+#ifndef FBINK_FOR_KINDLE
+// The framebuffer layout watcher (c.f., fbink_start_fb_watcher)
+// NOTE: fbWatcherBpp, fbWatcherRota & isFbLayoutDirty are protected by fbWatcherLock,
+//       the rest is only ever touched by the thread that starts & stops the watcher.
+#	define FB_WATCHER_DEFAULT_INTERVAL_MS 500
+#	define FB_WATCHER_UEVENT_SIZE         4096U
+pthread_t       fbWatcherThread;
+pthread_mutex_t fbWatcherLock       = PTHREAD_MUTEX_INITIALIZER;
+int             fbWatcherFd         = -1;    // The watcher's own fb fd
+int             fbWatcherEventFd    = -1;    // Signaled when the layout changed
+int             fbWatcherStopFd     = -1;    // Signaled by fbink_stop_fb_watcher
+int             fbWatcherIntervalMs = FB_WATCHER_DEFAULT_INTERVAL_MS;
+uint32_t        fbWatcherBpp        = 0U;    // The layout as of our last (re)init
+uint32_t        fbWatcherRota       = 0U;
+bool            isFbWatcherActive   = false;
+bool            isFbLayoutDirty     = false;
+#endif
+
+#ifdef FBINK_WITH_IMAGE
+// The band workers, used to blit images in parallel (c.f., run_bands & fbink_set_image_threads)
+// NOTE: Everything but bandThreads is protected by bandLock.
+#	define BAND_WORKERS_MAX 15U
+#	define BAND_MIN_ROWS    32U    // Don't bother splitting a job in bands smaller than that
+pthread_t       bandWorkers[BAND_WORKERS_MAX];
+pthread_mutex_t bandLock         = PTHREAD_MUTEX_INITIALIZER;
+pthread_cond_t  bandJobCond      = PTHREAD_COND_INITIALIZER;    // Signaled when a job is posted (or when dying)
+pthread_cond_t  bandDoneCond     = PTHREAD_COND_INITIALIZER;    // Signaled when a job is complete
+FBInkBandJob    bandJob          = { 0 };
+uint32_t        bandJobGen       = 0U;
+uint8_t         bandWorkersCount = 0U;
+uint8_t         bandThreads      = 0U;    // Including the caller's, 0 means one per online CPU
+bool            isBandPoolDying  = false;
 #endif
 
 #if defined(FBINK_FOR_KOBO) || defined(FBINK_FOR_CERVANTES)
@@ -455,19 +710,31 @@ static void put_pixel_Gray8(const FBInkCoordinates* restrict, const FBInkPixel*
 static void put_pixel_RGB24(const FBInkCoordinates* restrict, const FBInkPixel* restrict);
 static void put_pixel_RGB32(const FBInkCoordinates* restrict, const FBInkPixel* restrict);
 static void put_pixel_RGB565(const FBInkCoordinates* restrict, const FBInkPixel* restrict);
-// NOTE: We pass coordinates by value here, because a rotation transformation *may* be applied to them,
-//       and that's a rotation that the caller will *never* care about.
-static void put_pixel(FBInkCoordinates, const FBInkPixel* restrict, bool);
-// NOTE: On the other hand, if you happen to be calling function pointers directly,
-//       it's left to you to not do anything stupid ;)
+// NOTE: If you happen to be calling these directly, it's left to you to not do anything stupid ;)
 
 static void get_pixel_Gray4(const FBInkCoordinates* restrict, FBInkPixel* restrict);
 static void get_pixel_Gray8(const FBInkCoordinates* restrict, FBInkPixel* restrict);
 static void get_pixel_RGB24(const FBInkCoordinates* restrict, FBInkPixel* restrict);
 static void get_pixel_RGB32(const FBInkCoordinates* restrict, FBInkPixel* restrict);
 static void get_pixel_RGB565(const FBInkCoordinates* restrict, FBInkPixel* restrict);
-// NOTE: Same as put_pixel ;)
-static void get_pixel(FBInkCoordinates, FBInkPixel* restrict);
+
+// Span blitters: plot a whole horizontal run of pixels at once, without per-pixel rotation/bounds/bpp dispatch.
+static bool clip_span(FBInkCoordinates, unsigned short int, FBInkSpan* restrict);
+// NOTE: These take a run of 8-bit grayscale values (i.e., text & bars, which are always grayscale),
+//       and expand them to the fb's pixel format on the fly.
+static void put_span_Gray4(const FBInkSpan* restrict, const uint8_t* restrict);
+static void put_span_Gray8(const FBInkSpan* restrict, const uint8_t* restrict);
+static void put_span_RGB24(const FBInkSpan* restrict, const uint8_t* restrict);
+static void put_span_RGB32(const FBInkSpan* restrict, const uint8_t* restrict);
+static void put_span_RGB565(const FBInkSpan* restrict, const uint8_t* restrict);
+// NOTE: We pass coordinates by value here, because a rotation transformation *may* be applied to them,
+//       and that's a rotation that the caller will *never* care about. Clipping is handled for you, too.
+static void put_gray_span(FBInkCoordinates, unsigned short int, const uint8_t* restrict);
+// NOTE: And these work on FBInkPixel runs, for the codepaths that need to read back what's already on screen.
+static void put_span(FBInkCoordinates, unsigned short int, const FBInkPixel* restrict, bool);
+static void get_span(FBInkCoordinates, unsigned short int, FBInkPixel* restrict);
+// NOTE: And this one takes a run of pixels already in the fb's pixel format (except at 4bpp, where it's Y8).
+static void put_native_span(FBInkCoordinates, unsigned short int, const uint8_t* restrict);
 
 #if defined(FBINK_WITH_IMAGE) || defined(FBINK_WITH_OPENTYPE)
 // This is only needed for alpha blending in the image or OpenType codepath ;).
@@ -504,6 +771,12 @@ static const char* fontname_to_string(uint8_t);
 
 static int zu_print_length(size_t);
 
+static void     flush_glyph_cache(void);
+static void     invalidate_glyph_cache(uint8_t);
+static bool     prepare_glyph_cache(uint8_t, uint8_t);
+static uint8_t* fetch_cached_glyph(uint32_t, bool* restrict);
+static void     gray_to_native(const uint8_t* restrict, uint8_t* restrict, unsigned short int);
+
 static struct mxcfb_rect draw(const char* restrict,
 			      unsigned short int,
 			      unsigned short int,
@@ -534,6 +807,16 @@ static int refresh_kobo_mk7(int, const struct mxcfb_rect, uint32_t, uint32_t, in
 static int wait_for_complete_kobo_mk7(int, uint32_t);
 #	endif    // FBINK_FOR_KINDLE
 #endif            // !FBINK_FOR_LINUX
+#ifndef FBINK_FOR_LINUX
+static int   send_refresh(int, const struct mxcfb_rect, uint32_t, int UNUSED_BY_CERVANTES, bool, bool);
+static bool  regions_touch(const struct mxcfb_rect* restrict, const struct mxcfb_rect* restrict, uint32_t);
+static void  merge_regions(struct mxcfb_rect* restrict, const struct mxcfb_rect* restrict);
+static bool  are_refreshes_compatible(const FBInkRefreshRequest* restrict, const FBInkRefreshRequest* restrict);
+static void  dequeue_refresh(uint8_t);
+static int   queue_refresh(int, const struct mxcfb_rect, uint32_t, int, bool, bool);
+static void* async_refresh_worker(void*);
+static int   start_async_refresh_worker(void);
+#endif
 static int refresh(int, const struct mxcfb_rect, uint32_t, int UNUSED_BY_CERVANTES, bool, bool, bool);
 #ifndef FBINK_FOR_LINUX
 #	if defined(FBINK_FOR_KINDLE)
@@ -547,6 +830,9 @@ static int open_fb_fd_nonblock(int* restrict, bool* restrict);
 
 static const char* fb_rotate_to_string(uint32_t);
 static int         initialize_fbink(int, const FBInkConfig* restrict, bool);
+#ifndef FBINK_FOR_KINDLE
+static void* fb_watcher(void*);
+#endif
 
 static int memmap_fb(int);
 static int unmap_fb(void);
@@ -559,15 +845,77 @@ static void rotate_region_nop(struct mxcfb_rect* restrict);
 static void fullscreen_region(struct mxcfb_rect* restrict);
 
 static void set_last_rect(const struct mxcfb_rect* restrict);
+static void record_canvas_refresh(const struct mxcfb_rect* restrict);
+static FBInkScratchMark scratch_mark(void);
+static void*            scratch_alloc(size_t);
+static void*            scratch_calloc(size_t, size_t);
+static void             scratch_release(FBInkScratchMark);
+
+static void record_back_buffer_damage(const struct mxcfb_rect* restrict);
+static void release_back_buffer(void);
+static int  create_shared_fd(size_t);
+static int  setup_back_buffer(int, bool);
 
 int draw_progress_bars(int, bool, uint8_t, const FBInkConfig* restrict);
 
 #ifdef FBINK_WITH_IMAGE
-unsigned char* qSmoothScaleImage(const unsigned char* src, int sw, int sh, int sn, bool ignore_alpha, int dw, int dh);
-
+unsigned char* qSmoothScaleImage(const unsigned char* src,
+				 int                  sw,
+				 int                  sh,
+				 int                  sn,
+				 bool                 ignore_alpha,
+				 int                  dw,
+				 int                  dh,
+				 int                  threads);
+
+static int            stdin_read_cb(void*, char*, int);
+static void           stdin_skip_cb(void*, int);
+static int            stdin_eof_cb(void*);
 static unsigned char* img_load_from_file(const char*, int*, int*, int*, int);
 static unsigned char* img_convert_px_format(const unsigned char*, int, int, int, int);
 static uint8_t        dither_o8x8(unsigned short int, unsigned short int, uint8_t);
+static bool           find_diff_span(const unsigned char* restrict,
+				     const unsigned char* restrict,
+				     size_t,
+				     size_t* restrict,
+				     size_t* restrict);
+static int            refresh_diff_band(int,
+					const FBInkConfig* restrict,
+					unsigned short int,
+					unsigned short int,
+					unsigned short int,
+					unsigned short int,
+					size_t,
+					size_t);
+static int            restore_diff(int,
+				   const FBInkConfig* restrict,
+				   const FBInkDump* restrict,
+				   unsigned short int,
+				   unsigned short int,
+				   unsigned short int,
+				   unsigned short int);
+static size_t         rle_pack_row(const unsigned char* restrict, size_t, size_t, unsigned char* restrict);
+static size_t         rle_run_length(const unsigned char* restrict, size_t, size_t, size_t);
+static const unsigned char* rle_unpack_row(const unsigned char* restrict,
+					   const unsigned char*,
+					   size_t,
+					   size_t,
+					   size_t,
+					   size_t,
+					   unsigned char* restrict);
+static int                  rle_dump_rows(FBInkDump* restrict, size_t, size_t);
+static int                  rle_restore(const FBInkDump* restrict,
+					unsigned short int,
+					unsigned short int,
+					unsigned short int,
+					unsigned short int);
+static void*          band_worker(void*);
+static void           process_bands(void);
+static uint8_t        get_band_threads(void);
+static void           start_band_workers(uint8_t);
+static void           stop_band_workers(void);
+static void           run_bands(FBInkBandFn, const void*, unsigned short int, unsigned short int);
+static void           draw_image_band(const void*, unsigned short int, unsigned short int);
 static int            draw_image(int,
 				 const unsigned char* restrict,
 				 const int,
@@ -580,9 +928,49 @@ static int            draw_image(int,
 #endif
 
 #ifdef FBINK_WITH_OPENTYPE
-static const char* font_style_to_string(uint8_t);
-static int         free_ot_font(stbtt_fontinfo** restrict);
-static void        parse_simple_md(const char* restrict, size_t, unsigned char* restrict);
+static const char*         font_style_to_string(uint8_t);
+static int                 free_ot_font(stbtt_fontinfo** restrict);
+static uint32_t            ot_cache_hash(const stbtt_fontinfo*, float, int);
+static size_t              ot_glyph_bitmap_len(const FBInkOTGlyph* restrict);
+static void                ot_cache_evict(FBInkOTGlyph* restrict);
+static bool                ot_cache_make_room(size_t, const FBInkOTGlyph* restrict);
+static void                ot_cache_drop_font(const stbtt_fontinfo*);
+static void                ot_cache_flush(void);
+static const FBInkOTGlyph* ot_cache_get_glyph(const stbtt_fontinfo*, float, int, bool);
+static void                parse_simple_md(const char* restrict, size_t, unsigned char* restrict);
+static int  ot_compute_area(const FBInkOTConfig* restrict, FBInkCoordinates* restrict, FBInkCoordinates* restrict);
+static unsigned short int ot_get_font_size_px(const FBInkOTConfig* restrict);
+static int  ot_get_scaled_metrics(unsigned short int, float* restrict, int* restrict, int* restrict);
+static int  ot_measure_chars(const char* restrict,
+			     size_t,
+			     const unsigned char* restrict,
+			     FBInkOTFitChar* restrict,
+			     size_t,
+			     size_t);
+static bool ot_break_line(const char* restrict,
+			  size_t,
+			  const char* restrict,
+			  const unsigned char* restrict,
+			  const FBInkOTFitChar* restrict,
+			  const float* restrict,
+			  unsigned short int,
+			  size_t* restrict,
+			  size_t* restrict,
+			  int* restrict,
+			  int* restrict,
+			  int* restrict);
+static int  ot_layout_reserve(FBInkOTLayout* restrict, size_t);
+static int  ot_layout_reserve_lines(FBInkOTLayout* restrict, size_t);
+static int  ot_layout_update(FBInkOTLayout* restrict, const char* restrict, size_t, FBInkOTFit* restrict);
+static char* ot_layout_line_text(const FBInkOTLayout* restrict, const FBInkOTLayoutLine* restrict);
+static int  ot_fit_probe(const char* restrict,
+			 size_t,
+			 const char* restrict,
+			 const unsigned char* restrict,
+			 const FBInkOTFitChar* restrict,
+			 unsigned short int,
+			 unsigned short int,
+			 unsigned int);
 #endif
 
 static uint32_t    get_wfm_mode(uint8_t);
@@ -24,80 +24,47 @@
 static const unsigned char*
     kates_get_bitmap(uint32_t codepoint)
 {
-	if (codepoint <= 0x02u) {
-		return kates_block1[codepoint];
-	} else if (codepoint >= 0x09u && codepoint <= 0x19u) {
-		return kates_block2[codepoint - 0x09u];
-	} else if (codepoint == 0x1bu) {
-		return kates_block3[0];
-	} else if (codepoint >= 0x20u && codepoint <= 0x7eu) {
-		return kates_block4[codepoint - 0x20u];
-	} else if (codepoint >= 0xa1u && codepoint <= 0xacu) {
-		return kates_block5[codepoint - 0xa1u];
-	} else if (codepoint >= 0xaeu && codepoint <= 0xffu) {
-		return kates_block6[codepoint - 0xaeu];
-	} else {
+	const uint32_t page = codepoint >> 8U;
+	const uint8_t  slot = page <= 0x00u ? kates_page_index[page] : 0U;
+	const uint32_t word = (codepoint >> 5U) & 0x07U;
+	const uint32_t bit  = 1U << (codepoint & 0x1FU);
+	const uint32_t bits = kates_page_bits[slot][word];
+	if (!(bits & bit)) {
 		WARN("Codepoint U+%04X (%s) is not covered by this font", codepoint, u8_cp_to_utf8(codepoint));
-		return kates_block1[0];
+		return kates_glyphs[0];
 	}
+	const uint32_t glyph = kates_page_base[slot][word] + (uint32_t) __builtin_popcount(bits & (bit - 1U));
+	return kates_glyphs[glyph];
 }
 
 static const unsigned char*
     fkp_get_bitmap(uint32_t codepoint)
 {
-	if (codepoint <= 0xffu) {
-		return fkp_block1[codepoint];
-	} else {
+	const uint32_t page = codepoint >> 8U;
+	const uint8_t  slot = page <= 0x00u ? fkp_page_index[page] : 0U;
+	const uint32_t word = (codepoint >> 5U) & 0x07U;
+	const uint32_t bit  = 1U << (codepoint & 0x1FU);
+	const uint32_t bits = fkp_page_bits[slot][word];
+	if (!(bits & bit)) {
 		WARN("Codepoint U+%04X (%s) is not covered by this font", codepoint, u8_cp_to_utf8(codepoint));
-		return fkp_block1[0];
+		return fkp_glyphs[0];
 	}
+	const uint32_t glyph = fkp_page_base[slot][word] + (uint32_t) __builtin_popcount(bits & (bit - 1U));
+	return fkp_glyphs[glyph];
 }
 
 static const unsigned char*
     ctrld_get_bitmap(uint32_t codepoint)
 {
-	if (codepoint >= 0x0au && codepoint <= 0xffu) {
-		return ctrld_block1[codepoint - 0x0au];
-	} else if (codepoint == 0x3bbu) {
-		return ctrld_block2[0];
-	} else if (codepoint == 0x3c0u) {
-		return ctrld_block3[0];
-	} else if (codepoint == 0x21b5u) {
-		return ctrld_block4[0];
-	} else if (codepoint == 0x25aau) {
-		return ctrld_block5[0];
-	} else if (codepoint == 0x25b4u) {
-		return ctrld_block6[0];
-	} else if (codepoint == 0x25b8u) {
-		return ctrld_block7[0];
-	} else if (codepoint == 0x25beu) {
-		return ctrld_block8[0];
-	} else if (codepoint == 0x25c2u) {
-		return ctrld_block9[0];
-	} else if (codepoint == 0x25c6u) {
-		return ctrld_block10[0];
-	} else if (codepoint == 0x2713u) {
-		return ctrld_block11[0];
-	} else if (codepoint == 0x2717u) {
-		return ctrld_block12[0];
-	} else if (codepoint >= 0xe0a0u && codepoint <= 0xe0a2u) {
-		return ctrld_block13[codepoint - 0xe0a0u];
-	} else if (codepoint >= 0xe0b0u && codepoint <= 0xe0b3u) {
-		return ctrld_block14[codepoint - 0xe0b0u];
-	} else if (codepoint >= 0xee00u && codepoint <= 0xee03u) {
-		return ctrld_block15[codepoint - 0xee00u];
-	} else if (codepoint >= 0xee10u && codepoint <= 0xee13u) {
-		return ctrld_block16[codepoint - 0xee10u];
-	} else if (codepoint >= 0xee20u && codepoint <= 0xee23u) {
-		return ctrld_block17[codepoint - 0xee20u];
-	} else if (codepoint >= 0xee30u && codepoint <= 0xee37u) {
-		return ctrld_block18[codepoint - 0xee30u];
-	} else if (codepoint >= 0xee40u && codepoint <= 0xee43u) {
-		return ctrld_block19[codepoint - 0xee40u];
-	} else if (codepoint >= 0xeef0u && codepoint <= 0xeef9u) {
-		return ctrld_block20[codepoint - 0xeef0u];
-	} else {
+	const uint32_t page = codepoint >> 8U;
+	const uint8_t  slot = page <= 0xeeu ? ctrld_page_index[page] : 0U;
+	const uint32_t word = (codepoint >> 5U) & 0x07U;
+	const uint32_t bit  = 1U << (codepoint & 0x1FU);
+	const uint32_t bits = ctrld_page_bits[slot][word];
+	if (!(bits & bit)) {
 		WARN("Codepoint U+%04X (%s) is not covered by this font", codepoint, u8_cp_to_utf8(codepoint));
-		return ctrld_block1[0];
+		return ctrld_glyphs[0];
 	}
+	const uint32_t glyph = ctrld_page_base[slot][word] + (uint32_t) __builtin_popcount(bits & (bit - 1U));
+	return ctrld_glyphs[glyph];
 }
@@ -0,0 +1,195 @@
+/*
+	FBInk: FrameBuffer eInker, a tool to print text & images on eInk devices (Kobo/Kindle)
+	Copyright (C) 2018-2020 NiLuJe <ninuje@gmail.com>
+	SPDX-License-Identifier: GPL-3.0-or-later
+
+	----
+
+	This program is free software: you can redistribute it and/or modify
+	it under the terms of the GNU General Public License as published by
+	the Free Software Foundation, either version 3 of the License, or
+	(at your option) any later version.
+
+	This program is distributed in the hope that it will be useful,
+	but WITHOUT ANY WARRANTY; without even the implied warranty of
+	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+	GNU General Public License for more details.
+
+	You should have received a copy of the GNU General Public License
+	along with this program.  If not, see <https://www.gnu.org/licenses/>.
+*/
+
+#ifndef __FBINK_SOCKET_H
+#define __FBINK_SOCKET_H
+
+#include "fbink.h"
+
+// Wire protocol spoken by the socket server mode of the CLI tool (c.f., fbink -U, --socket).
+//
+// Clients connect to a UNIX stream socket, and send requests, each one made of an FBInkSocketRequest header,
+// immediately followed by its payload (len bytes, the layout of which depends on op, see below).
+// Each request gets exactly one reply, made of an FBInkSocketReply header,
+// immediately followed by its own payload (len bytes, most ops don't have any).
+// NOTE: Everything is in native byte order, alignment & struct layout:
+//       this is meant to be spoken between processes running on the *same* device, and built against the same fbink.h.
+// NOTE: The server is single-threaded: requests are handled one at a time, in the order they were received.
+// NOTE: Strings in payloads are expected to be NUL-terminated (the server enforces that anyway).
+// NOTE: A few API calls have no op, because they only make sense in-process, or are the server's to manage:
+//       fbink_printf (format the string yourself), the async refresh callback & eventfd (wait on markers instead),
+//       the layout watcher (c.f., fbink -K, --watch), contexts, dump buffers (dump to a file instead),
+//       and anything that configures FBInk's logging.
+
+// Where our socket lives by default (/tmp should be a safe bet on every supported platform)
+#define FBINK_SOCKET "/tmp/fbink-socket"
+
+// Bumped on every incompatible change to the protocol
+#define FBINK_SOCKET_VERSION 1U
+
+// Largest request payload the server will accept, bulk pixel data is expected to go through a memfd (see below).
+#define FBINK_SOCKET_MAX_PAYLOAD (64U * 1024U)
+// How many OT layouts a single client may keep around at the same time (c.f., SOCK_NEW_OT_LAYOUT)
+#define FBINK_SOCKET_MAX_LAYOUTS 16U
+
+// List of supported requests, and the API call they map to
+typedef enum
+{
+	SOCK_PRINT = 0U,                // fbink_print
+					//	Payload: a string
+	SOCK_PRINT_OT,                  // fbink_print_ot
+					//	Payload: an FBInkOTConfig, then a string
+					//	Reply payload: an FBInkOTFit
+	SOCK_PRINT_PROGRESS_BAR,        // fbink_print_progress_bar
+					//	Payload: an uint8_t (percentage)
+	SOCK_PRINT_ACTIVITY_BAR,        // fbink_print_activity_bar
+					//	Payload: an uint8_t (progress)
+	SOCK_PRINT_IMAGE,               // fbink_print_image
+					//	Payload: an FBInkSocketImage (only x_off & y_off are used), then a path
+	SOCK_PRINT_RAW_DATA,            // fbink_print_raw_data
+					//	Payload: an FBInkSocketImage
+					//	The pixel data itself MUST be passed via a memfd (or any readable fd),
+					//	sent as SCM_RIGHTS ancillary data alongside the request.
+					//	If it's sealed with F_SEAL_SHRINK, the server maps it directly,
+					//	otherwise, it makes a private copy of it first.
+					//	w & h MUST be > 0, and len >= w * h.
+	SOCK_CLS,                       // fbink_cls
+					//	Payload: an FBInkRect
+	SOCK_REFRESH,                   // fbink_refresh
+					//	Payload: an FBInkSocketRefresh
+	SOCK_WAIT_FOR_SUBMISSION,       // fbink_wait_for_submission
+					//	Payload: an uint32_t (marker)
+	SOCK_WAIT_FOR_COMPLETE,         // fbink_wait_for_complete
+					//	Payload: an uint32_t (marker)
+	SOCK_SET_DEFERRED_REFRESH,      // fbink_set_deferred_refresh
+					//	Payload: a bool
+	SOCK_FLUSH,                     // fbink_flush
+	SOCK_REINIT,                    // fbink_reinit
+	SOCK_GET_STATE,                 // fbink_get_state
+					//	Reply payload: an FBInkState
+	SOCK_ADD_OT_FONT,               // fbink_add_ot_font
+					//	Payload: an uint8_t (style, c.f., FONT_STYLE_T), then a path
+	SOCK_FREE_OT_FONTS,             // fbink_free_ot_fonts
+	SOCK_DUMP_TO_FILE,              // fbink_dump or fbink_region_dump, then fbink_dump_to_file
+					//	Payload: an FBInkSocketDump, then a path
+	SOCK_RESTORE_FROM_FILE,         // fbink_restore_from_file
+					//	Payload: a path
+	SOCK_GET_BACK_BUFFER,           // fbink_get_back_buffer
+	SOCK_PRESENT,                   // fbink_present
+					//	Payload: an FBInkRect
+	SOCK_RELEASE_BACK_BUFFER,       // fbink_release_back_buffer
+	SOCK_SHARE_BACK_BUFFER,         // fbink_share_back_buffer
+					//	Reply payload: an FBInkSharedBuffer
+					//	The fd itself is sent as SCM_RIGHTS ancillary data alongside the reply
+					//	(the fd field is meaningless on the client's side).
+					//	mmap it (MAP_SHARED), draw to it directly,
+					//	then send a SOCK_PRESENT with the region you touched.
+	SOCK_REFRESH_ASYNC,             // fbink_refresh_async (without a callback)
+					//	Payload: an FBInkSocketRefresh
+					//	rv is 0 if the update was sent, its marker is the reply's marker:
+					//	pass it to SOCK_WAIT_FOR_COMPLETE to wait for it.
+	SOCK_FIT_OT,                    // fbink_fit_ot
+					//	Payload: an FBInkSocketFitOT, then a string
+					//	Reply payload: an FBInkOTFit
+	SOCK_SET_OT_CACHE_SIZE,         // fbink_set_ot_cache_size
+					//	Payload: an uint64_t (max_size)
+	SOCK_TRIM_SCRATCH,              // fbink_trim_scratch
+					//	Reply payload: an uint64_t (the amount of memory that was released)
+	SOCK_SET_IMAGE_THREADS,         // fbink_set_image_threads
+					//	Payload: an uint8_t (threads)
+	SOCK_NEW_OT_LAYOUT,             // fbink_new_ot_layout
+					//	Payload: an FBInkOTConfig
+					//	Reply payload: an uint32_t (handle to the new layout, never 0)
+					//	Handles are only valid on the connection that created them,
+					//	and the server frees whatever layouts are left when a client disconnects.
+	SOCK_SET_OT_LAYOUT_TEXT,        // fbink_set_ot_layout_text
+					//	Payload: an uint32_t (layout handle), then a string
+					//	Reply payload: an FBInkOTFit
+	SOCK_APPEND_OT_LAYOUT_TEXT,     // fbink_append_ot_layout_text
+					//	Payload: an uint32_t (layout handle), then a string
+					//	Reply payload: an FBInkOTFit
+	SOCK_RENDER_OT_LAYOUT,          // fbink_render_ot_layout
+					//	Payload: an uint32_t (layout handle)
+	SOCK_FREE_OT_LAYOUT,            // fbink_free_ot_layout
+					//	Payload: an uint32_t (layout handle)
+	NB_SOCK_OPS                     // Keep last ;)
+} SOCKET_OP_INDEX_T;
+
+// Request header
+typedef struct
+{
+	uint32_t    len;          // Size of the payload that follows, in bytes
+	uint16_t    op;           // c.f., SOCKET_OP_INDEX_T enum
+	uint16_t    version;      // MUST be FBINK_SOCKET_VERSION
+	FBInkConfig fbink_cfg;    // Passed to the API call, if it takes one
+				  // NOTE: Fields that require an fbink_init are honored (the server will re-init as needed),
+				  //       but is_verbose, is_quiet & to_syslog are the server's to decide.
+} FBInkSocketRequest;
+
+// Reply header
+typedef struct
+{
+	int32_t   rv;           // What the API call returned (or a negative errno if the request itself was rejected)
+	uint32_t  marker;       // fbink_get_last_marker after the call
+	FBInkRect last_rect;    // fbink_get_last_rect after the call
+	uint32_t  len;          // Size of the payload that follows, in bytes
+} FBInkSocketReply;
+
+// Payload of SOCK_PRINT_IMAGE & SOCK_PRINT_RAW_DATA
+typedef struct
+{
+	int32_t   w;      // Raw data only
+	int32_t   h;      // Raw data only
+	uint64_t  len;    // Raw data only (*exact* size of the pixel data at the start of the fd, c.f., fbink_print_raw_data)
+	short int x_off;
+	short int y_off;
+} FBInkSocketImage;
+
+// Payload of SOCK_REFRESH
+typedef struct
+{
+	uint32_t region_top;
+	uint32_t region_left;
+	uint32_t region_width;
+	uint32_t region_height;
+	uint8_t  dithering_mode;    // c.f., HW_DITHER_INDEX_T enum
+} FBInkSocketRefresh;
+
+// Payload of SOCK_DUMP_TO_FILE
+typedef struct
+{
+	short int          x_off;    // Region dumps only
+	short int          y_off;    // Region dumps only
+	unsigned short int w;        // If either w or h is 0, the full screen is dumped
+	unsigned short int h;
+	bool               is_compressed;    // c.f., FBInkDump
+} FBInkSocketDump;
+
+// Payload of SOCK_FIT_OT
+typedef struct
+{
+	FBInkOTConfig      cfg;
+	unsigned short int max_lines;
+	unsigned short int min_size_px;
+	unsigned short int max_size_px;
+} FBInkSocketFitOT;
+
+#endif
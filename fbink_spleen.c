@@ -24,32 +24,15 @@
 static const uint16_t*
     spleen_get_bitmap(uint32_t codepoint)
 {
-	if (codepoint >= 0x20u && codepoint <= 0x7fu) {
-		return spleen_block1[codepoint - 0x20u];
-	} else if (codepoint >= 0xa0u && codepoint <= 0x17fu) {
-		return spleen_block2[codepoint - 0xa0u];
-	} else if (codepoint >= 0x2018u && codepoint <= 0x2019u) {
-		return spleen_block3[codepoint - 0x2018u];
-	} else if (codepoint >= 0x201cu && codepoint <= 0x201du) {
-		return spleen_block4[codepoint - 0x201cu];
-	} else if (codepoint == 0x2022u) {
-		return spleen_block5[0];
-	} else if (codepoint == 0x2026u) {
-		return spleen_block6[0];
-	} else if (codepoint == 0x20acu) {
-		return spleen_block7[0];
-	} else if (codepoint >= 0x2500u && codepoint <= 0x259fu) {
-		return spleen_block8[codepoint - 0x2500u];
-	} else if (codepoint >= 0x2630u && codepoint <= 0x2637u) {
-		return spleen_block9[codepoint - 0x2630u];
-	} else if (codepoint >= 0x2800u && codepoint <= 0x28ffu) {
-		return spleen_block10[codepoint - 0x2800u];
-	} else if (codepoint >= 0xe0a0u && codepoint <= 0xe0a2u) {
-		return spleen_block11[codepoint - 0xe0a0u];
-	} else if (codepoint >= 0xe0b0u && codepoint <= 0xe0b3u) {
-		return spleen_block12[codepoint - 0xe0b0u];
-	} else {
+	const uint32_t page = codepoint >> 8U;
+	const uint8_t  slot = page <= 0xe0u ? spleen_page_index[page] : 0U;
+	const uint32_t word = (codepoint >> 5U) & 0x07U;
+	const uint32_t bit  = 1U << (codepoint & 0x1FU);
+	const uint32_t bits = spleen_page_bits[slot][word];
+	if (!(bits & bit)) {
 		WARN("Codepoint U+%04X (%s) is not covered by this font", codepoint, u8_cp_to_utf8(codepoint));
-		return spleen_block1[0];
+		return spleen_glyphs[0];
 	}
+	const uint32_t glyph = spleen_page_base[slot][word] + (uint32_t) __builtin_popcount(bits & (bit - 1U));
+	return spleen_glyphs[glyph];
 }
@@ -23,6 +23,7 @@
 #define __FBINK_TYPES_H
 
 #include <stdbool.h>
+#include <stddef.h>
 #include <stdint.h>
 
 #ifdef FBINK_WITH_OPENTYPE
@@ -40,13 +41,11 @@ typedef struct
 	char               deviceName[16];
 	char               deviceCodename[16];
 	char               devicePlatform[16];
-	bool               isPerfectFit;
 	bool               isKindleLegacy;
 	bool               isKindlePearlScreen;
 	bool               isKindleZelda;
 	bool               isKindleRex;
 	bool               isKoboNonMT;
-	bool               isNTX16bLandscape;
 	bool               isKoboMk7;
 	int8_t             koboVertOffset;
 	uint8_t            ntxBootRota;
@@ -63,6 +62,36 @@ typedef struct
 	unsigned short int y;
 } FBInkCoordinates;
 
+// An horizontal run of pixels, as seen by the caller (i.e., before rotation),
+// resolved to its on-screen part, in physical framebuffer coordinates (i.e., after rotation).
+typedef struct
+{
+	unsigned short int x;       // Physical coordinates of the first on-screen pixel
+	unsigned short int y;
+	short int          dx;      // Physical offset between two consecutive pixels of the run
+	short int          dy;      // (i.e., (1, 0) when unrotated, (0, 1) or (0, -1) when rotated).
+	unsigned short int skip;    // Amount of pixels clipped off the start of the run
+	unsigned short int len;     // Amount of on-screen pixels
+} FBInkSpan;
+
+// A refresh request, as queued in deferred refresh mode
+typedef struct
+{
+	struct mxcfb_rect region;    // Already rotated
+	uint32_t          waveform_mode;
+	int               dithering_mode;
+	bool              is_nightmode;
+	bool              is_flashing;
+} FBInkRefreshRequest;
+
+// An update sent by fbink_refresh_async, as tracked by the async refresh worker
+typedef struct
+{
+	uint32_t             marker;
+	FBInkRefreshCallback callback;
+	void*                userdata;
+} FBInkAsyncRefresh;
+
 // A color, as an (r, g, b) triplet for an 8-bit per component, 3 channel color
 // NOTE: For grayscale, r = g = b (= v), so we assume v is r for simplicity's sake.
 typedef struct
@@ -155,6 +184,42 @@ typedef union
 	} gray4;
 } FBInkPixel;
 
+// A direct-mapped cache of fixed-cell glyphs, pre-scaled & already converted to the fb's pixel format
+// NOTE: We only store glyphHeight rows per cell, since vertical scaling just means plotting each row FONTSIZE_MULT times.
+typedef struct
+{
+	uint8_t*  cells;         // nslots cells of cell_len bytes
+	uint32_t* codepoints;    // The codepoint stored in each slot (GLYPH_CACHE_EMPTY if none)
+	size_t    row_len;       // Size of a row of FONTW pixels in the fb's pixel format, in bytes
+	size_t    cell_len;      // Size of a full cell (glyphHeight rows), in bytes
+	uint16_t  nslots;        // Always a power of two
+	// What the cached cells depend on, if any of these change, the cache is flushed
+	uint8_t   fontname;
+	uint8_t   fontmult;
+	uint8_t   fg;
+	uint8_t   bg;
+	uint8_t   bpp;
+} FBInkGlyphCache;
+
+// Header of a dump file (c.f., fbink_dump_to_file), followed by the dump's data, as-is
+// NOTE: Fixed-width fields in native byte order, padded so that the data that follows stays 8-byte aligned.
+typedef struct
+{
+	char     magic[8];    // FBINK_DUMP_MAGIC, *not* NUL-terminated
+	uint32_t version;     // FBINK_DUMP_VERSION
+	uint32_t stride;      // Size of a row of data, in bytes (0 for compressed dumps, whose rows are packed)
+	uint64_t size;        // Size of the data, in bytes
+	uint16_t left;
+	uint16_t top;
+	uint16_t width;
+	uint16_t height;
+	uint8_t  rota;
+	uint8_t  bpp;
+	uint8_t  is_full;
+	uint8_t  is_compressed;
+	uint8_t  padding[4];
+} FBInkDumpFileHeader;
+
 #ifdef FBINK_WITH_OPENTYPE
 // Stores the information necessary to render a line of text
 // using OpenType/TrueType fonts
@@ -167,6 +232,14 @@ typedef struct FBInkOTLine
 	bool   has_a_break;
 } FBInkOTLine;
 
+// A loaded font: stbtt's own state, plus what we need to unmap the font file
+// NOTE: info *must* stay the first member, as we only pass pointers to it around.
+typedef struct FBInkOTFont
+{
+	stbtt_fontinfo info;
+	size_t         data_len;    // Size of the mapping backing info.data
+} FBInkOTFont;
+
 typedef struct FBInkOTFonts
 {
 	stbtt_fontinfo* otRegular;
@@ -175,6 +248,43 @@ typedef struct FBInkOTFonts
 	stbtt_fontinfo* otBoldItalic;
 } FBInkOTFonts;
 
+// A glyph, as cached by the OpenType renderer (metrics, and, if we've needed it yet, its coverage mask)
+typedef struct FBInkOTGlyph
+{
+	struct FBInkOTGlyph*  hash_next;    // Next glyph in the same hash bucket
+	struct FBInkOTGlyph*  lru_prev;     // Previous glyph in the LRU list (i.e., more recently used)
+	struct FBInkOTGlyph*  lru_next;     // Next glyph in the LRU list (i.e., less recently used)
+	const stbtt_fontinfo* font;         // The key is (font, sf, gi)
+	float                 sf;
+	int                   gi;
+	int                   adv;       // Unscaled, as returned by stbtt_GetGlyphHMetrics
+	int                   lsb;
+	int                   x0;        // Already scaled, as returned by stbtt_GetGlyphBitmapBox
+	int                   y0;
+	int                   x1;
+	int                   y1;
+	unsigned char*        bitmap;    // (x1 - x0) * (y1 - y0) coverage mask, NULL until rendered (or if empty)
+} FBInkOTGlyph;
+
+// A bounded, LRU cache of FBInkOTGlyph
+typedef struct
+{
+	FBInkOTGlyph** buckets;
+	FBInkOTGlyph*  lru_head;    // Most recently used
+	FBInkOTGlyph*  lru_tail;    // Least recently used, first to go
+	size_t         size;        // Current memory usage of the glyphs, in bytes
+	size_t         max_size;
+	size_t         entries;
+	uint64_t       hits;
+	uint64_t       misses;
+	uint64_t       evictions;
+	// Used when a glyph can't be cached (i.e., it wouldn't fit in the budget, or we ran out of memory).
+	// Only valid until the next lookup.
+	FBInkOTGlyph   scratch;
+	unsigned char* scratch_buff;    // Backs scratch.bitmap
+	size_t         scratch_len;
+} FBInkOTGlyphCache;
+
 typedef enum
 {
 	CH_IGNORE = 0U,
@@ -183,6 +293,130 @@ typedef enum
 	CH_BOLD,
 	CH_BOLD_ITALIC
 } CHARACTER_FONT_T;
+
+// Per-character, size-independent metrics, as gathered once by fbink_fit_ot
+// NOTE: Everything is unscaled (i.e., in font units), the probes simply scale these on the fly.
+typedef struct
+{
+	int     adv;     // As returned by stbtt_GetGlyphHMetrics
+	int     kern;    // Against the next character, as returned by stbtt_GetGlyphKernAdvance
+	int     x0;      // As returned by stbtt_GetGlyphBox (all zeroes for empty glyphs)
+	int     y0;
+	int     x1;
+	int     y1;
+	uint8_t style;    // c.f., CHARACTER_FONT_T enum
+} FBInkOTFitChar;
+
+// A line of an FBInkOTLayout (offsets are in bytes, in the layout's text)
+typedef struct
+{
+	size_t start;
+	size_t end;     // Exclusive (i.e., a hard break isn't part of the line)
+	size_t next;    // Where the next line starts
+	int    height;
+	int    line_gap;
+} FBInkOTLayoutLine;
+
+// What was last drawn for a line of an FBInkOTLayout (c.f., fbink_render_ot_layout)
+typedef struct
+{
+	char*              text;      // The line's text (formatting markup included), NULL if nothing was drawn
+	unsigned short int y;         // Relative to the top of the printable area
+	unsigned short int height;    // Including the line gap
+} FBInkOTDrawnLine;
+
+// c.f., fbink_new_ot_layout
+struct FBInkOTLayout
+{
+	FBInkOTConfig      cfg;
+	FBInkCoordinates   tl;    // Printable area, as computed by ot_compute_area
+	FBInkCoordinates   br;
+	unsigned short int max_lw;
+	unsigned int       print_height;
+	unsigned short int font_size_px;
+	float              sfs[CH_BOLD_ITALIC + 1];    // Indexed by CHARACTER_FONT_T
+	int                max_baseline;
+	int                max_lg;
+	int                max_row_height;
+	// Everything below is indexed by byte offset in text, and sized for capacity bytes
+	char*              text;
+	size_t             len;
+	size_t             capacity;
+	char*              brk_buff;
+	unsigned char*     fmt_buff;    // NULL if !cfg.is_formatted
+	FBInkOTFitChar*    chars;
+	FBInkOTLayoutLine* lines;
+	size_t             lines_count;
+	size_t             lines_capacity;
+	bool               is_truncated;
+	FBInkOTDrawnLine*  drawn;
+	size_t             drawn_count;
+	size_t             drawn_capacity;
+};
 #endif    // FBINK_WITH_OPENTYPE
 
+// Header of a scratch arena overflow block, for requests that didn't fit in the arena itself.
+// NOTE: The union ensures the data that follows it is suitably aligned for anything.
+typedef union FBInkScratchBlock
+{
+	union FBInkScratchBlock* next;
+	max_align_t              align;
+} FBInkScratchBlock;
+
+// Scratch memory for the print functions, reused across calls (c.f., scratch_alloc & fbink_trim_scratch)
+typedef struct
+{
+	unsigned char*     base;
+	size_t             size;            // Size of base
+	size_t             used;            // How much of base is currently handed out
+	size_t             peak;            // Largest amount of scratch memory ever needed at once (base grows to that)
+	FBInkScratchBlock* overflow;        // Overflow blocks currently handed out, most recent first
+	size_t             overflow_len;    // Their combined size
+} FBInkScratchArena;
+
+// Snapshot of the arena, to give back everything that was allocated since then in one go (c.f., scratch_release)
+typedef struct
+{
+	size_t             used;
+	FBInkScratchBlock* overflow;
+	size_t             overflow_len;
+} FBInkScratchMark;
+
+// Processes the [start, end) rows of a job (c.f., run_bands)
+typedef void (*FBInkBandFn)(const void*, unsigned short int, unsigned short int);
+
+// A job for the band workers: rows [start, end), split in bands of band_rows rows
+typedef struct
+{
+	FBInkBandFn        fn;
+	const void*        arg;
+	FBInkContext*      ctx;    // The caller's, so the workers draw to the same target
+	unsigned short int start;
+	unsigned short int end;
+	unsigned short int band_rows;
+	uint8_t            bands;
+	uint8_t            next;    // Next band up for grabs
+	uint8_t            done;    // How many bands have been processed
+} FBInkBandJob;
+
+// Everything draw_image_band needs to know about the image it's blitting
+typedef struct
+{
+	const unsigned char* data;
+	int                  w;
+	int                  req_n;
+	short int            x_off;
+	short int            y_off;
+	unsigned short int   img_x_off;
+	unsigned short int   max_width;
+	uint8_t              invert;
+	uint32_t             invert_rgb;
+	bool                 fb_is_grayscale;
+	bool                 fb_is_legacy;
+	bool                 fb_is_24bpp;
+	bool                 fb_is_true_bgr;
+	bool                 img_has_alpha;
+	const FBInkConfig*   fbink_cfg;
+} FBInkImageBlit;
+
 #endif
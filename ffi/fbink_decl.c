@@ -8,6 +8,7 @@
 
 // Constants
 cdecl_const(FBFD_AUTO)
+cdecl_const(FBFD_CANVAS)
 cdecl_const(LAST_MARKER)
 
 // Typedefs
@@ -31,11 +32,20 @@ cdecl_type(FBInkConfig)
 
 cdecl_type(FBInkOTConfig)
 cdecl_type(FBInkOTFit)
+cdecl_type(FBInkContext)
+cdecl_type(FBInkOTLayout)
+cdecl_type(FBInkOTCacheStats)
 
 cdecl_type(FBInkRect)
 
 cdecl_type(FBInkDump)
 
+cdecl_type(FBInkCanvas)
+cdecl_type(FBInkSharedBuffer)
+cdecl_type(FBInkDeviceIdStats)
+
+cdecl_type(FBInkRefreshCallback)
+
 // API
 cdecl_func(fbink_version)
 
@@ -45,12 +55,26 @@ cdecl_func(fbink_init)
 
 cdecl_func(fbink_state_dump)
 cdecl_func(fbink_get_state)
+cdecl_func(fbink_get_device_id_stats)
 
 cdecl_func(fbink_print)
 
 cdecl_func(fbink_add_ot_font)
 cdecl_func(fbink_free_ot_fonts)
+cdecl_func(fbink_set_ot_cache_size)
+cdecl_func(fbink_get_ot_cache_stats)
+cdecl_func(fbink_trim_scratch)
+
+cdecl_func(fbink_open_canvas)
+cdecl_func(fbink_get_canvas_info)
+
 cdecl_func(fbink_print_ot)
+cdecl_func(fbink_fit_ot)
+cdecl_func(fbink_new_ot_layout)
+cdecl_func(fbink_set_ot_layout_text)
+cdecl_func(fbink_append_ot_layout_text)
+cdecl_func(fbink_render_ot_layout)
+cdecl_func(fbink_free_ot_layout)
 
 cdecl_func(fbink_printf)
 
@@ -59,14 +83,25 @@ cdecl_func(fbink_wait_for_submission)
 cdecl_func(fbink_wait_for_complete)
 cdecl_func(fbink_get_last_marker)
 
+cdecl_func(fbink_set_deferred_refresh)
+cdecl_func(fbink_flush)
+
+cdecl_func(fbink_refresh_async)
+cdecl_func(fbink_get_refresh_eventfd)
+cdecl_func(fbink_get_last_completed_marker)
+cdecl_func(fbink_stop_refresh_worker)
+
 //cdecl_func(fbink_is_fb_quirky)
 cdecl_func(fbink_reinit)
+cdecl_func(fbink_start_fb_watcher)
+cdecl_func(fbink_stop_fb_watcher)
 
 cdecl_func(fbink_print_progress_bar)
 cdecl_func(fbink_print_activity_bar)
 
 cdecl_func(fbink_print_image)
 cdecl_func(fbink_print_raw_data)
+cdecl_func(fbink_set_image_threads)
 
 cdecl_func(fbink_cls)
 
@@ -74,8 +109,58 @@ cdecl_func(fbink_dump)
 cdecl_func(fbink_region_dump)
 cdecl_func(fbink_restore)
 cdecl_func(fbink_free_dump_data)
+cdecl_func(fbink_dump_to_file)
+cdecl_func(fbink_restore_from_file)
+
+cdecl_func(fbink_get_back_buffer)
+cdecl_func(fbink_share_back_buffer)
+cdecl_func(fbink_present)
+cdecl_func(fbink_release_back_buffer)
 
 cdecl_func(fbink_get_last_rect)
 
+cdecl_func(fbink_new_context)
+cdecl_func(fbink_free_context)
+cdecl_func(fbink_init_ctx)
+cdecl_func(fbink_reinit_ctx)
+cdecl_func(fbink_open_canvas_ctx)
+cdecl_func(fbink_get_canvas_info_ctx)
+cdecl_func(fbink_close_ctx)
+cdecl_func(fbink_state_dump_ctx)
+cdecl_func(fbink_get_state_ctx)
+cdecl_func(fbink_add_ot_font_ctx)
+cdecl_func(fbink_free_ot_fonts_ctx)
+cdecl_func(fbink_set_ot_cache_size_ctx)
+cdecl_func(fbink_get_ot_cache_stats_ctx)
+cdecl_func(fbink_trim_scratch_ctx)
+cdecl_func(fbink_print_ctx)
+cdecl_func(fbink_print_ot_ctx)
+cdecl_func(fbink_fit_ot_ctx)
+cdecl_func(fbink_new_ot_layout_ctx)
+cdecl_func(fbink_set_ot_layout_text_ctx)
+cdecl_func(fbink_append_ot_layout_text_ctx)
+cdecl_func(fbink_render_ot_layout_ctx)
+cdecl_func(fbink_refresh_ctx)
+cdecl_func(fbink_wait_for_submission_ctx)
+cdecl_func(fbink_wait_for_complete_ctx)
+cdecl_func(fbink_get_last_marker_ctx)
+cdecl_func(fbink_set_deferred_refresh_ctx)
+cdecl_func(fbink_flush_ctx)
+cdecl_func(fbink_refresh_async_ctx)
+cdecl_func(fbink_print_progress_bar_ctx)
+cdecl_func(fbink_print_activity_bar_ctx)
+cdecl_func(fbink_print_image_ctx)
+cdecl_func(fbink_print_raw_data_ctx)
+cdecl_func(fbink_cls_ctx)
+cdecl_func(fbink_dump_ctx)
+cdecl_func(fbink_region_dump_ctx)
+cdecl_func(fbink_restore_ctx)
+cdecl_func(fbink_restore_from_file_ctx)
+cdecl_func(fbink_get_back_buffer_ctx)
+cdecl_func(fbink_share_back_buffer_ctx)
+cdecl_func(fbink_present_ctx)
+cdecl_func(fbink_release_back_buffer_ctx)
+cdecl_func(fbink_get_last_rect_ctx)
+
 cdecl_func(fbink_button_scan)
 cdecl_func(fbink_wait_for_usbms_processing)
@@ -4,7 +4,7 @@
 * With FBInk's tools/hextoc.py
 */
 
-static const unsigned char alt_block1[][8] = {
+static const unsigned char alt_glyphs[][8] = {
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+0000 (ESC)
 	{ 0x07, 0x01, 0x57, 0x54, 0x77, 0x50, 0x50, 0x00 },	// U+0001 (ESC)
 	{ 0x07, 0x01, 0x57, 0x54, 0x27, 0x50, 0x50, 0x00 },	// U+0002 (ESC)
@@ -411,9 +411,6 @@ static const unsigned char alt_block1[][8] = {
 	{ 0x60, 0x3e, 0x03, 0x03, 0x3b, 0x33, 0x3e, 0x00 },	// U+0193 (Ɠ)
 	{ 0x63, 0x63, 0x63, 0x36, 0x1c, 0x36, 0x1c, 0x00 },	// U+0194 (Ɣ)
 	{ 0x03, 0x03, 0xcf, 0xdb, 0xdb, 0xdb, 0x73, 0x00 },	// U+0195 (ƕ)
-}; // 406
-
-static const unsigned char alt_block2[][8] = {
 	{ 0x7e, 0x18, 0x18, 0x7e, 0x18, 0x18, 0x7e, 0x00 },	// U+0197 (Ɨ)
 	{ 0x73, 0x5b, 0x1b, 0x0f, 0x1b, 0x33, 0x33, 0x00 },	// U+0198 (Ƙ)
 	{ 0x3c, 0x06, 0x66, 0x36, 0x1e, 0x36, 0x66, 0x00 },	// U+0199 (ƙ)
@@ -423,9 +420,6 @@ static const unsigned char alt_block2[][8] = {
 	{ 0x63, 0x67, 0x6f, 0x7f, 0x7b, 0x73, 0x63, 0x03 },	// U+019D (Ɲ)
 	{ 0x00, 0x00, 0x3e, 0x66, 0x66, 0x66, 0x66, 0x60 },	// U+019E (ƞ)
 	{ 0x3c, 0x66, 0x66, 0x7e, 0x66, 0x66, 0x3c, 0x00 },	// U+019F (Ɵ)
-}; // 9
-
-static const unsigned char alt_block3[][8] = {
 	{ 0x66, 0x18, 0x00, 0x3c, 0x66, 0x7e, 0x66, 0x00 },	// U+01CD (Ǎ)
 	{ 0x66, 0x18, 0x00, 0x7c, 0x66, 0x63, 0x7e, 0x00 },	// U+01CE (ǎ)
 	{ 0x66, 0x18, 0x00, 0x7e, 0x18, 0x18, 0x7e, 0x00 },	// U+01CF (Ǐ)
@@ -449,24 +443,12 @@ static const unsigned char alt_block3[][8] = {
 	{ 0x7f, 0x36, 0x00, 0x7c, 0x66, 0x63, 0x7e, 0x00 },	// U+01E1 (ǡ)
 	{ 0x7e, 0x00, 0xfe, 0x33, 0x7f, 0x33, 0xf3, 0x00 },	// U+01E2 (Ǣ)
 	{ 0x7e, 0x00, 0x7e, 0xd8, 0xfe, 0x1b, 0xee, 0x00 },	// U+01E3 (ǣ)
-}; // 23
-
-static const unsigned char alt_block4[][8] = {
 	{ 0x66, 0x18, 0x00, 0x7c, 0x06, 0x66, 0x7c, 0x00 },	// U+01E6 (Ǧ)
 	{ 0x66, 0x18, 0x00, 0x7c, 0x66, 0x7c, 0x60, 0x3e },	// U+01E7 (ǧ)
 	{ 0x66, 0x18, 0x00, 0x73, 0x1f, 0x33, 0x63, 0x00 },	// U+01E8 (Ǩ)
-}; // 3
-
-static const unsigned char alt_block5[][8] = {
 	{ 0x66, 0x18, 0x00, 0x30, 0x30, 0x30, 0x30, 0x1e },	// U+01F0 (ǰ)
-}; // 1
-
-static const unsigned char alt_block6[][8] = {
 	{ 0x70, 0x00, 0x7c, 0x06, 0x76, 0x66, 0x7c, 0x00 },	// U+01F4 (Ǵ)
 	{ 0x70, 0x00, 0x7c, 0x66, 0x66, 0x7c, 0x60, 0x3e },	// U+01F5 (ǵ)
-}; // 2
-
-static const unsigned char alt_block7[][8] = {
 	{ 0x0e, 0x00, 0x63, 0x67, 0x6f, 0x7b, 0x73, 0x00 },	// U+01F8 (Ǹ)
 	{ 0x0e, 0x00, 0x3e, 0x66, 0x66, 0x66, 0x66, 0x00 },	// U+01F9 (ǹ)
 	{ 0x66, 0x36, 0x00, 0x3c, 0x66, 0x7e, 0x66, 0x00 },	// U+01FA (Ǻ)
@@ -503,14 +485,8 @@ static const unsigned char alt_block7[][8] = {
 	{ 0x00, 0x00, 0x3c, 0x06, 0x3c, 0x60, 0x3e, 0x0c },	// U+0219 (ș)
 	{ 0x7e, 0x5a, 0x18, 0x18, 0x18, 0x18, 0x3c, 0x0c },	// U+021A (Ț)
 	{ 0x08, 0x0c, 0x3e, 0x0c, 0x0c, 0x6c, 0x38, 0x0c },	// U+021B (ț)
-}; // 36
-
-static const unsigned char alt_block8[][8] = {
 	{ 0x18, 0x00, 0x3c, 0x66, 0x7e, 0x66, 0x66, 0x00 },	// U+0226 (Ȧ)
 	{ 0x18, 0x00, 0x3c, 0x60, 0x7c, 0x66, 0x7c, 0x00 },	// U+0227 (ȧ)
-}; // 2
-
-static const unsigned char alt_block9[][8] = {
 	{ 0x7f, 0x36, 0x00, 0x3e, 0x63, 0x63, 0x3e, 0x00 },	// U+022A (Ȫ)
 	{ 0x7f, 0x36, 0x00, 0x3c, 0x66, 0x66, 0x3c, 0x00 },	// U+022B (ȫ)
 	{ 0x7f, 0x26, 0x19, 0x3e, 0x63, 0x63, 0x3e, 0x00 },	// U+022C (Ȭ)
@@ -521,42 +497,15 @@ static const unsigned char alt_block9[][8] = {
 	{ 0x7f, 0x36, 0x00, 0x3c, 0x66, 0x66, 0x3c, 0x00 },	// U+0231 (ȱ)
 	{ 0x7e, 0x00, 0x66, 0x66, 0x3c, 0x18, 0x18, 0x00 },	// U+0232 (Ȳ)
 	{ 0x7e, 0x00, 0x66, 0x66, 0x66, 0x7c, 0x60, 0x3c },	// U+0233 (ȳ)
-}; // 10
-
-static const unsigned char alt_block10[][8] = {
 	{ 0x00, 0x00, 0x3c, 0x66, 0x7e, 0x60, 0x3c, 0x00 },	// U+0258 (ɘ)
 	{ 0x00, 0x00, 0x3c, 0x60, 0x7e, 0x66, 0x3c, 0x00 },	// U+0259 (ə)
-}; // 2
-
-static const unsigned char alt_block11[][8] = {
 	{ 0x00, 0x00, 0x63, 0x63, 0x36, 0x1c, 0x36, 0x1c },	// U+0263 (ɣ)
-}; // 1
-
-static const unsigned char alt_block12[][8] = {
 	{ 0x3c, 0x66, 0x60, 0x30, 0x18, 0x18, 0x18, 0x00 },	// U+0294 (ʔ)
-}; // 1
-
-static const unsigned char alt_block13[][8] = {
 	{ 0x18, 0x66, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+02C6 (ˆ)
-}; // 1
-
-static const unsigned char alt_block14[][8] = {
 	{ 0x3c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+02C9 (ˉ)
-}; // 1
-
-static const unsigned char alt_block15[][8] = {
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3c },	// U+02CD (ˍ)
-}; // 1
-
-static const unsigned char alt_block16[][8] = {
 	{ 0x7f, 0x26, 0x19, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+02DC (˜)
-}; // 1
-
-static const unsigned char alt_block17[][8] = {
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+034F (͏)
-}; // 1
-
-static const unsigned char alt_block18[][8] = {
 	{ 0x18, 0x3c, 0x66, 0x66, 0x7e, 0x66, 0x66, 0x00 },	// U+0391 (Α)
 	{ 0x3e, 0x66, 0x66, 0x3e, 0x66, 0x66, 0x3e, 0x00 },	// U+0392 (Β)
 	{ 0x7f, 0x63, 0x03, 0x03, 0x03, 0x03, 0x03, 0x00 },	// U+0393 (Γ)
@@ -574,9 +523,6 @@ static const unsigned char alt_block18[][8] = {
 	{ 0x3c, 0x66, 0x66, 0x66, 0x66, 0x66, 0x3c, 0x00 },	// U+039F (Ο)
 	{ 0x7f, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x00 },	// U+03A0 (Π)
 	{ 0x3e, 0x66, 0x66, 0x3e, 0x06, 0x06, 0x06, 0x00 },	// U+03A1 (Ρ)
-}; // 17
-
-static const unsigned char alt_block19[][8] = {
 	{ 0x7e, 0x66, 0x0c, 0x18, 0x0c, 0x66, 0x7e, 0x00 },	// U+03A3 (Σ)
 	{ 0x7e, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x00 },	// U+03A4 (Τ)
 	{ 0x66, 0x66, 0x66, 0x3c, 0x18, 0x18, 0x18, 0x00 },	// U+03A5 (Υ)
@@ -584,9 +530,6 @@ static const unsigned char alt_block19[][8] = {
 	{ 0xc3, 0x66, 0x3c, 0x18, 0x3c, 0x66, 0xc3, 0x00 },	// U+03A7 (Χ)
 	{ 0x08, 0x6b, 0x6b, 0x6b, 0x6b, 0x3e, 0x08, 0x00 },	// U+03A8 (Ψ)
 	{ 0x1c, 0x36, 0x63, 0x63, 0x36, 0x36, 0x77, 0x00 },	// U+03A9 (Ω)
-}; // 7
-
-static const unsigned char alt_block20[][8] = {
 	{ 0x00, 0x00, 0x6e, 0x3b, 0x13, 0x3b, 0x6e, 0x00 },	// U+03B1 (α)
 	{ 0x00, 0x3c, 0x66, 0x3e, 0x66, 0x3e, 0x06, 0x06 },	// U+03B2 (β)
 	{ 0x00, 0x00, 0x66, 0x66, 0x3c, 0x66, 0x66, 0x3c },	// U+03B3 (γ)
@@ -612,21 +555,12 @@ static const unsigned char alt_block20[][8] = {
 	{ 0x00, 0x67, 0x3c, 0x18, 0x1c, 0x36, 0xe3, 0x00 },	// U+03C7 (χ)
 	{ 0x00, 0x00, 0xc3, 0xdb, 0xdb, 0x7e, 0x18, 0x18 },	// U+03C8 (ψ)
 	{ 0x00, 0x00, 0x66, 0xc3, 0xdb, 0xdb, 0x7e, 0x00 },	// U+03C9 (ω)
-}; // 25
-
-static const unsigned char alt_block21[][8] = {
 	{ 0x0e, 0x00, 0x3c, 0x66, 0x7e, 0x66, 0x66, 0x00 },	// U+0400 (Ѐ)
 	{ 0x66, 0x00, 0x3c, 0x66, 0x7e, 0x66, 0x66, 0x00 },	// U+0401 (Ё)
-}; // 2
-
-static const unsigned char alt_block22[][8] = {
 	{ 0x1e, 0x33, 0x03, 0x3e, 0x60, 0x63, 0x3e, 0x00 },	// U+0405 (Ѕ)
 	{ 0x7e, 0x18, 0x18, 0x18, 0x18, 0x18, 0x7e, 0x00 },	// U+0406 (І)
 	{ 0x66, 0x00, 0x7e, 0x18, 0x18, 0x18, 0x7e, 0x00 },	// U+0407 (Ї)
 	{ 0x7c, 0x30, 0x30, 0x30, 0x33, 0x33, 0x1e, 0x00 },	// U+0408 (Ј)
-}; // 4
-
-static const unsigned char alt_block23[][8] = {
 	{ 0x18, 0x3c, 0x66, 0x66, 0x7e, 0x66, 0x66, 0x00 },	// U+0410 (А)
 	{ 0x7e, 0x06, 0x06, 0x3e, 0x66, 0x66, 0x3e, 0x00 },	// U+0411 (Б)
 	{ 0x3e, 0x66, 0x66, 0x3e, 0x66, 0x66, 0x3e, 0x00 },	// U+0412 (В)
@@ -693,16 +627,10 @@ static const unsigned char alt_block23[][8] = {
 	{ 0x00, 0x00, 0x7c, 0x66, 0x7c, 0x6c, 0x66, 0x00 },	// U+044F (я)
 	{ 0x0e, 0x00, 0x3c, 0x66, 0x7e, 0x06, 0x3c, 0x00 },	// U+0450 (ѐ)
 	{ 0x66, 0x00, 0x3c, 0x66, 0x7e, 0x06, 0x3c, 0x00 },	// U+0451 (ё)
-}; // 66
-
-static const unsigned char alt_block24[][8] = {
 	{ 0x00, 0x00, 0x3c, 0x06, 0x3c, 0x60, 0x3e, 0x00 },	// U+0455 (ѕ)
 	{ 0x18, 0x00, 0x18, 0x18, 0x18, 0x18, 0x30, 0x00 },	// U+0456 (і)
 	{ 0x66, 0x00, 0x1c, 0x18, 0x18, 0x18, 0x3c, 0x00 },	// U+0457 (ї)
 	{ 0x60, 0x00, 0x70, 0x60, 0x60, 0x66, 0x66, 0x3c },	// U+0458 (ј)
-}; // 4
-
-static const unsigned char alt_block25[][8] = {
 	{ 0x63, 0x3e, 0x00, 0x3c, 0x66, 0x7e, 0x66, 0x00 },	// U+04D0 (Ӑ)
 	{ 0x63, 0x3e, 0x00, 0x7c, 0x66, 0x63, 0x7e, 0x00 },	// U+04D1 (ӑ)
 	{ 0x66, 0x00, 0x3c, 0x66, 0x7e, 0x66, 0x66, 0x00 },	// U+04D2 (Ӓ)
@@ -711,18 +639,9 @@ static const unsigned char alt_block25[][8] = {
 	{ 0x00, 0x00, 0x7e, 0xd8, 0xfe, 0x1b, 0xee, 0x00 },	// U+04D5 (ӕ)
 	{ 0x63, 0x3e, 0x00, 0x7f, 0x0f, 0x03, 0x7f, 0x00 },	// U+04D6 (Ӗ)
 	{ 0x63, 0x3e, 0x00, 0x3c, 0x7e, 0x06, 0x3c, 0x00 },	// U+04D7 (ӗ)
-}; // 8
-
-static const unsigned char alt_block26[][8] = {
 	{ 0x66, 0x00, 0x3e, 0x63, 0x63, 0x63, 0x3e, 0x00 },	// U+04E6 (Ӧ)
 	{ 0x66, 0x00, 0x3c, 0x66, 0x66, 0x66, 0x3c, 0x00 },	// U+04E7 (ӧ)
-}; // 2
-
-static const unsigned char alt_block27[][8] = {
 	{ 0x66, 0x00, 0x66, 0x66, 0x66, 0x7c, 0x60, 0x3c },	// U+04F1 (ӱ)
-}; // 1
-
-static const unsigned char alt_block28[][8] = {
 	{ 0x00, 0x66, 0x6e, 0x3c, 0x76, 0x66, 0x00, 0x00 },	// U+05D0 (א)
 	{ 0x00, 0x3e, 0x30, 0x30, 0x30, 0x7e, 0x00, 0x00 },	// U+05D1 (ב)
 	{ 0x00, 0x78, 0x60, 0x70, 0x78, 0x6c, 0x00, 0x00 },	// U+05D2 (ג)
@@ -750,13 +669,7 @@ static const unsigned char alt_block28[][8] = {
 	{ 0x00, 0x1e, 0x30, 0x30, 0x30, 0x30, 0x00, 0x00 },	// U+05E8 (ר)
 	{ 0x00, 0x6b, 0x6b, 0x6b, 0x6b, 0x7f, 0x00, 0x00 },	// U+05E9 (ש)
 	{ 0x00, 0x7c, 0x6c, 0x6c, 0x6c, 0x6e, 0x00, 0x00 },	// U+05EA (ת)
-}; // 27
-
-static const unsigned char alt_block29[][8] = {
 	{ 0x18, 0x0c, 0x10, 0x10, 0x10, 0x10, 0x00, 0x00 },	// U+0623 (أ)
-}; // 1
-
-static const unsigned char alt_block30[][8] = {
 	{ 0x10, 0x10, 0x10, 0x10, 0x10, 0x00, 0x00, 0x00 },	// U+0627 (ا)
 	{ 0x00, 0x00, 0x81, 0x81, 0x7e, 0x00, 0x18, 0x00 },	// U+0628 (ب)
 	{ 0xd8, 0x00, 0xf0, 0x90, 0xf0, 0x00, 0x00, 0x00 },	// U+0629 (ة)
@@ -764,9 +677,6 @@ static const unsigned char alt_block30[][8] = {
 	{ 0x18, 0x66, 0x00, 0x81, 0x7e, 0x00, 0x00, 0x00 },	// U+062B (ث)
 	{ 0x00, 0x00, 0x38, 0x40, 0xf8, 0x04, 0x34, 0xf8 },	// U+062C (ج)
 	{ 0x00, 0x00, 0x38, 0x40, 0xf8, 0x04, 0x04, 0xf8 },	// U+062D (ح)
-}; // 7
-
-static const unsigned char alt_block31[][8] = {
 	{ 0x00, 0x20, 0x40, 0x88, 0xf8, 0x00, 0x00, 0x00 },	// U+062F (د)
 	{ 0x0c, 0x20, 0x40, 0x88, 0xf8, 0x00, 0x00, 0x00 },	// U+0630 (ذ)
 	{ 0x00, 0x00, 0x00, 0x80, 0x80, 0x40, 0x3c, 0x00 },	// U+0631 (ر)
@@ -774,16 +684,10 @@ static const unsigned char alt_block31[][8] = {
 	{ 0x00, 0x00, 0x00, 0xaa, 0xfa, 0x0a, 0x04, 0x00 },	// U+0633 (س)
 	{ 0x20, 0x50, 0x00, 0xaa, 0xfa, 0x0a, 0x04, 0x00 },	// U+0634 (ش)
 	{ 0x00, 0x00, 0xe0, 0x9a, 0xfa, 0x0a, 0x04, 0x00 },	// U+0635 (ص)
-}; // 7
-
-static const unsigned char alt_block32[][8] = {
 	{ 0x08, 0x08, 0xe8, 0x98, 0xff, 0x00, 0x00, 0x00 },	// U+0637 (ط)
 	{ 0x68, 0x08, 0xe8, 0x98, 0xff, 0x00, 0x00, 0x00 },	// U+0638 (ظ)
 	{ 0x00, 0x70, 0x10, 0x78, 0x04, 0x04, 0x78, 0x00 },	// U+0639 (ع)
 	{ 0x0c, 0x70, 0x10, 0x78, 0x04, 0x04, 0x78, 0x00 },	// U+063A (غ)
-}; // 4
-
-static const unsigned char alt_block33[][8] = {
 	{ 0x00, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00 },	// U+0640 (ـ)
 	{ 0x60, 0x00, 0xf1, 0x91, 0xfe, 0x00, 0x00, 0x00 },	// U+0641 (ف)
 	{ 0xd8, 0x00, 0xf0, 0x91, 0xf1, 0x81, 0x7e, 0x00 },	// U+0642 (ق)
@@ -795,44 +699,23 @@ static const unsigned char alt_block33[][8] = {
 	{ 0x00, 0x00, 0x40, 0xa0, 0xe0, 0x80, 0x7c, 0x00 },	// U+0648 (و)
 	{ 0x00, 0x00, 0xc0, 0x20, 0xc2, 0x82, 0x7c, 0x00 },	// U+0649 (ى)
 	{ 0x00, 0xc0, 0x20, 0xc2, 0x82, 0x7c, 0x00, 0x6c },	// U+064A (ي)
-}; // 11
-
-static const unsigned char alt_block34[][8] = {
 	{ 0x38, 0x4c, 0x32, 0x08, 0x08, 0x08, 0x00, 0x00 },	// U+0671 (ٱ)
 	{ 0x60, 0x14, 0x62, 0x08, 0x08, 0x08, 0x00, 0x00 },	// U+0672 (ٲ)
 	{ 0x08, 0x08, 0x08, 0x08, 0x60, 0x14, 0x62, 0x00 },	// U+0673 (ٳ)
-}; // 3
-
-static const unsigned char alt_block35[][8] = {
 	{ 0x18, 0x00, 0x7e, 0x03, 0x3c, 0x60, 0x3f, 0x00 },	// U+1560 (ᕠ)
 	{ 0x18, 0x00, 0x7c, 0x06, 0x3c, 0x60, 0x3e, 0x00 },	// U+1561 (ᕡ)
 	{ 0x1e, 0x33, 0x03, 0x3e, 0x60, 0x63, 0x3e, 0x18 },	// U+1562 (ᕢ)
 	{ 0x00, 0x00, 0x3c, 0x06, 0x3c, 0x60, 0x3e, 0x18 },	// U+1563 (ᕣ)
-}; // 4
-
-static const unsigned char alt_block36[][8] = {
 	{ 0x18, 0x00, 0x7e, 0x18, 0x18, 0x18, 0x18, 0x00 },	// U+156A (ᕪ)
-}; // 1
-
-static const unsigned char alt_block37[][8] = {
 	{ 0x7e, 0x5a, 0x18, 0x18, 0x18, 0x18, 0x3c, 0x18 },	// U+156C (ᕬ)
 	{ 0x08, 0x0c, 0x3e, 0x0c, 0x0c, 0x6c, 0x38, 0x18 },	// U+156D (ᕭ)
 	{ 0x7e, 0x5a, 0x18, 0x18, 0x18, 0x18, 0x3c, 0x7e },	// U+156E (ᕮ)
 	{ 0x08, 0x0c, 0x3e, 0x0c, 0x0c, 0x6c, 0x38, 0x7e },	// U+156F (ᕯ)
 	{ 0x7e, 0x5a, 0x18, 0x18, 0x18, 0x18, 0x7e, 0x3c },	// U+1570 (ᕰ)
 	{ 0x08, 0x0c, 0x3e, 0x0c, 0x0c, 0x6c, 0x7e, 0x3c },	// U+1571 (ᕱ)
-}; // 6
-
-static const unsigned char alt_block38[][8] = {
 	{ 0x7e, 0x00, 0x3e, 0x66, 0x3e, 0x66, 0x66, 0x18 },	// U+15EC (ᗬ)
 	{ 0x7e, 0x00, 0x3e, 0x66, 0x06, 0x06, 0x06, 0x18 },	// U+15ED (ᗭ)
-}; // 2
-
-static const unsigned char alt_block39[][8] = {
 	{ 0x00, 0x00, 0x3b, 0x6e, 0x66, 0x06, 0x0f, 0x7e },	// U+15EF (ᗯ)
-}; // 1
-
-static const unsigned char alt_block40[][8] = {
 	{ 0x36, 0x1e, 0x06, 0x36, 0x1e, 0x06, 0x06, 0x00 },	// U+16A0 (ᚠ)
 	{ 0x6b, 0x33, 0x1f, 0x03, 0x33, 0x1f, 0x03, 0x00 },	// U+16A1 (ᚡ)
 	{ 0x06, 0x0e, 0x1e, 0x36, 0x66, 0x66, 0x66, 0x00 },	// U+16A2 (ᚢ)
@@ -845,9 +728,6 @@ static const unsigned char alt_block40[][8] = {
 	{ 0x6e, 0x36, 0x06, 0x6e, 0x36, 0x06, 0x06, 0x00 },	// U+16A9 (ᚩ)
 	{ 0x6e, 0x36, 0x06, 0x1e, 0x36, 0x06, 0x06, 0x00 },	// U+16AA (ᚪ)
 	{ 0x3c, 0x6c, 0x0c, 0x3c, 0x6c, 0x0c, 0x0c, 0x00 },	// U+16AB (ᚫ)
-}; // 12
-
-static const unsigned char alt_block41[][8] = {
 	{ 0x1e, 0x36, 0x66, 0x36, 0x1e, 0x36, 0x66, 0x00 },	// U+16B1 (ᚱ)
 	{ 0x00, 0x18, 0x0c, 0x06, 0x0c, 0x18, 0x00, 0x00 },	// U+16B2 (ᚲ)
 	{ 0x06, 0x06, 0x06, 0x0e, 0x1e, 0x36, 0x66, 0x00 },	// U+16B3 (ᚳ)
@@ -920,33 +800,18 @@ static const unsigned char alt_block41[][8] = {
 	{ 0x06, 0x06, 0x6c, 0x18, 0x36, 0x60, 0x60, 0x00 },	// U+16F6 (ᛶ)
 	{ 0x06, 0x06, 0x3e, 0x66, 0x66, 0x66, 0x66, 0x00 },	// U+16F7 (ᛷ)
 	{ 0x18, 0x18, 0x18, 0x18, 0x3c, 0x66, 0x66, 0x00 },	// U+16F8 (ᛸ)
-}; // 72
-
-static const unsigned char alt_block42[][8] = {
 	{ 0x3c, 0x66, 0x7e, 0x66, 0x66, 0x66, 0x66, 0x18 },	// U+1E00 (Ḁ)
 	{ 0x00, 0x00, 0x1e, 0x30, 0x3e, 0x33, 0x6e, 0x18 },	// U+1E01 (ḁ)
 	{ 0x18, 0x00, 0x3e, 0x66, 0x3e, 0x66, 0x3e, 0x00 },	// U+1E02 (Ḃ)
-}; // 3
-
-static const unsigned char alt_block43[][8] = {
 	{ 0x3f, 0x66, 0x66, 0x3e, 0x66, 0x66, 0x3f, 0x18 },	// U+1E04 (Ḅ)
 	{ 0x07, 0x06, 0x06, 0x3e, 0x66, 0x66, 0x3b, 0x18 },	// U+1E05 (ḅ)
 	{ 0x3f, 0x66, 0x66, 0x3e, 0x66, 0x66, 0x3f, 0x7e },	// U+1E06 (Ḇ)
 	{ 0x07, 0x06, 0x06, 0x3e, 0x66, 0x66, 0x3b, 0x7e },	// U+1E07 (ḇ)
-}; // 4
-
-static const unsigned char alt_block44[][8] = {
 	{ 0x18, 0x00, 0x3e, 0x66, 0x66, 0x66, 0x3e, 0x00 },	// U+1E0A (Ḋ)
-}; // 1
-
-static const unsigned char alt_block45[][8] = {
 	{ 0x1f, 0x36, 0x66, 0x66, 0x66, 0x36, 0x1f, 0x18 },	// U+1E0C (Ḍ)
 	{ 0x38, 0x30, 0x30, 0x3e, 0x33, 0x33, 0x6e, 0x18 },	// U+1E0D (ḍ)
 	{ 0x1f, 0x36, 0x66, 0x66, 0x66, 0x36, 0x1f, 0x7e },	// U+1E0E (Ḏ)
 	{ 0x38, 0x30, 0x30, 0x3e, 0x33, 0x33, 0x6e, 0x7e },	// U+1E0F (ḏ)
-}; // 4
-
-static const unsigned char alt_block46[][8] = {
 	{ 0x18, 0x00, 0x36, 0x7f, 0x6b, 0x6b, 0x63, 0x00 },	// U+1E41 (ṁ)
 	{ 0x63, 0x77, 0x7f, 0x6b, 0x6b, 0x63, 0x63, 0x18 },	// U+1E42 (Ṃ)
 	{ 0x00, 0x00, 0x36, 0x7f, 0x6b, 0x6b, 0x63, 0x18 },	// U+1E43 (ṃ)
@@ -958,20 +823,11 @@ static const unsigned char alt_block46[][8] = {
 	{ 0x00, 0x00, 0x3b, 0x66, 0x66, 0x66, 0x66, 0x7e },	// U+1E49 (ṉ)
 	{ 0x63, 0x67, 0x6f, 0x7b, 0x73, 0x63, 0x67, 0x3c },	// U+1E4A (Ṋ)
 	{ 0x00, 0x00, 0x3b, 0x66, 0x66, 0x66, 0x66, 0x3c },	// U+1E4B (ṋ)
-}; // 11
-
-static const unsigned char alt_block47[][8] = {
 	{ 0x18, 0x00, 0x3e, 0x66, 0x3e, 0x66, 0x66, 0x00 },	// U+1E58 (Ṙ)
 	{ 0x18, 0x00, 0x3e, 0x66, 0x06, 0x06, 0x06, 0x00 },	// U+1E59 (ṙ)
 	{ 0x3f, 0x66, 0x66, 0x76, 0x3e, 0x36, 0x67, 0x18 },	// U+1E5A (Ṛ)
 	{ 0x00, 0x00, 0x3b, 0x6e, 0x66, 0x06, 0x0f, 0x18 },	// U+1E5B (ṛ)
-}; // 4
-
-static const unsigned char alt_block48[][8] = {
 	{ 0x3f, 0x66, 0x66, 0x76, 0x3e, 0x36, 0x67, 0x7e },	// U+1E5E (Ṟ)
-}; // 1
-
-static const unsigned char alt_block49[][8] = {
 	{ 0x00, 0x00, 0x00, 0x3c, 0x00, 0x00, 0x00, 0x00 },	// U+2010 (‐)
 	{ 0x00, 0x00, 0x00, 0x3c, 0x00, 0x00, 0x00, 0x00 },	// U+2011 (‑)
 	{ 0x00, 0x00, 0x00, 0x3e, 0x00, 0x00, 0x00, 0x00 },	// U+2012 (‒)
@@ -982,159 +838,63 @@ static const unsigned char alt_block49[][8] = {
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x00, 0xff },	// U+2017 (‗)
 	{ 0x0e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+2018 (‘)
 	{ 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+2019 (’)
-}; // 10
-
-static const unsigned char alt_block50[][8] = {
 	{ 0x33, 0x66, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+201C (“)
 	{ 0x66, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+201D (”)
-}; // 2
-
-static const unsigned char alt_block51[][8] = {
 	{ 0x18, 0x18, 0x7e, 0x18, 0x18, 0x18, 0x18, 0x00 },	// U+2020 (†)
 	{ 0x18, 0x18, 0x7e, 0x18, 0x7e, 0x18, 0x18, 0x00 },	// U+2021 (‡)
 	{ 0x00, 0x00, 0x18, 0x3c, 0x3c, 0x18, 0x00, 0x00 },	// U+2022 (•)
-}; // 3
-
-static const unsigned char alt_block52[][8] = {
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x18, 0x00 },	// U+2024 (․)
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x66, 0x66, 0x00 },	// U+2025 (‥)
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x49, 0x49, 0x00 },	// U+2026 (…)
-}; // 3
-
-static const unsigned char alt_block53[][8] = {
 	{ 0x00, 0x63, 0x33, 0x18, 0x06, 0xdb, 0xdb, 0x00 },	// U+2030 (‰)
 	{ 0x00, 0x63, 0x33, 0x18, 0x06, 0xab, 0xab, 0x00 },	// U+2031 (‱)
-}; // 2
-
-static const unsigned char alt_block54[][8] = {
 	{ 0x66, 0x66, 0x66, 0x66, 0x66, 0x00, 0x66, 0x00 },	// U+203C (‼)
-}; // 1
-
-static const unsigned char alt_block55[][8] = {
 	{ 0x33, 0x66, 0x66, 0x33, 0x33, 0x00, 0x33, 0x00 },	// U+2047 (⁇)
 	{ 0x67, 0x6c, 0x6c, 0x66, 0x63, 0x00, 0x63, 0x00 },	// U+2048 (⁈)
 	{ 0x3b, 0x63, 0x63, 0x33, 0x1b, 0x00, 0x1b, 0x00 },	// U+2049 (⁉)
-}; // 3
-
-static const unsigned char alt_block56[][8] = {
 	{ 0x1c, 0x36, 0x36, 0x36, 0x1c, 0x00, 0x00, 0x00 },	// U+2070 (⁰)
-}; // 1
-
-static const unsigned char alt_block57[][8] = {
 	{ 0x38, 0x34, 0x36, 0x7e, 0x30, 0x00, 0x00, 0x00 },	// U+2074 (⁴)
 	{ 0x3e, 0x06, 0x1e, 0x30, 0x1e, 0x00, 0x00, 0x00 },	// U+2075 (⁵)
 	{ 0x1c, 0x06, 0x1e, 0x36, 0x1c, 0x00, 0x00, 0x00 },	// U+2076 (⁶)
 	{ 0x3e, 0x30, 0x18, 0x0c, 0x0c, 0x00, 0x00, 0x00 },	// U+2077 (⁷)
 	{ 0x1c, 0x36, 0x1c, 0x36, 0x1c, 0x00, 0x00, 0x00 },	// U+2078 (⁸)
 	{ 0x1c, 0x36, 0x3c, 0x30, 0x1c, 0x00, 0x00, 0x00 },	// U+2079 (⁹)
-}; // 6
-
-static const unsigned char alt_block58[][8] = {
 	{ 0x00, 0x1e, 0x36, 0x36, 0x36, 0x00, 0x00, 0x00 },	// U+207F (ⁿ)
-}; // 1
-
-static const unsigned char alt_block59[][8] = {
 	{ 0x1f, 0x33, 0x33, 0x5f, 0x63, 0xf3, 0x63, 0xe3 },	// U+20A7 (₧)
-}; // 1
-
-static const unsigned char alt_block60[][8] = {
 	{ 0x7c, 0x06, 0x3f, 0x06, 0x1f, 0x06, 0x7c, 0x00 },	// U+20AC (€)
-}; // 1
-
-static const unsigned char alt_block61[][8] = {
 	{ 0x7e, 0x81, 0x9d, 0xa5, 0x9d, 0x85, 0x81, 0x7e },	// U+2117 (℗)
-}; // 1
-
-static const unsigned char alt_block62[][8] = {
 	{ 0x56, 0x71, 0x72, 0x54, 0x53, 0x00, 0x00, 0x00 },	// U+2120 (℠)
-}; // 1
-
-static const unsigned char alt_block63[][8] = {
 	{ 0x57, 0x72, 0x72, 0x52, 0x52, 0x00, 0x00, 0x00 },	// U+2122 (™)
-}; // 1
-
-static const unsigned char alt_block64[][8] = {
 	{ 0x00, 0x08, 0x0c, 0xfe, 0xfe, 0x0c, 0x08, 0x00 },	// U+2190 (←)
 	{ 0x18, 0x3c, 0x7e, 0x18, 0x18, 0x18, 0x18, 0x18 },	// U+2191 (↑)
 	{ 0x00, 0x10, 0x30, 0x7f, 0x7f, 0x30, 0x10, 0x00 },	// U+2192 (→)
-}; // 3
-
-static const unsigned char alt_block65[][8] = {
 	{ 0x00, 0x24, 0x66, 0xff, 0xff, 0x66, 0x24, 0x00 },	// U+2194 (↔)
-}; // 1
-
-static const unsigned char alt_block66[][8] = {
 	{ 0x0f, 0x07, 0x0f, 0x1d, 0x38, 0x70, 0x20, 0x00 },	// U+2196 (↖)
 	{ 0xf0, 0xe0, 0xf0, 0xb8, 0x1c, 0x0e, 0x04, 0x00 },	// U+2197 (↗)
 	{ 0x00, 0x04, 0x0e, 0x1c, 0xb8, 0xf0, 0xe0, 0xf0 },	// U+2198 (↘)
 	{ 0x00, 0x20, 0x70, 0x38, 0x1d, 0x0f, 0x07, 0x0f },	// U+2199 (↙)
-}; // 4
-
-static const unsigned char alt_block67[][8] = {
 	{ 0x18, 0x3c, 0x7e, 0x18, 0x18, 0x7e, 0x3c, 0x18 },	// U+21A5 (↥)
-}; // 1
-
-static const unsigned char alt_block68[][8] = {
 	{ 0x18, 0x3c, 0x7e, 0x18, 0x7e, 0x3c, 0x18, 0xff },	// U+21A8 (↨)
-}; // 1
-
-static const unsigned char alt_block69[][8] = {
 	{ 0x18, 0x1c, 0xf6, 0x83, 0x83, 0xf6, 0x1c, 0x18 },	// U+21E6 (⇦)
 	{ 0x18, 0x3c, 0x66, 0xc3, 0xe7, 0x24, 0x24, 0x3c },	// U+21E7 (⇧)
 	{ 0x18, 0x38, 0x6f, 0xc1, 0xc1, 0x6f, 0x38, 0x18 },	// U+21E8 (⇨)
 	{ 0x3c, 0x24, 0x24, 0xe7, 0xc3, 0x66, 0x3c, 0x18 },	// U+21E9 (⇩)
-}; // 4
-
-static const unsigned char alt_block70[][8] = {
 	{ 0x00, 0x00, 0x00, 0x7e, 0x00, 0x00, 0x00, 0x00 },	// U+2212 (−)
-}; // 1
-
-static const unsigned char alt_block71[][8] = {
 	{ 0x00, 0x00, 0x3c, 0x66, 0x66, 0x3c, 0x00, 0x00 },	// U+2218 (∘)
-}; // 1
-
-static const unsigned char alt_block72[][8] = {
 	{ 0xf0, 0x30, 0x30, 0x30, 0x37, 0x36, 0x3c, 0x38 },	// U+221A (√)
-}; // 1
-
-static const unsigned char alt_block73[][8] = {
 	{ 0x66, 0xef, 0x99, 0x99, 0xf7, 0x66, 0x00, 0x00 },	// U+221E (∞)
 	{ 0x00, 0x00, 0x03, 0x03, 0x03, 0x7f, 0x00, 0x00 },	// U+221F (∟)
-}; // 2
-
-static const unsigned char alt_block74[][8] = {
 	{ 0x3c, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x00 },	// U+2229 (∩)
-}; // 1
-
-static const unsigned char alt_block75[][8] = {
 	{ 0x00, 0x6e, 0x3b, 0x00, 0x6e, 0x3b, 0x00, 0x00 },	// U+2248 (≈)
-}; // 1
-
-static const unsigned char alt_block76[][8] = {
 	{ 0x00, 0x7e, 0x00, 0x7e, 0x00, 0x7e, 0x00, 0x00 },	// U+2261 (≡)
-}; // 1
-
-static const unsigned char alt_block77[][8] = {
 	{ 0x30, 0x18, 0x0c, 0x18, 0x30, 0x00, 0x7e, 0x00 },	// U+2264 (≤)
 	{ 0x0c, 0x18, 0x30, 0x18, 0x0c, 0x00, 0x7e, 0x00 },	// U+2265 (≥)
-}; // 2
-
-static const unsigned char alt_block78[][8] = {
 	{ 0x00, 0x00, 0x18, 0x18, 0x00, 0x00, 0x00, 0x00 },	// U+22C5 (⋅)
-}; // 1
-
-static const unsigned char alt_block79[][8] = {
 	{ 0x00, 0x70, 0xd8, 0xd8, 0x18, 0x18, 0x18, 0x18 },	// U+2320 (⌠)
 	{ 0x18, 0x18, 0x18, 0x18, 0x1b, 0x1b, 0x0e, 0x00 },	// U+2321 (⌡)
-}; // 2
-
-static const unsigned char alt_block80[][8] = {
 	{ 0x00, 0x00, 0x44, 0x66, 0x77, 0x66, 0x44, 0x00 },	// U+23EA (⏪)
 	{ 0x3e, 0x1c, 0x08, 0x00, 0x3e, 0x1c, 0x08, 0x00 },	// U+23EB (⏫)
 	{ 0x00, 0x00, 0x11, 0x33, 0x77, 0x33, 0x11, 0x00 },	// U+23EC (⏬)
-}; // 3
-
-static const unsigned char alt_block81[][8] = {
 	{ 0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0x00 },	// U+2500 (─)
 	{ 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00 },	// U+2501 (━)
 	{ 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18 },	// U+2502 (│)
@@ -1391,17 +1151,8 @@ static const unsigned char alt_block81[][8] = {
 	{ 0x00, 0x00, 0x3c, 0x24, 0x24, 0x3c, 0x00, 0x00 },	// U+25FD (◽)
 	{ 0x00, 0x00, 0x3c, 0x3c, 0x3c, 0x3c, 0x00, 0x00 },	// U+25FE (◾)
 	{ 0x01, 0x03, 0x07, 0x0f, 0x1b, 0x33, 0x63, 0xff },	// U+25FF (◿)
-}; // 256
-
-static const unsigned char alt_block82[][8] = {
 	{ 0x3e, 0x63, 0x36, 0x1c, 0x7f, 0x1c, 0x1c, 0x00 },	// U+2625 (☥)
-}; // 1
-
-static const unsigned char alt_block83[][8] = {
 	{ 0x18, 0x3c, 0x18, 0x7e, 0x18, 0x18, 0x18, 0x00 },	// U+2628 (☨)
-}; // 1
-
-static const unsigned char alt_block84[][8] = {
 	{ 0x00, 0x7e, 0x81, 0x8d, 0xcf, 0xff, 0x7e, 0x00 },	// U+262F (☯)
 	{ 0x00, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00 },	// U+2630 (☰)
 	{ 0x00, 0x00, 0x63, 0x00, 0x7f, 0x00, 0x7f, 0x00 },	// U+2631 (☱)
@@ -1411,15 +1162,9 @@ static const unsigned char alt_block84[][8] = {
 	{ 0x00, 0x00, 0x63, 0x00, 0x7f, 0x00, 0x63, 0x00 },	// U+2635 (☵)
 	{ 0x00, 0x00, 0x7f, 0x00, 0x63, 0x00, 0x63, 0x00 },	// U+2636 (☶)
 	{ 0x00, 0x00, 0x63, 0x00, 0x63, 0x00, 0x63, 0x00 },	// U+2637 (☷)
-}; // 9
-
-static const unsigned char alt_block85[][8] = {
 	{ 0x7e, 0x81, 0xa5, 0x81, 0x99, 0xbd, 0x81, 0x7e },	// U+2639 (☹)
 	{ 0x7e, 0x81, 0xa5, 0x81, 0xbd, 0x99, 0x81, 0x7e },	// U+263A (☺)
 	{ 0x7e, 0xff, 0xdb, 0xff, 0xc3, 0xe7, 0xff, 0x7e },	// U+263B (☻)
-}; // 3
-
-static const unsigned char alt_block86[][8] = {
 	{ 0x08, 0x1c, 0x3e, 0x7f, 0x7f, 0x1c, 0x3e, 0x00 },	// U+2660 (♠)
 	{ 0x36, 0x7f, 0x63, 0x63, 0x36, 0x1c, 0x08, 0x00 },	// U+2661 (♡)
 	{ 0x08, 0x1c, 0x36, 0x63, 0x36, 0x1c, 0x08, 0x00 },	// U+2662 (♢)
@@ -1428,39 +1173,21 @@ static const unsigned char alt_block86[][8] = {
 	{ 0x36, 0x7f, 0x7f, 0x7f, 0x3e, 0x1c, 0x08, 0x00 },	// U+2665 (♥)
 	{ 0x08, 0x1c, 0x3e, 0x7f, 0x3e, 0x1c, 0x08, 0x00 },	// U+2666 (♦)
 	{ 0x1c, 0x1c, 0x63, 0x63, 0x77, 0x14, 0x3e, 0x00 },	// U+2667 (♧)
-}; // 8
-
-static const unsigned char alt_block87[][8] = {
 	{ 0x30, 0x30, 0x30, 0x30, 0x30, 0x3c, 0x3e, 0x1c },	// U+2669 (♩)
 	{ 0x18, 0x38, 0x78, 0xd8, 0x18, 0x1e, 0x1f, 0x0e },	// U+266A (♪)
 	{ 0xfe, 0xc6, 0xc6, 0xc6, 0xc6, 0xe6, 0x67, 0x03 },	// U+266B (♫)
 	{ 0xfe, 0xc6, 0xfe, 0xc6, 0xc6, 0xe6, 0x67, 0x03 },	// U+266C (♬)
-}; // 4
-
-static const unsigned char alt_block88[][8] = {
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7f, 0x00 },	// U+268A (⚊)
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x63, 0x00 },	// U+268B (⚋)
 	{ 0x00, 0x00, 0x00, 0x00, 0x7f, 0x00, 0x7f, 0x00 },	// U+268C (⚌)
 	{ 0x00, 0x00, 0x00, 0x00, 0x63, 0x00, 0x7f, 0x00 },	// U+268D (⚍)
 	{ 0x00, 0x00, 0x00, 0x00, 0x7f, 0x00, 0x63, 0x00 },	// U+268E (⚎)
 	{ 0x00, 0x00, 0x00, 0x00, 0x63, 0x00, 0x63, 0x00 },	// U+268F (⚏)
-}; // 6
-
-static const unsigned char alt_block89[][8] = {
 	{ 0x00, 0x00, 0x3c, 0x42, 0x42, 0x42, 0x3c, 0x00 },	// U+26AA (⚪)
 	{ 0x00, 0x00, 0x3c, 0x7e, 0x7e, 0x7e, 0x3c, 0x00 },	// U+26AB (⚫)
 	{ 0x00, 0x1c, 0x3e, 0x36, 0x3e, 0x1c, 0x00, 0x00 },	// U+26AC (⚬)
-}; // 3
-
-static const unsigned char alt_block90[][8] = {
 	{ 0x0c, 0x1c, 0x39, 0xff, 0xff, 0x39, 0x1c, 0x0c },	// U+2708 (✈)
-}; // 1
-
-static const unsigned char alt_block91[][8] = {
 	{ 0x49, 0x2a, 0x1c, 0x7f, 0x1c, 0x2a, 0x49, 0x00 },	// U+2734 (✴)
-}; // 1
-
-static const unsigned char alt_block92[][8] = {
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+2800 (⠀)
 	{ 0x0f, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+2801 (⠁)
 	{ 0x00, 0x00, 0x0f, 0x0f, 0x00, 0x00, 0x00, 0x00 },	// U+2802 (⠂)
@@ -1717,33 +1444,12 @@ static const unsigned char alt_block92[][8] = {
 	{ 0xff, 0xff, 0xf0, 0xf0, 0xff, 0xff, 0xff, 0xff },	// U+28FD (⣽)
 	{ 0xf0, 0xf0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },	// U+28FE (⣾)
 	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },	// U+28FF (⣿)
-}; // 256
-
-static const unsigned char alt_block93[][8] = {
 	{ 0x38, 0x38, 0x7c, 0x38, 0x10, 0x00, 0x7c, 0x00 },	// U+2913 (⤓)
-}; // 1
-
-static const unsigned char alt_block94[][8] = {
 	{ 0x00, 0x00, 0x00, 0x18, 0x18, 0x00, 0x00, 0x00 },	// U+2B1D (⬝)
-}; // 1
-
-static const unsigned char alt_block95[][8] = {
 	{ 0x3c, 0x7e, 0xff, 0xff, 0xff, 0xff, 0x7e, 0x3c },	// U+2B24 (⬤)
-}; // 1
-
-static const unsigned char alt_block96[][8] = {
 	{ 0x3c, 0x7e, 0xe7, 0xc3, 0xc3, 0xe7, 0x7e, 0x3c },	// U+2B55 (⭕)
-}; // 1
-
-static const unsigned char alt_block97[][8] = {
 	{ 0x00, 0x3c, 0x7e, 0x66, 0x66, 0x7e, 0x3c, 0x00 },	// U+2B58 (⭘)
-}; // 1
-
-static const unsigned char alt_block98[][8] = {
 	{ 0x3c, 0x66, 0x66, 0x0c, 0x18, 0x00, 0x18, 0x00 },	// U+2E2E (⸮)
-}; // 1
-
-static const unsigned char alt_block99[][8] = {
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+E080 ()
 	{ 0x0f, 0x0f, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+E081 ()
 	{ 0x00, 0x00, 0x0f, 0x0f, 0x0f, 0x0f, 0x00, 0x00 },	// U+E082 ()
@@ -2028,9 +1734,6 @@ static const unsigned char alt_block99[][8] = {
 	{ 0x33, 0x33, 0xcc, 0xcc, 0x33, 0x33, 0xcc, 0xcc },	// U+E199 ()
 	{ 0xcc, 0x66, 0x33, 0x99, 0xcc, 0x66, 0x33, 0x99 },	// U+E19A ()
 	{ 0x33, 0x66, 0xcc, 0x99, 0x33, 0x66, 0xcc, 0x99 },	// U+E19B ()
-}; // 284
-
-static const unsigned char alt_block100[][8] = {
 	{ 0x03, 0x03, 0x03, 0xff, 0xff, 0x03, 0x03, 0x03 },	// U+E800 ()
 	{ 0xff, 0xff, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18 },	// U+E801 ()
 	{ 0xc0, 0xc0, 0xc0, 0xff, 0xff, 0xc0, 0xc0, 0xc0 },	// U+E802 ()
@@ -2112,9 +1815,6 @@ static const unsigned char alt_block100[][8] = {
 	{ 0x6c, 0x0c, 0xc0, 0xc6, 0x36, 0x30, 0x03, 0x63 },	// U+E84E ()
 	{ 0x44, 0x44, 0x44, 0x82, 0x01, 0x10, 0x28, 0x44 },	// U+E84F ()
 	{ 0x44, 0x82, 0x01, 0x01, 0x01, 0x82, 0x44, 0x39 },	// U+E850 ()
-}; // 81
-
-static const unsigned char alt_block101[][8] = {
 	{ 0x60, 0x90, 0x09, 0x06, 0x60, 0x90, 0x09, 0x06 },	// U+EC00 ()
 	{ 0x72, 0x4e, 0xcf, 0xfc, 0xe4, 0x27, 0x3f, 0xf3 },	// U+EC01 ()
 	{ 0xa5, 0x42, 0xa5, 0x00, 0x00, 0xa5, 0x42, 0xa5 },	// U+EC02 ()
@@ -2154,22 +1854,10 @@ static const unsigned char alt_block101[][8] = {
 	{ 0x3c, 0x42, 0xa5, 0x81, 0x99, 0x81, 0xab, 0x55 },	// U+EC24 ()
 	{ 0x3c, 0x42, 0xa5, 0x81, 0x99, 0x81, 0xd5, 0xaa },	// U+EC25 ()
 	{ 0x7e, 0xff, 0x99, 0xff, 0xc3, 0xbd, 0xff, 0x7e },	// U+EC26 ()
-}; // 39
-
-static const unsigned char alt_block102[][8] = {
 	{ 0x38, 0x04, 0x10, 0x10, 0x10, 0x10, 0x00, 0x00 },	// U+FE81 (ﺁ)
 	{ 0x1c, 0x0a, 0x08, 0x08, 0xf8, 0x00, 0x00, 0x00 },	// U+FE82 (ﺂ)
-}; // 2
-
-static const unsigned char alt_block103[][8] = {
 	{ 0x0c, 0x06, 0x08, 0x08, 0xf8, 0x00, 0x00, 0x00 },	// U+FE84 (ﺄ)
-}; // 1
-
-static const unsigned char alt_block104[][8] = {
 	{ 0x08, 0x08, 0x08, 0x08, 0x08, 0x00, 0x18, 0x0c },	// U+FE87 (ﺇ)
-}; // 1
-
-static const unsigned char alt_block105[][8] = {
 	{ 0x00, 0x00, 0x81, 0x81, 0x7e, 0x00, 0x18, 0x00 },	// U+FE8F (ﺏ)
 	{ 0x00, 0x00, 0x81, 0x81, 0x7e, 0x00, 0x18, 0x00 },	// U+FE90 (ﺐ)
 	{ 0x00, 0x00, 0x80, 0x80, 0x7f, 0x00, 0x18, 0x00 },	// U+FE91 (ﺑ)
@@ -2184,9 +1872,6 @@ static const unsigned char alt_block105[][8] = {
 	{ 0x18, 0x66, 0x00, 0x81, 0x7e, 0x00, 0x00, 0x00 },	// U+FE9A (ﺚ)
 	{ 0x18, 0x66, 0x00, 0x10, 0x0f, 0x00, 0x00, 0x00 },	// U+FE9B (ﺛ)
 	{ 0x18, 0x66, 0x00, 0x10, 0xef, 0x00, 0x00, 0x00 },	// U+FE9C (ﺜ)
-}; // 14
-
-static const unsigned char alt_block106[][8] = {
 	{ 0x00, 0x00, 0x38, 0x40, 0xf8, 0x04, 0x34, 0xf8 },	// U+FE9E (ﺞ)
 	{ 0x00, 0x00, 0x38, 0x40, 0xff, 0x00, 0x30, 0x00 },	// U+FE9F (ﺟ)
 	{ 0x00, 0x00, 0x38, 0x40, 0xff, 0x00, 0x30, 0x00 },	// U+FEA0 (ﺠ)
@@ -2194,21 +1879,12 @@ static const unsigned char alt_block106[][8] = {
 	{ 0x00, 0x00, 0x38, 0x40, 0xf8, 0x04, 0x04, 0xf8 },	// U+FEA2 (ﺢ)
 	{ 0x00, 0x00, 0x38, 0x40, 0xff, 0x00, 0x00, 0x00 },	// U+FEA3 (ﺣ)
 	{ 0x00, 0x00, 0x38, 0x40, 0xff, 0x00, 0x00, 0x00 },	// U+FEA4 (ﺤ)
-}; // 7
-
-static const unsigned char alt_block107[][8] = {
 	{ 0x00, 0x20, 0x40, 0x88, 0xf8, 0x00, 0x00, 0x00 },	// U+FEA9 (ﺩ)
 	{ 0x00, 0x18, 0x20, 0x40, 0xbf, 0x00, 0x00, 0x00 },	// U+FEAA (ﺪ)
 	{ 0x0c, 0x20, 0x40, 0x88, 0xf8, 0x00, 0x00, 0x00 },	// U+FEAB (ﺫ)
 	{ 0x06, 0x10, 0x20, 0x40, 0xbf, 0x00, 0x00, 0x00 },	// U+FEAC (ﺬ)
 	{ 0x00, 0x00, 0x00, 0x80, 0x80, 0x40, 0x3c, 0x00 },	// U+FEAD (ﺭ)
-}; // 5
-
-static const unsigned char alt_block108[][8] = {
 	{ 0x00, 0xc0, 0x00, 0x80, 0x80, 0x40, 0x3c, 0x00 },	// U+FEAF (ﺯ)
-}; // 1
-
-static const unsigned char alt_block109[][8] = {
 	{ 0x00, 0x00, 0x00, 0xaa, 0xfa, 0x0a, 0x04, 0x00 },	// U+FEB1 (ﺱ)
 	{ 0x00, 0x00, 0x00, 0xaa, 0xfa, 0x0a, 0x04, 0x00 },	// U+FEB2 (ﺲ)
 	{ 0x00, 0x00, 0x00, 0xa8, 0xff, 0x00, 0x00, 0x00 },	// U+FEB3 (ﺳ)
@@ -2216,25 +1892,16 @@ static const unsigned char alt_block109[][8] = {
 	{ 0x20, 0x50, 0x00, 0xaa, 0xfa, 0x0a, 0x04, 0x00 },	// U+FEB5 (ﺵ)
 	{ 0x20, 0x50, 0x00, 0xaa, 0xfa, 0x0a, 0x04, 0x00 },	// U+FEB6 (ﺶ)
 	{ 0x20, 0x50, 0x00, 0xa8, 0xff, 0x00, 0x00, 0x00 },	// U+FEB7 (ﺷ)
-}; // 7
-
-static const unsigned char alt_block110[][8] = {
 	{ 0x00, 0x00, 0xe0, 0x9a, 0xfa, 0x0a, 0x04, 0x00 },	// U+FEB9 (ﺹ)
 	{ 0x00, 0x00, 0xe0, 0x9a, 0xfa, 0x0a, 0x04, 0x00 },	// U+FEBA (ﺺ)
 	{ 0x00, 0x00, 0xe0, 0x94, 0xff, 0x00, 0x00, 0x00 },	// U+FEBB (ﺻ)
 	{ 0x00, 0x00, 0xe0, 0x94, 0xff, 0x00, 0x00, 0x00 },	// U+FEBC (ﺼ)
-}; // 4
-
-static const unsigned char alt_block111[][8] = {
 	{ 0x08, 0x08, 0xe8, 0x98, 0xff, 0x00, 0x00, 0x00 },	// U+FEC1 (ﻁ)
 	{ 0x08, 0x08, 0xe8, 0x98, 0xff, 0x00, 0x00, 0x00 },	// U+FEC2 (ﻂ)
 	{ 0x08, 0x08, 0xe8, 0x98, 0xff, 0x00, 0x00, 0x00 },	// U+FEC3 (ﻃ)
 	{ 0x68, 0x08, 0xe8, 0x98, 0xff, 0x00, 0x00, 0x00 },	// U+FEC4 (ﻄ)
 	{ 0x68, 0x08, 0xe8, 0x98, 0xff, 0x00, 0x00, 0x00 },	// U+FEC5 (ﻅ)
 	{ 0x68, 0x08, 0xe8, 0x98, 0xff, 0x00, 0x00, 0x00 },	// U+FEC6 (ﻆ)
-}; // 6
-
-static const unsigned char alt_block112[][8] = {
 	{ 0x00, 0x70, 0x10, 0x78, 0x04, 0x04, 0x78, 0x00 },	// U+FEC9 (ﻉ)
 	{ 0x00, 0x00, 0x3c, 0x18, 0xf4, 0x02, 0x7c, 0x00 },	// U+FECA (ﻊ)
 	{ 0x00, 0x70, 0x08, 0x08, 0x7f, 0x00, 0x00, 0x00 },	// U+FECB (ﻋ)
@@ -2256,25 +1923,16 @@ static const unsigned char alt_block112[][8] = {
 	{ 0x80, 0xb0, 0x9a, 0x82, 0x7c, 0x00, 0x00, 0x00 },	// U+FEDB (ﻛ)
 	{ 0x80, 0xb0, 0x9a, 0x82, 0x7c, 0x00, 0x00, 0x00 },	// U+FEDC (ﻜ)
 	{ 0x80, 0x80, 0x80, 0x80, 0x81, 0x81, 0x7e, 0x00 },	// U+FEDD (ﻝ)
-}; // 21
-
-static const unsigned char alt_block113[][8] = {
 	{ 0x80, 0x80, 0x80, 0x80, 0x7f, 0x00, 0x00, 0x00 },	// U+FEDF (ﻟ)
 	{ 0x80, 0x80, 0x80, 0x80, 0x7f, 0x00, 0x00, 0x00 },	// U+FEE0 (ﻠ)
 	{ 0x00, 0x00, 0x40, 0xa0, 0xb8, 0x44, 0x04, 0x04 },	// U+FEE1 (ﻡ)
 	{ 0x00, 0x00, 0x40, 0xa0, 0xb8, 0x44, 0x04, 0x04 },	// U+FEE2 (ﻢ)
 	{ 0x00, 0x00, 0x40, 0xa0, 0xbf, 0x40, 0x00, 0x00 },	// U+FEE3 (ﻣ)
-}; // 5
-
-static const unsigned char alt_block114[][8] = {
 	{ 0x18, 0x81, 0x81, 0x81, 0x7e, 0x00, 0x00, 0x00 },	// U+FEE5 (ﻥ)
 	{ 0x18, 0x81, 0x81, 0x81, 0x7e, 0x00, 0x00, 0x00 },	// U+FEE6 (ﻦ)
 	{ 0x30, 0x00, 0x40, 0x40, 0x3f, 0x00, 0x00, 0x00 },	// U+FEE7 (ﻧ)
 	{ 0x30, 0x00, 0x10, 0x10, 0xef, 0x00, 0x00, 0x00 },	// U+FEE8 (ﻨ)
 	{ 0x00, 0x00, 0xe0, 0xa0, 0xe0, 0x00, 0x00, 0x00 },	// U+FEE9 (ﻩ)
-}; // 5
-
-static const unsigned char alt_block115[][8] = {
 	{ 0x00, 0x70, 0x80, 0xb0, 0xff, 0x00, 0x00, 0x00 },	// U+FEEB (ﻫ)
 	{ 0x00, 0x70, 0x80, 0xb0, 0xff, 0x00, 0x00, 0x00 },	// U+FEEC (ﻬ)
 	{ 0x00, 0x00, 0x40, 0xa0, 0xe0, 0x80, 0x7c, 0x00 },	// U+FEED (ﻭ)
@@ -2285,9 +1943,6 @@ static const unsigned char alt_block115[][8] = {
 	{ 0x00, 0x00, 0x00, 0x70, 0x91, 0x21, 0x7e, 0x6c },	// U+FEF2 (ﻲ)
 	{ 0x00, 0x00, 0x80, 0x80, 0x7f, 0x00, 0x28, 0x00 },	// U+FEF3 (ﻳ)
 	{ 0x00, 0x00, 0x80, 0x80, 0x7f, 0x00, 0x28, 0x00 },	// U+FEF4 (ﻴ)
-}; // 10
-
-static const unsigned char alt_block116[][8] = {
 	{ 0x00, 0x00, 0x00, 0x00, 0x1c, 0x36, 0x1c, 0x00 },	// U+FF61 (｡)
 	{ 0x78, 0x18, 0x18, 0x18, 0x00, 0x00, 0x00, 0x00 },	// U+FF62 (｢)
 	{ 0x00, 0x00, 0x00, 0x18, 0x18, 0x18, 0x1e, 0x00 },	// U+FF63 (｣)
@@ -2351,5 +2006,85 @@ static const unsigned char alt_block116[][8] = {
 	{ 0x00, 0x06, 0x00, 0x60, 0x60, 0x30, 0x1e, 0x00 },	// U+FF9D (ﾝ)
 	{ 0x33, 0x66, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+FF9E (ﾞ)
 	{ 0x1c, 0x36, 0x1c, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+FF9F (ﾟ)
-}; // 63
+}; // 2001
+
+static const uint8_t alt_page_index[] = {
+	0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0a, 0x00,
+	0x0b, 0x0c, 0x0d, 0x0e, 0x00, 0x0f, 0x10, 0x11, 0x12, 0x13, 0x00, 0x14, 0x00, 0x00, 0x15, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x16, 0x17, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x19, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1a, 0x1b,
+}; // 256
 
+static const uint32_t alt_page_bits[][8] = {
+	{ 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000 },	// Empty
+	{ 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff },	// U+00xx
+	{ 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffbfffff, 0x00000000, 0xffffe000, 0xff3101cf },	// U+01xx
+	{ 0x0fffffff, 0x000ffcc0, 0x03000000, 0x00000008, 0x00100000, 0x00000000, 0x10002240, 0x00000000 },	// U+02xx
+	{ 0x00000000, 0x00000000, 0x00008000, 0x00000000, 0xfffe0000, 0xfffe03fb, 0x000003ff, 0x00000000 },	// U+03xx
+	{ 0xffff01e3, 0xffffffff, 0x01e3ffff, 0x00000000, 0x00000000, 0x00000000, 0x00ff0000, 0x000200c0 },	// U+04xx
+	{ 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xffff0000, 0x000007ff },	// U+05xx
+	{ 0x00000000, 0x07bfbf88, 0x000007ff, 0x000e0000, 0x00000000, 0x00000000, 0x00000000, 0x00000000 },	// U+06xx
+	{ 0x00000000, 0x00000000, 0x00000000, 0x0003f40f, 0x00000000, 0x00000000, 0x00000000, 0x0000b000 },	// U+15xx
+	{ 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xfffe0fff, 0xffffffff, 0x01ffffff },	// U+16xx
+	{ 0x0000f4f7, 0x00000000, 0x4f000ffe, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000 },	// U+1Exx
+	{ 0x33ff0000, 0x10030077, 0x00000380, 0x83f10000, 0x00000000, 0x00001080, 0x00000000, 0x00000000 },	// U+20xx
+	{ 0x00800000, 0x00000005, 0x00000000, 0x00000000, 0x03d70000, 0x00000120, 0x00000000, 0x000003c0 },	// U+21xx
+	{ 0xc5040000, 0x00000200, 0x00000100, 0x00000032, 0x00000000, 0x00000000, 0x00000020, 0x00000000 },	// U+22xx
+	{ 0x00000000, 0x00000003, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00001c00 },	// U+23xx
+	{ 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff },	// U+25xx
+	{ 0x00000000, 0x0eff8120, 0x00000000, 0x00001eff, 0x0000fc00, 0x00001c00, 0x00000000, 0x00000000 },	// U+26xx
+	{ 0x00000100, 0x00100000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000 },	// U+27xx
+	{ 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff },	// U+28xx
+	{ 0x00080000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000 },	// U+29xx
+	{ 0x20000000, 0x00000010, 0x01200000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000 },	// U+2Bxx
+	{ 0x00000000, 0x00004000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000 },	// U+2Exx
+	{ 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff },	// U+E0xx
+	{ 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0x0fffffff, 0x00000000, 0x00000000, 0x00000000 },	// U+E1xx
+	{ 0xffffffff, 0xffffffff, 0x0001ffff, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000 },	// U+E8xx
+	{ 0xffffffff, 0x0000007f, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000 },	// U+ECxx
+	{ 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xdfff8096, 0x1efebe1f, 0xbffffe7e, 0x001ffbef },	// U+FExx
+	{ 0x00000000, 0x00000000, 0x00000000, 0xfffffffe, 0xffffffff, 0x00000000, 0x00000000, 0x00000000 },	// U+FFxx
+}; // 28
+
+static const uint16_t alt_page_base[][8] = {
+	{ 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000 },	// Empty
+	{ 0x0000, 0x0020, 0x0040, 0x0060, 0x0080, 0x00a0, 0x00c0, 0x00e0 },	// U+00xx
+	{ 0x0100, 0x0120, 0x0140, 0x0160, 0x0180, 0x019f, 0x019f, 0x01b2 },	// U+01xx
+	{ 0x01c4, 0x01e0, 0x01ec, 0x01ee, 0x01ef, 0x01f0, 0x01f0, 0x01f4 },	// U+02xx
+	{ 0x01f4, 0x01f4, 0x01f4, 0x01f5, 0x01f5, 0x0204, 0x021c, 0x0226 },	// U+03xx
+	{ 0x0226, 0x023c, 0x025c, 0x0272, 0x0272, 0x0272, 0x0272, 0x027a },	// U+04xx
+	{ 0x027d, 0x027d, 0x027d, 0x027d, 0x027d, 0x027d, 0x027d, 0x028d },	// U+05xx
+	{ 0x0298, 0x0298, 0x02ab, 0x02b6, 0x02b9, 0x02b9, 0x02b9, 0x02b9 },	// U+06xx
+	{ 0x02b9, 0x02b9, 0x02b9, 0x02b9, 0x02c4, 0x02c4, 0x02c4, 0x02c4 },	// U+15xx
+	{ 0x02c7, 0x02c7, 0x02c7, 0x02c7, 0x02c7, 0x02c7, 0x02e2, 0x0302 },	// U+16xx
+	{ 0x031b, 0x0327, 0x0327, 0x0337, 0x0337, 0x0337, 0x0337, 0x0337 },	// U+1Exx
+	{ 0x0337, 0x0343, 0x034c, 0x034f, 0x0357, 0x0357, 0x0359, 0x0359 },	// U+20xx
+	{ 0x0359, 0x035a, 0x035c, 0x035c, 0x035c, 0x0364, 0x0366, 0x0366 },	// U+21xx
+	{ 0x036a, 0x036f, 0x0370, 0x0371, 0x0374, 0x0374, 0x0374, 0x0375 },	// U+22xx
+	{ 0x0375, 0x0375, 0x0377, 0x0377, 0x0377, 0x0377, 0x0377, 0x0377 },	// U+23xx
+	{ 0x037a, 0x039a, 0x03ba, 0x03da, 0x03fa, 0x041a, 0x043a, 0x045a },	// U+25xx
+	{ 0x047a, 0x047a, 0x0488, 0x0488, 0x0494, 0x049a, 0x049d, 0x049d },	// U+26xx
+	{ 0x049d, 0x049e, 0x049f, 0x049f, 0x049f, 0x049f, 0x049f, 0x049f },	// U+27xx
+	{ 0x049f, 0x04bf, 0x04df, 0x04ff, 0x051f, 0x053f, 0x055f, 0x057f },	// U+28xx
+	{ 0x059f, 0x05a0, 0x05a0, 0x05a0, 0x05a0, 0x05a0, 0x05a0, 0x05a0 },	// U+29xx
+	{ 0x05a0, 0x05a1, 0x05a2, 0x05a4, 0x05a4, 0x05a4, 0x05a4, 0x05a4 },	// U+2Bxx
+	{ 0x05a4, 0x05a4, 0x05a5, 0x05a5, 0x05a5, 0x05a5, 0x05a5, 0x05a5 },	// U+2Exx
+	{ 0x05a5, 0x05a5, 0x05a5, 0x05a5, 0x05a5, 0x05c5, 0x05e5, 0x0605 },	// U+E0xx
+	{ 0x0625, 0x0645, 0x0665, 0x0685, 0x06a5, 0x06c1, 0x06c1, 0x06c1 },	// U+E1xx
+	{ 0x06c1, 0x06e1, 0x0701, 0x0712, 0x0712, 0x0712, 0x0712, 0x0712 },	// U+E8xx
+	{ 0x0712, 0x0732, 0x0739, 0x0739, 0x0739, 0x0739, 0x0739, 0x0739 },	// U+ECxx
+	{ 0x0739, 0x0739, 0x0739, 0x0739, 0x0739, 0x074d, 0x0763, 0x077f },	// U+FExx
+	{ 0x0792, 0x0792, 0x0792, 0x0792, 0x07b1, 0x07d1, 0x07d1, 0x07d1 },	// U+FFxx
+}; // 28
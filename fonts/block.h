@@ -4,7 +4,7 @@
 * With FBInk's tools/hextoc.py
 */
 
-static const uint32_t block_block1[][32] = {
+static const uint32_t block_glyphs[][32] = {
 	{ 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000 },	// U+0020 ( )
 	{ 0x0000ff00, 0x0000ff00, 0x0000ff00, 0x0000ff00, 0x0000ff00, 0x0000ff00, 0x0000ff00, 0x0000ff00, 0x0000ff00, 0x0000ff00, 0x0000ff00, 0x0000ff00, 0x0000ff00, 0x0000ff00, 0x0000ff00, 0x0000ff00, 0x0000ff00, 0x00007f00, 0x00003f00, 0x00001f00, 0x00000f00, 0x00000700, 0x00000300, 0x00000100, 0x0000ff00, 0x0000ff00, 0x0000ff00, 0x0000ff00, 0x0000ff00, 0x0000ff00, 0x0000ff00, 0x0000ff00 },	// U+0021 (!)
 	{ 0x00808000, 0x00c0c000, 0x00e0e000, 0x00f0f000, 0x00f8f800, 0x00fcfc00, 0x00fefe00, 0x00ffff00, 0x00ffff00, 0x00ffff00, 0x00ffff00, 0x00ffff00, 0x00ffff00, 0x00ffff00, 0x00ffff00, 0x00ffff00, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000 },	// U+0022 (")
@@ -102,3 +102,16 @@ static const uint32_t block_block1[][32] = {
 	{ 0xff008000, 0x7f00c000, 0x3f00e000, 0x1f00f000, 0x0f00f800, 0x0700fc00, 0x0300fe00, 0x0100ff00, 0x00ff00ff, 0x007f007f, 0x003f003f, 0x001f001f, 0x000f000f, 0x00070007, 0x00030003, 0x00010001, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000 },	// U+007E (~)
 }; // 95
 
+static const uint8_t block_page_index[] = {
+	0x01,
+}; // 1
+
+static const uint32_t block_page_bits[][8] = {
+	{ 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000 },	// Empty
+	{ 0x00000000, 0xffffffff, 0xffffffff, 0x7fffffff, 0x00000000, 0x00000000, 0x00000000, 0x00000000 },	// U+00xx
+}; // 2
+
+static const uint16_t block_page_base[][8] = {
+	{ 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000 },	// Empty
+	{ 0x0000, 0x0000, 0x0020, 0x0040, 0x005f, 0x005f, 0x005f, 0x005f },	// U+00xx
+}; // 2
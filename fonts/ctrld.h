@@ -4,7 +4,7 @@
 * With FBInk's tools/hextoc.py
 */
 
-static const unsigned char ctrld_block1[][16] = {
+static const unsigned char ctrld_glyphs[][16] = {
 	{ 0x00, 0x00, 0x00, 0x7e, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x7e, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+000A (ESC)
 	{ 0x00, 0x00, 0x00, 0x7e, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x7e, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+000B (ESC)
 	{ 0x00, 0x00, 0x00, 0x7e, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x7e, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+000C (ESC)
@@ -251,87 +251,36 @@ static const unsigned char ctrld_block1[][16] = {
 	{ 0x00, 0x30, 0x10, 0x08, 0x00, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x7c, 0x40, 0x40, 0x40, 0x3c },	// U+00FD (ý)
 	{ 0x00, 0x00, 0x02, 0x02, 0x02, 0x1e, 0x22, 0x22, 0x22, 0x22, 0x22, 0x1e, 0x02, 0x02, 0x02, 0x00 },	// U+00FE (þ)
 	{ 0x00, 0x00, 0x24, 0x24, 0x00, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x7c, 0x40, 0x40, 0x40, 0x3c },	// U+00FF (ÿ)
-}; // 246
-
-static const unsigned char ctrld_block2[][16] = {
 	{ 0x00, 0x00, 0x03, 0x04, 0x04, 0x08, 0x08, 0x14, 0x22, 0x22, 0x41, 0x41, 0x00, 0x00, 0x00, 0x00 },	// U+03BB (λ)
-}; // 1
-
-static const unsigned char ctrld_block3[][16] = {
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x7f, 0x14, 0x14, 0x12, 0x12, 0x51, 0x71, 0x00, 0x00, 0x00, 0x00 },	// U+03C0 (π)
-}; // 1
-
-static const unsigned char ctrld_block4[][16] = {
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0xc0, 0xc4, 0xc6, 0xff, 0xff, 0x06, 0x04, 0x00, 0x00, 0x00, 0x00 },	// U+21B5 (↵)
-}; // 1
-
-static const unsigned char ctrld_block5[][16] = {
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x3e, 0x3e, 0x3e, 0x3e, 0x3e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+25AA (▪)
-}; // 1
-
-static const unsigned char ctrld_block6[][16] = {
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x08, 0x1c, 0x1c, 0x3e, 0x3e, 0x7f, 0x00, 0x00, 0x00, 0x00 },	// U+25B4 (▴)
-}; // 1
-
-static const unsigned char ctrld_block7[][16] = {
 	{ 0x00, 0x00, 0x00, 0x02, 0x06, 0x0e, 0x1e, 0x3e, 0x1e, 0x0e, 0x06, 0x02, 0x00, 0x00, 0x00, 0x00 },	// U+25B8 (▸)
-}; // 1
-
-static const unsigned char ctrld_block8[][16] = {
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x7f, 0x3e, 0x3e, 0x1c, 0x1c, 0x08, 0x08, 0x00, 0x00, 0x00, 0x00 },	// U+25BE (▾)
-}; // 1
-
-static const unsigned char ctrld_block9[][16] = {
 	{ 0x00, 0x00, 0x00, 0x20, 0x30, 0x38, 0x3c, 0x3e, 0x3c, 0x38, 0x30, 0x20, 0x00, 0x00, 0x00, 0x00 },	// U+25C2 (◂)
-}; // 1
-
-static const unsigned char ctrld_block10[][16] = {
 	{ 0x00, 0x00, 0x00, 0x00, 0x08, 0x1c, 0x3e, 0x7f, 0x3e, 0x1c, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+25C6 (◆)
-}; // 1
-
-static const unsigned char ctrld_block11[][16] = {
 	{ 0x00, 0x00, 0x80, 0x40, 0x40, 0x20, 0x20, 0x10, 0x11, 0x09, 0x0a, 0x04, 0x00, 0x00, 0x00, 0x00 },	// U+2713 (✓)
-}; // 1
-
-static const unsigned char ctrld_block12[][16] = {
 	{ 0x00, 0x40, 0x44, 0x24, 0x18, 0x18, 0x28, 0x44, 0x04, 0x02, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00 },	// U+2717 (✗)
-}; // 1
-
-static const unsigned char ctrld_block13[][16] = {
 	{ 0x03, 0x03, 0x03, 0x23, 0x73, 0xfb, 0x23, 0x33, 0x39, 0x1c, 0x0e, 0x07, 0x07, 0x07, 0x07, 0x07 },	// U+E0A0 ()
 	{ 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x1f, 0x00, 0x88, 0x98, 0x98, 0xa8, 0xe8, 0xc8, 0x88, 0x00 },	// U+E0A1 ()
 	{ 0x00, 0x00, 0x3c, 0x66, 0x42, 0x42, 0x7e, 0xe7, 0xc3, 0xe7, 0xff, 0x7e, 0x3c, 0x00, 0x00, 0x00 },	// U+E0A2 ()
-}; // 3
-
-static const unsigned char ctrld_block14[][16] = {
 	{ 0x01, 0x03, 0x07, 0x0f, 0x1f, 0x3f, 0x7f, 0xff, 0xff, 0x7f, 0x3f, 0x1f, 0x0f, 0x07, 0x03, 0x01 },	// U+E0B0 ()
 	{ 0x01, 0x02, 0x04, 0x08, 0x10, 0x20, 0x40, 0x80, 0x80, 0x40, 0x20, 0x10, 0x08, 0x04, 0x02, 0x01 },	// U+E0B1 ()
 	{ 0x80, 0xc0, 0xe0, 0xf0, 0xf8, 0xfc, 0xfe, 0xff, 0xff, 0xfe, 0xfc, 0xf8, 0xf0, 0xe0, 0xc0, 0x80 },	// U+E0B2 ()
 	{ 0x80, 0x40, 0x20, 0x10, 0x08, 0x04, 0x02, 0x01, 0x01, 0x02, 0x04, 0x08, 0x10, 0x20, 0x40, 0x80 },	// U+E0B3 ()
-}; // 4
-
-static const unsigned char ctrld_block15[][16] = {
 	{ 0x00, 0x00, 0x00, 0xf7, 0xf7, 0x07, 0xf7, 0xf0, 0xf7, 0x07, 0xf7, 0xf7, 0x00, 0x00, 0x00, 0x00 },	// U+EE00 ()
 	{ 0x00, 0x00, 0x00, 0xf7, 0xf7, 0xf7, 0x00, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0x00, 0x00, 0x00, 0x00 },	// U+EE01 ()
 	{ 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00 },	// U+EE02 ()
 	{ 0x00, 0x00, 0x00, 0xf7, 0xf7, 0xf7, 0xf7, 0x00, 0xf7, 0xf7, 0xf7, 0xf7, 0x00, 0x00, 0x00, 0x00 },	// U+EE03 ()
-}; // 4
-
-static const unsigned char ctrld_block16[][16] = {
 	{ 0x00, 0x00, 0x00, 0xff, 0x89, 0x89, 0xf9, 0x8f, 0x89, 0xf9, 0x89, 0xff, 0x00, 0x00, 0x00, 0x00 },	// U+EE10 ()
 	{ 0x00, 0x00, 0x00, 0xff, 0x91, 0x91, 0xff, 0xa9, 0xa9, 0xa9, 0xa9, 0xff, 0x00, 0x00, 0x00, 0x00 },	// U+EE11 ()
 	{ 0x00, 0x00, 0x00, 0xff, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0xff, 0x00, 0x00, 0x00, 0x00 },	// U+EE12 ()
 	{ 0x00, 0x00, 0x00, 0xff, 0x89, 0x89, 0x89, 0xff, 0x89, 0x89, 0x89, 0xff, 0x00, 0x00, 0x00, 0x00 },	// U+EE13 ()
-}; // 4
-
-static const unsigned char ctrld_block17[][16] = {
 	{ 0x00, 0x00, 0x00, 0x10, 0x18, 0x5c, 0x2f, 0x17, 0x0b, 0x14, 0x1a, 0x11, 0x00, 0x00, 0x00, 0x00 },	// U+EE20 ()
 	{ 0x00, 0x00, 0x00, 0x10, 0x18, 0x1c, 0x1f, 0x1f, 0x1f, 0x1c, 0x18, 0x10, 0x00, 0x00, 0x00, 0x00 },	// U+EE21 ()
 	{ 0x00, 0x00, 0x00, 0x10, 0x18, 0x1c, 0x5f, 0x5f, 0x5f, 0x1c, 0x18, 0x10, 0x00, 0x00, 0x00, 0x00 },	// U+EE22 ()
 	{ 0x00, 0x00, 0x00, 0x08, 0x4c, 0x8e, 0xaf, 0xaf, 0xaf, 0x8e, 0x4c, 0x08, 0x00, 0x00, 0x00, 0x00 },	// U+EE23 ()
-}; // 4
-
-static const unsigned char ctrld_block18[][16] = {
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x3e, 0x3e, 0x3e, 0x3e, 0x3e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+EE30 ()
 	{ 0x00, 0x00, 0x00, 0x00, 0x02, 0x06, 0x0e, 0x1e, 0x0e, 0x06, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+EE31 ()
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x36, 0x36, 0x36, 0x36, 0x36, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+EE32 ()
@@ -340,16 +289,10 @@ static const unsigned char ctrld_block18[][16] = {
 	{ 0x00, 0x00, 0x00, 0x00, 0x22, 0x32, 0x3a, 0x3e, 0x3a, 0x32, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+EE35 ()
 	{ 0x00, 0x00, 0x00, 0x00, 0x48, 0x6c, 0x7e, 0x7f, 0x7e, 0x6c, 0x48, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+EE36 ()
 	{ 0x00, 0x00, 0x00, 0x00, 0x18, 0x3c, 0x7e, 0x7e, 0x7e, 0x3c, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+EE37 ()
-}; // 8
-
-static const unsigned char ctrld_block19[][16] = {
 	{ 0x00, 0x00, 0x1c, 0x7f, 0x49, 0x5d, 0x49, 0x41, 0x41, 0x41, 0x41, 0x5d, 0x41, 0x7f, 0x00, 0x00 },	// U+EE40 ()
 	{ 0x00, 0x00, 0x1c, 0x7f, 0x49, 0x5d, 0x49, 0x41, 0x41, 0x41, 0x7f, 0x63, 0x7f, 0x7f, 0x00, 0x00 },	// U+EE41 ()
 	{ 0x00, 0x00, 0x1c, 0x7f, 0x49, 0x5d, 0x49, 0x7f, 0x7f, 0x7f, 0x7f, 0x63, 0x7f, 0x7f, 0x00, 0x00 },	// U+EE42 ()
 	{ 0x00, 0x00, 0x1c, 0x7f, 0x77, 0x63, 0x77, 0x7f, 0x7f, 0x7f, 0x7f, 0x63, 0x7f, 0x7f, 0x00, 0x00 },	// U+EE43 ()
-}; // 4
-
-static const unsigned char ctrld_block20[][16] = {
 	{ 0x00, 0x00, 0x00, 0xff, 0x81, 0x81, 0xa1, 0xd1, 0x8b, 0x85, 0x81, 0xff, 0x00, 0x00, 0x00, 0x00 },	// U+EEF0 ()
 	{ 0x00, 0x00, 0x00, 0x00, 0xdb, 0x81, 0x3c, 0xbd, 0xbd, 0x3c, 0x81, 0xdb, 0x00, 0x00, 0x00, 0x00 },	// U+EEF1 ()
 	{ 0x00, 0x00, 0x00, 0x00, 0x55, 0x00, 0x7f, 0x7f, 0x7f, 0x7f, 0x00, 0x55, 0x00, 0x00, 0x00, 0x00 },	// U+EEF2 ()
@@ -360,5 +303,44 @@ static const unsigned char ctrld_block20[][16] = {
 	{ 0x00, 0x00, 0x00, 0x3c, 0x42, 0x42, 0x81, 0x81, 0xa5, 0xe7, 0x66, 0x24, 0x00, 0x00, 0x00, 0x00 },	// U+EEF7 ()
 	{ 0x00, 0x00, 0x00, 0x0e, 0x1c, 0x1c, 0x1c, 0x1c, 0x7f, 0x3e, 0x1c, 0x08, 0x00, 0x00, 0x00, 0x00 },	// U+EEF8 ()
 	{ 0x00, 0x00, 0x00, 0x08, 0x1c, 0x3e, 0x7f, 0x1c, 0x1c, 0x1c, 0x1c, 0x0e, 0x00, 0x00, 0x00, 0x00 },	// U+EEF9 ()
-}; // 10
+}; // 298
+
+static const uint8_t ctrld_page_index[] = {
+	0x01, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x03, 0x00, 0x00, 0x00, 0x04, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07,
+}; // 239
 
+static const uint32_t ctrld_page_bits[][8] = {
+	{ 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000 },	// Empty
+	{ 0xfffffc00, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff },	// U+00xx
+	{ 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x08000000, 0x00000001, 0x00000000 },	// U+03xx
+	{ 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00200000, 0x00000000, 0x00000000 },	// U+21xx
+	{ 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x41100400, 0x00000044, 0x00000000 },	// U+25xx
+	{ 0x00880000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000 },	// U+27xx
+	{ 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x000f0007, 0x00000000, 0x00000000 },	// U+E0xx
+	{ 0x000f000f, 0x00ff000f, 0x0000000f, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x03ff0000 },	// U+EExx
+}; // 8
+
+static const uint16_t ctrld_page_base[][8] = {
+	{ 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000 },	// Empty
+	{ 0x0000, 0x0016, 0x0036, 0x0056, 0x0076, 0x0096, 0x00b6, 0x00d6 },	// U+00xx
+	{ 0x00f6, 0x00f6, 0x00f6, 0x00f6, 0x00f6, 0x00f6, 0x00f7, 0x00f8 },	// U+03xx
+	{ 0x00f8, 0x00f8, 0x00f8, 0x00f8, 0x00f8, 0x00f8, 0x00f9, 0x00f9 },	// U+21xx
+	{ 0x00f9, 0x00f9, 0x00f9, 0x00f9, 0x00f9, 0x00f9, 0x00fd, 0x00ff },	// U+25xx
+	{ 0x00ff, 0x0101, 0x0101, 0x0101, 0x0101, 0x0101, 0x0101, 0x0101 },	// U+27xx
+	{ 0x0101, 0x0101, 0x0101, 0x0101, 0x0101, 0x0101, 0x0108, 0x0108 },	// U+E0xx
+	{ 0x0108, 0x0110, 0x011c, 0x0120, 0x0120, 0x0120, 0x0120, 0x0120 },	// U+EExx
+}; // 8
@@ -4,11 +4,8 @@
 * With FBInk's tools/hextoc.py
 */
 
-static const unsigned char fatty_block1[][16] = {
+static const unsigned char fatty_glyphs[][16] = {
 	{ 0x00, 0x00, 0x00, 0x2a, 0x00, 0x22, 0x00, 0x22, 0x00, 0x22, 0x00, 0x2a, 0x00, 0x00, 0x00, 0x00 },	// U+0000 (ESC)
-}; // 1
-
-static const unsigned char fatty_block2[][16] = {
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+0020 ( )
 	{ 0x00, 0x00, 0x00, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x00, 0x0c, 0x0c, 0x00, 0x00, 0x00 },	// U+0021 (!)
 	{ 0x00, 0x00, 0x33, 0x33, 0x33, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+0022 (")
@@ -105,9 +102,6 @@ static const unsigned char fatty_block2[][16] = {
 	{ 0x00, 0x07, 0x0e, 0x0c, 0x0c, 0x0c, 0x0c, 0x38, 0x38, 0x0c, 0x0c, 0x0c, 0x0c, 0x0e, 0x07, 0x00 },	// U+007D (})
 	{ 0x00, 0x00, 0x00, 0x00, 0x36, 0x3f, 0x1b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+007E (~)
 	{ 0x00, 0x03, 0x05, 0x05, 0x05, 0x03, 0x1c, 0x04, 0x0c, 0x04, 0x1c, 0x00, 0x10, 0x10, 0x10, 0x70 },	// U+007F ()
-}; // 96
-
-static const unsigned char fatty_block3[][16] = {
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+00A0 ( )
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x0c, 0x0c, 0x00, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x00 },	// U+00A1 (¡)
 	{ 0x00, 0x00, 0x00, 0x00, 0x18, 0x3e, 0x2b, 0x0b, 0x0b, 0x0b, 0x2b, 0x3e, 0x18, 0x00, 0x00, 0x00 },	// U+00A2 (¢)
@@ -332,242 +326,86 @@ static const unsigned char fatty_block3[][16] = {
 	{ 0x33, 0x1e, 0x0c, 0x00, 0x3f, 0x3f, 0x30, 0x18, 0x0c, 0x06, 0x03, 0x3f, 0x3f, 0x00, 0x00, 0x00 },	// U+017D (Ž)
 	{ 0x00, 0x33, 0x1e, 0x0c, 0x00, 0x3f, 0x3f, 0x30, 0x1c, 0x0e, 0x03, 0x3f, 0x3f, 0x00, 0x00, 0x00 },	// U+017E (ž)
 	{ 0x00, 0x00, 0x00, 0x1c, 0x3e, 0x26, 0x06, 0x07, 0x07, 0x06, 0x06, 0x06, 0x06, 0x00, 0x00, 0x00 },	// U+017F (ſ)
-}; // 224
-
-static const unsigned char fatty_block4[][16] = {
 	{ 0x00, 0x00, 0x00, 0x1e, 0x3f, 0x33, 0x03, 0x0e, 0x1c, 0x30, 0x33, 0x3f, 0x1e, 0x00, 0x0c, 0x06 },	// U+0218 (Ș)
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x1e, 0x37, 0x03, 0x1f, 0x3e, 0x30, 0x3b, 0x1e, 0x00, 0x0c, 0x06 },	// U+0219 (ș)
 	{ 0x00, 0x00, 0x00, 0x3f, 0x3f, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x00, 0x0c, 0x06 },	// U+021A (Ț)
 	{ 0x00, 0x00, 0x00, 0x06, 0x06, 0x1f, 0x1f, 0x06, 0x06, 0x06, 0x26, 0x3e, 0x1c, 0x00, 0x0c, 0x06 },	// U+021B (ț)
-}; // 4
-
-static const unsigned char fatty_block5[][16] = {
 	{ 0x00, 0x00, 0x33, 0x1e, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+02C7 (ˇ)
-}; // 1
-
-static const unsigned char fatty_block6[][16] = {
 	{ 0x00, 0x00, 0x21, 0x3f, 0x1e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+02D8 (˘)
 	{ 0x00, 0x00, 0x0c, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+02D9 (˙)
-}; // 2
-
-static const unsigned char fatty_block7[][16] = {
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0c, 0x06, 0x16, 0x0c, 0x00 },	// U+02DB (˛)
-}; // 1
-
-static const unsigned char fatty_block8[][16] = {
 	{ 0x00, 0x00, 0x36, 0x36, 0x12, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+02DD (˝)
-}; // 1
-
-static const unsigned char fatty_block9[][16] = {
 	{ 0x0c, 0x0c, 0x00, 0x1f, 0x3f, 0x33, 0x33, 0x1f, 0x1f, 0x33, 0x33, 0x3f, 0x1f, 0x00, 0x00, 0x00 },	// U+1E02 (Ḃ)
 	{ 0x0c, 0x0c, 0x00, 0x03, 0x03, 0x1b, 0x3f, 0x37, 0x33, 0x33, 0x37, 0x3f, 0x1d, 0x00, 0x00, 0x00 },	// U+1E03 (ḃ)
-}; // 2
-
-static const unsigned char fatty_block10[][16] = {
 	{ 0x0c, 0x0c, 0x00, 0x0f, 0x1f, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x1f, 0x0f, 0x00, 0x00, 0x00 },	// U+1E0A (Ḋ)
 	{ 0x0c, 0x0c, 0x00, 0x30, 0x30, 0x36, 0x3f, 0x3b, 0x33, 0x33, 0x3b, 0x3f, 0x2e, 0x00, 0x00, 0x00 },	// U+1E0B (ḋ)
-}; // 2
-
-static const unsigned char fatty_block11[][16] = {
 	{ 0x0c, 0x0c, 0x00, 0x3f, 0x3f, 0x03, 0x03, 0x1f, 0x1f, 0x03, 0x03, 0x03, 0x03, 0x00, 0x00, 0x00 },	// U+1E1E (Ḟ)
 	{ 0x0c, 0x0c, 0x00, 0x1c, 0x3e, 0x26, 0x06, 0x1f, 0x1f, 0x06, 0x06, 0x06, 0x06, 0x00, 0x00, 0x00 },	// U+1E1F (ḟ)
-}; // 2
-
-static const unsigned char fatty_block12[][16] = {
 	{ 0x0c, 0x0c, 0x00, 0x21, 0x33, 0x3f, 0x3f, 0x3f, 0x33, 0x33, 0x33, 0x33, 0x33, 0x00, 0x00, 0x00 },	// U+1E40 (Ṁ)
 	{ 0x00, 0x00, 0x0c, 0x0c, 0x00, 0x33, 0x3f, 0x3f, 0x3f, 0x33, 0x33, 0x33, 0x33, 0x00, 0x00, 0x00 },	// U+1E41 (ṁ)
-}; // 2
-
-static const unsigned char fatty_block13[][16] = {
 	{ 0x0c, 0x0c, 0x00, 0x1f, 0x3f, 0x33, 0x33, 0x3f, 0x1f, 0x03, 0x03, 0x03, 0x03, 0x00, 0x00, 0x00 },	// U+1E56 (Ṗ)
 	{ 0x00, 0x00, 0x0c, 0x0c, 0x00, 0x1d, 0x3f, 0x33, 0x33, 0x33, 0x3f, 0x1b, 0x03, 0x03, 0x03, 0x03 },	// U+1E57 (ṗ)
-}; // 2
-
-static const unsigned char fatty_block14[][16] = {
 	{ 0x0c, 0x0c, 0x00, 0x1e, 0x3f, 0x33, 0x03, 0x0e, 0x1c, 0x30, 0x33, 0x3f, 0x1e, 0x00, 0x00, 0x00 },	// U+1E60 (Ṡ)
 	{ 0x00, 0x00, 0x0c, 0x0c, 0x00, 0x1e, 0x37, 0x03, 0x1f, 0x3e, 0x30, 0x3b, 0x1e, 0x00, 0x00, 0x00 },	// U+1E61 (ṡ)
-}; // 2
-
-static const unsigned char fatty_block15[][16] = {
 	{ 0x0c, 0x0c, 0x00, 0x3f, 0x3f, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x00, 0x00, 0x00 },	// U+1E6A (Ṫ)
 	{ 0x0c, 0x0c, 0x00, 0x06, 0x06, 0x1f, 0x1f, 0x06, 0x06, 0x06, 0x26, 0x3e, 0x1c, 0x00, 0x00, 0x00 },	// U+1E6B (ṫ)
-}; // 2
-
-static const unsigned char fatty_block16[][16] = {
 	{ 0x06, 0x0c, 0x08, 0x21, 0x33, 0x33, 0x33, 0x33, 0x3f, 0x3f, 0x3f, 0x33, 0x21, 0x00, 0x00, 0x00 },	// U+1E80 (Ẁ)
 	{ 0x00, 0x06, 0x0c, 0x08, 0x00, 0x33, 0x33, 0x33, 0x33, 0x3f, 0x3f, 0x3f, 0x33, 0x00, 0x00, 0x00 },	// U+1E81 (ẁ)
 	{ 0x18, 0x0c, 0x04, 0x21, 0x33, 0x33, 0x33, 0x33, 0x3f, 0x3f, 0x3f, 0x33, 0x21, 0x00, 0x00, 0x00 },	// U+1E82 (Ẃ)
 	{ 0x00, 0x18, 0x0c, 0x04, 0x00, 0x33, 0x33, 0x33, 0x33, 0x3f, 0x3f, 0x3f, 0x33, 0x00, 0x00, 0x00 },	// U+1E83 (ẃ)
 	{ 0x33, 0x33, 0x00, 0x21, 0x33, 0x33, 0x33, 0x33, 0x3f, 0x3f, 0x3f, 0x33, 0x21, 0x00, 0x00, 0x00 },	// U+1E84 (Ẅ)
 	{ 0x00, 0x00, 0x33, 0x33, 0x00, 0x33, 0x33, 0x33, 0x33, 0x3f, 0x3f, 0x3f, 0x33, 0x00, 0x00, 0x00 },	// U+1E85 (ẅ)
-}; // 6
-
-static const unsigned char fatty_block17[][16] = {
 	{ 0x06, 0x0c, 0x08, 0x23, 0x33, 0x33, 0x33, 0x3f, 0x1e, 0x0c, 0x0c, 0x0c, 0x0c, 0x00, 0x00, 0x00 },	// U+1EF2 (Ỳ)
 	{ 0x00, 0x06, 0x0c, 0x08, 0x00, 0x33, 0x33, 0x33, 0x33, 0x3b, 0x3f, 0x36, 0x30, 0x31, 0x3f, 0x1e },	// U+1EF3 (ỳ)
-}; // 2
-
-static const unsigned char fatty_block18[][16] = {
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3e, 0x3e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+2010 (‐)
-}; // 1
-
-static const unsigned char fatty_block19[][16] = {
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3f, 0x3f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+2013 (–)
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7f, 0x7f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+2014 (—)
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7f, 0x7f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+2015 (―)
-}; // 3
-
-static const unsigned char fatty_block20[][16] = {
 	{ 0x00, 0x00, 0x18, 0x0c, 0x1c, 0x1c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+2018 (‘)
 	{ 0x00, 0x00, 0x1c, 0x1c, 0x18, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+2019 (’)
-}; // 2
-
-static const unsigned char fatty_block21[][16] = {
 	{ 0x00, 0x00, 0x1c, 0x1c, 0x0c, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+201B (‛)
 	{ 0x00, 0x00, 0x36, 0x1b, 0x3f, 0x3f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+201C (“)
 	{ 0x00, 0x00, 0x3f, 0x3f, 0x36, 0x1b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+201D (”)
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3f, 0x3f, 0x36, 0x1b, 0x00 },	// U+201E („)
 	{ 0x00, 0x00, 0x3f, 0x3f, 0x1b, 0x36, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+201F (‟)
-}; // 5
-
-static const unsigned char fatty_block22[][16] = {
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x0c, 0x1e, 0x3f, 0x3f, 0x1e, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+2022 (•)
-}; // 1
-
-static const unsigned char fatty_block23[][16] = {
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x15, 0x00, 0x00, 0x00 },	// U+2026 (…)
-}; // 1
-
-static const unsigned char fatty_block24[][16] = {
 	{ 0x00, 0x00, 0x00, 0x26, 0x39, 0x19, 0x1e, 0x0c, 0x0c, 0x3e, 0x56, 0x57, 0x3d, 0x00, 0x00, 0x00 },	// U+2030 (‰)
-}; // 1
-
-static const unsigned char fatty_block25[][16] = {
 	{ 0x00, 0x00, 0x00, 0x30, 0x33, 0x1b, 0x18, 0x0c, 0x0c, 0x06, 0x36, 0x33, 0x03, 0x00, 0x00, 0x00 },	// U+2052 (⁒)
-}; // 1
-
-static const unsigned char fatty_block26[][16] = {
 	{ 0x00, 0x00, 0x00, 0x3c, 0x7e, 0x66, 0x06, 0x3f, 0x06, 0x1f, 0x06, 0x66, 0x7e, 0x3c, 0x00, 0x00 },	// U+20AC (€)
-}; // 1
-
-static const unsigned char fatty_block27[][16] = {
 	{ 0x00, 0x00, 0x00, 0x2f, 0x3a, 0x3a, 0x2a, 0x2a, 0x2a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+2122 (™)
-}; // 1
-
-static const unsigned char fatty_block28[][16] = {
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x18, 0x3f, 0x3f, 0x18, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+2192 (→)
-}; // 1
-
-static const unsigned char fatty_block29[][16] = {
 	{ 0x00, 0x00, 0x00, 0x18, 0x18, 0x3f, 0x3f, 0x0c, 0x0c, 0x3f, 0x3f, 0x06, 0x06, 0x00, 0x00, 0x00 },	// U+2260 (≠)
-}; // 1
-
-static const unsigned char fatty_block30[][16] = {
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+2500 (─)
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7f, 0x7f, 0x7f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+2501 (━)
 	{ 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08 },	// U+2502 (│)
 	{ 0x1c, 0x1c, 0x1c, 0x1c, 0x1c, 0x1c, 0x1c, 0x1c, 0x1c, 0x1c, 0x1c, 0x1c, 0x1c, 0x1c, 0x1c, 0x1c },	// U+2503 (┃)
-}; // 4
-
-static const unsigned char fatty_block31[][16] = {
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x78, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08 },	// U+250C (┌)
-}; // 1
-
-static const unsigned char fatty_block32[][16] = {
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0f, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08 },	// U+2510 (┐)
-}; // 1
-
-static const unsigned char fatty_block33[][16] = {
 	{ 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x78, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+2514 (└)
-}; // 1
-
-static const unsigned char fatty_block34[][16] = {
 	{ 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+2518 (┘)
-}; // 1
-
-static const unsigned char fatty_block35[][16] = {
 	{ 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x78, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08 },	// U+251C (├)
-}; // 1
-
-static const unsigned char fatty_block36[][16] = {
 	{ 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x0f, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08 },	// U+2524 (┤)
-}; // 1
-
-static const unsigned char fatty_block37[][16] = {
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7f, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08 },	// U+252C (┬)
-}; // 1
-
-static const unsigned char fatty_block38[][16] = {
 	{ 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x7f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+2534 (┴)
-}; // 1
-
-static const unsigned char fatty_block39[][16] = {
 	{ 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x7f, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08 },	// U+253C (┼)
-}; // 1
-
-static const unsigned char fatty_block40[][16] = {
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x3f, 0x3f, 0x3f, 0x3f, 0x3f, 0x3f, 0x3f, 0x00, 0x00, 0x00, 0x00 },	// U+25A0 (■)
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x3f, 0x3f, 0x33, 0x33, 0x33, 0x3f, 0x3f, 0x00, 0x00, 0x00, 0x00 },	// U+25A1 (□)
-}; // 2
-
-static const unsigned char fatty_block41[][16] = {
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x04, 0x0e, 0x0e, 0x1f, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+25B2 (▲)
-}; // 1
-
-static const unsigned char fatty_block42[][16] = {
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x0f, 0x3f, 0x3f, 0x0f, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+25BA (►)
-}; // 1
-
-static const unsigned char fatty_block43[][16] = {
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x1f, 0x1f, 0x0e, 0x0e, 0x04, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+25BC (▼)
-}; // 1
-
-static const unsigned char fatty_block44[][16] = {
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x1e, 0x3f, 0x33, 0x33, 0x33, 0x3f, 0x1e, 0x00, 0x00, 0x00, 0x00 },	// U+25CB (○)
-}; // 1
-
-static const unsigned char fatty_block45[][16] = {
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x1e, 0x3f, 0x3f, 0x3f, 0x3f, 0x3f, 0x1e, 0x00, 0x00, 0x00, 0x00 },	// U+25CF (●)
-}; // 1
-
-static const unsigned char fatty_block46[][16] = {
 	{ 0x00, 0x00, 0x00, 0x00, 0x0c, 0x1e, 0x1e, 0x0c, 0x1e, 0x3f, 0x3f, 0x3f, 0x1e, 0x00, 0x00, 0x00 },	// U+2603 (☃)
-}; // 1
-
-static const unsigned char fatty_block47[][16] = {
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x08, 0x3e, 0x1c, 0x1c, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+2605 (★)
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x08, 0x3e, 0x14, 0x1c, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+2606 (☆)
-}; // 2
-
-static const unsigned char fatty_block48[][16] = {
 	{ 0x00, 0x00, 0x00, 0x00, 0x1c, 0x22, 0x41, 0x55, 0x41, 0x55, 0x5d, 0x49, 0x22, 0x1c, 0x00, 0x00 },	// U+263A (☺)
-}; // 1
-
-static const unsigned char fatty_block49[][16] = {
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0x77, 0x7f, 0x7f, 0x3e, 0x1c, 0x08, 0x00, 0x00, 0x00, 0x00 },	// U+2665 (♥)
-}; // 1
-
-static const unsigned char fatty_block50[][16] = {
 	{ 0x00, 0x00, 0x0c, 0x0c, 0x00, 0x33, 0x21, 0x0c, 0x0c, 0x21, 0x33, 0x00, 0x0c, 0x0c, 0x00, 0x00 },	// U+269B (⚛)
-}; // 1
-
-static const unsigned char fatty_block51[][16] = {
 	{ 0x00, 0x00, 0x00, 0x00, 0x40, 0x60, 0x50, 0x53, 0x4d, 0x21, 0x11, 0x0e, 0x00, 0x00, 0x00, 0x00 },	// U+2705 (✅)
-}; // 1
-
-static const unsigned char fatty_block52[][16] = {
 	{ 0x00, 0x00, 0x00, 0x00, 0x04, 0x0c, 0x18, 0x19, 0x3f, 0x19, 0x18, 0x0c, 0x04, 0x00, 0x00, 0x00 },	// U+2708 (✈)
-}; // 1
-
-static const unsigned char fatty_block53[][16] = {
 	{ 0x00, 0x00, 0x00, 0x00, 0x20, 0x30, 0x31, 0x1b, 0x1b, 0x0e, 0x0e, 0x04, 0x04, 0x00, 0x00, 0x00 },	// U+2713 (✓)
-}; // 1
-
-static const unsigned char fatty_block54[][16] = {
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x0a, 0x15, 0x0e, 0x15, 0x0a, 0x04, 0x00, 0x00, 0x00, 0x00 },	// U+2744 (❄)
-}; // 1
-
-static const unsigned char fatty_block55[][16] = {
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+2800 (⠀)
 	{ 0x00, 0x06, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+2801 (⠁)
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+2802 (⠂)
@@ -824,13 +662,59 @@ static const unsigned char fatty_block55[][16] = {
 	{ 0x00, 0x36, 0x36, 0x00, 0x00, 0x30, 0x30, 0x00, 0x00, 0x36, 0x36, 0x00, 0x00, 0x36, 0x36, 0x00 },	// U+28FD (⣽)
 	{ 0x00, 0x30, 0x30, 0x00, 0x00, 0x36, 0x36, 0x00, 0x00, 0x36, 0x36, 0x00, 0x00, 0x36, 0x36, 0x00 },	// U+28FE (⣾)
 	{ 0x00, 0x36, 0x36, 0x00, 0x00, 0x36, 0x36, 0x00, 0x00, 0x36, 0x36, 0x00, 0x00, 0x36, 0x36, 0x00 },	// U+28FF (⣿)
-}; // 256
-
-static const unsigned char fatty_block56[][16] = {
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1c, 0x1c, 0x1c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+30FB (・)
-}; // 1
-
-static const unsigned char fatty_block57[][16] = {
 	{ 0x00, 0x00, 0x0c, 0x1e, 0x33, 0x21, 0x2d, 0x2f, 0x23, 0x33, 0x3f, 0x12, 0x1e, 0x0c, 0x00, 0x00 },	// U+FFFD (�)
-}; // 1
+}; // 659
+
+static const uint8_t fatty_page_index[] = {
+	0x01, 0x02, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00,
+	0x05, 0x06, 0x07, 0x00, 0x00, 0x08, 0x09, 0x0a, 0x0b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0d,
+}; // 256
 
+static const uint32_t fatty_page_bits[][8] = {
+	{ 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000 },	// Empty
+	{ 0x00000001, 0xffffffff, 0xffffffff, 0xffffffff, 0x00000000, 0xffffffff, 0xffffffff, 0xffffffff },	// U+00xx
+	{ 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0x00000000, 0x00000000, 0x00000000, 0x00000000 },	// U+01xx
+	{ 0x0f000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x2b000080, 0x00000000 },	// U+02xx
+	{ 0xc0000c0c, 0x00000000, 0x00c00003, 0x00000c03, 0x0000003f, 0x00000000, 0x00000000, 0x000c0000 },	// U+1Exx
+	{ 0xfb390000, 0x00010044, 0x00040000, 0x00000000, 0x00000000, 0x00001000, 0x00000000, 0x00000000 },	// U+20xx
+	{ 0x00000000, 0x00000004, 0x00000000, 0x00000000, 0x00040000, 0x00000000, 0x00000000, 0x00000000 },	// U+21xx
+	{ 0x00000000, 0x00000000, 0x00000000, 0x00000001, 0x00000000, 0x00000000, 0x00000000, 0x00000000 },	// U+22xx
+	{ 0x1111100f, 0x10101010, 0x00000000, 0x00000000, 0x00000000, 0x14040003, 0x00008800, 0x00000000 },	// U+25xx
+	{ 0x00000068, 0x04000000, 0x00000000, 0x00000020, 0x08000000, 0x00000000, 0x00000000, 0x00000000 },	// U+26xx
+	{ 0x00080120, 0x00000000, 0x00000010, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000 },	// U+27xx
+	{ 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff },	// U+28xx
+	{ 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x08000000 },	// U+30xx
+	{ 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x20000000 },	// U+FFxx
+}; // 14
+
+static const uint16_t fatty_page_base[][8] = {
+	{ 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000 },	// Empty
+	{ 0x0000, 0x0001, 0x0021, 0x0041, 0x0061, 0x0061, 0x0081, 0x00a1 },	// U+00xx
+	{ 0x00c1, 0x00e1, 0x0101, 0x0121, 0x0141, 0x0141, 0x0141, 0x0141 },	// U+01xx
+	{ 0x0141, 0x0145, 0x0145, 0x0145, 0x0145, 0x0145, 0x0145, 0x014a },	// U+02xx
+	{ 0x014a, 0x0150, 0x0150, 0x0154, 0x0158, 0x015e, 0x015e, 0x015e },	// U+1Exx
+	{ 0x0160, 0x016b, 0x016e, 0x016f, 0x016f, 0x016f, 0x0170, 0x0170 },	// U+20xx
+	{ 0x0170, 0x0170, 0x0171, 0x0171, 0x0171, 0x0172, 0x0172, 0x0172 },	// U+21xx
+	{ 0x0172, 0x0172, 0x0172, 0x0172, 0x0173, 0x0173, 0x0173, 0x0173 },	// U+22xx
+	{ 0x0173, 0x017c, 0x0180, 0x0180, 0x0180, 0x0180, 0x0185, 0x0187 },	// U+25xx
+	{ 0x0187, 0x018a, 0x018b, 0x018b, 0x018c, 0x018d, 0x018d, 0x018d },	// U+26xx
+	{ 0x018d, 0x0190, 0x0190, 0x0191, 0x0191, 0x0191, 0x0191, 0x0191 },	// U+27xx
+	{ 0x0191, 0x01b1, 0x01d1, 0x01f1, 0x0211, 0x0231, 0x0251, 0x0271 },	// U+28xx
+	{ 0x0291, 0x0291, 0x0291, 0x0291, 0x0291, 0x0291, 0x0291, 0x0291 },	// U+30xx
+	{ 0x0292, 0x0292, 0x0292, 0x0292, 0x0292, 0x0292, 0x0292, 0x0292 },	// U+FFxx
+}; // 14
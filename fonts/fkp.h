@@ -4,7 +4,7 @@
 * With FBInk's tools/hextoc.py
 */
 
-static const unsigned char fkp_block1[][16] = {
+static const unsigned char fkp_glyphs[][16] = {
 	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },	// U+0000 (ESC)
 	{ 0x00, 0x00, 0x3c, 0x42, 0x81, 0xa5, 0x81, 0x81, 0xa5, 0x99, 0x42, 0x3c, 0x00, 0x00, 0x00, 0x00 },	// U+0001 (ESC)
 	{ 0x00, 0x00, 0x3c, 0x7e, 0xff, 0xdb, 0xff, 0xff, 0xdb, 0xe7, 0x7e, 0x3c, 0x00, 0x00, 0x00, 0x00 },	// U+0002 (ESC)
@@ -263,3 +263,16 @@ static const unsigned char fkp_block1[][16] = {
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+00FF (ÿ)
 }; // 256
 
+static const uint8_t fkp_page_index[] = {
+	0x01,
+}; // 1
+
+static const uint32_t fkp_page_bits[][8] = {
+	{ 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000 },	// Empty
+	{ 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff },	// U+00xx
+}; // 2
+
+static const uint16_t fkp_page_base[][8] = {
+	{ 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000 },	// Empty
+	{ 0x0000, 0x0020, 0x0040, 0x0060, 0x0080, 0x00a0, 0x00c0, 0x00e0 },	// U+00xx
+}; // 2
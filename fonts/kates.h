@@ -4,13 +4,10 @@
 * With FBInk's tools/hextoc.py
 */
 
-static const unsigned char kates_block1[][15] = {
+static const unsigned char kates_glyphs[][15] = {
 	{ 0x00, 0x3e, 0x3e, 0x3e, 0x3e, 0x3e, 0x3e, 0x3e, 0x3e, 0x3e, 0x3e, 0x3e, 0x3e, 0x00, 0x00 },	// U+0000 (ESC)
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x1c, 0x3e, 0x1c, 0x08, 0x00, 0x00, 0x00, 0x00 },	// U+0001 (ESC)
 	{ 0x00, 0x2a, 0x14, 0x2a, 0x14, 0x2a, 0x14, 0x2a, 0x14, 0x2a, 0x14, 0x2a, 0x14, 0x00, 0x00 },	// U+0002 (ESC)
-}; // 3
-
-static const unsigned char kates_block2[][15] = {
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+0009 (ESC)
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+000A (ESC)
 	{ 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+000B (ESC)
@@ -28,13 +25,7 @@ static const unsigned char kates_block2[][15] = {
 	{ 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x7f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+0017 (ESC)
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7f, 0x08, 0x08, 0x08, 0x08, 0x08, 0x00 },	// U+0018 (ESC)
 	{ 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08 },	// U+0019 (ESC)
-}; // 17
-
-static const unsigned char kates_block3[][15] = {
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+001B (ESC)
-}; // 1
-
-static const unsigned char kates_block4[][15] = {
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+0020 ( )
 	{ 0x00, 0x00, 0x00, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x00, 0x08, 0x08, 0x00, 0x00, 0x00 },	// U+0021 (!)
 	{ 0x00, 0x00, 0x00, 0x12, 0x12, 0x12, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+0022 (")
@@ -130,9 +121,6 @@ static const unsigned char kates_block4[][15] = {
 	{ 0x00, 0x00, 0x00, 0x08, 0x08, 0x08, 0x08, 0x00, 0x00, 0x08, 0x08, 0x08, 0x08, 0x00, 0x00 },	// U+007C (|)
 	{ 0x00, 0x00, 0x00, 0x0e, 0x10, 0x10, 0x10, 0x20, 0x20, 0x10, 0x10, 0x10, 0x0e, 0x00, 0x00 },	// U+007D (})
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x26, 0x19, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+007E (~)
-}; // 95
-
-static const unsigned char kates_block5[][15] = {
 	{ 0x00, 0x00, 0x00, 0x08, 0x08, 0x00, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x00, 0x00, 0x00 },	// U+00A1 (¡)
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x3e, 0x09, 0x09, 0x09, 0x09, 0x3e, 0x08, 0x00, 0x00 },	// U+00A2 (¢)
 	{ 0x00, 0x00, 0x00, 0x1c, 0x22, 0x22, 0x02, 0x02, 0x02, 0x1f, 0x02, 0x02, 0x3d, 0x00, 0x00 },	// U+00A3 (£)
@@ -145,9 +133,6 @@ static const unsigned char kates_block5[][15] = {
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x1e, 0x11, 0x11, 0x11, 0x1e, 0x00, 0x1f, 0x00, 0x00, 0x00 },	// U+00AA (ª)
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x24, 0x12, 0x09, 0x12, 0x24, 0x00, 0x00, 0x00, 0x00 },	// U+00AB («)
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3e, 0x20, 0x20, 0x20, 0x00, 0x00, 0x00 },	// U+00AC (¬)
-}; // 12
-
-static const unsigned char kates_block6[][15] = {
 	{ 0x00, 0x00, 0x00, 0x0e, 0x21, 0x2e, 0x2a, 0x26, 0x2a, 0x0a, 0x21, 0x1e, 0x00, 0x00, 0x00 },	// U+00AE (®)
 	{ 0x00, 0x3e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+00AF (¯)
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x1c, 0x22, 0x22, 0x22, 0x1c, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+00B0 (°)
@@ -230,5 +215,18 @@ static const unsigned char kates_block6[][15] = {
 	{ 0x00, 0x00, 0x00, 0x00, 0x08, 0x04, 0x21, 0x21, 0x21, 0x21, 0x21, 0x1e, 0x10, 0x0f, 0x00 },	// U+00FD (ý)
 	{ 0x00, 0x00, 0x00, 0x01, 0x01, 0x01, 0x1f, 0x20, 0x20, 0x20, 0x1f, 0x01, 0x01, 0x01, 0x00 },	// U+00FE (þ)
 	{ 0x00, 0x00, 0x00, 0x00, 0x14, 0x00, 0x21, 0x21, 0x21, 0x21, 0x21, 0x1e, 0x10, 0x0f, 0x00 },	// U+00FF (ÿ)
-}; // 82
+}; // 210
+
+static const uint8_t kates_page_index[] = {
+	0x01,
+}; // 1
+
+static const uint32_t kates_page_bits[][8] = {
+	{ 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000 },	// Empty
+	{ 0x0bfffe07, 0xffffffff, 0xffffffff, 0x7fffffff, 0x00000000, 0xffffdffe, 0xffffffff, 0xffffffff },	// U+00xx
+}; // 2
 
+static const uint16_t kates_page_base[][8] = {
+	{ 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000 },	// Empty
+	{ 0x0000, 0x0015, 0x0035, 0x0055, 0x0074, 0x0074, 0x0092, 0x00b2 },	// U+00xx
+}; // 2
@@ -4,7 +4,7 @@
 * With FBInk's tools/hextoc.py
 */
 
-static const unsigned char leggie_block1[][18] = {
+static const unsigned char leggie_glyphs[][18] = {
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+0020 ( )
 	{ 0x00, 0x00, 0x00, 0x00, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00 },	// U+0021 (!)
 	{ 0x00, 0x00, 0x00, 0x00, 0x44, 0x44, 0x44, 0x44, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+0022 (")
@@ -100,9 +100,6 @@ static const unsigned char leggie_block1[][18] = {
 	{ 0x00, 0x00, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10 },	// U+007C (|)
 	{ 0x00, 0x00, 0x08, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x20, 0x20, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x08 },	// U+007D (})
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0c, 0x92, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+007E (~)
-}; // 95
-
-static const unsigned char leggie_block2[][18] = {
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+00A0 ( )
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10 },	// U+00A1 (¡)
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x20, 0xfc, 0x02, 0x02, 0x02, 0x02, 0x02, 0xfc, 0x10, 0x10, 0x00 },	// U+00A2 (¢)
@@ -327,34 +324,16 @@ static const unsigned char leggie_block2[][18] = {
 	{ 0x44, 0x28, 0x10, 0x00, 0xfe, 0x80, 0x80, 0x40, 0x20, 0x10, 0x08, 0x04, 0x02, 0x02, 0xfe, 0x00, 0x00, 0x00 },	// U+017D (Ž)
 	{ 0x00, 0x00, 0x00, 0x44, 0x28, 0x10, 0x00, 0x00, 0xfe, 0x40, 0x20, 0x10, 0x08, 0x04, 0xfe, 0x00, 0x00, 0x00 },	// U+017E (ž)
 	{ 0x00, 0x00, 0x00, 0x00, 0x70, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x00, 0x00, 0x00 },	// U+017F (ſ)
-}; // 224
-
-static const unsigned char leggie_block3[][18] = {
 	{ 0x00, 0x00, 0x00, 0x00, 0xfe, 0x80, 0x80, 0x80, 0x80, 0xf0, 0x80, 0x80, 0x80, 0x80, 0xfe, 0x00, 0x00, 0x00 },	// U+018E (Ǝ)
 	{ 0x00, 0x00, 0x00, 0x00, 0x7c, 0x80, 0x80, 0x80, 0x80, 0xfe, 0x82, 0x82, 0x82, 0x82, 0x7c, 0x00, 0x00, 0x00 },	// U+018F (Ə)
-}; // 2
-
-static const unsigned char leggie_block4[][18] = {
 	{ 0x00, 0x00, 0x00, 0x70, 0x08, 0x08, 0x08, 0x08, 0x3c, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x06, 0x00 },	// U+0192 (ƒ)
-}; // 1
-
-static const unsigned char leggie_block5[][18] = {
 	{ 0x00, 0x00, 0x00, 0x00, 0x7c, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x7c, 0x00, 0x00, 0x00 },	// U+01A0 (Ơ)
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7c, 0x82, 0x82, 0x82, 0x82, 0x82, 0x7c, 0x00, 0x00, 0x00 },	// U+01A1 (ơ)
-}; // 2
-
-static const unsigned char leggie_block6[][18] = {
 	{ 0x00, 0x00, 0x00, 0x00, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x7c, 0x00, 0x00, 0x00 },	// U+01AF (Ư)
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0xfc, 0x00, 0x00, 0x00 },	// U+01B0 (ư)
-}; // 2
-
-static const unsigned char leggie_block7[][18] = {
 	{ 0x00, 0x00, 0x00, 0x00, 0xfe, 0x80, 0x80, 0x40, 0x20, 0x7c, 0x08, 0x04, 0x02, 0x02, 0xfe, 0x00, 0x00, 0x00 },	// U+01B5 (Ƶ)
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfe, 0x40, 0x20, 0x7c, 0x08, 0x04, 0xfe, 0x00, 0x00, 0x00 },	// U+01B6 (ƶ)
 	{ 0x00, 0x00, 0x00, 0x00, 0xfe, 0x40, 0x20, 0x10, 0x78, 0x80, 0x80, 0x80, 0x80, 0x80, 0x7e, 0x00, 0x00, 0x00 },	// U+01B7 (Ʒ)
-}; // 3
-
-static const unsigned char leggie_block8[][18] = {
 	{ 0x44, 0x28, 0x10, 0x00, 0x7c, 0x82, 0x82, 0x82, 0x82, 0x82, 0xfe, 0x82, 0x82, 0x82, 0x82, 0x00, 0x00, 0x00 },	// U+01CD (Ǎ)
 	{ 0x00, 0x00, 0x00, 0x44, 0x28, 0x10, 0x00, 0x00, 0x7c, 0x80, 0x80, 0xfc, 0x82, 0x82, 0xfc, 0x00, 0x00, 0x00 },	// U+01CE (ǎ)
 	{ 0x44, 0x28, 0x10, 0x00, 0x38, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x38, 0x00, 0x00, 0x00 },	// U+01CF (Ǐ)
@@ -372,39 +351,24 @@ static const unsigned char leggie_block8[][18] = {
 	{ 0x04, 0x08, 0x92, 0x00, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x7c, 0x00, 0x00, 0x00 },	// U+01DB (Ǜ)
 	{ 0x04, 0x08, 0x10, 0x00, 0x00, 0x44, 0x00, 0x00, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0xfc, 0x00, 0x00, 0x00 },	// U+01DC (ǜ)
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7c, 0x80, 0x80, 0xfe, 0x82, 0x82, 0x7c, 0x00, 0x00, 0x00 },	// U+01DD (ǝ)
-}; // 17
-
-static const unsigned char leggie_block9[][18] = {
 	{ 0x00, 0x00, 0x00, 0x00, 0xfc, 0x02, 0x02, 0x02, 0x02, 0xe2, 0x82, 0xf2, 0x82, 0x82, 0xfc, 0x00, 0x00, 0x00 },	// U+01E4 (Ǥ)
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfc, 0x82, 0x82, 0xff, 0x82, 0x82, 0xfc, 0x80, 0x80, 0x78 },	// U+01E5 (ǥ)
 	{ 0x44, 0x28, 0x10, 0x00, 0xfc, 0x02, 0x02, 0x02, 0x02, 0xe2, 0x82, 0x82, 0x82, 0x82, 0xfc, 0x00, 0x00, 0x00 },	// U+01E6 (Ǧ)
 	{ 0x00, 0x00, 0x00, 0x44, 0x28, 0x10, 0x00, 0x00, 0xfc, 0x82, 0x82, 0x82, 0x82, 0x82, 0xfc, 0x80, 0x80, 0x78 },	// U+01E7 (ǧ)
 	{ 0x44, 0x28, 0x10, 0x00, 0x82, 0x42, 0x22, 0x12, 0x0a, 0x06, 0x0a, 0x12, 0x22, 0x42, 0x82, 0x00, 0x00, 0x00 },	// U+01E8 (Ǩ)
 	{ 0x44, 0x28, 0x10, 0x04, 0x04, 0x04, 0x04, 0x04, 0x44, 0x24, 0x14, 0x0c, 0x14, 0x24, 0x44, 0x00, 0x00, 0x00 },	// U+01E9 (ǩ)
-}; // 6
-
-static const unsigned char leggie_block10[][18] = {
 	{ 0x44, 0x28, 0x10, 0x00, 0xfe, 0x40, 0x20, 0x10, 0x78, 0x80, 0x80, 0x80, 0x80, 0x80, 0x7e, 0x00, 0x00, 0x00 },	// U+01EE (Ǯ)
 	{ 0x00, 0x00, 0x00, 0x44, 0x28, 0x10, 0x00, 0x00, 0xfe, 0x40, 0x20, 0x10, 0x78, 0x80, 0x80, 0x80, 0x80, 0x7e },	// U+01EF (ǯ)
-}; // 2
-
-static const unsigned char leggie_block11[][18] = {
 	{ 0x20, 0x10, 0x28, 0x10, 0x7c, 0x82, 0x82, 0x82, 0x82, 0x82, 0xfe, 0x82, 0x82, 0x82, 0x82, 0x00, 0x00, 0x00 },	// U+01FA (Ǻ)
 	{ 0x40, 0x20, 0x10, 0x00, 0x10, 0x28, 0x10, 0x00, 0x7c, 0x80, 0x80, 0xfc, 0x82, 0x82, 0xfc, 0x00, 0x00, 0x00 },	// U+01FB (ǻ)
 	{ 0x40, 0x20, 0x10, 0x00, 0xfe, 0x11, 0x11, 0x11, 0x11, 0x71, 0x1f, 0x11, 0x11, 0x11, 0xf1, 0x00, 0x00, 0x00 },	// U+01FC (Ǽ)
 	{ 0x00, 0x00, 0x00, 0x40, 0x20, 0x10, 0x00, 0x00, 0xee, 0x10, 0x10, 0xfe, 0x11, 0x11, 0xee, 0x00, 0x00, 0x00 },	// U+01FD (ǽ)
 	{ 0x40, 0x20, 0x10, 0x00, 0xfc, 0xc2, 0xc2, 0xa2, 0xa2, 0x92, 0x8a, 0x8a, 0x86, 0x86, 0x7e, 0x00, 0x00, 0x00 },	// U+01FE (Ǿ)
 	{ 0x00, 0x00, 0x00, 0x40, 0x20, 0x10, 0x00, 0x00, 0xfc, 0xc2, 0xa2, 0x92, 0x8a, 0x86, 0x7e, 0x00, 0x00, 0x00 },	// U+01FF (ǿ)
-}; // 6
-
-static const unsigned char leggie_block12[][18] = {
 	{ 0x00, 0x00, 0x00, 0x00, 0xfc, 0x02, 0x02, 0x02, 0x02, 0x7c, 0x80, 0x80, 0x80, 0x80, 0x7e, 0x00, 0x10, 0x08 },	// U+0218 (Ș)
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfc, 0x02, 0x02, 0x7c, 0x80, 0x80, 0x7e, 0x00, 0x10, 0x08 },	// U+0219 (ș)
 	{ 0x00, 0x00, 0x00, 0x00, 0xfe, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x00, 0x10, 0x08 },	// U+021A (Ț)
 	{ 0x00, 0x00, 0x00, 0x08, 0x08, 0x08, 0x08, 0x08, 0x3c, 0x08, 0x08, 0x08, 0x08, 0x08, 0x70, 0x00, 0x10, 0x08 },	// U+021B (ț)
-}; // 4
-
-static const unsigned char leggie_block13[][18] = {
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7e, 0x82, 0x82, 0x7e, 0x02, 0x02, 0x7c, 0x00, 0x00, 0x00 },	// U+0250 (ɐ)
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfc, 0x82, 0x82, 0x82, 0x82, 0x82, 0xfc, 0x00, 0x00, 0x00 },	// U+0251 (ɑ)
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7e, 0x82, 0x82, 0x82, 0x82, 0x82, 0x7e, 0x00, 0x00, 0x00 },	// U+0252 (ɒ)
@@ -564,33 +528,15 @@ static const unsigned char leggie_block13[][18] = {
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x28, 0x10, 0x00 },	// U+02EC (ˬ)
 	{ 0xfe, 0x00, 0xfe, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+02ED (˭)
 	{ 0x00, 0x00, 0x00, 0x00, 0x28, 0x28, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+02EE (ˮ)
-}; // 159
-
-static const unsigned char leggie_block14[][18] = {
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x10, 0x10 },	// U+037A (ͺ)
-}; // 1
-
-static const unsigned char leggie_block15[][18] = {
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x10, 0x08, 0x00 },	// U+037E (;)
-}; // 1
-
-static const unsigned char leggie_block16[][18] = {
 	{ 0x40, 0x20, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+0384 (΄)
 	{ 0x40, 0x20, 0x92, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+0385 (΅)
 	{ 0x00, 0x00, 0x04, 0x02, 0x7d, 0x82, 0x82, 0x82, 0x82, 0x82, 0xfe, 0x82, 0x82, 0x82, 0x82, 0x00, 0x00, 0x00 },	// U+0386 (Ά)
-}; // 3
-
-static const unsigned char leggie_block17[][18] = {
 	{ 0x00, 0x00, 0x04, 0x02, 0xfd, 0x02, 0x02, 0x02, 0x02, 0x3e, 0x02, 0x02, 0x02, 0x02, 0xfe, 0x00, 0x00, 0x00 },	// U+0388 (Έ)
 	{ 0x00, 0x00, 0x04, 0x02, 0x81, 0x82, 0x82, 0x82, 0x82, 0xfe, 0x82, 0x82, 0x82, 0x82, 0x82, 0x00, 0x00, 0x00 },	// U+0389 (Ή)
 	{ 0x00, 0x00, 0x08, 0x04, 0x3a, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x38, 0x00, 0x00, 0x00 },	// U+038A (Ί)
-}; // 3
-
-static const unsigned char leggie_block18[][18] = {
 	{ 0x00, 0x00, 0x04, 0x02, 0x7d, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x7c, 0x00, 0x00, 0x00 },	// U+038C (Ό)
-}; // 1
-
-static const unsigned char leggie_block19[][18] = {
 	{ 0x00, 0x00, 0x04, 0x02, 0x81, 0x82, 0x82, 0x44, 0x28, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x00, 0x00, 0x00 },	// U+038E (Ύ)
 	{ 0x00, 0x00, 0x04, 0x02, 0x7d, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x44, 0x28, 0xee, 0x00, 0x00, 0x00 },	// U+038F (Ώ)
 	{ 0x40, 0x20, 0x10, 0x00, 0x00, 0x28, 0x00, 0x00, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x20, 0x00, 0x00, 0x00 },	// U+0390 (ΐ)
@@ -611,9 +557,6 @@ static const unsigned char leggie_block19[][18] = {
 	{ 0x00, 0x00, 0x00, 0x00, 0x7c, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x7c, 0x00, 0x00, 0x00 },	// U+039F (Ο)
 	{ 0x00, 0x00, 0x00, 0x00, 0xfe, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x00, 0x00, 0x00 },	// U+03A0 (Π)
 	{ 0x00, 0x00, 0x00, 0x00, 0x7e, 0x82, 0x82, 0x82, 0x82, 0x82, 0x7e, 0x02, 0x02, 0x02, 0x02, 0x00, 0x00, 0x00 },	// U+03A1 (Ρ)
-}; // 20
-
-static const unsigned char leggie_block20[][18] = {
 	{ 0x00, 0x00, 0x00, 0x00, 0xfe, 0x02, 0x04, 0x08, 0x10, 0x20, 0x10, 0x08, 0x04, 0x02, 0xfe, 0x00, 0x00, 0x00 },	// U+03A3 (Σ)
 	{ 0x00, 0x00, 0x00, 0x00, 0xfe, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x00, 0x00, 0x00 },	// U+03A4 (Τ)
 	{ 0x00, 0x00, 0x00, 0x00, 0x82, 0x82, 0x82, 0x44, 0x28, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x00, 0x00, 0x00 },	// U+03A5 (Υ)
@@ -658,9 +601,6 @@ static const unsigned char leggie_block20[][18] = {
 	{ 0x00, 0x00, 0x00, 0x40, 0x20, 0x10, 0x00, 0x00, 0x7c, 0x82, 0x82, 0x82, 0x82, 0x82, 0x7c, 0x00, 0x00, 0x00 },	// U+03CC (ό)
 	{ 0x00, 0x00, 0x00, 0x40, 0x20, 0x10, 0x00, 0x00, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x7c, 0x00, 0x00, 0x00 },	// U+03CD (ύ)
 	{ 0x00, 0x00, 0x00, 0x40, 0x20, 0x10, 0x00, 0x00, 0x44, 0x82, 0x82, 0x82, 0x92, 0x92, 0x6c, 0x00, 0x00, 0x00 },	// U+03CE (ώ)
-}; // 44
-
-static const unsigned char leggie_block21[][18] = {
 	{ 0x04, 0x08, 0x10, 0x00, 0xfe, 0x02, 0x02, 0x02, 0x02, 0x1e, 0x02, 0x02, 0x02, 0x02, 0xfe, 0x00, 0x00, 0x00 },	// U+0400 (Ѐ)
 	{ 0x00, 0x44, 0x00, 0x00, 0xfe, 0x02, 0x02, 0x02, 0x02, 0x1e, 0x02, 0x02, 0x02, 0x02, 0xfe, 0x00, 0x00, 0x00 },	// U+0401 (Ё)
 	{ 0x00, 0x00, 0x00, 0x00, 0x1f, 0x02, 0x02, 0x02, 0x7e, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x60, 0x00, 0x00 },	// U+0402 (Ђ)
@@ -781,14 +721,8 @@ static const unsigned char leggie_block21[][18] = {
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x82, 0x82, 0x44, 0x44, 0x28, 0x28, 0x10, 0x00, 0x00, 0x00 },	// U+0475 (ѵ)
 	{ 0x12, 0x24, 0x48, 0x00, 0x82, 0x82, 0x82, 0x82, 0x82, 0x44, 0x44, 0x44, 0x28, 0x28, 0x10, 0x00, 0x00, 0x00 },	// U+0476 (Ѷ)
 	{ 0x00, 0x00, 0x00, 0x00, 0x12, 0x24, 0x48, 0x00, 0x82, 0x82, 0x44, 0x44, 0x28, 0x28, 0x10, 0x00, 0x00, 0x00 },	// U+0477 (ѷ)
-}; // 120
-
-static const unsigned char leggie_block22[][18] = {
 	{ 0x00, 0x00, 0x00, 0x00, 0xfc, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0xfc, 0x80, 0x80, 0x80 },	// U+0480 (Ҁ)
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfc, 0x02, 0x02, 0x02, 0x02, 0x02, 0xfc, 0x80, 0x80, 0x80 },	// U+0481 (ҁ)
-}; // 2
-
-static const unsigned char leggie_block23[][18] = {
 	{ 0x44, 0x44, 0x38, 0x00, 0x82, 0x82, 0x82, 0xc2, 0xa2, 0x92, 0x8a, 0x86, 0x82, 0x82, 0x82, 0x00, 0x00, 0x00 },	// U+048A (Ҋ)
 	{ 0x00, 0x00, 0x00, 0x44, 0x44, 0x38, 0x00, 0x00, 0x82, 0xc2, 0xa2, 0x92, 0x8a, 0x86, 0x82, 0x00, 0x00, 0x00 },	// U+048B (ҋ)
 	{ 0x00, 0x00, 0x00, 0x00, 0x02, 0x1f, 0x02, 0x02, 0x02, 0x7e, 0x82, 0x82, 0x82, 0x82, 0x7e, 0x00, 0x00, 0x00 },	// U+048C (Ҍ)
@@ -799,9 +733,6 @@ static const unsigned char leggie_block23[][18] = {
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x80, 0xfe, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x00, 0x00, 0x00 },	// U+0491 (ґ)
 	{ 0x00, 0x00, 0x00, 0x00, 0xfe, 0x02, 0x02, 0x02, 0x02, 0x1f, 0x02, 0x02, 0x02, 0x02, 0x02, 0x00, 0x00, 0x00 },	// U+0492 (Ғ)
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfe, 0x02, 0x02, 0x1f, 0x02, 0x02, 0x02, 0x00, 0x00, 0x00 },	// U+0493 (ғ)
-}; // 10
-
-static const unsigned char leggie_block24[][18] = {
 	{ 0x00, 0x00, 0x00, 0x00, 0x11, 0x92, 0x92, 0x92, 0x92, 0x7c, 0x92, 0x92, 0x92, 0x92, 0x11, 0x00, 0x00, 0x00 },	// U+0496 (Җ)
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x92, 0x92, 0x7c, 0x92, 0x92, 0x11, 0x00, 0x00, 0x00 },	// U+0497 (җ)
 	{ 0x00, 0x00, 0x00, 0x00, 0x7e, 0x80, 0x80, 0x80, 0x80, 0x70, 0x80, 0x80, 0x80, 0x80, 0x7e, 0x10, 0x10, 0x00 },	// U+0498 (Ҙ)
@@ -810,46 +741,25 @@ static const unsigned char leggie_block24[][18] = {
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x44, 0x24, 0x14, 0x0c, 0x14, 0x24, 0x44, 0x40, 0x40, 0x00 },	// U+049B (қ)
 	{ 0x00, 0x00, 0x00, 0x00, 0x82, 0x42, 0x2a, 0x1a, 0x0a, 0x0e, 0x0a, 0x1a, 0x2a, 0x42, 0x82, 0x00, 0x00, 0x00 },	// U+049C (Ҝ)
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x42, 0x2a, 0x1a, 0x0e, 0x1a, 0x2a, 0x42, 0x00, 0x00, 0x00 },	// U+049D (ҝ)
-}; // 8
-
-static const unsigned char leggie_block25[][18] = {
 	{ 0x00, 0x00, 0x00, 0x00, 0x07, 0x84, 0x44, 0x24, 0x14, 0x0c, 0x14, 0x24, 0x44, 0x84, 0x04, 0x00, 0x00, 0x00 },	// U+04A0 (Ҡ)
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8e, 0x48, 0x28, 0x18, 0x28, 0x48, 0x88, 0x00, 0x00, 0x00 },	// U+04A1 (ҡ)
 	{ 0x00, 0x00, 0x00, 0x00, 0x82, 0x82, 0x82, 0x82, 0x82, 0xfe, 0x82, 0x82, 0x82, 0x82, 0x82, 0x00, 0x00, 0x00 },	// U+04A2 (Ң)
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x42, 0x42, 0x42, 0x7e, 0x42, 0x42, 0xc2, 0x80, 0x80, 0x00 },	// U+04A3 (ң)
-}; // 4
-
-static const unsigned char leggie_block26[][18] = {
 	{ 0x00, 0x00, 0x00, 0x00, 0xfc, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0xfc, 0x10, 0x10, 0x00 },	// U+04AA (Ҫ)
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfc, 0x02, 0x02, 0x02, 0x02, 0x02, 0xfc, 0x10, 0x10, 0x00 },	// U+04AB (ҫ)
-}; // 2
-
-static const unsigned char leggie_block27[][18] = {
 	{ 0x00, 0x00, 0x00, 0x00, 0x82, 0x82, 0x82, 0x44, 0x28, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x00, 0x00, 0x00 },	// U+04AE (Ү)
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x82, 0x82, 0x44, 0x44, 0x28, 0x28, 0x10, 0x10, 0x10, 0x10 },	// U+04AF (ү)
 	{ 0x00, 0x00, 0x00, 0x00, 0x82, 0x82, 0x82, 0x44, 0x28, 0x10, 0x7c, 0x10, 0x10, 0x10, 0x10, 0x00, 0x00, 0x00 },	// U+04B0 (Ұ)
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x82, 0x82, 0x44, 0x44, 0x28, 0x28, 0x10, 0x7c, 0x10, 0x10 },	// U+04B1 (ұ)
-}; // 4
-
-static const unsigned char leggie_block28[][18] = {
 	{ 0x00, 0x00, 0x00, 0x00, 0x02, 0x02, 0x02, 0x02, 0x02, 0x7e, 0x82, 0x82, 0x82, 0x82, 0x82, 0x00, 0x00, 0x00 },	// U+04BA (Һ)
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x02, 0x02, 0x7e, 0x82, 0x82, 0x82, 0x00, 0x00, 0x00 },	// U+04BB (һ)
-}; // 2
-
-static const unsigned char leggie_block29[][18] = {
 	{ 0x00, 0x00, 0x00, 0x00, 0x38, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x38, 0x00, 0x00, 0x00 },	// U+04C0 (Ӏ)
-}; // 1
-
-static const unsigned char leggie_block30[][18] = {
 	{ 0x00, 0x00, 0x00, 0x00, 0xf8, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x82, 0x00, 0x00, 0x00 },	// U+04C5 (Ӆ)
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf8, 0x84, 0x84, 0x84, 0x84, 0x84, 0x82, 0x00, 0x00, 0x00 },	// U+04C6 (ӆ)
 	{ 0x00, 0x00, 0x00, 0x00, 0x82, 0x82, 0x82, 0x82, 0x82, 0xfe, 0x82, 0x82, 0x82, 0x82, 0x82, 0x80, 0x60, 0x00 },	// U+04C7 (Ӈ)
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x82, 0x82, 0x82, 0xfe, 0x82, 0x82, 0x82, 0x80, 0x60, 0x00 },	// U+04C8 (ӈ)
 	{ 0x00, 0x00, 0x00, 0x00, 0x82, 0x82, 0x82, 0x82, 0x82, 0xfe, 0x82, 0x82, 0x82, 0x82, 0x82, 0x00, 0x00, 0x00 },	// U+04C9 (Ӊ)
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x82, 0x82, 0x82, 0xfe, 0x82, 0x82, 0x82, 0x00, 0x00, 0x00 },	// U+04CA (ӊ)
-}; // 6
-
-static const unsigned char leggie_block31[][18] = {
 	{ 0x00, 0x00, 0x00, 0x00, 0x82, 0xc6, 0xaa, 0x92, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x00, 0x00, 0x00 },	// U+04CD (Ӎ)
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x82, 0xc6, 0xaa, 0x92, 0x82, 0x82, 0x82, 0x00, 0x00, 0x00 },	// U+04CE (ӎ)
 	{ 0x00, 0x00, 0x00, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x70, 0x00, 0x00, 0x00 },	// U+04CF (ӏ)
@@ -863,21 +773,12 @@ static const unsigned char leggie_block31[][18] = {
 	{ 0x00, 0x00, 0x00, 0x44, 0x44, 0x38, 0x00, 0x00, 0x7c, 0x82, 0x82, 0xfe, 0x02, 0x02, 0x7c, 0x00, 0x00, 0x00 },	// U+04D7 (ӗ)
 	{ 0x00, 0x00, 0x00, 0x00, 0x7c, 0x80, 0x80, 0x80, 0x80, 0xfe, 0x82, 0x82, 0x82, 0x82, 0x7c, 0x00, 0x00, 0x00 },	// U+04D8 (Ә)
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7c, 0x80, 0x80, 0xfe, 0x82, 0x82, 0x7c, 0x00, 0x00, 0x00 },	// U+04D9 (ә)
-}; // 13
-
-static const unsigned char leggie_block32[][18] = {
 	{ 0x00, 0x7c, 0x00, 0x00, 0x82, 0x82, 0x82, 0xc2, 0xa2, 0x92, 0x8a, 0x86, 0x82, 0x82, 0x82, 0x00, 0x00, 0x00 },	// U+04E2 (Ӣ)
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x7c, 0x00, 0x00, 0x82, 0xc2, 0xa2, 0x92, 0x8a, 0x86, 0x82, 0x00, 0x00, 0x00 },	// U+04E3 (ӣ)
-}; // 2
-
-static const unsigned char leggie_block33[][18] = {
 	{ 0x00, 0x44, 0x00, 0x00, 0x7c, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x7c, 0x00, 0x00, 0x00 },	// U+04E6 (Ӧ)
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x44, 0x00, 0x00, 0x7c, 0x82, 0x82, 0x82, 0x82, 0x82, 0x7c, 0x00, 0x00, 0x00 },	// U+04E7 (ӧ)
 	{ 0x00, 0x00, 0x00, 0x00, 0x7c, 0x82, 0x82, 0x82, 0x82, 0xfe, 0x82, 0x82, 0x82, 0x82, 0x7c, 0x00, 0x00, 0x00 },	// U+04E8 (Ө)
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7c, 0x82, 0x82, 0xfe, 0x82, 0x82, 0x7c, 0x00, 0x00, 0x00 },	// U+04E9 (ө)
-}; // 4
-
-static const unsigned char leggie_block34[][18] = {
 	{ 0x00, 0x44, 0x00, 0x00, 0x7e, 0x80, 0x80, 0x80, 0x80, 0xf0, 0x80, 0x80, 0x80, 0x80, 0x7e, 0x00, 0x00, 0x00 },	// U+04EC (Ӭ)
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x44, 0x00, 0x00, 0x7e, 0x80, 0x80, 0xf0, 0x80, 0x80, 0x7e, 0x00, 0x00, 0x00 },	// U+04ED (ӭ)
 	{ 0x00, 0x7c, 0x00, 0x00, 0x82, 0x82, 0x82, 0x82, 0x82, 0xfc, 0x80, 0x80, 0x80, 0x80, 0x70, 0x00, 0x00, 0x00 },	// U+04EE (Ӯ)
@@ -886,14 +787,8 @@ static const unsigned char leggie_block34[][18] = {
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x44, 0x00, 0x00, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0xfc, 0x80, 0x80, 0x78 },	// U+04F1 (ӱ)
 	{ 0x90, 0x48, 0x24, 0x00, 0x82, 0x82, 0x82, 0x82, 0x82, 0xfc, 0x80, 0x80, 0x80, 0x80, 0x70, 0x00, 0x00, 0x00 },	// U+04F2 (Ӳ)
 	{ 0x00, 0x00, 0x00, 0x90, 0x48, 0x24, 0x00, 0x00, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0xfc, 0x80, 0x80, 0x78 },	// U+04F3 (ӳ)
-}; // 8
-
-static const unsigned char leggie_block35[][18] = {
 	{ 0x00, 0x44, 0x00, 0x00, 0x82, 0x82, 0x82, 0x82, 0x9e, 0xa2, 0xa2, 0xa2, 0xa2, 0xa2, 0x9e, 0x00, 0x00, 0x00 },	// U+04F8 (Ӹ)
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x44, 0x00, 0x00, 0x82, 0x82, 0x82, 0x9e, 0xa2, 0xa2, 0x9e, 0x00, 0x00, 0x00 },	// U+04F9 (ӹ)
-}; // 2
-
-static const unsigned char leggie_block36[][18] = {
 	{ 0x00, 0x00, 0x00, 0x00, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x92, 0xa2, 0x42, 0xbc, 0x00, 0x00, 0x00 },	// U+0531 (Ա)
 	{ 0x00, 0x00, 0x00, 0x00, 0xfc, 0x02, 0x02, 0x02, 0x02, 0x02, 0x3e, 0x02, 0x02, 0x02, 0x02, 0x00, 0x00, 0x00 },	// U+0532 (Բ)
 	{ 0x00, 0x00, 0x00, 0x00, 0x3c, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0xfc, 0x40, 0x40, 0x40, 0x00, 0x00, 0x00 },	// U+0533 (Գ)
@@ -932,9 +827,6 @@ static const unsigned char leggie_block36[][18] = {
 	{ 0x00, 0x00, 0x00, 0x00, 0x78, 0x84, 0x84, 0x84, 0x84, 0x7c, 0x04, 0x04, 0xfe, 0x04, 0x04, 0x00, 0x00, 0x00 },	// U+0554 (Ք)
 	{ 0x00, 0x00, 0x00, 0x00, 0x7c, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x7c, 0x00, 0x00, 0x00 },	// U+0555 (Օ)
 	{ 0x00, 0x00, 0x00, 0x00, 0x1c, 0x12, 0x12, 0x12, 0x12, 0x7c, 0x90, 0x90, 0x90, 0x90, 0x7e, 0x00, 0x00, 0x00 },	// U+0556 (Ֆ)
-}; // 38
-
-static const unsigned char leggie_block37[][18] = {
 	{ 0x00, 0x10, 0x08, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+0559 (ՙ)
 	{ 0x00, 0x00, 0x00, 0x00, 0x10, 0x10, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+055A (՚)
 	{ 0x40, 0x20, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+055B (՛)
@@ -942,9 +834,6 @@ static const unsigned char leggie_block37[][18] = {
 	{ 0x00, 0x00, 0x00, 0x00, 0x08, 0x10, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+055D (՝)
 	{ 0x00, 0x00, 0x00, 0x00, 0x38, 0x44, 0x34, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+055E (՞)
 	{ 0x00, 0x00, 0x00, 0x00, 0x04, 0x7c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+055F (՟)
-}; // 7
-
-static const unsigned char leggie_block38[][18] = {
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0xec, 0x00, 0x00, 0x00 },	// U+0561 (ա)
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7e, 0x82, 0x82, 0x02, 0x02, 0x02, 0xfe, 0x02, 0x02, 0x02 },	// U+0562 (բ)
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3c, 0x22, 0x22, 0x22, 0x22, 0x22, 0xfc, 0x20, 0x20, 0x20 },	// U+0563 (գ)
@@ -984,20 +873,11 @@ static const unsigned char leggie_block38[][18] = {
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7c, 0x82, 0x82, 0x82, 0x82, 0x82, 0x7c, 0x00, 0x00, 0x00 },	// U+0585 (օ)
 	{ 0x00, 0x00, 0x00, 0x00, 0x1c, 0x12, 0x12, 0x12, 0x12, 0x7c, 0x90, 0x90, 0x90, 0x90, 0x7e, 0x10, 0x10, 0x10 },	// U+0586 (ֆ)
 	{ 0x00, 0x00, 0x00, 0x00, 0x02, 0x02, 0x02, 0x02, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0xfc, 0x00, 0x00, 0x00 },	// U+0587 (և)
-}; // 39
-
-static const unsigned char leggie_block39[][18] = {
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00 },	// U+0589 (։)
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x82, 0x44, 0x38, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+058A (֊)
-}; // 2
-
-static const unsigned char leggie_block40[][18] = {
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfe, 0x09, 0x09, 0xf9, 0x29, 0x3f, 0x21, 0x21, 0xfe, 0x00, 0x00, 0x00 },	// U+058D (֍)
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfe, 0x21, 0x21, 0x3f, 0x29, 0xf9, 0x09, 0x09, 0xfe, 0x00, 0x00, 0x00 },	// U+058E (֎)
 	{ 0x00, 0x00, 0x00, 0x00, 0x1e, 0x20, 0x20, 0x20, 0x20, 0xf8, 0x20, 0x20, 0xf8, 0x20, 0x20, 0x00, 0x00, 0x00 },	// U+058F (֏)
-}; // 3
-
-static const unsigned char leggie_block41[][18] = {
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x82, 0x84, 0x88, 0x54, 0x22, 0x42, 0x82, 0x00, 0x00, 0x00 },	// U+05D0 (א)
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3e, 0x40, 0x40, 0x40, 0x40, 0x40, 0xfe, 0x00, 0x00, 0x00 },	// U+05D1 (ב)
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3e, 0x40, 0x40, 0x40, 0x40, 0x40, 0xbe, 0x00, 0x00, 0x00 },	// U+05D2 (ג)
@@ -1025,13 +905,7 @@ static const unsigned char leggie_block41[][18] = {
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7e, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x00, 0x00, 0x00 },	// U+05E8 (ר)
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x92, 0x92, 0x92, 0x92, 0x8e, 0x82, 0x7e, 0x00, 0x00, 0x00 },	// U+05E9 (ש)
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7e, 0x88, 0x88, 0x88, 0x88, 0x88, 0x86, 0x00, 0x00, 0x00 },	// U+05EA (ת)
-}; // 27
-
-static const unsigned char leggie_block42[][18] = {
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x80, 0x80, 0x7e, 0x82, 0x82, 0x92, 0x82, 0x82, 0x7c, 0x00, 0x00, 0x00 },	// U+0CA0 (ಠ)
-}; // 1
-
-static const unsigned char leggie_block43[][18] = {
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x60, 0x80, 0x80, 0x80, 0x80, 0x80, 0x7e, 0x00, 0x00, 0x00 },	// U+10D0 (ა)
 	{ 0x00, 0x00, 0x00, 0x1e, 0x10, 0x10, 0x10, 0x10, 0x6c, 0x82, 0x82, 0x82, 0x82, 0x82, 0x7c, 0x00, 0x00, 0x00 },	// U+10D1 (ბ)
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0c, 0x12, 0x10, 0x6c, 0x82, 0x82, 0x82, 0x82, 0x82, 0x7c },	// U+10D2 (გ)
@@ -1065,9 +939,6 @@ static const unsigned char leggie_block43[][18] = {
 	{ 0x00, 0x00, 0x00, 0x02, 0x22, 0x12, 0x0a, 0x06, 0x7e, 0x82, 0x82, 0x82, 0x82, 0x82, 0x7c, 0x00, 0x00, 0x00 },	// U+10EE (ხ)
 	{ 0x00, 0x00, 0x00, 0x10, 0x10, 0x10, 0x10, 0x10, 0xfe, 0x10, 0x10, 0x20, 0x40, 0x80, 0x80, 0x80, 0x80, 0x7e },	// U+10EF (ჯ)
 	{ 0x00, 0x00, 0x00, 0x02, 0x7c, 0x80, 0x80, 0x70, 0x80, 0x80, 0x70, 0x80, 0x80, 0x80, 0x7e, 0x00, 0x00, 0x00 },	// U+10F0 (ჰ)
-}; // 33
-
-static const unsigned char leggie_block44[][18] = {
 	{ 0x00, 0x00, 0x00, 0x10, 0x10, 0x10, 0x7c, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x7c, 0x10, 0x10, 0x10 },	// U+10F6 (ჶ)
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7e, 0x80, 0x80, 0x80, 0x7c, 0x02, 0x02, 0x02, 0x02, 0xfc },	// U+10F7 (ჷ)
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x82, 0x82, 0x82, 0x82, 0x82, 0x7e, 0x02, 0x02, 0x02, 0xfc },	// U+10F8 (ჸ)
@@ -1078,68 +949,32 @@ static const unsigned char leggie_block44[][18] = {
 	{ 0x00, 0x00, 0x00, 0x00, 0xfc, 0x02, 0x02, 0x02, 0x02, 0x7c, 0x80, 0x80, 0x80, 0x80, 0x7e, 0x00, 0x00, 0x00 },	// U+10FD (ჽ)
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xee, 0x10, 0x6c, 0x82, 0x82, 0x82, 0x7c, 0x00, 0x00, 0x00 },	// U+10FE (ჾ)
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7c, 0x82, 0x82, 0x82, 0x82, 0x82, 0x7c, 0x00, 0x00, 0x00 },	// U+10FF (ჿ)
-}; // 10
-
-static const unsigned char leggie_block45[][18] = {
 	{ 0x00, 0x10, 0x00, 0x00, 0x7e, 0x82, 0x82, 0x82, 0x82, 0x7e, 0x82, 0x82, 0x82, 0x82, 0x7e, 0x00, 0x00, 0x00 },	// U+1E02 (Ḃ)
 	{ 0x02, 0x00, 0x00, 0x02, 0x02, 0x02, 0x02, 0x02, 0x7e, 0x82, 0x82, 0x82, 0x82, 0x82, 0x7e, 0x00, 0x00, 0x00 },	// U+1E03 (ḃ)
-}; // 2
-
-static const unsigned char leggie_block46[][18] = {
 	{ 0x00, 0x10, 0x00, 0x00, 0x7e, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x7e, 0x00, 0x00, 0x00 },	// U+1E0A (Ḋ)
 	{ 0x80, 0x00, 0x00, 0x80, 0x80, 0x80, 0x80, 0x80, 0xfc, 0x82, 0x82, 0x82, 0x82, 0x82, 0xfc, 0x00, 0x00, 0x00 },	// U+1E0B (ḋ)
-}; // 2
-
-static const unsigned char leggie_block47[][18] = {
 	{ 0x00, 0x10, 0x00, 0x00, 0xfe, 0x02, 0x02, 0x02, 0x02, 0x1e, 0x02, 0x02, 0x02, 0x02, 0x02, 0x00, 0x00, 0x00 },	// U+1E1E (Ḟ)
 	{ 0x20, 0x00, 0x00, 0x70, 0x08, 0x08, 0x08, 0x08, 0x38, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x00, 0x00, 0x00 },	// U+1E1F (ḟ)
-}; // 2
-
-static const unsigned char leggie_block48[][18] = {
 	{ 0x00, 0x00, 0x00, 0x00, 0x82, 0x82, 0x82, 0x82, 0x82, 0xfe, 0x82, 0x82, 0x82, 0x82, 0x82, 0x00, 0x10, 0x00 },	// U+1E24 (Ḥ)
 	{ 0x00, 0x00, 0x00, 0x02, 0x02, 0x02, 0x02, 0x02, 0x7e, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x00, 0x10, 0x00 },	// U+1E25 (ḥ)
-}; // 2
-
-static const unsigned char leggie_block49[][18] = {
 	{ 0x00, 0x00, 0x00, 0x00, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0xfe, 0x00, 0x10, 0x00 },	// U+1E36 (Ḷ)
 	{ 0x00, 0x00, 0x00, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x70, 0x00, 0x10, 0x00 },	// U+1E37 (ḷ)
-}; // 2
-
-static const unsigned char leggie_block50[][18] = {
 	{ 0x00, 0x10, 0x00, 0x00, 0x82, 0xc6, 0xaa, 0x92, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x00, 0x00, 0x00 },	// U+1E40 (Ṁ)
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x6e, 0x92, 0x92, 0x92, 0x92, 0x92, 0x82, 0x00, 0x00, 0x00 },	// U+1E41 (ṁ)
-}; // 2
-
-static const unsigned char leggie_block51[][18] = {
 	{ 0x00, 0x10, 0x00, 0x00, 0x7e, 0x82, 0x82, 0x82, 0x82, 0x82, 0x7e, 0x02, 0x02, 0x02, 0x02, 0x00, 0x00, 0x00 },	// U+1E56 (Ṗ)
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x7e, 0x82, 0x82, 0x82, 0x82, 0x82, 0x7e, 0x02, 0x02, 0x02 },	// U+1E57 (ṗ)
-}; // 2
-
-static const unsigned char leggie_block52[][18] = {
 	{ 0x00, 0x10, 0x00, 0x00, 0xfc, 0x02, 0x02, 0x02, 0x02, 0x7c, 0x80, 0x80, 0x80, 0x80, 0x7e, 0x00, 0x00, 0x00 },	// U+1E60 (Ṡ)
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0xfc, 0x02, 0x02, 0x7c, 0x80, 0x80, 0x7e, 0x00, 0x00, 0x00 },	// U+1E61 (ṡ)
-}; // 2
-
-static const unsigned char leggie_block53[][18] = {
 	{ 0x00, 0x10, 0x00, 0x00, 0xfe, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x00, 0x00, 0x00 },	// U+1E6A (Ṫ)
 	{ 0x08, 0x00, 0x00, 0x08, 0x08, 0x08, 0x08, 0x08, 0x3c, 0x08, 0x08, 0x08, 0x08, 0x08, 0x70, 0x00, 0x00, 0x00 },	// U+1E6B (ṫ)
-}; // 2
-
-static const unsigned char leggie_block54[][18] = {
 	{ 0x04, 0x08, 0x10, 0x00, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x92, 0xaa, 0xc6, 0x82, 0x00, 0x00, 0x00 },	// U+1E80 (Ẁ)
 	{ 0x00, 0x00, 0x00, 0x04, 0x08, 0x10, 0x00, 0x00, 0x82, 0x82, 0x82, 0x92, 0xaa, 0xc6, 0x82, 0x00, 0x00, 0x00 },	// U+1E81 (ẁ)
 	{ 0x40, 0x20, 0x10, 0x00, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x92, 0xaa, 0xc6, 0x82, 0x00, 0x00, 0x00 },	// U+1E82 (Ẃ)
 	{ 0x00, 0x00, 0x00, 0x40, 0x20, 0x10, 0x00, 0x00, 0x82, 0x82, 0x82, 0x92, 0xaa, 0xc6, 0x82, 0x00, 0x00, 0x00 },	// U+1E83 (ẃ)
 	{ 0x00, 0x44, 0x00, 0x00, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x92, 0xaa, 0xc6, 0x82, 0x00, 0x00, 0x00 },	// U+1E84 (Ẅ)
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x44, 0x00, 0x00, 0x82, 0x82, 0x82, 0x92, 0xaa, 0xc6, 0x82, 0x00, 0x00, 0x00 },	// U+1E85 (ẅ)
-}; // 6
-
-static const unsigned char leggie_block55[][18] = {
 	{ 0x00, 0x10, 0x00, 0x00, 0x82, 0x82, 0x82, 0x44, 0x28, 0x10, 0x28, 0x44, 0x82, 0x82, 0x82, 0x00, 0x00, 0x00 },	// U+1E8A (Ẋ)
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x82, 0x44, 0x28, 0x10, 0x28, 0x44, 0x82, 0x00, 0x00, 0x00 },	// U+1E8B (ẋ)
-}; // 2
-
-static const unsigned char leggie_block56[][18] = {
 	{ 0x00, 0x00, 0x00, 0x00, 0x7c, 0x82, 0x82, 0x82, 0x82, 0x82, 0xfe, 0x82, 0x82, 0x82, 0x82, 0x00, 0x10, 0x00 },	// U+1EA0 (Ạ)
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7c, 0x80, 0x80, 0xfc, 0x82, 0x82, 0xfc, 0x00, 0x10, 0x00 },	// U+1EA1 (ạ)
 	{ 0x18, 0x20, 0x10, 0x00, 0x7c, 0x82, 0x82, 0x82, 0x82, 0x82, 0xfe, 0x82, 0x82, 0x82, 0x82, 0x00, 0x00, 0x00 },	// U+1EA2 (Ả)
@@ -1230,9 +1065,6 @@ static const unsigned char leggie_block56[][18] = {
 	{ 0x00, 0x00, 0x00, 0x18, 0x20, 0x10, 0x00, 0x00, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0xfc, 0x80, 0x80, 0x78 },	// U+1EF7 (ỷ)
 	{ 0x0c, 0x92, 0x60, 0x00, 0x82, 0x82, 0x82, 0x44, 0x28, 0x10, 0x10, 0x10, 0x10, 0x10, 0x00, 0x00, 0x00, 0x00 },	// U+1EF8 (Ỹ)
 	{ 0x00, 0x00, 0x00, 0x0c, 0x92, 0x60, 0x00, 0x00, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0xfc, 0x80, 0x80, 0x78 },	// U+1EF9 (ỹ)
-}; // 90
-
-static const unsigned char leggie_block57[][18] = {
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x38, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+2010 (‐)
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x38, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+2011 (‑)
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+2012 (‒)
@@ -1257,9 +1089,6 @@ static const unsigned char leggie_block57[][18] = {
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x28, 0x00, 0x00, 0x00 },	// U+2025 (‥)
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x54, 0x00, 0x00, 0x00 },	// U+2026 (…)
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+2027 (‧)
-}; // 24
-
-static const unsigned char leggie_block58[][18] = {
 	{ 0x00, 0x00, 0x00, 0x00, 0x06, 0x09, 0x49, 0x26, 0x10, 0x08, 0x04, 0xda, 0x25, 0x24, 0xd8, 0x00, 0x00, 0x00 },	// U+2030 (‰)
 	{ 0x00, 0x00, 0x00, 0x00, 0x06, 0x09, 0x49, 0x26, 0x10, 0x08, 0x04, 0xaa, 0x55, 0x54, 0xa8, 0x00, 0x00, 0x00 },	// U+2031 (‱)
 	{ 0x00, 0x00, 0x00, 0x00, 0x20, 0x10, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+2032 (′)
@@ -1271,9 +1100,6 @@ static const unsigned char leggie_block58[][18] = {
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x28, 0x44 },	// U+2038 (‸)
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x20, 0x10, 0x08, 0x04, 0x08, 0x10, 0x20, 0x40, 0x00, 0x00, 0x00, 0x00 },	// U+2039 (‹)
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x08, 0x10, 0x20, 0x40, 0x20, 0x10, 0x08, 0x04, 0x00, 0x00, 0x00, 0x00 },	// U+203A (›)
-}; // 11
-
-static const unsigned char leggie_block59[][18] = {
 	{ 0x00, 0x00, 0x00, 0x00, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x00, 0x00, 0x44, 0x00, 0x00, 0x00 },	// U+203C (‼)
 	{ 0x00, 0x00, 0x00, 0x00, 0x7e, 0x90, 0x90, 0x90, 0x50, 0x30, 0x10, 0x10, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00 },	// U+203D (‽)
 	{ 0x00, 0x00, 0xfe, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+203E (‾)
@@ -1309,21 +1135,12 @@ static const unsigned char leggie_block59[][18] = {
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x54, 0x10, 0xfe, 0x10, 0x54, 0x10, 0x00, 0x00, 0x00 },	// U+205C (⁜)
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x10, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00 },	// U+205D (⁝)
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x10, 0x00, 0x10, 0x00, 0x10, 0x00, 0x00, 0x00 },	// U+205E (⁞)
-}; // 35
-
-static const unsigned char leggie_block60[][18] = {
 	{ 0x00, 0x00, 0x00, 0x00, 0x0e, 0x01, 0xa1, 0x11, 0x17, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0xa0, 0x00, 0x00 },	// U+2061 (⁡)
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x44, 0x28, 0x10, 0x28, 0x44, 0x00, 0x00, 0x00, 0x00 },	// U+2062 (⁢)
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x10, 0x08, 0x00 },	// U+2063 (⁣)
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x10, 0x7c, 0x10, 0x10, 0x00, 0x00, 0x00, 0x00 },	// U+2064 (⁤)
-}; // 4
-
-static const unsigned char leggie_block61[][18] = {
 	{ 0x7c, 0x82, 0x82, 0xc2, 0xa2, 0x92, 0x8a, 0x86, 0x82, 0x82, 0x7c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+2070 (⁰)
 	{ 0x00, 0x10, 0x00, 0x00, 0x18, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+2071 (ⁱ)
-}; // 2
-
-static const unsigned char leggie_block62[][18] = {
 	{ 0x80, 0xc0, 0xa0, 0x90, 0x88, 0x84, 0xfe, 0x80, 0x80, 0x80, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+2074 (⁴)
 	{ 0xfe, 0x02, 0x02, 0x02, 0x7e, 0x80, 0x80, 0x80, 0x80, 0x80, 0x7e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+2075 (⁵)
 	{ 0x7c, 0x02, 0x02, 0x02, 0x7e, 0x82, 0x82, 0x82, 0x82, 0x82, 0x7c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+2076 (⁶)
@@ -1351,9 +1168,6 @@ static const unsigned char leggie_block62[][18] = {
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfe, 0x00, 0x00, 0x00, 0xfe, 0x00, 0x00, 0x00, 0x00 },	// U+208C (₌)
 	{ 0x00, 0x00, 0x00, 0x00, 0x20, 0x10, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x10, 0x20 },	// U+208D (₍)
 	{ 0x00, 0x00, 0x00, 0x00, 0x08, 0x10, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x10, 0x08 },	// U+208E (₎)
-}; // 27
-
-static const unsigned char leggie_block63[][18] = {
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7c, 0x80, 0x80, 0xfc, 0x82, 0x82, 0xfc, 0x00 },	// U+2090 (ₐ)
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7c, 0x82, 0x82, 0xfe, 0x02, 0x02, 0x7c, 0x00 },	// U+2091 (ₑ)
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7c, 0x82, 0x82, 0x82, 0x82, 0x82, 0x7c, 0x00 },	// U+2092 (ₒ)
@@ -1367,13 +1181,7 @@ static const unsigned char leggie_block63[][18] = {
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7e, 0x82, 0x82, 0x82, 0x82, 0x7e, 0x02, 0x02 },	// U+209A (ₚ)
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfc, 0x02, 0x02, 0x7c, 0x80, 0x80, 0x7e, 0x00 },	// U+209B (ₛ)
 	{ 0x00, 0x00, 0x00, 0x08, 0x08, 0x08, 0x08, 0x08, 0x3c, 0x08, 0x08, 0x08, 0x08, 0x08, 0x70, 0x00, 0x00, 0x00 },	// U+209C (ₜ)
-}; // 13
-
-static const unsigned char leggie_block64[][18] = {
 	{ 0x00, 0x00, 0x50, 0x50, 0xfc, 0x52, 0x52, 0x52, 0x52, 0x4a, 0x2a, 0x2a, 0x2a, 0x2a, 0xfc, 0x28, 0x28, 0x00 },	// U+20A1 (₡)
-}; // 1
-
-static const unsigned char leggie_block65[][18] = {
 	{ 0x00, 0x00, 0x00, 0x00, 0x40, 0x40, 0x40, 0x20, 0x6e, 0xb2, 0x92, 0x92, 0x9a, 0x9a, 0x8a, 0x04, 0x04, 0x04 },	// U+20A5 (₥)
 	{ 0x00, 0x00, 0x00, 0x00, 0x82, 0x82, 0x82, 0xff, 0x8a, 0x92, 0xa2, 0xff, 0x82, 0x82, 0x82, 0x00, 0x00, 0x00 },	// U+20A6 (₦)
 	{ 0x00, 0x00, 0x00, 0x40, 0x4f, 0x51, 0x51, 0x51, 0xf1, 0x51, 0x4f, 0x41, 0x41, 0x41, 0x81, 0x00, 0x00, 0x00 },	// U+20A7 (₧)
@@ -1385,42 +1193,18 @@ static const unsigned char leggie_block65[][18] = {
 	{ 0x00, 0x00, 0x00, 0x00, 0x82, 0x42, 0x22, 0x12, 0x0a, 0x7f, 0x0a, 0x12, 0x22, 0x42, 0x82, 0x00, 0x00, 0x00 },	// U+20AD (₭)
 	{ 0x00, 0x00, 0x00, 0x00, 0xfe, 0x10, 0x10, 0x70, 0x1c, 0x10, 0x70, 0x1c, 0x10, 0x10, 0x10, 0x00, 0x00, 0x00 },	// U+20AE (₮)
 	{ 0x00, 0x00, 0x00, 0x00, 0x0f, 0x11, 0x11, 0x11, 0xf1, 0x31, 0x31, 0x31, 0x31, 0x31, 0xef, 0x20, 0x20, 0x20 },	// U+20AF (₯)
-}; // 11
-
-static const unsigned char leggie_block66[][18] = {
 	{ 0x00, 0x00, 0x00, 0x00, 0x7e, 0x82, 0x82, 0xff, 0x82, 0x82, 0x7e, 0x02, 0x02, 0x02, 0x02, 0x00, 0x00, 0x00 },	// U+20B1 (₱)
 	{ 0x00, 0x00, 0x10, 0x10, 0xfc, 0x12, 0x12, 0x12, 0x12, 0xf2, 0x92, 0x92, 0x92, 0x92, 0xfc, 0x10, 0x10, 0x00 },	// U+20B2 (₲)
-}; // 2
-
-static const unsigned char leggie_block67[][18] = {
 	{ 0x00, 0x00, 0x00, 0x00, 0x7e, 0x80, 0x80, 0xff, 0x80, 0x7c, 0x02, 0xff, 0x02, 0x02, 0xfc, 0x00, 0x00, 0x00 },	// U+20B4 (₴)
 	{ 0x00, 0x00, 0x10, 0x10, 0xfc, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0xfc, 0x10, 0x10, 0x00 },	// U+20B5 (₵)
-}; // 2
-
-static const unsigned char leggie_block68[][18] = {
 	{ 0x00, 0x00, 0x00, 0x00, 0xfe, 0x00, 0xfe, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x00, 0x00, 0x00 },	// U+20B8 (₸)
 	{ 0x00, 0x00, 0x00, 0x00, 0xfe, 0x20, 0x20, 0xfe, 0x10, 0x08, 0x04, 0x08, 0x10, 0x20, 0x40, 0x00, 0x00, 0x00 },	// U+20B9 (₹)
 	{ 0x00, 0x00, 0x00, 0x00, 0x04, 0x04, 0x04, 0x1c, 0x06, 0x04, 0x1c, 0x06, 0x04, 0x84, 0x7c, 0x00, 0x00, 0x00 },	// U+20BA (₺)
-}; // 3
-
-static const unsigned char leggie_block69[][18] = {
 	{ 0x00, 0x00, 0x00, 0x00, 0x10, 0x7c, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x82, 0x00, 0x00, 0x00 },	// U+20BC (₼)
 	{ 0x00, 0x00, 0x00, 0x00, 0x7e, 0x82, 0x82, 0x82, 0x82, 0x82, 0x7e, 0x02, 0x3f, 0x02, 0x02, 0x00, 0x00, 0x00 },	// U+20BD (₽)
-}; // 2
-
-static const unsigned char leggie_block70[][18] = {
 	{ 0x00, 0x00, 0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0xd3, 0x35, 0x39, 0xd1, 0x11, 0xf1, 0x11, 0x00, 0x00, 0x00 },	// U+2116 (№)
-}; // 1
-
-static const unsigned char leggie_block71[][18] = {
 	{ 0x00, 0x00, 0x00, 0x1f, 0xb4, 0x54, 0x14, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+2122 (™)
-}; // 1
-
-static const unsigned char leggie_block72[][18] = {
 	{ 0x10, 0x28, 0x10, 0x00, 0x7c, 0x82, 0x82, 0x82, 0x82, 0x82, 0xfe, 0x82, 0x82, 0x82, 0x82, 0x00, 0x00, 0x00 },	// U+212B (Å)
-}; // 1
-
-static const unsigned char leggie_block73[][18] = {
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x04, 0x02, 0xff, 0x02, 0x04, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+2190 (←)
 	{ 0x00, 0x00, 0x00, 0x00, 0x10, 0x38, 0x54, 0x92, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x00, 0x00, 0x00 },	// U+2191 (↑)
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x40, 0x80, 0xff, 0x80, 0x40, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+2192 (→)
@@ -1428,191 +1212,74 @@ static const unsigned char leggie_block73[][18] = {
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x28, 0x44, 0x82, 0xff, 0x82, 0x44, 0x28, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+2194 (↔)
 	{ 0x00, 0x00, 0x00, 0x00, 0x10, 0x38, 0x54, 0x92, 0x10, 0x10, 0x10, 0x92, 0x54, 0x38, 0x10, 0x00, 0x00, 0x00 },	// U+2195 (↕)
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1f, 0x03, 0x05, 0x09, 0x11, 0x20, 0x40, 0x80, 0x00, 0x00, 0x00, 0x00 },	// U+2196 (↖)
-}; // 7
-
-static const unsigned char leggie_block74[][18] = {
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x02, 0x04, 0x08, 0x10, 0x20, 0x40, 0x80, 0xf0, 0x00, 0x00, 0x00 },	// U+2198 (↘)
-}; // 1
-
-static const unsigned char leggie_block75[][18] = {
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x04, 0x02, 0xff, 0x02, 0x04, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+21A4 (↤)
-}; // 1
-
-static const unsigned char leggie_block76[][18] = {
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x21, 0x41, 0x81, 0xff, 0x81, 0x41, 0x21, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+21A6 (↦)
-}; // 1
-
-static const unsigned char leggie_block77[][18] = {
 	{ 0x00, 0x00, 0x00, 0x00, 0x10, 0x38, 0x54, 0x92, 0x10, 0x10, 0x10, 0x92, 0x54, 0x38, 0x10, 0xfe, 0x00, 0x00 },	// U+21A8 (↨)
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x84, 0x02, 0xff, 0x02, 0x04, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+21A9 (↩)
-}; // 2
-
-static const unsigned char leggie_block78[][18] = {
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x04, 0x02, 0xff, 0x02, 0x04, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+21B5 (↵)
-}; // 1
-
-static const unsigned char leggie_block79[][18] = {
 	{ 0x00, 0x00, 0x00, 0x00, 0x3f, 0x00, 0x1f, 0x03, 0x05, 0x09, 0x11, 0x20, 0x40, 0x80, 0x00, 0x00, 0x00, 0x00 },	// U+21B8 (↸)
 	{ 0x00, 0x00, 0x00, 0x00, 0x11, 0x09, 0x05, 0xff, 0x25, 0x49, 0x90, 0xff, 0x80, 0x40, 0x20, 0x00, 0x00, 0x00 },	// U+21B9 (↹)
-}; // 2
-
-static const unsigned char leggie_block80[][18] = {
 	{ 0x00, 0x00, 0x00, 0x00, 0x08, 0x04, 0x02, 0xff, 0x22, 0x44, 0x88, 0xff, 0x80, 0x40, 0x20, 0x00, 0x00, 0x00 },	// U+21C6 (⇆)
-}; // 1
-
-static const unsigned char leggie_block81[][18] = {
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x04, 0xfe, 0x01, 0xfe, 0x04, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+21D0 (⇐)
 	{ 0x00, 0x00, 0x00, 0x00, 0x10, 0x28, 0x6c, 0xaa, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x00, 0x00, 0x00 },	// U+21D1 (⇑)
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x40, 0xff, 0x00, 0xff, 0x40, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+21D2 (⇒)
 	{ 0x00, 0x00, 0x00, 0x00, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0xaa, 0x6c, 0x28, 0x10, 0x00, 0x00, 0x00 },	// U+21D3 (⇓)
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x28, 0x44, 0xfe, 0x01, 0xfe, 0x44, 0x28, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+21D4 (⇔)
 	{ 0x00, 0x00, 0x00, 0x00, 0x10, 0x28, 0x6c, 0xaa, 0x28, 0x28, 0x28, 0xaa, 0x6c, 0x28, 0x10, 0x00, 0x00, 0x00 },	// U+21D5 (⇕)
-}; // 6
-
-static const unsigned char leggie_block82[][18] = {
 	{ 0x00, 0x00, 0x00, 0x00, 0x10, 0x38, 0x54, 0x92, 0x10, 0x10, 0x10, 0x7c, 0x10, 0x7c, 0x10, 0x00, 0x00, 0x00 },	// U+21DE (⇞)
 	{ 0x00, 0x00, 0x00, 0x00, 0x10, 0x7c, 0x10, 0x7c, 0x10, 0x10, 0x10, 0x92, 0x54, 0x38, 0x10, 0x00, 0x00, 0x00 },	// U+21DF (⇟)
-}; // 2
-
-static const unsigned char leggie_block83[][18] = {
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x09, 0x05, 0xff, 0x05, 0x09, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+21E4 (⇤)
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x20, 0x40, 0xff, 0x40, 0x20, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+21E5 (⇥)
-}; // 2
-
-static const unsigned char leggie_block84[][18] = {
 	{ 0x00, 0x00, 0x00, 0x00, 0x10, 0x28, 0x44, 0x82, 0xee, 0x28, 0x28, 0x28, 0x28, 0x28, 0x38, 0x00, 0x00, 0x00 },	// U+21E7 (⇧)
-}; // 1
-
-static const unsigned char leggie_block85[][18] = {
 	{ 0x00, 0x00, 0x00, 0x00, 0x10, 0x28, 0x44, 0x82, 0xee, 0x28, 0x28, 0x28, 0x7c, 0x44, 0x7c, 0x00, 0x00, 0x00 },	// U+21EA (⇪)
-}; // 1
-
-static const unsigned char leggie_block86[][18] = {
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3f, 0x01, 0x3d, 0x0d, 0x15, 0x25, 0x40, 0x80, 0x00, 0x00, 0x00, 0x00 },	// U+21F1 (⇱)
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x02, 0x04, 0x48, 0x50, 0x60, 0x78, 0x00, 0xf8, 0x00, 0x00, 0x00 },	// U+21F2 (⇲)
-}; // 2
-
-static const unsigned char leggie_block87[][18] = {
 	{ 0x00, 0x00, 0x00, 0x00, 0xfe, 0x80, 0x80, 0x80, 0x80, 0xf0, 0x80, 0x80, 0x80, 0x80, 0xfe, 0x00, 0x00, 0x00 },	// U+2203 (∃)
-}; // 1
-
-static const unsigned char leggie_block88[][18] = {
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7c, 0x82, 0x41, 0x21, 0x11, 0x09, 0x05, 0x82, 0x7d, 0x00, 0x00, 0x00 },	// U+2205 (∅)
-}; // 1
-
-static const unsigned char leggie_block89[][18] = {
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfc, 0x02, 0x02, 0xfe, 0x02, 0x02, 0xfc, 0x00, 0x00, 0x00 },	// U+2208 (∈)
-}; // 1
-
-static const unsigned char leggie_block90[][18] = {
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x38, 0x38, 0x38, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+2219 (∙)
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x80, 0x40, 0x40, 0x20, 0x21, 0x12, 0x14, 0x08, 0x00, 0x00, 0x00 },	// U+221A (√)
-}; // 2
-
-static const unsigned char leggie_block91[][18] = {
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xee, 0x11, 0x11, 0x11, 0x11, 0x11, 0xee, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+221E (∞)
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xff, 0x00, 0x00, 0x00 },	// U+221F (∟)
-}; // 2
-
-static const unsigned char leggie_block92[][18] = {
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x10, 0x28, 0x28, 0x44, 0x44, 0x82, 0x82, 0x00, 0x00, 0x00 },	// U+2227 (∧)
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x82, 0x82, 0x44, 0x44, 0x28, 0x28, 0x10, 0x10, 0x00, 0x00, 0x00 },	// U+2228 (∨)
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7c, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x00, 0x00, 0x00 },	// U+2229 (∩)
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x7c, 0x00, 0x00, 0x00 },	// U+222A (∪)
-}; // 4
-
-static const unsigned char leggie_block93[][18] = {
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0c, 0x92, 0x60, 0x00, 0x0c, 0x92, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+2248 (≈)
-}; // 1
-
-static const unsigned char leggie_block94[][18] = {
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0xfe, 0x20, 0x10, 0x08, 0xfe, 0x02, 0x01, 0x00, 0x00, 0x00, 0x00 },	// U+2260 (≠)
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfe, 0x00, 0xfe, 0x00, 0xfe, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+2261 (≡)
-}; // 2
-
-static const unsigned char leggie_block95[][18] = {
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x60, 0x18, 0x06, 0x18, 0x60, 0x80, 0x00, 0xfe, 0x00, 0x00, 0x00, 0x00 },	// U+2264 (≤)
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x0c, 0x30, 0xc0, 0x30, 0x0c, 0x02, 0x00, 0xfe, 0x00, 0x00, 0x00, 0x00 },	// U+2265 (≥)
-}; // 2
-
-static const unsigned char leggie_block96[][18] = {
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0xfe, 0x01, 0x01, 0x01, 0x7d, 0x01, 0x01, 0x01, 0xfe, 0x00, 0x00, 0x00, 0x00 },	// U+2296 (⊖)
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0xfe, 0x01, 0x45, 0x29, 0x11, 0x29, 0x45, 0x01, 0xfe, 0x00, 0x00, 0x00, 0x00 },	// U+2297 (⊗)
-}; // 2
-
-static const unsigned char leggie_block97[][18] = {
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfe, 0x01, 0x01, 0x01, 0x7d, 0x01, 0x01, 0x01, 0xfe, 0x00, 0x00 },	// U+229D (⊝)
-}; // 1
-
-static const unsigned char leggie_block98[][18] = {
 	{ 0x00, 0x00, 0x00, 0x00, 0x10, 0x28, 0x44, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0xfe, 0x00, 0x00, 0x00 },	// U+2302 (⌂)
 	{ 0x00, 0x00, 0x00, 0x00, 0x10, 0x28, 0x44, 0x82, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+2303 (⌃)
-}; // 2
-
-static const unsigned char leggie_block99[][18] = {
 	{ 0x00, 0x00, 0x00, 0xfe, 0x00, 0x10, 0x28, 0x44, 0x82, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+2305 (⌅)
-}; // 1
-
-static const unsigned char leggie_block100[][18] = {
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfe, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+2310 (⌐)
-}; // 1
-
-static const unsigned char leggie_block101[][18] = {
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x82, 0x45, 0xfe, 0x44, 0x44, 0x44, 0xfe, 0x45, 0x82, 0x00, 0x00, 0x00 },	// U+2318 (⌘)
-}; // 1
-
-static const unsigned char leggie_block102[][18] = {
 	{ 0x00, 0xe0, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10 },	// U+2320 (⌠)
 	{ 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x0e, 0x00 },	// U+2321 (⌡)
-}; // 2
-
-static const unsigned char leggie_block103[][18] = {
 	{ 0x00, 0x00, 0x00, 0xee, 0x00, 0x10, 0x28, 0x44, 0x82, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+2324 (⌤)
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc7, 0x08, 0x10, 0x20, 0xc0, 0x00, 0x00, 0x00, 0x00 },	// U+2325 (⌥)
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3f, 0x5d, 0xeb, 0xf7, 0xeb, 0x5d, 0x3f, 0x00, 0x00, 0x00 },	// U+2326 (⌦)
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x01, 0x45, 0x29, 0x11, 0x29, 0x45, 0x01, 0xff, 0x00, 0x00, 0x00 },	// U+2327 (⌧)
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xaa, 0x00, 0x55, 0x00, 0xaa, 0x00, 0x7c, 0x00, 0x00, 0x00 },	// U+2328 (⌨)
-}; // 5
-
-static const unsigned char leggie_block104[][18] = {
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf8, 0x74, 0xae, 0xdf, 0xae, 0x74, 0xf8, 0x00, 0x00, 0x00 },	// U+232B (⌫)
-}; // 1
-
-static const unsigned char leggie_block105[][18] = {
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x10, 0x10, 0x7c, 0x92, 0x92, 0x92, 0x92, 0x92, 0x7c, 0x10, 0x10, 0x10 },	// U+233D (⌽)
-}; // 1
-
-static const unsigned char leggie_block106[][18] = {
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3c, 0x40, 0x40, 0x7c, 0x42, 0x42, 0x7c, 0x00, 0x82, 0x44, 0x28, 0x10 },	// U+2380 (⎀)
-}; // 1
-
-static const unsigned char leggie_block107[][18] = {
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xef, 0x13, 0x13, 0x13, 0x13, 0x13, 0xef, 0x00, 0x00, 0x00 },	// U+2384 (⎄)
-}; // 1
-
-static const unsigned char leggie_block108[][18] = {
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x04, 0x02, 0xff, 0x02, 0x04, 0x08, 0x00, 0x00, 0x00 },	// U+2386 (⎆)
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc0, 0x20, 0x10, 0x08, 0xc7, 0x00, 0x00, 0x00, 0x00 },	// U+2387 (⎇)
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x92, 0x7c, 0xba, 0x92, 0xba, 0x7c, 0x92, 0x10, 0x00, 0x00 },	// U+2388 (⎈)
-}; // 3
-
-static const unsigned char leggie_block109[][18] = {
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0f, 0x63, 0x85, 0x89, 0x90, 0xa2, 0x82, 0x7c, 0x00, 0x00, 0x00 },	// U+238B (⎋)
-}; // 1
-
-static const unsigned char leggie_block110[][18] = {
 	{ 0x00, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+23BA (⎺)
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+23BB (⎻)
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0x00 },	// U+23BC (⎼)
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff },	// U+23BD (⎽)
-}; // 4
-
-static const unsigned char leggie_block111[][18] = {
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc0, 0x40, 0x40, 0x58, 0x54, 0x72, 0x01, 0xf2, 0x14, 0x18, 0x00, 0x00 },	// U+23CE (⏎)
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x38, 0x7c, 0xfe, 0xfe, 0x00, 0xfe, 0x00, 0x00, 0x00 },	// U+23CF (⏏)
-}; // 2
-
-static const unsigned char leggie_block112[][18] = {
 	{ 0x09, 0x09, 0x0b, 0x0d, 0x09, 0x09, 0x24, 0x24, 0x24, 0x24, 0x24, 0x18, 0x20, 0x20, 0x20, 0x20, 0x20, 0xe0 },	// U+2400 (␀)
 	{ 0x0e, 0x01, 0x06, 0x08, 0x08, 0x07, 0x18, 0x24, 0x24, 0x24, 0x24, 0x18, 0x20, 0x20, 0x20, 0xe0, 0x20, 0x20 },	// U+2401 (␁)
 	{ 0x0e, 0x01, 0x06, 0x08, 0x08, 0x07, 0x7c, 0x10, 0x10, 0x10, 0x10, 0x10, 0x20, 0x20, 0x20, 0xe0, 0x20, 0x20 },	// U+2402 (␂)
@@ -1652,53 +1319,17 @@ static const unsigned char leggie_block112[][18] = {
 	{ 0x00, 0x00, 0x12, 0x12, 0x16, 0x1a, 0x12, 0x12, 0x00, 0x00, 0x10, 0x10, 0x10, 0x10, 0x10, 0xf0, 0x00, 0x00 },	// U+2424 (␤)
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x84, 0x42, 0x20, 0x10, 0x08, 0x84, 0x42, 0x20, 0x00, 0x00, 0x00 },	// U+2425 (␥)
 	{ 0x00, 0x00, 0x00, 0x00, 0xfc, 0x02, 0x02, 0x02, 0x04, 0x08, 0x10, 0x10, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00 },	// U+2426 (␦)
-}; // 39
-
-static const unsigned char leggie_block113[][18] = {
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+2500 (─)
-}; // 1
-
-static const unsigned char leggie_block114[][18] = {
 	{ 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10 },	// U+2502 (│)
-}; // 1
-
-static const unsigned char leggie_block115[][18] = {
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe0, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10 },	// U+250C (┌)
-}; // 1
-
-static const unsigned char leggie_block116[][18] = {
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0f, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10 },	// U+2510 (┐)
-}; // 1
-
-static const unsigned char leggie_block117[][18] = {
 	{ 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0xe0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+2514 (└)
-}; // 1
-
-static const unsigned char leggie_block118[][18] = {
 	{ 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+2518 (┘)
-}; // 1
-
-static const unsigned char leggie_block119[][18] = {
 	{ 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0xf0, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10 },	// U+251C (├)
-}; // 1
-
-static const unsigned char leggie_block120[][18] = {
 	{ 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x1f, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10 },	// U+2524 (┤)
-}; // 1
-
-static const unsigned char leggie_block121[][18] = {
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10 },	// U+252C (┬)
-}; // 1
-
-static const unsigned char leggie_block122[][18] = {
 	{ 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+2534 (┴)
-}; // 1
-
-static const unsigned char leggie_block123[][18] = {
 	{ 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0xff, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10 },	// U+253C (┼)
-}; // 1
-
-static const unsigned char leggie_block124[][18] = {
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x00, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+2550 (═)
 	{ 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28 },	// U+2551 (║)
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe0, 0x00, 0xe0, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10 },	// U+2552 (╒)
@@ -1728,155 +1359,56 @@ static const unsigned char leggie_block124[][18] = {
 	{ 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0xff, 0x00, 0xff, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10 },	// U+256A (╪)
 	{ 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0xef, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28 },	// U+256B (╫)
 	{ 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0xc7, 0x10, 0xc7, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28 },	// U+256C (╬)
-}; // 29
-
-static const unsigned char leggie_block125[][18] = {
 	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+2580 (▀)
-}; // 1
-
-static const unsigned char leggie_block126[][18] = {
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },	// U+2584 (▄)
-}; // 1
-
-static const unsigned char leggie_block127[][18] = {
 	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },	// U+2588 (█)
-}; // 1
-
-static const unsigned char leggie_block128[][18] = {
 	{ 0x1f, 0x1f, 0x1f, 0x1f, 0x1f, 0x1f, 0x1f, 0x1f, 0x1f, 0x1f, 0x1f, 0x1f, 0x1f, 0x1f, 0x1f, 0x1f, 0x1f, 0x1f },	// U+258C (▌)
-}; // 1
-
-static const unsigned char leggie_block129[][18] = {
 	{ 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0 },	// U+2590 (▐)
 	{ 0x00, 0x24, 0x00, 0x49, 0x00, 0x92, 0x00, 0x24, 0x00, 0x49, 0x00, 0x92, 0x00, 0x24, 0x00, 0x49, 0x00, 0x92 },	// U+2591 (░)
 	{ 0x55, 0xaa, 0x55, 0xaa, 0x55, 0xaa, 0x55, 0xaa, 0x55, 0xaa, 0x55, 0xaa, 0x55, 0xaa, 0x55, 0xaa, 0x55, 0xaa },	// U+2592 (▒)
 	{ 0xff, 0xdb, 0xff, 0xb6, 0xff, 0x6d, 0xff, 0xdb, 0xff, 0xb6, 0xff, 0x6d, 0xff, 0xdb, 0xff, 0xb6, 0xff, 0x6d },	// U+2593 (▓)
-}; // 4
-
-static const unsigned char leggie_block130[][18] = {
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+25A0 (■)
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfe, 0x82, 0x82, 0x82, 0x82, 0x82, 0xfe, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+25A1 (□)
-}; // 2
-
-static const unsigned char leggie_block131[][18] = {
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfe, 0x82, 0xfe, 0x82, 0xfe, 0x82, 0xfe, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+25A4 (▤)
-}; // 1
-
-static const unsigned char leggie_block132[][18] = {
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+25AA (▪)
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7c, 0x44, 0x44, 0x44, 0x7c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+25AB (▫)
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+25AC (▬)
-}; // 3
-
-static const unsigned char leggie_block133[][18] = {
 	{ 0x10, 0x10, 0x10, 0x38, 0x38, 0x38, 0x38, 0x7c, 0x7c, 0x7c, 0x7c, 0xfe, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff },	// U+25B2 (▲)
-}; // 1
-
-static const unsigned char leggie_block134[][18] = {
 	{ 0x00, 0x00, 0x00, 0x00, 0x0f, 0x1f, 0x3f, 0x7f, 0xff, 0xff, 0xff, 0x7f, 0x3f, 0x1f, 0x0f, 0x00, 0x00, 0x00 },	// U+25B6 (▶)
 	{ 0x00, 0x00, 0x00, 0x00, 0x0f, 0x11, 0x21, 0x41, 0x81, 0x01, 0x81, 0x41, 0x21, 0x11, 0x0f, 0x00, 0x00, 0x00 },	// U+25B7 (▷)
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x0e, 0x1e, 0x3e, 0x7e, 0xfe, 0x7e, 0x3e, 0x1e, 0x0e, 0x00, 0x00, 0x00, 0x00 },	// U+25B8 (▸)
-}; // 3
-
-static const unsigned char leggie_block135[][18] = {
 	{ 0x01, 0x03, 0x07, 0x0f, 0x1f, 0x3f, 0x7f, 0xff, 0xff, 0xff, 0xff, 0x7f, 0x3f, 0x1f, 0x0f, 0x07, 0x03, 0x01 },	// U+25BA (►)
-}; // 1
-
-static const unsigned char leggie_block136[][18] = {
 	{ 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xfe, 0x7c, 0x7c, 0x7c, 0x7c, 0x38, 0x38, 0x38, 0x38, 0x10, 0x10, 0x10 },	// U+25BC (▼)
-}; // 1
-
-static const unsigned char leggie_block137[][18] = {
 	{ 0x00, 0x00, 0x00, 0x00, 0xe0, 0x10, 0x08, 0x04, 0x02, 0x01, 0x02, 0x04, 0x08, 0x10, 0xe0, 0x00, 0x00, 0x00 },	// U+25C1 (◁)
-}; // 1
-
-static const unsigned char leggie_block138[][18] = {
 	{ 0x00, 0x00, 0x00, 0x00, 0xe0, 0xf0, 0xf8, 0xfc, 0xfe, 0xff, 0xfe, 0xfc, 0xf8, 0xf0, 0xe0, 0x00, 0x00, 0x00 },	// U+25C4 (◄)
-}; // 1
-
-static const unsigned char leggie_block139[][18] = {
 	{ 0x00, 0x00, 0x00, 0x00, 0x10, 0x38, 0x7c, 0xfe, 0xff, 0xff, 0xff, 0xfe, 0x7c, 0x38, 0x10, 0x00, 0x00, 0x00 },	// U+25C6 (◆)
 	{ 0x00, 0x00, 0x00, 0x00, 0x10, 0x28, 0x44, 0x82, 0x01, 0x01, 0x01, 0x82, 0x44, 0x28, 0x10, 0x00, 0x00, 0x00 },	// U+25C7 (◇)
-}; // 2
-
-static const unsigned char leggie_block140[][18] = {
 	{ 0x10, 0x10, 0x28, 0x28, 0x44, 0x44, 0x82, 0x82, 0x01, 0x01, 0x82, 0x82, 0x44, 0x44, 0x28, 0x28, 0x10, 0x10 },	// U+25CA (◊)
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x38, 0x44, 0x82, 0x82, 0x82, 0x44, 0x38, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+25CB (○)
-}; // 2
-
-static const unsigned char leggie_block141[][18] = {
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x38, 0x7c, 0xfe, 0xfe, 0xfe, 0x7c, 0x38, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+25CF (●)
-}; // 1
-
-static const unsigned char leggie_block142[][18] = {
 	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc7, 0x83, 0x01, 0x01, 0x01, 0x83, 0xc7, 0xff, 0xff, 0xff, 0xff, 0xff },	// U+25D8 (◘)
 	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc7, 0xbb, 0x7d, 0x7d, 0x7d, 0xbb, 0xc7, 0xff, 0xff, 0xff, 0xff, 0xff },	// U+25D9 (◙)
-}; // 2
-
-static const unsigned char leggie_block143[][18] = {
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x7c, 0x82, 0x01, 0x01, 0x01, 0x01, 0x01, 0x82, 0x7c, 0x00, 0x00, 0x00, 0x00 },	// U+25EF (◯)
-}; // 1
-
-static const unsigned char leggie_block144[][18] = {
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xff, 0x00, 0x00, 0x00 },	// U+2610 (☐)
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x01, 0x81, 0x41, 0x23, 0x15, 0x09, 0x01, 0xff, 0x00, 0x00, 0x00 },	// U+2611 (☑)
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x01, 0x45, 0x29, 0x11, 0x29, 0x45, 0x01, 0xff, 0x00, 0x00, 0x00 },	// U+2612 (☒)
-}; // 3
-
-static const unsigned char leggie_block145[][18] = {
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x44, 0x00, 0x00, 0x00, 0x00, 0x82, 0x7c, 0x00, 0x00, 0x00, 0x00 },	// U+263A (☺)
 	{ 0x00, 0x00, 0x00, 0x00, 0x7c, 0xfe, 0xff, 0xbb, 0xff, 0xff, 0xff, 0xff, 0x7d, 0x83, 0xff, 0xfe, 0x7c, 0x00 },	// U+263B (☻)
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x92, 0x38, 0x44, 0xc7, 0x44, 0x38, 0x92, 0x11, 0x00, 0x00, 0x00 },	// U+263C (☼)
-}; // 3
-
-static const unsigned char leggie_block146[][18] = {
 	{ 0x00, 0x00, 0x00, 0x00, 0x7c, 0x82, 0x82, 0x82, 0x82, 0x82, 0x7c, 0x10, 0x10, 0x7c, 0x10, 0x00, 0x00, 0x00 },	// U+2640 (♀)
-}; // 1
-
-static const unsigned char leggie_block147[][18] = {
 	{ 0x00, 0x00, 0x00, 0x00, 0xe0, 0xc0, 0xb0, 0x0c, 0x7c, 0x82, 0x82, 0x82, 0x82, 0x82, 0x7c, 0x00, 0x00, 0x00 },	// U+2642 (♂)
-}; // 1
-
-static const unsigned char leggie_block148[][18] = {
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x38, 0x7c, 0xfe, 0xfe, 0xfe, 0x6c, 0x10, 0x7c, 0x00, 0x00, 0x00 },	// U+2660 (♠)
-}; // 1
-
-static const unsigned char leggie_block149[][18] = {
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x38, 0x38, 0x54, 0xfe, 0xfe, 0x6c, 0x10, 0x7c, 0x00, 0x00, 0x00 },	// U+2663 (♣)
-}; // 1
-
-static const unsigned char leggie_block150[][18] = {
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6c, 0xee, 0xfe, 0xfe, 0x7c, 0x7c, 0x38, 0x38, 0x10, 0x00, 0x00, 0x00 },	// U+2665 (♥)
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x38, 0x7c, 0xfe, 0xfe, 0xfe, 0x7c, 0x38, 0x10, 0x00, 0x00, 0x00 },	// U+2666 (♦)
-}; // 2
-
-static const unsigned char leggie_block151[][18] = {
 	{ 0x00, 0x00, 0x00, 0x00, 0x20, 0x60, 0xa0, 0x20, 0x20, 0xa0, 0x20, 0x3c, 0x3e, 0x3e, 0x1c, 0x00, 0x00, 0x00 },	// U+266A (♪)
 	{ 0x00, 0x00, 0x00, 0x00, 0x08, 0x38, 0xc8, 0x08, 0x08, 0x08, 0x08, 0x0e, 0xcf, 0xef, 0xee, 0xc0, 0x00, 0x00 },	// U+266B (♫)
-}; // 2
-
-static const unsigned char leggie_block152[][18] = {
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x40, 0x20, 0x12, 0x0a, 0x04, 0x04, 0x00, 0x00, 0x00 },	// U+2713 (✓)
-}; // 1
-
-static const unsigned char leggie_block153[][18] = {
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x44, 0x28, 0x10, 0x28, 0x44, 0x00, 0x00, 0x00, 0x00 },	// U+2717 (✗)
-}; // 1
-
-static const unsigned char leggie_block154[][18] = {
 	{ 0x00, 0x00, 0x00, 0x00, 0x10, 0x10, 0x10, 0x38, 0x38, 0xfe, 0x38, 0x38, 0x10, 0x10, 0x10, 0x00, 0x00, 0x00 },	// U+2726 (✦)
 	{ 0x00, 0x00, 0x00, 0x00, 0x10, 0x10, 0x10, 0x28, 0x28, 0xc6, 0x28, 0x28, 0x10, 0x10, 0x10, 0x00, 0x00, 0x00 },	// U+2727 (✧)
-}; // 2
-
-static const unsigned char leggie_block155[][18] = {
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x44, 0x28, 0x10, 0xee, 0x10, 0x28, 0x44, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+2732 (✲)
-}; // 1
-
-static const unsigned char leggie_block156[][18] = {
 	{ 0x00, 0x00, 0x00, 0x00, 0x10, 0x38, 0x7c, 0xba, 0xd7, 0xef, 0xd7, 0xba, 0x7c, 0x38, 0x10, 0x00, 0x00, 0x00 },	// U+2756 (❖)
-}; // 1
-
-static const unsigned char leggie_block157[][18] = {
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+2800 (⠀)
 	{ 0x00, 0x00, 0x0e, 0x0e, 0x0e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+2801 (⠁)
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0e, 0x0e, 0x0e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+2802 (⠂)
@@ -2133,45 +1665,24 @@ static const unsigned char leggie_block157[][18] = {
 	{ 0x00, 0x00, 0xee, 0xee, 0xee, 0x00, 0xe0, 0xe0, 0xe0, 0x00, 0xee, 0xee, 0xee, 0x00, 0xee, 0xee, 0xee, 0x00 },	// U+28FD (⣽)
 	{ 0x00, 0x00, 0xe0, 0xe0, 0xe0, 0x00, 0xee, 0xee, 0xee, 0x00, 0xee, 0xee, 0xee, 0x00, 0xee, 0xee, 0xee, 0x00 },	// U+28FE (⣾)
 	{ 0x00, 0x00, 0xee, 0xee, 0xee, 0x00, 0xee, 0xee, 0xee, 0x00, 0xee, 0xee, 0xee, 0x00, 0xee, 0xee, 0xee, 0x00 },	// U+28FF (⣿)
-}; // 256
-
-static const unsigned char leggie_block158[][18] = {
 	{ 0x00, 0x00, 0x00, 0x00, 0xfe, 0x80, 0x80, 0x40, 0x20, 0x10, 0x08, 0x04, 0x02, 0x02, 0xfe, 0x80, 0x80, 0x78 },	// U+A640 (Ꙁ)
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfe, 0x40, 0x20, 0x10, 0x08, 0x04, 0xfe, 0x80, 0x80, 0x78 },	// U+A641 (ꙁ)
 	{ 0x00, 0x00, 0x00, 0x00, 0xfe, 0x80, 0x80, 0x40, 0x20, 0xfe, 0x08, 0x04, 0x02, 0x02, 0xfe, 0x80, 0x80, 0x78 },	// U+A642 (Ꙃ)
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfe, 0x40, 0x20, 0xfe, 0x08, 0x04, 0xfe, 0x80, 0x80, 0x78 },	// U+A643 (ꙃ)
-}; // 4
-
-static const unsigned char leggie_block159[][18] = {
 	{ 0x00, 0x00, 0x00, 0x00, 0x82, 0x82, 0x44, 0x28, 0x10, 0x7c, 0x92, 0x92, 0x92, 0x82, 0x7c, 0x00, 0x00, 0x00 },	// U+A64A (Ꙋ)
 	{ 0x00, 0x00, 0x00, 0x82, 0x82, 0x82, 0x44, 0x28, 0x10, 0x28, 0x44, 0x82, 0x82, 0x82, 0x7c, 0x00, 0x00, 0x00 },	// U+A64B (ꙋ)
-}; // 2
-
-static const unsigned char leggie_block160[][18] = {
 	{ 0x00, 0x00, 0x00, 0x00, 0x83, 0x82, 0x82, 0x82, 0x9e, 0xa2, 0xa2, 0xa2, 0xa2, 0xa2, 0x9e, 0x00, 0x00, 0x00 },	// U+A650 (Ꙑ)
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x83, 0x82, 0x82, 0x9e, 0xa2, 0xa2, 0x9e, 0x00, 0x00, 0x00 },	// U+A651 (ꙑ)
-}; // 2
-
-static const unsigned char leggie_block161[][18] = {
 	{ 0x00, 0x00, 0x00, 0x00, 0x72, 0x8a, 0x8a, 0x8a, 0x8a, 0x8e, 0xfa, 0x8a, 0x8a, 0x8a, 0x8a, 0x00, 0x00, 0x00 },	// U+A656 (Ꙗ)
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x72, 0x82, 0x82, 0xfe, 0x8a, 0x8a, 0xf2, 0x00, 0x00, 0x00 },	// U+A657 (ꙗ)
-}; // 2
-
-static const unsigned char leggie_block162[][18] = {
 	{ 0x00, 0x00, 0x00, 0x00, 0x82, 0x82, 0x82, 0x86, 0x8a, 0x92, 0xa2, 0xc2, 0x82, 0x82, 0x82, 0x00, 0x00, 0x00 },	// U+A790 (Ꞑ)
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7e, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x00, 0x00, 0x00 },	// U+A791 (ꞑ)
-}; // 2
-
-static const unsigned char leggie_block163[][18] = {
 	{ 0x00, 0x00, 0x00, 0x01, 0x01, 0x01, 0x01, 0x01, 0x81, 0x41, 0x41, 0xc1, 0x41, 0x41, 0x8e, 0x00, 0x00, 0x00 },	// U+E000 ()
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x87, 0x48, 0x48, 0x4f, 0x40, 0x40, 0x87, 0x00, 0x00, 0x00 },	// U+E001 ()
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8f, 0x48, 0x48, 0x48, 0x48, 0x48, 0x8f, 0x08, 0x08, 0x07 },	// U+E002 ()
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0xcf, 0x88, 0x88, 0x88, 0x88, 0x88, 0x8f, 0x08, 0x08, 0x07 },	// U+E003 ()
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3c, 0x42, 0x42, 0x7e, 0x02, 0x02, 0x3c, 0x00, 0x00, 0x00 },	// U+E004 ()
 	{ 0x00, 0x00, 0x00, 0x00, 0xfe, 0xee, 0xee, 0x00, 0x00, 0x10, 0x00, 0x00, 0x82, 0x82, 0x7c, 0x00, 0x00, 0x00 },	// U+E005 ()
-}; // 6
-
-static const unsigned char leggie_block164[][18] = {
 	{ 0x00, 0x00, 0x00, 0x38, 0xfe, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0xfe, 0x00, 0x00, 0x00 },	// U+E010 ()
 	{ 0x00, 0x00, 0x00, 0x38, 0xfe, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0xfe, 0xfe, 0x00, 0x00, 0x00 },	// U+E011 ()
 	{ 0x00, 0x00, 0x00, 0x38, 0xfe, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0xfe, 0xfe, 0xfe, 0x00, 0x00, 0x00 },	// U+E012 ()
@@ -2183,18 +1694,12 @@ static const unsigned char leggie_block164[][18] = {
 	{ 0x00, 0x00, 0x00, 0x38, 0xfe, 0x82, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0x00, 0x00, 0x00 },	// U+E018 ()
 	{ 0x00, 0x00, 0x00, 0x38, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0x00, 0x00, 0x00 },	// U+E019 ()
 	{ 0x00, 0x00, 0x00, 0x38, 0xfe, 0xfe, 0xfe, 0xd6, 0xfe, 0xfe, 0xba, 0xc6, 0xfe, 0xfe, 0xfe, 0x00, 0x00, 0x00 },	// U+E01A ()
-}; // 11
-
-static const unsigned char leggie_block165[][18] = {
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x44, 0x28, 0x10, 0x28, 0x44, 0x10, 0x55, 0x00, 0x00, 0x00 },	// U+E020 ()
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00 },	// U+E021 ()
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x04, 0x05, 0x00, 0x00, 0x00 },	// U+E022 ()
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x10, 0x14, 0x14, 0x15, 0x00, 0x00, 0x00 },	// U+E023 ()
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x40, 0x50, 0x50, 0x54, 0x54, 0x55, 0x00, 0x00, 0x00 },	// U+E024 ()
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x40, 0x50, 0x50, 0x54, 0x54, 0x55, 0x00, 0x00, 0x00 },	// U+E025 ()
-}; // 6
-
-static const unsigned char leggie_block166[][18] = {
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x00, 0x44, 0x28, 0x10, 0x29, 0x44, 0x10, 0x48, 0x20, 0x80, 0x00 },	// U+E030 ()
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+E031 ()
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x04, 0x05, 0x04, 0x02, 0x00, 0x00, 0x00, 0x00 },	// U+E032 ()
@@ -2205,46 +1710,25 @@ static const unsigned char leggie_block166[][18] = {
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7c, 0x82, 0x01, 0x01, 0x01, 0x01, 0x6d, 0xee, 0x6c, 0x00, 0x00, 0x00 },	// U+E037 ()
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x00, 0x44, 0x28, 0x92, 0x28, 0x44, 0x10, 0xa0, 0xc0, 0x80, 0x00 },	// U+E038 ()
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0xc0, 0xa0, 0x90, 0x8e, 0x86, 0x8e, 0x90, 0xa0, 0xc0, 0x80, 0x00 },	// U+E039 ()
-}; // 10
-
-static const unsigned char leggie_block167[][18] = {
 	{ 0x01, 0x21, 0x71, 0xa9, 0x25, 0x21, 0x21, 0x21, 0x21, 0x11, 0x09, 0x04, 0x02, 0x01, 0x01, 0x01, 0x01, 0x01 },	// U+E0A0 ()
 	{ 0x00, 0x00, 0x02, 0x02, 0x02, 0x02, 0x02, 0x1e, 0x00, 0x00, 0x90, 0x90, 0xb0, 0xd0, 0x90, 0x90, 0x00, 0x00 },	// U+E0A1 ()
 	{ 0x00, 0x00, 0x00, 0x00, 0x38, 0x44, 0x44, 0x44, 0xfe, 0xee, 0xee, 0xee, 0xfe, 0xfe, 0x7c, 0x00, 0x00, 0x00 },	// U+E0A2 ()
-}; // 3
-
-static const unsigned char leggie_block168[][18] = {
 	{ 0x01, 0x03, 0x07, 0x0f, 0x1f, 0x3f, 0x7f, 0xff, 0xff, 0xff, 0xff, 0x7f, 0x3f, 0x1f, 0x0f, 0x07, 0x03, 0x01 },	// U+E0B0 ()
 	{ 0x01, 0x02, 0x04, 0x08, 0x10, 0x20, 0x40, 0x80, 0x00, 0x00, 0x80, 0x40, 0x20, 0x10, 0x08, 0x04, 0x02, 0x01 },	// U+E0B1 ()
 	{ 0x00, 0x80, 0xc0, 0xe0, 0xf0, 0xf8, 0xfc, 0xfe, 0xff, 0xff, 0xfe, 0xfc, 0xf8, 0xf0, 0xe0, 0xc0, 0x80, 0x00 },	// U+E0B2 ()
 	{ 0x00, 0x80, 0x40, 0x20, 0x10, 0x08, 0x04, 0x02, 0x01, 0x01, 0x02, 0x04, 0x08, 0x10, 0x20, 0x40, 0x80, 0x00 },	// U+E0B3 ()
-}; // 4
-
-static const unsigned char leggie_block169[][18] = {
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xee, 0xee, 0xee, 0x00, 0xee, 0xee, 0xee, 0x00, 0x00, 0x00 },	// U+F000 ()
 	{ 0x00, 0x00, 0x00, 0x1c, 0x02, 0x82, 0x02, 0x02, 0xce, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x00, 0x00, 0x00 },	// U+F001 ()
 	{ 0x00, 0x00, 0x00, 0x1c, 0x22, 0x22, 0x22, 0x22, 0x2e, 0x22, 0x22, 0x22, 0x22, 0x22, 0xc2, 0x00, 0x00, 0x00 },	// U+F002 ()
-}; // 3
-
-static const unsigned char leggie_block170[][18] = {
 	{ 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+F800 ()
 	{ 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+F801 ()
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00 },	// U+F802 ()
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff },	// U+F803 ()
-}; // 4
-
-static const unsigned char leggie_block171[][18] = {
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xee, 0xee, 0xee, 0x00, 0xee, 0xee, 0xee, 0x00, 0x00, 0x00 },	// U+F810 ()
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfe, 0x00, 0x00, 0xfe, 0x00, 0x00, 0xfe, 0x00, 0x00, 0x00 },	// U+F811 ()
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x10, 0x6c, 0x92, 0x42, 0x42, 0x42, 0x92, 0x6c, 0x00, 0x00, 0x00 },	// U+F812 ()
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x10, 0x6c, 0xfe, 0x7e, 0x7e, 0x7e, 0xfe, 0x6c, 0x00, 0x00, 0x00 },	// U+F813 ()
-}; // 4
-
-static const unsigned char leggie_block172[][18] = {
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x10, 0x6c, 0xfe, 0x7e, 0x7e, 0x7e, 0xfe, 0x6c, 0x00, 0x00, 0x00 },	// U+F8FF ()
-}; // 1
-
-static const unsigned char leggie_block173[][18] = {
 	{ 0x00, 0x00, 0x00, 0xdc, 0x22, 0x22, 0x22, 0x22, 0xee, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x00, 0x00, 0x00 },	// U+FB00 (ﬀ)
 	{ 0x00, 0x00, 0x00, 0x1c, 0x02, 0x82, 0x02, 0x02, 0xce, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x00, 0x00, 0x00 },	// U+FB01 (ﬁ)
 	{ 0x00, 0x00, 0x00, 0x1c, 0x22, 0x22, 0x22, 0x22, 0x2e, 0x22, 0x22, 0x22, 0x22, 0x22, 0xc2, 0x00, 0x00, 0x00 },	// U+FB02 (ﬂ)
@@ -2252,23 +1736,14 @@ static const unsigned char leggie_block173[][18] = {
 	{ 0x00, 0x00, 0x00, 0x36, 0x49, 0x49, 0x49, 0x49, 0x5b, 0x49, 0x49, 0x49, 0x49, 0x49, 0x89, 0x00, 0x00, 0x00 },	// U+FB04 (ﬄ)
 	{ 0x00, 0x00, 0x00, 0x0c, 0x12, 0x12, 0x12, 0x12, 0x7a, 0x12, 0x12, 0x12, 0x12, 0x12, 0xe2, 0x00, 0x00, 0x00 },	// U+FB05 (ﬅ)
 	{ 0x00, 0x00, 0x00, 0x20, 0x20, 0x20, 0x20, 0x20, 0xfe, 0x21, 0x21, 0x26, 0x28, 0x28, 0xc7, 0x00, 0x00, 0x00 },	// U+FB06 (ﬆ)
-}; // 7
-
-static const unsigned char leggie_block174[][18] = {
 	{ 0x00, 0x00, 0x00, 0x1e, 0x09, 0x3e, 0x28, 0x28, 0x29, 0x29, 0x29, 0x29, 0x29, 0x29, 0xce, 0x00, 0x00, 0x00 },	// U+FB13 (ﬓ)
 	{ 0x00, 0x00, 0x00, 0x38, 0x28, 0x28, 0x28, 0x28, 0xe9, 0x29, 0x29, 0x29, 0x29, 0x29, 0xce, 0x00, 0x00, 0x00 },	// U+FB14 (ﬔ)
 	{ 0x00, 0x00, 0x00, 0x38, 0x28, 0x28, 0x28, 0x28, 0xe9, 0x29, 0x29, 0x29, 0x29, 0x29, 0x2e, 0x20, 0x20, 0x20 },	// U+FB15 (ﬕ)
 	{ 0x00, 0x00, 0x00, 0x0e, 0x09, 0x3e, 0x28, 0x28, 0x29, 0x29, 0x29, 0x29, 0x29, 0x29, 0xce, 0x08, 0x08, 0x18 },	// U+FB16 (ﬖ)
 	{ 0x00, 0x00, 0x00, 0x1c, 0x14, 0x14, 0x14, 0x14, 0x35, 0x55, 0x55, 0x55, 0x55, 0x55, 0x96, 0x10, 0x10, 0x30 },	// U+FB17 (ﬗ)
-}; // 5
-
-static const unsigned char leggie_block175[][18] = {
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x08, 0x00, 0x00, 0x00 },	// U+FE50 (﹐)
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+FE51 (﹑)
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00 },	// U+FE52 (﹒)
-}; // 3
-
-static const unsigned char leggie_block176[][18] = {
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x10, 0x08, 0x00, 0x00, 0x00 },	// U+FE54 (﹔)
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00 },	// U+FE55 (﹕)
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7e, 0x80, 0x80, 0x60, 0x10, 0x00, 0x10, 0x00, 0x00, 0x00 },	// U+FE56 (﹖)
@@ -2288,20 +1763,89 @@ static const unsigned char leggie_block176[][18] = {
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x20, 0x10, 0x08, 0x10, 0x20, 0x40, 0x00, 0x00, 0x00 },	// U+FE64 (﹤)
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x08, 0x10, 0x20, 0x10, 0x08, 0x04, 0x00, 0x00, 0x00 },	// U+FE65 (﹥)
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7c, 0x00, 0x7c, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+FE66 (﹦)
-}; // 19
-
-static const unsigned char leggie_block177[][18] = {
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x04, 0x08, 0x10, 0x20, 0x40, 0x80, 0x00, 0x00, 0x00 },	// U+FE68 (﹨)
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0xfc, 0x02, 0x7c, 0x80, 0x7e, 0x10, 0x00, 0x00, 0x00 },	// U+FE69 (﹩)
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x84, 0x4a, 0x24, 0x10, 0x48, 0xa4, 0x42, 0x00, 0x00, 0x00 },	// U+FE6A (﹪)
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x78, 0x84, 0xf2, 0x8a, 0x72, 0x04, 0x78, 0x00, 0x00, 0x00 },	// U+FE6B (﹫)
-}; // 4
-
-static const unsigned char leggie_block178[][18] = {
 	{ 0x00, 0x00, 0x00, 0x00, 0x10, 0x38, 0x44, 0xbe, 0xbf, 0xdf, 0xef, 0xfe, 0x6c, 0x38, 0x10, 0x00, 0x00, 0x00 },	// U+FFFD (�)
-}; // 1
-
-static const unsigned char leggie_block179[][18] = {
 	{ 0x00, 0x00, 0x00, 0x00, 0xfe, 0xc6, 0xc6, 0xaa, 0xaa, 0x92, 0x92, 0xaa, 0xaa, 0xc6, 0xc6, 0xfe, 0x00, 0x00 },	// U+FFFF (￿)
-}; // 1
+}; // 1764
+
+static const uint8_t leggie_page_index[] = {
+	0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00,
+	0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x00,
+	0x0a, 0x0b, 0x0c, 0x0d, 0x0e, 0x0f, 0x10, 0x11, 0x12, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x13, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x16, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x17, 0x00, 0x00, 0x18, 0x00, 0x00, 0x19, 0x1a,
+}; // 256
 
+static const uint32_t leggie_page_bits[][8] = {
+	{ 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000 },	// Empty
+	{ 0x00000000, 0xffffffff, 0xffffffff, 0x7fffffff, 0x00000000, 0xffffffff, 0xffffffff, 0xffffffff },	// U+00xx
+	{ 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0x0004c000, 0x00e18003, 0x3fffe000, 0xfc00c3f0 },	// U+01xx
+	{ 0x0f000000, 0x00000000, 0xffff0000, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0x00007fff },	// U+02xx
+	{ 0x00000000, 0x00000000, 0x00000000, 0x44000000, 0xffffd770, 0xfffffffb, 0x00007fff, 0x00000000 },	// U+03xx
+	{ 0xffffffff, 0xffffffff, 0xffffffff, 0x00ffffff, 0x3fcffc03, 0x0c03cc0f, 0x03ffe7e1, 0x030ff3cc },	// U+04xx
+	{ 0x00000000, 0xfffe0000, 0xfe7fffff, 0xfffffffe, 0x0000e6ff, 0x00000000, 0xffff0000, 0x000007ff },	// U+05xx
+	{ 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000001, 0x00000000, 0x00000000 },	// U+0Cxx
+	{ 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xffff0000, 0xffc1ffff },	// U+10xx
+	{ 0xc0000c0c, 0x00c00030, 0x00c00003, 0x00000c03, 0x00000c3f, 0xffffffff, 0xffffffff, 0x03ffffff },	// U+1Exx
+	{ 0xffff0000, 0xf7ff00ff, 0x7fffffff, 0xfff3001e, 0x1fff7fff, 0x3736ffe2, 0x00000000, 0x00000000 },	// U+20xx
+	{ 0x00400000, 0x00000804, 0x00000000, 0x00000000, 0x017f0000, 0x03200350, 0xc03f0040, 0x000604b0 },	// U+21xx
+	{ 0xc6000128, 0x00000780, 0x00000100, 0x00000033, 0x20c00000, 0x00000000, 0x00000000, 0x00000000 },	// U+22xx
+	{ 0x0101002c, 0x200009f3, 0x00000000, 0x00000000, 0x000009d1, 0x3c000000, 0x0000c000, 0x00000000 },	// U+23xx
+	{ 0xffffffff, 0x0000007f, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000 },	// U+24xx
+	{ 0x11111005, 0x10101010, 0xffff0000, 0x00001fff, 0x000f1111, 0x15c41c13, 0x03008cd2, 0x00008000 },	// U+25xx
+	{ 0x00070000, 0x1c000000, 0x00000005, 0x00000c69, 0x00000000, 0x00000000, 0x00000000, 0x00000000 },	// U+26xx
+	{ 0x00880000, 0x000400c0, 0x00400000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000 },	// U+27xx
+	{ 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff },	// U+28xx
+	{ 0x00000000, 0x00000000, 0x00c30c0f, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000 },	// U+A6xx
+	{ 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00030000, 0x00000000, 0x00000000, 0x00000000 },	// U+A7xx
+	{ 0x07ff003f, 0x03ff003f, 0x00000000, 0x00000000, 0x00000000, 0x000f0007, 0x00000000, 0x00000000 },	// U+E0xx
+	{ 0x00000007, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000 },	// U+F0xx
+	{ 0x000f000f, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x80000000 },	// U+F8xx
+	{ 0x00f8007f, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000 },	// U+FBxx
+	{ 0x00000000, 0x00000000, 0xfff70000, 0x00000f7f, 0x00000000, 0x00000000, 0x00000000, 0x00000000 },	// U+FExx
+	{ 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xa0000000 },	// U+FFxx
+}; // 27
+
+static const uint16_t leggie_page_base[][8] = {
+	{ 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000 },	// Empty
+	{ 0x0000, 0x0000, 0x0020, 0x0040, 0x005f, 0x005f, 0x007f, 0x009f },	// U+00xx
+	{ 0x00bf, 0x00df, 0x00ff, 0x011f, 0x013f, 0x0142, 0x0149, 0x015a },	// U+01xx
+	{ 0x0168, 0x016c, 0x016c, 0x017c, 0x019c, 0x01bc, 0x01dc, 0x01fc },	// U+02xx
+	{ 0x020b, 0x020b, 0x020b, 0x020b, 0x020d, 0x0226, 0x0245, 0x0254 },	// U+03xx
+	{ 0x0254, 0x0274, 0x0294, 0x02b4, 0x02cc, 0x02e0, 0x02ec, 0x0300 },	// U+04xx
+	{ 0x0310, 0x0310, 0x031f, 0x033d, 0x035c, 0x0369, 0x0369, 0x0379 },	// U+05xx
+	{ 0x0384, 0x0384, 0x0384, 0x0384, 0x0384, 0x0384, 0x0385, 0x0385 },	// U+0Cxx
+	{ 0x0385, 0x0385, 0x0385, 0x0385, 0x0385, 0x0385, 0x0385, 0x0395 },	// U+10xx
+	{ 0x03b0, 0x03b6, 0x03ba, 0x03be, 0x03c2, 0x03ca, 0x03ea, 0x040a },	// U+1Exx
+	{ 0x0424, 0x0434, 0x044b, 0x046a, 0x047c, 0x0498, 0x04ad, 0x04ad },	// U+20xx
+	{ 0x04ad, 0x04ae, 0x04b0, 0x04b0, 0x04b0, 0x04b8, 0x04bf, 0x04c8 },	// U+21xx
+	{ 0x04ce, 0x04d5, 0x04d9, 0x04da, 0x04de, 0x04e1, 0x04e1, 0x04e1 },	// U+22xx
+	{ 0x04e1, 0x04e6, 0x04ef, 0x04ef, 0x04ef, 0x04f5, 0x04f9, 0x04fb },	// U+23xx
+	{ 0x04fb, 0x051b, 0x0522, 0x0522, 0x0522, 0x0522, 0x0522, 0x0522 },	// U+24xx
+	{ 0x0522, 0x0529, 0x052d, 0x053d, 0x054a, 0x0552, 0x055e, 0x0567 },	// U+25xx
+	{ 0x0568, 0x056b, 0x056e, 0x0570, 0x0576, 0x0576, 0x0576, 0x0576 },	// U+26xx
+	{ 0x0576, 0x0578, 0x057b, 0x057c, 0x057c, 0x057c, 0x057c, 0x057c },	// U+27xx
+	{ 0x057c, 0x059c, 0x05bc, 0x05dc, 0x05fc, 0x061c, 0x063c, 0x065c },	// U+28xx
+	{ 0x067c, 0x067c, 0x067c, 0x0686, 0x0686, 0x0686, 0x0686, 0x0686 },	// U+A6xx
+	{ 0x0686, 0x0686, 0x0686, 0x0686, 0x0686, 0x0688, 0x0688, 0x0688 },	// U+A7xx
+	{ 0x0688, 0x0699, 0x06a9, 0x06a9, 0x06a9, 0x06a9, 0x06b0, 0x06b0 },	// U+E0xx
+	{ 0x06b0, 0x06b3, 0x06b3, 0x06b3, 0x06b3, 0x06b3, 0x06b3, 0x06b3 },	// U+F0xx
+	{ 0x06b3, 0x06bb, 0x06bb, 0x06bb, 0x06bb, 0x06bb, 0x06bb, 0x06bb },	// U+F8xx
+	{ 0x06bc, 0x06c8, 0x06c8, 0x06c8, 0x06c8, 0x06c8, 0x06c8, 0x06c8 },	// U+FBxx
+	{ 0x06c8, 0x06c8, 0x06c8, 0x06d7, 0x06e2, 0x06e2, 0x06e2, 0x06e2 },	// U+FExx
+	{ 0x06e2, 0x06e2, 0x06e2, 0x06e2, 0x06e2, 0x06e2, 0x06e2, 0x06e2 },	// U+FFxx
+}; // 27
@@ -4,11 +4,8 @@
 * With FBInk's tools/hextoc.py
 */
 
-static const unsigned char orpb_block1[][12] = {
+static const unsigned char orpb_glyphs[][12] = {
 	{ 0x00, 0x00, 0x00, 0x15, 0x00, 0x11, 0x00, 0x11, 0x00, 0x15, 0x00, 0x00 },	// U+0000 (ESC)
-}; // 1
-
-static const unsigned char orpb_block2[][12] = {
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+0020 ( )
 	{ 0x00, 0x00, 0x00, 0x0c, 0x0c, 0x0c, 0x0c, 0x00, 0x0c, 0x0c, 0x00, 0x00 },	// U+0021 (!)
 	{ 0x00, 0x00, 0x1b, 0x1b, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+0022 (")
@@ -104,9 +101,6 @@ static const unsigned char orpb_block2[][12] = {
 	{ 0x00, 0x00, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x00 },	// U+007C (|)
 	{ 0x00, 0x00, 0x06, 0x0c, 0x0c, 0x0c, 0x38, 0x0c, 0x0c, 0x0c, 0x06, 0x00 },	// U+007D (})
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x36, 0x3f, 0x1b, 0x00, 0x00, 0x00, 0x00 },	// U+007E (~)
-}; // 95
-
-static const unsigned char orpb_block3[][12] = {
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+00A0 ( )
 	{ 0x00, 0x00, 0x00, 0x04, 0x00, 0x04, 0x04, 0x04, 0x04, 0x04, 0x00, 0x00 },	// U+00A1 (¡)
 	{ 0x00, 0x00, 0x00, 0x00, 0x04, 0x0e, 0x15, 0x05, 0x15, 0x0e, 0x04, 0x00 },	// U+00A2 (¢)
@@ -835,17 +829,11 @@ static const unsigned char orpb_block3[][12] = {
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x04 },	// U+0375 (͵)
 	{ 0x00, 0x00, 0x00, 0x11, 0x19, 0x19, 0x15, 0x13, 0x13, 0x11, 0x00, 0x00 },	// U+0376 (Ͷ)
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x0d, 0x0b, 0x09, 0x09, 0x10, 0x00 },	// U+0377 (ͷ)
-}; // 728
-
-static const unsigned char orpb_block4[][12] = {
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x0c },	// U+037A (ͺ)
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x0e, 0x11, 0x10, 0x11, 0x0e, 0x00, 0x00 },	// U+037B (ͻ)
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x0e, 0x11, 0x05, 0x11, 0x0e, 0x00, 0x00 },	// U+037C (ͼ)
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x0e, 0x11, 0x14, 0x11, 0x0e, 0x00, 0x00 },	// U+037D (ͽ)
 	{ 0x00, 0x00, 0x00, 0x00, 0x04, 0x0e, 0x04, 0x00, 0x0c, 0x04, 0x02, 0x00 },	// U+037E (;)
-}; // 5
-
-static const unsigned char orpb_block5[][12] = {
 	{ 0x00, 0x08, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+0384 (΄)
 	{ 0x08, 0x04, 0x00, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+0385 (΅)
 	{ 0x02, 0x01, 0x00, 0x0e, 0x11, 0x11, 0x1f, 0x11, 0x11, 0x11, 0x00, 0x00 },	// U+0386 (Ά)
@@ -853,13 +841,7 @@ static const unsigned char orpb_block5[][12] = {
 	{ 0x02, 0x01, 0x00, 0x1f, 0x01, 0x01, 0x0f, 0x01, 0x01, 0x1f, 0x00, 0x00 },	// U+0388 (Έ)
 	{ 0x02, 0x01, 0x00, 0x11, 0x11, 0x11, 0x1f, 0x11, 0x11, 0x11, 0x00, 0x00 },	// U+0389 (Ή)
 	{ 0x02, 0x01, 0x00, 0x0e, 0x04, 0x04, 0x04, 0x04, 0x04, 0x0e, 0x00, 0x00 },	// U+038A (Ί)
-}; // 7
-
-static const unsigned char orpb_block6[][12] = {
 	{ 0x02, 0x01, 0x00, 0x0e, 0x11, 0x11, 0x11, 0x11, 0x11, 0x0e, 0x00, 0x00 },	// U+038C (Ό)
-}; // 1
-
-static const unsigned char orpb_block7[][12] = {
 	{ 0x02, 0x01, 0x00, 0x11, 0x11, 0x0a, 0x04, 0x04, 0x04, 0x04, 0x00, 0x00 },	// U+038E (Ύ)
 	{ 0x02, 0x01, 0x00, 0x0e, 0x11, 0x11, 0x11, 0x11, 0x0a, 0x1b, 0x00, 0x00 },	// U+038F (Ώ)
 	{ 0x08, 0x04, 0x00, 0x0a, 0x00, 0x04, 0x04, 0x04, 0x14, 0x08, 0x00, 0x00 },	// U+0390 (ΐ)
@@ -880,9 +862,6 @@ static const unsigned char orpb_block7[][12] = {
 	{ 0x00, 0x00, 0x00, 0x0e, 0x11, 0x11, 0x11, 0x11, 0x11, 0x0e, 0x00, 0x00 },	// U+039F (Ο)
 	{ 0x00, 0x00, 0x00, 0x1f, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x00, 0x00 },	// U+03A0 (Π)
 	{ 0x00, 0x00, 0x00, 0x0f, 0x11, 0x11, 0x0f, 0x01, 0x01, 0x01, 0x00, 0x00 },	// U+03A1 (Ρ)
-}; // 20
-
-static const unsigned char orpb_block8[][12] = {
 	{ 0x00, 0x00, 0x00, 0x1f, 0x02, 0x04, 0x08, 0x04, 0x02, 0x1f, 0x00, 0x00 },	// U+03A3 (Σ)
 	{ 0x00, 0x00, 0x00, 0x1f, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x00, 0x00 },	// U+03A4 (Τ)
 	{ 0x00, 0x00, 0x00, 0x11, 0x11, 0x0a, 0x04, 0x04, 0x04, 0x04, 0x00, 0x00 },	// U+03A5 (Υ)
@@ -1268,9 +1247,6 @@ static const unsigned char orpb_block8[][12] = {
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x0b, 0x0a, 0x1a, 0x2a, 0x29, 0x20, 0x00 },	// U+0521 (ԡ)
 	{ 0x00, 0x00, 0x00, 0x05, 0x05, 0x05, 0x0f, 0x15, 0x15, 0x15, 0x10, 0x08 },	// U+0522 (Ԣ)
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x05, 0x0f, 0x15, 0x15, 0x10, 0x08 },	// U+0523 (ԣ)
-}; // 385
-
-static const unsigned char orpb_block9[][12] = {
 	{ 0x00, 0x00, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x0d, 0x12, 0x00, 0x00 },	// U+0531 (Ա)
 	{ 0x00, 0x00, 0x0e, 0x11, 0x11, 0x01, 0x01, 0x0f, 0x11, 0x01, 0x00, 0x00 },	// U+0532 (Բ)
 	{ 0x00, 0x00, 0x02, 0x05, 0x05, 0x05, 0x0e, 0x14, 0x04, 0x04, 0x00, 0x00 },	// U+0533 (Գ)
@@ -1309,9 +1285,6 @@ static const unsigned char orpb_block9[][12] = {
 	{ 0x00, 0x00, 0x08, 0x14, 0x14, 0x0c, 0x05, 0x0e, 0x14, 0x04, 0x00, 0x00 },	// U+0554 (Ք)
 	{ 0x00, 0x00, 0x0e, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x0e, 0x00, 0x00 },	// U+0555 (Օ)
 	{ 0x00, 0x00, 0x02, 0x05, 0x05, 0x0e, 0x14, 0x15, 0x15, 0x0e, 0x00, 0x00 },	// U+0556 (Ֆ)
-}; // 38
-
-static const unsigned char orpb_block10[][12] = {
 	{ 0x04, 0x02, 0x02, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+0559 (ՙ)
 	{ 0x00, 0x0c, 0x08, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+055A (՚)
 	{ 0x00, 0x08, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+055B (՛)
@@ -1319,9 +1292,6 @@ static const unsigned char orpb_block10[][12] = {
 	{ 0x00, 0x04, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+055D (՝)
 	{ 0x00, 0x0e, 0x11, 0x15, 0x15, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+055E (՞)
 	{ 0x00, 0x03, 0x11, 0x0e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+055F (՟)
-}; // 7
-
-static const unsigned char orpb_block11[][12] = {
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x15, 0x15, 0x1a, 0x00, 0x00 },	// U+0561 (ա)
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x0f, 0x11, 0x11, 0x01, 0x1f, 0x01, 0x01 },	// U+0562 (բ)
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x0e, 0x09, 0x09, 0x09, 0x1e, 0x08, 0x08 },	// U+0563 (գ)
@@ -1361,14 +1331,8 @@ static const unsigned char orpb_block11[][12] = {
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x0e, 0x11, 0x11, 0x11, 0x0e, 0x00, 0x00 },	// U+0585 (օ)
 	{ 0x00, 0x00, 0x06, 0x05, 0x05, 0x0e, 0x14, 0x14, 0x15, 0x0e, 0x04, 0x04 },	// U+0586 (ֆ)
 	{ 0x00, 0x00, 0x00, 0x01, 0x01, 0x09, 0x09, 0x09, 0x09, 0x16, 0x00, 0x00 },	// U+0587 (և)
-}; // 39
-
-static const unsigned char orpb_block12[][12] = {
 	{ 0x00, 0x00, 0x00, 0x00, 0x0c, 0x0c, 0x00, 0x0c, 0x0c, 0x00, 0x00, 0x00 },	// U+0589 (։)
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x1c, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+058A (֊)
-}; // 2
-
-static const unsigned char orpb_block13[][12] = {
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x0a },	// U+0591 (֑)
 	{ 0x00, 0x04, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+0592 (֒)
 	{ 0x08, 0x04, 0x08, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+0593 (֓)
@@ -1424,9 +1388,6 @@ static const unsigned char orpb_block13[][12] = {
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x06 },	// U+05C5 (ׅ)
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x02, 0x02, 0x02, 0x0e, 0x00, 0x00 },	// U+05C6 (׆)
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0e, 0x04, 0x04 },	// U+05C7 (ׇ)
-}; // 55
-
-static const unsigned char orpb_block14[][12] = {
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x12, 0x16, 0x09, 0x13, 0x00, 0x00 },	// U+05D0 (א)
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x0f, 0x08, 0x08, 0x08, 0x1f, 0x00, 0x00 },	// U+05D1 (ב)
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x04, 0x08, 0x14, 0x12, 0x00, 0x00 },	// U+05D2 (ג)
@@ -1454,17 +1415,11 @@ static const unsigned char orpb_block14[][12] = {
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x0f, 0x10, 0x10, 0x10, 0x10, 0x00, 0x00 },	// U+05E8 (ר)
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x15, 0x17, 0x11, 0x0f, 0x00, 0x00 },	// U+05E9 (ש)
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x1f, 0x12, 0x12, 0x12, 0x13, 0x00, 0x00 },	// U+05EA (ת)
-}; // 27
-
-static const unsigned char orpb_block15[][12] = {
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x1b, 0x12, 0x12, 0x12, 0x12, 0x00, 0x00 },	// U+05F0 (װ)
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x1b, 0x12, 0x12, 0x10, 0x10, 0x00, 0x00 },	// U+05F1 (ױ)
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x1b, 0x12, 0x12, 0x00, 0x00, 0x00, 0x00 },	// U+05F2 (ײ)
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+05F3 (׳)
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x12, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+05F4 (״)
-}; // 5
-
-static const unsigned char orpb_block16[][12] = {
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3f, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+1680 ( )
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3f, 0x10, 0x10, 0x10, 0x00, 0x00 },	// U+1681 (ᚁ)
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3f, 0x14, 0x14, 0x14, 0x00, 0x00 },	// U+1682 (ᚂ)
@@ -1494,9 +1449,6 @@ static const unsigned char orpb_block16[][12] = {
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3f, 0x00, 0x1e, 0x00, 0x00, 0x00 },	// U+169A (ᚚ)
 	{ 0x00, 0x00, 0x00, 0x01, 0x02, 0x04, 0x38, 0x04, 0x02, 0x01, 0x00, 0x00 },	// U+169B (᚛)
 	{ 0x00, 0x00, 0x00, 0x00, 0x20, 0x10, 0x0f, 0x10, 0x20, 0x00, 0x00, 0x00 },	// U+169C (᚜)
-}; // 29
-
-static const unsigned char orpb_block17[][12] = {
 	{ 0x00, 0x12, 0x0a, 0x06, 0x12, 0x0a, 0x06, 0x02, 0x02, 0x02, 0x00, 0x00 },	// U+16A0 (ᚠ)
 	{ 0x08, 0x02, 0x12, 0x0a, 0x06, 0x12, 0x0a, 0x06, 0x02, 0x02, 0x00, 0x00 },	// U+16A1 (ᚡ)
 	{ 0x00, 0x01, 0x03, 0x05, 0x09, 0x11, 0x11, 0x11, 0x11, 0x11, 0x00, 0x00 },	// U+16A2 (ᚢ)
@@ -1578,18 +1530,12 @@ static const unsigned char orpb_block17[][12] = {
 	{ 0x00, 0x04, 0x0c, 0x14, 0x04, 0x06, 0x05, 0x04, 0x04, 0x04, 0x00, 0x00 },	// U+16EE (ᛮ)
 	{ 0x00, 0x15, 0x15, 0x0e, 0x04, 0x04, 0x04, 0x0e, 0x15, 0x15, 0x00, 0x00 },	// U+16EF (ᛯ)
 	{ 0x00, 0x04, 0x04, 0x0e, 0x15, 0x15, 0x15, 0x0e, 0x04, 0x04, 0x00, 0x00 },	// U+16F0 (ᛰ)
-}; // 81
-
-static const unsigned char orpb_block18[][12] = {
 	{ 0x00, 0x04, 0x00, 0x0f, 0x12, 0x12, 0x0e, 0x12, 0x12, 0x0f, 0x00, 0x00 },	// U+1E02 (Ḃ)
 	{ 0x00, 0x04, 0x00, 0x01, 0x01, 0x0f, 0x11, 0x11, 0x11, 0x0f, 0x00, 0x00 },	// U+1E03 (ḃ)
 	{ 0x00, 0x00, 0x00, 0x0f, 0x12, 0x12, 0x0e, 0x12, 0x12, 0x0f, 0x00, 0x04 },	// U+1E04 (Ḅ)
 	{ 0x00, 0x00, 0x00, 0x01, 0x01, 0x0f, 0x11, 0x11, 0x11, 0x0f, 0x00, 0x04 },	// U+1E05 (ḅ)
 	{ 0x00, 0x00, 0x00, 0x0f, 0x12, 0x12, 0x0e, 0x12, 0x12, 0x0f, 0x00, 0x1f },	// U+1E06 (Ḇ)
 	{ 0x00, 0x00, 0x00, 0x01, 0x01, 0x0f, 0x11, 0x11, 0x11, 0x0f, 0x00, 0x1f },	// U+1E07 (ḇ)
-}; // 6
-
-static const unsigned char orpb_block19[][12] = {
 	{ 0x00, 0x04, 0x00, 0x0f, 0x12, 0x12, 0x12, 0x12, 0x12, 0x0f, 0x00, 0x00 },	// U+1E0A (Ḋ)
 	{ 0x00, 0x04, 0x00, 0x10, 0x10, 0x1e, 0x11, 0x11, 0x11, 0x1e, 0x00, 0x00 },	// U+1E0B (ḋ)
 	{ 0x00, 0x00, 0x00, 0x0f, 0x12, 0x12, 0x12, 0x12, 0x12, 0x0f, 0x00, 0x04 },	// U+1E0C (Ḍ)
@@ -1600,39 +1546,24 @@ static const unsigned char orpb_block19[][12] = {
 	{ 0x00, 0x00, 0x00, 0x10, 0x10, 0x1e, 0x11, 0x11, 0x11, 0x1e, 0x04, 0x02 },	// U+1E11 (ḑ)
 	{ 0x00, 0x00, 0x0f, 0x12, 0x12, 0x12, 0x12, 0x12, 0x0f, 0x00, 0x04, 0x0a },	// U+1E12 (Ḓ)
 	{ 0x00, 0x00, 0x10, 0x10, 0x1e, 0x11, 0x11, 0x11, 0x1e, 0x00, 0x04, 0x0a },	// U+1E13 (ḓ)
-}; // 10
-
-static const unsigned char orpb_block20[][12] = {
 	{ 0x00, 0x04, 0x00, 0x1f, 0x01, 0x01, 0x0f, 0x01, 0x01, 0x01, 0x00, 0x00 },	// U+1E1E (Ḟ)
 	{ 0x00, 0x04, 0x00, 0x0c, 0x12, 0x02, 0x07, 0x02, 0x02, 0x02, 0x00, 0x00 },	// U+1E1F (ḟ)
-}; // 2
-
-static const unsigned char orpb_block21[][12] = {
 	{ 0x08, 0x04, 0x00, 0x11, 0x09, 0x05, 0x03, 0x05, 0x09, 0x11, 0x00, 0x00 },	// U+1E30 (Ḱ)
 	{ 0x00, 0x08, 0x04, 0x01, 0x01, 0x11, 0x09, 0x07, 0x09, 0x11, 0x00, 0x00 },	// U+1E31 (ḱ)
 	{ 0x00, 0x00, 0x00, 0x11, 0x09, 0x05, 0x03, 0x05, 0x09, 0x11, 0x00, 0x04 },	// U+1E32 (Ḳ)
 	{ 0x00, 0x00, 0x00, 0x01, 0x01, 0x11, 0x09, 0x07, 0x09, 0x11, 0x00, 0x04 },	// U+1E33 (ḳ)
 	{ 0x00, 0x00, 0x00, 0x11, 0x09, 0x05, 0x03, 0x05, 0x09, 0x11, 0x00, 0x1f },	// U+1E34 (Ḵ)
 	{ 0x00, 0x00, 0x00, 0x01, 0x01, 0x11, 0x09, 0x07, 0x09, 0x11, 0x00, 0x1f },	// U+1E35 (ḵ)
-}; // 6
-
-static const unsigned char orpb_block22[][12] = {
 	{ 0x08, 0x04, 0x00, 0x11, 0x1b, 0x15, 0x11, 0x11, 0x11, 0x11, 0x00, 0x00 },	// U+1E3E (Ḿ)
 	{ 0x00, 0x00, 0x08, 0x04, 0x00, 0x0b, 0x15, 0x15, 0x15, 0x15, 0x00, 0x00 },	// U+1E3F (ḿ)
 	{ 0x00, 0x04, 0x00, 0x11, 0x1b, 0x15, 0x11, 0x11, 0x11, 0x11, 0x00, 0x00 },	// U+1E40 (Ṁ)
 	{ 0x00, 0x00, 0x00, 0x04, 0x00, 0x0b, 0x15, 0x15, 0x15, 0x15, 0x00, 0x00 },	// U+1E41 (ṁ)
 	{ 0x00, 0x00, 0x00, 0x11, 0x1b, 0x15, 0x11, 0x11, 0x11, 0x11, 0x00, 0x04 },	// U+1E42 (Ṃ)
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x0b, 0x15, 0x15, 0x15, 0x15, 0x00, 0x04 },	// U+1E43 (ṃ)
-}; // 6
-
-static const unsigned char orpb_block23[][12] = {
 	{ 0x08, 0x04, 0x00, 0x0f, 0x11, 0x11, 0x0f, 0x01, 0x01, 0x01, 0x00, 0x00 },	// U+1E54 (Ṕ)
 	{ 0x00, 0x00, 0x08, 0x04, 0x00, 0x0f, 0x11, 0x11, 0x11, 0x0f, 0x01, 0x01 },	// U+1E55 (ṕ)
 	{ 0x00, 0x04, 0x00, 0x0f, 0x11, 0x11, 0x0f, 0x01, 0x01, 0x01, 0x00, 0x00 },	// U+1E56 (Ṗ)
 	{ 0x00, 0x00, 0x00, 0x04, 0x00, 0x0f, 0x11, 0x11, 0x11, 0x0f, 0x01, 0x01 },	// U+1E57 (ṗ)
-}; // 4
-
-static const unsigned char orpb_block24[][12] = {
 	{ 0x00, 0x04, 0x00, 0x0e, 0x11, 0x01, 0x0e, 0x10, 0x11, 0x0e, 0x00, 0x00 },	// U+1E60 (Ṡ)
 	{ 0x00, 0x00, 0x00, 0x04, 0x00, 0x1e, 0x01, 0x0e, 0x10, 0x0f, 0x00, 0x00 },	// U+1E61 (ṡ)
 	{ 0x00, 0x00, 0x00, 0x0e, 0x11, 0x01, 0x0e, 0x10, 0x11, 0x0e, 0x00, 0x04 },	// U+1E62 (Ṣ)
@@ -1651,9 +1582,6 @@ static const unsigned char orpb_block24[][12] = {
 	{ 0x00, 0x00, 0x00, 0x04, 0x04, 0x1f, 0x04, 0x04, 0x04, 0x18, 0x00, 0x1f },	// U+1E6F (ṯ)
 	{ 0x00, 0x00, 0x00, 0x1f, 0x04, 0x04, 0x04, 0x04, 0x04, 0x00, 0x04, 0x0a },	// U+1E70 (Ṱ)
 	{ 0x00, 0x00, 0x00, 0x04, 0x04, 0x1f, 0x04, 0x04, 0x18, 0x00, 0x04, 0x0a },	// U+1E71 (ṱ)
-}; // 18
-
-static const unsigned char orpb_block25[][12] = {
 	{ 0x02, 0x04, 0x00, 0x11, 0x11, 0x11, 0x11, 0x15, 0x15, 0x0a, 0x00, 0x00 },	// U+1E80 (Ẁ)
 	{ 0x00, 0x00, 0x02, 0x04, 0x00, 0x11, 0x11, 0x15, 0x15, 0x0a, 0x00, 0x00 },	// U+1E81 (ẁ)
 	{ 0x08, 0x04, 0x00, 0x11, 0x11, 0x11, 0x11, 0x15, 0x15, 0x0a, 0x00, 0x00 },	// U+1E82 (Ẃ)
@@ -1670,9 +1598,6 @@ static const unsigned char orpb_block25[][12] = {
 	{ 0x00, 0x00, 0x00, 0x0a, 0x00, 0x11, 0x0a, 0x04, 0x0a, 0x11, 0x00, 0x00 },	// U+1E8D (ẍ)
 	{ 0x00, 0x04, 0x00, 0x11, 0x11, 0x0a, 0x04, 0x04, 0x04, 0x04, 0x00, 0x00 },	// U+1E8E (Ẏ)
 	{ 0x00, 0x00, 0x00, 0x04, 0x00, 0x11, 0x11, 0x11, 0x0a, 0x04, 0x02, 0x01 },	// U+1E8F (ẏ)
-}; // 16
-
-static const unsigned char orpb_block26[][12] = {
 	{ 0x02, 0x04, 0x00, 0x11, 0x11, 0x0a, 0x04, 0x04, 0x04, 0x04, 0x00, 0x00 },	// U+1EF2 (Ỳ)
 	{ 0x00, 0x00, 0x02, 0x04, 0x00, 0x11, 0x11, 0x11, 0x0a, 0x04, 0x02, 0x01 },	// U+1EF3 (ỳ)
 	{ 0x00, 0x00, 0x00, 0x11, 0x11, 0x0a, 0x04, 0x04, 0x04, 0x04, 0x00, 0x04 },	// U+1EF4 (Ỵ)
@@ -1681,9 +1606,6 @@ static const unsigned char orpb_block26[][12] = {
 	{ 0x04, 0x0a, 0x08, 0x04, 0x04, 0x11, 0x11, 0x11, 0x0a, 0x04, 0x02, 0x01 },	// U+1EF7 (ỷ)
 	{ 0x16, 0x0d, 0x00, 0x11, 0x11, 0x0a, 0x04, 0x04, 0x04, 0x04, 0x00, 0x00 },	// U+1EF8 (Ỹ)
 	{ 0x00, 0x00, 0x16, 0x0d, 0x00, 0x11, 0x11, 0x11, 0x0a, 0x04, 0x02, 0x01 },	// U+1EF9 (ỹ)
-}; // 8
-
-static const unsigned char orpb_block27[][12] = {
 	{ 0x00, 0x00, 0x06, 0x04, 0x00, 0x16, 0x09, 0x09, 0x09, 0x16, 0x00, 0x00 },	// U+1F00 (ἀ)
 	{ 0x00, 0x00, 0x0c, 0x04, 0x00, 0x16, 0x09, 0x09, 0x09, 0x16, 0x00, 0x00 },	// U+1F01 (ἁ)
 	{ 0x00, 0x00, 0x0b, 0x12, 0x00, 0x16, 0x09, 0x09, 0x09, 0x16, 0x00, 0x00 },	// U+1F02 (ἂ)
@@ -1706,18 +1628,12 @@ static const unsigned char orpb_block27[][12] = {
 	{ 0x00, 0x00, 0x0b, 0x11, 0x00, 0x0e, 0x11, 0x06, 0x11, 0x0e, 0x00, 0x00 },	// U+1F13 (ἓ)
 	{ 0x00, 0x00, 0x13, 0x0a, 0x00, 0x0e, 0x11, 0x06, 0x11, 0x0e, 0x00, 0x00 },	// U+1F14 (ἔ)
 	{ 0x00, 0x00, 0x13, 0x09, 0x00, 0x0e, 0x11, 0x06, 0x11, 0x0e, 0x00, 0x00 },	// U+1F15 (ἕ)
-}; // 22
-
-static const unsigned char orpb_block28[][12] = {
 	{ 0x03, 0x02, 0x00, 0x1f, 0x01, 0x01, 0x0f, 0x01, 0x01, 0x1f, 0x00, 0x00 },	// U+1F18 (Ἐ)
 	{ 0x03, 0x01, 0x00, 0x1f, 0x01, 0x01, 0x0f, 0x01, 0x01, 0x1f, 0x00, 0x00 },	// U+1F19 (Ἑ)
 	{ 0x0b, 0x12, 0x00, 0x1f, 0x01, 0x01, 0x0f, 0x01, 0x01, 0x1f, 0x00, 0x00 },	// U+1F1A (Ἒ)
 	{ 0x0b, 0x11, 0x00, 0x1f, 0x01, 0x01, 0x0f, 0x01, 0x01, 0x1f, 0x00, 0x00 },	// U+1F1B (Ἓ)
 	{ 0x13, 0x0a, 0x00, 0x1f, 0x01, 0x01, 0x0f, 0x01, 0x01, 0x1f, 0x00, 0x00 },	// U+1F1C (Ἔ)
 	{ 0x13, 0x09, 0x00, 0x1f, 0x01, 0x01, 0x0f, 0x01, 0x01, 0x1f, 0x00, 0x00 },	// U+1F1D (Ἕ)
-}; // 6
-
-static const unsigned char orpb_block29[][12] = {
 	{ 0x00, 0x00, 0x06, 0x04, 0x00, 0x0d, 0x13, 0x11, 0x11, 0x11, 0x10, 0x10 },	// U+1F20 (ἠ)
 	{ 0x00, 0x00, 0x0c, 0x04, 0x00, 0x0d, 0x13, 0x11, 0x11, 0x11, 0x10, 0x10 },	// U+1F21 (ἡ)
 	{ 0x00, 0x00, 0x0b, 0x12, 0x00, 0x0d, 0x13, 0x11, 0x11, 0x11, 0x10, 0x10 },	// U+1F22 (ἢ)
@@ -1756,18 +1672,12 @@ static const unsigned char orpb_block29[][12] = {
 	{ 0x00, 0x00, 0x0b, 0x11, 0x00, 0x0e, 0x11, 0x11, 0x11, 0x0e, 0x00, 0x00 },	// U+1F43 (ὃ)
 	{ 0x00, 0x00, 0x13, 0x0a, 0x00, 0x0e, 0x11, 0x11, 0x11, 0x0e, 0x00, 0x00 },	// U+1F44 (ὄ)
 	{ 0x00, 0x00, 0x13, 0x09, 0x00, 0x0e, 0x11, 0x11, 0x11, 0x0e, 0x00, 0x00 },	// U+1F45 (ὅ)
-}; // 38
-
-static const unsigned char orpb_block30[][12] = {
 	{ 0x03, 0x02, 0x00, 0x0e, 0x11, 0x11, 0x11, 0x11, 0x11, 0x0e, 0x00, 0x00 },	// U+1F48 (Ὀ)
 	{ 0x03, 0x01, 0x00, 0x0e, 0x11, 0x11, 0x11, 0x11, 0x11, 0x0e, 0x00, 0x00 },	// U+1F49 (Ὁ)
 	{ 0x0b, 0x12, 0x00, 0x0e, 0x11, 0x11, 0x11, 0x11, 0x11, 0x0e, 0x00, 0x00 },	// U+1F4A (Ὂ)
 	{ 0x0b, 0x11, 0x00, 0x0e, 0x11, 0x11, 0x11, 0x11, 0x11, 0x0e, 0x00, 0x00 },	// U+1F4B (Ὃ)
 	{ 0x13, 0x0a, 0x00, 0x0e, 0x11, 0x11, 0x11, 0x11, 0x11, 0x0e, 0x00, 0x00 },	// U+1F4C (Ὄ)
 	{ 0x13, 0x09, 0x00, 0x0e, 0x11, 0x11, 0x11, 0x11, 0x11, 0x0e, 0x00, 0x00 },	// U+1F4D (Ὅ)
-}; // 6
-
-static const unsigned char orpb_block31[][12] = {
 	{ 0x00, 0x00, 0x06, 0x04, 0x00, 0x09, 0x11, 0x11, 0x11, 0x0e, 0x00, 0x00 },	// U+1F50 (ὐ)
 	{ 0x00, 0x00, 0x0c, 0x04, 0x00, 0x09, 0x11, 0x11, 0x11, 0x0e, 0x00, 0x00 },	// U+1F51 (ὑ)
 	{ 0x00, 0x00, 0x0b, 0x12, 0x00, 0x09, 0x11, 0x11, 0x11, 0x0e, 0x00, 0x00 },	// U+1F52 (ὒ)
@@ -1776,21 +1686,9 @@ static const unsigned char orpb_block31[][12] = {
 	{ 0x00, 0x00, 0x13, 0x09, 0x00, 0x09, 0x11, 0x11, 0x11, 0x0e, 0x00, 0x00 },	// U+1F55 (ὕ)
 	{ 0x16, 0x0d, 0x00, 0x0c, 0x08, 0x00, 0x09, 0x11, 0x11, 0x0e, 0x00, 0x00 },	// U+1F56 (ὖ)
 	{ 0x16, 0x0d, 0x00, 0x0c, 0x04, 0x00, 0x09, 0x11, 0x11, 0x0e, 0x00, 0x00 },	// U+1F57 (ὗ)
-}; // 8
-
-static const unsigned char orpb_block32[][12] = {
 	{ 0x03, 0x01, 0x00, 0x11, 0x11, 0x0a, 0x04, 0x04, 0x04, 0x04, 0x00, 0x00 },	// U+1F59 (Ὑ)
-}; // 1
-
-static const unsigned char orpb_block33[][12] = {
 	{ 0x0b, 0x11, 0x00, 0x11, 0x11, 0x0a, 0x04, 0x04, 0x04, 0x04, 0x00, 0x00 },	// U+1F5B (Ὓ)
-}; // 1
-
-static const unsigned char orpb_block34[][12] = {
 	{ 0x13, 0x09, 0x00, 0x11, 0x11, 0x0a, 0x04, 0x04, 0x04, 0x04, 0x00, 0x00 },	// U+1F5D (Ὕ)
-}; // 1
-
-static const unsigned char orpb_block35[][12] = {
 	{ 0x16, 0x0d, 0x00, 0x03, 0x2a, 0x28, 0x28, 0x10, 0x10, 0x10, 0x00, 0x00 },	// U+1F5F (Ὗ)
 	{ 0x00, 0x00, 0x06, 0x04, 0x00, 0x0a, 0x11, 0x15, 0x15, 0x0a, 0x00, 0x00 },	// U+1F60 (ὠ)
 	{ 0x00, 0x00, 0x0c, 0x04, 0x00, 0x0a, 0x11, 0x15, 0x15, 0x0a, 0x00, 0x00 },	// U+1F61 (ὡ)
@@ -1822,9 +1720,6 @@ static const unsigned char orpb_block35[][12] = {
 	{ 0x00, 0x00, 0x08, 0x04, 0x00, 0x09, 0x11, 0x11, 0x11, 0x0e, 0x00, 0x00 },	// U+1F7B (ύ)
 	{ 0x00, 0x00, 0x04, 0x08, 0x00, 0x0a, 0x11, 0x15, 0x15, 0x0a, 0x00, 0x00 },	// U+1F7C (ὼ)
 	{ 0x00, 0x00, 0x08, 0x04, 0x00, 0x0a, 0x11, 0x15, 0x15, 0x0a, 0x00, 0x00 },	// U+1F7D (ώ)
-}; // 31
-
-static const unsigned char orpb_block36[][12] = {
 	{ 0x00, 0x06, 0x04, 0x00, 0x16, 0x09, 0x09, 0x09, 0x16, 0x00, 0x04, 0x08 },	// U+1F80 (ᾀ)
 	{ 0x00, 0x0c, 0x04, 0x00, 0x16, 0x09, 0x09, 0x09, 0x16, 0x00, 0x04, 0x08 },	// U+1F81 (ᾁ)
 	{ 0x00, 0x0b, 0x12, 0x00, 0x16, 0x09, 0x09, 0x09, 0x16, 0x00, 0x04, 0x08 },	// U+1F82 (ᾂ)
@@ -1878,9 +1773,6 @@ static const unsigned char orpb_block36[][12] = {
 	{ 0x00, 0x02, 0x04, 0x00, 0x16, 0x09, 0x09, 0x09, 0x16, 0x00, 0x04, 0x08 },	// U+1FB2 (ᾲ)
 	{ 0x00, 0x00, 0x00, 0x00, 0x16, 0x09, 0x09, 0x09, 0x16, 0x00, 0x04, 0x08 },	// U+1FB3 (ᾳ)
 	{ 0x00, 0x08, 0x04, 0x00, 0x16, 0x09, 0x09, 0x09, 0x16, 0x00, 0x04, 0x08 },	// U+1FB4 (ᾴ)
-}; // 53
-
-static const unsigned char orpb_block37[][12] = {
 	{ 0x00, 0x00, 0x16, 0x0d, 0x00, 0x16, 0x09, 0x09, 0x09, 0x16, 0x00, 0x00 },	// U+1FB6 (ᾶ)
 	{ 0x00, 0x16, 0x0d, 0x00, 0x16, 0x09, 0x09, 0x09, 0x16, 0x00, 0x04, 0x08 },	// U+1FB7 (ᾷ)
 	{ 0x11, 0x0e, 0x00, 0x0e, 0x11, 0x11, 0x1f, 0x11, 0x11, 0x11, 0x00, 0x00 },	// U+1FB8 (Ᾰ)
@@ -1896,9 +1788,6 @@ static const unsigned char orpb_block37[][12] = {
 	{ 0x00, 0x02, 0x04, 0x00, 0x0d, 0x13, 0x11, 0x11, 0x11, 0x10, 0x11, 0x02 },	// U+1FC2 (ῂ)
 	{ 0x00, 0x00, 0x00, 0x00, 0x0d, 0x13, 0x11, 0x11, 0x11, 0x10, 0x11, 0x02 },	// U+1FC3 (ῃ)
 	{ 0x00, 0x08, 0x04, 0x00, 0x0d, 0x13, 0x11, 0x11, 0x11, 0x10, 0x11, 0x02 },	// U+1FC4 (ῄ)
-}; // 15
-
-static const unsigned char orpb_block38[][12] = {
 	{ 0x00, 0x00, 0x16, 0x0d, 0x00, 0x0d, 0x13, 0x11, 0x11, 0x11, 0x10, 0x10 },	// U+1FC6 (ῆ)
 	{ 0x00, 0x16, 0x0d, 0x00, 0x0d, 0x13, 0x11, 0x11, 0x11, 0x10, 0x11, 0x02 },	// U+1FC7 (ῇ)
 	{ 0x01, 0x02, 0x00, 0x1f, 0x01, 0x01, 0x0f, 0x01, 0x01, 0x1f, 0x00, 0x00 },	// U+1FC8 (Ὲ)
@@ -1913,18 +1802,12 @@ static const unsigned char orpb_block38[][12] = {
 	{ 0x00, 0x00, 0x00, 0x1f, 0x00, 0x02, 0x02, 0x02, 0x0a, 0x04, 0x00, 0x00 },	// U+1FD1 (ῑ)
 	{ 0x02, 0x04, 0x00, 0x0a, 0x00, 0x04, 0x04, 0x04, 0x14, 0x08, 0x00, 0x00 },	// U+1FD2 (ῒ)
 	{ 0x02, 0x04, 0x00, 0x0a, 0x00, 0x04, 0x04, 0x04, 0x14, 0x08, 0x00, 0x00 },	// U+1FD3 (ΐ)
-}; // 14
-
-static const unsigned char orpb_block39[][12] = {
 	{ 0x00, 0x00, 0x16, 0x0d, 0x00, 0x04, 0x04, 0x04, 0x14, 0x08, 0x00, 0x00 },	// U+1FD6 (ῖ)
 	{ 0x16, 0x0d, 0x00, 0x0a, 0x00, 0x04, 0x04, 0x04, 0x14, 0x08, 0x00, 0x00 },	// U+1FD7 (ῗ)
 	{ 0x11, 0x0e, 0x00, 0x0e, 0x04, 0x04, 0x04, 0x04, 0x04, 0x0e, 0x00, 0x00 },	// U+1FD8 (Ῐ)
 	{ 0x00, 0x1f, 0x00, 0x0e, 0x04, 0x04, 0x04, 0x04, 0x04, 0x0e, 0x00, 0x00 },	// U+1FD9 (Ῑ)
 	{ 0x01, 0x02, 0x00, 0x0e, 0x04, 0x04, 0x04, 0x04, 0x04, 0x0e, 0x00, 0x00 },	// U+1FDA (Ὶ)
 	{ 0x02, 0x01, 0x00, 0x0e, 0x04, 0x04, 0x04, 0x04, 0x04, 0x0e, 0x00, 0x00 },	// U+1FDB (Ί)
-}; // 6
-
-static const unsigned char orpb_block40[][12] = {
 	{ 0x00, 0x00, 0x0b, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+1FDD (῝)
 	{ 0x00, 0x00, 0x13, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+1FDE (῞)
 	{ 0x16, 0x0d, 0x00, 0x0c, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+1FDF (῟)
@@ -1944,15 +1827,9 @@ static const unsigned char orpb_block40[][12] = {
 	{ 0x02, 0x04, 0x00, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+1FED (῭)
 	{ 0x08, 0x04, 0x00, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+1FEE (΅)
 	{ 0x00, 0x00, 0x02, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+1FEF (`)
-}; // 19
-
-static const unsigned char orpb_block41[][12] = {
 	{ 0x00, 0x02, 0x04, 0x00, 0x0a, 0x11, 0x15, 0x15, 0x0a, 0x00, 0x04, 0x08 },	// U+1FF2 (ῲ)
 	{ 0x00, 0x00, 0x00, 0x00, 0x0a, 0x11, 0x15, 0x15, 0x0a, 0x00, 0x04, 0x08 },	// U+1FF3 (ῳ)
 	{ 0x00, 0x08, 0x04, 0x00, 0x0a, 0x11, 0x15, 0x15, 0x0a, 0x00, 0x04, 0x08 },	// U+1FF4 (ῴ)
-}; // 3
-
-static const unsigned char orpb_block42[][12] = {
 	{ 0x00, 0x00, 0x16, 0x0d, 0x00, 0x0a, 0x11, 0x15, 0x15, 0x0a, 0x00, 0x00 },	// U+1FF6 (ῶ)
 	{ 0x00, 0x16, 0x0d, 0x00, 0x0a, 0x11, 0x15, 0x15, 0x0a, 0x00, 0x04, 0x08 },	// U+1FF7 (ῷ)
 	{ 0x11, 0x0e, 0x00, 0x0e, 0x11, 0x11, 0x11, 0x11, 0x11, 0x0e, 0x00, 0x00 },	// U+1FF8 (Ὸ)
@@ -1962,9 +1839,6 @@ static const unsigned char orpb_block42[][12] = {
 	{ 0x00, 0x00, 0x00, 0x0e, 0x11, 0x11, 0x11, 0x11, 0x0a, 0x1b, 0x04, 0x08 },	// U+1FFC (ῼ)
 	{ 0x00, 0x00, 0x08, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+1FFD (´)
 	{ 0x00, 0x00, 0x0c, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+1FFE (῾)
-}; // 9
-
-static const unsigned char orpb_block43[][12] = {
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0e, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+2010 (‐)
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0e, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+2011 (‑)
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+2012 (‒)
@@ -1989,9 +1863,6 @@ static const unsigned char orpb_block43[][12] = {
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x00 },	// U+2025 (‥)
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x00, 0x00 },	// U+2026 (…)
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+2027 (‧)
-}; // 24
-
-static const unsigned char orpb_block44[][12] = {
 	{ 0x00, 0x00, 0x00, 0x12, 0x15, 0x0a, 0x04, 0x16, 0x2b, 0x15, 0x00, 0x00 },	// U+2030 (‰)
 	{ 0x00, 0x00, 0x00, 0x12, 0x15, 0x1a, 0x2c, 0x16, 0x2b, 0x15, 0x00, 0x00 },	// U+2031 (‱)
 	{ 0x00, 0x00, 0x00, 0x04, 0x04, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+2032 (′)
@@ -2039,14 +1910,8 @@ static const unsigned char orpb_block44[][12] = {
 	{ 0x00, 0x00, 0x00, 0x15, 0x04, 0x1f, 0x04, 0x15, 0x00, 0x00, 0x00, 0x00 },	// U+205C (⁜)
 	{ 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x04, 0x00, 0x00, 0x04, 0x00, 0x00 },	// U+205D (⁝)
 	{ 0x00, 0x00, 0x00, 0x04, 0x00, 0x04, 0x00, 0x04, 0x00, 0x04, 0x00, 0x00 },	// U+205E (⁞)
-}; // 47
-
-static const unsigned char orpb_block45[][12] = {
 	{ 0x04, 0x0a, 0x0a, 0x0a, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+2070 (⁰)
 	{ 0x04, 0x00, 0x06, 0x04, 0x0e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+2071 (ⁱ)
-}; // 2
-
-static const unsigned char orpb_block46[][12] = {
 	{ 0x02, 0x02, 0x0a, 0x0e, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+2074 (⁴)
 	{ 0x0e, 0x02, 0x06, 0x08, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+2075 (⁵)
 	{ 0x0c, 0x02, 0x06, 0x0a, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+2076 (⁶)
@@ -2074,17 +1939,11 @@ static const unsigned char orpb_block46[][12] = {
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0e, 0x00, 0x0e, 0x00 },	// U+208C (₌)
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x02, 0x02, 0x02, 0x04 },	// U+208D (₍)
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x04, 0x04, 0x04, 0x02 },	// U+208E (₎)
-}; // 27
-
-static const unsigned char orpb_block47[][12] = {
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x04, 0x06, 0x05, 0x06, 0x00 },	// U+2090 (ₐ)
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x05, 0x07, 0x01, 0x06 },	// U+2091 (ₑ)
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x09, 0x09, 0x06 },	// U+2092 (ₒ)
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x02, 0x05 },	// U+2093 (ₓ)
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x04, 0x07, 0x05, 0x02 },	// U+2094 (ₔ)
-}; // 5
-
-static const unsigned char orpb_block48[][12] = {
 	{ 0x00, 0x00, 0x00, 0x06, 0x01, 0x1d, 0x05, 0x0e, 0x04, 0x1c, 0x00, 0x00 },	// U+20A0 (₠)
 	{ 0x00, 0x00, 0x00, 0x1e, 0x15, 0x15, 0x0b, 0x0b, 0x1b, 0x0e, 0x00, 0x00 },	// U+20A1 (₡)
 	{ 0x00, 0x00, 0x00, 0x0e, 0x11, 0x01, 0x0d, 0x05, 0x15, 0x0e, 0x00, 0x00 },	// U+20A2 (₢)
@@ -2107,9 +1966,6 @@ static const unsigned char orpb_block48[][12] = {
 	{ 0x00, 0x00, 0x00, 0x0e, 0x11, 0x1f, 0x11, 0x1f, 0x11, 0x11, 0x00, 0x00 },	// U+20B3 (₳)
 	{ 0x00, 0x00, 0x00, 0x06, 0x08, 0x1f, 0x04, 0x1f, 0x02, 0x0c, 0x00, 0x00 },	// U+20B4 (₴)
 	{ 0x00, 0x00, 0x04, 0x0e, 0x15, 0x05, 0x05, 0x05, 0x15, 0x0e, 0x04, 0x00 },	// U+20B5 (₵)
-}; // 22
-
-static const unsigned char orpb_block49[][12] = {
 	{ 0x04, 0x02, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+20D0 (⃐)
 	{ 0x04, 0x08, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+20D1 (⃑)
 	{ 0x00, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x00 },	// U+20D2 (⃒)
@@ -2143,9 +1999,6 @@ static const unsigned char orpb_block49[][12] = {
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x1f, 0x02 },	// U+20EE (⃮)
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x1f, 0x08 },	// U+20EF (⃯)
 	{ 0x05, 0x02, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+20F0 (⃰)
-}; // 33
-
-static const unsigned char orpb_block50[][12] = {
 	{ 0x00, 0x16, 0x15, 0x0e, 0x08, 0x04, 0x02, 0x1a, 0x05, 0x19, 0x00, 0x00 },	// U+2100 (℀)
 	{ 0x00, 0x16, 0x15, 0x0e, 0x08, 0x04, 0x1a, 0x06, 0x09, 0x11, 0x0c, 0x00 },	// U+2101 (℁)
 	{ 0x00, 0x00, 0x00, 0x0e, 0x15, 0x05, 0x05, 0x05, 0x15, 0x0e, 0x00, 0x00 },	// U+2102 (ℂ)
@@ -2226,9 +2079,6 @@ static const unsigned char orpb_block50[][12] = {
 	{ 0x02, 0x15, 0x17, 0x0d, 0x08, 0x04, 0x12, 0x0a, 0x11, 0x09, 0x00, 0x00 },	// U+214D (⅍)
 	{ 0x00, 0x00, 0x00, 0x00, 0x10, 0x10, 0x10, 0x1c, 0x10, 0x1e, 0x00, 0x00 },	// U+214E (ⅎ)
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x0e, 0x0e, 0x0e, 0x15, 0x00, 0x00, 0x00 },	// U+214F (⅏)
-}; // 80
-
-static const unsigned char orpb_block51[][12] = {
 	{ 0x02, 0x12, 0x12, 0x0a, 0x08, 0x1c, 0x22, 0x12, 0x21, 0x19, 0x00, 0x00 },	// U+2153 (⅓)
 	{ 0x02, 0x15, 0x12, 0x0f, 0x08, 0x1c, 0x22, 0x12, 0x21, 0x19, 0x00, 0x00 },	// U+2154 (⅔)
 	{ 0x02, 0x12, 0x12, 0x0a, 0x08, 0x04, 0x1a, 0x0a, 0x11, 0x09, 0x00, 0x00 },	// U+2155 (⅕)
@@ -2283,9 +2133,6 @@ static const unsigned char orpb_block51[][12] = {
 	{ 0x00, 0x00, 0x00, 0x04, 0x04, 0x04, 0x04, 0x15, 0x0e, 0x04, 0x00, 0x00 },	// U+2186 (ↆ)
 	{ 0x00, 0x00, 0x00, 0x1f, 0x3f, 0x3f, 0x39, 0x3f, 0x3f, 0x1f, 0x00, 0x00 },	// U+2187 (ↇ)
 	{ 0x00, 0x00, 0x00, 0x0e, 0x1f, 0x1f, 0x15, 0x1f, 0x1f, 0x0e, 0x00, 0x00 },	// U+2188 (ↈ)
-}; // 54
-
-static const unsigned char orpb_block52[][12] = {
 	{ 0x00, 0x00, 0x00, 0x00, 0x04, 0x02, 0x1f, 0x02, 0x04, 0x00, 0x00, 0x00 },	// U+2190 (←)
 	{ 0x00, 0x00, 0x00, 0x04, 0x0e, 0x15, 0x04, 0x04, 0x04, 0x04, 0x00, 0x00 },	// U+2191 (↑)
 	{ 0x00, 0x00, 0x00, 0x00, 0x04, 0x08, 0x1f, 0x08, 0x04, 0x00, 0x00, 0x00 },	// U+2192 (→)
@@ -2695,9 +2542,6 @@ static const unsigned char orpb_block52[][12] = {
 	{ 0x00, 0x00, 0x00, 0x00, 0x0f, 0x1b, 0x25, 0x1b, 0x0f, 0x00, 0x00, 0x00 },	// U+2326 (⌦)
 	{ 0x00, 0x00, 0x00, 0x00, 0x1f, 0x1b, 0x15, 0x1b, 0x1f, 0x00, 0x00, 0x00 },	// U+2327 (⌧)
 	{ 0x3f, 0x21, 0x35, 0x21, 0x35, 0x21, 0x35, 0x21, 0x35, 0x21, 0x3f, 0x00 },	// U+2328 (⌨)
-}; // 409
-
-static const unsigned char orpb_block53[][12] = {
 	{ 0x00, 0x00, 0x00, 0x00, 0x3c, 0x36, 0x29, 0x36, 0x3c, 0x00, 0x00, 0x00 },	// U+232B (⌫)
 	{ 0x00, 0x00, 0x00, 0x04, 0x0e, 0x1b, 0x13, 0x1b, 0x0e, 0x04, 0x00, 0x00 },	// U+232C (⌬)
 	{ 0x00, 0x00, 0x00, 0x08, 0x04, 0x06, 0x1b, 0x0c, 0x04, 0x02, 0x00, 0x00 },	// U+232D (⌭)
@@ -2887,9 +2731,6 @@ static const unsigned char orpb_block53[][12] = {
 	{ 0x00, 0x00, 0x00, 0x00, 0x3e, 0x22, 0x11, 0x1f, 0x00, 0x00, 0x00, 0x00 },	// U+23E5 (⏥)
 	{ 0x00, 0x00, 0x00, 0x00, 0x02, 0x05, 0x3f, 0x28, 0x10, 0x00, 0x00, 0x00 },	// U+23E6 (⏦)
 	{ 0x00, 0x00, 0x00, 0x05, 0x25, 0x15, 0x0d, 0x0c, 0x12, 0x21, 0x00, 0x00 },	// U+23E7 (⏧)
-}; // 189
-
-static const unsigned char orpb_block54[][12] = {
 	{ 0x09, 0x0b, 0x0d, 0x09, 0x0a, 0x0a, 0x0e, 0x04, 0x04, 0x04, 0x1c, 0x00 },	// U+2400 (␀)
 	{ 0x06, 0x01, 0x02, 0x04, 0x07, 0x0a, 0x0a, 0x04, 0x14, 0x1c, 0x14, 0x00 },	// U+2401 (␁)
 	{ 0x06, 0x01, 0x02, 0x04, 0x03, 0x0e, 0x04, 0x04, 0x14, 0x08, 0x14, 0x00 },	// U+2402 (␂)
@@ -2929,9 +2770,6 @@ static const unsigned char orpb_block54[][12] = {
 	{ 0x00, 0x00, 0x09, 0x0b, 0x0d, 0x09, 0x0d, 0x04, 0x04, 0x1c, 0x00, 0x00 },	// U+2424 (␤)
 	{ 0x00, 0x00, 0x12, 0x12, 0x09, 0x05, 0x14, 0x12, 0x09, 0x09, 0x00, 0x00 },	// U+2425 (␥)
 	{ 0x00, 0x00, 0x0e, 0x11, 0x01, 0x02, 0x04, 0x04, 0x00, 0x04, 0x00, 0x00 },	// U+2426 (␦)
-}; // 39
-
-static const unsigned char orpb_block55[][12] = {
 	{ 0x00, 0x00, 0x1c, 0x14, 0x14, 0x04, 0x04, 0x05, 0x05, 0x07, 0x00, 0x00 },	// U+2440 (⑀)
 	{ 0x00, 0x00, 0x10, 0x10, 0x10, 0x10, 0x1f, 0x11, 0x11, 0x11, 0x00, 0x00 },	// U+2441 (⑁)
 	{ 0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x1f, 0x04, 0x04, 0x04, 0x00, 0x00 },	// U+2442 (⑂)
@@ -2943,9 +2781,6 @@ static const unsigned char orpb_block55[][12] = {
 	{ 0x00, 0x00, 0x00, 0x30, 0x35, 0x35, 0x35, 0x05, 0x05, 0x00, 0x00, 0x00 },	// U+2448 (⑈)
 	{ 0x00, 0x00, 0x00, 0x00, 0x15, 0x15, 0x15, 0x15, 0x00, 0x00, 0x00, 0x00 },	// U+2449 (⑉)
 	{ 0x00, 0x00, 0x05, 0x05, 0x0a, 0x0a, 0x14, 0x14, 0x28, 0x28, 0x00, 0x00 },	// U+244A (⑊)
-}; // 11
-
-static const unsigned char orpb_block56[][12] = {
 	{ 0x00, 0x0e, 0x11, 0x15, 0x17, 0x15, 0x15, 0x1f, 0x11, 0x0e, 0x00, 0x00 },	// U+2460 (①)
 	{ 0x00, 0x0e, 0x11, 0x15, 0x1b, 0x19, 0x15, 0x1f, 0x11, 0x0e, 0x00, 0x00 },	// U+2461 (②)
 	{ 0x00, 0x0e, 0x11, 0x17, 0x19, 0x15, 0x19, 0x17, 0x11, 0x0e, 0x00, 0x00 },	// U+2462 (③)
@@ -3382,14 +3217,8 @@ static const unsigned char orpb_block56[][12] = {
 	{ 0x00, 0x3f, 0x21, 0x31, 0x31, 0x29, 0x29, 0x2b, 0x25, 0x3f, 0x00, 0x00 },	// U+2611 (☑)
 	{ 0x00, 0x3f, 0x33, 0x33, 0x2d, 0x2d, 0x2d, 0x33, 0x33, 0x3f, 0x00, 0x00 },	// U+2612 (☒)
 	{ 0x00, 0x11, 0x11, 0x0a, 0x0a, 0x04, 0x0a, 0x0a, 0x11, 0x11, 0x00, 0x00 },	// U+2613 (☓)
-}; // 436
-
-static const unsigned char orpb_block57[][12] = {
 	{ 0x00, 0x00, 0x04, 0x0a, 0x11, 0x11, 0x11, 0x11, 0x11, 0x1f, 0x00, 0x00 },	// U+2616 (☖)
 	{ 0x00, 0x00, 0x04, 0x0e, 0x1f, 0x1f, 0x1f, 0x1f, 0x1f, 0x1f, 0x00, 0x00 },	// U+2617 (☗)
-}; // 2
-
-static const unsigned char orpb_block58[][12] = {
 	{ 0x00, 0x00, 0x10, 0x24, 0x2e, 0x1f, 0x17, 0x2f, 0x2e, 0x14, 0x00, 0x00 },	// U+2619 (☙)
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x3f, 0x3e, 0x3e, 0x3c, 0x00, 0x00, 0x00 },	// U+261A (☚)
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x3f, 0x1f, 0x1f, 0x0f, 0x00, 0x00, 0x00 },	// U+261B (☛)
@@ -3522,9 +3351,6 @@ static const unsigned char orpb_block58[][12] = {
 	{ 0x00, 0x04, 0x0a, 0x04, 0x15, 0x1f, 0x04, 0x04, 0x04, 0x04, 0x00, 0x00 },	// U+269A (⚚)
 	{ 0x00, 0x00, 0x00, 0x15, 0x0e, 0x1b, 0x0e, 0x1b, 0x0e, 0x15, 0x00, 0x00 },	// U+269B (⚛)
 	{ 0x00, 0x00, 0x04, 0x0a, 0x1b, 0x11, 0x15, 0x0a, 0x0a, 0x04, 0x00, 0x00 },	// U+269C (⚜)
-}; // 132
-
-static const unsigned char orpb_block59[][12] = {
 	{ 0x00, 0x04, 0x0a, 0x11, 0x15, 0x15, 0x11, 0x15, 0x11, 0x1f, 0x00, 0x00 },	// U+26A0 (⚠)
 	{ 0x00, 0x00, 0x00, 0x10, 0x08, 0x04, 0x1e, 0x08, 0x04, 0x02, 0x00, 0x00 },	// U+26A1 (⚡)
 	{ 0x00, 0x00, 0x00, 0x00, 0x0e, 0x15, 0x15, 0x0e, 0x0a, 0x1f, 0x0a, 0x00 },	// U+26A2 (⚢)
@@ -3554,30 +3380,18 @@ static const unsigned char orpb_block59[][12] = {
 	{ 0x00, 0x00, 0x00, 0x00, 0x11, 0x11, 0x0a, 0x0a, 0x04, 0x1f, 0x00, 0x00 },	// U+26BA (⚺)
 	{ 0x00, 0x00, 0x00, 0x00, 0x1f, 0x04, 0x0a, 0x0a, 0x11, 0x11, 0x00, 0x00 },	// U+26BB (⚻)
 	{ 0x00, 0x00, 0x00, 0x1f, 0x11, 0x11, 0x15, 0x1f, 0x04, 0x0c, 0x00, 0x00 },	// U+26BC (⚼)
-}; // 29
-
-static const unsigned char orpb_block60[][12] = {
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x0e, 0x11, 0x1f, 0x11, 0x0e, 0x00, 0x00 },	// U+26C0 (⛀)
 	{ 0x00, 0x00, 0x00, 0x0e, 0x11, 0x1f, 0x11, 0x1f, 0x11, 0x0e, 0x00, 0x00 },	// U+26C1 (⛁)
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x0e, 0x1f, 0x1f, 0x1f, 0x0e, 0x00, 0x00 },	// U+26C2 (⛂)
 	{ 0x00, 0x00, 0x00, 0x0e, 0x1f, 0x1f, 0x0e, 0x11, 0x1f, 0x0e, 0x00, 0x00 },	// U+26C3 (⛃)
-}; // 4
-
-static const unsigned char orpb_block61[][12] = {
 	{ 0x00, 0x00, 0x00, 0x00, 0x09, 0x3f, 0x04, 0x02, 0x06, 0x00, 0x00, 0x00 },	// U+2701 (✁)
 	{ 0x00, 0x00, 0x00, 0x00, 0x23, 0x13, 0x0c, 0x13, 0x23, 0x00, 0x00, 0x00 },	// U+2702 (✂)
 	{ 0x00, 0x00, 0x00, 0x00, 0x06, 0x02, 0x04, 0x3f, 0x09, 0x00, 0x00, 0x00 },	// U+2703 (✃)
 	{ 0x00, 0x00, 0x00, 0x33, 0x29, 0x17, 0x0c, 0x17, 0x29, 0x33, 0x00, 0x00 },	// U+2704 (✄)
-}; // 4
-
-static const unsigned char orpb_block62[][12] = {
 	{ 0x00, 0x00, 0x1e, 0x21, 0x2d, 0x2d, 0x25, 0x2d, 0x2d, 0x21, 0x1e, 0x00 },	// U+2706 (✆)
 	{ 0x00, 0x00, 0x1e, 0x21, 0x2d, 0x21, 0x2d, 0x21, 0x33, 0x21, 0x1e, 0x00 },	// U+2707 (✇)
 	{ 0x00, 0x00, 0x00, 0x00, 0x04, 0x0d, 0x3f, 0x0d, 0x04, 0x00, 0x00, 0x00 },	// U+2708 (✈)
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x3f, 0x33, 0x2d, 0x21, 0x3f, 0x00, 0x00 },	// U+2709 (✉)
-}; // 4
-
-static const unsigned char orpb_block63[][12] = {
 	{ 0x00, 0x00, 0x12, 0x12, 0x14, 0x1c, 0x1e, 0x1e, 0x1e, 0x1c, 0x00, 0x00 },	// U+270C (✌)
 	{ 0x00, 0x00, 0x00, 0x20, 0x1c, 0x3e, 0x3e, 0x02, 0x01, 0x00, 0x00, 0x00 },	// U+270D (✍)
 	{ 0x00, 0x00, 0x00, 0x00, 0x02, 0x07, 0x0a, 0x14, 0x28, 0x30, 0x00, 0x00 },	// U+270E (✎)
@@ -3606,9 +3420,6 @@ static const unsigned char orpb_block63[][12] = {
 	{ 0x00, 0x00, 0x00, 0x04, 0x0e, 0x15, 0x1f, 0x15, 0x0e, 0x04, 0x00, 0x00 },	// U+2725 (✥)
 	{ 0x00, 0x00, 0x00, 0x00, 0x04, 0x0e, 0x1f, 0x0e, 0x04, 0x00, 0x00, 0x00 },	// U+2726 (✦)
 	{ 0x00, 0x00, 0x00, 0x00, 0x04, 0x0e, 0x1b, 0x0e, 0x04, 0x00, 0x00, 0x00 },	// U+2727 (✧)
-}; // 28
-
-static const unsigned char orpb_block64[][12] = {
 	{ 0x00, 0x00, 0x00, 0x00, 0x04, 0x1b, 0x0a, 0x04, 0x0a, 0x00, 0x00, 0x00 },	// U+2729 (✩)
 	{ 0x00, 0x00, 0x00, 0x0e, 0x1b, 0x11, 0x1b, 0x15, 0x1f, 0x0e, 0x00, 0x00 },	// U+272A (✪)
 	{ 0x00, 0x00, 0x00, 0x04, 0x04, 0x1f, 0x0a, 0x0e, 0x11, 0x00, 0x00, 0x00 },	// U+272B (✫)
@@ -3644,24 +3455,12 @@ static const unsigned char orpb_block64[][12] = {
 	{ 0x00, 0x00, 0x00, 0x04, 0x15, 0x0e, 0x1f, 0x0e, 0x15, 0x04, 0x00, 0x00 },	// U+2749 (❉)
 	{ 0x00, 0x00, 0x00, 0x04, 0x15, 0x0e, 0x1f, 0x0e, 0x15, 0x04, 0x00, 0x00 },	// U+274A (❊)
 	{ 0x00, 0x00, 0x00, 0x04, 0x15, 0x0e, 0x1f, 0x0e, 0x15, 0x04, 0x00, 0x00 },	// U+274B (❋)
-}; // 35
-
-static const unsigned char orpb_block65[][12] = {
 	{ 0x00, 0x00, 0x00, 0x00, 0x1e, 0x31, 0x31, 0x31, 0x1e, 0x00, 0x00, 0x00 },	// U+274D (❍)
-}; // 1
-
-static const unsigned char orpb_block66[][12] = {
 	{ 0x00, 0x00, 0x00, 0x00, 0x1f, 0x31, 0x31, 0x31, 0x3f, 0x3e, 0x00, 0x00 },	// U+274F (❏)
 	{ 0x00, 0x00, 0x00, 0x00, 0x3e, 0x3f, 0x31, 0x31, 0x31, 0x1f, 0x00, 0x00 },	// U+2750 (❐)
 	{ 0x00, 0x00, 0x00, 0x00, 0x1f, 0x31, 0x31, 0x31, 0x3f, 0x3e, 0x00, 0x00 },	// U+2751 (❑)
 	{ 0x00, 0x00, 0x00, 0x00, 0x3e, 0x3f, 0x31, 0x31, 0x31, 0x1f, 0x00, 0x00 },	// U+2752 (❒)
-}; // 4
-
-static const unsigned char orpb_block67[][12] = {
 	{ 0x00, 0x00, 0x00, 0x08, 0x1c, 0x2a, 0x37, 0x2a, 0x1c, 0x08, 0x00, 0x00 },	// U+2756 (❖)
-}; // 1
-
-static const unsigned char orpb_block68[][12] = {
 	{ 0x00, 0x00, 0x00, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x00, 0x00 },	// U+2758 (❘)
 	{ 0x00, 0x00, 0x00, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x00, 0x00 },	// U+2759 (❙)
 	{ 0x00, 0x00, 0x00, 0x1e, 0x1e, 0x1e, 0x1e, 0x1e, 0x1e, 0x1e, 0x00, 0x00 },	// U+275A (❚)
@@ -3669,9 +3468,6 @@ static const unsigned char orpb_block68[][12] = {
 	{ 0x00, 0x0c, 0x1e, 0x1c, 0x10, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+275C (❜)
 	{ 0x00, 0x12, 0x09, 0x1b, 0x3f, 0x12, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+275D (❝)
 	{ 0x00, 0x12, 0x3f, 0x36, 0x24, 0x12, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+275E (❞)
-}; // 7
-
-static const unsigned char orpb_block69[][12] = {
 	{ 0x00, 0x10, 0x3e, 0x13, 0x13, 0x13, 0x1e, 0x10, 0x13, 0x11, 0x0e, 0x00 },	// U+2761 (❡)
 	{ 0x00, 0x0e, 0x1f, 0x1f, 0x0e, 0x04, 0x00, 0x04, 0x0e, 0x04, 0x00, 0x00 },	// U+2762 (❢)
 	{ 0x00, 0x00, 0x1b, 0x1f, 0x0e, 0x04, 0x00, 0x04, 0x0e, 0x04, 0x00, 0x00 },	// U+2763 (❣)
@@ -3724,9 +3520,6 @@ static const unsigned char orpb_block69[][12] = {
 	{ 0x00, 0x0e, 0x1f, 0x1b, 0x15, 0x13, 0x17, 0x19, 0x1f, 0x0e, 0x00, 0x00 },	// U+2792 (➒)
 	{ 0x00, 0x1e, 0x3f, 0x35, 0x29, 0x29, 0x29, 0x35, 0x3f, 0x1e, 0x00, 0x00 },	// U+2793 (➓)
 	{ 0x00, 0x00, 0x00, 0x00, 0x0c, 0x18, 0x3f, 0x18, 0x0c, 0x00, 0x00, 0x00 },	// U+2794 (➔)
-}; // 52
-
-static const unsigned char orpb_block70[][12] = {
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x02, 0x14, 0x18, 0x1c, 0x00, 0x00 },	// U+2798 (➘)
 	{ 0x00, 0x00, 0x00, 0x00, 0x04, 0x0c, 0x1f, 0x0c, 0x04, 0x00, 0x00, 0x00 },	// U+2799 (➙)
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x1c, 0x18, 0x14, 0x02, 0x01, 0x00, 0x00 },	// U+279A (➚)
@@ -3751,9 +3544,6 @@ static const unsigned char orpb_block70[][12] = {
 	{ 0x00, 0x00, 0x00, 0x00, 0x08, 0x17, 0x21, 0x21, 0x17, 0x08, 0x00, 0x00 },	// U+27AD (➭)
 	{ 0x00, 0x00, 0x00, 0x00, 0x08, 0x17, 0x21, 0x21, 0x17, 0x08, 0x00, 0x00 },	// U+27AE (➮)
 	{ 0x00, 0x00, 0x00, 0x00, 0x08, 0x17, 0x21, 0x17, 0x08, 0x00, 0x00, 0x00 },	// U+27AF (➯)
-}; // 24
-
-static const unsigned char orpb_block71[][12] = {
 	{ 0x00, 0x00, 0x00, 0x00, 0x08, 0x17, 0x21, 0x17, 0x08, 0x00, 0x00, 0x00 },	// U+27B1 (➱)
 	{ 0x00, 0x00, 0x00, 0x1e, 0x3b, 0x30, 0x20, 0x30, 0x3b, 0x1e, 0x00, 0x00 },	// U+27B2 (➲)
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x17, 0x3e, 0x17, 0x00, 0x00, 0x00 },	// U+27B3 (➳)
@@ -3768,9 +3558,6 @@ static const unsigned char orpb_block71[][12] = {
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x17, 0x3e, 0x17, 0x00, 0x00, 0x00 },	// U+27BC (➼)
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x17, 0x3f, 0x3f, 0x17, 0x00, 0x00, 0x00 },	// U+27BD (➽)
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x0a, 0x17, 0x20, 0x17, 0x0a, 0x00, 0x00 },	// U+27BE (➾)
-}; // 14
-
-static const unsigned char orpb_block72[][12] = {
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x09, 0x05, 0x03, 0x1f, 0x00, 0x00 },	// U+27C0 (⟀)
 	{ 0x00, 0x00, 0x00, 0x00, 0x04, 0x04, 0x0a, 0x0e, 0x15, 0x1f, 0x00, 0x00 },	// U+27C1 (⟁)
 	{ 0x00, 0x00, 0x00, 0x00, 0x04, 0x04, 0x04, 0x04, 0x04, 0x1f, 0x00, 0x00 },	// U+27C2 (⟂)
@@ -3782,13 +3569,7 @@ static const unsigned char orpb_block72[][12] = {
 	{ 0x00, 0x00, 0x01, 0x39, 0x05, 0x05, 0x05, 0x3a, 0x02, 0x02, 0x00, 0x00 },	// U+27C8 (⟈)
 	{ 0x00, 0x00, 0x20, 0x27, 0x28, 0x28, 0x28, 0x17, 0x10, 0x10, 0x00, 0x00 },	// U+27C9 (⟉)
 	{ 0x00, 0x00, 0x00, 0x04, 0x04, 0x04, 0x0e, 0x04, 0x04, 0x04, 0x00, 0x00 },	// U+27CA (⟊)
-}; // 11
-
-static const unsigned char orpb_block73[][12] = {
 	{ 0x00, 0x00, 0x00, 0x3f, 0x02, 0x04, 0x04, 0x04, 0x04, 0x02, 0x00, 0x00 },	// U+27CC (⟌)
-}; // 1
-
-static const unsigned char orpb_block74[][12] = {
 	{ 0x00, 0x00, 0x00, 0x00, 0x04, 0x0a, 0x15, 0x0a, 0x04, 0x00, 0x00, 0x00 },	// U+27D0 (⟐)
 	{ 0x00, 0x00, 0x00, 0x04, 0x04, 0x0a, 0x0a, 0x11, 0x15, 0x11, 0x00, 0x00 },	// U+27D1 (⟑)
 	{ 0x00, 0x00, 0x00, 0x15, 0x15, 0x15, 0x15, 0x15, 0x15, 0x0e, 0x00, 0x00 },	// U+27D2 (⟒)
@@ -4682,9 +4463,6 @@ static const unsigned char orpb_block74[][12] = {
 	{ 0x00, 0x00, 0x02, 0x1f, 0x02, 0x00, 0x16, 0x0d, 0x00, 0x16, 0x0d, 0x00 },	// U+2B4A (⭊)
 	{ 0x00, 0x00, 0x00, 0x00, 0x02, 0x1f, 0x02, 0x00, 0x16, 0x0d, 0x00, 0x00 },	// U+2B4B (⭋)
 	{ 0x00, 0x00, 0x00, 0x00, 0x08, 0x1f, 0x08, 0x00, 0x16, 0x0d, 0x00, 0x00 },	// U+2B4C (⭌)
-}; // 893
-
-static const unsigned char orpb_block75[][12] = {
 	{ 0x00, 0x00, 0x00, 0x02, 0x02, 0x07, 0x02, 0x07, 0x02, 0x1e, 0x00, 0x00 },	// U+2C60 (Ⱡ)
 	{ 0x00, 0x00, 0x00, 0x04, 0x06, 0x04, 0x0e, 0x04, 0x0e, 0x04, 0x00, 0x00 },	// U+2C61 (ⱡ)
 	{ 0x00, 0x00, 0x00, 0x04, 0x04, 0x16, 0x0d, 0x04, 0x04, 0x1c, 0x00, 0x00 },	// U+2C62 (Ɫ)
@@ -4701,9 +4479,6 @@ static const unsigned char orpb_block75[][12] = {
 	{ 0x00, 0x00, 0x00, 0x16, 0x19, 0x11, 0x11, 0x11, 0x11, 0x2e, 0x00, 0x00 },	// U+2C6D (Ɑ)
 	{ 0x00, 0x00, 0x00, 0x11, 0x1b, 0x15, 0x11, 0x11, 0x11, 0x11, 0x14, 0x08 },	// U+2C6E (Ɱ)
 	{ 0x00, 0x00, 0x00, 0x11, 0x11, 0x11, 0x1f, 0x11, 0x11, 0x0e, 0x00, 0x00 },	// U+2C6F (Ɐ)
-}; // 16
-
-static const unsigned char orpb_block76[][12] = {
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x21, 0x11, 0x11, 0x0a, 0x04, 0x00, 0x00 },	// U+2C71 (ⱱ)
 	{ 0x00, 0x00, 0x00, 0x21, 0x11, 0x11, 0x11, 0x15, 0x15, 0x0a, 0x00, 0x00 },	// U+2C72 (Ⱳ)
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x21, 0x11, 0x15, 0x15, 0x0a, 0x00, 0x00 },	// U+2C73 (ⱳ)
@@ -4717,9 +4492,6 @@ static const unsigned char orpb_block76[][12] = {
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x1e, 0x10, 0x1c, 0x10, 0x1e, 0x00, 0x00 },	// U+2C7B (ⱻ)
 	{ 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x06, 0x04, 0x04, 0x04, 0x05, 0x02 },	// U+2C7C (ⱼ)
 	{ 0x00, 0x11, 0x11, 0x11, 0x0a, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+2C7D (ⱽ)
-}; // 13
-
-static const unsigned char orpb_block77[][12] = {
 	{ 0x06, 0x03, 0x05, 0x05, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+2DE0 (ⷠ)
 	{ 0x03, 0x05, 0x03, 0x05, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+2DE1 (ⷡ)
 	{ 0x07, 0x01, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+2DE2 (ⷢ)
@@ -4752,9 +4524,6 @@ static const unsigned char orpb_block77[][12] = {
 	{ 0x04, 0x0a, 0x1f, 0x15, 0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+2DFD (ⷽ)
 	{ 0x1f, 0x0a, 0x0e, 0x15, 0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+2DFE (ⷾ)
 	{ 0x3f, 0x15, 0x1d, 0x2b, 0x2b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+2DFF (ⷿ)
-}; // 32
-
-static const unsigned char orpb_block78[][12] = {
 	{ 0x00, 0x00, 0x00, 0x1c, 0x0a, 0x0a, 0x1f, 0x0a, 0x0a, 0x0a, 0x00, 0x00 },	// U+FB00 (ﬀ)
 	{ 0x00, 0x00, 0x00, 0x0c, 0x12, 0x02, 0x1f, 0x12, 0x12, 0x12, 0x00, 0x00 },	// U+FB01 (ﬁ)
 	{ 0x00, 0x00, 0x00, 0x1c, 0x12, 0x12, 0x1f, 0x12, 0x12, 0x12, 0x00, 0x00 },	// U+FB02 (ﬂ)
@@ -4762,16 +4531,88 @@ static const unsigned char orpb_block78[][12] = {
 	{ 0x00, 0x00, 0x00, 0x1e, 0x15, 0x15, 0x1f, 0x15, 0x15, 0x15, 0x00, 0x00 },	// U+FB04 (ﬄ)
 	{ 0x00, 0x00, 0x00, 0x04, 0x0a, 0x1e, 0x0b, 0x0a, 0x0a, 0x12, 0x00, 0x00 },	// U+FB05 (ﬅ)
 	{ 0x00, 0x00, 0x00, 0x0c, 0x0a, 0x1e, 0x09, 0x0a, 0x0a, 0x11, 0x00, 0x00 },	// U+FB06 (ﬆ)
-}; // 7
-
-static const unsigned char orpb_block79[][12] = {
 	{ 0x38, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+FE20 (︠)
 	{ 0x07, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+FE21 (︡)
 	{ 0x3e, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+FE22 (︢)
 	{ 0x10, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+FE23 (︣)
-}; // 4
-
-static const unsigned char orpb_block80[][12] = {
 	{ 0x00, 0x00, 0x0e, 0x1b, 0x15, 0x17, 0x1b, 0x1b, 0x1f, 0x1b, 0x0e, 0x00 },	// U+FFFD (�)
-}; // 1
+}; // 4531
+
+static const uint8_t orpb_page_index[] = {
+	0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x09,
+	0x0a, 0x0b, 0x0c, 0x0d, 0x0e, 0x0f, 0x10, 0x11, 0x12, 0x13, 0x14, 0x15, 0x16, 0x17, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x19, 0x1a,
+}; // 256
 
+static const uint32_t orpb_page_bits[][8] = {
+	{ 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000 },	// Empty
+	{ 0x00000001, 0xffffffff, 0xffffffff, 0x7fffffff, 0x00000000, 0xffffffff, 0xffffffff, 0xffffffff },	// U+00xx
+	{ 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff },	// U+01xx
+	{ 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff },	// U+02xx
+	{ 0xffffffff, 0xffffffff, 0xffffffff, 0x7cffffff, 0xffffd7f0, 0xfffffffb, 0xffffffff, 0xffffffff },	// U+03xx
+	{ 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff },	// U+04xx
+	{ 0xffffffff, 0xfffe000f, 0xfe7fffff, 0xfffffffe, 0xfffe06ff, 0xffffffff, 0xffff00ff, 0x001f07ff },	// U+05xx
+	{ 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x1fffffff, 0xffffffff, 0xffffffff, 0x0001ffff },	// U+16xx
+	{ 0xc00ffcfc, 0xc03f0000, 0x00f0000f, 0x0003ffff, 0x0000ffff, 0x00000000, 0x00000000, 0x03fc0000 },	// U+1Exx
+	{ 0x3f3fffff, 0xffffffff, 0xaaff3f3f, 0x3fffffff, 0xffffffff, 0xffdfffff, 0xefcfffdf, 0x7fdcffff },	// U+1Fxx
+	{ 0xffff0000, 0xffff00ff, 0x7fffffff, 0xfff30000, 0x001f7fff, 0x003fffff, 0xffff0000, 0x0001ffff },	// U+20xx
+	{ 0xffffffff, 0xffffffff, 0xfff8ffff, 0xffffffff, 0xffff01ff, 0xffffffff, 0xffffffff, 0xffffffff },	// U+21xx
+	{ 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff },	// U+22xx
+	{ 0xffffffff, 0xfffff9ff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0x000000ff },	// U+23xx
+	{ 0xffffffff, 0x0000007f, 0x000007ff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff },	// U+24xx
+	{ 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff },	// U+25xx
+	{ 0xfecfffff, 0xffffffff, 0xffffffff, 0xffffffff, 0x1fffffff, 0x1fffffff, 0x0000000f, 0x00000000 },	// U+26xx
+	{ 0xfffff3de, 0xfffffeff, 0x7f47afff, 0xfffffffe, 0xff1fffff, 0x7ffeffff, 0xffff17ff, 0xffffffff },	// U+27xx
+	{ 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff },	// U+28xx
+	{ 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff },	// U+29xx
+	{ 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff },	// U+2Axx
+	{ 0xffffffff, 0xffffffff, 0x00001fff, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000 },	// U+2Bxx
+	{ 0x00000000, 0x00000000, 0x00000000, 0x3ffeffff, 0x00000000, 0x00000000, 0x00000000, 0x00000000 },	// U+2Cxx
+	{ 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xffffffff },	// U+2Dxx
+	{ 0x0000007f, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000 },	// U+FBxx
+	{ 0x00000000, 0x0000000f, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000 },	// U+FExx
+	{ 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x20000000 },	// U+FFxx
+}; // 27
+
+static const uint16_t orpb_page_base[][8] = {
+	{ 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000 },	// Empty
+	{ 0x0000, 0x0001, 0x0021, 0x0041, 0x0060, 0x0060, 0x0080, 0x00a0 },	// U+00xx
+	{ 0x00c0, 0x00e0, 0x0100, 0x0120, 0x0140, 0x0160, 0x0180, 0x01a0 },	// U+01xx
+	{ 0x01c0, 0x01e0, 0x0200, 0x0220, 0x0240, 0x0260, 0x0280, 0x02a0 },	// U+02xx
+	{ 0x02c0, 0x02e0, 0x0300, 0x0320, 0x033d, 0x0357, 0x0376, 0x0396 },	// U+03xx
+	{ 0x03b6, 0x03d6, 0x03f6, 0x0416, 0x0436, 0x0456, 0x0476, 0x0496 },	// U+04xx
+	{ 0x04b6, 0x04d6, 0x04e9, 0x0507, 0x0526, 0x053f, 0x055f, 0x0577 },	// U+05xx
+	{ 0x0587, 0x0587, 0x0587, 0x0587, 0x0587, 0x05a4, 0x05c4, 0x05e4 },	// U+16xx
+	{ 0x05f5, 0x0607, 0x060f, 0x0617, 0x0629, 0x0639, 0x0639, 0x0639 },	// U+1Exx
+	{ 0x0641, 0x065d, 0x067d, 0x0695, 0x06b3, 0x06d3, 0x06f2, 0x070e },	// U+1Fxx
+	{ 0x072a, 0x073a, 0x0752, 0x0771, 0x077f, 0x0793, 0x07a9, 0x07b9 },	// U+20xx
+	{ 0x07ca, 0x07ea, 0x080a, 0x0827, 0x0847, 0x0860, 0x0880, 0x08a0 },	// U+21xx
+	{ 0x08c0, 0x08e0, 0x0900, 0x0920, 0x0940, 0x0960, 0x0980, 0x09a0 },	// U+22xx
+	{ 0x09c0, 0x09e0, 0x09fe, 0x0a1e, 0x0a3e, 0x0a5e, 0x0a7e, 0x0a9e },	// U+23xx
+	{ 0x0aa6, 0x0ac6, 0x0acd, 0x0ad8, 0x0af8, 0x0b18, 0x0b38, 0x0b58 },	// U+24xx
+	{ 0x0b78, 0x0b98, 0x0bb8, 0x0bd8, 0x0bf8, 0x0c18, 0x0c38, 0x0c58 },	// U+25xx
+	{ 0x0c78, 0x0c95, 0x0cb5, 0x0cd5, 0x0cf5, 0x0d12, 0x0d2f, 0x0d33 },	// U+26xx
+	{ 0x0d33, 0x0d4f, 0x0d6e, 0x0d87, 0x0da6, 0x0dc3, 0x0de1, 0x0dfd },	// U+27xx
+	{ 0x0e1d, 0x0e3d, 0x0e5d, 0x0e7d, 0x0e9d, 0x0ebd, 0x0edd, 0x0efd },	// U+28xx
+	{ 0x0f1d, 0x0f3d, 0x0f5d, 0x0f7d, 0x0f9d, 0x0fbd, 0x0fdd, 0x0ffd },	// U+29xx
+	{ 0x101d, 0x103d, 0x105d, 0x107d, 0x109d, 0x10bd, 0x10dd, 0x10fd },	// U+2Axx
+	{ 0x111d, 0x113d, 0x115d, 0x116a, 0x116a, 0x116a, 0x116a, 0x116a },	// U+2Bxx
+	{ 0x116a, 0x116a, 0x116a, 0x116a, 0x1187, 0x1187, 0x1187, 0x1187 },	// U+2Cxx
+	{ 0x1187, 0x1187, 0x1187, 0x1187, 0x1187, 0x1187, 0x1187, 0x1187 },	// U+2Dxx
+	{ 0x11a7, 0x11ae, 0x11ae, 0x11ae, 0x11ae, 0x11ae, 0x11ae, 0x11ae },	// U+FBxx
+	{ 0x11ae, 0x11ae, 0x11b2, 0x11b2, 0x11b2, 0x11b2, 0x11b2, 0x11b2 },	// U+FExx
+	{ 0x11b2, 0x11b2, 0x11b2, 0x11b2, 0x11b2, 0x11b2, 0x11b2, 0x11b2 },	// U+FFxx
+}; // 27
@@ -4,7 +4,7 @@
 * With FBInk's tools/hextoc.py
 */
 
-static const unsigned char scientificab_block1[][12] = {
+static const unsigned char scientificab_glyphs[][12] = {
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+0020 ( )
 	{ 0x00, 0x00, 0x00, 0x04, 0x04, 0x04, 0x04, 0x04, 0x00, 0x04, 0x00, 0x00 },	// U+0021 (!)
 	{ 0x00, 0x00, 0x00, 0x0a, 0x0a, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+0022 (")
@@ -100,9 +100,6 @@ static const unsigned char scientificab_block1[][12] = {
 	{ 0x00, 0x00, 0x00, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x00, 0x00 },	// U+007C (|)
 	{ 0x00, 0x00, 0x03, 0x04, 0x04, 0x04, 0x18, 0x04, 0x04, 0x04, 0x03, 0x00 },	// U+007D (})
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x15, 0x08, 0x00, 0x00, 0x00, 0x00 },	// U+007E (~)
-}; // 95
-
-static const unsigned char scientificab_block2[][12] = {
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+00A0 ( )
 	{ 0x00, 0x00, 0x04, 0x00, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x00, 0x00 },	// U+00A1 (¡)
 	{ 0x00, 0x00, 0x00, 0x00, 0x02, 0x06, 0x0b, 0x03, 0x0b, 0x06, 0x02, 0x00 },	// U+00A2 (¢)
@@ -382,9 +379,6 @@ static const unsigned char scientificab_block2[][12] = {
 	{ 0x00, 0x00, 0x00, 0x00, 0x08, 0x15, 0x05, 0x05, 0x05, 0x06, 0x05, 0x06 },	// U+01B4 (ƴ)
 	{ 0x00, 0x00, 0x00, 0x0f, 0x08, 0x04, 0x0f, 0x02, 0x01, 0x0f, 0x00, 0x00 },	// U+01B5 (Ƶ)
 	{ 0x00, 0x00, 0x00, 0x00, 0x0f, 0x08, 0x04, 0x0f, 0x02, 0x0f, 0x00, 0x00 },	// U+01B6 (ƶ)
-}; // 279
-
-static const unsigned char scientificab_block3[][12] = {
 	{ 0x00, 0x00, 0x00, 0x0d, 0x09, 0x09, 0x09, 0x09, 0x09, 0x0b, 0x08, 0x06 },	// U+01C7 (Ǉ)
 	{ 0x00, 0x00, 0x00, 0x09, 0x01, 0x09, 0x09, 0x09, 0x09, 0x0b, 0x08, 0x04 },	// U+01C8 (ǈ)
 	{ 0x00, 0x00, 0x00, 0x0b, 0x02, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x08, 0x04 },	// U+01C9 (ǉ)
@@ -399,18 +393,12 @@ static const unsigned char scientificab_block3[][12] = {
 	{ 0x00, 0x00, 0x05, 0x02, 0x00, 0x06, 0x09, 0x09, 0x09, 0x06, 0x00, 0x00 },	// U+01D2 (ǒ)
 	{ 0x00, 0x05, 0x02, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x06, 0x00, 0x00 },	// U+01D3 (Ǔ)
 	{ 0x00, 0x00, 0x05, 0x02, 0x00, 0x09, 0x09, 0x09, 0x09, 0x0e, 0x00, 0x00 },	// U+01D4 (ǔ)
-}; // 14
-
-static const unsigned char scientificab_block4[][12] = {
 	{ 0x00, 0x05, 0x0a, 0x06, 0x09, 0x09, 0x09, 0x09, 0x09, 0x06, 0x00, 0x00 },	// U+020C (Ȍ)
 	{ 0x00, 0x00, 0x05, 0x0a, 0x00, 0x06, 0x09, 0x09, 0x09, 0x06, 0x00, 0x00 },	// U+020D (ȍ)
 	{ 0x00, 0x06, 0x09, 0x06, 0x09, 0x09, 0x09, 0x09, 0x09, 0x06, 0x00, 0x00 },	// U+020E (Ȏ)
 	{ 0x00, 0x00, 0x06, 0x09, 0x00, 0x06, 0x09, 0x09, 0x09, 0x06, 0x00, 0x00 },	// U+020F (ȏ)
 	{ 0x00, 0x05, 0x0a, 0x00, 0x07, 0x09, 0x07, 0x05, 0x05, 0x09, 0x00, 0x00 },	// U+0210 (Ȑ)
 	{ 0x00, 0x00, 0x05, 0x0a, 0x00, 0x07, 0x09, 0x01, 0x01, 0x01, 0x00, 0x00 },	// U+0211 (ȑ)
-}; // 6
-
-static const unsigned char scientificab_block5[][12] = {
 	{ 0x00, 0x00, 0x06, 0x09, 0x00, 0x07, 0x09, 0x01, 0x01, 0x01, 0x00, 0x00 },	// U+0213 (ȓ)
 	{ 0x00, 0x05, 0x0a, 0x00, 0x09, 0x09, 0x09, 0x09, 0x09, 0x0e, 0x00, 0x00 },	// U+0214 (Ȕ)
 	{ 0x00, 0x00, 0x05, 0x0a, 0x00, 0x09, 0x09, 0x09, 0x09, 0x0e, 0x00, 0x00 },	// U+0215 (ȕ)
@@ -420,25 +408,10 @@ static const unsigned char scientificab_block5[][12] = {
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x0e, 0x01, 0x06, 0x08, 0x07, 0x04, 0x02 },	// U+0219 (ș)
 	{ 0x00, 0x00, 0x00, 0x07, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x01 },	// U+021A (Ț)
 	{ 0x00, 0x00, 0x00, 0x02, 0x02, 0x07, 0x02, 0x02, 0x02, 0x04, 0x04, 0x02 },	// U+021B (ț)
-}; // 9
-
-static const unsigned char scientificab_block6[][12] = {
 	{ 0x00, 0x00, 0x00, 0x02, 0x02, 0x04, 0x08, 0x08, 0x09, 0x06, 0x00, 0x00 },	// U+0296 (ʖ)
-}; // 1
-
-static const unsigned char scientificab_block7[][12] = {
 	{ 0x00, 0x00, 0x00, 0x0a, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+02C7 (ˇ)
-}; // 1
-
-static const unsigned char scientificab_block8[][12] = {
 	{ 0x00, 0x00, 0x04, 0x0a, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+02DA (˚)
-}; // 1
-
-static const unsigned char scientificab_block9[][12] = {
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x09, 0x08, 0x08, 0x04, 0x00, 0x00 },	// U+0364 (ͤ)
-}; // 1
-
-static const unsigned char scientificab_block10[][12] = {
 	{ 0x00, 0x00, 0x00, 0x06, 0x09, 0x09, 0x0f, 0x09, 0x09, 0x09, 0x00, 0x00 },	// U+0391 (Α)
 	{ 0x00, 0x00, 0x00, 0x03, 0x05, 0x05, 0x07, 0x09, 0x09, 0x0f, 0x00, 0x00 },	// U+0392 (Β)
 	{ 0x00, 0x00, 0x00, 0x0f, 0x09, 0x01, 0x01, 0x01, 0x01, 0x01, 0x00, 0x00 },	// U+0393 (Γ)
@@ -464,9 +437,6 @@ static const unsigned char scientificab_block10[][12] = {
 	{ 0x00, 0x00, 0x00, 0x09, 0x09, 0x06, 0x09, 0x09, 0x09, 0x09, 0x00, 0x00 },	// U+03A7 (Χ)
 	{ 0x00, 0x00, 0x00, 0x15, 0x15, 0x15, 0x0e, 0x04, 0x04, 0x04, 0x00, 0x00 },	// U+03A8 (Ψ)
 	{ 0x00, 0x00, 0x00, 0x0e, 0x11, 0x11, 0x11, 0x1b, 0x0a, 0x1b, 0x00, 0x00 },	// U+03A9 (Ω)
-}; // 25
-
-static const unsigned char scientificab_block11[][12] = {
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0a, 0x05, 0x05, 0x0a, 0x00, 0x00 },	// U+03B1 (α)
 	{ 0x00, 0x00, 0x00, 0x00, 0x03, 0x05, 0x05, 0x0b, 0x09, 0x07, 0x01, 0x01 },	// U+03B2 (β)
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x06, 0x04, 0x0a, 0x0a, 0x04 },	// U+03B3 (γ)
@@ -492,18 +462,9 @@ static const unsigned char scientificab_block11[][12] = {
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x06, 0x02, 0x05, 0x08, 0x00 },	// U+03C7 (χ)
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x15, 0x15, 0x0e, 0x04, 0x04 },	// U+03C8 (ψ)
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x0a, 0x11, 0x11, 0x15, 0x0a, 0x00, 0x00 },	// U+03C9 (ω)
-}; // 25
-
-static const unsigned char scientificab_block12[][12] = {
 	{ 0x00, 0x00, 0x08, 0x14, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x02, 0x01 },	// U+0F3C (༼)
 	{ 0x00, 0x00, 0x02, 0x05, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x08, 0x10 },	// U+0F3D (༽)
-}; // 2
-
-static const unsigned char scientificab_block13[][12] = {
 	{ 0x00, 0x00, 0x00, 0x00, 0x03, 0x05, 0x05, 0x0b, 0x09, 0x0f, 0x01, 0x01 },	// U+1E9E (ẞ)
-}; // 1
-
-static const unsigned char scientificab_block14[][12] = {
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x00 },	// U+2010 (‐)
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x00 },	// U+2011 (‑)
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0f, 0x00, 0x00, 0x00, 0x00 },	// U+2012 (‒)
@@ -528,9 +489,6 @@ static const unsigned char scientificab_block14[][12] = {
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x00 },	// U+2025 (‥)
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x00, 0x00 },	// U+2026 (…)
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00 },	// U+2027 (‧)
-}; // 24
-
-static const unsigned char scientificab_block15[][12] = {
 	{ 0x00, 0x00, 0x00, 0x04, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+2032 (′)
 	{ 0x00, 0x00, 0x00, 0x14, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+2033 (″)
 	{ 0x00, 0x00, 0x00, 0x0a, 0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+2034 (‴)
@@ -540,35 +498,17 @@ static const unsigned char scientificab_block15[][12] = {
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x05, 0x00, 0x00 },	// U+2038 (‸)
 	{ 0x00, 0x00, 0x00, 0x00, 0x01, 0x02, 0x04, 0x08, 0x04, 0x02, 0x01, 0x00 },	// U+2039 (‹)
 	{ 0x00, 0x00, 0x00, 0x00, 0x06, 0x02, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+203A (›)
-}; // 9
-
-static const unsigned char scientificab_block16[][12] = {
 	{ 0x00, 0x00, 0x00, 0x05, 0x05, 0x05, 0x05, 0x05, 0x00, 0x05, 0x00, 0x00 },	// U+203C (‼)
-}; // 1
-
-static const unsigned char scientificab_block17[][12] = {
 	{ 0x00, 0x00, 0x00, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+203E (‾)
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x06, 0x00 },	// U+203F (‿)
 	{ 0x00, 0x00, 0x00, 0x06, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+2040 (⁀)
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x04, 0x02, 0x05, 0x00, 0x00 },	// U+2041 (⁁)
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00 },	// U+2042 (⁂)
-}; // 5
-
-static const unsigned char scientificab_block18[][12] = {
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x02, 0x04, 0x00 },	// U+204F (⁏)
 	{ 0x00, 0x00, 0x00, 0x00, 0x06, 0x09, 0x00, 0x00, 0x09, 0x06, 0x00, 0x00 },	// U+2050 (⁐)
 	{ 0x00, 0x00, 0x00, 0x05, 0x02, 0x05, 0x00, 0x05, 0x02, 0x05, 0x00, 0x00 },	// U+2051 (⁑)
-}; // 3
-
-static const unsigned char scientificab_block19[][12] = {
 	{ 0x00, 0x00, 0x00, 0x00, 0x0e, 0x01, 0x07, 0x07, 0x01, 0x0e, 0x00, 0x00 },	// U+20AC (€)
-}; // 1
-
-static const unsigned char scientificab_block20[][12] = {
 	{ 0x00, 0x0e, 0x04, 0x04, 0x04, 0x0a, 0x0e, 0x0a, 0x0a, 0x00, 0x00, 0x00 },	// U+2122 (™)
-}; // 1
-
-static const unsigned char scientificab_block21[][12] = {
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x02, 0x1f, 0x02, 0x04, 0x00, 0x00 },	// U+2190 (←)
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x0e, 0x15, 0x04, 0x04, 0x00, 0x00 },	// U+2191 (↑)
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x08, 0x1f, 0x08, 0x04, 0x00, 0x00 },	// U+2192 (→)
@@ -579,28 +519,16 @@ static const unsigned char scientificab_block21[][12] = {
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0c, 0x0c, 0x02, 0x01, 0x00, 0x00 },	// U+2197 (↗)
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x02, 0x0c, 0x0c, 0x00, 0x00 },	// U+2198 (↘)
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x04, 0x03, 0x03, 0x00, 0x00 },	// U+2199 (↙)
-}; // 10
-
-static const unsigned char scientificab_block22[][12] = {
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x14, 0x12, 0x1f, 0x12, 0x14, 0x00, 0x00 },	// U+21A4 (↤)
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x0e, 0x15, 0x04, 0x1f, 0x00, 0x00 },	// U+21A5 (↥)
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x09, 0x1f, 0x09, 0x05, 0x00, 0x00 },	// U+21A6 (↦)
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x0e, 0x15, 0x04, 0x1f, 0x00, 0x00 },	// U+21A7 (↧)
-}; // 4
-
-static const unsigned char scientificab_block23[][12] = {
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x12, 0x1f, 0x02, 0x00, 0x00, 0x00 },	// U+21A9 (↩)
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x1f, 0x08, 0x00, 0x00, 0x00 },	// U+21AA (↪)
-}; // 2
-
-static const unsigned char scientificab_block24[][12] = {
 	{ 0x00, 0x00, 0x00, 0x04, 0x0f, 0x05, 0x01, 0x01, 0x01, 0x01, 0x00, 0x00 },	// U+21B1 (↱)
 	{ 0x00, 0x00, 0x00, 0x08, 0x08, 0x08, 0x0a, 0x0f, 0x02, 0x00, 0x00, 0x00 },	// U+21B2 (↲)
 	{ 0x00, 0x00, 0x00, 0x01, 0x01, 0x01, 0x05, 0x0f, 0x04, 0x00, 0x00, 0x00 },	// U+21B3 (↳)
 	{ 0x00, 0x00, 0x00, 0x0f, 0x08, 0x08, 0x08, 0x08, 0x1c, 0x08, 0x00, 0x00 },	// U+21B4 (↴)
-}; // 4
-
-static const unsigned char scientificab_block25[][12] = {
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+21B9 (↹)
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x19, 0x09, 0x09, 0x06, 0x00, 0x00 },	// U+21BA (↺)
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x13, 0x12, 0x12, 0x0c, 0x00, 0x00 },	// U+21BB (↻)
@@ -613,25 +541,13 @@ static const unsigned char scientificab_block25[][12] = {
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x04, 0x04, 0x0c, 0x04, 0x00, 0x00 },	// U+21C2 (⇂)
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x02, 0x02, 0x03, 0x02, 0x00, 0x00 },	// U+21C3 (⇃)
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x0f, 0x00, 0x0f, 0x02, 0x00, 0x00 },	// U+21C4 (⇄)
-}; // 12
-
-static const unsigned char scientificab_block26[][12] = {
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x0f, 0x00, 0x0f, 0x04, 0x00, 0x00 },	// U+21C6 (⇆)
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x0f, 0x00, 0x0f, 0x02, 0x00, 0x00 },	// U+21C7 (⇇)
-}; // 2
-
-static const unsigned char scientificab_block27[][12] = {
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x0f, 0x00, 0x0f, 0x04, 0x00, 0x00 },	// U+21C9 (⇉)
-}; // 1
-
-static const unsigned char scientificab_block28[][12] = {
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x1e, 0x01, 0x1e, 0x04, 0x00, 0x00 },	// U+21D0 (⇐)
 	{ 0x00, 0x00, 0x00, 0x00, 0x04, 0x0a, 0x1b, 0x0a, 0x0a, 0x0a, 0x00, 0x00 },	// U+21D1 (⇑)
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x0f, 0x10, 0x0f, 0x04, 0x00, 0x00 },	// U+21D2 (⇒)
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x0a, 0x0a, 0x0a, 0x1b, 0x0a, 0x04, 0x00 },	// U+21D3 (⇓)
-}; // 4
-
-static const unsigned char scientificab_block29[][12] = {
 	{ 0x00, 0x00, 0x00, 0x00, 0x09, 0x09, 0x09, 0x0f, 0x09, 0x09, 0x06, 0x00 },	// U+2200 (∀)
 	{ 0x00, 0x00, 0x00, 0x06, 0x09, 0x05, 0x01, 0x09, 0x09, 0x06, 0x00, 0x00 },	// U+2201 (∁)
 	{ 0x00, 0x00, 0x00, 0x06, 0x09, 0x08, 0x0e, 0x09, 0x09, 0x06, 0x00, 0x00 },	// U+2202 (∂)
@@ -653,69 +569,33 @@ static const unsigned char scientificab_block29[][12] = {
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0f, 0x00, 0x00, 0x00, 0x00 },	// U+2212 (−)
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x00, 0x02, 0x07, 0x02, 0x00, 0x00 },	// U+2213 (∓)
 	{ 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x04, 0x1f, 0x04, 0x04, 0x00, 0x00 },	// U+2214 (∔)
-}; // 21
-
-static const unsigned char scientificab_block30[][12] = {
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x09, 0x09, 0x06, 0x00, 0x00, 0x00 },	// U+2218 (∘)
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x0f, 0x0f, 0x06, 0x00, 0x00, 0x00 },	// U+2219 (∙)
 	{ 0x00, 0x00, 0x00, 0x0c, 0x04, 0x04, 0x04, 0x04, 0x05, 0x06, 0x00, 0x00 },	// U+221A (√)
-}; // 3
-
-static const unsigned char scientificab_block31[][12] = {
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0a, 0x05, 0x05, 0x0a, 0x00, 0x00 },	// U+221D (∝)
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0a, 0x15, 0x15, 0x0a, 0x00, 0x00 },	// U+221E (∞)
-}; // 2
-
-static const unsigned char scientificab_block32[][12] = {
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x09, 0x09, 0x09, 0x09, 0x00, 0x00 },	// U+2229 (∩)
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x09, 0x09, 0x09, 0x06, 0x00, 0x00 },	// U+222A (∪)
 	{ 0x00, 0x00, 0x08, 0x14, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x05, 0x02 },	// U+222B (∫)
-}; // 3
-
-static const unsigned char scientificab_block33[][12] = {
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x11, 0x00, 0x00 },	// U+2234 (∴)
 	{ 0x00, 0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00 },	// U+2235 (∵)
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00 },	// U+2236 (∶)
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x12, 0x00, 0x00, 0x00, 0x12, 0x00, 0x00 },	// U+2237 (∷)
-}; // 4
-
-static const unsigned char scientificab_block34[][12] = {
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x0a, 0x05, 0x00, 0x0a, 0x05, 0x00, 0x00 },	// U+2248 (≈)
-}; // 1
-
-static const unsigned char scientificab_block35[][12] = {
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x0f, 0x04, 0x0f, 0x01, 0x00, 0x00 },	// U+2260 (≠)
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x0f, 0x00, 0x0f, 0x00, 0x0f, 0x00, 0x00 },	// U+2261 (≡)
-}; // 2
-
-static const unsigned char scientificab_block36[][12] = {
 	{ 0x00, 0x00, 0x00, 0x08, 0x04, 0x02, 0x04, 0x08, 0x00, 0x1f, 0x00, 0x00 },	// U+2264 (≤)
 	{ 0x00, 0x00, 0x00, 0x02, 0x04, 0x08, 0x04, 0x02, 0x00, 0x1f, 0x00, 0x00 },	// U+2265 (≥)
-}; // 2
-
-static const unsigned char scientificab_block37[][12] = {
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+227A (≺)
-}; // 1
-
-static const unsigned char scientificab_block38[][12] = {
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x0e, 0x01, 0x01, 0x0e, 0x00, 0x00, 0x00 },	// U+2282 (⊂)
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x08, 0x08, 0x07, 0x00, 0x00, 0x00 },	// U+2283 (⊃)
 	{ 0x00, 0x00, 0x00, 0x00, 0x08, 0x0e, 0x05, 0x05, 0x0e, 0x02, 0x00, 0x00 },	// U+2284 (⊄)
 	{ 0x00, 0x00, 0x00, 0x00, 0x01, 0x07, 0x0a, 0x0a, 0x07, 0x04, 0x00, 0x00 },	// U+2285 (⊅)
 	{ 0x00, 0x00, 0x00, 0x00, 0x0e, 0x01, 0x01, 0x0e, 0x00, 0x0f, 0x00, 0x00 },	// U+2286 (⊆)
 	{ 0x00, 0x00, 0x00, 0x00, 0x07, 0x08, 0x08, 0x07, 0x00, 0x0f, 0x00, 0x00 },	// U+2287 (⊇)
-}; // 6
-
-static const unsigned char scientificab_block39[][12] = {
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x0e, 0x15, 0x1f, 0x15, 0x0e, 0x00, 0x00 },	// U+2295 (⊕)
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x0e, 0x11, 0x1f, 0x11, 0x0e, 0x00, 0x00 },	// U+2296 (⊖)
-}; // 2
-
-static const unsigned char scientificab_block40[][12] = {
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x0e, 0x11, 0x15, 0x11, 0x0e, 0x00, 0x00 },	// U+2299 (⊙)
-}; // 1
-
-static const unsigned char scientificab_block41[][12] = {
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x1f, 0x15, 0x1f, 0x15, 0x1f, 0x00, 0x00 },	// U+229E (⊞)
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x1f, 0x11, 0x1f, 0x11, 0x1f, 0x00, 0x00 },	// U+229F (⊟)
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x0a, 0x15, 0x0a, 0x15, 0x00, 0x00 },	// U+22A0 (⊠)
@@ -728,33 +608,18 @@ static const unsigned char scientificab_block41[][12] = {
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x07, 0x01, 0x07, 0x01, 0x00, 0x00 },	// U+22A7 (⊧)
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x1f, 0x01, 0x1f, 0x01, 0x00, 0x00 },	// U+22A8 (⊨)
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x05, 0x1d, 0x05, 0x05, 0x00, 0x00 },	// U+22A9 (⊩)
-}; // 12
-
-static const unsigned char scientificab_block42[][12] = {
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x1d, 0x05, 0x1d, 0x05, 0x00, 0x00 },	// U+22AB (⊫)
-}; // 1
-
-static const unsigned char scientificab_block43[][12] = {
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x05, 0x02, 0x00, 0x00, 0x00 },	// U+22C4 (⋄)
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00 },	// U+22C5 (⋅)
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x02, 0x05, 0x00, 0x00, 0x00 },	// U+22C6 (⋆)
-}; // 3
-
-static const unsigned char scientificab_block44[][12] = {
 	{ 0x00, 0x00, 0x1e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+23BA (⎺)
 	{ 0x00, 0x00, 0x00, 0x00, 0x1e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+23BB (⎻)
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1e, 0x00, 0x00, 0x00, 0x00 },	// U+23BC (⎼)
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1e, 0x00 },	// U+23BD (⎽)
-}; // 4
-
-static const unsigned char scientificab_block45[][12] = {
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x0f, 0x1f, 0x0f, 0x05, 0x00, 0x00 },	// U+23E9 (⏩)
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x14, 0x1e, 0x1f, 0x1e, 0x14, 0x00, 0x00 },	// U+23EA (⏪)
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x0e, 0x1f, 0x0e, 0x1f, 0x00, 0x00 },	// U+23EB (⏫)
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x1f, 0x0e, 0x1f, 0x0e, 0x04, 0x00, 0x00 },	// U+23EC (⏬)
-}; // 4
-
-static const unsigned char scientificab_block46[][12] = {
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x06, 0x07, 0x06, 0x04, 0x00, 0x00 },	// U+23F4 (⏴)
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x03, 0x07, 0x03, 0x01, 0x00, 0x00 },	// U+23F5 (⏵)
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x0e, 0x1f, 0x00, 0x00 },	// U+23F6 (⏶)
@@ -763,16 +628,10 @@ static const unsigned char scientificab_block46[][12] = {
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0f, 0x0f, 0x0f, 0x0f, 0x00, 0x00 },	// U+23F9 (⏹)
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x0f, 0x0f, 0x06, 0x00, 0x00 },	// U+23FA (⏺)
 	{ 0x00, 0x00, 0x00, 0x00, 0x04, 0x0e, 0x15, 0x15, 0x11, 0x0e, 0x00, 0x00 },	// U+23FB (⏻)
-}; // 8
-
-static const unsigned char scientificab_block47[][12] = {
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+2500 (─)
 	{ 0x00, 0x00, 0x00, 0x00, 0x1f, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+2501 (━)
 	{ 0x00, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04 },	// U+2502 (│)
 	{ 0x00, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e },	// U+2503 (┃)
-}; // 4
-
-static const unsigned char scientificab_block48[][12] = {
 	{ 0x00, 0x04, 0x04, 0x00, 0x04, 0x04, 0x00, 0x04, 0x04, 0x00, 0x04, 0x04 },	// U+250A (┊)
 	{ 0x00, 0x06, 0x06, 0x00, 0x06, 0x06, 0x00, 0x06, 0x06, 0x00, 0x06, 0x06 },	// U+250B (┋)
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x1c, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04 },	// U+250C (┌)
@@ -793,60 +652,24 @@ static const unsigned char scientificab_block48[][12] = {
 	{ 0x00, 0x0e, 0x0e, 0x0e, 0x0f, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+251B (┛)
 	{ 0x00, 0x04, 0x04, 0x04, 0x04, 0x1c, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04 },	// U+251C (├)
 	{ 0x00, 0x04, 0x04, 0x04, 0x1c, 0x1c, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04 },	// U+251D (┝)
-}; // 20
-
-static const unsigned char scientificab_block49[][12] = {
 	{ 0x00, 0x0e, 0x0e, 0x0e, 0x0e, 0x1e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e },	// U+2520 (┠)
-}; // 1
-
-static const unsigned char scientificab_block50[][12] = {
 	{ 0x00, 0x0e, 0x0e, 0x0e, 0x1e, 0x1e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e },	// U+2523 (┣)
 	{ 0x00, 0x04, 0x04, 0x04, 0x04, 0x07, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04 },	// U+2524 (┤)
 	{ 0x00, 0x04, 0x04, 0x04, 0x07, 0x07, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04 },	// U+2525 (┥)
-}; // 3
-
-static const unsigned char scientificab_block51[][12] = {
 	{ 0x00, 0x0e, 0x0e, 0x0e, 0x0e, 0x0f, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e },	// U+2528 (┨)
-}; // 1
-
-static const unsigned char scientificab_block52[][12] = {
 	{ 0x00, 0x0e, 0x0e, 0x0e, 0x0f, 0x0f, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e },	// U+252B (┫)
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x1f, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04 },	// U+252C (┬)
-}; // 2
-
-static const unsigned char scientificab_block53[][12] = {
 	{ 0x00, 0x00, 0x00, 0x00, 0x1f, 0x1f, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04 },	// U+252F (┯)
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x1f, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e },	// U+2530 (┰)
-}; // 2
-
-static const unsigned char scientificab_block54[][12] = {
 	{ 0x00, 0x00, 0x00, 0x00, 0x1f, 0x1f, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e },	// U+2533 (┳)
 	{ 0x00, 0x04, 0x04, 0x04, 0x04, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+2534 (┴)
-}; // 2
-
-static const unsigned char scientificab_block55[][12] = {
 	{ 0x00, 0x04, 0x04, 0x04, 0x1f, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+2537 (┷)
 	{ 0x00, 0x0e, 0x0e, 0x0e, 0x0e, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+2538 (┸)
-}; // 2
-
-static const unsigned char scientificab_block56[][12] = {
 	{ 0x00, 0x0e, 0x0e, 0x0e, 0x1f, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+253B (┻)
 	{ 0x00, 0x04, 0x04, 0x04, 0x04, 0x1f, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04 },	// U+253C (┼)
-}; // 2
-
-static const unsigned char scientificab_block57[][12] = {
 	{ 0x00, 0x04, 0x04, 0x04, 0x04, 0x1f, 0x1f, 0x04, 0x04, 0x04, 0x04, 0x04 },	// U+253F (┿)
-}; // 1
-
-static const unsigned char scientificab_block58[][12] = {
 	{ 0x00, 0x0e, 0x0e, 0x0e, 0x0e, 0x1f, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e },	// U+2542 (╂)
-}; // 1
-
-static const unsigned char scientificab_block59[][12] = {
 	{ 0x00, 0x0e, 0x0e, 0x0e, 0x1f, 0x1f, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e },	// U+254B (╋)
-}; // 1
-
-static const unsigned char scientificab_block60[][12] = {
 	{ 0x00, 0x00, 0x00, 0x00, 0x1f, 0x00, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+2550 (═)
 	{ 0x00, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a },	// U+2551 (║)
 	{ 0x00, 0x00, 0x00, 0x00, 0x1c, 0x04, 0x1c, 0x04, 0x04, 0x04, 0x04, 0x04 },	// U+2552 (╒)
@@ -880,17 +703,8 @@ static const unsigned char scientificab_block60[][12] = {
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04 },	// U+256E (╮)
 	{ 0x00, 0x04, 0x04, 0x04, 0x04, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+256F (╯)
 	{ 0x00, 0x04, 0x04, 0x04, 0x04, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+2570 (╰)
-}; // 33
-
-static const unsigned char scientificab_block61[][12] = {
 	{ 0x00, 0x00, 0x00, 0x00, 0x1c, 0x1f, 0x1c, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+257C (╼)
-}; // 1
-
-static const unsigned char scientificab_block62[][12] = {
 	{ 0x00, 0x00, 0x00, 0x00, 0x07, 0x1f, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+257E (╾)
-}; // 1
-
-static const unsigned char scientificab_block63[][12] = {
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1f },	// U+2581 (▁)
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1f, 0x1f },	// U+2582 (▂)
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1f, 0x1f, 0x1f },	// U+2583 (▃)
@@ -901,135 +715,66 @@ static const unsigned char scientificab_block63[][12] = {
 	{ 0x00, 0x1f, 0x1f, 0x1f, 0x1f, 0x1f, 0x1f, 0x1f, 0x1f, 0x1f, 0x1f, 0x1f },	// U+2588 (█)
 	{ 0x00, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f },	// U+2589 (▉)
 	{ 0x00, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f },	// U+258A (▊)
-}; // 10
-
-static const unsigned char scientificab_block64[][12] = {
 	{ 0x00, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01 },	// U+258F (▏)
-}; // 1
-
-static const unsigned char scientificab_block65[][12] = {
 	{ 0x00, 0x11, 0x04, 0x11, 0x04, 0x11, 0x04, 0x11, 0x04, 0x11, 0x04, 0x11 },	// U+2591 (░)
 	{ 0x00, 0x15, 0x0a, 0x15, 0x0a, 0x15, 0x0a, 0x15, 0x0a, 0x15, 0x0a, 0x15 },	// U+2592 (▒)
 	{ 0x00, 0x15, 0x1b, 0x15, 0x1b, 0x15, 0x1b, 0x15, 0x1b, 0x15, 0x1b, 0x15 },	// U+2593 (▓)
-}; // 3
-
-static const unsigned char scientificab_block66[][12] = {
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x0f, 0x09, 0x09, 0x0f, 0x00, 0x00, 0x00 },	// U+25A1 (□)
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x09, 0x09, 0x06, 0x00, 0x00, 0x00 },	// U+25A2 (▢)
-}; // 2
-
-static const unsigned char scientificab_block67[][12] = {
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x06, 0x00, 0x00, 0x00, 0x00 },	// U+25AA (▪)
-}; // 1
-
-static const unsigned char scientificab_block68[][12] = {
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x0e, 0x1f, 0x00, 0x00, 0x00 },	// U+25B2 (▲)
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x0a, 0x1f, 0x00, 0x00, 0x00 },	// U+25B3 (△)
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x0e, 0x00, 0x00, 0x00 },	// U+25B4 (▴)
-}; // 3
-
-static const unsigned char scientificab_block69[][12] = {
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x07, 0x1f, 0x07, 0x01, 0x00, 0x00 },	// U+25B6 (▶)
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x07, 0x19, 0x07, 0x01, 0x00, 0x00 },	// U+25B7 (▷)
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x03, 0x07, 0x03, 0x01, 0x00, 0x00 },	// U+25B8 (▸)
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x03, 0x05, 0x03, 0x01, 0x00, 0x00 },	// U+25B9 (▹)
-}; // 4
-
-static const unsigned char scientificab_block70[][12] = {
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1f, 0x0e, 0x04, 0x00, 0x00, 0x00 },	// U+25BC (▼)
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1f, 0x0a, 0x04, 0x00, 0x00, 0x00 },	// U+25BD (▽)
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x02, 0x00, 0x00, 0x00 },	// U+25BE (▾)
-}; // 3
-
-static const unsigned char scientificab_block71[][12] = {
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x1c, 0x1f, 0x1c, 0x10, 0x00, 0x00 },	// U+25C0 (◀)
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x1c, 0x13, 0x1c, 0x10, 0x00, 0x00 },	// U+25C1 (◁)
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x06, 0x07, 0x06, 0x04, 0x00, 0x00 },	// U+25C2 (◂)
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x06, 0x05, 0x06, 0x04, 0x00, 0x00 },	// U+25C3 (◃)
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+25C4 (◄)
-}; // 5
-
-static const unsigned char scientificab_block72[][12] = {
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x09, 0x0f, 0x06, 0x00, 0x00 },	// U+25D2 (◒)
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x0f, 0x09, 0x06, 0x00, 0x00 },	// U+25D3 (◓)
-}; // 2
-
-static const unsigned char scientificab_block73[][12] = {
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x0d, 0x0f, 0x06, 0x00, 0x00 },	// U+25D5 (◕)
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x03, 0x03, 0x02, 0x00, 0x00 },	// U+25D6 (◖)
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x0c, 0x0c, 0x04, 0x00, 0x00 },	// U+25D7 (◗)
-}; // 3
-
-static const unsigned char scientificab_block74[][12] = {
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x0f, 0x0b, 0x0f, 0x0f, 0x00, 0x00, 0x00 },	// U+25E7 (◧)
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x0f, 0x0d, 0x0d, 0x0f, 0x00, 0x00, 0x00 },	// U+25E8 (◨)
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x0f, 0x0f, 0x0b, 0x0f, 0x00, 0x00, 0x00 },	// U+25E9 (◩)
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x0f, 0x0d, 0x0f, 0x0f, 0x00, 0x00, 0x00 },	// U+25EA (◪)
-}; // 4
-
-static const unsigned char scientificab_block75[][12] = {
 	{ 0x00, 0x00, 0x00, 0x00, 0x04, 0x15, 0x0e, 0x1f, 0x0e, 0x15, 0x04, 0x00 },	// U+2600 (☀)
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x0e, 0x1f, 0x00, 0x00, 0x00, 0x00 },	// U+2601 (☁)
 	{ 0x00, 0x00, 0x00, 0x0e, 0x1f, 0x1f, 0x04, 0x04, 0x05, 0x05, 0x02, 0x00 },	// U+2602 (☂)
-}; // 3
-
-static const unsigned char scientificab_block76[][12] = {
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x0a, 0x15, 0x11, 0x0a, 0x04, 0x00, 0x00 },	// U+2661 (♡)
-}; // 1
-
-static const unsigned char scientificab_block77[][12] = {
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x0a, 0x1f, 0x1f, 0x0e, 0x04, 0x00, 0x00 },	// U+2665 (♥)
-}; // 1
-
-static const unsigned char scientificab_block78[][12] = {
 	{ 0x00, 0x00, 0x00, 0x00, 0x02, 0x02, 0x02, 0x02, 0x03, 0x03, 0x00, 0x00 },	// U+2669 (♩)
 	{ 0x00, 0x00, 0x00, 0x00, 0x06, 0x02, 0x02, 0x02, 0x03, 0x03, 0x00, 0x00 },	// U+266A (♪)
 	{ 0x00, 0x00, 0x00, 0x00, 0x12, 0x1e, 0x12, 0x12, 0x1b, 0x1b, 0x00, 0x00 },	// U+266B (♫)
 	{ 0x00, 0x00, 0x00, 0x00, 0x1e, 0x12, 0x1e, 0x12, 0x1b, 0x1b, 0x00, 0x00 },	// U+266C (♬)
-}; // 4
-
-static const unsigned char scientificab_block79[][12] = {
 	{ 0x00, 0x00, 0x00, 0x00, 0x10, 0x10, 0x08, 0x09, 0x06, 0x04, 0x00, 0x00 },	// U+2713 (✓)
 	{ 0x00, 0x00, 0x00, 0x00, 0x10, 0x18, 0x09, 0x0f, 0x06, 0x04, 0x00, 0x00 },	// U+2714 (✔)
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x0a, 0x04, 0x0a, 0x11, 0x00, 0x00 },	// U+2715 (✕)
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x1b, 0x0e, 0x04, 0x0e, 0x1b, 0x00, 0x00 },	// U+2716 (✖)
 	{ 0x00, 0x00, 0x08, 0x08, 0x05, 0x06, 0x06, 0x06, 0x09, 0x09, 0x00, 0x00 },	// U+2717 (✗)
 	{ 0x00, 0x00, 0x08, 0x08, 0x05, 0x05, 0x06, 0x06, 0x09, 0x09, 0x00, 0x00 },	// U+2718 (✘)
-}; // 6
-
-static const unsigned char scientificab_block80[][12] = {
 	{ 0x00, 0x00, 0x00, 0x00, 0x04, 0x04, 0x1f, 0x0e, 0x0e, 0x11, 0x00, 0x00 },	// U+272E (✮)
-}; // 1
-
-static const unsigned char scientificab_block81[][12] = {
 	{ 0x00, 0x00, 0x00, 0x04, 0x1b, 0x15, 0x0e, 0x15, 0x1b, 0x04, 0x00, 0x00 },	// U+2744 (❄)
-}; // 1
-
-static const unsigned char scientificab_block82[][12] = {
 	{ 0x00, 0x00, 0x00, 0x18, 0x0c, 0x06, 0x03, 0x06, 0x0c, 0x18, 0x00, 0x00 },	// U+276E (❮)
 	{ 0x00, 0x00, 0x00, 0x03, 0x06, 0x0c, 0x18, 0x0c, 0x06, 0x03, 0x00, 0x00 },	// U+276F (❯)
 	{ 0x00, 0x00, 0x00, 0x1c, 0x0e, 0x07, 0x03, 0x07, 0x0e, 0x1c, 0x00, 0x00 },	// U+2770 (❰)
 	{ 0x00, 0x00, 0x00, 0x07, 0x0e, 0x1c, 0x18, 0x1c, 0x0e, 0x07, 0x00, 0x00 },	// U+2771 (❱)
-}; // 4
-
-static const unsigned char scientificab_block83[][12] = {
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x02, 0x02, 0x02, 0x07, 0x00, 0x00 },	// U+27C2 (⟂)
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x0e, 0x01, 0x05, 0x01, 0x0e, 0x00, 0x00 },	// U+27C3 (⟃)
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x08, 0x0a, 0x08, 0x07, 0x00, 0x00 },	// U+27C4 (⟄)
-}; // 3
-
-static const unsigned char scientificab_block84[][12] = {
 	{ 0x00, 0x00, 0x00, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x1f, 0x00, 0x00 },	// U+27D8 (⟘)
 	{ 0x00, 0x00, 0x00, 0x1f, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x00, 0x00 },	// U+27D9 (⟙)
-}; // 2
-
-static const unsigned char scientificab_block85[][12] = {
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x1d, 0x02, 0x00, 0x00, 0x00 },	// U+27DC (⟜)
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x1f, 0x01, 0x00, 0x00, 0x00 },	// U+27DD (⟝)
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x1f, 0x10, 0x00, 0x00, 0x00 },	// U+27DE (⟞)
-}; // 3
-
-static const unsigned char scientificab_block86[][12] = {
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x04, 0x00, 0x05, 0x00, 0x01 },	// U+287D (⡽)
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x05, 0x00, 0x05, 0x00, 0x01 },	// U+287E (⡾)
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x05, 0x00, 0x05, 0x00, 0x01 },	// U+287F (⡿)
@@ -1161,59 +906,32 @@ static const unsigned char scientificab_block86[][12] = {
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x04, 0x00, 0x05, 0x00, 0x05 },	// U+28FD (⣽)
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x05, 0x00, 0x05, 0x00, 0x05 },	// U+28FE (⣾)
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x05, 0x00, 0x05, 0x00, 0x05 },	// U+28FF (⣿)
-}; // 131
-
-static const unsigned char scientificab_block87[][12] = {
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x08, 0x07, 0x08, 0x10, 0x00, 0x00 },	// U+2919 (⤙)
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x02, 0x1c, 0x02, 0x01, 0x00, 0x00 },	// U+291A (⤚)
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x14, 0x0b, 0x14, 0x08, 0x00, 0x00 },	// U+291B (⤛)
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x05, 0x1a, 0x05, 0x02, 0x00, 0x00 },	// U+291C (⤜)
-}; // 4
-
-static const unsigned char scientificab_block88[][12] = {
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x1f, 0x00, 0x1f, 0x00, 0x00, 0x00, 0x00 },	// U+2B5E (⭞)
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1f, 0x00, 0x00, 0x00, 0x00 },	// U+2B5F (⭟)
 	{ 0x00, 0x00, 0x01, 0x05, 0x0f, 0x05, 0x05, 0x07, 0x01, 0x01, 0x00, 0x00 },	// U+2B60 (⭠)
 	{ 0x00, 0x00, 0x01, 0x01, 0x01, 0x01, 0x17, 0x1c, 0x14, 0x14, 0x00, 0x00 },	// U+2B61 (⭡)
 	{ 0x00, 0x00, 0x06, 0x02, 0x03, 0x0a, 0x1a, 0x0b, 0x08, 0x18, 0x00, 0x00 },	// U+2B62 (⭢)
-}; // 5
-
-static const unsigned char scientificab_block89[][12] = {
 	{ 0x00, 0x00, 0x00, 0x06, 0x09, 0x09, 0x0f, 0x0f, 0x0b, 0x0f, 0x00, 0x00 },	// U+2B64 (⭤)
-}; // 1
-
-static const unsigned char scientificab_block90[][12] = {
 	{ 0x00, 0x01, 0x03, 0x07, 0x0f, 0x1f, 0x0f, 0x07, 0x03, 0x01, 0x00, 0x00 },	// U+2B80 (⮀)
 	{ 0x00, 0x01, 0x02, 0x04, 0x08, 0x10, 0x08, 0x04, 0x02, 0x01, 0x00, 0x00 },	// U+2B81 (⮁)
 	{ 0x00, 0x10, 0x18, 0x1c, 0x1e, 0x1f, 0x1e, 0x1c, 0x18, 0x10, 0x00, 0x00 },	// U+2B82 (⮂)
 	{ 0x00, 0x10, 0x08, 0x04, 0x02, 0x01, 0x02, 0x04, 0x08, 0x10, 0x00, 0x00 },	// U+2B83 (⮃)
-}; // 4
-
-static const unsigned char scientificab_block91[][12] = {
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x00, 0x09, 0x06, 0x00, 0x00 },	// U+30C3 (ッ)
 	{ 0x00, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x09, 0x09, 0x06, 0x00, 0x00 },	// U+30C4 (ツ)
-}; // 2
-
-static const unsigned char scientificab_block92[][12] = {
 	{ 0x00, 0x00, 0x00, 0x1d, 0x05, 0x05, 0x1f, 0x14, 0x14, 0x17, 0x00, 0x00 },	// U+5350 (卐)
-}; // 1
-
-static const unsigned char scientificab_block93[][12] = {
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1f, 0x00, 0x1f, 0x00, 0x00, 0x00 },	// U+E09E ()
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1f, 0x00, 0x00, 0x00, 0x00 },	// U+E09F ()
 	{ 0x00, 0x00, 0x01, 0x05, 0x0f, 0x05, 0x05, 0x03, 0x01, 0x01, 0x00, 0x00 },	// U+E0A0 ()
 	{ 0x00, 0x00, 0x01, 0x01, 0x01, 0x03, 0x06, 0x0a, 0x0a, 0x0a, 0x00, 0x00 },	// U+E0A1 ()
 	{ 0x00, 0x00, 0x00, 0x06, 0x09, 0x09, 0x0f, 0x0b, 0x0b, 0x0f, 0x00, 0x00 },	// U+E0A2 ()
-}; // 5
-
-static const unsigned char scientificab_block94[][12] = {
 	{ 0x00, 0x01, 0x03, 0x07, 0x0f, 0x1f, 0x1f, 0x0f, 0x07, 0x03, 0x01, 0x00 },	// U+E0B0 ()
 	{ 0x00, 0x01, 0x02, 0x04, 0x08, 0x10, 0x10, 0x08, 0x04, 0x02, 0x01, 0x00 },	// U+E0B1 ()
 	{ 0x00, 0x10, 0x18, 0x1c, 0x1e, 0x1f, 0x1f, 0x1e, 0x1c, 0x18, 0x10, 0x00 },	// U+E0B2 ()
 	{ 0x00, 0x10, 0x08, 0x04, 0x02, 0x01, 0x01, 0x02, 0x04, 0x08, 0x10, 0x00 },	// U+E0B3 ()
-}; // 4
-
-static const unsigned char scientificab_block95[][12] = {
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x05, 0x0a, 0x15, 0x12, 0x00, 0x00 },	// U+E0C0 ()
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x08, 0x10, 0x08, 0x04, 0x00, 0x00 },	// U+E0C1 ()
 	{ 0x00, 0x00, 0x00, 0x0a, 0x0a, 0x1f, 0x0e, 0x0e, 0x04, 0x04, 0x04, 0x00 },	// U+E0C2 ()
@@ -1221,17 +939,8 @@ static const unsigned char scientificab_block95[][12] = {
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x1a, 0x04, 0x1a, 0x05, 0x00, 0x00 },	// U+E0C4 ()
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x0f, 0x00, 0x0f, 0x10, 0x00, 0x00 },	// U+E0C5 ()
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x14, 0x0b, 0x04, 0x0b, 0x14, 0x00, 0x00 },	// U+E0C6 ()
-}; // 7
-
-static const unsigned char scientificab_block96[][12] = {
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x02, 0x01, 0x02, 0x04, 0x00, 0x00 },	// U+E0D1 ()
-}; // 1
-
-static const unsigned char scientificab_block97[][12] = {
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x0f, 0x0f, 0x09, 0x09, 0x0f, 0x00, 0x00 },	// U+F031 ()
-}; // 1
-
-static const unsigned char scientificab_block98[][12] = {
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x06, 0x07, 0x06, 0x04, 0x00, 0x00 },	// U+F033 ()
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x03, 0x07, 0x03, 0x01, 0x00, 0x00 },	// U+F034 ()
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x0e, 0x1f, 0x00, 0x00, 0x00 },	// U+F035 ()
@@ -1243,38 +952,17 @@ static const unsigned char scientificab_block98[][12] = {
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x05, 0x05, 0x05, 0x00, 0x00 },	// U+F03B ()
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0f, 0x0f, 0x0f, 0x0f, 0x00, 0x00 },	// U+F03C ()
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x0f, 0x0f, 0x06, 0x00, 0x00 },	// U+F03D ()
-}; // 11
-
-static const unsigned char scientificab_block99[][12] = {
 	{ 0x00, 0x00, 0x00, 0x00, 0x01, 0x03, 0x0f, 0x0f, 0x0f, 0x03, 0x01, 0x00 },	// U+F057 ()
 	{ 0x00, 0x00, 0x00, 0x00, 0x08, 0x0c, 0x0f, 0x0f, 0x0f, 0x0c, 0x08, 0x00 },	// U+F058 ()
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x0a, 0x1f, 0x1f, 0x0e, 0x04, 0x00, 0x00 },	// U+F059 ()
-}; // 3
-
-static const unsigned char scientificab_block100[][12] = {
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x1b, 0x0e, 0x04, 0x00, 0x00 },	// U+F061 ()
-}; // 1
-
-static const unsigned char scientificab_block101[][12] = {
 	{ 0x00, 0x00, 0x00, 0x06, 0x0f, 0x19, 0x19, 0x0c, 0x06, 0x06, 0x00, 0x06 },	// U+F073 ()
-}; // 1
-
-static const unsigned char scientificab_block102[][12] = {
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x0e, 0x13, 0x15, 0x19, 0x0e, 0x00, 0x00 },	// U+F078 ()
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x0e, 0x11, 0x1f, 0x11, 0x0e, 0x00, 0x00 },	// U+F079 ()
-}; // 2
-
-static const unsigned char scientificab_block103[][12] = {
 	{ 0x00, 0x00, 0x00, 0x00, 0x08, 0x04, 0x0e, 0x07, 0x02, 0x01, 0x00, 0x00 },	// U+F07E ()
-}; // 1
-
-static const unsigned char scientificab_block104[][12] = {
 	{ 0x00, 0x00, 0x00, 0x06, 0x09, 0x09, 0x0f, 0x0b, 0x0b, 0x0f, 0x00, 0x00 },	// U+F0CF ()
 	{ 0x00, 0x00, 0x06, 0x09, 0x08, 0x08, 0x0f, 0x0b, 0x0b, 0x0f, 0x00, 0x00 },	// U+F0D0 ()
 	{ 0x00, 0x00, 0x00, 0x00, 0x06, 0x06, 0x02, 0x02, 0x02, 0x05, 0x02, 0x00 },	// U+F0D1 ()
-}; // 3
-
-static const unsigned char scientificab_block105[][12] = {
 	{ 0x00, 0x00, 0x00, 0x04, 0x12, 0x0f, 0x19, 0x09, 0x0f, 0x15, 0x00, 0x00 },	// U+F0D5 ()
 	{ 0x00, 0x00, 0x08, 0x05, 0x12, 0x0f, 0x19, 0x1d, 0x1f, 0x1f, 0x00, 0x00 },	// U+F0D6 ()
 	{ 0x00, 0x00, 0x00, 0x00, 0x06, 0x19, 0x1d, 0x1e, 0x00, 0x00, 0x00, 0x00 },	// U+F0D7 ()
@@ -1283,18 +971,78 @@ static const unsigned char scientificab_block105[][12] = {
 	{ 0x00, 0x00, 0x00, 0x00, 0x08, 0x1e, 0x1f, 0x00, 0x15, 0x00, 0x0a, 0x00 },	// U+F0DA ()
 	{ 0x00, 0x00, 0x00, 0x00, 0x08, 0x1e, 0x1f, 0x00, 0x15, 0x0a, 0x00, 0x00 },	// U+F0DB ()
 	{ 0x00, 0x00, 0x00, 0x00, 0x08, 0x1e, 0x1f, 0x08, 0x0c, 0x04, 0x02, 0x00 },	// U+F0DC ()
-}; // 8
-
-static const unsigned char scientificab_block106[][12] = {
 	{ 0x00, 0x00, 0x0a, 0x05, 0x00, 0x08, 0x14, 0x00, 0x0a, 0x05, 0x00, 0x00 },	// U+F0DE ()
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x0a, 0x15, 0x0a, 0x15, 0x00, 0x00 },	// U+F0DF ()
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x0e, 0x1d, 0x19, 0x19, 0x0e, 0x00, 0x00 },	// U+F0E0 ()
-}; // 3
-
-static const unsigned char scientificab_block107[][12] = {
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x04, 0x11, 0x0a, 0x00, 0x00 },	// U+F0ED ()
 	{ 0x00, 0x00, 0x0a, 0x11, 0x04, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+F0EE ()
 	{ 0x00, 0x00, 0x00, 0x00, 0x04, 0x08, 0x00, 0x06, 0x00, 0x08, 0x04, 0x00 },	// U+F0EF ()
 	{ 0x00, 0x00, 0x00, 0x00, 0x02, 0x01, 0x00, 0x06, 0x00, 0x01, 0x02, 0x00 },	// U+F0F0 ()
-}; // 4
+}; // 973
+
+static const uint8_t scientificab_page_index[] = {
+	0x01, 0x02, 0x03, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x00,
+	0x07, 0x08, 0x09, 0x0a, 0x00, 0x0b, 0x0c, 0x0d, 0x0e, 0x0f, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00,
+	0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x12, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x14,
+}; // 241
+
+static const uint32_t scientificab_page_bits[][8] = {
+	{ 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000 },	// Empty
+	{ 0x00000000, 0xffffffff, 0xffffffff, 0x7fffffff, 0x00000000, 0xffffffff, 0xffffffff, 0xffffffff },	// U+00xx
+	{ 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0x007fffff, 0x001fff80, 0x00000000 },	// U+01xx
+	{ 0x0ffbf000, 0x00000000, 0x00000000, 0x00000000, 0x00400000, 0x00000000, 0x04000080, 0x00000000 },	// U+02xx
+	{ 0x00000000, 0x00000000, 0x00000000, 0x00000010, 0xfffe0000, 0xfffe03ff, 0x000003ff, 0x00000000 },	// U+03xx
+	{ 0x00000000, 0x30000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000 },	// U+0Fxx
+	{ 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x40000000, 0x00000000, 0x00000000, 0x00000000 },	// U+1Exx
+	{ 0xffff0000, 0xd7fc00ff, 0x00038007, 0x00000000, 0x00000000, 0x00001000, 0x00000000, 0x00000000 },	// U+20xx
+	{ 0x00000000, 0x00000004, 0x00000000, 0x00000000, 0x03ff0000, 0xfe1e06f0, 0x000f02df, 0x00000000 },	// U+21xx
+	{ 0x671fffff, 0x00f00e00, 0x00000100, 0x04000033, 0xc26000fc, 0x00000bff, 0x00000070, 0x00000000 },	// U+22xx
+	{ 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x3c000000, 0x00000000, 0x0ff01e00 },	// U+23xx
+	{ 0x3ffffc0f, 0x99999939, 0xffff0804, 0x5001ffff, 0x000e87fe, 0x73dc0406, 0x00ec001f, 0x00000780 },	// U+25xx
+	{ 0x00000007, 0x00000000, 0x00000000, 0x00001e22, 0x00000000, 0x00000000, 0x00000000, 0x00000000 },	// U+26xx
+	{ 0x01f80000, 0x00004000, 0x00000010, 0x0003c000, 0x00000000, 0x00000000, 0x7300001c, 0x00000000 },	// U+27xx
+	{ 0x00000000, 0x00000000, 0x00000000, 0xe0000000, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff },	// U+28xx
+	{ 0x1e000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000 },	// U+29xx
+	{ 0x00000000, 0x00000000, 0xc0000000, 0x00000017, 0x0000000f, 0x00000000, 0x00000000, 0x00000000 },	// U+2Bxx
+	{ 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000018, 0x00000000 },	// U+30xx
+	{ 0x00000000, 0x00000000, 0x00010000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000 },	// U+53xx
+	{ 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xc0000000, 0x000f0007, 0x0002007f, 0x00000000 },	// U+E0xx
+	{ 0x00000000, 0x3ffa0000, 0x03800000, 0x43080002, 0x00000000, 0x00000000, 0xdfe38000, 0x0001e001 },	// U+F0xx
+}; // 21
 
+static const uint16_t scientificab_page_base[][8] = {
+	{ 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000 },	// Empty
+	{ 0x0000, 0x0000, 0x0020, 0x0040, 0x005f, 0x005f, 0x007f, 0x009f },	// U+00xx
+	{ 0x00bf, 0x00df, 0x00ff, 0x011f, 0x013f, 0x015f, 0x0176, 0x0184 },	// U+01xx
+	{ 0x0184, 0x0193, 0x0193, 0x0193, 0x0193, 0x0194, 0x0194, 0x0196 },	// U+02xx
+	{ 0x0196, 0x0196, 0x0196, 0x0196, 0x0197, 0x01a6, 0x01bf, 0x01c9 },	// U+03xx
+	{ 0x01c9, 0x01c9, 0x01cb, 0x01cb, 0x01cb, 0x01cb, 0x01cb, 0x01cb },	// U+0Fxx
+	{ 0x01cb, 0x01cb, 0x01cb, 0x01cb, 0x01cb, 0x01cc, 0x01cc, 0x01cc },	// U+1Exx
+	{ 0x01cc, 0x01dc, 0x01f0, 0x01f6, 0x01f6, 0x01f6, 0x01f7, 0x01f7 },	// U+20xx
+	{ 0x01f7, 0x01f7, 0x01f8, 0x01f8, 0x01f8, 0x0202, 0x0213, 0x021f },	// U+21xx
+	{ 0x021f, 0x0239, 0x0240, 0x0241, 0x0246, 0x0251, 0x025c, 0x025f },	// U+22xx
+	{ 0x025f, 0x025f, 0x025f, 0x025f, 0x025f, 0x025f, 0x0263, 0x0263 },	// U+23xx
+	{ 0x026f, 0x0287, 0x0297, 0x02a9, 0x02bc, 0x02ca, 0x02d7, 0x02e1 },	// U+25xx
+	{ 0x02e5, 0x02e8, 0x02e8, 0x02e8, 0x02ee, 0x02ee, 0x02ee, 0x02ee },	// U+26xx
+	{ 0x02ee, 0x02f4, 0x02f5, 0x02f6, 0x02fa, 0x02fa, 0x02fa, 0x0302 },	// U+27xx
+	{ 0x0302, 0x0302, 0x0302, 0x0302, 0x0305, 0x0325, 0x0345, 0x0365 },	// U+28xx
+	{ 0x0385, 0x0389, 0x0389, 0x0389, 0x0389, 0x0389, 0x0389, 0x0389 },	// U+29xx
+	{ 0x0389, 0x0389, 0x0389, 0x038b, 0x038f, 0x0393, 0x0393, 0x0393 },	// U+2Bxx
+	{ 0x0393, 0x0393, 0x0393, 0x0393, 0x0393, 0x0393, 0x0393, 0x0395 },	// U+30xx
+	{ 0x0395, 0x0395, 0x0395, 0x0396, 0x0396, 0x0396, 0x0396, 0x0396 },	// U+53xx
+	{ 0x0396, 0x0396, 0x0396, 0x0396, 0x0396, 0x0398, 0x039f, 0x03a7 },	// U+E0xx
+	{ 0x03a7, 0x03a7, 0x03b3, 0x03b6, 0x03bb, 0x03bb, 0x03bb, 0x03c8 },	// U+F0xx
+}; // 21
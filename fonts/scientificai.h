@@ -4,7 +4,7 @@
 * With FBInk's tools/hextoc.py
 */
 
-static const unsigned char scientificai_block1[][12] = {
+static const unsigned char scientificai_glyphs[][12] = {
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+0020 ( )
 	{ 0x00, 0x00, 0x00, 0x10, 0x10, 0x10, 0x10, 0x10, 0x00, 0x10, 0x00, 0x00 },	// U+0021 (!)
 	{ 0x00, 0x00, 0x00, 0x28, 0x28, 0x28, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+0022 (")
@@ -100,9 +100,6 @@ static const unsigned char scientificai_block1[][12] = {
 	{ 0x00, 0x00, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x00 },	// U+007C (|)
 	{ 0x00, 0x00, 0x08, 0x10, 0x10, 0x10, 0x60, 0x10, 0x10, 0x10, 0x08, 0x00 },	// U+007D (})
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x54, 0x20, 0x00, 0x00, 0x00, 0x00 },	// U+007E (~)
-}; // 95
-
-static const unsigned char scientificai_block2[][12] = {
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+00A0 ( )
 	{ 0x00, 0x00, 0x10, 0x00, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x00, 0x00 },	// U+00A1 (¡)
 	{ 0x00, 0x00, 0x00, 0x00, 0x08, 0x18, 0x2c, 0x0c, 0x2c, 0x18, 0x08, 0x00 },	// U+00A2 (¢)
@@ -382,9 +379,6 @@ static const unsigned char scientificai_block2[][12] = {
 	{ 0x00, 0x00, 0x00, 0x00, 0x20, 0x54, 0x14, 0x14, 0x14, 0x18, 0x14, 0x18 },	// U+01B4 (ƴ)
 	{ 0x00, 0x00, 0x00, 0x3c, 0x20, 0x10, 0x3c, 0x08, 0x04, 0x3c, 0x00, 0x00 },	// U+01B5 (Ƶ)
 	{ 0x00, 0x00, 0x00, 0x00, 0x3c, 0x20, 0x10, 0x3c, 0x08, 0x3c, 0x00, 0x00 },	// U+01B6 (ƶ)
-}; // 279
-
-static const unsigned char scientificai_block3[][12] = {
 	{ 0x00, 0x00, 0x00, 0x34, 0x24, 0x24, 0x24, 0x24, 0x24, 0x2c, 0x20, 0x18 },	// U+01C7 (Ǉ)
 	{ 0x00, 0x00, 0x00, 0x24, 0x04, 0x24, 0x24, 0x24, 0x24, 0x2c, 0x20, 0x10 },	// U+01C8 (ǈ)
 	{ 0x00, 0x00, 0x00, 0x2c, 0x08, 0x28, 0x28, 0x28, 0x28, 0x28, 0x20, 0x10 },	// U+01C9 (ǉ)
@@ -399,9 +393,6 @@ static const unsigned char scientificai_block3[][12] = {
 	{ 0x00, 0x00, 0x14, 0x08, 0x00, 0x18, 0x24, 0x24, 0x24, 0x18, 0x00, 0x00 },	// U+01D2 (ǒ)
 	{ 0x00, 0x14, 0x08, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x18, 0x00, 0x00 },	// U+01D3 (Ǔ)
 	{ 0x00, 0x00, 0x14, 0x08, 0x00, 0x24, 0x24, 0x24, 0x24, 0x38, 0x00, 0x00 },	// U+01D4 (ǔ)
-}; // 14
-
-static const unsigned char scientificai_block4[][12] = {
 	{ 0x00, 0x14, 0x28, 0x18, 0x24, 0x24, 0x24, 0x24, 0x24, 0x18, 0x00, 0x00 },	// U+020C (Ȍ)
 	{ 0x00, 0x00, 0x14, 0x28, 0x00, 0x18, 0x24, 0x24, 0x24, 0x18, 0x00, 0x00 },	// U+020D (ȍ)
 	{ 0x00, 0x18, 0x24, 0x18, 0x24, 0x24, 0x24, 0x24, 0x24, 0x18, 0x00, 0x00 },	// U+020E (Ȏ)
@@ -418,29 +409,11 @@ static const unsigned char scientificai_block4[][12] = {
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x38, 0x04, 0x18, 0x20, 0x1c, 0x10, 0x08 },	// U+0219 (ș)
 	{ 0x00, 0x00, 0x00, 0x1c, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x04 },	// U+021A (Ț)
 	{ 0x00, 0x00, 0x00, 0x08, 0x08, 0x3c, 0x08, 0x08, 0x08, 0x30, 0x10, 0x08 },	// U+021B (ț)
-}; // 16
-
-static const unsigned char scientificai_block5[][12] = {
 	{ 0x00, 0x00, 0x00, 0x08, 0x08, 0x10, 0x20, 0x20, 0x24, 0x18, 0x00, 0x00 },	// U+0296 (ʖ)
-}; // 1
-
-static const unsigned char scientificai_block6[][12] = {
 	{ 0x00, 0x00, 0x38, 0x44, 0x44, 0x54, 0x54, 0x44, 0x44, 0x38, 0x00, 0x00 },	// U+0298 (ʘ)
-}; // 1
-
-static const unsigned char scientificai_block7[][12] = {
 	{ 0x00, 0x00, 0x00, 0x28, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+02C7 (ˇ)
-}; // 1
-
-static const unsigned char scientificai_block8[][12] = {
 	{ 0x00, 0x00, 0x10, 0x28, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+02DA (˚)
-}; // 1
-
-static const unsigned char scientificai_block9[][12] = {
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x24, 0x20, 0x20, 0x10, 0x00, 0x00 },	// U+0364 (ͤ)
-}; // 1
-
-static const unsigned char scientificai_block10[][12] = {
 	{ 0x00, 0x00, 0x00, 0x18, 0x24, 0x24, 0x3c, 0x24, 0x24, 0x24, 0x00, 0x00 },	// U+0391 (Α)
 	{ 0x00, 0x00, 0x00, 0x1c, 0x24, 0x24, 0x1c, 0x24, 0x24, 0x1c, 0x00, 0x00 },	// U+0392 (Β)
 	{ 0x00, 0x00, 0x00, 0x3c, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x00, 0x00 },	// U+0393 (Γ)
@@ -466,9 +439,6 @@ static const unsigned char scientificai_block10[][12] = {
 	{ 0x00, 0x00, 0x00, 0x24, 0x24, 0x18, 0x24, 0x24, 0x24, 0x24, 0x00, 0x00 },	// U+03A7 (Χ)
 	{ 0x00, 0x00, 0x00, 0x54, 0x54, 0x54, 0x38, 0x10, 0x10, 0x10, 0x00, 0x00 },	// U+03A8 (Ψ)
 	{ 0x00, 0x00, 0x00, 0x38, 0x44, 0x44, 0x44, 0x6c, 0x28, 0x6c, 0x00, 0x00 },	// U+03A9 (Ω)
-}; // 25
-
-static const unsigned char scientificai_block11[][12] = {
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x28, 0x14, 0x14, 0x28, 0x00, 0x00 },	// U+03B1 (α)
 	{ 0x00, 0x00, 0x00, 0x00, 0x0c, 0x14, 0x14, 0x2c, 0x24, 0x1c, 0x04, 0x04 },	// U+03B2 (β)
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x24, 0x18, 0x10, 0x28, 0x28, 0x10 },	// U+03B3 (γ)
@@ -494,18 +464,9 @@ static const unsigned char scientificai_block11[][12] = {
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x24, 0x18, 0x08, 0x14, 0x20, 0x00 },	// U+03C7 (χ)
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x54, 0x54, 0x38, 0x10, 0x10 },	// U+03C8 (ψ)
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x28, 0x44, 0x44, 0x54, 0x28, 0x00, 0x00 },	// U+03C9 (ω)
-}; // 25
-
-static const unsigned char scientificai_block12[][12] = {
 	{ 0x00, 0x00, 0x20, 0x50, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x08, 0x04 },	// U+0F3C (༼)
 	{ 0x00, 0x00, 0x08, 0x14, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x20, 0x40 },	// U+0F3D (༽)
-}; // 2
-
-static const unsigned char scientificai_block13[][12] = {
 	{ 0x00, 0x00, 0x00, 0x38, 0x24, 0x24, 0x14, 0x24, 0x24, 0x3c, 0x04, 0x04 },	// U+1E9E (ẞ)
-}; // 1
-
-static const unsigned char scientificai_block14[][12] = {
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x00, 0x00 },	// U+2010 (‐)
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x00, 0x00 },	// U+2011 (‑)
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3c, 0x00, 0x00, 0x00, 0x00 },	// U+2012 (‒)
@@ -530,9 +491,6 @@ static const unsigned char scientificai_block14[][12] = {
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x28, 0x00, 0x00 },	// U+2025 (‥)
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x54, 0x00, 0x00 },	// U+2026 (…)
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00 },	// U+2027 (‧)
-}; // 24
-
-static const unsigned char scientificai_block15[][12] = {
 	{ 0x00, 0x00, 0x00, 0x10, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+2032 (′)
 	{ 0x00, 0x00, 0x00, 0x50, 0x28, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+2033 (″)
 	{ 0x00, 0x00, 0x00, 0x28, 0x54, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+2034 (‴)
@@ -544,43 +502,19 @@ static const unsigned char scientificai_block15[][12] = {
 	{ 0x00, 0x00, 0x00, 0x00, 0x18, 0x08, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+203A (›)
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x28, 0x10, 0x28, 0x00, 0x00, 0x00 },	// U+203B (※)
 	{ 0x00, 0x00, 0x00, 0x14, 0x14, 0x14, 0x14, 0x14, 0x00, 0x14, 0x00, 0x00 },	// U+203C (‼)
-}; // 11
-
-static const unsigned char scientificai_block16[][12] = {
 	{ 0x00, 0x00, 0x00, 0x3c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+203E (‾)
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x24, 0x18, 0x00 },	// U+203F (‿)
 	{ 0x00, 0x00, 0x00, 0x18, 0x24, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+2040 (⁀)
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x10, 0x08, 0x14, 0x00, 0x00 },	// U+2041 (⁁)
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x14, 0x00, 0x00, 0x00, 0x00 },	// U+2042 (⁂)
-}; // 5
-
-static const unsigned char scientificai_block17[][12] = {
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x08, 0x10, 0x00 },	// U+204F (⁏)
 	{ 0x00, 0x00, 0x00, 0x00, 0x18, 0x24, 0x00, 0x00, 0x24, 0x18, 0x00, 0x00 },	// U+2050 (⁐)
 	{ 0x00, 0x00, 0x00, 0x14, 0x08, 0x14, 0x00, 0x14, 0x08, 0x14, 0x00, 0x00 },	// U+2051 (⁑)
-}; // 3
-
-static const unsigned char scientificai_block18[][12] = {
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x54, 0x10, 0x7c, 0x10, 0x54, 0x00, 0x00 },	// U+205C (⁜)
-}; // 1
-
-static const unsigned char scientificai_block19[][12] = {
 	{ 0x00, 0x00, 0x7c, 0x20, 0x7c, 0x20, 0x1c, 0x08, 0x10, 0x20, 0x00, 0x00 },	// U+20A8 (₨)
-}; // 1
-
-static const unsigned char scientificai_block20[][12] = {
 	{ 0x00, 0x00, 0x00, 0x5c, 0x54, 0x54, 0x44, 0x54, 0x54, 0x74, 0x00, 0x00 },	// U+20AA (₪)
-}; // 1
-
-static const unsigned char scientificai_block21[][12] = {
 	{ 0x00, 0x00, 0x00, 0x00, 0x38, 0x04, 0x1c, 0x1c, 0x04, 0x38, 0x00, 0x00 },	// U+20AC (€)
-}; // 1
-
-static const unsigned char scientificai_block22[][12] = {
 	{ 0x00, 0x38, 0x10, 0x10, 0x10, 0x28, 0x38, 0x28, 0x28, 0x00, 0x00, 0x00 },	// U+2122 (™)
-}; // 1
-
-static const unsigned char scientificai_block23[][12] = {
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x08, 0x7c, 0x08, 0x10, 0x00, 0x00 },	// U+2190 (←)
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x38, 0x54, 0x10, 0x10, 0x00, 0x00 },	// U+2191 (↑)
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x20, 0x7c, 0x20, 0x10, 0x00, 0x00 },	// U+2192 (→)
@@ -591,21 +525,12 @@ static const unsigned char scientificai_block23[][12] = {
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0x30, 0x08, 0x04, 0x00, 0x00 },	// U+2197 (↗)
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x08, 0x30, 0x30, 0x00, 0x00 },	// U+2198 (↘)
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x10, 0x0c, 0x0c, 0x00, 0x00 },	// U+2199 (↙)
-}; // 10
-
-static const unsigned char scientificai_block24[][12] = {
 	{ 0x00, 0x00, 0x00, 0x00, 0x50, 0x48, 0x7c, 0x48, 0x50, 0x00, 0x00, 0x00 },	// U+21A4 (↤)
 	{ 0x00, 0x00, 0x00, 0x00, 0x10, 0x38, 0x54, 0x10, 0x7c, 0x00, 0x00, 0x00 },	// U+21A5 (↥)
 	{ 0x00, 0x00, 0x00, 0x00, 0x14, 0x24, 0x7c, 0x24, 0x14, 0x00, 0x00, 0x00 },	// U+21A6 (↦)
 	{ 0x00, 0x00, 0x00, 0x00, 0x7c, 0x10, 0x54, 0x38, 0x10, 0x00, 0x00, 0x00 },	// U+21A7 (↧)
-}; // 4
-
-static const unsigned char scientificai_block25[][12] = {
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x48, 0x7c, 0x08, 0x00, 0x00, 0x00 },	// U+21A9 (↩)
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x24, 0x7c, 0x20, 0x00, 0x00, 0x00 },	// U+21AA (↪)
-}; // 2
-
-static const unsigned char scientificai_block26[][12] = {
 	{ 0x00, 0x00, 0x00, 0x08, 0x3c, 0x28, 0x20, 0x20, 0x20, 0x20, 0x00, 0x00 },	// U+21B0 (↰)
 	{ 0x00, 0x00, 0x00, 0x10, 0x3c, 0x14, 0x04, 0x04, 0x04, 0x04, 0x00, 0x00 },	// U+21B1 (↱)
 	{ 0x00, 0x00, 0x00, 0x20, 0x20, 0x20, 0x20, 0x28, 0x3c, 0x08, 0x00, 0x00 },	// U+21B2 (↲)
@@ -614,9 +539,6 @@ static const unsigned char scientificai_block26[][12] = {
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x40, 0x48, 0x7c, 0x08, 0x00, 0x00 },	// U+21B5 (↵)
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0x48, 0x48, 0x5c, 0x08, 0x00, 0x00 },	// U+21B6 (↶)
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x24, 0x24, 0x74, 0x24, 0x00, 0x00 },	// U+21B7 (↷)
-}; // 8
-
-static const unsigned char scientificai_block27[][12] = {
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+21B9 (↹)
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x64, 0x24, 0x24, 0x18, 0x00, 0x00 },	// U+21BA (↺)
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x4c, 0x48, 0x48, 0x30, 0x00, 0x00 },	// U+21BB (↻)
@@ -629,25 +551,16 @@ static const unsigned char scientificai_block27[][12] = {
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x10, 0x10, 0x30, 0x10, 0x00, 0x00 },	// U+21C2 (⇂)
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x08, 0x08, 0x0c, 0x08, 0x00, 0x00 },	// U+21C3 (⇃)
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x7c, 0x28, 0x7c, 0x08, 0x00, 0x00 },	// U+21C4 (⇄)
-}; // 12
-
-static const unsigned char scientificai_block28[][12] = {
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x7c, 0x28, 0x7c, 0x20, 0x00, 0x00 },	// U+21C6 (⇆)
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x7c, 0x08, 0x7c, 0x08, 0x00, 0x00 },	// U+21C7 (⇇)
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x28, 0x7c, 0x28, 0x28, 0x28, 0x00, 0x00 },	// U+21C8 (⇈)
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x7c, 0x20, 0x7c, 0x20, 0x00, 0x00 },	// U+21C9 (⇉)
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x28, 0x28, 0x28, 0x7c, 0x28, 0x00, 0x00 },	// U+21CA (⇊)
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x7c, 0x00, 0x7c, 0x20, 0x00, 0x00 },	// U+21CB (⇋)
-}; // 6
-
-static const unsigned char scientificai_block29[][12] = {
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x78, 0x04, 0x78, 0x10, 0x00, 0x00 },	// U+21D0 (⇐)
 	{ 0x00, 0x00, 0x00, 0x00, 0x10, 0x28, 0x6c, 0x28, 0x28, 0x28, 0x00, 0x00 },	// U+21D1 (⇑)
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x3c, 0x40, 0x3c, 0x10, 0x00, 0x00 },	// U+21D2 (⇒)
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x28, 0x28, 0x28, 0x6c, 0x28, 0x10, 0x00 },	// U+21D3 (⇓)
-}; // 4
-
-static const unsigned char scientificai_block30[][12] = {
 	{ 0x00, 0x00, 0x00, 0x00, 0x24, 0x24, 0x24, 0x3c, 0x24, 0x24, 0x18, 0x00 },	// U+2200 (∀)
 	{ 0x00, 0x00, 0x00, 0x18, 0x24, 0x14, 0x04, 0x24, 0x24, 0x18, 0x00, 0x00 },	// U+2201 (∁)
 	{ 0x00, 0x00, 0x00, 0x18, 0x24, 0x20, 0x38, 0x24, 0x24, 0x18, 0x00, 0x00 },	// U+2202 (∂)
@@ -669,78 +582,39 @@ static const unsigned char scientificai_block30[][12] = {
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3c, 0x00, 0x00, 0x00, 0x00 },	// U+2212 (−)
 	{ 0x00, 0x00, 0x00, 0x00, 0x7c, 0x10, 0x10, 0x7c, 0x10, 0x10, 0x00, 0x00 },	// U+2213 (∓)
 	{ 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x10, 0x7c, 0x10, 0x10, 0x00, 0x00 },	// U+2214 (∔)
-}; // 21
-
-static const unsigned char scientificai_block31[][12] = {
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x28, 0x10, 0x7c, 0x10, 0x28, 0x00, 0x00 },	// U+2217 (∗)
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x28, 0x10, 0x00, 0x00, 0x00 },	// U+2218 (∘)
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x38, 0x10, 0x00, 0x00, 0x00 },	// U+2219 (∙)
 	{ 0x00, 0x00, 0x40, 0x40, 0x20, 0x20, 0x10, 0x14, 0x08, 0x08, 0x00, 0x00 },	// U+221A (√)
-}; // 4
-
-static const unsigned char scientificai_block32[][12] = {
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x28, 0x14, 0x14, 0x28, 0x00, 0x00 },	// U+221D (∝)
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x28, 0x54, 0x54, 0x54, 0x28, 0x00, 0x00 },	// U+221E (∞)
-}; // 2
-
-static const unsigned char scientificai_block33[][12] = {
 	{ 0x00, 0x00, 0x00, 0x00, 0x10, 0x10, 0x28, 0x28, 0x44, 0x44, 0x00, 0x00 },	// U+2227 (∧)
 	{ 0x00, 0x00, 0x00, 0x00, 0x44, 0x44, 0x28, 0x28, 0x10, 0x10, 0x00, 0x00 },	// U+2228 (∨)
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x24, 0x24, 0x24, 0x24, 0x00, 0x00 },	// U+2229 (∩)
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x24, 0x24, 0x24, 0x24, 0x18, 0x00, 0x00 },	// U+222A (∪)
 	{ 0x00, 0x00, 0x20, 0x50, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x14, 0x08 },	// U+222B (∫)
-}; // 5
-
-static const unsigned char scientificai_block34[][12] = {
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x44, 0x00, 0x00 },	// U+2234 (∴)
 	{ 0x00, 0x00, 0x00, 0x00, 0x44, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00 },	// U+2235 (∵)
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00 },	// U+2236 (∶)
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x48, 0x00, 0x00, 0x00, 0x48, 0x00, 0x00 },	// U+2237 (∷)
-}; // 4
-
-static const unsigned char scientificai_block35[][12] = {
 	{ 0x00, 0x00, 0x00, 0x08, 0x54, 0x20, 0x00, 0x7c, 0x00, 0x00, 0x00, 0x00 },	// U+2243 (≃)
-}; // 1
-
-static const unsigned char scientificai_block36[][12] = {
 	{ 0x00, 0x00, 0x00, 0x00, 0x08, 0x54, 0x20, 0x08, 0x54, 0x20, 0x00, 0x00 },	// U+2248 (≈)
-}; // 1
-
-static const unsigned char scientificai_block37[][12] = {
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x74, 0x00, 0x74, 0x00, 0x00, 0x00 },	// U+2254 (≔)
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5c, 0x00, 0x5c, 0x00, 0x00, 0x00 },	// U+2255 (≕)
-}; // 2
-
-static const unsigned char scientificai_block38[][12] = {
 	{ 0x00, 0x00, 0x00, 0x00, 0x20, 0x20, 0x7c, 0x10, 0x7c, 0x08, 0x08, 0x00 },	// U+2260 (≠)
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x7c, 0x00, 0x7c, 0x00, 0x7c, 0x00, 0x00 },	// U+2261 (≡)
 	{ 0x00, 0x00, 0x00, 0x00, 0x40, 0x7c, 0x20, 0x7c, 0x08, 0x7c, 0x04, 0x00 },	// U+2262 (≢)
-}; // 3
-
-static const unsigned char scientificai_block39[][12] = {
 	{ 0x00, 0x00, 0x00, 0x20, 0x10, 0x08, 0x10, 0x20, 0x00, 0x7c, 0x00, 0x00 },	// U+2264 (≤)
 	{ 0x00, 0x00, 0x00, 0x08, 0x10, 0x20, 0x10, 0x08, 0x00, 0x7c, 0x00, 0x00 },	// U+2265 (≥)
-}; // 2
-
-static const unsigned char scientificai_block40[][12] = {
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x38, 0x04, 0x04, 0x38, 0x00, 0x00, 0x00 },	// U+2282 (⊂)
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x1c, 0x20, 0x20, 0x1c, 0x00, 0x00, 0x00 },	// U+2283 (⊃)
 	{ 0x00, 0x00, 0x00, 0x00, 0x20, 0x38, 0x14, 0x14, 0x38, 0x08, 0x00, 0x00 },	// U+2284 (⊄)
 	{ 0x00, 0x00, 0x00, 0x00, 0x04, 0x1c, 0x28, 0x28, 0x1c, 0x10, 0x00, 0x00 },	// U+2285 (⊅)
 	{ 0x00, 0x00, 0x00, 0x00, 0x38, 0x04, 0x04, 0x38, 0x00, 0x3c, 0x00, 0x00 },	// U+2286 (⊆)
 	{ 0x00, 0x00, 0x00, 0x00, 0x1c, 0x20, 0x20, 0x1c, 0x00, 0x3c, 0x00, 0x00 },	// U+2287 (⊇)
-}; // 6
-
-static const unsigned char scientificai_block41[][12] = {
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x38, 0x54, 0x7c, 0x54, 0x38, 0x00, 0x00 },	// U+2295 (⊕)
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x38, 0x44, 0x7c, 0x44, 0x38, 0x00, 0x00 },	// U+2296 (⊖)
-}; // 2
-
-static const unsigned char scientificai_block42[][12] = {
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x38, 0x44, 0x54, 0x44, 0x38, 0x00, 0x00 },	// U+2299 (⊙)
-}; // 1
-
-static const unsigned char scientificai_block43[][12] = {
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x7c, 0x54, 0x7c, 0x54, 0x7c, 0x00, 0x00 },	// U+229E (⊞)
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x7c, 0x44, 0x7c, 0x44, 0x7c, 0x00, 0x00 },	// U+229F (⊟)
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x54, 0x28, 0x54, 0x28, 0x54, 0x00, 0x00 },	// U+22A0 (⊠)
@@ -753,23 +627,11 @@ static const unsigned char scientificai_block43[][12] = {
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x1c, 0x04, 0x1c, 0x04, 0x00, 0x00 },	// U+22A7 (⊧)
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x7c, 0x04, 0x7c, 0x04, 0x00, 0x00 },	// U+22A8 (⊨)
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x14, 0x14, 0x74, 0x14, 0x14, 0x00, 0x00 },	// U+22A9 (⊩)
-}; // 12
-
-static const unsigned char scientificai_block44[][12] = {
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x14, 0x74, 0x14, 0x74, 0x14, 0x00, 0x00 },	// U+22AB (⊫)
-}; // 1
-
-static const unsigned char scientificai_block45[][12] = {
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x14, 0x08, 0x00, 0x00, 0x00 },	// U+22C4 (⋄)
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00 },	// U+22C5 (⋅)
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x14, 0x08, 0x14, 0x00, 0x00, 0x00 },	// U+22C6 (⋆)
-}; // 3
-
-static const unsigned char scientificai_block46[][12] = {
 	{ 0x00, 0x00, 0x00, 0x00, 0x6c, 0x08, 0x10, 0x10, 0x20, 0x60, 0x00, 0x00 },	// U+2325 (⌥)
-}; // 1
-
-static const unsigned char scientificai_block47[][12] = {
 	{ 0x00, 0x40, 0x20, 0x10, 0x10, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08 },	// U+239B (⎛)
 	{ 0x00, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08 },	// U+239C (⎜)
 	{ 0x00, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x10, 0x10, 0x20, 0x40 },	// U+239D (⎝)
@@ -790,23 +652,14 @@ static const unsigned char scientificai_block47[][12] = {
 	{ 0x00, 0x10, 0x10, 0x10, 0x10, 0x60, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10 },	// U+23AC (⎬)
 	{ 0x00, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x0c },	// U+23AD (⎭)
 	{ 0x00, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10 },	// U+23AE (⎮)
-}; // 20
-
-static const unsigned char scientificai_block48[][12] = {
 	{ 0x00, 0x00, 0x78, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+23BA (⎺)
 	{ 0x00, 0x00, 0x00, 0x00, 0x78, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+23BB (⎻)
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x78, 0x00, 0x00, 0x00, 0x00 },	// U+23BC (⎼)
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x78, 0x00 },	// U+23BD (⎽)
-}; // 4
-
-static const unsigned char scientificai_block49[][12] = {
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x14, 0x3c, 0x7c, 0x3c, 0x14, 0x00, 0x00 },	// U+23E9 (⏩)
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x50, 0x78, 0x7c, 0x78, 0x50, 0x00, 0x00 },	// U+23EA (⏪)
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x38, 0x7c, 0x38, 0x7c, 0x00, 0x00 },	// U+23EB (⏫)
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x7c, 0x38, 0x7c, 0x38, 0x10, 0x00, 0x00 },	// U+23EC (⏬)
-}; // 4
-
-static const unsigned char scientificai_block50[][12] = {
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x18, 0x1c, 0x18, 0x10, 0x00, 0x00 },	// U+23F4 (⏴)
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x0c, 0x1c, 0x0c, 0x04, 0x00, 0x00 },	// U+23F5 (⏵)
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x38, 0x7c, 0x00, 0x00 },	// U+23F6 (⏶)
@@ -815,21 +668,12 @@ static const unsigned char scientificai_block50[][12] = {
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3c, 0x3c, 0x3c, 0x3c, 0x00, 0x00 },	// U+23F9 (⏹)
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x3c, 0x3c, 0x18, 0x00, 0x00 },	// U+23FA (⏺)
 	{ 0x00, 0x00, 0x00, 0x00, 0x10, 0x38, 0x54, 0x54, 0x44, 0x38, 0x00, 0x00 },	// U+23FB (⏻)
-}; // 8
-
-static const unsigned char scientificai_block51[][12] = {
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x7c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+2500 (─)
 	{ 0x00, 0x00, 0x00, 0x00, 0x7c, 0x7c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+2501 (━)
 	{ 0x00, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10 },	// U+2502 (│)
 	{ 0x00, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18 },	// U+2503 (┃)
-}; // 4
-
-static const unsigned char scientificai_block52[][12] = {
 	{ 0x00, 0x10, 0x10, 0x10, 0x00, 0x10, 0x10, 0x10, 0x00, 0x10, 0x10, 0x10 },	// U+2506 (┆)
 	{ 0x00, 0x18, 0x18, 0x18, 0x00, 0x18, 0x18, 0x18, 0x00, 0x18, 0x18, 0x18 },	// U+2507 (┇)
-}; // 2
-
-static const unsigned char scientificai_block53[][12] = {
 	{ 0x00, 0x10, 0x10, 0x00, 0x10, 0x10, 0x00, 0x10, 0x10, 0x00, 0x10, 0x10 },	// U+250A (┊)
 	{ 0x00, 0x18, 0x18, 0x00, 0x18, 0x18, 0x00, 0x18, 0x18, 0x00, 0x18, 0x18 },	// U+250B (┋)
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x70, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10 },	// U+250C (┌)
@@ -850,60 +694,24 @@ static const unsigned char scientificai_block53[][12] = {
 	{ 0x00, 0x38, 0x38, 0x38, 0x3c, 0x3c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+251B (┛)
 	{ 0x00, 0x10, 0x10, 0x10, 0x10, 0x70, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10 },	// U+251C (├)
 	{ 0x00, 0x10, 0x10, 0x10, 0x70, 0x70, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10 },	// U+251D (┝)
-}; // 20
-
-static const unsigned char scientificai_block54[][12] = {
 	{ 0x00, 0x38, 0x38, 0x38, 0x38, 0x78, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38 },	// U+2520 (┠)
-}; // 1
-
-static const unsigned char scientificai_block55[][12] = {
 	{ 0x00, 0x38, 0x38, 0x38, 0x78, 0x78, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38 },	// U+2523 (┣)
 	{ 0x00, 0x10, 0x10, 0x10, 0x10, 0x1c, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10 },	// U+2524 (┤)
 	{ 0x00, 0x10, 0x10, 0x10, 0x1c, 0x1c, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10 },	// U+2525 (┥)
-}; // 3
-
-static const unsigned char scientificai_block56[][12] = {
 	{ 0x00, 0x38, 0x38, 0x38, 0x38, 0x3c, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38 },	// U+2528 (┨)
-}; // 1
-
-static const unsigned char scientificai_block57[][12] = {
 	{ 0x00, 0x38, 0x38, 0x38, 0x3c, 0x3c, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38 },	// U+252B (┫)
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x7c, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10 },	// U+252C (┬)
-}; // 2
-
-static const unsigned char scientificai_block58[][12] = {
 	{ 0x00, 0x00, 0x00, 0x00, 0x7c, 0x7c, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10 },	// U+252F (┯)
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x7c, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38 },	// U+2530 (┰)
-}; // 2
-
-static const unsigned char scientificai_block59[][12] = {
 	{ 0x00, 0x00, 0x00, 0x00, 0x7c, 0x7c, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38 },	// U+2533 (┳)
 	{ 0x00, 0x10, 0x10, 0x10, 0x10, 0x7c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+2534 (┴)
-}; // 2
-
-static const unsigned char scientificai_block60[][12] = {
 	{ 0x00, 0x10, 0x10, 0x10, 0x7c, 0x7c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+2537 (┷)
 	{ 0x00, 0x38, 0x38, 0x38, 0x38, 0x7c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+2538 (┸)
-}; // 2
-
-static const unsigned char scientificai_block61[][12] = {
 	{ 0x00, 0x38, 0x38, 0x38, 0x7c, 0x7c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+253B (┻)
 	{ 0x00, 0x10, 0x10, 0x10, 0x10, 0x7c, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10 },	// U+253C (┼)
-}; // 2
-
-static const unsigned char scientificai_block62[][12] = {
 	{ 0x00, 0x10, 0x10, 0x10, 0x10, 0x7c, 0x7c, 0x10, 0x10, 0x10, 0x10, 0x10 },	// U+253F (┿)
-}; // 1
-
-static const unsigned char scientificai_block63[][12] = {
 	{ 0x00, 0x38, 0x38, 0x38, 0x38, 0x7c, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38 },	// U+2542 (╂)
-}; // 1
-
-static const unsigned char scientificai_block64[][12] = {
 	{ 0x00, 0x38, 0x38, 0x38, 0x7c, 0x7c, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38 },	// U+254B (╋)
-}; // 1
-
-static const unsigned char scientificai_block65[][12] = {
 	{ 0x00, 0x00, 0x00, 0x00, 0x7c, 0x00, 0x7c, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+2550 (═)
 	{ 0x00, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28 },	// U+2551 (║)
 	{ 0x00, 0x00, 0x00, 0x00, 0x70, 0x10, 0x70, 0x10, 0x10, 0x10, 0x10, 0x10 },	// U+2552 (╒)
@@ -940,17 +748,8 @@ static const unsigned char scientificai_block65[][12] = {
 	{ 0x00, 0x40, 0x40, 0x40, 0x20, 0x20, 0x10, 0x10, 0x08, 0x08, 0x04, 0x04 },	// U+2571 (╱)
 	{ 0x00, 0x04, 0x04, 0x04, 0x08, 0x08, 0x10, 0x10, 0x20, 0x20, 0x40, 0x40 },	// U+2572 (╲)
 	{ 0x00, 0x44, 0x44, 0x44, 0x28, 0x28, 0x10, 0x10, 0x28, 0x28, 0x44, 0x44 },	// U+2573 (╳)
-}; // 36
-
-static const unsigned char scientificai_block66[][12] = {
 	{ 0x00, 0x00, 0x00, 0x00, 0x70, 0x7c, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+257C (╼)
-}; // 1
-
-static const unsigned char scientificai_block67[][12] = {
 	{ 0x00, 0x00, 0x00, 0x00, 0x1c, 0x7c, 0x1c, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+257E (╾)
-}; // 1
-
-static const unsigned char scientificai_block68[][12] = {
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7c, 0x7c, 0x00, 0x00 },	// U+2581 (▁)
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7c, 0x7c, 0x7c, 0x00, 0x00 },	// U+2582 (▂)
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7c, 0x7c, 0x7c, 0x7c, 0x00, 0x00 },	// U+2583 (▃)
@@ -961,29 +760,14 @@ static const unsigned char scientificai_block68[][12] = {
 	{ 0x00, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x00, 0x00 },	// U+2588 (█)
 	{ 0x00, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0x00, 0x00 },	// U+2589 (▉)
 	{ 0x00, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0x00, 0x00 },	// U+258A (▊)
-}; // 10
-
-static const unsigned char scientificai_block69[][12] = {
 	{ 0x00, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x00 },	// U+258F (▏)
-}; // 1
-
-static const unsigned char scientificai_block70[][12] = {
 	{ 0x00, 0x44, 0x10, 0x44, 0x10, 0x44, 0x10, 0x44, 0x10, 0x44, 0x00, 0x00 },	// U+2591 (░)
 	{ 0x00, 0x54, 0x28, 0x54, 0x28, 0x54, 0x28, 0x54, 0x28, 0x54, 0x00, 0x00 },	// U+2592 (▒)
 	{ 0x00, 0x54, 0x7c, 0x54, 0x7c, 0x54, 0x7c, 0x54, 0x7c, 0x54, 0x00, 0x00 },	// U+2593 (▓)
-}; // 3
-
-static const unsigned char scientificai_block71[][12] = {
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x3c, 0x24, 0x24, 0x3c, 0x00, 0x00, 0x00 },	// U+25A1 (□)
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x24, 0x24, 0x18, 0x00, 0x00, 0x00 },	// U+25A2 (▢)
-}; // 2
-
-static const unsigned char scientificai_block72[][12] = {
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x3c, 0x3c, 0x3c, 0x3c, 0x00, 0x00, 0x00 },	// U+25AA (▪)
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x3c, 0x24, 0x24, 0x3c, 0x00, 0x00, 0x00 },	// U+25AB (▫)
-}; // 2
-
-static const unsigned char scientificai_block73[][12] = {
 	{ 0x00, 0x00, 0x00, 0x00, 0x10, 0x10, 0x38, 0x38, 0x7c, 0x00, 0x00, 0x00 },	// U+25B2 (▲)
 	{ 0x00, 0x00, 0x00, 0x00, 0x10, 0x10, 0x28, 0x28, 0x7c, 0x00, 0x00, 0x00 },	// U+25B3 (△)
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x38, 0x7c, 0x00, 0x00, 0x00 },	// U+25B4 (▴)
@@ -992,27 +776,15 @@ static const unsigned char scientificai_block73[][12] = {
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x1c, 0x64, 0x1c, 0x04, 0x00, 0x00 },	// U+25B7 (▷)
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x0c, 0x1c, 0x0c, 0x04, 0x00, 0x00 },	// U+25B8 (▸)
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x0c, 0x14, 0x0c, 0x04, 0x00, 0x00 },	// U+25B9 (▹)
-}; // 8
-
-static const unsigned char scientificai_block74[][12] = {
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7c, 0x38, 0x10, 0x00, 0x00, 0x00 },	// U+25BC (▼)
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7c, 0x28, 0x10, 0x00, 0x00, 0x00 },	// U+25BD (▽)
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1c, 0x08, 0x00, 0x00, 0x00 },	// U+25BE (▾)
-}; // 3
-
-static const unsigned char scientificai_block75[][12] = {
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x70, 0x7c, 0x70, 0x40, 0x00, 0x00 },	// U+25C0 (◀)
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x70, 0x4c, 0x70, 0x40, 0x00, 0x00 },	// U+25C1 (◁)
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x18, 0x1c, 0x18, 0x10, 0x00, 0x00 },	// U+25C2 (◂)
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x18, 0x14, 0x18, 0x10, 0x00, 0x00 },	// U+25C3 (◃)
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+25C4 (◄)
-}; // 5
-
-static const unsigned char scientificai_block76[][12] = {
 	{ 0x00, 0x00, 0x00, 0x00, 0x38, 0x44, 0x44, 0x44, 0x38, 0x00, 0x00, 0x00 },	// U+25CB (○)
-}; // 1
-
-static const unsigned char scientificai_block77[][12] = {
 	{ 0x00, 0x00, 0x00, 0x00, 0x38, 0x44, 0x54, 0x44, 0x38, 0x00, 0x00, 0x00 },	// U+25CE (◎)
 	{ 0x00, 0x00, 0x00, 0x00, 0x38, 0x7c, 0x7c, 0x7c, 0x38, 0x00, 0x00, 0x00 },	// U+25CF (●)
 	{ 0x00, 0x00, 0x00, 0x00, 0x38, 0x5c, 0x5c, 0x5c, 0x38, 0x00, 0x00, 0x00 },	// U+25D0 (◐)
@@ -1023,30 +795,18 @@ static const unsigned char scientificai_block77[][12] = {
 	{ 0x00, 0x00, 0x00, 0x00, 0x38, 0x64, 0x64, 0x7c, 0x38, 0x00, 0x00, 0x00 },	// U+25D5 (◕)
 	{ 0x00, 0x00, 0x00, 0x00, 0x08, 0x0c, 0x0c, 0x0c, 0x08, 0x00, 0x00, 0x00 },	// U+25D6 (◖)
 	{ 0x00, 0x00, 0x00, 0x00, 0x20, 0x60, 0x60, 0x60, 0x20, 0x00, 0x00, 0x00 },	// U+25D7 (◗)
-}; // 10
-
-static const unsigned char scientificai_block78[][12] = {
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x7c, 0x5c, 0x5c, 0x5c, 0x7c, 0x00, 0x00 },	// U+25E7 (◧)
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x7c, 0x74, 0x74, 0x74, 0x7c, 0x00, 0x00 },	// U+25E8 (◨)
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x7c, 0x7c, 0x5c, 0x4c, 0x7c, 0x00, 0x00 },	// U+25E9 (◩)
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x7c, 0x64, 0x74, 0x7c, 0x7c, 0x00, 0x00 },	// U+25EA (◪)
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x7c, 0x54, 0x54, 0x54, 0x7c, 0x00, 0x00 },	// U+25EB (◫)
-}; // 5
-
-static const unsigned char scientificai_block79[][12] = {
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x7c, 0x54, 0x5c, 0x44, 0x7c, 0x00, 0x00 },	// U+25F0 (◰)
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x7c, 0x44, 0x5c, 0x54, 0x7c, 0x00, 0x00 },	// U+25F1 (◱)
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x7c, 0x44, 0x74, 0x54, 0x7c, 0x00, 0x00 },	// U+25F2 (◲)
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x7c, 0x54, 0x74, 0x44, 0x7c, 0x00, 0x00 },	// U+25F3 (◳)
-}; // 4
-
-static const unsigned char scientificai_block80[][12] = {
 	{ 0x00, 0x00, 0x00, 0x00, 0x10, 0x54, 0x38, 0x7c, 0x38, 0x54, 0x10, 0x00 },	// U+2600 (☀)
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x38, 0x7c, 0x7c, 0x00, 0x00, 0x00 },	// U+2601 (☁)
 	{ 0x00, 0x00, 0x00, 0x38, 0x7c, 0x7c, 0x10, 0x10, 0x14, 0x14, 0x08, 0x00 },	// U+2602 (☂)
-}; // 3
-
-static const unsigned char scientificai_block81[][12] = {
 	{ 0x00, 0x00, 0x00, 0x7c, 0x00, 0x00, 0x7c, 0x00, 0x00, 0x7c, 0x00, 0x00 },	// U+2630 (☰)
 	{ 0x00, 0x00, 0x00, 0x6c, 0x00, 0x00, 0x7c, 0x00, 0x00, 0x7c, 0x00, 0x00 },	// U+2631 (☱)
 	{ 0x00, 0x00, 0x00, 0x7c, 0x00, 0x00, 0x6c, 0x00, 0x00, 0x7c, 0x00, 0x00 },	// U+2632 (☲)
@@ -1055,75 +815,36 @@ static const unsigned char scientificai_block81[][12] = {
 	{ 0x00, 0x00, 0x00, 0x6c, 0x00, 0x00, 0x7c, 0x00, 0x00, 0x6c, 0x00, 0x00 },	// U+2635 (☵)
 	{ 0x00, 0x00, 0x00, 0x7c, 0x00, 0x00, 0x6c, 0x00, 0x00, 0x6c, 0x00, 0x00 },	// U+2636 (☶)
 	{ 0x00, 0x00, 0x00, 0x6c, 0x00, 0x00, 0x6c, 0x00, 0x00, 0x6c, 0x00, 0x00 },	// U+2637 (☷)
-}; // 8
-
-static const unsigned char scientificai_block82[][12] = {
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x28, 0x54, 0x44, 0x28, 0x10, 0x00, 0x00 },	// U+2661 (♡)
-}; // 1
-
-static const unsigned char scientificai_block83[][12] = {
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x28, 0x7c, 0x7c, 0x38, 0x10, 0x00, 0x00 },	// U+2665 (♥)
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x38, 0x7c, 0x38, 0x10, 0x00, 0x00 },	// U+2666 (♦)
-}; // 2
-
-static const unsigned char scientificai_block84[][12] = {
 	{ 0x00, 0x00, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x0c, 0x0c, 0x00, 0x00 },	// U+2669 (♩)
 	{ 0x00, 0x00, 0x08, 0x18, 0x28, 0x08, 0x08, 0x08, 0x0c, 0x0c, 0x00, 0x00 },	// U+266A (♪)
 	{ 0x00, 0x00, 0x18, 0x68, 0x48, 0x48, 0x48, 0x4c, 0x6c, 0x60, 0x00, 0x00 },	// U+266B (♫)
 	{ 0x00, 0x00, 0x48, 0x78, 0x48, 0x78, 0x48, 0x48, 0x6c, 0x6c, 0x00, 0x00 },	// U+266C (♬)
-}; // 4
-
-static const unsigned char scientificai_block85[][12] = {
 	{ 0x00, 0x00, 0x00, 0x00, 0x10, 0x28, 0x00, 0x44, 0x44, 0x28, 0x00, 0x00 },	// U+267A (♺)
-}; // 1
-
-static const unsigned char scientificai_block86[][12] = {
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x24, 0x24, 0x18, 0x00, 0x00, 0x00 },	// U+26AA (⚪)
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x3c, 0x3c, 0x18, 0x00, 0x00, 0x00 },	// U+26AB (⚫)
-}; // 2
-
-static const unsigned char scientificai_block87[][12] = {
 	{ 0x00, 0x00, 0x00, 0x00, 0x40, 0x40, 0x20, 0x24, 0x18, 0x10, 0x00, 0x00 },	// U+2713 (✓)
 	{ 0x00, 0x00, 0x00, 0x40, 0x40, 0x60, 0x24, 0x3c, 0x18, 0x10, 0x00, 0x00 },	// U+2714 (✔)
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x44, 0x28, 0x10, 0x28, 0x44, 0x00, 0x00 },	// U+2715 (✕)
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x6c, 0x7c, 0x38, 0x7c, 0x6c, 0x00, 0x00 },	// U+2716 (✖)
 	{ 0x00, 0x00, 0x20, 0x20, 0x14, 0x18, 0x18, 0x18, 0x24, 0x24, 0x00, 0x00 },	// U+2717 (✗)
 	{ 0x00, 0x00, 0x20, 0x20, 0x14, 0x14, 0x18, 0x18, 0x24, 0x24, 0x00, 0x00 },	// U+2718 (✘)
-}; // 6
-
-static const unsigned char scientificai_block88[][12] = {
 	{ 0x00, 0x00, 0x00, 0x00, 0x10, 0x10, 0x7c, 0x38, 0x38, 0x44, 0x00, 0x00 },	// U+272E (✮)
-}; // 1
-
-static const unsigned char scientificai_block89[][12] = {
 	{ 0x00, 0x00, 0x00, 0x10, 0x6c, 0x54, 0x38, 0x54, 0x6c, 0x10, 0x00, 0x00 },	// U+2744 (❄)
-}; // 1
-
-static const unsigned char scientificai_block90[][12] = {
 	{ 0x00, 0x00, 0x00, 0x60, 0x30, 0x18, 0x0c, 0x18, 0x30, 0x60, 0x00, 0x00 },	// U+276E (❮)
 	{ 0x00, 0x00, 0x00, 0x0c, 0x18, 0x30, 0x60, 0x30, 0x18, 0x0c, 0x00, 0x00 },	// U+276F (❯)
 	{ 0x00, 0x00, 0x00, 0x70, 0x38, 0x1c, 0x0c, 0x1c, 0x38, 0x70, 0x00, 0x00 },	// U+2770 (❰)
 	{ 0x00, 0x00, 0x00, 0x1c, 0x38, 0x70, 0x60, 0x70, 0x38, 0x1c, 0x00, 0x00 },	// U+2771 (❱)
-}; // 4
-
-static const unsigned char scientificai_block91[][12] = {
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x08, 0x08, 0x08, 0x1c, 0x00, 0x00 },	// U+27C2 (⟂)
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x38, 0x04, 0x14, 0x04, 0x38, 0x00, 0x00 },	// U+27C3 (⟃)
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x1c, 0x20, 0x28, 0x20, 0x1c, 0x00, 0x00 },	// U+27C4 (⟄)
-}; // 3
-
-static const unsigned char scientificai_block92[][12] = {
 	{ 0x00, 0x00, 0x00, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x7c, 0x00, 0x00 },	// U+27D8 (⟘)
 	{ 0x00, 0x00, 0x00, 0x7c, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x00, 0x00 },	// U+27D9 (⟙)
-}; // 2
-
-static const unsigned char scientificai_block93[][12] = {
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x74, 0x08, 0x00, 0x00, 0x00 },	// U+27DC (⟜)
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x7c, 0x04, 0x00, 0x00, 0x00 },	// U+27DD (⟝)
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x7c, 0x40, 0x00, 0x00, 0x00 },	// U+27DE (⟞)
-}; // 3
-
-static const unsigned char scientificai_block94[][12] = {
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x14, 0x00, 0x04 },	// U+2864 (⡤)
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x14, 0x00, 0x04 },	// U+2865 (⡥)
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x14, 0x00, 0x04 },	// U+2866 (⡦)
@@ -1280,61 +1001,34 @@ static const unsigned char scientificai_block94[][12] = {
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x14, 0x00, 0x10, 0x00, 0x14, 0x00, 0x14 },	// U+28FD (⣽)
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x14, 0x00, 0x14, 0x00, 0x14 },	// U+28FE (⣾)
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x14, 0x00, 0x14, 0x00, 0x14, 0x00, 0x14 },	// U+28FF (⣿)
-}; // 156
-
-static const unsigned char scientificai_block95[][12] = {
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x20, 0x1c, 0x20, 0x40, 0x00, 0x00 },	// U+2919 (⤙)
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x08, 0x70, 0x08, 0x04, 0x00, 0x00 },	// U+291A (⤚)
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x48, 0x24, 0x10, 0x24, 0x48, 0x00, 0x00 },	// U+291B (⤛)
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x24, 0x48, 0x10, 0x48, 0x24, 0x00, 0x00 },	// U+291C (⤜)
-}; // 4
-
-static const unsigned char scientificai_block96[][12] = {
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x7c, 0x00, 0x7c, 0x00, 0x00, 0x00, 0x00 },	// U+2B5E (⭞)
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7c, 0x00, 0x00, 0x00, 0x00 },	// U+2B5F (⭟)
 	{ 0x00, 0x04, 0x04, 0x14, 0x3c, 0x14, 0x14, 0x1c, 0x04, 0x04, 0x00, 0x00 },	// U+2B60 (⭠)
 	{ 0x00, 0x04, 0x04, 0x04, 0x1c, 0x00, 0x18, 0x28, 0x28, 0x28, 0x00, 0x00 },	// U+2B61 (⭡)
 	{ 0x00, 0x00, 0x18, 0x08, 0x0c, 0x28, 0x68, 0x2c, 0x20, 0x60, 0x00, 0x00 },	// U+2B62 (⭢)
-}; // 5
-
-static const unsigned char scientificai_block97[][12] = {
 	{ 0x00, 0x00, 0x00, 0x18, 0x24, 0x24, 0x3c, 0x3c, 0x2c, 0x3c, 0x00, 0x00 },	// U+2B64 (⭤)
-}; // 1
-
-static const unsigned char scientificai_block98[][12] = {
 	{ 0x00, 0x04, 0x0c, 0x1c, 0x3c, 0x7c, 0x3c, 0x1c, 0x0c, 0x04, 0x00, 0x00 },	// U+2B80 (⮀)
 	{ 0x00, 0x04, 0x08, 0x10, 0x20, 0x40, 0x20, 0x10, 0x08, 0x04, 0x00, 0x00 },	// U+2B81 (⮁)
 	{ 0x00, 0x40, 0x60, 0x70, 0x78, 0x7c, 0x78, 0x70, 0x60, 0x40, 0x00, 0x00 },	// U+2B82 (⮂)
 	{ 0x00, 0x40, 0x20, 0x10, 0x08, 0x04, 0x08, 0x10, 0x20, 0x40, 0x00, 0x00 },	// U+2B83 (⮃)
-}; // 4
-
-static const unsigned char scientificai_block99[][12] = {
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x24, 0x00, 0x24, 0x18, 0x00, 0x00 },	// U+30C3 (ッ)
 	{ 0x00, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x24, 0x18, 0x00, 0x00 },	// U+30C4 (ツ)
-}; // 2
-
-static const unsigned char scientificai_block100[][12] = {
 	{ 0x00, 0x00, 0x00, 0x74, 0x14, 0x14, 0x7c, 0x50, 0x50, 0x5c, 0x00, 0x00 },	// U+5350 (卐)
-}; // 1
-
-static const unsigned char scientificai_block101[][12] = {
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7c, 0x00, 0x7c, 0x00, 0x00, 0x00 },	// U+E09E ()
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7c, 0x00, 0x00, 0x00, 0x00 },	// U+E09F ()
 	{ 0x00, 0x00, 0x04, 0x14, 0x34, 0x14, 0x14, 0x0c, 0x04, 0x04, 0x00, 0x00 },	// U+E0A0 ()
 	{ 0x00, 0x04, 0x04, 0x04, 0x1c, 0x00, 0x18, 0x28, 0x28, 0x28, 0x00, 0x00 },	// U+E0A1 ()
 	{ 0x00, 0x00, 0x00, 0x18, 0x24, 0x24, 0x3c, 0x2c, 0x2c, 0x3c, 0x00, 0x00 },	// U+E0A2 ()
-}; // 5
-
-static const unsigned char scientificai_block102[][12] = {
 	{ 0x00, 0x00, 0x04, 0x0c, 0x1c, 0x3c, 0x7c, 0x3c, 0x1c, 0x0c, 0x04, 0x00 },	// U+E0B0 ()
 	{ 0x00, 0x00, 0x04, 0x08, 0x10, 0x20, 0x40, 0x20, 0x10, 0x08, 0x04, 0x00 },	// U+E0B1 ()
 	{ 0x00, 0x00, 0x40, 0x60, 0x70, 0x78, 0x7c, 0x78, 0x70, 0x60, 0x40, 0x00 },	// U+E0B2 ()
 	{ 0x00, 0x00, 0x40, 0x20, 0x10, 0x08, 0x04, 0x08, 0x10, 0x20, 0x40, 0x00 },	// U+E0B3 ()
 	{ 0x00, 0x7c, 0x78, 0x70, 0x60, 0x40, 0x00, 0x40, 0x60, 0x70, 0x78, 0x7c },	// U+E0B4 ()
 	{ 0x00, 0x7c, 0x3c, 0x1c, 0x0c, 0x04, 0x00, 0x04, 0x0c, 0x1c, 0x3c, 0x7c },	// U+E0B5 ()
-}; // 6
-
-static const unsigned char scientificai_block103[][12] = {
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x14, 0x28, 0x54, 0x48, 0x00, 0x00 },	// U+E0C0 ()
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x20, 0x40, 0x20, 0x10, 0x00, 0x00 },	// U+E0C1 ()
 	{ 0x00, 0x00, 0x00, 0x28, 0x28, 0x7c, 0x38, 0x38, 0x10, 0x10, 0x10, 0x00 },	// U+E0C2 ()
@@ -1342,17 +1036,8 @@ static const unsigned char scientificai_block103[][12] = {
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x14, 0x68, 0x10, 0x68, 0x14, 0x00, 0x00 },	// U+E0C4 ()
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x3c, 0x00, 0x3c, 0x40, 0x00, 0x00 },	// U+E0C5 ()
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x50, 0x2c, 0x10, 0x2c, 0x50, 0x00, 0x00 },	// U+E0C6 ()
-}; // 7
-
-static const unsigned char scientificai_block104[][12] = {
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x08, 0x04, 0x08, 0x10, 0x00, 0x00 },	// U+E0D1 ()
-}; // 1
-
-static const unsigned char scientificai_block105[][12] = {
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x3c, 0x3c, 0x24, 0x24, 0x3c, 0x00, 0x00 },	// U+F031 ()
-}; // 1
-
-static const unsigned char scientificai_block106[][12] = {
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x18, 0x1c, 0x18, 0x10, 0x00, 0x00 },	// U+F033 ()
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x0c, 0x1c, 0x0c, 0x04, 0x00, 0x00 },	// U+F034 ()
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x38, 0x7c, 0x00, 0x00, 0x00 },	// U+F035 ()
@@ -1364,38 +1049,17 @@ static const unsigned char scientificai_block106[][12] = {
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x14, 0x14, 0x14, 0x14, 0x00, 0x00 },	// U+F03B ()
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3c, 0x3c, 0x3c, 0x3c, 0x00, 0x00 },	// U+F03C ()
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x3c, 0x3c, 0x18, 0x00, 0x00 },	// U+F03D ()
-}; // 11
-
-static const unsigned char scientificai_block107[][12] = {
 	{ 0x00, 0x00, 0x00, 0x00, 0x04, 0x0c, 0x3c, 0x3c, 0x3c, 0x0c, 0x04, 0x00 },	// U+F057 ()
 	{ 0x00, 0x00, 0x00, 0x00, 0x20, 0x30, 0x3c, 0x3c, 0x3c, 0x30, 0x20, 0x00 },	// U+F058 ()
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x28, 0x7c, 0x7c, 0x38, 0x10, 0x00, 0x00 },	// U+F059 ()
-}; // 3
-
-static const unsigned char scientificai_block108[][12] = {
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x6c, 0x38, 0x10, 0x00, 0x00 },	// U+F061 ()
-}; // 1
-
-static const unsigned char scientificai_block109[][12] = {
 	{ 0x00, 0x00, 0x00, 0x18, 0x3c, 0x64, 0x64, 0x30, 0x18, 0x18, 0x00, 0x18 },	// U+F073 ()
-}; // 1
-
-static const unsigned char scientificai_block110[][12] = {
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x38, 0x4c, 0x54, 0x64, 0x38, 0x00, 0x00 },	// U+F078 ()
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x38, 0x44, 0x7c, 0x44, 0x38, 0x00, 0x00 },	// U+F079 ()
-}; // 2
-
-static const unsigned char scientificai_block111[][12] = {
 	{ 0x00, 0x00, 0x00, 0x00, 0x20, 0x10, 0x38, 0x1c, 0x08, 0x04, 0x00, 0x00 },	// U+F07E ()
-}; // 1
-
-static const unsigned char scientificai_block112[][12] = {
 	{ 0x00, 0x00, 0x00, 0x18, 0x24, 0x24, 0x3c, 0x2c, 0x2c, 0x3c, 0x00, 0x00 },	// U+F0CF ()
 	{ 0x00, 0x00, 0x18, 0x24, 0x20, 0x20, 0x3c, 0x2c, 0x2c, 0x3c, 0x00, 0x00 },	// U+F0D0 ()
 	{ 0x00, 0x00, 0x00, 0x00, 0x18, 0x18, 0x08, 0x08, 0x08, 0x14, 0x08, 0x00 },	// U+F0D1 ()
-}; // 3
-
-static const unsigned char scientificai_block113[][12] = {
 	{ 0x00, 0x00, 0x00, 0x10, 0x48, 0x3c, 0x64, 0x24, 0x3c, 0x54, 0x00, 0x00 },	// U+F0D5 ()
 	{ 0x00, 0x00, 0x20, 0x14, 0x48, 0x3c, 0x64, 0x74, 0x7c, 0x7c, 0x00, 0x00 },	// U+F0D6 ()
 	{ 0x00, 0x00, 0x00, 0x00, 0x18, 0x64, 0x74, 0x78, 0x00, 0x00, 0x00, 0x00 },	// U+F0D7 ()
@@ -1404,18 +1068,78 @@ static const unsigned char scientificai_block113[][12] = {
 	{ 0x00, 0x00, 0x00, 0x00, 0x20, 0x78, 0x7c, 0x00, 0x54, 0x00, 0x28, 0x00 },	// U+F0DA ()
 	{ 0x00, 0x00, 0x00, 0x00, 0x20, 0x78, 0x7c, 0x00, 0x54, 0x28, 0x00, 0x00 },	// U+F0DB ()
 	{ 0x00, 0x00, 0x00, 0x00, 0x20, 0x78, 0x7c, 0x20, 0x30, 0x10, 0x08, 0x00 },	// U+F0DC ()
-}; // 8
-
-static const unsigned char scientificai_block114[][12] = {
 	{ 0x00, 0x00, 0x28, 0x14, 0x00, 0x20, 0x50, 0x00, 0x28, 0x14, 0x00, 0x00 },	// U+F0DE ()
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x54, 0x28, 0x54, 0x28, 0x54, 0x00, 0x00 },	// U+F0DF ()
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x38, 0x74, 0x64, 0x64, 0x38, 0x00, 0x00 },	// U+F0E0 ()
-}; // 3
-
-static const unsigned char scientificai_block115[][12] = {
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x10, 0x44, 0x28, 0x00, 0x00 },	// U+F0ED ()
 	{ 0x00, 0x00, 0x28, 0x44, 0x10, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+F0EE ()
 	{ 0x00, 0x00, 0x00, 0x00, 0x10, 0x20, 0x00, 0x18, 0x00, 0x20, 0x10, 0x00 },	// U+F0EF ()
 	{ 0x00, 0x00, 0x00, 0x00, 0x08, 0x04, 0x00, 0x18, 0x00, 0x04, 0x08, 0x00 },	// U+F0F0 ()
-}; // 4
+}; // 1070
+
+static const uint8_t scientificai_page_index[] = {
+	0x01, 0x02, 0x03, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x00,
+	0x07, 0x08, 0x09, 0x0a, 0x00, 0x0b, 0x0c, 0x0d, 0x0e, 0x0f, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00,
+	0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x12, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x14,
+}; // 241
+
+static const uint32_t scientificai_page_bits[][8] = {
+	{ 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000 },	// Empty
+	{ 0x00000000, 0xffffffff, 0xffffffff, 0x7fffffff, 0x00000000, 0xffffffff, 0xffffffff, 0xffffffff },	// U+00xx
+	{ 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0x007fffff, 0x001fff80, 0x00000000 },	// U+01xx
+	{ 0x0ffff000, 0x00000000, 0x00000000, 0x00000000, 0x01400000, 0x00000000, 0x04000080, 0x00000000 },	// U+02xx
+	{ 0x00000000, 0x00000000, 0x00000000, 0x00000010, 0xfffe0000, 0xfffe03ff, 0x000003ff, 0x00000000 },	// U+03xx
+	{ 0x00000000, 0x30000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000 },	// U+0Fxx
+	{ 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x40000000, 0x00000000, 0x00000000, 0x00000000 },	// U+1Exx
+	{ 0xffff0000, 0xdffc00ff, 0x10038007, 0x00000000, 0x00000000, 0x00001500, 0x00000000, 0x00000000 },	// U+20xx
+	{ 0x00000000, 0x00000004, 0x00000000, 0x00000000, 0x03ff0000, 0xfeff06f0, 0x000f0fdf, 0x00000000 },	// U+21xx
+	{ 0x679fffff, 0x00f00f80, 0x00300108, 0x00000037, 0xc26000fc, 0x00000bff, 0x00000070, 0x00000000 },	// U+22xx
+	{ 0x00000000, 0x00000020, 0x00000000, 0x00000000, 0xf8000000, 0x3c007fff, 0x00000000, 0x0ff01e00 },	// U+23xx
+	{ 0x3ffffccf, 0x99999939, 0xffff0804, 0x500fffff, 0x000e87fe, 0x73fc0c06, 0x00ffc81f, 0x000f0f80 },	// U+25xx
+	{ 0x00000007, 0x00ff0000, 0x00000000, 0x04001e62, 0x00000000, 0x00000c00, 0x00000000, 0x00000000 },	// U+26xx
+	{ 0x01f80000, 0x00004000, 0x00000010, 0x0003c000, 0x00000000, 0x00000000, 0x7300001c, 0x00000000 },	// U+27xx
+	{ 0x00000000, 0x00000000, 0x00000000, 0xfffffff0, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff },	// U+28xx
+	{ 0x1e000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000 },	// U+29xx
+	{ 0x00000000, 0x00000000, 0xc0000000, 0x00000017, 0x0000000f, 0x00000000, 0x00000000, 0x00000000 },	// U+2Bxx
+	{ 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000018, 0x00000000 },	// U+30xx
+	{ 0x00000000, 0x00000000, 0x00010000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000 },	// U+53xx
+	{ 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xc0000000, 0x003f0007, 0x0002007f, 0x00000000 },	// U+E0xx
+	{ 0x00000000, 0x3ffa0000, 0x03800000, 0x43080002, 0x00000000, 0x00000000, 0xdfe38000, 0x0001e001 },	// U+F0xx
+}; // 21
 
+static const uint16_t scientificai_page_base[][8] = {
+	{ 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000 },	// Empty
+	{ 0x0000, 0x0000, 0x0020, 0x0040, 0x005f, 0x005f, 0x007f, 0x009f },	// U+00xx
+	{ 0x00bf, 0x00df, 0x00ff, 0x011f, 0x013f, 0x015f, 0x0176, 0x0184 },	// U+01xx
+	{ 0x0184, 0x0194, 0x0194, 0x0194, 0x0194, 0x0196, 0x0196, 0x0198 },	// U+02xx
+	{ 0x0198, 0x0198, 0x0198, 0x0198, 0x0199, 0x01a8, 0x01c1, 0x01cb },	// U+03xx
+	{ 0x01cb, 0x01cb, 0x01cd, 0x01cd, 0x01cd, 0x01cd, 0x01cd, 0x01cd },	// U+0Fxx
+	{ 0x01cd, 0x01cd, 0x01cd, 0x01cd, 0x01cd, 0x01ce, 0x01ce, 0x01ce },	// U+1Exx
+	{ 0x01ce, 0x01de, 0x01f3, 0x01fa, 0x01fa, 0x01fa, 0x01fd, 0x01fd },	// U+20xx
+	{ 0x01fd, 0x01fd, 0x01fe, 0x01fe, 0x01fe, 0x0208, 0x021d, 0x022c },	// U+21xx
+	{ 0x022c, 0x0247, 0x0250, 0x0254, 0x0259, 0x0264, 0x026f, 0x0272 },	// U+22xx
+	{ 0x0272, 0x0272, 0x0273, 0x0273, 0x0273, 0x0278, 0x028b, 0x028b },	// U+23xx
+	{ 0x0297, 0x02b1, 0x02c1, 0x02d3, 0x02e9, 0x02f7, 0x0306, 0x0316 },	// U+25xx
+	{ 0x031f, 0x0322, 0x032a, 0x032a, 0x0332, 0x0332, 0x0334, 0x0334 },	// U+26xx
+	{ 0x0334, 0x033a, 0x033b, 0x033c, 0x0340, 0x0340, 0x0340, 0x0348 },	// U+27xx
+	{ 0x0348, 0x0348, 0x0348, 0x0348, 0x0364, 0x0384, 0x03a4, 0x03c4 },	// U+28xx
+	{ 0x03e4, 0x03e8, 0x03e8, 0x03e8, 0x03e8, 0x03e8, 0x03e8, 0x03e8 },	// U+29xx
+	{ 0x03e8, 0x03e8, 0x03e8, 0x03ea, 0x03ee, 0x03f2, 0x03f2, 0x03f2 },	// U+2Bxx
+	{ 0x03f2, 0x03f2, 0x03f2, 0x03f2, 0x03f2, 0x03f2, 0x03f2, 0x03f4 },	// U+30xx
+	{ 0x03f4, 0x03f4, 0x03f4, 0x03f5, 0x03f5, 0x03f5, 0x03f5, 0x03f5 },	// U+53xx
+	{ 0x03f5, 0x03f5, 0x03f5, 0x03f5, 0x03f5, 0x03f7, 0x0400, 0x0408 },	// U+E0xx
+	{ 0x0408, 0x0408, 0x0414, 0x0417, 0x041c, 0x041c, 0x041c, 0x0429 },	// U+F0xx
+}; // 21
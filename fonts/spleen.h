@@ -4,7 +4,7 @@
 * With FBInk's tools/hextoc.py
 */
 
-static const uint16_t spleen_block1[][32] = {
+static const uint16_t spleen_glyphs[][32] = {
 	{ 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000 },	// U+0020 ( )
 	{ 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0180, 0x0180, 0x0180, 0x0180, 0x0180, 0x0180, 0x0180, 0x0180, 0x0180, 0x0180, 0x0180, 0x0180, 0x0180, 0x0180, 0x0000, 0x0000, 0x0000, 0x0180, 0x0180, 0x0180, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000 },	// U+0021 (!)
 	{ 0x0000, 0x0000, 0x0000, 0x0000, 0x1818, 0x1818, 0x1818, 0x1818, 0x1818, 0x1818, 0x1818, 0x1818, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000 },	// U+0022 (")
@@ -101,9 +101,6 @@ static const uint16_t spleen_block1[][32] = {
 	{ 0x0000, 0x0000, 0x00fc, 0x01fc, 0x0380, 0x0300, 0x0300, 0x0300, 0x0300, 0x0300, 0x0300, 0x0300, 0x0300, 0x0700, 0x3e00, 0x3c00, 0x3c00, 0x3e00, 0x0700, 0x0300, 0x0300, 0x0300, 0x0300, 0x0300, 0x0300, 0x0300, 0x0300, 0x0380, 0x01fc, 0x00fc, 0x0000, 0x0000 },	// U+007D (})
 	{ 0x0000, 0x0000, 0x0000, 0x0000, 0x3070, 0x30f8, 0x39dc, 0x1f8c, 0x0f0c, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000 },	// U+007E (~)
 	{ 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000 },	// U+007F ()
-}; // 96
-
-static const uint16_t spleen_block2[][32] = {
 	{ 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000 },	// U+00A0 ( )
 	{ 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0180, 0x0180, 0x0000, 0x0000, 0x0000, 0x0000, 0x0180, 0x0180, 0x0180, 0x0180, 0x0180, 0x0180, 0x0180, 0x0180, 0x0180, 0x0180, 0x0180, 0x0180, 0x0180, 0x0180, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000 },	// U+00A1 (¡)
 	{ 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0300, 0x0300, 0x3ff0, 0x3ff8, 0x031c, 0x030c, 0x030c, 0x030c, 0x030c, 0x030c, 0x030c, 0x030c, 0x030c, 0x031c, 0x3ff8, 0x3ff0, 0x0300, 0x0300, 0x0000, 0x0000, 0x0000, 0x0000 },	// U+00A2 (¢)
@@ -328,31 +325,13 @@ static const uint16_t spleen_block2[][32] = {
 	{ 0x0e70, 0x07e0, 0x03c0, 0x0180, 0x0000, 0x0000, 0x3ffc, 0x3ffc, 0x3000, 0x3000, 0x3000, 0x3000, 0x1800, 0x0c00, 0x0600, 0x0300, 0x0180, 0x00c0, 0x0060, 0x0030, 0x0018, 0x000c, 0x000c, 0x000c, 0x3ffc, 0x3ffc, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000 },	// U+017D (Ž)
 	{ 0x0000, 0x0000, 0x0000, 0x0000, 0x1818, 0x1c38, 0x0e70, 0x07e0, 0x03c0, 0x0180, 0x0000, 0x0000, 0x3ffc, 0x3ffc, 0x3000, 0x1800, 0x0c00, 0x0600, 0x0300, 0x0180, 0x00c0, 0x0060, 0x0030, 0x0018, 0x3ffc, 0x3ffc, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000 },	// U+017E (ž)
 	{ 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x1f80, 0x1fc0, 0x00e0, 0x0060, 0x0060, 0x0060, 0x0078, 0x0078, 0x0060, 0x0060, 0x0060, 0x0060, 0x0060, 0x0060, 0x0060, 0x0060, 0x0060, 0x0060, 0x0060, 0x0060, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000 },	// U+017F (ſ)
-}; // 224
-
-static const uint16_t spleen_block3[][32] = {
 	{ 0x0000, 0x0000, 0x0000, 0x0000, 0x0180, 0x0180, 0x0180, 0x0180, 0x0180, 0x0180, 0x0180, 0x0180, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000 },	// U+2018 (‘)
 	{ 0x0000, 0x0000, 0x0000, 0x0000, 0x0180, 0x0180, 0x0180, 0x0180, 0x0180, 0x0180, 0x0180, 0x0180, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000 },	// U+2019 (’)
-}; // 2
-
-static const uint16_t spleen_block4[][32] = {
 	{ 0x0000, 0x0000, 0x0000, 0x0000, 0x1818, 0x1818, 0x1818, 0x1818, 0x1818, 0x1818, 0x1818, 0x1818, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000 },	// U+201C (“)
 	{ 0x0000, 0x0000, 0x0000, 0x0000, 0x1818, 0x1818, 0x1818, 0x1818, 0x1818, 0x1818, 0x1818, 0x1818, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000 },	// U+201D (”)
-}; // 2
-
-static const uint16_t spleen_block5[][32] = {
 	{ 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x03c0, 0x07e0, 0x07e0, 0x07e0, 0x07e0, 0x03c0, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000 },	// U+2022 (•)
-}; // 1
-
-static const uint16_t spleen_block6[][32] = {
 	{ 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x318c, 0x318c, 0x318c, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000 },	// U+2026 (…)
-}; // 1
-
-static const uint16_t spleen_block7[][32] = {
 	{ 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0fc0, 0x1fe0, 0x3870, 0x3038, 0x0018, 0x000c, 0x000c, 0x03ff, 0x03ff, 0x000c, 0x000c, 0x03ff, 0x03ff, 0x000c, 0x000c, 0x0018, 0x3038, 0x3870, 0x1fe0, 0x0fc0, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000 },	// U+20AC (€)
-}; // 1
-
-static const uint16_t spleen_block8[][32] = {
 	{ 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xffff, 0xffff, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000 },	// U+2500 (─)
 	{ 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xffff, 0xffff, 0xffff, 0xffff, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000 },	// U+2501 (━)
 	{ 0x0180, 0x0180, 0x0180, 0x0180, 0x0180, 0x0180, 0x0180, 0x0180, 0x0180, 0x0180, 0x0180, 0x0180, 0x0180, 0x0180, 0x0180, 0x0180, 0x0180, 0x0180, 0x0180, 0x0180, 0x0180, 0x0180, 0x0180, 0x0180, 0x0180, 0x0180, 0x0180, 0x0180, 0x0180, 0x0180, 0x0180, 0x0180 },	// U+2502 (│)
@@ -513,9 +492,6 @@ static const uint16_t spleen_block8[][32] = {
 	{ 0xff00, 0xff00, 0xff00, 0xff00, 0xff00, 0xff00, 0xff00, 0xff00, 0xff00, 0xff00, 0xff00, 0xff00, 0xff00, 0xff00, 0xff00, 0xff00, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000 },	// U+259D (▝)
 	{ 0xff00, 0xff00, 0xff00, 0xff00, 0xff00, 0xff00, 0xff00, 0xff00, 0xff00, 0xff00, 0xff00, 0xff00, 0xff00, 0xff00, 0xff00, 0xff00, 0x00ff, 0x00ff, 0x00ff, 0x00ff, 0x00ff, 0x00ff, 0x00ff, 0x00ff, 0x00ff, 0x00ff, 0x00ff, 0x00ff, 0x00ff, 0x00ff, 0x00ff, 0x00ff },	// U+259E (▞)
 	{ 0xff00, 0xff00, 0xff00, 0xff00, 0xff00, 0xff00, 0xff00, 0xff00, 0xff00, 0xff00, 0xff00, 0xff00, 0xff00, 0xff00, 0xff00, 0xff00, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff },	// U+259F (▟)
-}; // 160
-
-static const uint16_t spleen_block9[][32] = {
 	{ 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x3ffc, 0x3ffc, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x3ffc, 0x3ffc, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x3ffc, 0x3ffc, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000 },	// U+2630 (☰)
 	{ 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x3e7c, 0x3e7c, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x3ffc, 0x3ffc, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x3ffc, 0x3ffc, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000 },	// U+2631 (☱)
 	{ 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x3ffc, 0x3ffc, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x3e7c, 0x3e7c, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x3ffc, 0x3ffc, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000 },	// U+2632 (☲)
@@ -524,9 +500,6 @@ static const uint16_t spleen_block9[][32] = {
 	{ 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x3e7c, 0x3e7c, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x3ffc, 0x3ffc, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x3e7c, 0x3e7c, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000 },	// U+2635 (☵)
 	{ 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x3ffc, 0x3ffc, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x3e7c, 0x3e7c, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x3e7c, 0x3e7c, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000 },	// U+2636 (☶)
 	{ 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x3e7c, 0x3e7c, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x3e7c, 0x3e7c, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x3e7c, 0x3e7c, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000 },	// U+2637 (☷)
-}; // 8
-
-static const uint16_t spleen_block10[][32] = {
 	{ 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000 },	// U+2800 (⠀)
 	{ 0x0000, 0x0000, 0x0018, 0x003c, 0x003c, 0x0018, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000 },	// U+2801 (⠁)
 	{ 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0018, 0x003c, 0x003c, 0x0018, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000 },	// U+2802 (⠂)
@@ -783,18 +756,51 @@ static const uint16_t spleen_block10[][32] = {
 	{ 0x0000, 0x0000, 0x1818, 0x3c3c, 0x3c3c, 0x1818, 0x0000, 0x0000, 0x0000, 0x0000, 0x1800, 0x3c00, 0x3c00, 0x1800, 0x0000, 0x0000, 0x0000, 0x0000, 0x1818, 0x3c3c, 0x3c3c, 0x1818, 0x0000, 0x0000, 0x0000, 0x0000, 0x1818, 0x3c3c, 0x3c3c, 0x1818, 0x0000, 0x0000 },	// U+28FD (⣽)
 	{ 0x0000, 0x0000, 0x1800, 0x3c00, 0x3c00, 0x1800, 0x0000, 0x0000, 0x0000, 0x0000, 0x1818, 0x3c3c, 0x3c3c, 0x1818, 0x0000, 0x0000, 0x0000, 0x0000, 0x1818, 0x3c3c, 0x3c3c, 0x1818, 0x0000, 0x0000, 0x0000, 0x0000, 0x1818, 0x3c3c, 0x3c3c, 0x1818, 0x0000, 0x0000 },	// U+28FE (⣾)
 	{ 0x0000, 0x0000, 0x1818, 0x3c3c, 0x3c3c, 0x1818, 0x0000, 0x0000, 0x0000, 0x0000, 0x1818, 0x3c3c, 0x3c3c, 0x1818, 0x0000, 0x0000, 0x0000, 0x0000, 0x1818, 0x3c3c, 0x3c3c, 0x1818, 0x0000, 0x0000, 0x0000, 0x0000, 0x1818, 0x3c3c, 0x3c3c, 0x1818, 0x0000, 0x0000 },	// U+28FF (⣿)
-}; // 256
-
-static const uint16_t spleen_block11[][32] = {
 	{ 0x0000, 0x0000, 0x0000, 0x0000, 0x000c, 0x000c, 0x0c0c, 0x1e0c, 0x3f0c, 0x7f8c, 0x0c0c, 0x0c0c, 0x0c0c, 0x0c0c, 0x060c, 0x030c, 0x0184, 0x00c0, 0x0060, 0x0030, 0x0018, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x0000, 0x0000, 0x0000, 0x0000 },	// U+E0A0 ()
 	{ 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x01f8, 0x0000, 0x0000, 0x3180, 0x3180, 0x3380, 0x3380, 0x3580, 0x3580, 0x3980, 0x3980, 0x3180, 0x3180, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000 },	// U+E0A1 ()
 	{ 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x03c0, 0x07e0, 0x0e70, 0x0c30, 0x0c30, 0x0c30, 0x0c30, 0x0c30, 0x3ffc, 0x3ffc, 0x3ffc, 0x3c3c, 0x381c, 0x381c, 0x381c, 0x381c, 0x3c3c, 0x3ffc, 0x3ffc, 0x3ffc, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000 },	// U+E0A2 ()
-}; // 3
-
-static const uint16_t spleen_block12[][32] = {
 	{ 0x0001, 0x0003, 0x0007, 0x000f, 0x001f, 0x003f, 0x007f, 0x00ff, 0x01ff, 0x03ff, 0x07ff, 0x0fff, 0x1fff, 0x3fff, 0x7fff, 0xffff, 0xffff, 0x7fff, 0x3fff, 0x1fff, 0x0fff, 0x07ff, 0x03ff, 0x01ff, 0x00ff, 0x007f, 0x003f, 0x001f, 0x000f, 0x0007, 0x0003, 0x0001 },	// U+E0B0 ()
 	{ 0x0001, 0x0003, 0x0006, 0x000c, 0x0018, 0x0030, 0x0060, 0x00c0, 0x0180, 0x0300, 0x0600, 0x0c00, 0x1800, 0x3000, 0x6000, 0xc000, 0xc000, 0x6000, 0x3000, 0x1800, 0x0c00, 0x0600, 0x0300, 0x0180, 0x00c0, 0x0060, 0x0030, 0x0018, 0x000c, 0x0006, 0x0003, 0x0001 },	// U+E0B1 ()
 	{ 0x8000, 0xc000, 0xe000, 0xf000, 0xf800, 0xfc00, 0xfe00, 0xff00, 0xff80, 0xffc0, 0xffe0, 0xfff0, 0xfff8, 0xfffc, 0xfffe, 0xffff, 0xffff, 0xfffe, 0xfffc, 0xfff8, 0xfff0, 0xffe0, 0xffc0, 0xff80, 0xff00, 0xfe00, 0xfc00, 0xf800, 0xf000, 0xe000, 0xc000, 0x8000 },	// U+E0B2 ()
 	{ 0x8000, 0xc000, 0x6000, 0x3000, 0x1800, 0x0c00, 0x0600, 0x0300, 0x0180, 0x00c0, 0x0060, 0x0030, 0x0018, 0x000c, 0x0006, 0x0003, 0x0003, 0x0006, 0x000c, 0x0018, 0x0030, 0x0060, 0x00c0, 0x0180, 0x0300, 0x0600, 0x0c00, 0x1800, 0x3000, 0x6000, 0xc000, 0x8000 },	// U+E0B3 ()
-}; // 4
+}; // 758
 
+static const uint8_t spleen_page_index[] = {
+	0x01, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x03, 0x00, 0x00, 0x00, 0x00, 0x04, 0x05, 0x00, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x07,
+}; // 225
+
+static const uint32_t spleen_page_bits[][8] = {
+	{ 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000 },	// Empty
+	{ 0x00000000, 0xffffffff, 0xffffffff, 0xffffffff, 0x00000000, 0xffffffff, 0xffffffff, 0xffffffff },	// U+00xx
+	{ 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0x00000000, 0x00000000, 0x00000000, 0x00000000 },	// U+01xx
+	{ 0x33000000, 0x00000044, 0x00000000, 0x00000000, 0x00000000, 0x00001000, 0x00000000, 0x00000000 },	// U+20xx
+	{ 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0x00000000, 0x00000000, 0x00000000 },	// U+25xx
+	{ 0x00000000, 0x00ff0000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000 },	// U+26xx
+	{ 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff },	// U+28xx
+	{ 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x000f0007, 0x00000000, 0x00000000 },	// U+E0xx
+}; // 8
+
+static const uint16_t spleen_page_base[][8] = {
+	{ 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000 },	// Empty
+	{ 0x0000, 0x0000, 0x0020, 0x0040, 0x0060, 0x0060, 0x0080, 0x00a0 },	// U+00xx
+	{ 0x00c0, 0x00e0, 0x0100, 0x0120, 0x0140, 0x0140, 0x0140, 0x0140 },	// U+01xx
+	{ 0x0140, 0x0144, 0x0146, 0x0146, 0x0146, 0x0146, 0x0147, 0x0147 },	// U+20xx
+	{ 0x0147, 0x0167, 0x0187, 0x01a7, 0x01c7, 0x01e7, 0x01e7, 0x01e7 },	// U+25xx
+	{ 0x01e7, 0x01e7, 0x01ef, 0x01ef, 0x01ef, 0x01ef, 0x01ef, 0x01ef },	// U+26xx
+	{ 0x01ef, 0x020f, 0x022f, 0x024f, 0x026f, 0x028f, 0x02af, 0x02cf },	// U+28xx
+	{ 0x02ef, 0x02ef, 0x02ef, 0x02ef, 0x02ef, 0x02ef, 0x02f6, 0x02f6 },	// U+E0xx
+}; // 8
@@ -4,7 +4,7 @@
 * With FBInk's tools/hextoc.py
 */
 
-static const unsigned char tall_block1[][16] = {
+static const unsigned char tall_glyphs[][16] = {
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+0000 (ESC)
 	{ 0x07, 0x07, 0x01, 0x01, 0x57, 0x57, 0x54, 0x54, 0x77, 0x77, 0x50, 0x50, 0x50, 0x50, 0x00, 0x00 },	// U+0001 (ESC)
 	{ 0x07, 0x07, 0x01, 0x01, 0x57, 0x57, 0x54, 0x54, 0x27, 0x27, 0x50, 0x50, 0x50, 0x50, 0x00, 0x00 },	// U+0002 (ESC)
@@ -421,9 +421,6 @@ static const unsigned char tall_block1[][16] = {
 	{ 0x00, 0x00, 0x63, 0x63, 0x67, 0x67, 0x6f, 0x7f, 0x7b, 0x73, 0x73, 0x63, 0x63, 0x03, 0x03, 0x03 },	// U+019D (Ɲ)
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3e, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x60, 0x60, 0x60 },	// U+019E (ƞ)
 	{ 0x00, 0x00, 0x3c, 0x66, 0x66, 0x66, 0x66, 0x7e, 0x66, 0x66, 0x66, 0x66, 0x3c, 0x00, 0x00, 0x00 },	// U+019F (Ɵ)
-}; // 416
-
-static const unsigned char tall_block2[][16] = {
 	{ 0x66, 0x18, 0x00, 0x18, 0x3c, 0x66, 0x66, 0x66, 0x7e, 0x66, 0x66, 0x66, 0x66, 0x00, 0x00, 0x00 },	// U+01CD (Ǎ)
 	{ 0x00, 0x66, 0x3c, 0x18, 0x00, 0x00, 0x3c, 0x60, 0x7c, 0x66, 0x66, 0x66, 0x7c, 0x00, 0x00, 0x00 },	// U+01CE (ǎ)
 	{ 0x66, 0x18, 0x00, 0x7e, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x7e, 0x00, 0x00, 0x00 },	// U+01CF (Ǐ)
@@ -447,24 +444,12 @@ static const unsigned char tall_block2[][16] = {
 	{ 0x00, 0x7e, 0x00, 0x66, 0x00, 0x00, 0x3c, 0x60, 0x7c, 0x66, 0x66, 0x66, 0x7c, 0x00, 0x00, 0x00 },	// U+01E1 (ǡ)
 	{ 0x7e, 0x00, 0xfc, 0x3e, 0x3f, 0x33, 0x33, 0x7f, 0x33, 0x33, 0x33, 0x33, 0xf3, 0x00, 0x00, 0x00 },	// U+01E2 (Ǣ)
 	{ 0x00, 0x00, 0x00, 0x7e, 0x00, 0x00, 0x7e, 0xd8, 0xd8, 0xfe, 0x1b, 0x1b, 0xee, 0x00, 0x00, 0x00 },	// U+01E3 (ǣ)
-}; // 23
-
-static const unsigned char tall_block3[][16] = {
 	{ 0x66, 0x18, 0x00, 0x3c, 0x66, 0x66, 0x06, 0x06, 0x76, 0x66, 0x66, 0x66, 0x7c, 0x00, 0x00, 0x00 },	// U+01E6 (Ǧ)
 	{ 0x00, 0x66, 0x3c, 0x18, 0x00, 0x00, 0x7c, 0x66, 0x66, 0x66, 0x66, 0x66, 0x7c, 0x60, 0x60, 0x3e },	// U+01E7 (ǧ)
 	{ 0x66, 0x18, 0x00, 0x63, 0x63, 0x33, 0x1b, 0x0f, 0x1b, 0x33, 0x33, 0x63, 0x63, 0x00, 0x00, 0x00 },	// U+01E8 (Ǩ)
-}; // 3
-
-static const unsigned char tall_block4[][16] = {
 	{ 0x00, 0x66, 0x3c, 0x18, 0x00, 0x00, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x1e },	// U+01F0 (ǰ)
-}; // 1
-
-static const unsigned char tall_block5[][16] = {
 	{ 0x30, 0x18, 0x00, 0x3c, 0x66, 0x66, 0x06, 0x06, 0x76, 0x66, 0x66, 0x66, 0x7c, 0x00, 0x00, 0x00 },	// U+01F4 (Ǵ)
 	{ 0x00, 0x00, 0x30, 0x18, 0x00, 0x00, 0x7c, 0x66, 0x66, 0x66, 0x66, 0x66, 0x7c, 0x60, 0x60, 0x3e },	// U+01F5 (ǵ)
-}; // 2
-
-static const unsigned char tall_block6[][16] = {
 	{ 0x0c, 0x18, 0x00, 0x63, 0x63, 0x67, 0x6f, 0x7b, 0x73, 0x63, 0x63, 0x63, 0x63, 0x00, 0x00, 0x00 },	// U+01F8 (Ǹ)
 	{ 0x00, 0x00, 0x0c, 0x18, 0x00, 0x00, 0x3e, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x00, 0x00, 0x00 },	// U+01F9 (ǹ)
 	{ 0x0e, 0xdb, 0x6e, 0x00, 0x18, 0x3c, 0x66, 0x66, 0x7e, 0x66, 0x66, 0x66, 0x66, 0x00, 0x00, 0x00 },	// U+01FA (Ǻ)
@@ -501,14 +486,8 @@ static const unsigned char tall_block6[][16] = {
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7c, 0x06, 0x06, 0x3c, 0x60, 0x60, 0x3e, 0x00, 0x18, 0x0c },	// U+0219 (ș)
 	{ 0x00, 0x00, 0x7e, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x00, 0x18, 0x0c },	// U+021A (Ț)
 	{ 0x00, 0x00, 0x00, 0x0c, 0x0c, 0x0c, 0x7e, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x78, 0x00, 0x18, 0x0c },	// U+021B (ț)
-}; // 36
-
-static const unsigned char tall_block7[][16] = {
 	{ 0x18, 0x18, 0x00, 0x18, 0x3c, 0x66, 0x66, 0x66, 0x7e, 0x66, 0x66, 0x66, 0x66, 0x00, 0x00, 0x00 },	// U+0226 (Ȧ)
 	{ 0x00, 0x00, 0x18, 0x18, 0x00, 0x00, 0x3c, 0x60, 0x7c, 0x66, 0x66, 0x66, 0x7c, 0x00, 0x00, 0x00 },	// U+0227 (ȧ)
-}; // 2
-
-static const unsigned char tall_block8[][16] = {
 	{ 0x7e, 0x00, 0x66, 0x00, 0x3c, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x3c, 0x00, 0x00, 0x00 },	// U+022A (Ȫ)
 	{ 0x00, 0x7e, 0x00, 0x66, 0x00, 0x00, 0x3c, 0x66, 0x66, 0x66, 0x66, 0x66, 0x3c, 0x00, 0x00, 0x00 },	// U+022B (ȫ)
 	{ 0x7f, 0x00, 0x6e, 0x3b, 0x3c, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x3c, 0x00, 0x00, 0x00 },	// U+022C (Ȭ)
@@ -519,27 +498,12 @@ static const unsigned char tall_block8[][16] = {
 	{ 0x00, 0x7e, 0x00, 0x66, 0x00, 0x00, 0x3c, 0x66, 0x66, 0x66, 0x66, 0x66, 0x3c, 0x00, 0x00, 0x00 },	// U+0231 (ȱ)
 	{ 0x7e, 0x00, 0xc3, 0xc3, 0x66, 0x66, 0x3c, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x00, 0x00, 0x00 },	// U+0232 (Ȳ)
 	{ 0x00, 0x00, 0x00, 0x7e, 0x00, 0x00, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x7c, 0x60, 0x60, 0x3c },	// U+0233 (ȳ)
-}; // 10
-
-static const unsigned char tall_block9[][16] = {
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3c, 0x66, 0x66, 0x7e, 0x60, 0x60, 0x3c, 0x00, 0x00, 0x00 },	// U+0258 (ɘ)
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3c, 0x60, 0x60, 0x7e, 0x66, 0x66, 0x3c, 0x00, 0x00, 0x00 },	// U+0259 (ə)
-}; // 2
-
-static const unsigned char tall_block10[][16] = {
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3c, 0x66, 0x06, 0x1c, 0x06, 0x66, 0x3c, 0x00, 0x00, 0x00 },	// U+025B (ɛ)
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3c, 0x66, 0x60, 0x38, 0x60, 0x66, 0x3c, 0x00, 0x00, 0x00 },	// U+025C (ɜ)
-}; // 2
-
-static const unsigned char tall_block11[][16] = {
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x63, 0x63, 0x63, 0x63, 0x36, 0x36, 0x1c, 0x36, 0x1c, 0x00 },	// U+0263 (ɣ)
-}; // 1
-
-static const unsigned char tall_block12[][16] = {
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7e, 0x18, 0x18, 0x18, 0x18, 0x18, 0x7e, 0x00, 0x00, 0x00 },	// U+026A (ɪ)
-}; // 1
-
-static const unsigned char tall_block13[][16] = {
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x77, 0x22, 0x63, 0x63, 0x63, 0x63, 0x3e, 0x00, 0x00, 0x00 },	// U+028A (ʊ)
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x36, 0x66, 0x66, 0x66, 0x66, 0x66, 0x3c, 0x00, 0x00, 0x00 },	// U+028B (ʋ)
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x3c, 0x66, 0x66, 0x66, 0x66, 0x66, 0x00, 0x00, 0x00 },	// U+028C (ʌ)
@@ -553,29 +517,11 @@ static const unsigned char tall_block13[][16] = {
 	{ 0x00, 0x3c, 0x66, 0x66, 0x60, 0x60, 0x38, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x00, 0x00, 0x00 },	// U+0294 (ʔ)
 	{ 0x00, 0x00, 0x3c, 0x66, 0x66, 0x66, 0x06, 0x0c, 0x18, 0x18, 0x18, 0x18, 0x18, 0x00, 0x00, 0x00 },	// U+0295 (ʕ)
 	{ 0x00, 0x00, 0x18, 0x18, 0x18, 0x18, 0x18, 0x30, 0x60, 0x66, 0x66, 0x66, 0x3c, 0x00, 0x00, 0x00 },	// U+0296 (ʖ)
-}; // 13
-
-static const unsigned char tall_block14[][16] = {
 	{ 0x18, 0x66, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+02C6 (ˆ)
-}; // 1
-
-static const unsigned char tall_block15[][16] = {
 	{ 0x3c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+02C9 (ˉ)
-}; // 1
-
-static const unsigned char tall_block16[][16] = {
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3c },	// U+02CD (ˍ)
-}; // 1
-
-static const unsigned char tall_block17[][16] = {
 	{ 0x7f, 0x00, 0x6e, 0x3b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+02DC (˜)
-}; // 1
-
-static const unsigned char tall_block18[][16] = {
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+034F (͏)
-}; // 1
-
-static const unsigned char tall_block19[][16] = {
 	{ 0x00, 0x00, 0x18, 0x3c, 0x66, 0x66, 0x66, 0x7e, 0x66, 0x66, 0x66, 0x66, 0x66, 0x00, 0x00, 0x00 },	// U+0391 (Α)
 	{ 0x00, 0x00, 0x3e, 0x66, 0x66, 0x66, 0x36, 0x1e, 0x36, 0x66, 0x66, 0x66, 0x3e, 0x00, 0x00, 0x00 },	// U+0392 (Β)
 	{ 0x00, 0x00, 0x7e, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x00, 0x00, 0x00 },	// U+0393 (Γ)
@@ -593,9 +539,6 @@ static const unsigned char tall_block19[][16] = {
 	{ 0x00, 0x00, 0x3c, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x3c, 0x00, 0x00, 0x00 },	// U+039F (Ο)
 	{ 0x00, 0x00, 0x7f, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x00, 0x00, 0x00 },	// U+03A0 (Π)
 	{ 0x00, 0x00, 0x3e, 0x66, 0x66, 0x66, 0x66, 0x3e, 0x06, 0x06, 0x06, 0x06, 0x06, 0x00, 0x00, 0x00 },	// U+03A1 (Ρ)
-}; // 17
-
-static const unsigned char tall_block20[][16] = {
 	{ 0x00, 0x00, 0x7f, 0x03, 0x06, 0x0c, 0x18, 0x30, 0x18, 0x0c, 0x06, 0x03, 0x7f, 0x00, 0x00, 0x00 },	// U+03A3 (Σ)
 	{ 0x00, 0x00, 0x7e, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x00, 0x00, 0x00 },	// U+03A4 (Τ)
 	{ 0x00, 0x00, 0x66, 0x66, 0x66, 0x66, 0x66, 0x3c, 0x18, 0x18, 0x18, 0x18, 0x18, 0x00, 0x00, 0x00 },	// U+03A5 (Υ)
@@ -603,9 +546,6 @@ static const unsigned char tall_block20[][16] = {
 	{ 0x00, 0x00, 0xc3, 0xc3, 0x66, 0x3c, 0x18, 0x18, 0x18, 0x3c, 0x66, 0xc3, 0xc3, 0x00, 0x00, 0x00 },	// U+03A7 (Χ)
 	{ 0x00, 0x00, 0x00, 0x08, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x3e, 0x08, 0x08, 0x08, 0x00, 0x00, 0x00 },	// U+03A8 (Ψ)
 	{ 0x00, 0x00, 0x00, 0x3e, 0x63, 0x63, 0x63, 0x63, 0x63, 0x77, 0x36, 0x36, 0x77, 0x00, 0x00, 0x00 },	// U+03A9 (Ω)
-}; // 7
-
-static const unsigned char tall_block21[][16] = {
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6e, 0x73, 0x63, 0x63, 0x63, 0x73, 0x6e, 0x00, 0x00, 0x00 },	// U+03B1 (α)
 	{ 0x00, 0x00, 0x3e, 0x63, 0x63, 0x63, 0x63, 0x3f, 0x63, 0x63, 0x63, 0x67, 0x3b, 0x03, 0x03, 0x00 },	// U+03B2 (β)
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x63, 0x63, 0x63, 0x36, 0x36, 0x1c, 0x36, 0x36, 0x1c, 0x00 },	// U+03B3 (γ)
@@ -631,22 +571,13 @@ static const unsigned char tall_block21[][16] = {
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x63, 0x63, 0x36, 0x1c, 0x36, 0x63, 0x63, 0x00, 0x00, 0x00 },	// U+03C7 (χ)
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x3e, 0x08, 0x08, 0x00 },	// U+03C8 (ψ)
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x36, 0x63, 0x6b, 0x6b, 0x6b, 0x6b, 0x36, 0x00, 0x00, 0x00 },	// U+03C9 (ω)
-}; // 25
-
-static const unsigned char tall_block22[][16] = {
 	{ 0x0c, 0x18, 0x00, 0x7e, 0x06, 0x06, 0x06, 0x3e, 0x06, 0x06, 0x06, 0x06, 0x7e, 0x00, 0x00, 0x00 },	// U+0400 (Ѐ)
 	{ 0x66, 0x66, 0x00, 0x7e, 0x06, 0x06, 0x06, 0x3e, 0x06, 0x06, 0x06, 0x06, 0x7e, 0x00, 0x00, 0x00 },	// U+0401 (Ё)
-}; // 2
-
-static const unsigned char tall_block23[][16] = {
 	{ 0x00, 0x00, 0x3c, 0x66, 0x66, 0x06, 0x0c, 0x18, 0x30, 0x60, 0x66, 0x66, 0x3c, 0x00, 0x00, 0x00 },	// U+0405 (Ѕ)
 	{ 0x00, 0x00, 0x7e, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x7e, 0x00, 0x00, 0x00 },	// U+0406 (І)
 	{ 0x66, 0x66, 0x00, 0x7e, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x7e, 0x00, 0x00, 0x00 },	// U+0407 (Ї)
 	{ 0x00, 0x00, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x66, 0x66, 0x3c, 0x00, 0x00, 0x00 },	// U+0408 (Ј)
 	{ 0x00, 0x00, 0x3c, 0x36, 0x36, 0x36, 0x36, 0x76, 0xb6, 0xb6, 0xb6, 0xb6, 0x73, 0x00, 0x00, 0x00 },	// U+0409 (Љ)
-}; // 5
-
-static const unsigned char tall_block24[][16] = {
 	{ 0x00, 0x00, 0x18, 0x3c, 0x66, 0x66, 0x66, 0x7e, 0x66, 0x66, 0x66, 0x66, 0x66, 0x00, 0x00, 0x00 },	// U+0410 (А)
 	{ 0x00, 0x00, 0x7e, 0x06, 0x06, 0x06, 0x06, 0x3e, 0x66, 0x66, 0x66, 0x66, 0x3e, 0x00, 0x00, 0x00 },	// U+0411 (Б)
 	{ 0x00, 0x00, 0x3e, 0x66, 0x66, 0x66, 0x36, 0x1e, 0x36, 0x66, 0x66, 0x66, 0x3e, 0x00, 0x00, 0x00 },	// U+0412 (В)
@@ -713,16 +644,10 @@ static const unsigned char tall_block24[][16] = {
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7c, 0x66, 0x66, 0x7c, 0x78, 0x6c, 0x66, 0x00, 0x00, 0x00 },	// U+044F (я)
 	{ 0x00, 0x00, 0x0c, 0x18, 0x00, 0x00, 0x3c, 0x66, 0x66, 0x7e, 0x06, 0x06, 0x3c, 0x00, 0x00, 0x00 },	// U+0450 (ѐ)
 	{ 0x00, 0x00, 0x66, 0x66, 0x00, 0x00, 0x3c, 0x66, 0x66, 0x7e, 0x06, 0x06, 0x3c, 0x00, 0x00, 0x00 },	// U+0451 (ё)
-}; // 66
-
-static const unsigned char tall_block25[][16] = {
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7c, 0x06, 0x06, 0x3c, 0x60, 0x60, 0x3e, 0x00, 0x00, 0x00 },	// U+0455 (ѕ)
 	{ 0x00, 0x00, 0x18, 0x18, 0x00, 0x00, 0x1e, 0x18, 0x18, 0x18, 0x18, 0x18, 0x78, 0x00, 0x00, 0x00 },	// U+0456 (і)
 	{ 0x00, 0x00, 0x66, 0x66, 0x00, 0x00, 0x1c, 0x18, 0x18, 0x18, 0x18, 0x18, 0x3c, 0x00, 0x00, 0x00 },	// U+0457 (ї)
 	{ 0x00, 0x00, 0x30, 0x30, 0x00, 0x00, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x1e },	// U+0458 (ј)
-}; // 4
-
-static const unsigned char tall_block26[][16] = {
 	{ 0x66, 0x3c, 0x00, 0x18, 0x3c, 0x66, 0x66, 0x66, 0x7e, 0x66, 0x66, 0x66, 0x66, 0x00, 0x00, 0x00 },	// U+04D0 (Ӑ)
 	{ 0x00, 0x00, 0x66, 0x3c, 0x00, 0x00, 0x3c, 0x60, 0x7c, 0x66, 0x66, 0x66, 0x7c, 0x00, 0x00, 0x00 },	// U+04D1 (ӑ)
 	{ 0x66, 0x66, 0x00, 0x18, 0x3c, 0x66, 0x66, 0x66, 0x7e, 0x66, 0x66, 0x66, 0x66, 0x00, 0x00, 0x00 },	// U+04D2 (Ӓ)
@@ -731,18 +656,9 @@ static const unsigned char tall_block26[][16] = {
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7e, 0xd8, 0xd8, 0xfe, 0x1b, 0x1b, 0xee, 0x00, 0x00, 0x00 },	// U+04D5 (ӕ)
 	{ 0x66, 0x3c, 0x00, 0x7e, 0x06, 0x06, 0x06, 0x3e, 0x06, 0x06, 0x06, 0x06, 0x7e, 0x00, 0x00, 0x00 },	// U+04D6 (Ӗ)
 	{ 0x00, 0x00, 0x66, 0x3c, 0x00, 0x00, 0x3c, 0x66, 0x66, 0x7e, 0x06, 0x06, 0x3c, 0x00, 0x00, 0x00 },	// U+04D7 (ӗ)
-}; // 8
-
-static const unsigned char tall_block27[][16] = {
 	{ 0x66, 0x66, 0x00, 0x3c, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x3c, 0x00, 0x00, 0x00 },	// U+04E6 (Ӧ)
 	{ 0x00, 0x00, 0x66, 0x66, 0x00, 0x00, 0x3c, 0x66, 0x66, 0x66, 0x66, 0x66, 0x3c, 0x00, 0x00, 0x00 },	// U+04E7 (ӧ)
-}; // 2
-
-static const unsigned char tall_block28[][16] = {
 	{ 0x00, 0x00, 0x66, 0x66, 0x00, 0x00, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x7c, 0x60, 0x60, 0x3c },	// U+04F1 (ӱ)
-}; // 1
-
-static const unsigned char tall_block29[][16] = {
 	{ 0x00, 0x00, 0x66, 0x66, 0x6e, 0x6e, 0x3c, 0x3c, 0x76, 0x76, 0x66, 0x66, 0x00, 0x00, 0x00, 0x00 },	// U+05D0 (א)
 	{ 0x00, 0x00, 0x3e, 0x3e, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x7e, 0x7e, 0x00, 0x00, 0x00, 0x00 },	// U+05D1 (ב)
 	{ 0x00, 0x00, 0x78, 0x78, 0x60, 0x60, 0x70, 0x70, 0x78, 0x78, 0x6c, 0x6c, 0x00, 0x00, 0x00, 0x00 },	// U+05D2 (ג)
@@ -770,13 +686,7 @@ static const unsigned char tall_block29[][16] = {
 	{ 0x00, 0x00, 0x1e, 0x1e, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x00, 0x00, 0x00, 0x00 },	// U+05E8 (ר)
 	{ 0x00, 0x00, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x7f, 0x7f, 0x00, 0x00, 0x00, 0x00 },	// U+05E9 (ש)
 	{ 0x00, 0x00, 0x7c, 0x7c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6e, 0x6e, 0x00, 0x00, 0x00, 0x00 },	// U+05EA (ת)
-}; // 27
-
-static const unsigned char tall_block30[][16] = {
 	{ 0x0c, 0x02, 0x1c, 0x02, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+0623 (أ)
-}; // 1
-
-static const unsigned char tall_block31[][16] = {
 	{ 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+0627 (ا)
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x81, 0x81, 0x81, 0xff, 0x7e, 0x00, 0x18, 0x00, 0x00, 0x00, 0x00 },	// U+0628 (ب)
 	{ 0x00, 0x00, 0xcc, 0x00, 0x70, 0xf8, 0x88, 0x88, 0xf8, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+0629 (ة)
@@ -784,9 +694,6 @@ static const unsigned char tall_block31[][16] = {
 	{ 0x00, 0x18, 0x00, 0x66, 0x00, 0x81, 0x81, 0x81, 0xff, 0x7e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+062B (ث)
 	{ 0x00, 0x00, 0x00, 0x1e, 0x30, 0x60, 0xfc, 0x7e, 0x03, 0x19, 0x03, 0x7e, 0x3c, 0x00, 0x00, 0x00 },	// U+062C (ج)
 	{ 0x00, 0x00, 0x00, 0x1e, 0x30, 0x60, 0xfc, 0x7e, 0x03, 0x01, 0x03, 0x7e, 0x3c, 0x00, 0x00, 0x00 },	// U+062D (ح)
-}; // 7
-
-static const unsigned char tall_block32[][16] = {
 	{ 0x00, 0x00, 0x00, 0x38, 0x78, 0xc0, 0x80, 0xc0, 0x7e, 0x3c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+062F (د)
 	{ 0x00, 0x30, 0x00, 0x38, 0x78, 0xc0, 0x80, 0xc0, 0x7e, 0x3c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+0630 (ذ)
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0xe0, 0xc0, 0x80, 0x80, 0x40, 0x3e, 0x1c, 0x00, 0x00, 0x00 },	// U+0631 (ر)
@@ -794,16 +701,10 @@ static const unsigned char tall_block32[][16] = {
 	{ 0x00, 0x00, 0x00, 0x88, 0xa8, 0xf9, 0x51, 0x21, 0x3f, 0x1e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+0633 (س)
 	{ 0x30, 0x00, 0xcc, 0x00, 0x88, 0xa8, 0xf9, 0x21, 0x3f, 0x1e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+0634 (ش)
 	{ 0x00, 0x00, 0x78, 0x8c, 0xf8, 0x79, 0x11, 0x21, 0x3f, 0x1e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+0635 (ص)
-}; // 7
-
-static const unsigned char tall_block33[][16] = {
 	{ 0x04, 0x04, 0x04, 0x04, 0x64, 0xf4, 0x9c, 0x8c, 0xff, 0x7f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+0637 (ط)
 	{ 0x04, 0x64, 0x04, 0x04, 0x64, 0xf4, 0x9c, 0x8c, 0xff, 0x7f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+0638 (ظ)
 	{ 0x00, 0x00, 0x00, 0x1c, 0x3e, 0x02, 0x3e, 0x1c, 0x06, 0x82, 0xc6, 0x7e, 0x3c, 0x00, 0x00, 0x00 },	// U+0639 (ع)
 	{ 0x00, 0x0c, 0x00, 0x1c, 0x3e, 0x02, 0x3e, 0x1c, 0x06, 0x82, 0xc6, 0x7e, 0x3c, 0x00, 0x00, 0x00 },	// U+063A (غ)
-}; // 4
-
-static const unsigned char tall_block34[][16] = {
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+0640 (ـ)
 	{ 0x00, 0x00, 0x30, 0x00, 0x70, 0xf8, 0x88, 0xf9, 0x81, 0xff, 0x7e, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+0641 (ف)
 	{ 0x00, 0x00, 0xd8, 0x00, 0x70, 0xf8, 0x88, 0xf9, 0x81, 0xff, 0x7e, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+0642 (ق)
@@ -815,44 +716,23 @@ static const unsigned char tall_block34[][16] = {
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x1c, 0x3e, 0x22, 0x3e, 0x3c, 0x10, 0x1c, 0x0c, 0x00, 0x00, 0x00 },	// U+0648 (و)
 	{ 0x00, 0x00, 0x00, 0xf0, 0xf8, 0x08, 0x78, 0xf1, 0x81, 0xff, 0x7e, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+0649 (ى)
 	{ 0x00, 0x00, 0x00, 0xf0, 0xf8, 0x08, 0x78, 0xf1, 0x81, 0xff, 0x7e, 0x00, 0x6c, 0x00, 0x00, 0x00 },	// U+064A (ي)
-}; // 11
-
-static const unsigned char tall_block35[][16] = {
 	{ 0x30, 0x48, 0x3e, 0x00, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+0671 (ٱ)
 	{ 0x60, 0x14, 0x7a, 0x00, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+0672 (ٲ)
 	{ 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x00, 0xc0, 0x2c, 0xf6, 0x00, 0x00 },	// U+0673 (ٳ)
-}; // 3
-
-static const unsigned char tall_block36[][16] = {
 	{ 0x18, 0x18, 0x00, 0x3c, 0x66, 0x66, 0x0c, 0x18, 0x30, 0x60, 0x66, 0x66, 0x3c, 0x00, 0x00, 0x00 },	// U+1560 (ᕠ)
 	{ 0x00, 0x00, 0x18, 0x18, 0x00, 0x00, 0x7c, 0x06, 0x06, 0x3c, 0x60, 0x60, 0x3e, 0x00, 0x00, 0x00 },	// U+1561 (ᕡ)
 	{ 0x00, 0x00, 0x3c, 0x66, 0x66, 0x06, 0x0c, 0x18, 0x30, 0x60, 0x66, 0x66, 0x3c, 0x00, 0x18, 0x18 },	// U+1562 (ᕢ)
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7c, 0x06, 0x06, 0x3c, 0x60, 0x60, 0x3e, 0x00, 0x18, 0x18 },	// U+1563 (ᕣ)
-}; // 4
-
-static const unsigned char tall_block37[][16] = {
 	{ 0x18, 0x18, 0x00, 0x7e, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x00, 0x00, 0x00 },	// U+156A (ᕪ)
-}; // 1
-
-static const unsigned char tall_block38[][16] = {
 	{ 0x00, 0x00, 0x7e, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x00, 0x18, 0x18 },	// U+156C (ᕬ)
 	{ 0x00, 0x00, 0x00, 0x0c, 0x0c, 0x0c, 0x7e, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x78, 0x00, 0x18, 0x18 },	// U+156D (ᕭ)
 	{ 0x00, 0x00, 0x7e, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x00, 0x7e, 0x00 },	// U+156E (ᕮ)
 	{ 0x00, 0x00, 0x00, 0x0c, 0x0c, 0x0c, 0x7e, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x78, 0x00, 0x7e, 0x00 },	// U+156F (ᕯ)
 	{ 0x00, 0x00, 0x7e, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x00, 0x66, 0x3c },	// U+1570 (ᕰ)
 	{ 0x00, 0x00, 0x00, 0x0c, 0x0c, 0x0c, 0x7e, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x78, 0x00, 0x66, 0x3c },	// U+1571 (ᕱ)
-}; // 6
-
-static const unsigned char tall_block39[][16] = {
 	{ 0x7e, 0x00, 0x3e, 0x66, 0x66, 0x66, 0x66, 0x3e, 0x36, 0x66, 0x66, 0x66, 0x66, 0x00, 0x18, 0x18 },	// U+15EC (ᗬ)
 	{ 0x00, 0x00, 0x00, 0x7e, 0x00, 0x00, 0x3e, 0x66, 0x66, 0x06, 0x06, 0x06, 0x06, 0x00, 0x18, 0x18 },	// U+15ED (ᗭ)
-}; // 2
-
-static const unsigned char tall_block40[][16] = {
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3e, 0x66, 0x66, 0x06, 0x06, 0x06, 0x06, 0x00, 0x7e, 0x00 },	// U+15EF (ᗯ)
-}; // 1
-
-static const unsigned char tall_block41[][16] = {
 	{ 0x36, 0x36, 0x1e, 0x1e, 0x06, 0x06, 0x36, 0x36, 0x1e, 0x1e, 0x06, 0x06, 0x06, 0x06, 0x00, 0x00 },	// U+16A0 (ᚠ)
 	{ 0x6b, 0x6b, 0x33, 0x33, 0x1f, 0x1f, 0x03, 0x03, 0x33, 0x33, 0x1f, 0x1f, 0x03, 0x03, 0x00, 0x00 },	// U+16A1 (ᚡ)
 	{ 0x06, 0x06, 0x0e, 0x0e, 0x1e, 0x1e, 0x36, 0x36, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x00, 0x00 },	// U+16A2 (ᚢ)
@@ -865,9 +745,6 @@ static const unsigned char tall_block41[][16] = {
 	{ 0x6e, 0x6e, 0x36, 0x36, 0x06, 0x06, 0x6e, 0x6e, 0x36, 0x36, 0x06, 0x06, 0x06, 0x06, 0x00, 0x00 },	// U+16A9 (ᚩ)
 	{ 0x6e, 0x6e, 0x36, 0x36, 0x06, 0x06, 0x1e, 0x1e, 0x36, 0x36, 0x06, 0x06, 0x06, 0x06, 0x00, 0x00 },	// U+16AA (ᚪ)
 	{ 0x3c, 0x3c, 0x6c, 0x6c, 0x0c, 0x0c, 0x3c, 0x3c, 0x6c, 0x6c, 0x0c, 0x0c, 0x0c, 0x0c, 0x00, 0x00 },	// U+16AB (ᚫ)
-}; // 12
-
-static const unsigned char tall_block42[][16] = {
 	{ 0x1e, 0x1e, 0x36, 0x36, 0x66, 0x66, 0x36, 0x36, 0x1e, 0x1e, 0x36, 0x36, 0x66, 0x66, 0x00, 0x00 },	// U+16B1 (ᚱ)
 	{ 0x00, 0x00, 0x18, 0x18, 0x0c, 0x0c, 0x06, 0x06, 0x0c, 0x0c, 0x18, 0x18, 0x00, 0x00, 0x00, 0x00 },	// U+16B2 (ᚲ)
 	{ 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x0e, 0x0e, 0x1e, 0x1e, 0x36, 0x36, 0x66, 0x66, 0x00, 0x00 },	// U+16B3 (ᚳ)
@@ -940,33 +817,18 @@ static const unsigned char tall_block42[][16] = {
 	{ 0x06, 0x06, 0x06, 0x06, 0x6c, 0x6c, 0x18, 0x18, 0x36, 0x36, 0x60, 0x60, 0x60, 0x60, 0x00, 0x00 },	// U+16F6 (ᛶ)
 	{ 0x06, 0x06, 0x06, 0x06, 0x3e, 0x3e, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x00, 0x00 },	// U+16F7 (ᛷ)
 	{ 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x3c, 0x3c, 0x66, 0x66, 0x66, 0x66, 0x00, 0x00 },	// U+16F8 (ᛸ)
-}; // 72
-
-static const unsigned char tall_block43[][16] = {
 	{ 0x00, 0x00, 0x18, 0x3c, 0x66, 0x66, 0x66, 0x7e, 0x66, 0x66, 0x66, 0x66, 0x66, 0x18, 0x24, 0x18 },	// U+1E00 (Ḁ)
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3c, 0x60, 0x7c, 0x66, 0x66, 0x66, 0x7c, 0x18, 0x24, 0x18 },	// U+1E01 (ḁ)
 	{ 0x18, 0x18, 0x00, 0x3e, 0x66, 0x66, 0x36, 0x1e, 0x36, 0x66, 0x66, 0x66, 0x3e, 0x00, 0x00, 0x00 },	// U+1E02 (Ḃ)
-}; // 3
-
-static const unsigned char tall_block44[][16] = {
 	{ 0x00, 0x00, 0x3e, 0x66, 0x66, 0x66, 0x36, 0x1e, 0x36, 0x66, 0x66, 0x66, 0x3e, 0x00, 0x18, 0x18 },	// U+1E04 (Ḅ)
 	{ 0x00, 0x00, 0x06, 0x06, 0x06, 0x06, 0x3e, 0x66, 0x66, 0x66, 0x66, 0x66, 0x3e, 0x00, 0x18, 0x18 },	// U+1E05 (ḅ)
 	{ 0x00, 0x00, 0x3e, 0x66, 0x66, 0x66, 0x36, 0x1e, 0x36, 0x66, 0x66, 0x66, 0x3e, 0x00, 0x7e, 0x00 },	// U+1E06 (Ḇ)
 	{ 0x00, 0x00, 0x06, 0x06, 0x06, 0x06, 0x3e, 0x66, 0x66, 0x66, 0x66, 0x66, 0x3e, 0x00, 0x7e, 0x00 },	// U+1E07 (ḇ)
-}; // 4
-
-static const unsigned char tall_block45[][16] = {
 	{ 0x18, 0x18, 0x00, 0x1e, 0x36, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x36, 0x1e, 0x00, 0x00, 0x00 },	// U+1E0A (Ḋ)
-}; // 1
-
-static const unsigned char tall_block46[][16] = {
 	{ 0x00, 0x00, 0x1e, 0x36, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x36, 0x1e, 0x00, 0x18, 0x18 },	// U+1E0C (Ḍ)
 	{ 0x00, 0x00, 0x60, 0x60, 0x60, 0x60, 0x7c, 0x66, 0x66, 0x66, 0x66, 0x66, 0x7c, 0x00, 0x18, 0x18 },	// U+1E0D (ḍ)
 	{ 0x00, 0x00, 0x1e, 0x36, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x36, 0x1e, 0x00, 0x7e, 0x00 },	// U+1E0E (Ḏ)
 	{ 0x00, 0x00, 0x60, 0x60, 0x60, 0x60, 0x7c, 0x66, 0x66, 0x66, 0x66, 0x66, 0x7c, 0x00, 0x7e, 0x00 },	// U+1E0F (ḏ)
-}; // 4
-
-static const unsigned char tall_block47[][16] = {
 	{ 0x00, 0x00, 0x18, 0x18, 0x00, 0x00, 0x33, 0x7f, 0x6b, 0x6b, 0x6b, 0x6b, 0x63, 0x00, 0x00, 0x00 },	// U+1E41 (ṁ)
 	{ 0x00, 0x00, 0x63, 0x77, 0x77, 0x7f, 0x6b, 0x6b, 0x63, 0x63, 0x63, 0x63, 0x63, 0x00, 0x18, 0x18 },	// U+1E42 (Ṃ)
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x33, 0x7f, 0x6b, 0x6b, 0x6b, 0x6b, 0x63, 0x00, 0x18, 0x18 },	// U+1E43 (ṃ)
@@ -978,20 +840,11 @@ static const unsigned char tall_block47[][16] = {
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3e, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x00, 0x7e, 0x00 },	// U+1E49 (ṉ)
 	{ 0x00, 0x00, 0x63, 0x63, 0x67, 0x67, 0x6f, 0x7f, 0x7b, 0x73, 0x73, 0x63, 0x63, 0x00, 0x66, 0x3c },	// U+1E4A (Ṋ)
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3e, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x00, 0x66, 0x3c },	// U+1E4B (ṋ)
-}; // 11
-
-static const unsigned char tall_block48[][16] = {
 	{ 0x18, 0x18, 0x00, 0x3e, 0x66, 0x66, 0x66, 0x3e, 0x36, 0x66, 0x66, 0x66, 0x66, 0x00, 0x00, 0x00 },	// U+1E58 (Ṙ)
 	{ 0x00, 0x00, 0x18, 0x18, 0x00, 0x00, 0x3e, 0x66, 0x66, 0x06, 0x06, 0x06, 0x06, 0x00, 0x00, 0x00 },	// U+1E59 (ṙ)
 	{ 0x00, 0x00, 0x3e, 0x66, 0x66, 0x66, 0x66, 0x3e, 0x36, 0x66, 0x66, 0x66, 0x66, 0x00, 0x18, 0x18 },	// U+1E5A (Ṛ)
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3e, 0x66, 0x66, 0x06, 0x06, 0x06, 0x06, 0x00, 0x18, 0x18 },	// U+1E5B (ṛ)
-}; // 4
-
-static const unsigned char tall_block49[][16] = {
 	{ 0x00, 0x00, 0x3e, 0x66, 0x66, 0x66, 0x66, 0x3e, 0x36, 0x66, 0x66, 0x66, 0x66, 0x00, 0x7e, 0x00 },	// U+1E5E (Ṟ)
-}; // 1
-
-static const unsigned char tall_block50[][16] = {
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+2010 (‐)
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+2011 (‑)
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+2012 (‒)
@@ -1002,159 +855,63 @@ static const unsigned char tall_block50[][16] = {
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x00, 0xff },	// U+2017 (‗)
 	{ 0x0c, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+2018 (‘)
 	{ 0x30, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+2019 (’)
-}; // 10
-
-static const unsigned char tall_block51[][16] = {
 	{ 0x33, 0x66, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+201C (“)
 	{ 0x66, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+201D (”)
-}; // 2
-
-static const unsigned char tall_block52[][16] = {
 	{ 0x00, 0x00, 0x18, 0x18, 0x18, 0x7e, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x00, 0x00, 0x00 },	// U+2020 (†)
 	{ 0x00, 0x00, 0x18, 0x18, 0x18, 0x7e, 0x18, 0x18, 0x18, 0x7e, 0x18, 0x18, 0x18, 0x00, 0x00, 0x00 },	// U+2021 (‡)
 	{ 0x00, 0x00, 0x00, 0x00, 0x18, 0x18, 0x3c, 0x3c, 0x3c, 0x3c, 0x18, 0x18, 0x00, 0x00, 0x00, 0x00 },	// U+2022 (•)
-}; // 3
-
-static const unsigned char tall_block53[][16] = {
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x18, 0x18, 0x00, 0x00, 0x00 },	// U+2024 (․)
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x66, 0x66, 0x66, 0x66, 0x00, 0x00 },	// U+2025 (‥)
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x49, 0x49, 0x00, 0x00, 0x00 },	// U+2026 (…)
-}; // 3
-
-static const unsigned char tall_block54[][16] = {
 	{ 0x00, 0x00, 0x63, 0x63, 0x33, 0x33, 0x18, 0x18, 0x06, 0x06, 0xdb, 0xdb, 0xdb, 0xdb, 0x00, 0x00 },	// U+2030 (‰)
 	{ 0x00, 0x00, 0x63, 0x63, 0x33, 0x33, 0x18, 0x18, 0x06, 0x06, 0xab, 0xab, 0xab, 0xab, 0x00, 0x00 },	// U+2031 (‱)
-}; // 2
-
-static const unsigned char tall_block55[][16] = {
 	{ 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x00, 0x00, 0x66, 0x66, 0x00, 0x00 },	// U+203C (‼)
-}; // 1
-
-static const unsigned char tall_block56[][16] = {
 	{ 0x33, 0x33, 0x66, 0x66, 0x66, 0x66, 0x33, 0x33, 0x33, 0x33, 0x00, 0x00, 0x33, 0x33, 0x00, 0x00 },	// U+2047 (⁇)
 	{ 0x67, 0x67, 0x6c, 0x6c, 0x6c, 0x6c, 0x66, 0x66, 0x63, 0x63, 0x00, 0x00, 0x63, 0x63, 0x00, 0x00 },	// U+2048 (⁈)
 	{ 0x3b, 0x3b, 0x63, 0x63, 0x63, 0x63, 0x33, 0x33, 0x1b, 0x1b, 0x00, 0x00, 0x1b, 0x1b, 0x00, 0x00 },	// U+2049 (⁉)
-}; // 3
-
-static const unsigned char tall_block57[][16] = {
 	{ 0x00, 0x1c, 0x36, 0x36, 0x36, 0x36, 0x36, 0x1c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+2070 (⁰)
-}; // 1
-
-static const unsigned char tall_block58[][16] = {
 	{ 0x00, 0x38, 0x3c, 0x36, 0x7e, 0x30, 0x30, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+2074 (⁴)
 	{ 0x00, 0x3e, 0x06, 0x1e, 0x30, 0x30, 0x36, 0x1c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+2075 (⁵)
 	{ 0x00, 0x1c, 0x06, 0x06, 0x1e, 0x36, 0x36, 0x1c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+2076 (⁶)
 	{ 0x00, 0x3e, 0x30, 0x30, 0x18, 0x0c, 0x0c, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+2077 (⁷)
 	{ 0x00, 0x1c, 0x36, 0x36, 0x1c, 0x36, 0x36, 0x1c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+2078 (⁸)
 	{ 0x00, 0x1c, 0x36, 0x36, 0x3c, 0x30, 0x30, 0x1c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+2079 (⁹)
-}; // 6
-
-static const unsigned char tall_block59[][16] = {
 	{ 0x00, 0x00, 0x00, 0x1e, 0x36, 0x36, 0x36, 0x36, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+207F (ⁿ)
-}; // 1
-
-static const unsigned char tall_block60[][16] = {
 	{ 0x00, 0x3f, 0x66, 0x66, 0x3e, 0x46, 0x66, 0xf6, 0x66, 0x66, 0x66, 0xcf, 0x00, 0x00, 0x00, 0x00 },	// U+20A7 (₧)
-}; // 1
-
-static const unsigned char tall_block61[][16] = {
 	{ 0x00, 0x00, 0x3c, 0x66, 0x66, 0x06, 0x3f, 0x06, 0x1f, 0x06, 0x66, 0x66, 0x3c, 0x00, 0x00, 0x00 },	// U+20AC (€)
-}; // 1
-
-static const unsigned char tall_block62[][16] = {
 	{ 0x7e, 0x7e, 0x81, 0x81, 0x9d, 0x9d, 0xa5, 0xa5, 0x9d, 0x9d, 0x85, 0x85, 0x81, 0x81, 0x7e, 0x7e },	// U+2117 (℗)
-}; // 1
-
-static const unsigned char tall_block63[][16] = {
 	{ 0x00, 0x56, 0x71, 0x71, 0x52, 0x54, 0x54, 0x53, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+2120 (℠)
-}; // 1
-
-static const unsigned char tall_block64[][16] = {
 	{ 0x00, 0x57, 0x72, 0x72, 0x52, 0x52, 0x52, 0x52, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+2122 (™)
-}; // 1
-
-static const unsigned char tall_block65[][16] = {
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x0c, 0xfe, 0xfe, 0x0c, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+2190 (←)
 	{ 0x18, 0x3c, 0x7e, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18 },	// U+2191 (↑)
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x30, 0x7f, 0x7f, 0x30, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+2192 (→)
-}; // 3
-
-static const unsigned char tall_block66[][16] = {
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x24, 0x66, 0xff, 0xff, 0x66, 0x24, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+2194 (↔)
-}; // 1
-
-static const unsigned char tall_block67[][16] = {
 	{ 0x0f, 0x0f, 0x07, 0x07, 0x0f, 0x0f, 0x1d, 0x1d, 0x38, 0x38, 0x70, 0x70, 0x20, 0x20, 0x00, 0x00 },	// U+2196 (↖)
 	{ 0xf0, 0xf0, 0xe0, 0xe0, 0xf0, 0xf0, 0xb8, 0xb8, 0x1c, 0x1c, 0x0e, 0x0e, 0x04, 0x04, 0x00, 0x00 },	// U+2197 (↗)
 	{ 0x00, 0x00, 0x04, 0x04, 0x0e, 0x0e, 0x1c, 0x1c, 0xb8, 0xb8, 0xf0, 0xf0, 0xe0, 0xe0, 0xf0, 0xf0 },	// U+2198 (↘)
 	{ 0x00, 0x00, 0x20, 0x20, 0x70, 0x70, 0x38, 0x38, 0x1d, 0x1d, 0x0f, 0x0f, 0x07, 0x07, 0x0f, 0x0f },	// U+2199 (↙)
-}; // 4
-
-static const unsigned char tall_block68[][16] = {
 	{ 0x18, 0x3c, 0x7e, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x7e, 0x3c, 0x18 },	// U+21A5 (↥)
-}; // 1
-
-static const unsigned char tall_block69[][16] = {
 	{ 0x18, 0x3c, 0x7e, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x7e, 0x3c, 0x18, 0xff },	// U+21A8 (↨)
-}; // 1
-
-static const unsigned char tall_block70[][16] = {
 	{ 0x18, 0x18, 0x1c, 0x1c, 0xf6, 0xf6, 0x83, 0x83, 0x83, 0x83, 0xf6, 0xf6, 0x1c, 0x1c, 0x18, 0x18 },	// U+21E6 (⇦)
 	{ 0x18, 0x18, 0x3c, 0x3c, 0x66, 0x66, 0xc3, 0xc3, 0xe7, 0xe7, 0x24, 0x24, 0x24, 0x24, 0x3c, 0x3c },	// U+21E7 (⇧)
 	{ 0x18, 0x18, 0x38, 0x38, 0x6f, 0x6f, 0xc1, 0xc1, 0xc1, 0xc1, 0x6f, 0x6f, 0x38, 0x38, 0x18, 0x18 },	// U+21E8 (⇨)
 	{ 0x3c, 0x3c, 0x24, 0x24, 0x24, 0x24, 0xe7, 0xe7, 0xc3, 0xc3, 0x66, 0x66, 0x3c, 0x3c, 0x18, 0x18 },	// U+21E9 (⇩)
-}; // 4
-
-static const unsigned char tall_block71[][16] = {
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+2212 (−)
-}; // 1
-
-static const unsigned char tall_block72[][16] = {
 	{ 0x00, 0x00, 0x00, 0x00, 0x3c, 0x3c, 0x66, 0x66, 0x66, 0x66, 0x3c, 0x3c, 0x00, 0x00, 0x00, 0x00 },	// U+2218 (∘)
-}; // 1
-
-static const unsigned char tall_block73[][16] = {
 	{ 0x00, 0xc0, 0xc0, 0x60, 0x60, 0x60, 0x60, 0x60, 0x33, 0x33, 0x36, 0x1c, 0x18, 0x00, 0x00, 0x00 },	// U+221A (√)
-}; // 1
-
-static const unsigned char tall_block74[][16] = {
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x6e, 0xdb, 0xdb, 0xdb, 0x76, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+221E (∞)
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7f, 0x60, 0x60, 0x60, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+221F (∟)
-}; // 2
-
-static const unsigned char tall_block75[][16] = {
 	{ 0x00, 0x00, 0x00, 0x3c, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x00, 0x00, 0x00, 0x00 },	// U+2229 (∩)
-}; // 1
-
-static const unsigned char tall_block76[][16] = {
 	{ 0x00, 0x00, 0x00, 0x00, 0x4e, 0x6b, 0x39, 0x00, 0x4e, 0x6b, 0x39, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+2248 (≈)
-}; // 1
-
-static const unsigned char tall_block77[][16] = {
 	{ 0x00, 0x00, 0x00, 0x00, 0x7e, 0x00, 0x00, 0x7e, 0x00, 0x00, 0x7e, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+2261 (≡)
-}; // 1
-
-static const unsigned char tall_block78[][16] = {
 	{ 0x00, 0x00, 0x00, 0x00, 0x30, 0x18, 0x0c, 0x06, 0x0c, 0x18, 0x30, 0x00, 0x7e, 0x00, 0x00, 0x00 },	// U+2264 (≤)
 	{ 0x00, 0x00, 0x00, 0x00, 0x0c, 0x18, 0x30, 0x60, 0x30, 0x18, 0x0c, 0x00, 0x7e, 0x00, 0x00, 0x00 },	// U+2265 (≥)
-}; // 2
-
-static const unsigned char tall_block79[][16] = {
 	{ 0x00, 0x00, 0x00, 0x00, 0x18, 0x18, 0x18, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+22C5 (⋅)
-}; // 1
-
-static const unsigned char tall_block80[][16] = {
 	{ 0x00, 0x00, 0x70, 0xd8, 0xd8, 0xd8, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18 },	// U+2320 (⌠)
 	{ 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x1b, 0x1b, 0x1b, 0x0e, 0x00, 0x00, 0x00 },	// U+2321 (⌡)
-}; // 2
-
-static const unsigned char tall_block81[][16] = {
 	{ 0x00, 0x00, 0x00, 0x00, 0x44, 0x44, 0x66, 0x66, 0x77, 0x77, 0x66, 0x66, 0x44, 0x44, 0x00, 0x00 },	// U+23EA (⏪)
 	{ 0x08, 0x08, 0x1c, 0x1c, 0x3e, 0x3e, 0x00, 0x00, 0x08, 0x08, 0x1c, 0x1c, 0x3e, 0x3e, 0x00, 0x00 },	// U+23EB (⏫)
 	{ 0x00, 0x00, 0x00, 0x00, 0x11, 0x11, 0x33, 0x33, 0x77, 0x77, 0x33, 0x33, 0x11, 0x11, 0x00, 0x00 },	// U+23EC (⏬)
-}; // 3
-
-static const unsigned char tall_block82[][16] = {
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+2500 (─)
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+2501 (━)
 	{ 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18 },	// U+2502 (│)
@@ -1411,17 +1168,8 @@ static const unsigned char tall_block82[][16] = {
 	{ 0x00, 0x00, 0x00, 0x00, 0x3c, 0x3c, 0x24, 0x24, 0x24, 0x24, 0x3c, 0x3c, 0x00, 0x00, 0x00, 0x00 },	// U+25FD (◽)
 	{ 0x00, 0x00, 0x00, 0x00, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0x00, 0x00, 0x00, 0x00 },	// U+25FE (◾)
 	{ 0x01, 0x01, 0x03, 0x03, 0x07, 0x07, 0x0f, 0x0f, 0x1b, 0x1b, 0x33, 0x33, 0x63, 0x63, 0xff, 0xff },	// U+25FF (◿)
-}; // 256
-
-static const unsigned char tall_block83[][16] = {
 	{ 0x00, 0x00, 0x3e, 0x63, 0x63, 0x36, 0x1c, 0x7f, 0x1c, 0x1c, 0x1c, 0x1c, 0x1c, 0x00, 0x00, 0x00 },	// U+2625 (☥)
-}; // 1
-
-static const unsigned char tall_block84[][16] = {
 	{ 0x00, 0x00, 0x18, 0x18, 0x3c, 0x18, 0x18, 0x7e, 0x18, 0x18, 0x18, 0x18, 0x18, 0x00, 0x00, 0x00 },	// U+2628 (☨)
-}; // 1
-
-static const unsigned char tall_block85[][16] = {
 	{ 0x00, 0x00, 0x00, 0x3c, 0x42, 0xb1, 0x81, 0xcd, 0xff, 0xf3, 0x7e, 0x3c, 0x00, 0x00, 0x00, 0x00 },	// U+262F (☯)
 	{ 0x00, 0x00, 0x00, 0x00, 0x7f, 0x7f, 0x00, 0x00, 0x7f, 0x7f, 0x00, 0x00, 0x7f, 0x7f, 0x00, 0x00 },	// U+2630 (☰)
 	{ 0x00, 0x00, 0x00, 0x00, 0x63, 0x63, 0x00, 0x00, 0x7f, 0x7f, 0x00, 0x00, 0x7f, 0x7f, 0x00, 0x00 },	// U+2631 (☱)
@@ -1431,15 +1179,9 @@ static const unsigned char tall_block85[][16] = {
 	{ 0x00, 0x00, 0x00, 0x00, 0x63, 0x63, 0x00, 0x00, 0x7f, 0x7f, 0x00, 0x00, 0x63, 0x63, 0x00, 0x00 },	// U+2635 (☵)
 	{ 0x00, 0x00, 0x00, 0x00, 0x7f, 0x7f, 0x00, 0x00, 0x63, 0x63, 0x00, 0x00, 0x63, 0x63, 0x00, 0x00 },	// U+2636 (☶)
 	{ 0x00, 0x00, 0x00, 0x00, 0x63, 0x63, 0x00, 0x00, 0x63, 0x63, 0x00, 0x00, 0x63, 0x63, 0x00, 0x00 },	// U+2637 (☷)
-}; // 9
-
-static const unsigned char tall_block86[][16] = {
 	{ 0x00, 0x00, 0x3c, 0x42, 0x81, 0xa5, 0x81, 0x81, 0x99, 0xbd, 0x81, 0x42, 0x3c, 0x00, 0x00, 0x00 },	// U+2639 (☹)
 	{ 0x00, 0x00, 0x3c, 0x42, 0x81, 0xa5, 0x81, 0x81, 0xbd, 0x99, 0x81, 0x42, 0x3c, 0x00, 0x00, 0x00 },	// U+263A (☺)
 	{ 0x00, 0x00, 0x3c, 0x7e, 0xff, 0xdb, 0xff, 0xff, 0xc3, 0xe7, 0xff, 0x7e, 0x3c, 0x00, 0x00, 0x00 },	// U+263B (☻)
-}; // 3
-
-static const unsigned char tall_block87[][16] = {
 	{ 0x00, 0x00, 0x00, 0x08, 0x1c, 0x3e, 0x7f, 0x7f, 0x7f, 0x1c, 0x1c, 0x3e, 0x00, 0x00, 0x00, 0x00 },	// U+2660 (♠)
 	{ 0x00, 0x00, 0x00, 0x36, 0x7f, 0x63, 0x63, 0x63, 0x36, 0x36, 0x1c, 0x08, 0x00, 0x00, 0x00, 0x00 },	// U+2661 (♡)
 	{ 0x00, 0x00, 0x00, 0x08, 0x1c, 0x1c, 0x36, 0x63, 0x36, 0x1c, 0x1c, 0x08, 0x00, 0x00, 0x00, 0x00 },	// U+2662 (♢)
@@ -1448,39 +1190,21 @@ static const unsigned char tall_block87[][16] = {
 	{ 0x00, 0x00, 0x00, 0x36, 0x7f, 0x7f, 0x7f, 0x7f, 0x3e, 0x3e, 0x1c, 0x08, 0x00, 0x00, 0x00, 0x00 },	// U+2665 (♥)
 	{ 0x00, 0x00, 0x00, 0x08, 0x1c, 0x1c, 0x3e, 0x7f, 0x3e, 0x1c, 0x1c, 0x08, 0x00, 0x00, 0x00, 0x00 },	// U+2666 (♦)
 	{ 0x00, 0x00, 0x00, 0x1c, 0x1c, 0x1c, 0x63, 0x63, 0x77, 0x14, 0x14, 0x3e, 0x00, 0x00, 0x00, 0x00 },	// U+2667 (♧)
-}; // 8
-
-static const unsigned char tall_block88[][16] = {
 	{ 0x00, 0x00, 0x00, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x3c, 0x3e, 0x1c, 0x00, 0x00, 0x00, 0x00 },	// U+2669 (♩)
 	{ 0x00, 0x00, 0x00, 0x18, 0x38, 0x78, 0xd8, 0x18, 0x18, 0x1e, 0x1f, 0x0e, 0x00, 0x00, 0x00, 0x00 },	// U+266A (♪)
 	{ 0x00, 0x00, 0x00, 0xfe, 0xc6, 0xc6, 0xc6, 0xc6, 0xc6, 0xe6, 0xe7, 0x67, 0x03, 0x00, 0x00, 0x00 },	// U+266B (♫)
 	{ 0x00, 0x00, 0x00, 0xfe, 0xc6, 0xfe, 0xc6, 0xc6, 0xc6, 0xe6, 0xe7, 0x67, 0x03, 0x00, 0x00, 0x00 },	// U+266C (♬)
-}; // 4
-
-static const unsigned char tall_block89[][16] = {
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7f, 0x7f, 0x00, 0x00 },	// U+268A (⚊)
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x63, 0x63, 0x00, 0x00 },	// U+268B (⚋)
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7f, 0x7f, 0x00, 0x00, 0x7f, 0x7f, 0x00, 0x00 },	// U+268C (⚌)
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x63, 0x63, 0x00, 0x00, 0x7f, 0x7f, 0x00, 0x00 },	// U+268D (⚍)
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7f, 0x7f, 0x00, 0x00, 0x63, 0x63, 0x00, 0x00 },	// U+268E (⚎)
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x63, 0x63, 0x00, 0x00, 0x63, 0x63, 0x00, 0x00 },	// U+268F (⚏)
-}; // 6
-
-static const unsigned char tall_block90[][16] = {
 	{ 0x00, 0x00, 0x00, 0x00, 0x3c, 0x3c, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x3c, 0x3c, 0x00, 0x00 },	// U+26AA (⚪)
 	{ 0x00, 0x00, 0x00, 0x00, 0x3c, 0x3c, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x3c, 0x3c, 0x00, 0x00 },	// U+26AB (⚫)
 	{ 0x00, 0x00, 0x1c, 0x1c, 0x3e, 0x3e, 0x36, 0x36, 0x3e, 0x3e, 0x1c, 0x1c, 0x00, 0x00, 0x00, 0x00 },	// U+26AC (⚬)
-}; // 3
-
-static const unsigned char tall_block91[][16] = {
 	{ 0x0c, 0x0c, 0x1c, 0x1c, 0x39, 0x39, 0xff, 0xff, 0xff, 0xff, 0x39, 0x39, 0x1c, 0x1c, 0x0c, 0x0c },	// U+2708 (✈)
-}; // 1
-
-static const unsigned char tall_block92[][16] = {
 	{ 0x49, 0x49, 0x2a, 0x2a, 0x1c, 0x1c, 0x7f, 0x7f, 0x1c, 0x1c, 0x2a, 0x2a, 0x49, 0x49, 0x00, 0x00 },	// U+2734 (✴)
-}; // 1
-
-static const unsigned char tall_block93[][16] = {
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+2800 (⠀)
 	{ 0x0f, 0x0f, 0x0f, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+2801 (⠁)
 	{ 0x00, 0x00, 0x00, 0x00, 0x0f, 0x0f, 0x0f, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+2802 (⠂)
@@ -1737,33 +1461,12 @@ static const unsigned char tall_block93[][16] = {
 	{ 0xff, 0xff, 0xff, 0xff, 0xf0, 0xf0, 0xf0, 0xf0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },	// U+28FD (⣽)
 	{ 0xf0, 0xf0, 0xf0, 0xf0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },	// U+28FE (⣾)
 	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },	// U+28FF (⣿)
-}; // 256
-
-static const unsigned char tall_block94[][16] = {
 	{ 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x7e, 0x3c, 0x18 },	// U+2913 (⤓)
-}; // 1
-
-static const unsigned char tall_block95[][16] = {
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x18, 0x18, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+2B1D (⬝)
-}; // 1
-
-static const unsigned char tall_block96[][16] = {
 	{ 0x3c, 0x3c, 0x7e, 0x7e, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x7e, 0x7e, 0x3c, 0x3c },	// U+2B24 (⬤)
-}; // 1
-
-static const unsigned char tall_block97[][16] = {
 	{ 0x3c, 0x3c, 0x7e, 0x7e, 0xe7, 0xe7, 0xc3, 0xc3, 0xc3, 0xc3, 0xe7, 0xe7, 0x7e, 0x7e, 0x3c, 0x3c },	// U+2B55 (⭕)
-}; // 1
-
-static const unsigned char tall_block98[][16] = {
 	{ 0x00, 0x00, 0x3c, 0x3c, 0x7e, 0x7e, 0x66, 0x66, 0x66, 0x66, 0x7e, 0x7e, 0x3c, 0x3c, 0x00, 0x00 },	// U+2B58 (⭘)
-}; // 1
-
-static const unsigned char tall_block99[][16] = {
 	{ 0x3c, 0x3c, 0x66, 0x66, 0x66, 0x66, 0x0c, 0x0c, 0x18, 0x18, 0x00, 0x00, 0x18, 0x18, 0x00, 0x00 },	// U+2E2E (⸮)
-}; // 1
-
-static const unsigned char tall_block100[][16] = {
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+E080 ()
 	{ 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+E081 ()
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+E082 ()
@@ -2048,9 +1751,6 @@ static const unsigned char tall_block100[][16] = {
 	{ 0x33, 0x33, 0xcc, 0xcc, 0x33, 0x33, 0xcc, 0xcc, 0x33, 0x33, 0xcc, 0xcc, 0x33, 0x33, 0xcc, 0xcc },	// U+E199 ()
 	{ 0xcc, 0xcc, 0x66, 0x66, 0x33, 0x33, 0x99, 0x99, 0xcc, 0xcc, 0x66, 0x66, 0x33, 0x33, 0x99, 0x99 },	// U+E19A ()
 	{ 0x33, 0x33, 0x66, 0x66, 0xcc, 0xcc, 0x99, 0x99, 0x33, 0x33, 0x66, 0x66, 0xcc, 0xcc, 0x99, 0x99 },	// U+E19B ()
-}; // 284
-
-static const unsigned char tall_block101[][16] = {
 	{ 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0xff, 0xff, 0xff, 0xff, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03 },	// U+E800 ()
 	{ 0xff, 0xff, 0xff, 0xff, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18 },	// U+E801 ()
 	{ 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xff, 0xff, 0xff, 0xff, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0 },	// U+E802 ()
@@ -2132,9 +1832,6 @@ static const unsigned char tall_block101[][16] = {
 	{ 0x6c, 0x0c, 0xc0, 0xc6, 0x36, 0x30, 0x03, 0x63, 0x6c, 0x0c, 0xc0, 0xc6, 0x36, 0x30, 0x03, 0x63 },	// U+E84E ()
 	{ 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x82, 0x82, 0x01, 0x01, 0x10, 0x10, 0x28, 0x28, 0x44, 0x44 },	// U+E84F ()
 	{ 0x44, 0x44, 0x82, 0x82, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x82, 0x82, 0x44, 0x44, 0x39, 0x39 },	// U+E850 ()
-}; // 81
-
-static const unsigned char tall_block102[][16] = {
 	{ 0x60, 0x60, 0x90, 0x90, 0x09, 0x09, 0x06, 0x06, 0x60, 0x60, 0x90, 0x90, 0x09, 0x09, 0x06, 0x06 },	// U+EC00 ()
 	{ 0x72, 0x72, 0x4e, 0x4e, 0xcf, 0xcf, 0xfc, 0xfc, 0xe4, 0xe4, 0x27, 0x27, 0x3f, 0x3f, 0xf3, 0xf3 },	// U+EC01 ()
 	{ 0xa5, 0xa5, 0x42, 0x42, 0xa5, 0xa5, 0x00, 0x00, 0x00, 0x00, 0xa5, 0xa5, 0x42, 0x42, 0xa5, 0xa5 },	// U+EC02 ()
@@ -2174,23 +1871,11 @@ static const unsigned char tall_block102[][16] = {
 	{ 0x3c, 0x3c, 0x42, 0x42, 0xa5, 0xa5, 0x81, 0x81, 0x99, 0x99, 0x81, 0x81, 0xab, 0xab, 0x55, 0x55 },	// U+EC24 ()
 	{ 0x3c, 0x3c, 0x42, 0x42, 0xa5, 0xa5, 0x81, 0x81, 0x99, 0x99, 0x81, 0x81, 0xd5, 0xd5, 0xaa, 0xaa },	// U+EC25 ()
 	{ 0x00, 0x00, 0x3c, 0x7e, 0xff, 0x99, 0xff, 0xff, 0xc3, 0xbd, 0xff, 0x7e, 0x3c, 0x00, 0x00, 0x00 },	// U+EC26 ()
-}; // 39
-
-static const unsigned char tall_block103[][16] = {
 	{ 0x7e, 0x01, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+FE81 (ﺁ)
 	{ 0x3c, 0x02, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0xf8, 0xf0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+FE82 (ﺂ)
-}; // 2
-
-static const unsigned char tall_block104[][16] = {
 	{ 0x0c, 0x02, 0x1c, 0x02, 0x08, 0x08, 0x08, 0x08, 0xf8, 0xf0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+FE84 (ﺄ)
-}; // 1
-
-static const unsigned char tall_block105[][16] = {
 	{ 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x00, 0x30, 0x08, 0x70, 0x08, 0x00 },	// U+FE87 (ﺇ)
 	{ 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0xe0, 0xcc, 0x02, 0x1c, 0x02, 0x00, 0x00, 0x00 },	// U+FE88 (ﺈ)
-}; // 2
-
-static const unsigned char tall_block106[][16] = {
 	{ 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0xf0, 0xe0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+FE8E (ﺎ)
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x81, 0x81, 0x81, 0xff, 0x7e, 0x00, 0x18, 0x00, 0x00, 0x00, 0x00 },	// U+FE8F (ﺏ)
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x81, 0x81, 0x81, 0xff, 0x7e, 0x00, 0x18, 0x00, 0x00, 0x00, 0x00 },	// U+FE90 (ﺐ)
@@ -2206,9 +1891,6 @@ static const unsigned char tall_block106[][16] = {
 	{ 0x00, 0x18, 0x00, 0x66, 0x00, 0x81, 0x81, 0x81, 0xff, 0x7e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+FE9A (ﺚ)
 	{ 0x30, 0x00, 0xcc, 0x00, 0x20, 0x30, 0x30, 0x30, 0x1f, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+FE9B (ﺛ)
 	{ 0x00, 0x18, 0x00, 0x66, 0x00, 0x10, 0x10, 0x10, 0xff, 0xef, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+FE9C (ﺜ)
-}; // 15
-
-static const unsigned char tall_block107[][16] = {
 	{ 0x00, 0x00, 0x00, 0x1e, 0x30, 0x60, 0xfc, 0x7e, 0xc3, 0x99, 0x03, 0x7e, 0x3c, 0x00, 0x00, 0x00 },	// U+FE9E (ﺞ)
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x3c, 0x66, 0xc0, 0xff, 0x7f, 0x00, 0x18, 0x00, 0x00, 0x00, 0x00 },	// U+FE9F (ﺟ)
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x3c, 0x66, 0xc0, 0xff, 0x7f, 0x00, 0x18, 0x00, 0x00, 0x00, 0x00 },	// U+FEA0 (ﺠ)
@@ -2216,9 +1898,6 @@ static const unsigned char tall_block107[][16] = {
 	{ 0x00, 0x00, 0x00, 0x1e, 0x30, 0x60, 0xfc, 0x7e, 0xc3, 0x81, 0x03, 0x7e, 0x3c, 0x00, 0x00, 0x00 },	// U+FEA2 (ﺢ)
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x3c, 0x66, 0xc0, 0xff, 0x7f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+FEA3 (ﺣ)
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x3c, 0x66, 0xc0, 0xff, 0x7f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+FEA4 (ﺤ)
-}; // 7
-
-static const unsigned char tall_block108[][16] = {
 	{ 0x00, 0x00, 0x00, 0x38, 0x78, 0xc0, 0x80, 0xc0, 0x7e, 0x3c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+FEA9 (ﺩ)
 	{ 0x00, 0x00, 0x00, 0x00, 0x0c, 0x1c, 0x30, 0x60, 0xff, 0xdf, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+FEAA (ﺪ)
 	{ 0x00, 0x30, 0x00, 0x38, 0x78, 0xc0, 0x80, 0xc0, 0x7e, 0x3c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+FEAB (ﺫ)
@@ -2234,25 +1913,16 @@ static const unsigned char tall_block108[][16] = {
 	{ 0x30, 0x00, 0xcc, 0x00, 0x88, 0xa8, 0xf9, 0x21, 0x3f, 0x1e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+FEB5 (ﺵ)
 	{ 0x30, 0x00, 0xcc, 0x00, 0x88, 0xa8, 0xf9, 0x21, 0x3f, 0x1e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+FEB6 (ﺶ)
 	{ 0x00, 0x30, 0x00, 0xcc, 0x00, 0x88, 0xa8, 0xa8, 0xff, 0x57, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+FEB7 (ﺷ)
-}; // 15
-
-static const unsigned char tall_block109[][16] = {
 	{ 0x00, 0x00, 0x78, 0x8c, 0xf8, 0x79, 0x11, 0x21, 0x3f, 0x1e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+FEB9 (ﺹ)
 	{ 0x00, 0x00, 0x78, 0x8c, 0xf8, 0x79, 0x11, 0x21, 0x3f, 0x1e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+FEBA (ﺺ)
 	{ 0x00, 0x00, 0x00, 0x00, 0x40, 0xe0, 0x94, 0x8c, 0x7f, 0x3b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+FEBB (ﺻ)
 	{ 0x00, 0x00, 0x00, 0x00, 0x40, 0xe0, 0x94, 0x8c, 0x7f, 0x3b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+FEBC (ﺼ)
-}; // 4
-
-static const unsigned char tall_block110[][16] = {
 	{ 0x04, 0x04, 0x04, 0x04, 0x64, 0xf4, 0x9c, 0x8c, 0xff, 0x7f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+FEC1 (ﻁ)
 	{ 0x04, 0x04, 0x04, 0x04, 0x64, 0xf4, 0x9c, 0x8c, 0xff, 0x7f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+FEC2 (ﻂ)
 	{ 0x04, 0x04, 0x04, 0x04, 0x64, 0xf4, 0x9c, 0x8c, 0xff, 0x7f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+FEC3 (ﻃ)
 	{ 0x04, 0x64, 0x04, 0x04, 0x64, 0xf4, 0x9c, 0x8c, 0xff, 0x7f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+FEC4 (ﻄ)
 	{ 0x04, 0x64, 0x04, 0x04, 0x64, 0xf4, 0x9c, 0x8c, 0xff, 0x7f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+FEC5 (ﻅ)
 	{ 0x04, 0x64, 0x04, 0x04, 0x64, 0xf4, 0x9c, 0x8c, 0xff, 0x7f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+FEC6 (ﻆ)
-}; // 6
-
-static const unsigned char tall_block111[][16] = {
 	{ 0x00, 0x00, 0x00, 0x1c, 0x3e, 0x02, 0x3e, 0x1c, 0x06, 0x82, 0xc6, 0x7e, 0x3c, 0x00, 0x00, 0x00 },	// U+FEC9 (ﻉ)
 	{ 0x00, 0x00, 0x00, 0x1c, 0x3e, 0x22, 0x3e, 0x7c, 0xc6, 0x82, 0x46, 0x7e, 0x3c, 0x00, 0x00, 0x00 },	// U+FECA (ﻊ)
 	{ 0x00, 0x00, 0x00, 0x00, 0x70, 0xf8, 0x08, 0x08, 0xff, 0x77, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+FECB (ﻋ)
@@ -2280,9 +1950,6 @@ static const unsigned char tall_block111[][16] = {
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x1c, 0x3e, 0x62, 0x78, 0x7e, 0x02, 0x02, 0x02, 0x00, 0x00, 0x00 },	// U+FEE1 (ﻡ)
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x1c, 0x3e, 0x32, 0xf8, 0xdc, 0x04, 0x04, 0x04, 0x00, 0x00, 0x00 },	// U+FEE2 (ﻢ)
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x3c, 0x64, 0xff, 0xef, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+FEE3 (ﻣ)
-}; // 27
-
-static const unsigned char tall_block112[][16] = {
 	{ 0x00, 0x00, 0x00, 0x18, 0x00, 0x81, 0x81, 0x81, 0xff, 0x7e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+FEE5 (ﻥ)
 	{ 0x00, 0x00, 0x00, 0x18, 0x00, 0x81, 0x81, 0x81, 0xff, 0x7e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+FEE6 (ﻦ)
 	{ 0x00, 0x00, 0x60, 0x00, 0x40, 0x60, 0x60, 0x60, 0x3f, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+FEE7 (ﻧ)
@@ -2299,9 +1966,6 @@ static const unsigned char tall_block112[][16] = {
 	{ 0x00, 0x00, 0x00, 0x00, 0x30, 0x78, 0xc8, 0x99, 0xb1, 0x3f, 0x1e, 0x00, 0x36, 0x00, 0x00, 0x00 },	// U+FEF2 (ﻲ)
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x80, 0x80, 0xff, 0x7f, 0x00, 0x6c, 0x00, 0x00, 0x00, 0x00 },	// U+FEF3 (ﻳ)
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x10, 0xff, 0xef, 0x00, 0x6c, 0x00, 0x00, 0x00, 0x00 },	// U+FEF4 (ﻴ)
-}; // 16
-
-static const unsigned char tall_block113[][16] = {
 	{ 0x00, 0x00, 0xc0, 0x03, 0xc0, 0x03, 0xc0, 0x03, 0xc0, 0x03, 0xc0, 0x03, 0xc0, 0x03, 0xc0, 0x03 },	// U+FF01 (！)
 	{ 0x00, 0x00, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+FF02 (＂)
 	{ 0x00, 0x00, 0x00, 0x00, 0x78, 0x1e, 0x78, 0x1e, 0x78, 0x1e, 0xfe, 0x7f, 0x78, 0x1e, 0x78, 0x1e },	// U+FF03 (＃)
@@ -2360,13 +2024,7 @@ static const unsigned char tall_block113[][16] = {
 	{ 0x00, 0x00, 0x00, 0x00, 0x0f, 0xf0, 0x1e, 0x78, 0x3c, 0x3c, 0x78, 0x1e, 0xf0, 0x0f, 0xe0, 0x07 },	// U+FF38 (Ｘ)
 	{ 0x00, 0x00, 0x00, 0x00, 0x0f, 0xf0, 0x1e, 0x78, 0x3c, 0x3c, 0x78, 0x1e, 0xf0, 0x0f, 0xe0, 0x07 },	// U+FF39 (Ｙ)
 	{ 0x00, 0x00, 0x00, 0x00, 0xfc, 0x3f, 0x00, 0x3c, 0x00, 0x1e, 0x00, 0x0f, 0x80, 0x07, 0xc0, 0x03 },	// U+FF3A (Ｚ)
-}; // 58
-
-static const unsigned char tall_block114[][16] = {
 	{ 0x0f, 0x00, 0x1e, 0x00, 0x3c, 0x00, 0x78, 0x00, 0xf0, 0x00, 0xe0, 0x01, 0xc0, 0x03, 0x80, 0x07 },	// U+FF3C (＼)
-}; // 1
-
-static const unsigned char tall_block115[][16] = {
 	{ 0x00, 0x00, 0xc0, 0x03, 0xe0, 0x07, 0xf0, 0x0f, 0x78, 0x1e, 0x3c, 0x3c, 0x1e, 0x78, 0x00, 0x00 },	// U+FF3E (＾)
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+FF3F (＿)
 	{ 0x00, 0x00, 0xc0, 0x03, 0x80, 0x07, 0x00, 0x0f, 0x00, 0x3c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+FF40 (｀)
@@ -2396,15 +2054,9 @@ static const unsigned char tall_block115[][16] = {
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1e, 0x78, 0x3c, 0x3c },	// U+FF58 (ｘ)
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3c, 0x3c, 0x3c, 0x3c },	// U+FF59 (ｙ)
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfc, 0x3f, 0x00, 0x3c },	// U+FF5A (ｚ)
-}; // 29
-
-static const unsigned char tall_block116[][16] = {
 	{ 0x00, 0x00, 0x00, 0x7e, 0x80, 0x07, 0x80, 0x07, 0x80, 0x07, 0x80, 0x07, 0xc0, 0x03, 0xfe, 0x01 },	// U+FF5C (｜)
 	{ 0x00, 0x00, 0x7e, 0x00, 0xe0, 0x01, 0xe0, 0x01, 0xe0, 0x01, 0xe0, 0x01, 0xc0, 0x03, 0x80, 0x7f },	// U+FF5D (｝)
 	{ 0x00, 0x00, 0xf8, 0x61, 0xde, 0x7b, 0x06, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+FF5E (～)
-}; // 3
-
-static const unsigned char tall_block117[][16] = {
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1c, 0x1c, 0x36, 0x36, 0x1c, 0x1c, 0x00, 0x00 },	// U+FF61 (｡)
 	{ 0x78, 0x78, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+FF62 (｢)
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x1e, 0x1e, 0x00, 0x00 },	// U+FF63 (｣)
@@ -2468,5 +2120,85 @@ static const unsigned char tall_block117[][16] = {
 	{ 0x00, 0x00, 0x06, 0x06, 0x00, 0x00, 0x60, 0x60, 0x60, 0x60, 0x30, 0x30, 0x1e, 0x1e, 0x00, 0x00 },	// U+FF9D (ﾝ)
 	{ 0x33, 0x33, 0x66, 0x66, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+FF9E (ﾞ)
 	{ 0x1c, 0x1c, 0x36, 0x36, 0x1c, 0x1c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+FF9F (ﾟ)
-}; // 63
+}; // 2115
+
+static const uint8_t tall_page_index[] = {
+	0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0a, 0x00,
+	0x0b, 0x0c, 0x0d, 0x0e, 0x00, 0x0f, 0x10, 0x11, 0x12, 0x13, 0x00, 0x14, 0x00, 0x00, 0x15, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x16, 0x17, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x19, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1a, 0x1b,
+}; // 256
 
+static const uint32_t tall_page_bits[][8] = {
+	{ 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000 },	// Empty
+	{ 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff },	// U+00xx
+	{ 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0x00000000, 0xffffe000, 0xff3101cf },	// U+01xx
+	{ 0x0fffffff, 0x000ffcc0, 0x1b000000, 0x00000408, 0x007ffc00, 0x00000000, 0x10002240, 0x00000000 },	// U+02xx
+	{ 0x00000000, 0x00000000, 0x00008000, 0x00000000, 0xfffe0000, 0xfffe03fb, 0x000003ff, 0x00000000 },	// U+03xx
+	{ 0xffff03e3, 0xffffffff, 0x01e3ffff, 0x00000000, 0x00000000, 0x00000000, 0x00ff0000, 0x000200c0 },	// U+04xx
+	{ 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xffff0000, 0x000007ff },	// U+05xx
+	{ 0x00000000, 0x07bfbf88, 0x000007ff, 0x000e0000, 0x00000000, 0x00000000, 0x00000000, 0x00000000 },	// U+06xx
+	{ 0x00000000, 0x00000000, 0x00000000, 0x0003f40f, 0x00000000, 0x00000000, 0x00000000, 0x0000b000 },	// U+15xx
+	{ 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xfffe0fff, 0xffffffff, 0x01ffffff },	// U+16xx
+	{ 0x0000f4f7, 0x00000000, 0x4f000ffe, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000 },	// U+1Exx
+	{ 0x33ff0000, 0x10030077, 0x00000380, 0x83f10000, 0x00000000, 0x00001080, 0x00000000, 0x00000000 },	// U+20xx
+	{ 0x00800000, 0x00000005, 0x00000000, 0x00000000, 0x03d70000, 0x00000120, 0x00000000, 0x000003c0 },	// U+21xx
+	{ 0xc5040000, 0x00000200, 0x00000100, 0x00000032, 0x00000000, 0x00000000, 0x00000020, 0x00000000 },	// U+22xx
+	{ 0x00000000, 0x00000003, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00001c00 },	// U+23xx
+	{ 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff },	// U+25xx
+	{ 0x00000000, 0x0eff8120, 0x00000000, 0x00001eff, 0x0000fc00, 0x00001c00, 0x00000000, 0x00000000 },	// U+26xx
+	{ 0x00000100, 0x00100000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000 },	// U+27xx
+	{ 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff },	// U+28xx
+	{ 0x00080000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000 },	// U+29xx
+	{ 0x20000000, 0x00000010, 0x01200000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000 },	// U+2Bxx
+	{ 0x00000000, 0x00004000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000 },	// U+2Exx
+	{ 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff },	// U+E0xx
+	{ 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0x0fffffff, 0x00000000, 0x00000000, 0x00000000 },	// U+E1xx
+	{ 0xffffffff, 0xffffffff, 0x0001ffff, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000 },	// U+E8xx
+	{ 0xffffffff, 0x0000007f, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000 },	// U+ECxx
+	{ 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xdfffc196, 0x1efffe1f, 0xfffffe7e, 0x001fffef },	// U+FExx
+	{ 0xfffffffe, 0xd7ffffff, 0x77ffffff, 0xfffffffe, 0xffffffff, 0x00000000, 0x00000000, 0x00000000 },	// U+FFxx
+}; // 28
+
+static const uint16_t tall_page_base[][8] = {
+	{ 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000 },	// Empty
+	{ 0x0000, 0x0020, 0x0040, 0x0060, 0x0080, 0x00a0, 0x00c0, 0x00e0 },	// U+00xx
+	{ 0x0100, 0x0120, 0x0140, 0x0160, 0x0180, 0x01a0, 0x01a0, 0x01b3 },	// U+01xx
+	{ 0x01c5, 0x01e1, 0x01ed, 0x01f1, 0x01f3, 0x0200, 0x0200, 0x0204 },	// U+02xx
+	{ 0x0204, 0x0204, 0x0204, 0x0205, 0x0205, 0x0214, 0x022c, 0x0236 },	// U+03xx
+	{ 0x0236, 0x024d, 0x026d, 0x0283, 0x0283, 0x0283, 0x0283, 0x028b },	// U+04xx
+	{ 0x028e, 0x028e, 0x028e, 0x028e, 0x028e, 0x028e, 0x028e, 0x029e },	// U+05xx
+	{ 0x02a9, 0x02a9, 0x02bc, 0x02c7, 0x02ca, 0x02ca, 0x02ca, 0x02ca },	// U+06xx
+	{ 0x02ca, 0x02ca, 0x02ca, 0x02ca, 0x02d5, 0x02d5, 0x02d5, 0x02d5 },	// U+15xx
+	{ 0x02d8, 0x02d8, 0x02d8, 0x02d8, 0x02d8, 0x02d8, 0x02f3, 0x0313 },	// U+16xx
+	{ 0x032c, 0x0338, 0x0338, 0x0348, 0x0348, 0x0348, 0x0348, 0x0348 },	// U+1Exx
+	{ 0x0348, 0x0354, 0x035d, 0x0360, 0x0368, 0x0368, 0x036a, 0x036a },	// U+20xx
+	{ 0x036a, 0x036b, 0x036d, 0x036d, 0x036d, 0x0375, 0x0377, 0x0377 },	// U+21xx
+	{ 0x037b, 0x0380, 0x0381, 0x0382, 0x0385, 0x0385, 0x0385, 0x0386 },	// U+22xx
+	{ 0x0386, 0x0386, 0x0388, 0x0388, 0x0388, 0x0388, 0x0388, 0x0388 },	// U+23xx
+	{ 0x038b, 0x03ab, 0x03cb, 0x03eb, 0x040b, 0x042b, 0x044b, 0x046b },	// U+25xx
+	{ 0x048b, 0x048b, 0x0499, 0x0499, 0x04a5, 0x04ab, 0x04ae, 0x04ae },	// U+26xx
+	{ 0x04ae, 0x04af, 0x04b0, 0x04b0, 0x04b0, 0x04b0, 0x04b0, 0x04b0 },	// U+27xx
+	{ 0x04b0, 0x04d0, 0x04f0, 0x0510, 0x0530, 0x0550, 0x0570, 0x0590 },	// U+28xx
+	{ 0x05b0, 0x05b1, 0x05b1, 0x05b1, 0x05b1, 0x05b1, 0x05b1, 0x05b1 },	// U+29xx
+	{ 0x05b1, 0x05b2, 0x05b3, 0x05b5, 0x05b5, 0x05b5, 0x05b5, 0x05b5 },	// U+2Bxx
+	{ 0x05b5, 0x05b5, 0x05b6, 0x05b6, 0x05b6, 0x05b6, 0x05b6, 0x05b6 },	// U+2Exx
+	{ 0x05b6, 0x05b6, 0x05b6, 0x05b6, 0x05b6, 0x05d6, 0x05f6, 0x0616 },	// U+E0xx
+	{ 0x0636, 0x0656, 0x0676, 0x0696, 0x06b6, 0x06d2, 0x06d2, 0x06d2 },	// U+E1xx
+	{ 0x06d2, 0x06f2, 0x0712, 0x0723, 0x0723, 0x0723, 0x0723, 0x0723 },	// U+E8xx
+	{ 0x0723, 0x0743, 0x074a, 0x074a, 0x074a, 0x074a, 0x074a, 0x074a },	// U+ECxx
+	{ 0x074a, 0x074a, 0x074a, 0x074a, 0x074a, 0x0760, 0x0778, 0x0795 },	// U+FExx
+	{ 0x07a9, 0x07c8, 0x07e6, 0x0804, 0x0823, 0x0843, 0x0843, 0x0843 },	// U+FFxx
+}; // 28
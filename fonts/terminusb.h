@@ -4,11 +4,8 @@
 * With FBInk's tools/hextoc.py
 */
 
-static const unsigned char terminusb_block1[][16] = {
+static const unsigned char terminusb_glyphs[][16] = {
 	{ 0x00, 0x00, 0x77, 0x63, 0x00, 0x63, 0x63, 0x63, 0x00, 0x63, 0x63, 0x77, 0x00, 0x00, 0x00, 0x00 },	// U+0000 (ESC)
-}; // 1
-
-static const unsigned char terminusb_block2[][16] = {
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+0020 ( )
 	{ 0x00, 0x00, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x00, 0x18, 0x18, 0x00, 0x00, 0x00, 0x00 },	// U+0021 (!)
 	{ 0x00, 0x66, 0x66, 0x66, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+0022 (")
@@ -104,9 +101,6 @@ static const unsigned char terminusb_block2[][16] = {
 	{ 0x00, 0x00, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x00, 0x00, 0x00, 0x00 },	// U+007C (|)
 	{ 0x00, 0x00, 0x0e, 0x18, 0x18, 0x18, 0x30, 0x18, 0x18, 0x18, 0x18, 0x0e, 0x00, 0x00, 0x00, 0x00 },	// U+007D (})
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xce, 0xdb, 0x73, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+007E (~)
-}; // 95
-
-static const unsigned char terminusb_block3[][16] = {
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+00A0 ( )
 	{ 0x00, 0x00, 0x18, 0x18, 0x00, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x00, 0x00, 0x00, 0x00 },	// U+00A1 (¡)
 	{ 0x00, 0x00, 0x00, 0x08, 0x08, 0x3e, 0x6b, 0x0b, 0x0b, 0x0b, 0x6b, 0x3e, 0x08, 0x08, 0x00, 0x00 },	// U+00A2 (¢)
@@ -331,34 +325,16 @@ static const unsigned char terminusb_block3[][16] = {
 	{ 0x36, 0x1c, 0x00, 0x7f, 0x60, 0x30, 0x18, 0x0c, 0x06, 0x03, 0x03, 0x7f, 0x00, 0x00, 0x00, 0x00 },	// U+017D (Ž)
 	{ 0x00, 0x00, 0x36, 0x1c, 0x00, 0x7f, 0x30, 0x18, 0x0c, 0x06, 0x03, 0x7f, 0x00, 0x00, 0x00, 0x00 },	// U+017E (ž)
 	{ 0x00, 0x00, 0x78, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x00, 0x00, 0x00, 0x00 },	// U+017F (ſ)
-}; // 224
-
-static const unsigned char terminusb_block4[][16] = {
 	{ 0x00, 0x00, 0x3e, 0x63, 0x63, 0x60, 0x60, 0x60, 0x60, 0x63, 0x63, 0x3e, 0x00, 0x00, 0x00, 0x00 },	// U+0186 (Ɔ)
-}; // 1
-
-static const unsigned char terminusb_block5[][16] = {
 	{ 0x00, 0x00, 0x7f, 0x60, 0x60, 0x60, 0x7c, 0x60, 0x60, 0x60, 0x60, 0x7f, 0x00, 0x00, 0x00, 0x00 },	// U+018E (Ǝ)
 	{ 0x00, 0x00, 0x3e, 0x63, 0x60, 0x60, 0x7f, 0x63, 0x63, 0x63, 0x63, 0x3e, 0x00, 0x00, 0x00, 0x00 },	// U+018F (Ə)
 	{ 0x00, 0x00, 0x3e, 0x63, 0x63, 0x03, 0x1e, 0x03, 0x03, 0x63, 0x63, 0x3e, 0x00, 0x00, 0x00, 0x00 },	// U+0190 (Ɛ)
-}; // 3
-
-static const unsigned char terminusb_block6[][16] = {
 	{ 0x00, 0x00, 0x70, 0xd8, 0x18, 0x18, 0x7e, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x1b, 0x0e, 0x00 },	// U+0192 (ƒ)
-}; // 1
-
-static const unsigned char terminusb_block7[][16] = {
 	{ 0x00, 0x00, 0x66, 0x66, 0x66, 0x6e, 0x7e, 0x76, 0x66, 0x66, 0x66, 0x66, 0x06, 0x06, 0x03, 0x00 },	// U+019D (Ɲ)
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x3f, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x60, 0x60, 0x60, 0x00 },	// U+019E (ƞ)
-}; // 2
-
-static const unsigned char terminusb_block8[][16] = {
 	{ 0x00, 0x00, 0x7f, 0x60, 0x30, 0x18, 0x7f, 0x0c, 0x06, 0x03, 0x03, 0x7f, 0x00, 0x00, 0x00, 0x00 },	// U+01B5 (Ƶ)
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x7f, 0x30, 0x18, 0x3f, 0x0c, 0x06, 0x7f, 0x00, 0x00, 0x00, 0x00 },	// U+01B6 (ƶ)
 	{ 0x00, 0x00, 0x7f, 0x60, 0x30, 0x18, 0x3c, 0x60, 0x60, 0x63, 0x63, 0x3e, 0x00, 0x00, 0x00, 0x00 },	// U+01B7 (Ʒ)
-}; // 3
-
-static const unsigned char terminusb_block9[][16] = {
 	{ 0x36, 0x1c, 0x00, 0x3e, 0x63, 0x63, 0x63, 0x7f, 0x63, 0x63, 0x63, 0x63, 0x00, 0x00, 0x00, 0x00 },	// U+01CD (Ǎ)
 	{ 0x00, 0x00, 0x36, 0x1c, 0x00, 0x3e, 0x60, 0x7e, 0x63, 0x63, 0x63, 0x7e, 0x00, 0x00, 0x00, 0x00 },	// U+01CE (ǎ)
 	{ 0x36, 0x1c, 0x00, 0x3c, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x3c, 0x00, 0x00, 0x00, 0x00 },	// U+01CF (Ǐ)
@@ -367,9 +343,6 @@ static const unsigned char terminusb_block9[][16] = {
 	{ 0x00, 0x00, 0x36, 0x1c, 0x00, 0x3e, 0x63, 0x63, 0x63, 0x63, 0x63, 0x3e, 0x00, 0x00, 0x00, 0x00 },	// U+01D2 (ǒ)
 	{ 0x36, 0x1c, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x3e, 0x00, 0x00, 0x00, 0x00 },	// U+01D3 (Ǔ)
 	{ 0x00, 0x00, 0x36, 0x1c, 0x00, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x7e, 0x00, 0x00, 0x00, 0x00 },	// U+01D4 (ǔ)
-}; // 8
-
-static const unsigned char terminusb_block10[][16] = {
 	{ 0x3e, 0x00, 0x7e, 0x1b, 0x1b, 0x1b, 0x7f, 0x1b, 0x1b, 0x1b, 0x1b, 0x7b, 0x00, 0x00, 0x00, 0x00 },	// U+01E2 (Ǣ)
 	{ 0x00, 0x00, 0x00, 0x3e, 0x00, 0x36, 0x68, 0x68, 0x7e, 0x0b, 0x0b, 0x36, 0x00, 0x00, 0x00, 0x00 },	// U+01E3 (ǣ)
 	{ 0x00, 0x00, 0x3e, 0x63, 0x63, 0x03, 0x03, 0x7b, 0x63, 0xfb, 0x63, 0x3e, 0x00, 0x00, 0x00, 0x00 },	// U+01E4 (Ǥ)
@@ -385,80 +358,35 @@ static const unsigned char terminusb_block10[][16] = {
 	{ 0x36, 0x1c, 0x00, 0x7f, 0x30, 0x18, 0x3c, 0x60, 0x60, 0x63, 0x63, 0x3e, 0x00, 0x00, 0x00, 0x00 },	// U+01EE (Ǯ)
 	{ 0x00, 0x00, 0x36, 0x1c, 0x00, 0x7f, 0x60, 0x30, 0x18, 0x3c, 0x60, 0x60, 0x63, 0x63, 0x3e, 0x00 },	// U+01EF (ǯ)
 	{ 0x00, 0x00, 0xd8, 0x70, 0x00, 0x70, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x66, 0x66, 0x3c, 0x00 },	// U+01F0 (ǰ)
-}; // 15
-
-static const unsigned char terminusb_block11[][16] = {
 	{ 0x18, 0x0c, 0x00, 0x3e, 0x63, 0x03, 0x03, 0x7b, 0x63, 0x63, 0x63, 0x3e, 0x00, 0x00, 0x00, 0x00 },	// U+01F4 (Ǵ)
 	{ 0x00, 0x00, 0x30, 0x18, 0x00, 0x7e, 0x63, 0x63, 0x63, 0x63, 0x63, 0x7e, 0x60, 0x60, 0x3e, 0x00 },	// U+01F5 (ǵ)
-}; // 2
-
-static const unsigned char terminusb_block12[][16] = {
 	{ 0x30, 0x18, 0x00, 0x7e, 0x1b, 0x1b, 0x1b, 0x7f, 0x1b, 0x1b, 0x1b, 0x7b, 0x00, 0x00, 0x00, 0x00 },	// U+01FC (Ǽ)
 	{ 0x00, 0x00, 0x30, 0x18, 0x00, 0x36, 0x68, 0x68, 0x7e, 0x0b, 0x0b, 0x36, 0x00, 0x00, 0x00, 0x00 },	// U+01FD (ǽ)
 	{ 0x18, 0x0c, 0x00, 0x3e, 0xe3, 0x63, 0x73, 0x7b, 0x6f, 0x67, 0x63, 0x3e, 0x00, 0x00, 0x00, 0x00 },	// U+01FE (Ǿ)
 	{ 0x00, 0x00, 0x18, 0x0c, 0x00, 0xbc, 0xe6, 0x76, 0x7e, 0x6e, 0x67, 0x3d, 0x00, 0x00, 0x00, 0x00 },	// U+01FF (ǿ)
-}; // 4
-
-static const unsigned char terminusb_block13[][16] = {
 	{ 0x00, 0x00, 0x3e, 0x63, 0x03, 0x03, 0x3e, 0x60, 0x60, 0x63, 0x63, 0x3e, 0x00, 0x0c, 0x0c, 0x06 },	// U+0218 (Ș)
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x7e, 0x03, 0x03, 0x3e, 0x60, 0x60, 0x3f, 0x00, 0x0c, 0x0c, 0x06 },	// U+0219 (ș)
 	{ 0x00, 0x00, 0xff, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x00, 0x18, 0x18, 0x0c },	// U+021A (Ț)
 	{ 0x00, 0x00, 0x0c, 0x0c, 0x0c, 0x3f, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x78, 0x00, 0x30, 0x30, 0x18 },	// U+021B (ț)
-}; // 4
-
-static const unsigned char terminusb_block14[][16] = {
 	{ 0x7e, 0x00, 0xc3, 0xc3, 0x66, 0x66, 0x3c, 0x18, 0x18, 0x18, 0x18, 0x18, 0x00, 0x00, 0x00, 0x00 },	// U+0232 (Ȳ)
 	{ 0x00, 0x00, 0x00, 0x3e, 0x00, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x7e, 0x60, 0x60, 0x3e, 0x00 },	// U+0233 (ȳ)
-}; // 2
-
-static const unsigned char terminusb_block15[][16] = {
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x70, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x66, 0x66, 0x3c, 0x00 },	// U+0237 (ȷ)
-}; // 1
-
-static const unsigned char terminusb_block16[][16] = {
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x3e, 0x63, 0x60, 0x60, 0x60, 0x63, 0x3e, 0x00, 0x00, 0x00, 0x00 },	// U+0254 (ɔ)
-}; // 1
-
-static const unsigned char terminusb_block17[][16] = {
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x3e, 0x63, 0x63, 0x7f, 0x60, 0x60, 0x3e, 0x00, 0x00, 0x00, 0x00 },	// U+0258 (ɘ)
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x3e, 0x60, 0x60, 0x7f, 0x63, 0x63, 0x3e, 0x00, 0x00, 0x00, 0x00 },	// U+0259 (ə)
-}; // 2
-
-static const unsigned char terminusb_block18[][16] = {
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x3e, 0x63, 0x03, 0x1e, 0x03, 0x63, 0x3e, 0x00, 0x00, 0x00, 0x00 },	// U+025B (ɛ)
-}; // 1
-
-static const unsigned char terminusb_block19[][16] = {
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x3e, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x06, 0x06, 0x03, 0x00 },	// U+0272 (ɲ)
-}; // 1
-
-static const unsigned char terminusb_block20[][16] = {
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x7f, 0x60, 0x30, 0x18, 0x3c, 0x60, 0x60, 0x63, 0x63, 0x3e, 0x00 },	// U+0292 (ʒ)
-}; // 1
-
-static const unsigned char terminusb_block21[][16] = {
 	{ 0x18, 0x0c, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+02BB (ʻ)
 	{ 0x18, 0x18, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+02BC (ʼ)
 	{ 0x0c, 0x0c, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+02BD (ʽ)
-}; // 3
-
-static const unsigned char terminusb_block22[][16] = {
 	{ 0x1c, 0x36, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+02C6 (ˆ)
 	{ 0x36, 0x1c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+02C7 (ˇ)
-}; // 2
-
-static const unsigned char terminusb_block23[][16] = {
 	{ 0x36, 0x1c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+02D8 (˘)
 	{ 0x18, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+02D9 (˙)
-}; // 2
-
-static const unsigned char terminusb_block24[][16] = {
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x0c, 0x38, 0x00 },	// U+02DB (˛)
 	{ 0x6e, 0x3b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+02DC (˜)
 	{ 0x6c, 0x36, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+02DD (˝)
-}; // 3
-
-static const unsigned char terminusb_block25[][16] = {
 	{ 0x0c, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+0300 (̀)
 	{ 0x18, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+0301 (́)
 	{ 0x1c, 0x36, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+0302 (̂)
@@ -468,19 +396,10 @@ static const unsigned char terminusb_block25[][16] = {
 	{ 0x36, 0x1c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+0306 (̆)
 	{ 0x18, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+0307 (̇)
 	{ 0x36, 0x36, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+0308 (̈)
-}; // 9
-
-static const unsigned char terminusb_block26[][16] = {
 	{ 0x1c, 0x36, 0x1c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+030A (̊)
 	{ 0x6c, 0x36, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+030B (̋)
 	{ 0x36, 0x1c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+030C (̌)
-}; // 3
-
-static const unsigned char terminusb_block27[][16] = {
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x18, 0x00 },	// U+0329 (̩)
-}; // 1
-
-static const unsigned char terminusb_block28[][16] = {
 	{ 0x06, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+0384 (΄)
 	{ 0x18, 0x0c, 0x00, 0x36, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+0385 (΅)
 	{ 0x06, 0x03, 0x3e, 0x63, 0x63, 0x63, 0x63, 0x7f, 0x63, 0x63, 0x63, 0x63, 0x00, 0x00, 0x00, 0x00 },	// U+0386 (Ά)
@@ -488,13 +407,7 @@ static const unsigned char terminusb_block28[][16] = {
 	{ 0x06, 0x03, 0x00, 0x7f, 0x03, 0x03, 0x03, 0x1f, 0x03, 0x03, 0x03, 0x7f, 0x00, 0x00, 0x00, 0x00 },	// U+0388 (Έ)
 	{ 0x06, 0x03, 0x00, 0x63, 0x63, 0x63, 0x63, 0x7f, 0x63, 0x63, 0x63, 0x63, 0x00, 0x00, 0x00, 0x00 },	// U+0389 (Ή)
 	{ 0x06, 0x03, 0x3c, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x3c, 0x00, 0x00, 0x00, 0x00 },	// U+038A (Ί)
-}; // 7
-
-static const unsigned char terminusb_block29[][16] = {
 	{ 0x06, 0x03, 0x3e, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x3e, 0x00, 0x00, 0x00, 0x00 },	// U+038C (Ό)
-}; // 1
-
-static const unsigned char terminusb_block30[][16] = {
 	{ 0x06, 0x03, 0x00, 0xc3, 0xc3, 0x66, 0x66, 0x3c, 0x18, 0x18, 0x18, 0x18, 0x00, 0x00, 0x00, 0x00 },	// U+038E (Ύ)
 	{ 0x06, 0x03, 0x3e, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x36, 0x36, 0x77, 0x00, 0x00, 0x00, 0x00 },	// U+038F (Ώ)
 	{ 0x18, 0x0c, 0x1b, 0x1b, 0x00, 0x0e, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x38, 0x00, 0x00, 0x00, 0x00 },	// U+0390 (ΐ)
@@ -515,9 +428,6 @@ static const unsigned char terminusb_block30[][16] = {
 	{ 0x00, 0x00, 0x3e, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x3e, 0x00, 0x00, 0x00, 0x00 },	// U+039F (Ο)
 	{ 0x00, 0x00, 0x7f, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x00, 0x00, 0x00, 0x00 },	// U+03A0 (Π)
 	{ 0x00, 0x00, 0x3f, 0x63, 0x63, 0x63, 0x63, 0x3f, 0x03, 0x03, 0x03, 0x03, 0x00, 0x00, 0x00, 0x00 },	// U+03A1 (Ρ)
-}; // 20
-
-static const unsigned char terminusb_block31[][16] = {
 	{ 0x00, 0x00, 0x7f, 0x03, 0x06, 0x0c, 0x18, 0x18, 0x0c, 0x06, 0x03, 0x7f, 0x00, 0x00, 0x00, 0x00 },	// U+03A3 (Σ)
 	{ 0x00, 0x00, 0xff, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x00, 0x00, 0x00, 0x00 },	// U+03A4 (Τ)
 	{ 0x00, 0x00, 0xc3, 0xc3, 0x66, 0x66, 0x3c, 0x18, 0x18, 0x18, 0x18, 0x18, 0x00, 0x00, 0x00, 0x00 },	// U+03A5 (Υ)
@@ -562,17 +472,8 @@ static const unsigned char terminusb_block31[][16] = {
 	{ 0x00, 0x00, 0x18, 0x0c, 0x00, 0x3e, 0x63, 0x63, 0x63, 0x63, 0x63, 0x3e, 0x00, 0x00, 0x00, 0x00 },	// U+03CC (ό)
 	{ 0x00, 0x00, 0x18, 0x0c, 0x00, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x3e, 0x00, 0x00, 0x00, 0x00 },	// U+03CD (ύ)
 	{ 0x00, 0x00, 0x18, 0x0c, 0x00, 0x22, 0x63, 0x6b, 0x6b, 0x6b, 0x7f, 0x36, 0x00, 0x00, 0x00, 0x00 },	// U+03CE (ώ)
-}; // 44
-
-static const unsigned char terminusb_block32[][16] = {
 	{ 0x00, 0x00, 0x3c, 0x66, 0x66, 0x66, 0xfc, 0x60, 0x67, 0x66, 0x66, 0x3c, 0x00, 0x00, 0x00, 0x00 },	// U+03D1 (ϑ)
-}; // 1
-
-static const unsigned char terminusb_block33[][16] = {
 	{ 0x00, 0x00, 0x00, 0x00, 0x08, 0x3e, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x3e, 0x08, 0x00, 0x00, 0x00 },	// U+03D5 (ϕ)
-}; // 1
-
-static const unsigned char terminusb_block34[][16] = {
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0xc7, 0x6c, 0x38, 0x18, 0x1c, 0x36, 0xe3, 0x00, 0x00, 0x00, 0x00 },	// U+03F0 (ϰ)
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x3e, 0x63, 0x63, 0x63, 0x63, 0x63, 0x3f, 0x03, 0x03, 0x3e, 0x00 },	// U+03F1 (ϱ)
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x3e, 0x63, 0x03, 0x03, 0x03, 0x63, 0x3e, 0x00, 0x00, 0x00, 0x00 },	// U+03F2 (ϲ)
@@ -580,9 +481,6 @@ static const unsigned char terminusb_block34[][16] = {
 	{ 0x00, 0x00, 0x3e, 0x63, 0x63, 0x63, 0x7f, 0x63, 0x63, 0x63, 0x63, 0x3e, 0x00, 0x00, 0x00, 0x00 },	// U+03F4 (ϴ)
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x7c, 0x06, 0x03, 0x3f, 0x03, 0x06, 0x7c, 0x00, 0x00, 0x00, 0x00 },	// U+03F5 (ϵ)
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x1f, 0x30, 0x60, 0x7e, 0x60, 0x30, 0x1f, 0x00, 0x00, 0x00, 0x00 },	// U+03F6 (϶)
-}; // 7
-
-static const unsigned char terminusb_block35[][16] = {
 	{ 0x0c, 0x18, 0x00, 0x7f, 0x03, 0x03, 0x03, 0x1f, 0x03, 0x03, 0x03, 0x7f, 0x00, 0x00, 0x00, 0x00 },	// U+0400 (Ѐ)
 	{ 0x36, 0x36, 0x00, 0x7f, 0x03, 0x03, 0x03, 0x1f, 0x03, 0x03, 0x03, 0x7f, 0x00, 0x00, 0x00, 0x00 },	// U+0401 (Ё)
 	{ 0x00, 0x00, 0x0f, 0x06, 0x06, 0x3e, 0x66, 0x66, 0x66, 0x66, 0x66, 0x36, 0x00, 0x00, 0x00, 0x00 },	// U+0402 (Ђ)
@@ -679,19 +577,10 @@ static const unsigned char terminusb_block35[][16] = {
 	{ 0x00, 0x00, 0x0c, 0x18, 0x00, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x7e, 0x00, 0x00, 0x00, 0x00 },	// U+045D (ѝ)
 	{ 0x00, 0x00, 0x36, 0x1c, 0x00, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x7e, 0x60, 0x60, 0x3e, 0x00 },	// U+045E (ў)
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x7f, 0x1c, 0x1c, 0x00, 0x00 },	// U+045F (џ)
-}; // 96
-
-static const unsigned char terminusb_block36[][16] = {
 	{ 0x00, 0x00, 0x06, 0x1f, 0x06, 0x3e, 0x66, 0x66, 0x66, 0x66, 0x66, 0x3e, 0x00, 0x00, 0x00, 0x00 },	// U+0462 (Ѣ)
 	{ 0x00, 0x00, 0x06, 0x06, 0x1f, 0x06, 0x06, 0x3e, 0x66, 0x66, 0x66, 0x3e, 0x00, 0x00, 0x00, 0x00 },	// U+0463 (ѣ)
-}; // 2
-
-static const unsigned char terminusb_block37[][16] = {
 	{ 0x00, 0x00, 0x7f, 0x63, 0x36, 0x36, 0x1c, 0x3e, 0x6b, 0x6b, 0x6b, 0x6b, 0x00, 0x00, 0x00, 0x00 },	// U+046A (Ѫ)
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x7f, 0x36, 0x14, 0x1c, 0x3e, 0x6b, 0x6b, 0x00, 0x00, 0x00, 0x00 },	// U+046B (ѫ)
-}; // 2
-
-static const unsigned char terminusb_block38[][16] = {
 	{ 0x60, 0x60, 0x7f, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x00, 0x00, 0x00, 0x00 },	// U+0490 (Ґ)
 	{ 0x00, 0x00, 0x00, 0x60, 0x60, 0x7f, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x00, 0x00, 0x00, 0x00 },	// U+0491 (ґ)
 	{ 0x00, 0x00, 0xfe, 0x06, 0x06, 0x06, 0x3f, 0x06, 0x06, 0x06, 0x06, 0x06, 0x00, 0x00, 0x00, 0x00 },	// U+0492 (Ғ)
@@ -706,47 +595,29 @@ static const unsigned char terminusb_block38[][16] = {
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x63, 0x33, 0x1b, 0x0f, 0x1b, 0x33, 0xe3, 0xc0, 0xc0, 0x00, 0x00 },	// U+049B (қ)
 	{ 0x00, 0x00, 0x63, 0x63, 0x6b, 0x3b, 0x1f, 0x1f, 0x3b, 0x6b, 0x63, 0x63, 0x00, 0x00, 0x00, 0x00 },	// U+049C (Ҝ)
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x63, 0x6b, 0x3b, 0x1f, 0x3b, 0x6b, 0x63, 0x00, 0x00, 0x00, 0x00 },	// U+049D (ҝ)
-}; // 14
-
-static const unsigned char terminusb_block39[][16] = {
 	{ 0x00, 0x00, 0xc7, 0xc7, 0x66, 0x36, 0x1e, 0x1e, 0x36, 0x66, 0xc6, 0xc6, 0x00, 0x00, 0x00, 0x00 },	// U+04A0 (Ҡ)
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0xc7, 0x66, 0x36, 0x1e, 0x36, 0x66, 0xc6, 0x00, 0x00, 0x00, 0x00 },	// U+04A1 (ҡ)
 	{ 0x00, 0x00, 0x63, 0x63, 0x63, 0x63, 0x7f, 0x63, 0x63, 0x63, 0x63, 0xe3, 0xc0, 0xc0, 0x00, 0x00 },	// U+04A2 (Ң)
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x63, 0x63, 0x63, 0x7f, 0x63, 0x63, 0xe3, 0xc0, 0xc0, 0x00, 0x00 },	// U+04A3 (ң)
 	{ 0x00, 0x00, 0xf3, 0x33, 0x33, 0x33, 0x3f, 0x33, 0x33, 0x33, 0x33, 0x33, 0x00, 0x00, 0x00, 0x00 },	// U+04A4 (Ҥ)
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0xf3, 0x33, 0x33, 0x3f, 0x33, 0x33, 0x33, 0x00, 0x00, 0x00, 0x00 },	// U+04A5 (ҥ)
-}; // 6
-
-static const unsigned char terminusb_block40[][16] = {
 	{ 0x00, 0x00, 0x3e, 0x63, 0x63, 0x03, 0x03, 0x03, 0x03, 0x63, 0x63, 0x3e, 0x0c, 0x0c, 0x0c, 0x00 },	// U+04AA (Ҫ)
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x3e, 0x63, 0x03, 0x03, 0x03, 0x63, 0x3e, 0x0c, 0x0c, 0x0c, 0x00 },	// U+04AB (ҫ)
-}; // 2
-
-static const unsigned char terminusb_block41[][16] = {
 	{ 0x00, 0x00, 0xc3, 0xc3, 0x66, 0x66, 0x3c, 0x18, 0x18, 0x18, 0x18, 0x18, 0x00, 0x00, 0x00, 0x00 },	// U+04AE (Ү)
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0xc3, 0xc3, 0x66, 0x66, 0x3c, 0x3c, 0x18, 0x18, 0x18, 0x18, 0x00 },	// U+04AF (ү)
 	{ 0x00, 0x00, 0xc3, 0xc3, 0x66, 0x66, 0x3c, 0x18, 0x7e, 0x18, 0x18, 0x18, 0x00, 0x00, 0x00, 0x00 },	// U+04B0 (Ұ)
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0xc3, 0xc3, 0x66, 0x66, 0x3c, 0x3c, 0x18, 0x7e, 0x18, 0x18, 0x00 },	// U+04B1 (ұ)
 	{ 0x00, 0x00, 0x63, 0x63, 0x36, 0x36, 0x1c, 0x1c, 0x36, 0x36, 0x63, 0xe3, 0xc0, 0xc0, 0x00, 0x00 },	// U+04B2 (Ҳ)
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x63, 0x63, 0x36, 0x1c, 0x36, 0x63, 0xe3, 0xc0, 0xc0, 0x00, 0x00 },	// U+04B3 (ҳ)
-}; // 6
-
-static const unsigned char terminusb_block42[][16] = {
 	{ 0x00, 0x00, 0x63, 0x63, 0x63, 0x63, 0x63, 0x7e, 0x60, 0x60, 0x60, 0xe0, 0xc0, 0xc0, 0x00, 0x00 },	// U+04B6 (Ҷ)
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x63, 0x63, 0x63, 0x7e, 0x60, 0x60, 0xe0, 0xc0, 0xc0, 0x00, 0x00 },	// U+04B7 (ҷ)
 	{ 0x00, 0x00, 0x63, 0x63, 0x63, 0x6b, 0x6b, 0x7e, 0x68, 0x68, 0x60, 0x60, 0x00, 0x00, 0x00, 0x00 },	// U+04B8 (Ҹ)
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x63, 0x6b, 0x6b, 0x7e, 0x68, 0x60, 0x60, 0x00, 0x00, 0x00, 0x00 },	// U+04B9 (ҹ)
 	{ 0x00, 0x00, 0x03, 0x03, 0x03, 0x03, 0x3f, 0x63, 0x63, 0x63, 0x63, 0x63, 0x00, 0x00, 0x00, 0x00 },	// U+04BA (Һ)
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x03, 0x3f, 0x63, 0x63, 0x63, 0x63, 0x00, 0x00, 0x00, 0x00 },	// U+04BB (һ)
-}; // 6
-
-static const unsigned char terminusb_block43[][16] = {
 	{ 0x00, 0x00, 0x3c, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x3c, 0x00, 0x00, 0x00, 0x00 },	// U+04C0 (Ӏ)
 	{ 0x36, 0x1c, 0x00, 0x6b, 0x6b, 0x6b, 0x3e, 0x1c, 0x3e, 0x6b, 0x6b, 0x6b, 0x00, 0x00, 0x00, 0x00 },	// U+04C1 (Ӂ)
 	{ 0x00, 0x00, 0x36, 0x1c, 0x00, 0x6b, 0x6b, 0x3e, 0x1c, 0x3e, 0x6b, 0x6b, 0x00, 0x00, 0x00, 0x00 },	// U+04C2 (ӂ)
-}; // 3
-
-static const unsigned char terminusb_block44[][16] = {
 	{ 0x00, 0x00, 0x0e, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x38, 0x00, 0x00, 0x00, 0x00 },	// U+04CF (ӏ)
 	{ 0x36, 0x1c, 0x00, 0x3e, 0x63, 0x63, 0x63, 0x7f, 0x63, 0x63, 0x63, 0x63, 0x00, 0x00, 0x00, 0x00 },	// U+04D0 (Ӑ)
 	{ 0x00, 0x00, 0x36, 0x1c, 0x00, 0x7e, 0x63, 0x63, 0x63, 0x63, 0x73, 0x6e, 0x00, 0x00, 0x00, 0x00 },	// U+04D1 (ӑ)
@@ -764,9 +635,6 @@ static const unsigned char terminusb_block44[][16] = {
 	{ 0x00, 0x00, 0x36, 0x36, 0x00, 0x6b, 0x6b, 0x3e, 0x1c, 0x3e, 0x6b, 0x6b, 0x00, 0x00, 0x00, 0x00 },	// U+04DD (ӝ)
 	{ 0x36, 0x36, 0x00, 0x3e, 0x63, 0x63, 0x60, 0x3c, 0x60, 0x63, 0x63, 0x3e, 0x00, 0x00, 0x00, 0x00 },	// U+04DE (Ӟ)
 	{ 0x00, 0x00, 0x36, 0x36, 0x00, 0x3e, 0x63, 0x60, 0x3c, 0x60, 0x63, 0x3e, 0x00, 0x00, 0x00, 0x00 },	// U+04DF (ӟ)
-}; // 17
-
-static const unsigned char terminusb_block45[][16] = {
 	{ 0x3e, 0x00, 0x63, 0x63, 0x63, 0x73, 0x7b, 0x6f, 0x67, 0x63, 0x63, 0x63, 0x00, 0x00, 0x00, 0x00 },	// U+04E2 (Ӣ)
 	{ 0x00, 0x00, 0x00, 0x3e, 0x00, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x7e, 0x00, 0x00, 0x00, 0x00 },	// U+04E3 (ӣ)
 	{ 0x36, 0x36, 0x00, 0x63, 0x63, 0x63, 0x73, 0x7b, 0x6f, 0x67, 0x63, 0x63, 0x00, 0x00, 0x00, 0x00 },	// U+04E4 (Ӥ)
@@ -787,14 +655,8 @@ static const unsigned char terminusb_block45[][16] = {
 	{ 0x00, 0x00, 0x6c, 0x36, 0x00, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x7e, 0x60, 0x60, 0x3e, 0x00 },	// U+04F3 (ӳ)
 	{ 0x36, 0x36, 0x00, 0x63, 0x63, 0x63, 0x63, 0x7e, 0x60, 0x60, 0x60, 0x60, 0x00, 0x00, 0x00, 0x00 },	// U+04F4 (Ӵ)
 	{ 0x00, 0x00, 0x36, 0x36, 0x00, 0x63, 0x63, 0x63, 0x7e, 0x60, 0x60, 0x60, 0x00, 0x00, 0x00, 0x00 },	// U+04F5 (ӵ)
-}; // 20
-
-static const unsigned char terminusb_block46[][16] = {
 	{ 0x36, 0x36, 0x00, 0x63, 0x63, 0x63, 0x67, 0x6b, 0x6b, 0x6b, 0x6b, 0x67, 0x00, 0x00, 0x00, 0x00 },	// U+04F8 (Ӹ)
 	{ 0x00, 0x00, 0x36, 0x36, 0x00, 0x63, 0x63, 0x67, 0x6b, 0x6b, 0x6b, 0x67, 0x00, 0x00, 0x00, 0x00 },	// U+04F9 (ӹ)
-}; // 2
-
-static const unsigned char terminusb_block47[][16] = {
 	{ 0x00, 0x00, 0x63, 0x63, 0x66, 0x66, 0x3c, 0x1e, 0x33, 0x33, 0x63, 0x63, 0x00, 0x00, 0x00, 0x00 },	// U+05D0 (א)
 	{ 0x00, 0x00, 0x3f, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0xff, 0x00, 0x00, 0x00, 0x00 },	// U+05D1 (ב)
 	{ 0x00, 0x00, 0x1e, 0x30, 0x30, 0x30, 0x30, 0x30, 0x78, 0x6c, 0xc6, 0xc3, 0x00, 0x00, 0x00, 0x00 },	// U+05D2 (ג)
@@ -822,21 +684,12 @@ static const unsigned char terminusb_block47[][16] = {
 	{ 0x00, 0x00, 0x3f, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x00, 0x00, 0x00, 0x00 },	// U+05E8 (ר)
 	{ 0x00, 0x00, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x67, 0x63, 0x63, 0x33, 0x1f, 0x00, 0x00, 0x00, 0x00 },	// U+05E9 (ש)
 	{ 0x00, 0x00, 0x3f, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x63, 0x00, 0x00, 0x00, 0x00 },	// U+05EA (ת)
-}; // 27
-
-static const unsigned char terminusb_block48[][16] = {
 	{ 0x00, 0x00, 0x1f, 0x33, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x33, 0x1f, 0x00, 0x0c, 0x0c, 0x00 },	// U+1E0C (Ḍ)
 	{ 0x00, 0x00, 0x60, 0x60, 0x60, 0x7e, 0x63, 0x63, 0x63, 0x63, 0x63, 0x7e, 0x00, 0x18, 0x18, 0x00 },	// U+1E0D (ḍ)
-}; // 2
-
-static const unsigned char terminusb_block49[][16] = {
 	{ 0x00, 0x00, 0x63, 0x63, 0x33, 0x1b, 0x0f, 0x0f, 0x1b, 0x33, 0x63, 0x63, 0x00, 0x3e, 0x00, 0x00 },	// U+1E34 (Ḵ)
 	{ 0x00, 0x00, 0x03, 0x03, 0x03, 0x63, 0x33, 0x1b, 0x0f, 0x1b, 0x33, 0x63, 0x00, 0x3e, 0x00, 0x00 },	// U+1E35 (ḵ)
 	{ 0x00, 0x00, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x7f, 0x00, 0x18, 0x18, 0x00 },	// U+1E36 (Ḷ)
 	{ 0x00, 0x00, 0x0e, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x38, 0x00, 0x18, 0x18, 0x00 },	// U+1E37 (ḷ)
-}; // 4
-
-static const unsigned char terminusb_block50[][16] = {
 	{ 0x18, 0x18, 0x41, 0x63, 0x77, 0x7f, 0x6b, 0x63, 0x63, 0x63, 0x63, 0x63, 0x00, 0x00, 0x00, 0x00 },	// U+1E40 (Ṁ)
 	{ 0x00, 0x00, 0x0c, 0x0c, 0x00, 0x3f, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x00, 0x00, 0x00, 0x00 },	// U+1E41 (ṁ)
 	{ 0x00, 0x00, 0x41, 0x63, 0x77, 0x7f, 0x6b, 0x63, 0x63, 0x63, 0x63, 0x63, 0x00, 0x18, 0x18, 0x00 },	// U+1E42 (Ṃ)
@@ -845,41 +698,20 @@ static const unsigned char terminusb_block50[][16] = {
 	{ 0x00, 0x00, 0x0c, 0x0c, 0x00, 0x3f, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x00, 0x00, 0x00, 0x00 },	// U+1E45 (ṅ)
 	{ 0x00, 0x00, 0x63, 0x63, 0x63, 0x67, 0x6f, 0x7b, 0x73, 0x63, 0x63, 0x63, 0x00, 0x18, 0x18, 0x00 },	// U+1E46 (Ṇ)
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x3f, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x00, 0x18, 0x18, 0x00 },	// U+1E47 (ṇ)
-}; // 8
-
-static const unsigned char terminusb_block51[][16] = {
 	{ 0x00, 0x00, 0xff, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x00, 0x18, 0x18, 0x00 },	// U+1E6C (Ṭ)
 	{ 0x00, 0x00, 0x0c, 0x0c, 0x0c, 0x3f, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x78, 0x00, 0x30, 0x30, 0x00 },	// U+1E6D (ṭ)
-}; // 2
-
-static const unsigned char terminusb_block52[][16] = {
 	{ 0x00, 0x00, 0x7f, 0x03, 0x03, 0x03, 0x1f, 0x03, 0x03, 0x03, 0x03, 0x7f, 0x00, 0x18, 0x18, 0x00 },	// U+1EB8 (Ẹ)
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x3e, 0x63, 0x63, 0x7f, 0x03, 0x03, 0x3e, 0x00, 0x18, 0x18, 0x00 },	// U+1EB9 (ẹ)
-}; // 2
-
-static const unsigned char terminusb_block53[][16] = {
 	{ 0x6e, 0x3b, 0x00, 0x7f, 0x03, 0x03, 0x03, 0x1f, 0x03, 0x03, 0x03, 0x7f, 0x00, 0x00, 0x00, 0x00 },	// U+1EBC (Ẽ)
 	{ 0x00, 0x00, 0x6e, 0x3b, 0x00, 0x3e, 0x63, 0x63, 0x7f, 0x03, 0x03, 0x3e, 0x00, 0x00, 0x00, 0x00 },	// U+1EBD (ẽ)
-}; // 2
-
-static const unsigned char terminusb_block54[][16] = {
 	{ 0x00, 0x00, 0x3c, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x3c, 0x00, 0x18, 0x18, 0x00 },	// U+1ECA (Ị)
 	{ 0x00, 0x00, 0x18, 0x18, 0x00, 0x1c, 0x18, 0x18, 0x18, 0x18, 0x18, 0x3c, 0x00, 0x18, 0x18, 0x00 },	// U+1ECB (ị)
 	{ 0x00, 0x00, 0x3e, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x3e, 0x00, 0x18, 0x18, 0x00 },	// U+1ECC (Ọ)
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x3e, 0x63, 0x63, 0x63, 0x63, 0x63, 0x3e, 0x00, 0x18, 0x18, 0x00 },	// U+1ECD (ọ)
-}; // 4
-
-static const unsigned char terminusb_block55[][16] = {
 	{ 0x00, 0x00, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x3e, 0x00, 0x18, 0x18, 0x00 },	// U+1EE4 (Ụ)
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x7e, 0x00, 0x18, 0x18, 0x00 },	// U+1EE5 (ụ)
-}; // 2
-
-static const unsigned char terminusb_block56[][16] = {
 	{ 0x6e, 0x3b, 0x00, 0xc3, 0xc3, 0x66, 0x66, 0x3c, 0x18, 0x18, 0x18, 0x18, 0x00, 0x00, 0x00, 0x00 },	// U+1EF8 (Ỹ)
 	{ 0x00, 0x00, 0x6e, 0x3b, 0x00, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x7e, 0x60, 0x60, 0x3e, 0x00 },	// U+1EF9 (ỹ)
-}; // 2
-
-static const unsigned char terminusb_block57[][16] = {
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+2000 ( )
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+2001 ( )
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+2002 ( )
@@ -915,40 +747,16 @@ static const unsigned char terminusb_block57[][16] = {
 	{ 0x00, 0x00, 0x18, 0x18, 0x7e, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x00, 0x00, 0x00, 0x00 },	// U+2020 (†)
 	{ 0x00, 0x00, 0x18, 0x18, 0x7e, 0x18, 0x18, 0x18, 0x18, 0x7e, 0x18, 0x18, 0x00, 0x00, 0x00, 0x00 },	// U+2021 (‡)
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x3c, 0x3c, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+2022 (•)
-}; // 35
-
-static const unsigned char terminusb_block58[][16] = {
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xdb, 0xdb, 0x00, 0x00, 0x00, 0x00 },	// U+2026 (…)
-}; // 1
-
-static const unsigned char terminusb_block59[][16] = {
 	{ 0x00, 0x00, 0x37, 0x35, 0x1f, 0x18, 0x0c, 0x0c, 0x06, 0xfe, 0xab, 0xfb, 0x00, 0x00, 0x00, 0x00 },	// U+2030 (‰)
-}; // 1
-
-static const unsigned char terminusb_block60[][16] = {
 	{ 0x00, 0x18, 0x18, 0x18, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+2032 (′)
 	{ 0x00, 0x66, 0x66, 0x66, 0x66, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+2033 (″)
-}; // 2
-
-static const unsigned char terminusb_block61[][16] = {
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0x18, 0x0c, 0x06, 0x0c, 0x18, 0x30, 0x00, 0x00, 0x00, 0x00 },	// U+2039 (‹)
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x0c, 0x18, 0x30, 0x18, 0x0c, 0x06, 0x00, 0x00, 0x00, 0x00 },	// U+203A (›)
-}; // 2
-
-static const unsigned char terminusb_block62[][16] = {
 	{ 0x00, 0x00, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x00, 0x66, 0x66, 0x00, 0x00, 0x00, 0x00 },	// U+203C (‼)
-}; // 1
-
-static const unsigned char terminusb_block63[][16] = {
 	{ 0x7f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+203E (‾)
-}; // 1
-
-static const unsigned char terminusb_block64[][16] = {
 	{ 0x00, 0x1c, 0x36, 0x36, 0x36, 0x36, 0x1c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+2070 (⁰)
 	{ 0x18, 0x00, 0x1c, 0x18, 0x18, 0x18, 0x3c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+2071 (ⁱ)
-}; // 2
-
-static const unsigned char terminusb_block65[][16] = {
 	{ 0x00, 0x30, 0x38, 0x2c, 0x7e, 0x30, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+2074 (⁴)
 	{ 0x00, 0x1e, 0x06, 0x1e, 0x30, 0x30, 0x1e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+2075 (⁵)
 	{ 0x00, 0x1c, 0x06, 0x1e, 0x36, 0x36, 0x1c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+2076 (⁶)
@@ -976,9 +784,6 @@ static const unsigned char terminusb_block65[][16] = {
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3e, 0x00, 0x3e, 0x00, 0x00, 0x00, 0x00 },	// U+208C (₌)
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x0c, 0x0c, 0x0c, 0x0c, 0x18, 0x00, 0x00, 0x00 },	// U+208D (₍)
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0c, 0x18, 0x18, 0x18, 0x18, 0x0c, 0x00, 0x00, 0x00 },	// U+208E (₎)
-}; // 27
-
-static const unsigned char terminusb_block66[][16] = {
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3c, 0x36, 0x36, 0x36, 0x2c, 0x00, 0x00, 0x00 },	// U+2090 (ₐ)
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1c, 0x36, 0x3e, 0x06, 0x3c, 0x00, 0x00, 0x00 },	// U+2091 (ₑ)
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1c, 0x36, 0x36, 0x36, 0x1c, 0x00, 0x00, 0x00 },	// U+2092 (ₒ)
@@ -988,114 +793,42 @@ static const unsigned char terminusb_block66[][16] = {
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x06, 0x66, 0x36, 0x1e, 0x36, 0x66, 0x00, 0x00, 0x00 },	// U+2096 (ₖ)
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0e, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x38, 0x00, 0x00, 0x00 },	// U+2097 (ₗ)
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3f, 0x6b, 0x6b, 0x6b, 0x6b, 0x00, 0x00, 0x00 },	// U+2098 (ₘ)
-}; // 9
-
-static const unsigned char terminusb_block67[][16] = {
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1e, 0x36, 0x36, 0x36, 0x1e, 0x06, 0x06, 0x00 },	// U+209A (ₚ)
-}; // 1
-
-static const unsigned char terminusb_block68[][16] = {
 	{ 0x00, 0x00, 0x1f, 0x33, 0x33, 0x33, 0x5f, 0x63, 0xf3, 0x63, 0x63, 0xc3, 0x00, 0x00, 0x00, 0x00 },	// U+20A7 (₧)
-}; // 1
-
-static const unsigned char terminusb_block69[][16] = {
 	{ 0x00, 0x00, 0x4f, 0x51, 0x51, 0x55, 0x55, 0x55, 0x55, 0x45, 0x45, 0x3d, 0x00, 0x00, 0x00, 0x00 },	// U+20AA (₪)
-}; // 1
-
-static const unsigned char terminusb_block70[][16] = {
 	{ 0x00, 0x00, 0x00, 0x78, 0xcc, 0x06, 0x3f, 0x06, 0x3f, 0x06, 0xcc, 0x78, 0x00, 0x00, 0x00, 0x00 },	// U+20AC (€)
-}; // 1
-
-static const unsigned char terminusb_block71[][16] = {
 	{ 0x00, 0x00, 0xff, 0x18, 0x18, 0x78, 0x1e, 0x78, 0x1e, 0x18, 0x18, 0x18, 0x00, 0x00, 0x00, 0x00 },	// U+20AE (₮)
-}; // 1
-
-static const unsigned char terminusb_block72[][16] = {
 	{ 0x00, 0x00, 0x3c, 0x4a, 0x4a, 0x0a, 0x0a, 0x0a, 0x0a, 0x4a, 0x4a, 0x3c, 0x00, 0x00, 0x00, 0x00 },	// U+2102 (ℂ)
-}; // 1
-
-static const unsigned char terminusb_block73[][16] = {
 	{ 0x00, 0x00, 0x03, 0x03, 0x03, 0x3f, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x00, 0x00, 0x00, 0x00 },	// U+210E (ℎ)
 	{ 0x00, 0x00, 0x06, 0x1f, 0x06, 0x3e, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x00, 0x00, 0x00, 0x00 },	// U+210F (ℏ)
-}; // 2
-
-static const unsigned char terminusb_block74[][16] = {
 	{ 0x00, 0x00, 0x42, 0x42, 0x46, 0x4a, 0x56, 0x6a, 0x52, 0x62, 0x42, 0x42, 0x00, 0x00, 0x00, 0x00 },	// U+2115 (ℕ)
 	{ 0x00, 0x00, 0x69, 0x69, 0x69, 0x0b, 0x0f, 0x0f, 0x0d, 0x69, 0x09, 0x69, 0x00, 0x00, 0x00, 0x00 },	// U+2116 (№)
-}; // 2
-
-static const unsigned char terminusb_block75[][16] = {
 	{ 0x00, 0x00, 0x3c, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x5a, 0x3c, 0x60, 0x00, 0x00, 0x00 },	// U+211A (ℚ)
-}; // 1
-
-static const unsigned char terminusb_block76[][16] = {
 	{ 0x00, 0x00, 0x1f, 0x25, 0x25, 0x25, 0x25, 0x1d, 0x15, 0x2d, 0x55, 0x67, 0x00, 0x00, 0x00, 0x00 },	// U+211D (ℝ)
-}; // 1
-
-static const unsigned char terminusb_block77[][16] = {
 	{ 0x00, 0x00, 0xdf, 0xaa, 0xaa, 0x8a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+2122 (™)
-}; // 1
-
-static const unsigned char terminusb_block78[][16] = {
 	{ 0x00, 0x00, 0x7e, 0x40, 0x60, 0x50, 0x28, 0x14, 0x0a, 0x06, 0x02, 0x7e, 0x00, 0x00, 0x00, 0x00 },	// U+2124 (ℤ)
-}; // 1
-
-static const unsigned char terminusb_block79[][16] = {
 	{ 0x00, 0x00, 0x3e, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x36, 0x36, 0x77, 0x00, 0x00, 0x00, 0x00 },	// U+2126 (Ω)
-}; // 1
-
-static const unsigned char terminusb_block80[][16] = {
 	{ 0x00, 0x00, 0x66, 0x66, 0xcc, 0xcc, 0x7c, 0x3e, 0x33, 0x33, 0x63, 0x66, 0x00, 0x00, 0x00, 0x00 },	// U+2135 (ℵ)
-}; // 1
-
-static const unsigned char terminusb_block81[][16] = {
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x06, 0x7f, 0x7f, 0x06, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+2190 (←)
 	{ 0x00, 0x00, 0x18, 0x3c, 0x7e, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x00, 0x00, 0x00, 0x00 },	// U+2191 (↑)
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x30, 0x7f, 0x7f, 0x30, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+2192 (→)
 	{ 0x00, 0x00, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x7e, 0x3c, 0x18, 0x00, 0x00, 0x00, 0x00 },	// U+2193 (↓)
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x24, 0x66, 0xff, 0xff, 0x66, 0x24, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+2194 (↔)
 	{ 0x00, 0x00, 0x18, 0x3c, 0x7e, 0x18, 0x18, 0x18, 0x18, 0x7e, 0x3c, 0x18, 0x00, 0x00, 0x00, 0x00 },	// U+2195 (↕)
-}; // 6
-
-static const unsigned char terminusb_block82[][16] = {
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x44, 0x46, 0x7f, 0x7f, 0x46, 0x44, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+21A4 (↤)
-}; // 1
-
-static const unsigned char terminusb_block83[][16] = {
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x31, 0x7f, 0x7f, 0x31, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+21A6 (↦)
-}; // 1
-
-static const unsigned char terminusb_block84[][16] = {
 	{ 0x00, 0x00, 0x18, 0x3c, 0x7e, 0x18, 0x18, 0x18, 0x7e, 0x3c, 0x18, 0x7e, 0x00, 0x00, 0x00, 0x00 },	// U+21A8 (↨)
-}; // 1
-
-static const unsigned char terminusb_block85[][16] = {
 	{ 0x00, 0x00, 0x60, 0x60, 0x60, 0x60, 0x64, 0x66, 0x7f, 0x7f, 0x06, 0x04, 0x00, 0x00, 0x00, 0x00 },	// U+21B5 (↵)
-}; // 1
-
-static const unsigned char terminusb_block86[][16] = {
 	{ 0x00, 0x00, 0x00, 0x1f, 0x1c, 0x16, 0xd3, 0xc3, 0xc3, 0x66, 0x3c, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+21BB (↻)
-}; // 1
-
-static const unsigned char terminusb_block87[][16] = {
 	{ 0x00, 0x00, 0x00, 0x04, 0x06, 0x7f, 0x7f, 0x00, 0x7f, 0x7f, 0x30, 0x10, 0x00, 0x00, 0x00, 0x00 },	// U+21CB (⇋)
 	{ 0x00, 0x00, 0x00, 0x10, 0x30, 0x7f, 0x7f, 0x00, 0x7f, 0x7f, 0x06, 0x04, 0x00, 0x00, 0x00, 0x00 },	// U+21CC (⇌)
-}; // 2
-
-static const unsigned char terminusb_block88[][16] = {
 	{ 0x00, 0x00, 0x00, 0x00, 0x08, 0x7c, 0x7e, 0x07, 0x7e, 0x7c, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+21D0 (⇐)
 	{ 0x00, 0x00, 0x08, 0x1c, 0x3e, 0x77, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x00, 0x00, 0x00, 0x00 },	// U+21D1 (⇑)
 	{ 0x00, 0x00, 0x00, 0x00, 0x08, 0x1f, 0x3f, 0x70, 0x3f, 0x1f, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+21D2 (⇒)
 	{ 0x00, 0x00, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x77, 0x3e, 0x1c, 0x08, 0x00, 0x00, 0x00, 0x00 },	// U+21D3 (⇓)
 	{ 0x00, 0x00, 0x00, 0x00, 0x24, 0x7e, 0xff, 0xc3, 0xff, 0x7e, 0x24, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+21D4 (⇔)
 	{ 0x00, 0x00, 0x08, 0x1c, 0x3e, 0x77, 0x36, 0x36, 0x77, 0x3e, 0x1c, 0x08, 0x00, 0x00, 0x00, 0x00 },	// U+21D5 (⇕)
-}; // 6
-
-static const unsigned char terminusb_block89[][16] = {
 	{ 0x00, 0x00, 0x63, 0x63, 0x63, 0x7f, 0x36, 0x36, 0x36, 0x1c, 0x1c, 0x1c, 0x00, 0x00, 0x00, 0x00 },	// U+2200 (∀)
-}; // 1
-
-static const unsigned char terminusb_block90[][16] = {
 	{ 0x00, 0x00, 0x00, 0x7f, 0x60, 0x60, 0x60, 0x7f, 0x60, 0x60, 0x60, 0x7f, 0x00, 0x00, 0x00, 0x00 },	// U+2203 (∃)
 	{ 0x00, 0x00, 0x30, 0x7f, 0x78, 0x68, 0x6c, 0x7f, 0x6c, 0x66, 0x66, 0x7f, 0x03, 0x00, 0x00, 0x00 },	// U+2204 (∄)
 	{ 0x00, 0x00, 0x60, 0x30, 0x3e, 0x73, 0x7b, 0x6f, 0x67, 0x3e, 0x06, 0x03, 0x00, 0x00, 0x00, 0x00 },	// U+2205 (∅)
@@ -1107,104 +840,44 @@ static const unsigned char terminusb_block90[][16] = {
 	{ 0x00, 0x00, 0x00, 0x1f, 0x30, 0x60, 0x60, 0x7f, 0x60, 0x60, 0x30, 0x1f, 0x00, 0x00, 0x00, 0x00 },	// U+220B (∋)
 	{ 0x00, 0x00, 0x03, 0x1f, 0x36, 0x66, 0x6c, 0x7f, 0x6c, 0x78, 0x38, 0x3f, 0x30, 0x00, 0x00, 0x00 },	// U+220C (∌)
 	{ 0x00, 0x00, 0x00, 0x00, 0x1f, 0x30, 0x60, 0x7f, 0x60, 0x30, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+220D (∍)
-}; // 11
-
-static const unsigned char terminusb_block91[][16] = {
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+2212 (−)
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x7e, 0x00, 0x18, 0x18, 0x7e, 0x18, 0x18, 0x00, 0x00, 0x00, 0x00 },	// U+2213 (∓)
 	{ 0x00, 0x00, 0x00, 0x00, 0x18, 0x18, 0x00, 0x18, 0x18, 0x7e, 0x18, 0x18, 0x00, 0x00, 0x00, 0x00 },	// U+2214 (∔)
 	{ 0x00, 0x00, 0x00, 0x00, 0x40, 0x60, 0x30, 0x18, 0x0c, 0x06, 0x03, 0x01, 0x00, 0x00, 0x00, 0x00 },	// U+2215 (∕)
 	{ 0x00, 0x00, 0x00, 0x00, 0x01, 0x03, 0x06, 0x0c, 0x18, 0x30, 0x60, 0x40, 0x00, 0x00, 0x00, 0x00 },	// U+2216 (∖)
-}; // 5
-
-static const unsigned char terminusb_block92[][16] = {
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1c, 0x1c, 0x1c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+2219 (∙)
 	{ 0x00, 0x70, 0x30, 0x30, 0x30, 0x30, 0x33, 0x33, 0x33, 0x36, 0x3c, 0x38, 0x00, 0x00, 0x00, 0x00 },	// U+221A (√)
-}; // 2
-
-static const unsigned char terminusb_block93[][16] = {
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x3e, 0x6b, 0x6b, 0x6b, 0x3e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+221E (∞)
 	{ 0x00, 0x00, 0x00, 0x00, 0x03, 0x03, 0x03, 0x03, 0x03, 0x7f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+221F (∟)
-}; // 2
-
-static const unsigned char terminusb_block94[][16] = {
 	{ 0x00, 0x00, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x00, 0x00, 0x00, 0x00 },	// U+2225 (∥)
-}; // 1
-
-static const unsigned char terminusb_block95[][16] = {
 	{ 0x00, 0x00, 0x00, 0x00, 0x18, 0x18, 0x3c, 0x3c, 0x66, 0x66, 0xc3, 0xc3, 0x00, 0x00, 0x00, 0x00 },	// U+2227 (∧)
 	{ 0x00, 0x00, 0x00, 0x00, 0xc3, 0xc3, 0x66, 0x66, 0x3c, 0x3c, 0x18, 0x18, 0x00, 0x00, 0x00, 0x00 },	// U+2228 (∨)
 	{ 0x00, 0x00, 0x00, 0x00, 0x3e, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x00, 0x00, 0x00, 0x00 },	// U+2229 (∩)
 	{ 0x00, 0x00, 0x00, 0x00, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x3e, 0x00, 0x00, 0x00, 0x00 },	// U+222A (∪)
-}; // 4
-
-static const unsigned char terminusb_block96[][16] = {
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x6e, 0x3b, 0x00, 0x6e, 0x3b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+2248 (≈)
-}; // 1
-
-static const unsigned char terminusb_block97[][16] = {
 	{ 0x00, 0x00, 0x00, 0x00, 0x60, 0x7f, 0x18, 0x0c, 0x7f, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+2260 (≠)
 	{ 0x00, 0x00, 0x00, 0x00, 0x7f, 0x00, 0x00, 0x7f, 0x00, 0x00, 0x7f, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+2261 (≡)
-}; // 2
-
-static const unsigned char terminusb_block98[][16] = {
 	{ 0x00, 0x00, 0x00, 0x30, 0x18, 0x0c, 0x06, 0x0c, 0x18, 0x30, 0x00, 0x7e, 0x00, 0x00, 0x00, 0x00 },	// U+2264 (≤)
 	{ 0x00, 0x00, 0x00, 0x0c, 0x18, 0x30, 0x60, 0x30, 0x18, 0x0c, 0x00, 0x7e, 0x00, 0x00, 0x00, 0x00 },	// U+2265 (≥)
-}; // 2
-
-static const unsigned char terminusb_block99[][16] = {
 	{ 0x00, 0x00, 0x00, 0x90, 0xd8, 0x6c, 0x36, 0x1b, 0x36, 0x6c, 0xd8, 0x90, 0x00, 0x00, 0x00, 0x00 },	// U+226A (≪)
 	{ 0x00, 0x00, 0x00, 0x09, 0x1b, 0x36, 0x6c, 0xd8, 0x6c, 0x36, 0x1b, 0x09, 0x00, 0x00, 0x00, 0x00 },	// U+226B (≫)
-}; // 2
-
-static const unsigned char terminusb_block100[][16] = {
 	{ 0x00, 0x00, 0x00, 0x00, 0x7e, 0x03, 0x03, 0x03, 0x03, 0x03, 0x7e, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+2282 (⊂)
 	{ 0x00, 0x00, 0x00, 0x00, 0x3f, 0x60, 0x60, 0x60, 0x60, 0x60, 0x3f, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+2283 (⊃)
-}; // 2
-
-static const unsigned char terminusb_block101[][16] = {
 	{ 0x00, 0x00, 0x00, 0x7e, 0x03, 0x03, 0x03, 0x03, 0x03, 0x7e, 0x00, 0x7f, 0x00, 0x00, 0x00, 0x00 },	// U+2286 (⊆)
 	{ 0x00, 0x00, 0x00, 0x3f, 0x60, 0x60, 0x60, 0x60, 0x60, 0x3f, 0x00, 0x7f, 0x00, 0x00, 0x00, 0x00 },	// U+2287 (⊇)
-}; // 2
-
-static const unsigned char terminusb_block102[][16] = {
 	{ 0x00, 0x00, 0x00, 0x00, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0xff, 0x00, 0x00, 0x00, 0x00 },	// U+22A5 (⊥)
-}; // 1
-
-static const unsigned char terminusb_block103[][16] = {
 	{ 0x00, 0x00, 0x3e, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x00, 0x00, 0x00, 0x00 },	// U+22C2 (⋂)
 	{ 0x00, 0x00, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x3e, 0x00, 0x00, 0x00, 0x00 },	// U+22C3 (⋃)
-}; // 2
-
-static const unsigned char terminusb_block104[][16] = {
 	{ 0x00, 0x00, 0x60, 0x30, 0x3e, 0x73, 0x7b, 0x6f, 0x67, 0x3e, 0x06, 0x03, 0x00, 0x00, 0x00, 0x00 },	// U+2300 (⌀)
-}; // 1
-
-static const unsigned char terminusb_block105[][16] = {
 	{ 0x00, 0x00, 0x00, 0x00, 0x08, 0x1c, 0x36, 0x63, 0x63, 0x63, 0x63, 0x7f, 0x00, 0x00, 0x00, 0x00 },	// U+2302 (⌂)
-}; // 1
-
-static const unsigned char terminusb_block106[][16] = {
 	{ 0x00, 0x00, 0x3c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x00, 0x00, 0x00, 0x00 },	// U+2308 (⌈)
 	{ 0x00, 0x00, 0x3c, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x00, 0x00, 0x00, 0x00 },	// U+2309 (⌉)
 	{ 0x00, 0x00, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x3c, 0x00, 0x00, 0x00, 0x00 },	// U+230A (⌊)
 	{ 0x00, 0x00, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x3c, 0x00, 0x00, 0x00, 0x00 },	// U+230B (⌋)
-}; // 4
-
-static const unsigned char terminusb_block107[][16] = {
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x7f, 0x03, 0x03, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+2310 (⌐)
-}; // 1
-
-static const unsigned char terminusb_block108[][16] = {
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x03, 0x03, 0x7f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+2319 (⌙)
-}; // 1
-
-static const unsigned char terminusb_block109[][16] = {
 	{ 0x00, 0x00, 0x70, 0xd8, 0xd8, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18 },	// U+2320 (⌠)
 	{ 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x1b, 0x1b, 0x0e, 0x00, 0x00, 0x00, 0x00 },	// U+2321 (⌡)
-}; // 2
-
-static const unsigned char terminusb_block110[][16] = {
 	{ 0x60, 0x30, 0x18, 0x18, 0x0c, 0x0c, 0x0c, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06 },	// U+239B (⎛)
 	{ 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06 },	// U+239C (⎜)
 	{ 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x0c, 0x0c, 0x0c, 0x18, 0x18, 0x30, 0x60 },	// U+239D (⎝)
@@ -1220,47 +893,26 @@ static const unsigned char terminusb_block110[][16] = {
 	{ 0xf0, 0x18, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c },	// U+23A7 (⎧)
 	{ 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x07, 0x07, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c },	// U+23A8 (⎨)
 	{ 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x18, 0xf0 },	// U+23A9 (⎩)
-}; // 15
-
-static const unsigned char terminusb_block111[][16] = {
 	{ 0x0f, 0x18, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30 },	// U+23AB (⎫)
 	{ 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0xe0, 0xe0, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30 },	// U+23AC (⎬)
 	{ 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x18, 0x0f },	// U+23AD (⎭)
 	{ 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18 },	// U+23AE (⎮)
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+23AF (⎯)
-}; // 5
-
-static const unsigned char terminusb_block112[][16] = {
 	{ 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+23BA (⎺)
 	{ 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+23BB (⎻)
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00 },	// U+23BC (⎼)
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff },	// U+23BD (⎽)
-}; // 4
-
-static const unsigned char terminusb_block113[][16] = {
 	{ 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18 },	// U+23D0 (⏐)
-}; // 1
-
-static const unsigned char terminusb_block114[][16] = {
 	{ 0x00, 0x33, 0x33, 0x3f, 0x33, 0x33, 0x33, 0x00, 0xfc, 0x30, 0x30, 0x30, 0x30, 0x30, 0x00, 0x00 },	// U+2409 (␉)
 	{ 0x00, 0x03, 0x03, 0x03, 0x03, 0x03, 0x1f, 0x00, 0xfc, 0x0c, 0x3c, 0x0c, 0x0c, 0x0c, 0x00, 0x00 },	// U+240A (␊)
 	{ 0x00, 0x33, 0x33, 0x33, 0x33, 0x1e, 0x0c, 0x00, 0xfc, 0x30, 0x30, 0x30, 0x30, 0x30, 0x00, 0x00 },	// U+240B (␋)
 	{ 0x00, 0x3f, 0x03, 0x0f, 0x03, 0x03, 0x03, 0x00, 0xfc, 0x0c, 0x3c, 0x0c, 0x0c, 0x0c, 0x00, 0x00 },	// U+240C (␌)
 	{ 0x00, 0x1e, 0x33, 0x03, 0x03, 0x33, 0x1e, 0x00, 0x7c, 0xcc, 0xcc, 0x7c, 0x6c, 0xcc, 0x00, 0x00 },	// U+240D (␍)
-}; // 5
-
-static const unsigned char terminusb_block115[][16] = {
 	{ 0x00, 0x33, 0x37, 0x3f, 0x3b, 0x33, 0x33, 0x00, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0xfc, 0x00, 0x00 },	// U+2424 (␤)
-}; // 1
-
-static const unsigned char terminusb_block116[][16] = {
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+2500 (─)
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+2501 (━)
 	{ 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18 },	// U+2502 (│)
 	{ 0x1c, 0x1c, 0x1c, 0x1c, 0x1c, 0x1c, 0x1c, 0x1c, 0x1c, 0x1c, 0x1c, 0x1c, 0x1c, 0x1c, 0x1c, 0x1c },	// U+2503 (┃)
-}; // 4
-
-static const unsigned char terminusb_block117[][16] = {
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x55, 0x55, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+2508 (┈)
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x55, 0x55, 0x55, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+2509 (┉)
 	{ 0x18, 0x18, 0x18, 0x00, 0x18, 0x18, 0x18, 0x00, 0x18, 0x18, 0x18, 0x00, 0x18, 0x18, 0x18, 0x00 },	// U+250A (┊)
@@ -1329,9 +981,6 @@ static const unsigned char terminusb_block117[][16] = {
 	{ 0x1c, 0x1c, 0x1c, 0x1c, 0x1c, 0x1c, 0x1f, 0xff, 0xff, 0x1c, 0x1c, 0x1c, 0x1c, 0x1c, 0x1c, 0x1c },	// U+2549 (╉)
 	{ 0x1c, 0x1c, 0x1c, 0x1c, 0x1c, 0x1c, 0xfc, 0xff, 0xff, 0x1c, 0x1c, 0x1c, 0x1c, 0x1c, 0x1c, 0x1c },	// U+254A (╊)
 	{ 0x1c, 0x1c, 0x1c, 0x1c, 0x1c, 0x1c, 0xff, 0xff, 0xff, 0x1c, 0x1c, 0x1c, 0x1c, 0x1c, 0x1c, 0x1c },	// U+254B (╋)
-}; // 68
-
-static const unsigned char terminusb_block118[][16] = {
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+2550 (═)
 	{ 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36 },	// U+2551 (║)
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0xf8, 0xf8, 0x18, 0xf8, 0xf8, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18 },	// U+2552 (╒)
@@ -1400,9 +1049,6 @@ static const unsigned char terminusb_block118[][16] = {
 	{ 0x11, 0x44, 0x11, 0x44, 0x11, 0x44, 0x11, 0x44, 0x11, 0x44, 0x11, 0x44, 0x11, 0x44, 0x11, 0x44 },	// U+2591 (░)
 	{ 0x55, 0xaa, 0x55, 0xaa, 0x55, 0xaa, 0x55, 0xaa, 0x55, 0xaa, 0x55, 0xaa, 0x55, 0xaa, 0x55, 0xaa },	// U+2592 (▒)
 	{ 0x77, 0xdd, 0x77, 0xdd, 0x77, 0xdd, 0x77, 0xdd, 0x77, 0xdd, 0x77, 0xdd, 0x77, 0xdd, 0x77, 0xdd },	// U+2593 (▓)
-}; // 68
-
-static const unsigned char terminusb_block119[][16] = {
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f },	// U+2596 (▖)
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0 },	// U+2597 (▗)
 	{ 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+2598 (▘)
@@ -1414,108 +1060,39 @@ static const unsigned char terminusb_block119[][16] = {
 	{ 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f },	// U+259E (▞)
 	{ 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },	// U+259F (▟)
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x3e, 0x3e, 0x3e, 0x3e, 0x3e, 0x3e, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+25A0 (■)
-}; // 11
-
-static const unsigned char terminusb_block120[][16] = {
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7f, 0x7f, 0x7f, 0x7f, 0x00, 0x00, 0x00, 0x00 },	// U+25AC (▬)
-}; // 1
-
-static const unsigned char terminusb_block121[][16] = {
 	{ 0x00, 0x00, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x00, 0x00, 0x00, 0x00 },	// U+25AE (▮)
-}; // 1
-
-static const unsigned char terminusb_block122[][16] = {
 	{ 0x00, 0x00, 0x00, 0x00, 0x18, 0x18, 0x3c, 0x3c, 0x7e, 0x7e, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00 },	// U+25B2 (▲)
-}; // 1
-
-static const unsigned char terminusb_block123[][16] = {
 	{ 0x00, 0x00, 0x00, 0x00, 0x03, 0x0f, 0x3f, 0xff, 0xff, 0x3f, 0x0f, 0x03, 0x00, 0x00, 0x00, 0x00 },	// U+25B6 (▶)
-}; // 1
-
-static const unsigned char terminusb_block124[][16] = {
 	{ 0x00, 0x00, 0x00, 0x00, 0x03, 0x0f, 0x3f, 0xff, 0xff, 0x3f, 0x0f, 0x03, 0x00, 0x00, 0x00, 0x00 },	// U+25BA (►)
-}; // 1
-
-static const unsigned char terminusb_block125[][16] = {
 	{ 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x7e, 0x7e, 0x3c, 0x3c, 0x18, 0x18, 0x00, 0x00, 0x00, 0x00 },	// U+25BC (▼)
-}; // 1
-
-static const unsigned char terminusb_block126[][16] = {
 	{ 0x00, 0x00, 0x00, 0x00, 0xc0, 0xf0, 0xfc, 0xff, 0xff, 0xfc, 0xf0, 0xc0, 0x00, 0x00, 0x00, 0x00 },	// U+25C0 (◀)
-}; // 1
-
-static const unsigned char terminusb_block127[][16] = {
 	{ 0x00, 0x00, 0x00, 0x00, 0xc0, 0xf0, 0xfc, 0xff, 0xff, 0xfc, 0xf0, 0xc0, 0x00, 0x00, 0x00, 0x00 },	// U+25C4 (◄)
-}; // 1
-
-static const unsigned char terminusb_block128[][16] = {
 	{ 0x00, 0x00, 0x00, 0x00, 0x18, 0x3c, 0x7e, 0xff, 0x7e, 0x3c, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+25C6 (◆)
-}; // 1
-
-static const unsigned char terminusb_block129[][16] = {
 	{ 0x00, 0x00, 0x00, 0x00, 0x18, 0x3c, 0x66, 0xc3, 0x66, 0x3c, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+25CA (◊)
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x3c, 0x66, 0x42, 0x42, 0x66, 0x3c, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+25CB (○)
-}; // 2
-
-static const unsigned char terminusb_block130[][16] = {
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x3c, 0x7e, 0x7e, 0x7e, 0x7e, 0x3c, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+25CF (●)
-}; // 1
-
-static const unsigned char terminusb_block131[][16] = {
 	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe7, 0xc3, 0xc3, 0xe7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },	// U+25D8 (◘)
 	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xc3, 0x99, 0xbd, 0xbd, 0x99, 0xc3, 0xff, 0xff, 0xff, 0xff, 0xff },	// U+25D9 (◙)
-}; // 2
-
-static const unsigned char terminusb_block132[][16] = {
 	{ 0x00, 0x00, 0x3e, 0x41, 0x55, 0x41, 0x41, 0x5d, 0x49, 0x41, 0x41, 0x3e, 0x00, 0x00, 0x00, 0x00 },	// U+263A (☺)
 	{ 0x00, 0x00, 0x3e, 0x7f, 0x6b, 0x7f, 0x7f, 0x63, 0x77, 0x7f, 0x7f, 0x3e, 0x00, 0x00, 0x00, 0x00 },	// U+263B (☻)
 	{ 0x00, 0x00, 0x00, 0x18, 0xdb, 0x7e, 0x3c, 0xe7, 0x3c, 0x7e, 0xdb, 0x18, 0x00, 0x00, 0x00, 0x00 },	// U+263C (☼)
-}; // 3
-
-static const unsigned char terminusb_block133[][16] = {
 	{ 0x00, 0x00, 0x3c, 0x66, 0x66, 0x66, 0x66, 0x3c, 0x18, 0x7e, 0x18, 0x18, 0x00, 0x00, 0x00, 0x00 },	// U+2640 (♀)
-}; // 1
-
-static const unsigned char terminusb_block134[][16] = {
 	{ 0x00, 0x00, 0x7c, 0x70, 0x58, 0x4c, 0x1e, 0x33, 0x33, 0x33, 0x33, 0x1e, 0x00, 0x00, 0x00, 0x00 },	// U+2642 (♂)
-}; // 1
-
-static const unsigned char terminusb_block135[][16] = {
 	{ 0x00, 0x00, 0x18, 0x18, 0x3c, 0x7e, 0xff, 0xff, 0x7e, 0x18, 0x18, 0x3c, 0x00, 0x00, 0x00, 0x00 },	// U+2660 (♠)
-}; // 1
-
-static const unsigned char terminusb_block136[][16] = {
 	{ 0x00, 0x00, 0x18, 0x3c, 0x3c, 0x18, 0x5a, 0xff, 0xff, 0x5a, 0x18, 0x3c, 0x00, 0x00, 0x00, 0x00 },	// U+2663 (♣)
-}; // 1
-
-static const unsigned char terminusb_block137[][16] = {
 	{ 0x00, 0x00, 0x00, 0x00, 0x36, 0x7f, 0x7f, 0x7f, 0x7f, 0x3e, 0x1c, 0x08, 0x00, 0x00, 0x00, 0x00 },	// U+2665 (♥)
 	{ 0x00, 0x00, 0x00, 0x00, 0x18, 0x3c, 0x7e, 0xff, 0x7e, 0x3c, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+2666 (♦)
-}; // 2
-
-static const unsigned char terminusb_block138[][16] = {
 	{ 0x00, 0x00, 0x7e, 0x66, 0x7e, 0x06, 0x06, 0x06, 0x06, 0x06, 0x07, 0x03, 0x00, 0x00, 0x00, 0x00 },	// U+266A (♪)
 	{ 0x00, 0x00, 0x7e, 0x66, 0x7e, 0x66, 0x66, 0x66, 0x66, 0x66, 0x76, 0x37, 0x03, 0x00, 0x00, 0x00 },	// U+266B (♫)
-}; // 2
-
-static const unsigned char terminusb_block139[][16] = {
 	{ 0x00, 0x00, 0xc0, 0xc0, 0x60, 0x60, 0x33, 0x33, 0x1e, 0x1e, 0x0c, 0x0c, 0x00, 0x00, 0x00, 0x00 },	// U+2713 (✓)
 	{ 0x00, 0x00, 0xe0, 0xe0, 0x70, 0x70, 0x3b, 0x3f, 0x1e, 0x1e, 0x0c, 0x0c, 0x00, 0x00, 0x00, 0x00 },	// U+2714 (✔)
-}; // 2
-
-static const unsigned char terminusb_block140[][16] = {
 	{ 0x00, 0x00, 0x30, 0x33, 0x1e, 0x1c, 0x1c, 0x3c, 0x66, 0x06, 0x03, 0x03, 0x00, 0x00, 0x00, 0x00 },	// U+2717 (✗)
 	{ 0x00, 0x00, 0x70, 0x77, 0x3e, 0x3c, 0x3c, 0x7c, 0xee, 0xce, 0x07, 0x07, 0x00, 0x00, 0x00, 0x00 },	// U+2718 (✘)
-}; // 2
-
-static const unsigned char terminusb_block141[][16] = {
 	{ 0x00, 0x00, 0x30, 0x30, 0x18, 0x18, 0x0c, 0x0c, 0x18, 0x18, 0x30, 0x30, 0x00, 0x00, 0x00, 0x00 },	// U+27E8 (⟨)
 	{ 0x00, 0x00, 0x0c, 0x0c, 0x18, 0x18, 0x30, 0x30, 0x18, 0x18, 0x0c, 0x0c, 0x00, 0x00, 0x00, 0x00 },	// U+27E9 (⟩)
 	{ 0x00, 0x00, 0x6c, 0x6c, 0x36, 0x36, 0x1b, 0x1b, 0x36, 0x36, 0x6c, 0x6c, 0x00, 0x00, 0x00, 0x00 },	// U+27EA (⟪)
 	{ 0x00, 0x00, 0x1b, 0x1b, 0x36, 0x36, 0x6c, 0x6c, 0x36, 0x36, 0x1b, 0x1b, 0x00, 0x00, 0x00, 0x00 },	// U+27EB (⟫)
-}; // 4
-
-static const unsigned char terminusb_block142[][16] = {
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+2800 (⠀)
 	{ 0x00, 0x00, 0x06, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+2801 (⠁)
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+2802 (⠂)
@@ -1772,30 +1349,81 @@ static const unsigned char terminusb_block142[][16] = {
 	{ 0x00, 0x00, 0x36, 0x36, 0x00, 0x30, 0x30, 0x00, 0x36, 0x36, 0x00, 0x36, 0x36, 0x00, 0x00, 0x00 },	// U+28FD (⣽)
 	{ 0x00, 0x00, 0x30, 0x30, 0x00, 0x36, 0x36, 0x00, 0x36, 0x36, 0x00, 0x36, 0x36, 0x00, 0x00, 0x00 },	// U+28FE (⣾)
 	{ 0x00, 0x00, 0x36, 0x36, 0x00, 0x36, 0x36, 0x00, 0x36, 0x36, 0x00, 0x36, 0x36, 0x00, 0x00, 0x00 },	// U+28FF (⣿)
-}; // 256
-
-static const unsigned char terminusb_block143[][16] = {
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x63, 0x63, 0x00, 0x00, 0x00, 0x63, 0x63, 0x00, 0x00, 0x00, 0x00 },	// U+2E2C (⸬)
-}; // 1
-
-static const unsigned char terminusb_block144[][16] = {
 	{ 0x03, 0x03, 0x33, 0x7b, 0xff, 0x33, 0x33, 0x33, 0x19, 0x0c, 0x06, 0x03, 0x03, 0x03, 0x03, 0x03 },	// U+E0A0 ()
 	{ 0x00, 0x03, 0x03, 0x03, 0x03, 0x03, 0x3f, 0x00, 0xcc, 0xdc, 0xfc, 0xec, 0xcc, 0xcc, 0x00, 0x00 },	// U+E0A1 ()
 	{ 0x00, 0x3c, 0x66, 0x66, 0x66, 0x66, 0xff, 0xff, 0xe7, 0xc3, 0xe7, 0xff, 0xff, 0xff, 0x00, 0x00 },	// U+E0A2 ()
-}; // 3
-
-static const unsigned char terminusb_block145[][16] = {
 	{ 0x01, 0x03, 0x07, 0x0f, 0x1f, 0x3f, 0x7f, 0xff, 0xff, 0x7f, 0x3f, 0x1f, 0x0f, 0x07, 0x03, 0x01 },	// U+E0B0 ()
 	{ 0x01, 0x03, 0x06, 0x0c, 0x18, 0x30, 0x60, 0xc0, 0xc0, 0x60, 0x30, 0x18, 0x0c, 0x06, 0x03, 0x01 },	// U+E0B1 ()
 	{ 0x80, 0xc0, 0xe0, 0xf0, 0xf8, 0xfc, 0xfe, 0xff, 0xff, 0xfe, 0xfc, 0xf8, 0xf0, 0xe0, 0xc0, 0x80 },	// U+E0B2 ()
 	{ 0x80, 0xc0, 0x60, 0x30, 0x18, 0x0c, 0x06, 0x03, 0x03, 0x06, 0x0c, 0x18, 0x30, 0x60, 0xc0, 0x80 },	// U+E0B3 ()
-}; // 4
-
-static const unsigned char terminusb_block146[][16] = {
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x70, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x66, 0x66, 0x3c, 0x00 },	// U+F6BE ()
-}; // 1
-
-static const unsigned char terminusb_block147[][16] = {
 	{ 0x00, 0x00, 0x7f, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x7f, 0x00, 0x00, 0x00, 0x00 },	// U+FFFD (�)
-}; // 1
+}; // 1354
+
+static const uint8_t terminusb_page_index[] = {
+	0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x00,
+	0x08, 0x09, 0x0a, 0x0b, 0x0c, 0x0d, 0x0e, 0x0f, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x12, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x14,
+}; // 256
 
+static const uint32_t terminusb_page_bits[][8] = {
+	{ 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000 },	// Empty
+	{ 0x00000001, 0xffffffff, 0xffffffff, 0x7fffffff, 0x00000000, 0xffffffff, 0xffffffff, 0xffffffff },	// U+00xx
+	{ 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0x6005c040, 0x00e00000, 0x001fe000, 0xf031fffc },	// U+01xx
+	{ 0x0f000000, 0x008c0000, 0x0b100000, 0x00040000, 0x00040000, 0x38000000, 0x3b0000c0, 0x00000000 },	// U+02xx
+	{ 0x00001dff, 0x00000200, 0x00000000, 0x00000000, 0xffffd7f0, 0xfffffffb, 0x00227fff, 0x007f0000 },	// U+03xx
+	{ 0xffffffff, 0xffffffff, 0xffffffff, 0x00000c0c, 0x3fff0000, 0x0fcfcc3f, 0xffff8007, 0x033ffffc },	// U+04xx
+	{ 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xffff0000, 0x000007ff },	// U+05xx
+	{ 0x00003000, 0x00f00000, 0x000000ff, 0x00003000, 0x00000000, 0x33000000, 0x00003c00, 0x03000030 },	// U+1Exx
+	{ 0xffffffff, 0x560d0047, 0x00000000, 0xfff30000, 0x05ff7fff, 0x00005480, 0x00000000, 0x00000000 },	// U+20xx
+	{ 0x2460c004, 0x00200054, 0x00000000, 0x00000000, 0x003f0000, 0x08200150, 0x003f1800, 0x00000000 },	// U+21xx
+	{ 0xc67c3ff9, 0x000007a0, 0x00000100, 0x00000c33, 0x000000cc, 0x00000020, 0x0000000c, 0x00000000 },	// U+22xx
+	{ 0x02010f05, 0x00000003, 0x00000000, 0x00000000, 0xf8000000, 0x3c00fbff, 0x00010000, 0x00000000 },	// U+23xx
+	{ 0x00003e00, 0x00000010, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000 },	// U+24xx
+	{ 0xffffff0f, 0xffffffff, 0xffff0fff, 0xffffffff, 0xffcfffff, 0x14445001, 0x03008c51, 0x00000000 },	// U+25xx
+	{ 0x00000000, 0x1c000000, 0x00000005, 0x00000c69, 0x00000000, 0x00000000, 0x00000000, 0x00000000 },	// U+26xx
+	{ 0x01980000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000f00 },	// U+27xx
+	{ 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff },	// U+28xx
+	{ 0x00000000, 0x00001000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000 },	// U+2Exx
+	{ 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x000f0007, 0x00000000, 0x00000000 },	// U+E0xx
+	{ 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x40000000, 0x00000000, 0x00000000 },	// U+F6xx
+	{ 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x20000000 },	// U+FFxx
+}; // 21
+
+static const uint16_t terminusb_page_base[][8] = {
+	{ 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000 },	// Empty
+	{ 0x0000, 0x0001, 0x0021, 0x0041, 0x0060, 0x0060, 0x0080, 0x00a0 },	// U+00xx
+	{ 0x00c0, 0x00e0, 0x0100, 0x0120, 0x0140, 0x0147, 0x014a, 0x0152 },	// U+01xx
+	{ 0x0167, 0x016b, 0x016e, 0x0172, 0x0173, 0x0174, 0x0177, 0x017e },	// U+02xx
+	{ 0x017e, 0x018a, 0x018b, 0x018b, 0x018b, 0x01a5, 0x01c4, 0x01d5 },	// U+03xx
+	{ 0x01dc, 0x01fc, 0x021c, 0x023c, 0x0240, 0x024e, 0x0262, 0x0276 },	// U+04xx
+	{ 0x028c, 0x028c, 0x028c, 0x028c, 0x028c, 0x028c, 0x028c, 0x029c },	// U+05xx
+	{ 0x02a7, 0x02a9, 0x02ad, 0x02b5, 0x02b7, 0x02b7, 0x02bb, 0x02bf },	// U+1Exx
+	{ 0x02c3, 0x02e3, 0x02ee, 0x02ee, 0x02fc, 0x0315, 0x0319, 0x0319 },	// U+20xx
+	{ 0x0319, 0x0320, 0x0324, 0x0324, 0x0324, 0x032a, 0x032f, 0x0337 },	// U+21xx
+	{ 0x0337, 0x034c, 0x0351, 0x0352, 0x0358, 0x035c, 0x035d, 0x035f },	// U+22xx
+	{ 0x035f, 0x0367, 0x0369, 0x0369, 0x0369, 0x036e, 0x0381, 0x0382 },	// U+23xx
+	{ 0x0382, 0x0387, 0x0388, 0x0388, 0x0388, 0x0388, 0x0388, 0x0388 },	// U+24xx
+	{ 0x0388, 0x03a4, 0x03c4, 0x03e0, 0x0400, 0x041e, 0x0425, 0x042d },	// U+25xx
+	{ 0x042d, 0x042d, 0x0430, 0x0432, 0x0438, 0x0438, 0x0438, 0x0438 },	// U+26xx
+	{ 0x0438, 0x043c, 0x043c, 0x043c, 0x043c, 0x043c, 0x043c, 0x043c },	// U+27xx
+	{ 0x0440, 0x0460, 0x0480, 0x04a0, 0x04c0, 0x04e0, 0x0500, 0x0520 },	// U+28xx
+	{ 0x0540, 0x0540, 0x0541, 0x0541, 0x0541, 0x0541, 0x0541, 0x0541 },	// U+2Exx
+	{ 0x0541, 0x0541, 0x0541, 0x0541, 0x0541, 0x0541, 0x0548, 0x0548 },	// U+E0xx
+	{ 0x0548, 0x0548, 0x0548, 0x0548, 0x0548, 0x0548, 0x0549, 0x0549 },	// U+F6xx
+	{ 0x0549, 0x0549, 0x0549, 0x0549, 0x0549, 0x0549, 0x0549, 0x0549 },	// U+FFxx
+}; // 21
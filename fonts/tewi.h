@@ -4,7 +4,7 @@
 * With FBInk's tools/hextoc.py
 */
 
-static const unsigned char tewi_block1[][13] = {
+static const unsigned char tewi_glyphs[][13] = {
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+0020 ( )
 	{ 0x00, 0x00, 0x00, 0x04, 0x04, 0x04, 0x04, 0x04, 0x00, 0x04, 0x00, 0x00, 0x00 },	// U+0021 (!)
 	{ 0x00, 0x00, 0x0a, 0x0a, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+0022 (")
@@ -100,9 +100,6 @@ static const unsigned char tewi_block1[][13] = {
 	{ 0x00, 0x00, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x00 },	// U+007C (|)
 	{ 0x00, 0x00, 0x03, 0x04, 0x04, 0x04, 0x18, 0x04, 0x04, 0x04, 0x03, 0x00, 0x00 },	// U+007D (})
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x16, 0x0d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+007E (~)
-}; // 95
-
-static const unsigned char tewi_block2[][13] = {
 	{ 0x00, 0x00, 0x00, 0x04, 0x00, 0x04, 0x04, 0x04, 0x04, 0x04, 0x00, 0x00, 0x00 },	// U+00A1 (¡)
 	{ 0x00, 0x00, 0x00, 0x00, 0x04, 0x0e, 0x15, 0x05, 0x15, 0x0e, 0x04, 0x00, 0x00 },	// U+00A2 (¢)
 	{ 0x00, 0x00, 0x0c, 0x12, 0x02, 0x07, 0x02, 0x02, 0x12, 0x0d, 0x00, 0x00, 0x00 },	// U+00A3 (£)
@@ -115,9 +112,6 @@ static const unsigned char tewi_block2[][13] = {
 	{ 0x00, 0x00, 0x00, 0x1c, 0x12, 0x1a, 0x14, 0x00, 0x1e, 0x00, 0x00, 0x00, 0x00 },	// U+00AA (ª)
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x12, 0x09, 0x09, 0x12, 0x00, 0x00, 0x00, 0x00 },	// U+00AB («)
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1f, 0x10, 0x10, 0x00, 0x00, 0x00, 0x00 },	// U+00AC (¬)
-}; // 12
-
-static const unsigned char tewi_block3[][13] = {
 	{ 0x00, 0x00, 0x00, 0x0f, 0x10, 0x13, 0x15, 0x13, 0x15, 0x10, 0x0f, 0x00, 0x00 },	// U+00AE (®)
 	{ 0x00, 0x00, 0x1e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+00AF (¯)
 	{ 0x00, 0x0c, 0x12, 0x12, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+00B0 (°)
@@ -646,9 +640,6 @@ static const unsigned char tewi_block3[][13] = {
 	{ 0x00, 0x00, 0x04, 0x02, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+02BB (ʻ)
 	{ 0x00, 0x00, 0x06, 0x04, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+02BC (ʼ)
 	{ 0x00, 0x00, 0x06, 0x02, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+02BD (ʽ)
-}; // 528
-
-static const unsigned char tewi_block4[][13] = {
 	{ 0x00, 0x00, 0x00, 0x00, 0x30, 0x0c, 0x03, 0x0c, 0x30, 0x00, 0x00, 0x00, 0x00 },	// U+02C2 (˂)
 	{ 0x00, 0x00, 0x00, 0x00, 0x03, 0x0c, 0x30, 0x0c, 0x03, 0x00, 0x00, 0x00, 0x00 },	// U+02C3 (˃)
 	{ 0x00, 0x00, 0x00, 0x11, 0x11, 0x0a, 0x0a, 0x04, 0x04, 0x00, 0x00, 0x00, 0x00 },	// U+02C4 (˄)
@@ -659,14 +650,8 @@ static const unsigned char tewi_block4[][13] = {
 	{ 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+02C9 (ˉ)
 	{ 0x00, 0x00, 0x00, 0x08, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+02CA (ˊ)
 	{ 0x00, 0x00, 0x00, 0x04, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+02CB (ˋ)
-}; // 10
-
-static const unsigned char tewi_block5[][13] = {
 	{ 0x00, 0x00, 0x00, 0x00, 0x0e, 0x04, 0x00, 0x00, 0x04, 0x0e, 0x00, 0x00, 0x00 },	// U+02D0 (ː)
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0e, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+02D1 (ˑ)
-}; // 2
-
-static const unsigned char tewi_block6[][13] = {
 	{ 0x00, 0x22, 0x1c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+02D8 (˘)
 	{ 0x00, 0x0c, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+02D9 (˙)
 	{ 0x00, 0x04, 0x0a, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+02DA (˚)
@@ -674,21 +659,9 @@ static const unsigned char tewi_block6[][13] = {
 	{ 0x00, 0x16, 0x0d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+02DC (˜)
 	{ 0x00, 0x22, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+02DD (˝)
 	{ 0x00, 0x00, 0x00, 0x00, 0x06, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+02DE (˞)
-}; // 7
-
-static const unsigned char tewi_block7[][13] = {
 	{ 0x00, 0x00, 0x00, 0x00, 0x11, 0x0a, 0x04, 0x0a, 0x04, 0x00, 0x00, 0x00, 0x00 },	// U+02E0 (ˠ)
-}; // 1
-
-static const unsigned char tewi_block8[][13] = {
 	{ 0x00, 0x00, 0x0c, 0x02, 0x02, 0x04, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+02E4 (ˤ)
-}; // 1
-
-static const unsigned char tewi_block9[][13] = {
 	{ 0x00, 0x00, 0x00, 0x1b, 0x1b, 0x12, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+02EE (ˮ)
-}; // 1
-
-static const unsigned char tewi_block10[][13] = {
 	{ 0x00, 0x02, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+0300 (̀)
 	{ 0x00, 0x04, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+0301 (́)
 	{ 0x00, 0x06, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+0302 (̂)
@@ -704,68 +677,29 @@ static const unsigned char tewi_block10[][13] = {
 	{ 0x00, 0x0a, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+030C (̌)
 	{ 0x00, 0x04, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+030D (̍)
 	{ 0x00, 0x0a, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+030E (̎)
-}; // 15
-
-static const unsigned char tewi_block11[][13] = {
 	{ 0x00, 0x04, 0x11, 0x0e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+0310 (̐)
 	{ 0x00, 0x0e, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+0311 (̑)
 	{ 0x00, 0x04, 0x02, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+0312 (̒)
 	{ 0x00, 0x06, 0x04, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+0313 (̓)
 	{ 0x00, 0x06, 0x02, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+0314 (̔)
 	{ 0x00, 0x06, 0x04, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+0315 (̕)
-}; // 6
-
-static const unsigned char tewi_block12[][13] = {
 	{ 0x00, 0x1e, 0x10, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+031A (̚)
-}; // 1
-
-static const unsigned char tewi_block13[][13] = {
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x02, 0x04 },	// U+031C (̜)
-}; // 1
-
-static const unsigned char tewi_block14[][13] = {
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x0e, 0x04 },	// U+031F (̟)
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0e, 0x00 },	// U+0320 (̠)
-}; // 2
-
-static const unsigned char tewi_block15[][13] = {
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0a, 0x00 },	// U+0324 (̤)
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x0a, 0x04 },	// U+0325 (̥)
-}; // 2
-
-static const unsigned char tewi_block16[][13] = {
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0e, 0x0a, 0x00 },	// U+032A (̪)
-}; // 1
-
-static const unsigned char tewi_block17[][13] = {
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0a, 0x04, 0x00 },	// U+032C (̬)
-}; // 1
-
-static const unsigned char tewi_block18[][13] = {
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x14, 0x0a },	// U+0330 (̰)
-}; // 1
-
-static const unsigned char tewi_block19[][13] = {
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x08, 0x04 },	// U+0339 (̹)
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0a, 0x0e },	// U+033A (̺)
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0e, 0x0a, 0x0e },	// U+033B (̻)
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0a, 0x15 },	// U+033C (̼)
-}; // 4
-
-static const unsigned char tewi_block20[][13] = {
 	{ 0x00, 0x00, 0x00, 0x0c, 0x0c, 0x08, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+0343 (̓)
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0e, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+0344 (̈́)
-}; // 2
-
-static const unsigned char tewi_block21[][13] = {
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x0e, 0x00 },	// U+035C (͜)
-}; // 1
-
-static const unsigned char tewi_block22[][13] = {
 	{ 0x00, 0x0e, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+0361 (͡)
-}; // 1
-
-static const unsigned char tewi_block23[][13] = {
 	{ 0x00, 0x00, 0x00, 0x01, 0x01, 0x01, 0x0f, 0x01, 0x01, 0x01, 0x00, 0x00, 0x00 },	// U+0370 (Ͱ)
 	{ 0x00, 0x00, 0x00, 0x00, 0x01, 0x02, 0x02, 0x1e, 0x02, 0x02, 0x00, 0x00, 0x00 },	// U+0371 (ͱ)
 	{ 0x00, 0x00, 0x00, 0x1f, 0x15, 0x15, 0x04, 0x04, 0x04, 0x04, 0x00, 0x00, 0x00 },	// U+0372 (Ͳ)
@@ -774,18 +708,12 @@ static const unsigned char tewi_block23[][13] = {
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0c, 0x06, 0x03, 0x00, 0x00 },	// U+0375 (͵)
 	{ 0x00, 0x00, 0x00, 0x00, 0x19, 0x19, 0x15, 0x15, 0x13, 0x13, 0x00, 0x00, 0x00 },	// U+0376 (Ͷ)
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x19, 0x15, 0x13, 0x11, 0x20, 0x00, 0x00 },	// U+0377 (ͷ)
-}; // 8
-
-static const unsigned char tewi_block24[][13] = {
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x06, 0x00 },	// U+037A (ͺ)
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x0e, 0x11, 0x10, 0x11, 0x0e, 0x00, 0x00, 0x00 },	// U+037B (ͻ)
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x0e, 0x11, 0x05, 0x11, 0x0e, 0x00, 0x00, 0x00 },	// U+037C (ͼ)
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x0e, 0x11, 0x14, 0x11, 0x0e, 0x00, 0x00, 0x00 },	// U+037D (ͽ)
 	{ 0x00, 0x00, 0x00, 0x00, 0x0c, 0x0c, 0x00, 0x00, 0x0c, 0x0c, 0x08, 0x04, 0x00 },	// U+037E (;)
 	{ 0x00, 0x00, 0x00, 0x10, 0x10, 0x10, 0x10, 0x10, 0x11, 0x0e, 0x00, 0x00, 0x00 },	// U+037F (Ϳ)
-}; // 6
-
-static const unsigned char tewi_block25[][13] = {
 	{ 0x00, 0x00, 0x00, 0x08, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+0384 (΄)
 	{ 0x00, 0x08, 0x04, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+0385 (΅)
 	{ 0x00, 0x00, 0x02, 0x0d, 0x12, 0x12, 0x1e, 0x12, 0x12, 0x12, 0x00, 0x00, 0x00 },	// U+0386 (Ά)
@@ -793,13 +721,7 @@ static const unsigned char tewi_block25[][13] = {
 	{ 0x00, 0x00, 0x02, 0x3d, 0x04, 0x04, 0x1c, 0x04, 0x04, 0x3c, 0x00, 0x00, 0x00 },	// U+0388 (Έ)
 	{ 0x00, 0x00, 0x02, 0x25, 0x24, 0x24, 0x3c, 0x24, 0x24, 0x24, 0x00, 0x00, 0x00 },	// U+0389 (Ή)
 	{ 0x00, 0x00, 0x02, 0x1d, 0x08, 0x08, 0x08, 0x08, 0x08, 0x1c, 0x00, 0x00, 0x00 },	// U+038A (Ί)
-}; // 7
-
-static const unsigned char tewi_block26[][13] = {
 	{ 0x00, 0x00, 0x02, 0x0d, 0x12, 0x12, 0x12, 0x12, 0x12, 0x0c, 0x00, 0x00, 0x00 },	// U+038C (Ό)
-}; // 1
-
-static const unsigned char tewi_block27[][13] = {
 	{ 0x00, 0x00, 0x02, 0x15, 0x14, 0x14, 0x08, 0x08, 0x08, 0x08, 0x00, 0x00, 0x00 },	// U+038E (Ύ)
 	{ 0x00, 0x02, 0x01, 0x0e, 0x11, 0x11, 0x11, 0x11, 0x0a, 0x1b, 0x00, 0x00, 0x00 },	// U+038F (Ώ)
 	{ 0x00, 0x08, 0x04, 0x11, 0x00, 0x04, 0x04, 0x04, 0x14, 0x08, 0x00, 0x00, 0x00 },	// U+0390 (ΐ)
@@ -820,9 +742,6 @@ static const unsigned char tewi_block27[][13] = {
 	{ 0x00, 0x00, 0x00, 0x0e, 0x11, 0x11, 0x11, 0x11, 0x11, 0x0e, 0x00, 0x00, 0x00 },	// U+039F (Ο)
 	{ 0x00, 0x00, 0x00, 0x1f, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x00, 0x00, 0x00 },	// U+03A0 (Π)
 	{ 0x00, 0x00, 0x00, 0x0f, 0x11, 0x11, 0x0f, 0x01, 0x01, 0x01, 0x00, 0x00, 0x00 },	// U+03A1 (Ρ)
-}; // 20
-
-static const unsigned char tewi_block28[][13] = {
 	{ 0x00, 0x00, 0x00, 0x1f, 0x01, 0x02, 0x04, 0x02, 0x01, 0x1f, 0x00, 0x00, 0x00 },	// U+03A3 (Σ)
 	{ 0x00, 0x00, 0x00, 0x1f, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x00, 0x00, 0x00 },	// U+03A4 (Τ)
 	{ 0x00, 0x00, 0x00, 0x11, 0x11, 0x11, 0x0a, 0x04, 0x04, 0x04, 0x00, 0x00, 0x00 },	// U+03A5 (Υ)
@@ -1051,9 +970,6 @@ static const unsigned char tewi_block28[][13] = {
 	{ 0x00, 0x18, 0x24, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+0484 (҄)
 	{ 0x00, 0x0c, 0x04, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+0485 (҅)
 	{ 0x00, 0x0c, 0x08, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+0486 (҆)
-}; // 228
-
-static const unsigned char tewi_block29[][13] = {
 	{ 0x00, 0x0a, 0x04, 0x19, 0x19, 0x15, 0x15, 0x15, 0x13, 0x33, 0x10, 0x08, 0x00 },	// U+048A (Ҋ)
 	{ 0x00, 0x00, 0x00, 0x0a, 0x04, 0x11, 0x19, 0x15, 0x13, 0x31, 0x10, 0x08, 0x00 },	// U+048B (ҋ)
 	{ 0x00, 0x00, 0x02, 0x07, 0x02, 0x1e, 0x22, 0x22, 0x22, 0x1e, 0x00, 0x00, 0x00 },	// U+048C (Ҍ)
@@ -1172,25 +1088,10 @@ static const unsigned char tewi_block29[][13] = {
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x0a, 0x04, 0x0a, 0x11, 0x10, 0x08, 0x00 },	// U+04FD (ӽ)
 	{ 0x00, 0x00, 0x00, 0x11, 0x11, 0x0a, 0x1f, 0x0a, 0x11, 0x11, 0x00, 0x00, 0x00 },	// U+04FE (Ӿ)
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x0a, 0x1f, 0x0a, 0x11, 0x00, 0x00, 0x00 },	// U+04FF (ӿ)
-}; // 118
-
-static const unsigned char tewi_block30[][13] = {
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x1e, 0x1e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+05BE (־)
-}; // 1
-
-static const unsigned char tewi_block31[][13] = {
 	{ 0x00, 0x00, 0x00, 0x00, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x00, 0x00, 0x00 },	// U+05C0 (׀)
-}; // 1
-
-static const unsigned char tewi_block32[][13] = {
 	{ 0x00, 0x00, 0x00, 0x00, 0x0c, 0x0c, 0x00, 0x00, 0x0c, 0x0c, 0x00, 0x00, 0x00 },	// U+05C3 (׃)
-}; // 1
-
-static const unsigned char tewi_block33[][13] = {
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x0c, 0x02, 0x02, 0x02, 0x0e, 0x00, 0x00, 0x00 },	// U+05C6 (׆)
-}; // 1
-
-static const unsigned char tewi_block34[][13] = {
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x19, 0x12, 0x15, 0x09, 0x13, 0x00, 0x00, 0x00 },	// U+05D0 (א)
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x08, 0x08, 0x08, 0x1f, 0x00, 0x00, 0x00 },	// U+05D1 (ב)
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x0c, 0x08, 0x08, 0x08, 0x16, 0x00, 0x00, 0x00 },	// U+05D2 (ג)
@@ -1223,39 +1124,18 @@ static const unsigned char tewi_block34[][13] = {
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x0a, 0x0a, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+05ED (׭)
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+05EE (׮)
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x14, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+05EF (ׯ)
-}; // 32
-
-static const unsigned char tewi_block35[][13] = {
 	{ 0x00, 0x00, 0x00, 0x18, 0x20, 0x1f, 0x22, 0x2a, 0x22, 0x1c, 0x00, 0x00, 0x00 },	// U+0CA0 (ಠ)
-}; // 1
-
-static const unsigned char tewi_block36[][13] = {
 	{ 0x00, 0x00, 0x04, 0x0f, 0x15, 0x15, 0x0f, 0x15, 0x15, 0x0f, 0x04, 0x00, 0x00 },	// U+0E3F (฿)
-}; // 1
-
-static const unsigned char tewi_block37[][13] = {
 	{ 0x00, 0x00, 0x00, 0x15, 0x15, 0x0b, 0x05, 0x03, 0x01, 0x01, 0x00, 0x00, 0x00 },	// U+16A0 (ᚠ)
-}; // 1
-
-static const unsigned char tewi_block38[][13] = {
 	{ 0x00, 0x00, 0x00, 0x03, 0x05, 0x09, 0x11, 0x11, 0x11, 0x11, 0x00, 0x00, 0x00 },	// U+16A2 (ᚢ)
 	{ 0x00, 0x00, 0x00, 0x03, 0x05, 0x09, 0x11, 0x15, 0x15, 0x15, 0x00, 0x00, 0x00 },	// U+16A3 (ᚣ)
-}; // 2
-
-static const unsigned char tewi_block39[][13] = {
 	{ 0x00, 0x00, 0x00, 0x03, 0x05, 0x09, 0x13, 0x15, 0x15, 0x15, 0x00, 0x00, 0x00 },	// U+16A5 (ᚥ)
 	{ 0x00, 0x00, 0x00, 0x04, 0x04, 0x0c, 0x14, 0x0c, 0x04, 0x04, 0x00, 0x00, 0x00 },	// U+16A6 (ᚦ)
-}; // 2
-
-static const unsigned char tewi_block40[][13] = {
 	{ 0x00, 0x00, 0x00, 0x06, 0x0a, 0x06, 0x0a, 0x02, 0x02, 0x02, 0x00, 0x00, 0x00 },	// U+16A8 (ᚨ)
 	{ 0x00, 0x00, 0x00, 0x11, 0x0b, 0x15, 0x0b, 0x05, 0x01, 0x01, 0x00, 0x00, 0x00 },	// U+16A9 (ᚩ)
 	{ 0x00, 0x00, 0x00, 0x11, 0x0b, 0x05, 0x03, 0x05, 0x01, 0x01, 0x00, 0x00, 0x00 },	// U+16AA (ᚪ)
 	{ 0x00, 0x00, 0x00, 0x03, 0x05, 0x0b, 0x05, 0x09, 0x01, 0x01, 0x00, 0x00, 0x00 },	// U+16AB (ᚫ)
 	{ 0x00, 0x00, 0x00, 0x05, 0x06, 0x05, 0x0e, 0x14, 0x0c, 0x14, 0x00, 0x00, 0x00 },	// U+16AC (ᚬ)
-}; // 5
-
-static const unsigned char tewi_block41[][13] = {
 	{ 0x00, 0x00, 0x00, 0x0e, 0x11, 0x11, 0x1f, 0x11, 0x11, 0x11, 0x04, 0x0a, 0x04 },	// U+1E00 (Ḁ)
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x1e, 0x11, 0x11, 0x19, 0x16, 0x04, 0x0a, 0x04 },	// U+1E01 (ḁ)
 	{ 0x00, 0x04, 0x00, 0x0f, 0x11, 0x11, 0x0f, 0x11, 0x11, 0x0f, 0x00, 0x00, 0x00 },	// U+1E02 (Ḃ)
@@ -1426,9 +1306,6 @@ static const unsigned char tewi_block41[][13] = {
 	{ 0x00, 0x00, 0x0d, 0x16, 0x00, 0x1e, 0x11, 0x11, 0x19, 0x16, 0x00, 0x00, 0x00 },	// U+1EA7 (ầ)
 	{ 0x00, 0x12, 0x25, 0x1e, 0x11, 0x11, 0x1f, 0x11, 0x11, 0x11, 0x00, 0x00, 0x00 },	// U+1EA8 (Ẩ)
 	{ 0x00, 0x00, 0x12, 0x25, 0x10, 0x1e, 0x11, 0x11, 0x19, 0x16, 0x00, 0x00, 0x00 },	// U+1EA9 (ẩ)
-}; // 170
-
-static const unsigned char tewi_block42[][13] = {
 	{ 0x00, 0x16, 0x0d, 0x04, 0x0a, 0x1e, 0x11, 0x11, 0x19, 0x16, 0x00, 0x00, 0x00 },	// U+1EAB (ẫ)
 	{ 0x00, 0x04, 0x0a, 0x0e, 0x11, 0x11, 0x1f, 0x11, 0x11, 0x11, 0x00, 0x04, 0x00 },	// U+1EAC (Ậ)
 	{ 0x00, 0x00, 0x04, 0x0a, 0x00, 0x1e, 0x11, 0x11, 0x19, 0x16, 0x00, 0x04, 0x00 },	// U+1EAD (ậ)
@@ -1438,9 +1315,6 @@ static const unsigned char tewi_block42[][13] = {
 	{ 0x00, 0x02, 0x15, 0x0e, 0x00, 0x1e, 0x11, 0x11, 0x19, 0x16, 0x00, 0x00, 0x00 },	// U+1EB1 (ằ)
 	{ 0x00, 0x04, 0x19, 0x0e, 0x11, 0x11, 0x1f, 0x11, 0x11, 0x11, 0x00, 0x00, 0x00 },	// U+1EB2 (Ẳ)
 	{ 0x00, 0x04, 0x19, 0x0e, 0x00, 0x1e, 0x11, 0x11, 0x19, 0x16, 0x00, 0x00, 0x00 },	// U+1EB3 (ẳ)
-}; // 9
-
-static const unsigned char tewi_block43[][13] = {
 	{ 0x00, 0x16, 0x0d, 0x11, 0x0e, 0x1e, 0x11, 0x11, 0x19, 0x16, 0x00, 0x00, 0x00 },	// U+1EB5 (ẵ)
 	{ 0x00, 0x11, 0x0e, 0x0e, 0x11, 0x11, 0x1f, 0x11, 0x11, 0x11, 0x00, 0x04, 0x00 },	// U+1EB6 (Ặ)
 	{ 0x00, 0x00, 0x11, 0x0e, 0x00, 0x1e, 0x11, 0x11, 0x19, 0x16, 0x00, 0x04, 0x00 },	// U+1EB7 (ặ)
@@ -1456,9 +1330,6 @@ static const unsigned char tewi_block43[][13] = {
 	{ 0x00, 0x00, 0x11, 0x2a, 0x00, 0x0e, 0x11, 0x1f, 0x01, 0x1e, 0x00, 0x00, 0x00 },	// U+1EC1 (ề)
 	{ 0x00, 0x12, 0x25, 0x1f, 0x01, 0x01, 0x0f, 0x01, 0x01, 0x1f, 0x00, 0x00, 0x00 },	// U+1EC2 (Ể)
 	{ 0x00, 0x00, 0x12, 0x25, 0x10, 0x0e, 0x11, 0x1f, 0x01, 0x1e, 0x00, 0x00, 0x00 },	// U+1EC3 (ể)
-}; // 15
-
-static const unsigned char tewi_block44[][13] = {
 	{ 0x00, 0x16, 0x0d, 0x04, 0x0a, 0x0e, 0x11, 0x1f, 0x01, 0x1e, 0x00, 0x00, 0x00 },	// U+1EC5 (ễ)
 	{ 0x00, 0x04, 0x0a, 0x1f, 0x01, 0x01, 0x0f, 0x01, 0x01, 0x1f, 0x00, 0x04, 0x00 },	// U+1EC6 (Ệ)
 	{ 0x00, 0x00, 0x04, 0x0a, 0x00, 0x0e, 0x11, 0x1f, 0x01, 0x1e, 0x00, 0x04, 0x00 },	// U+1EC7 (ệ)
@@ -1540,18 +1411,12 @@ static const unsigned char tewi_block44[][13] = {
 	{ 0x00, 0x03, 0x0a, 0x11, 0x00, 0x0e, 0x11, 0x07, 0x11, 0x0e, 0x00, 0x00, 0x00 },	// U+1F13 (ἓ)
 	{ 0x00, 0x03, 0x09, 0x12, 0x00, 0x0e, 0x11, 0x07, 0x11, 0x0e, 0x00, 0x00, 0x00 },	// U+1F14 (ἔ)
 	{ 0x00, 0x03, 0x11, 0x0a, 0x00, 0x0e, 0x11, 0x07, 0x11, 0x0e, 0x00, 0x00, 0x00 },	// U+1F15 (ἕ)
-}; // 81
-
-static const unsigned char tewi_block45[][13] = {
 	{ 0x00, 0x00, 0x03, 0x3e, 0x05, 0x04, 0x1c, 0x04, 0x04, 0x3c, 0x00, 0x00, 0x00 },	// U+1F18 (Ἐ)
 	{ 0x00, 0x00, 0x03, 0x3d, 0x06, 0x04, 0x1c, 0x04, 0x04, 0x3c, 0x00, 0x00, 0x00 },	// U+1F19 (Ἑ)
 	{ 0x00, 0x00, 0x03, 0x3e, 0x05, 0x05, 0x1e, 0x04, 0x04, 0x3c, 0x00, 0x00, 0x00 },	// U+1F1A (Ἒ)
 	{ 0x00, 0x00, 0x03, 0x3d, 0x06, 0x05, 0x1e, 0x04, 0x04, 0x3c, 0x00, 0x00, 0x00 },	// U+1F1B (Ἓ)
 	{ 0x00, 0x00, 0x03, 0x3e, 0x05, 0x06, 0x1d, 0x04, 0x04, 0x3c, 0x00, 0x00, 0x00 },	// U+1F1C (Ἔ)
 	{ 0x00, 0x00, 0x03, 0x3d, 0x06, 0x06, 0x1d, 0x04, 0x04, 0x3c, 0x00, 0x00, 0x00 },	// U+1F1D (Ἕ)
-}; // 6
-
-static const unsigned char tewi_block46[][13] = {
 	{ 0x00, 0x0c, 0x08, 0x04, 0x00, 0x0d, 0x13, 0x11, 0x11, 0x11, 0x10, 0x10, 0x00 },	// U+1F20 (ἠ)
 	{ 0x00, 0x0c, 0x04, 0x08, 0x00, 0x0d, 0x13, 0x11, 0x11, 0x11, 0x10, 0x10, 0x00 },	// U+1F21 (ἡ)
 	{ 0x00, 0x03, 0x0a, 0x11, 0x00, 0x0d, 0x13, 0x11, 0x11, 0x11, 0x10, 0x10, 0x00 },	// U+1F22 (ἢ)
@@ -1590,18 +1455,12 @@ static const unsigned char tewi_block46[][13] = {
 	{ 0x00, 0x03, 0x09, 0x12, 0x00, 0x0e, 0x11, 0x11, 0x11, 0x0e, 0x00, 0x00, 0x00 },	// U+1F43 (ὃ)
 	{ 0x00, 0x03, 0x12, 0x09, 0x00, 0x0e, 0x11, 0x11, 0x11, 0x0e, 0x00, 0x00, 0x00 },	// U+1F44 (ὄ)
 	{ 0x00, 0x03, 0x11, 0x0a, 0x00, 0x0e, 0x11, 0x11, 0x11, 0x0e, 0x00, 0x00, 0x00 },	// U+1F45 (ὅ)
-}; // 38
-
-static const unsigned char tewi_block47[][13] = {
 	{ 0x00, 0x00, 0x03, 0x1a, 0x25, 0x24, 0x24, 0x24, 0x24, 0x18, 0x00, 0x00, 0x00 },	// U+1F48 (Ὀ)
 	{ 0x00, 0x00, 0x03, 0x19, 0x26, 0x24, 0x24, 0x24, 0x24, 0x18, 0x00, 0x00, 0x00 },	// U+1F49 (Ὁ)
 	{ 0x00, 0x00, 0x03, 0x1a, 0x25, 0x25, 0x26, 0x24, 0x24, 0x18, 0x00, 0x00, 0x00 },	// U+1F4A (Ὂ)
 	{ 0x00, 0x00, 0x03, 0x19, 0x26, 0x25, 0x26, 0x24, 0x24, 0x18, 0x00, 0x00, 0x00 },	// U+1F4B (Ὃ)
 	{ 0x00, 0x00, 0x03, 0x1a, 0x25, 0x26, 0x25, 0x24, 0x24, 0x18, 0x00, 0x00, 0x00 },	// U+1F4C (Ὄ)
 	{ 0x00, 0x00, 0x03, 0x19, 0x26, 0x26, 0x25, 0x24, 0x24, 0x18, 0x00, 0x00, 0x00 },	// U+1F4D (Ὅ)
-}; // 6
-
-static const unsigned char tewi_block48[][13] = {
 	{ 0x00, 0x0c, 0x08, 0x04, 0x00, 0x11, 0x11, 0x11, 0x11, 0x0e, 0x00, 0x00, 0x00 },	// U+1F50 (ὐ)
 	{ 0x00, 0x0c, 0x04, 0x08, 0x00, 0x11, 0x11, 0x11, 0x11, 0x0e, 0x00, 0x00, 0x00 },	// U+1F51 (ὑ)
 	{ 0x00, 0x03, 0x0a, 0x11, 0x00, 0x11, 0x11, 0x11, 0x11, 0x0e, 0x00, 0x00, 0x00 },	// U+1F52 (ὒ)
@@ -1610,21 +1469,9 @@ static const unsigned char tewi_block48[][13] = {
 	{ 0x00, 0x03, 0x11, 0x0a, 0x00, 0x11, 0x11, 0x11, 0x11, 0x0e, 0x00, 0x00, 0x00 },	// U+1F55 (ὕ)
 	{ 0x00, 0x16, 0x0d, 0x04, 0x02, 0x11, 0x11, 0x11, 0x11, 0x0e, 0x00, 0x00, 0x00 },	// U+1F56 (ὖ)
 	{ 0x00, 0x16, 0x0d, 0x04, 0x08, 0x11, 0x11, 0x11, 0x11, 0x0e, 0x00, 0x00, 0x00 },	// U+1F57 (ὗ)
-}; // 8
-
-static const unsigned char tewi_block49[][13] = {
 	{ 0x00, 0x00, 0x03, 0x15, 0x16, 0x14, 0x08, 0x08, 0x08, 0x08, 0x00, 0x00, 0x00 },	// U+1F59 (Ὑ)
-}; // 1
-
-static const unsigned char tewi_block50[][13] = {
 	{ 0x00, 0x00, 0x03, 0x15, 0x16, 0x15, 0x0a, 0x08, 0x08, 0x08, 0x00, 0x00, 0x00 },	// U+1F5B (Ὓ)
-}; // 1
-
-static const unsigned char tewi_block51[][13] = {
 	{ 0x00, 0x00, 0x03, 0x15, 0x16, 0x16, 0x09, 0x08, 0x08, 0x08, 0x00, 0x00, 0x00 },	// U+1F5D (Ὕ)
-}; // 1
-
-static const unsigned char tewi_block52[][13] = {
 	{ 0x00, 0x16, 0x0d, 0x17, 0x15, 0x16, 0x08, 0x08, 0x08, 0x08, 0x00, 0x00, 0x00 },	// U+1F5F (Ὗ)
 	{ 0x00, 0x0c, 0x08, 0x04, 0x00, 0x11, 0x11, 0x15, 0x15, 0x0a, 0x00, 0x00, 0x00 },	// U+1F60 (ὠ)
 	{ 0x00, 0x0c, 0x04, 0x08, 0x00, 0x11, 0x11, 0x15, 0x15, 0x0a, 0x00, 0x00, 0x00 },	// U+1F61 (ὡ)
@@ -1656,9 +1503,6 @@ static const unsigned char tewi_block52[][13] = {
 	{ 0x00, 0x00, 0x08, 0x04, 0x00, 0x11, 0x11, 0x11, 0x11, 0x0e, 0x00, 0x00, 0x00 },	// U+1F7B (ύ)
 	{ 0x00, 0x00, 0x02, 0x04, 0x00, 0x11, 0x11, 0x15, 0x15, 0x0a, 0x00, 0x00, 0x00 },	// U+1F7C (ὼ)
 	{ 0x00, 0x00, 0x08, 0x04, 0x00, 0x11, 0x11, 0x15, 0x15, 0x0a, 0x00, 0x00, 0x00 },	// U+1F7D (ώ)
-}; // 31
-
-static const unsigned char tewi_block53[][13] = {
 	{ 0x00, 0x0c, 0x08, 0x04, 0x00, 0x16, 0x19, 0x11, 0x19, 0x16, 0x04, 0x08, 0x00 },	// U+1F80 (ᾀ)
 	{ 0x00, 0x0c, 0x04, 0x08, 0x00, 0x16, 0x19, 0x11, 0x19, 0x16, 0x04, 0x08, 0x00 },	// U+1F81 (ᾁ)
 	{ 0x00, 0x03, 0x0a, 0x11, 0x00, 0x16, 0x19, 0x11, 0x19, 0x16, 0x04, 0x08, 0x00 },	// U+1F82 (ᾂ)
@@ -1712,9 +1556,6 @@ static const unsigned char tewi_block53[][13] = {
 	{ 0x00, 0x00, 0x02, 0x04, 0x00, 0x16, 0x19, 0x11, 0x19, 0x16, 0x04, 0x08, 0x00 },	// U+1FB2 (ᾲ)
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x16, 0x19, 0x11, 0x19, 0x16, 0x04, 0x08, 0x00 },	// U+1FB3 (ᾳ)
 	{ 0x00, 0x00, 0x08, 0x04, 0x00, 0x16, 0x19, 0x11, 0x19, 0x16, 0x04, 0x08, 0x00 },	// U+1FB4 (ᾴ)
-}; // 53
-
-static const unsigned char tewi_block54[][13] = {
 	{ 0x00, 0x00, 0x16, 0x0d, 0x00, 0x16, 0x19, 0x11, 0x19, 0x16, 0x00, 0x00, 0x00 },	// U+1FB6 (ᾶ)
 	{ 0x00, 0x00, 0x16, 0x0d, 0x00, 0x16, 0x19, 0x11, 0x19, 0x16, 0x04, 0x08, 0x00 },	// U+1FB7 (ᾷ)
 	{ 0x00, 0x11, 0x0e, 0x0e, 0x11, 0x11, 0x1f, 0x11, 0x11, 0x11, 0x00, 0x00, 0x00 },	// U+1FB8 (Ᾰ)
@@ -1725,15 +1566,9 @@ static const unsigned char tewi_block54[][13] = {
 	{ 0x00, 0x00, 0x0c, 0x08, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+1FBD (᾽)
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x08, 0x00 },	// U+1FBE (ι)
 	{ 0x00, 0x00, 0x0c, 0x08, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+1FBF (᾿)
-}; // 10
-
-static const unsigned char tewi_block55[][13] = {
 	{ 0x00, 0x00, 0x02, 0x04, 0x00, 0x0d, 0x13, 0x11, 0x11, 0x11, 0x11, 0x12, 0x00 },	// U+1FC2 (ῂ)
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x0d, 0x13, 0x11, 0x11, 0x11, 0x11, 0x12, 0x00 },	// U+1FC3 (ῃ)
 	{ 0x00, 0x00, 0x08, 0x04, 0x00, 0x0d, 0x13, 0x11, 0x11, 0x11, 0x11, 0x12, 0x00 },	// U+1FC4 (ῄ)
-}; // 3
-
-static const unsigned char tewi_block56[][13] = {
 	{ 0x00, 0x00, 0x16, 0x0d, 0x00, 0x0d, 0x13, 0x11, 0x11, 0x11, 0x10, 0x10, 0x00 },	// U+1FC6 (ῆ)
 	{ 0x00, 0x00, 0x16, 0x0d, 0x00, 0x0d, 0x13, 0x11, 0x11, 0x11, 0x11, 0x12, 0x00 },	// U+1FC7 (ῇ)
 	{ 0x00, 0x00, 0x01, 0x3e, 0x04, 0x04, 0x1c, 0x04, 0x04, 0x3c, 0x00, 0x00, 0x00 },	// U+1FC8 (Ὲ)
@@ -1748,18 +1583,12 @@ static const unsigned char tewi_block56[][13] = {
 	{ 0x00, 0x00, 0x00, 0x0e, 0x00, 0x04, 0x04, 0x04, 0x14, 0x08, 0x00, 0x00, 0x00 },	// U+1FD1 (ῑ)
 	{ 0x00, 0x02, 0x04, 0x11, 0x00, 0x04, 0x04, 0x04, 0x14, 0x08, 0x00, 0x00, 0x00 },	// U+1FD2 (ῒ)
 	{ 0x00, 0x08, 0x04, 0x11, 0x00, 0x04, 0x04, 0x04, 0x14, 0x08, 0x00, 0x00, 0x00 },	// U+1FD3 (ΐ)
-}; // 14
-
-static const unsigned char tewi_block57[][13] = {
 	{ 0x00, 0x00, 0x16, 0x0d, 0x00, 0x04, 0x04, 0x04, 0x14, 0x08, 0x00, 0x00, 0x00 },	// U+1FD6 (ῖ)
 	{ 0x00, 0x16, 0x0d, 0x00, 0x11, 0x04, 0x04, 0x04, 0x14, 0x08, 0x00, 0x00, 0x00 },	// U+1FD7 (ῗ)
 	{ 0x00, 0x16, 0x0d, 0x0e, 0x04, 0x04, 0x04, 0x04, 0x04, 0x0e, 0x00, 0x00, 0x00 },	// U+1FD8 (Ῐ)
 	{ 0x00, 0x0e, 0x00, 0x0e, 0x04, 0x04, 0x04, 0x04, 0x04, 0x0e, 0x00, 0x00, 0x00 },	// U+1FD9 (Ῑ)
 	{ 0x00, 0x00, 0x01, 0x1e, 0x08, 0x08, 0x08, 0x08, 0x08, 0x1c, 0x00, 0x00, 0x00 },	// U+1FDA (Ὶ)
 	{ 0x00, 0x00, 0x02, 0x1d, 0x08, 0x08, 0x08, 0x08, 0x08, 0x1c, 0x00, 0x00, 0x00 },	// U+1FDB (Ί)
-}; // 6
-
-static const unsigned char tewi_block58[][13] = {
 	{ 0x00, 0x00, 0x03, 0x09, 0x12, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+1FDD (῝)
 	{ 0x00, 0x00, 0x03, 0x11, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+1FDE (῞)
 	{ 0x00, 0x16, 0x0d, 0x04, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+1FDF (῟)
@@ -1779,15 +1608,9 @@ static const unsigned char tewi_block58[][13] = {
 	{ 0x00, 0x02, 0x04, 0x00, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+1FED (῭)
 	{ 0x00, 0x08, 0x04, 0x00, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+1FEE (΅)
 	{ 0x00, 0x00, 0x02, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+1FEF (`)
-}; // 19
-
-static const unsigned char tewi_block59[][13] = {
 	{ 0x00, 0x00, 0x02, 0x04, 0x00, 0x11, 0x11, 0x15, 0x15, 0x0a, 0x04, 0x08, 0x00 },	// U+1FF2 (ῲ)
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x11, 0x15, 0x15, 0x0a, 0x04, 0x08, 0x00 },	// U+1FF3 (ῳ)
 	{ 0x00, 0x00, 0x08, 0x04, 0x00, 0x11, 0x11, 0x15, 0x15, 0x0a, 0x04, 0x08, 0x00 },	// U+1FF4 (ῴ)
-}; // 3
-
-static const unsigned char tewi_block60[][13] = {
 	{ 0x00, 0x00, 0x16, 0x0d, 0x00, 0x11, 0x11, 0x15, 0x15, 0x0a, 0x00, 0x00, 0x00 },	// U+1FF6 (ῶ)
 	{ 0x00, 0x00, 0x16, 0x0d, 0x00, 0x11, 0x11, 0x15, 0x15, 0x0a, 0x04, 0x08, 0x00 },	// U+1FF7 (ῷ)
 	{ 0x00, 0x00, 0x01, 0x0e, 0x12, 0x12, 0x12, 0x12, 0x12, 0x0c, 0x00, 0x00, 0x00 },	// U+1FF8 (Ὸ)
@@ -1797,13 +1620,7 @@ static const unsigned char tewi_block60[][13] = {
 	{ 0x00, 0x00, 0x00, 0x0e, 0x11, 0x11, 0x11, 0x11, 0x0a, 0x1b, 0x04, 0x08, 0x00 },	// U+1FFC (ῼ)
 	{ 0x00, 0x00, 0x08, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+1FFD (´)
 	{ 0x00, 0x00, 0x0c, 0x04, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+1FFE (῾)
-}; // 9
-
-static const unsigned char tewi_block61[][13] = {
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+2010 (‐)
-}; // 1
-
-static const unsigned char tewi_block62[][13] = {
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+2012 (‒)
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+2013 (–)
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+2014 (—)
@@ -1826,13 +1643,7 @@ static const unsigned char tewi_block62[][13] = {
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1b, 0x1b, 0x00, 0x00, 0x00 },	// U+2025 (‥)
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x00, 0x00, 0x00 },	// U+2026 (…)
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0c, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+2027 (‧)
-}; // 22
-
-static const unsigned char tewi_block63[][13] = {
 	{ 0x00, 0x00, 0x00, 0x12, 0x15, 0x0a, 0x04, 0x0a, 0x15, 0x0b, 0x00, 0x00, 0x00 },	// U+2030 (‰)
-}; // 1
-
-static const unsigned char tewi_block64[][13] = {
 	{ 0x00, 0x00, 0x04, 0x04, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+2032 (′)
 	{ 0x00, 0x00, 0x14, 0x14, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+2033 (″)
 	{ 0x00, 0x00, 0x2a, 0x2a, 0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+2034 (‴)
@@ -1842,9 +1653,6 @@ static const unsigned char tewi_block64[][13] = {
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x0a, 0x11, 0x00, 0x00 },	// U+2038 (‸)
 	{ 0x00, 0x00, 0x00, 0x00, 0x04, 0x04, 0x02, 0x02, 0x04, 0x04, 0x00, 0x00, 0x00 },	// U+2039 (‹)
 	{ 0x00, 0x00, 0x00, 0x00, 0x04, 0x04, 0x08, 0x08, 0x04, 0x04, 0x00, 0x00, 0x00 },	// U+203A (›)
-}; // 9
-
-static const unsigned char tewi_block65[][13] = {
 	{ 0x00, 0x00, 0x00, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x00, 0x0a, 0x00, 0x00, 0x00 },	// U+203C (‼)
 	{ 0x00, 0x00, 0x00, 0x0e, 0x15, 0x14, 0x0c, 0x04, 0x00, 0x04, 0x00, 0x00, 0x00 },	// U+203D (‽)
 	{ 0x00, 0x00, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+203E (‾)
@@ -1872,9 +1680,6 @@ static const unsigned char tewi_block65[][13] = {
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0e, 0x11, 0x00 },	// U+2054 (⁔)
 	{ 0x00, 0x00, 0x00, 0x00, 0x15, 0x0e, 0x1f, 0x0e, 0x15, 0x00, 0x00, 0x00, 0x00 },	// U+2055 (⁕)
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x01, 0x00, 0x04, 0x00, 0x00, 0x00 },	// U+2056 (⁖)
-}; // 27
-
-static const unsigned char tewi_block66[][13] = {
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x11, 0x00, 0x04, 0x00, 0x00, 0x00 },	// U+2058 (⁘)
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x00, 0x04, 0x00, 0x11, 0x00, 0x00, 0x00 },	// U+2059 (⁙)
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00 },	// U+205A (⁚)
@@ -1882,14 +1687,8 @@ static const unsigned char tewi_block66[][13] = {
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x04, 0x1f, 0x04, 0x15, 0x00, 0x00, 0x00 },	// U+205C (⁜)
 	{ 0x00, 0x00, 0x00, 0x0c, 0x0c, 0x00, 0x0c, 0x0c, 0x00, 0x0c, 0x0c, 0x00, 0x00 },	// U+205D (⁝)
 	{ 0x00, 0x00, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x00, 0x00 },	// U+205E (⁞)
-}; // 7
-
-static const unsigned char tewi_block67[][13] = {
 	{ 0x00, 0x00, 0x04, 0x0a, 0x0e, 0x0a, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+2070 (⁰)
 	{ 0x00, 0x04, 0x00, 0x06, 0x04, 0x04, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+2071 (ⁱ)
-}; // 2
-
-static const unsigned char tewi_block68[][13] = {
 	{ 0x00, 0x00, 0x02, 0x0a, 0x0e, 0x08, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+2074 (⁴)
 	{ 0x00, 0x00, 0x0e, 0x02, 0x06, 0x08, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+2075 (⁵)
 	{ 0x00, 0x00, 0x04, 0x02, 0x06, 0x0a, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+2076 (⁶)
@@ -1917,9 +1716,6 @@ static const unsigned char tewi_block68[][13] = {
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0e, 0x00, 0x0e, 0x00, 0x00 },	// U+208C (₌)
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x02, 0x02, 0x02, 0x04, 0x00 },	// U+208D (₍)
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x08, 0x08, 0x08, 0x04, 0x00 },	// U+208E (₎)
-}; // 27
-
-static const unsigned char tewi_block69[][13] = {
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x08, 0x0c, 0x0a, 0x0c, 0x00, 0x00 },	// U+2090 (ₐ)
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x0a, 0x0e, 0x02, 0x0c, 0x00, 0x00 },	// U+2091 (ₑ)
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x0a, 0x0a, 0x0a, 0x04, 0x00, 0x00 },	// U+2092 (ₒ)
@@ -1933,9 +1729,6 @@ static const unsigned char tewi_block69[][13] = {
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x0a, 0x0a, 0x06, 0x02, 0x02 },	// U+209A (ₚ)
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0c, 0x06, 0x08, 0x06, 0x00, 0x00 },	// U+209B (ₛ)
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x0e, 0x04, 0x04, 0x08, 0x00, 0x00 },	// U+209C (ₜ)
-}; // 13
-
-static const unsigned char tewi_block70[][13] = {
 	{ 0x00, 0x00, 0x00, 0x0e, 0x01, 0x1d, 0x05, 0x1e, 0x04, 0x1c, 0x00, 0x00, 0x00 },	// U+20A0 (₠)
 	{ 0x00, 0x00, 0x28, 0x2e, 0x15, 0x15, 0x15, 0x0b, 0x1b, 0x0e, 0x05, 0x05, 0x00 },	// U+20A1 (₡)
 	{ 0x00, 0x00, 0x00, 0x0e, 0x11, 0x01, 0x15, 0x0d, 0x05, 0x1e, 0x00, 0x00, 0x00 },	// U+20A2 (₢)
@@ -1943,9 +1736,6 @@ static const unsigned char tewi_block70[][13] = {
 	{ 0x00, 0x00, 0x0c, 0x12, 0x07, 0x02, 0x07, 0x02, 0x12, 0x0d, 0x00, 0x00, 0x00 },	// U+20A4 (₤)
 	{ 0x00, 0x00, 0x00, 0x00, 0x08, 0x0b, 0x15, 0x15, 0x15, 0x17, 0x02, 0x00, 0x00 },	// U+20A5 (₥)
 	{ 0x00, 0x00, 0x00, 0x13, 0x13, 0x1f, 0x15, 0x1f, 0x19, 0x19, 0x00, 0x00, 0x00 },	// U+20A6 (₦)
-}; // 7
-
-static const unsigned char tewi_block71[][13] = {
 	{ 0x00, 0x00, 0x00, 0x03, 0x15, 0x0d, 0x0b, 0x15, 0x15, 0x0d, 0x00, 0x00, 0x00 },	// U+20A8 (₨)
 	{ 0x00, 0x00, 0x00, 0x11, 0x11, 0x1f, 0x15, 0x1f, 0x0a, 0x0a, 0x00, 0x00, 0x00 },	// U+20A9 (₩)
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x2f, 0x29, 0x2d, 0x25, 0x3d, 0x00, 0x00, 0x00 },	// U+20AA (₪)
@@ -1954,31 +1744,16 @@ static const unsigned char tewi_block71[][13] = {
 	{ 0x00, 0x00, 0x00, 0x12, 0x12, 0x0a, 0x1f, 0x0a, 0x12, 0x12, 0x00, 0x00, 0x00 },	// U+20AD (₭)
 	{ 0x00, 0x00, 0x00, 0x1f, 0x04, 0x0c, 0x06, 0x0c, 0x06, 0x04, 0x00, 0x00, 0x00 },	// U+20AE (₮)
 	{ 0x00, 0x00, 0x00, 0x03, 0x05, 0x05, 0x0d, 0x15, 0x15, 0x0f, 0x04, 0x04, 0x04 },	// U+20AF (₯)
-}; // 8
-
-static const unsigned char tewi_block72[][13] = {
 	{ 0x00, 0x00, 0x0e, 0x3f, 0x12, 0x3f, 0x0e, 0x02, 0x02, 0x02, 0x00, 0x00, 0x00 },	// U+20B1 (₱)
 	{ 0x00, 0x00, 0x04, 0x0e, 0x15, 0x05, 0x1d, 0x15, 0x15, 0x0e, 0x04, 0x00, 0x00 },	// U+20B2 (₲)
 	{ 0x00, 0x00, 0x00, 0x0e, 0x11, 0x1f, 0x11, 0x1f, 0x11, 0x11, 0x00, 0x00, 0x00 },	// U+20B3 (₳)
-}; // 3
-
-static const unsigned char tewi_block73[][13] = {
 	{ 0x00, 0x00, 0x04, 0x0e, 0x15, 0x05, 0x05, 0x05, 0x15, 0x0e, 0x04, 0x00, 0x00 },	// U+20B5 (₵)
 	{ 0x00, 0x00, 0x00, 0x0a, 0x0a, 0x1f, 0x0a, 0x0a, 0x0a, 0x12, 0x00, 0x00, 0x00 },	// U+20B6 (₶)
-}; // 2
-
-static const unsigned char tewi_block74[][13] = {
 	{ 0x00, 0x00, 0x00, 0x1f, 0x00, 0x1f, 0x04, 0x04, 0x04, 0x04, 0x00, 0x00, 0x00 },	// U+20B8 (₸)
 	{ 0x00, 0x00, 0x00, 0x1f, 0x08, 0x1f, 0x08, 0x07, 0x02, 0x04, 0x08, 0x00, 0x00 },	// U+20B9 (₹)
 	{ 0x00, 0x00, 0x00, 0x02, 0x06, 0x03, 0x16, 0x13, 0x0a, 0x06, 0x00, 0x00, 0x00 },	// U+20BA (₺)
-}; // 3
-
-static const unsigned char tewi_block75[][13] = {
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x0e, 0x15, 0x15, 0x15, 0x00, 0x00, 0x00 },	// U+20BC (₼)
 	{ 0x00, 0x00, 0x00, 0x0e, 0x12, 0x12, 0x0f, 0x02, 0x07, 0x02, 0x00, 0x00, 0x00 },	// U+20BD (₽)
-}; // 2
-
-static const unsigned char tewi_block76[][13] = {
 	{ 0x00, 0x00, 0x00, 0x0e, 0x09, 0x1d, 0x0b, 0x04, 0x1a, 0x05, 0x04, 0x18, 0x00 },	// U+2100 (℀)
 	{ 0x00, 0x00, 0x00, 0x0e, 0x09, 0x1d, 0x0b, 0x04, 0x1a, 0x05, 0x08, 0x10, 0x0c },	// U+2101 (℁)
 	{ 0x00, 0x00, 0x00, 0x0e, 0x15, 0x05, 0x05, 0x05, 0x15, 0x0e, 0x00, 0x00, 0x00 },	// U+2102 (ℂ)
@@ -1991,38 +1766,17 @@ static const unsigned char tewi_block76[][13] = {
 	{ 0x00, 0x02, 0x05, 0x3e, 0x04, 0x04, 0x1c, 0x04, 0x04, 0x04, 0x00, 0x00, 0x00 },	// U+2109 (℉)
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x16, 0x19, 0x11, 0x11, 0x1e, 0x11, 0x11, 0x0e },	// U+210A (ℊ)
 	{ 0x00, 0x00, 0x00, 0x0b, 0x1a, 0x1a, 0x0e, 0x0b, 0x0b, 0x12, 0x00, 0x00, 0x00 },	// U+210B (ℋ)
-}; // 12
-
-static const unsigned char tewi_block77[][13] = {
 	{ 0x00, 0x00, 0x00, 0x09, 0x09, 0x1b, 0x2f, 0x1d, 0x09, 0x39, 0x00, 0x00, 0x00 },	// U+2116 (№)
 	{ 0x00, 0x00, 0x00, 0x0f, 0x10, 0x13, 0x15, 0x13, 0x11, 0x10, 0x0f, 0x00, 0x00 },	// U+2117 (℗)
-}; // 2
-
-static const unsigned char tewi_block78[][13] = {
 	{ 0x00, 0x00, 0x00, 0x2f, 0x3a, 0x3a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+2122 (™)
-}; // 1
-
-static const unsigned char tewi_block79[][13] = {
 	{ 0x00, 0x00, 0x1f, 0x08, 0x04, 0x1f, 0x08, 0x04, 0x0e, 0x10, 0x10, 0x11, 0x0e },	// U+2125 (℥)
 	{ 0x00, 0x00, 0x00, 0x0e, 0x11, 0x11, 0x11, 0x11, 0x0a, 0x1b, 0x00, 0x00, 0x00 },	// U+2126 (Ω)
 	{ 0x00, 0x00, 0x00, 0x1b, 0x0a, 0x11, 0x11, 0x11, 0x11, 0x0e, 0x00, 0x00, 0x00 },	// U+2127 (℧)
-}; // 3
-
-static const unsigned char tewi_block80[][13] = {
 	{ 0x00, 0x00, 0x00, 0x11, 0x09, 0x05, 0x03, 0x05, 0x09, 0x11, 0x00, 0x00, 0x00 },	// U+212A (K)
 	{ 0x00, 0x04, 0x0a, 0x0e, 0x11, 0x11, 0x1f, 0x11, 0x11, 0x11, 0x00, 0x00, 0x00 },	// U+212B (Å)
-}; // 2
-
-static const unsigned char tewi_block81[][13] = {
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x09, 0x07, 0x11, 0x0e, 0x00, 0x00, 0x00 },	// U+212F (ℯ)
-}; // 1
-
-static const unsigned char tewi_block82[][13] = {
 	{ 0x00, 0x00, 0x00, 0x14, 0x14, 0x1e, 0x1e, 0x16, 0x15, 0x31, 0x00, 0x00, 0x00 },	// U+2133 (ℳ)
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x29, 0x19, 0x09, 0x06, 0x00, 0x00, 0x00 },	// U+2134 (ℴ)
-}; // 2
-
-static const unsigned char tewi_block83[][13] = {
 	{ 0x00, 0x00, 0x00, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x00, 0x00, 0x00 },	// U+2160 (Ⅰ)
 	{ 0x00, 0x00, 0x00, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x00, 0x00, 0x00 },	// U+2161 (Ⅱ)
 	{ 0x00, 0x00, 0x00, 0x15, 0x15, 0x15, 0x15, 0x15, 0x15, 0x15, 0x00, 0x00, 0x00 },	// U+2162 (Ⅲ)
@@ -2030,9 +1784,6 @@ static const unsigned char tewi_block83[][13] = {
 	{ 0x00, 0x00, 0x00, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x04, 0x04, 0x00, 0x00, 0x00 },	// U+2164 (Ⅴ)
 	{ 0x00, 0x00, 0x00, 0x15, 0x15, 0x15, 0x15, 0x15, 0x12, 0x12, 0x00, 0x00, 0x00 },	// U+2165 (Ⅵ)
 	{ 0x00, 0x00, 0x00, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2a, 0x2a, 0x00, 0x00, 0x00 },	// U+2166 (Ⅶ)
-}; // 7
-
-static const unsigned char tewi_block84[][13] = {
 	{ 0x00, 0x00, 0x00, 0x15, 0x15, 0x15, 0x09, 0x15, 0x15, 0x15, 0x00, 0x00, 0x00 },	// U+2168 (Ⅸ)
 	{ 0x00, 0x00, 0x00, 0x0a, 0x0a, 0x0a, 0x04, 0x0a, 0x0a, 0x0a, 0x00, 0x00, 0x00 },	// U+2169 (Ⅹ)
 	{ 0x00, 0x00, 0x00, 0x15, 0x15, 0x15, 0x12, 0x15, 0x15, 0x15, 0x00, 0x00, 0x00 },	// U+216A (Ⅺ)
@@ -2048,9 +1799,6 @@ static const unsigned char tewi_block84[][13] = {
 	{ 0x00, 0x00, 0x00, 0x00, 0x0a, 0x0a, 0x0a, 0x0a, 0x04, 0x04, 0x00, 0x00, 0x00 },	// U+2174 (ⅴ)
 	{ 0x00, 0x00, 0x00, 0x00, 0x15, 0x05, 0x15, 0x15, 0x12, 0x12, 0x00, 0x00, 0x00 },	// U+2175 (ⅵ)
 	{ 0x00, 0x00, 0x00, 0x00, 0x2d, 0x05, 0x2d, 0x2d, 0x2a, 0x2a, 0x00, 0x00, 0x00 },	// U+2176 (ⅶ)
-}; // 15
-
-static const unsigned char tewi_block85[][13] = {
 	{ 0x00, 0x00, 0x00, 0x00, 0x01, 0x14, 0x15, 0x09, 0x15, 0x15, 0x00, 0x00, 0x00 },	// U+2178 (ⅸ)
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x0a, 0x0a, 0x04, 0x0a, 0x0a, 0x00, 0x00, 0x00 },	// U+2179 (ⅹ)
 	{ 0x00, 0x00, 0x00, 0x00, 0x10, 0x05, 0x15, 0x12, 0x15, 0x15, 0x00, 0x00, 0x00 },	// U+217A (ⅺ)
@@ -2060,20 +1808,11 @@ static const unsigned char tewi_block85[][13] = {
 	{ 0x00, 0x00, 0x00, 0x10, 0x10, 0x1e, 0x11, 0x11, 0x11, 0x1e, 0x00, 0x00, 0x00 },	// U+217E (ⅾ)
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x0b, 0x15, 0x15, 0x15, 0x15, 0x00, 0x00, 0x00 },	// U+217F (ⅿ)
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x0e, 0x15, 0x15, 0x15, 0x0e, 0x00, 0x00, 0x00 },	// U+2180 (ↀ)
-}; // 9
-
-static const unsigned char tewi_block86[][13] = {
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x0f, 0x10, 0x10, 0x10, 0x0f, 0x00, 0x00, 0x00 },	// U+2183 (Ↄ)
-}; // 1
-
-static const unsigned char tewi_block87[][13] = {
 	{ 0x00, 0x00, 0x00, 0x00, 0x04, 0x02, 0x1f, 0x02, 0x04, 0x00, 0x00, 0x00, 0x00 },	// U+2190 (←)
 	{ 0x00, 0x00, 0x00, 0x00, 0x04, 0x0e, 0x15, 0x04, 0x04, 0x00, 0x00, 0x00, 0x00 },	// U+2191 (↑)
 	{ 0x00, 0x00, 0x00, 0x00, 0x04, 0x08, 0x1f, 0x08, 0x04, 0x00, 0x00, 0x00, 0x00 },	// U+2192 (→)
 	{ 0x00, 0x00, 0x00, 0x00, 0x04, 0x04, 0x15, 0x0e, 0x04, 0x00, 0x00, 0x00, 0x00 },	// U+2193 (↓)
-}; // 4
-
-static const unsigned char tewi_block88[][13] = {
 	{ 0x00, 0x00, 0x00, 0x04, 0x0e, 0x15, 0x04, 0x15, 0x0e, 0x04, 0x00, 0x00, 0x00 },	// U+2195 (↕)
 	{ 0x00, 0x00, 0x00, 0x00, 0x07, 0x03, 0x05, 0x08, 0x10, 0x00, 0x00, 0x00, 0x00 },	// U+2196 (↖)
 	{ 0x00, 0x00, 0x00, 0x00, 0x1c, 0x18, 0x14, 0x02, 0x01, 0x00, 0x00, 0x00, 0x00 },	// U+2197 (↗)
@@ -2098,9 +1837,6 @@ static const unsigned char tewi_block88[][13] = {
 	{ 0x00, 0x00, 0x00, 0x00, 0x0a, 0x11, 0x3e, 0x10, 0x08, 0x00, 0x00, 0x00, 0x00 },	// U+21AA (↪)
 	{ 0x00, 0x00, 0x00, 0x00, 0x14, 0x2a, 0x1f, 0x0a, 0x04, 0x00, 0x00, 0x00, 0x00 },	// U+21AB (↫)
 	{ 0x00, 0x00, 0x00, 0x00, 0x0a, 0x15, 0x3e, 0x14, 0x08, 0x00, 0x00, 0x00, 0x00 },	// U+21AC (↬)
-}; // 24
-
-static const unsigned char tewi_block89[][13] = {
 	{ 0x00, 0x00, 0x10, 0x08, 0x04, 0x1e, 0x08, 0x05, 0x03, 0x07, 0x00, 0x00, 0x00 },	// U+21AF (↯)
 	{ 0x00, 0x00, 0x00, 0x04, 0x02, 0x1f, 0x12, 0x14, 0x10, 0x10, 0x00, 0x00, 0x00 },	// U+21B0 (↰)
 	{ 0x00, 0x00, 0x00, 0x04, 0x08, 0x1f, 0x09, 0x05, 0x01, 0x01, 0x00, 0x00, 0x00 },	// U+21B1 (↱)
@@ -2132,17 +1868,11 @@ static const unsigned char tewi_block89[][13] = {
 	{ 0x00, 0x00, 0x00, 0x04, 0x02, 0x1f, 0x00, 0x00, 0x1f, 0x08, 0x04, 0x00, 0x00 },	// U+21CB (⇋)
 	{ 0x00, 0x00, 0x00, 0x04, 0x08, 0x1f, 0x00, 0x00, 0x1f, 0x02, 0x04, 0x00, 0x00 },	// U+21CC (⇌)
 	{ 0x00, 0x00, 0x00, 0x00, 0x14, 0x1e, 0x09, 0x1e, 0x04, 0x00, 0x00, 0x00, 0x00 },	// U+21CD (⇍)
-}; // 31
-
-static const unsigned char tewi_block90[][13] = {
 	{ 0x00, 0x00, 0x00, 0x00, 0x04, 0x0f, 0x12, 0x0f, 0x05, 0x00, 0x00, 0x00, 0x00 },	// U+21CF (⇏)
 	{ 0x00, 0x00, 0x00, 0x00, 0x04, 0x1e, 0x01, 0x1e, 0x04, 0x00, 0x00, 0x00, 0x00 },	// U+21D0 (⇐)
 	{ 0x00, 0x00, 0x00, 0x00, 0x04, 0x0a, 0x1b, 0x0a, 0x0a, 0x00, 0x00, 0x00, 0x00 },	// U+21D1 (⇑)
 	{ 0x00, 0x00, 0x00, 0x00, 0x04, 0x0f, 0x10, 0x0f, 0x04, 0x00, 0x00, 0x00, 0x00 },	// U+21D2 (⇒)
 	{ 0x00, 0x00, 0x00, 0x00, 0x0a, 0x0a, 0x1b, 0x0a, 0x04, 0x00, 0x00, 0x00, 0x00 },	// U+21D3 (⇓)
-}; // 5
-
-static const unsigned char tewi_block91[][13] = {
 	{ 0x00, 0x00, 0x00, 0x04, 0x0a, 0x1b, 0x0a, 0x1b, 0x0a, 0x04, 0x00, 0x00, 0x00 },	// U+21D5 (⇕)
 	{ 0x00, 0x00, 0x00, 0x07, 0x05, 0x0b, 0x14, 0x08, 0x10, 0x00, 0x00, 0x00, 0x00 },	// U+21D6 (⇖)
 	{ 0x00, 0x00, 0x00, 0x1c, 0x14, 0x1a, 0x05, 0x02, 0x01, 0x00, 0x00, 0x00, 0x00 },	// U+21D7 (⇗)
@@ -2170,9 +1900,6 @@ static const unsigned char tewi_block91[][13] = {
 	{ 0x00, 0x00, 0x00, 0x04, 0x0e, 0x15, 0x0e, 0x1f, 0x15, 0x1f, 0x00, 0x00, 0x00 },	// U+21ED (⇭)
 	{ 0x00, 0x00, 0x00, 0x04, 0x0a, 0x1f, 0x0a, 0x1b, 0x0a, 0x0e, 0x00, 0x00, 0x00 },	// U+21EE (⇮)
 	{ 0x00, 0x00, 0x00, 0x04, 0x0a, 0x1f, 0x0a, 0x1b, 0x11, 0x1f, 0x00, 0x00, 0x00 },	// U+21EF (⇯)
-}; // 27
-
-static const unsigned char tewi_block92[][13] = {
 	{ 0x00, 0x00, 0x00, 0x1f, 0x01, 0x1d, 0x0d, 0x15, 0x20, 0x00, 0x00, 0x00, 0x00 },	// U+21F1 (⇱)
 	{ 0x00, 0x00, 0x00, 0x01, 0x2a, 0x2c, 0x2e, 0x20, 0x3e, 0x00, 0x00, 0x00, 0x00 },	// U+21F2 (⇲)
 	{ 0x00, 0x00, 0x00, 0x04, 0x0a, 0x1b, 0x0a, 0x1b, 0x0e, 0x04, 0x00, 0x00, 0x00 },	// U+21F3 (⇳)
@@ -2181,18 +1908,9 @@ static const unsigned char tewi_block92[][13] = {
 	{ 0x00, 0x00, 0x04, 0x08, 0x1f, 0x08, 0x1f, 0x08, 0x1f, 0x08, 0x04, 0x00, 0x00 },	// U+21F6 (⇶)
 	{ 0x00, 0x00, 0x00, 0x00, 0x14, 0x12, 0x3f, 0x12, 0x14, 0x00, 0x00, 0x00, 0x00 },	// U+21F7 (⇷)
 	{ 0x00, 0x00, 0x00, 0x00, 0x0a, 0x12, 0x3f, 0x12, 0x0a, 0x00, 0x00, 0x00, 0x00 },	// U+21F8 (⇸)
-}; // 8
-
-static const unsigned char tewi_block93[][13] = {
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x2a, 0x3f, 0x2a, 0x04, 0x00, 0x00, 0x00 },	// U+21FA (⇺)
-}; // 1
-
-static const unsigned char tewi_block94[][13] = {
 	{ 0x00, 0x00, 0x00, 0x00, 0x04, 0x06, 0x1d, 0x06, 0x04, 0x00, 0x00, 0x00, 0x00 },	// U+21FD (⇽)
 	{ 0x00, 0x00, 0x00, 0x00, 0x04, 0x0c, 0x17, 0x0c, 0x04, 0x00, 0x00, 0x00, 0x00 },	// U+21FE (⇾)
-}; // 2
-
-static const unsigned char tewi_block95[][13] = {
 	{ 0x00, 0x00, 0x00, 0x11, 0x11, 0x1f, 0x0a, 0x0a, 0x04, 0x04, 0x00, 0x00, 0x00 },	// U+2200 (∀)
 	{ 0x00, 0x00, 0x00, 0x06, 0x09, 0x09, 0x01, 0x09, 0x09, 0x06, 0x00, 0x00, 0x00 },	// U+2201 (∁)
 	{ 0x00, 0x00, 0x00, 0x0c, 0x12, 0x10, 0x16, 0x19, 0x11, 0x0e, 0x00, 0x00, 0x00 },	// U+2202 (∂)
@@ -2238,14 +1956,8 @@ static const unsigned char tewi_block95[][13] = {
 	{ 0x00, 0x00, 0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x0e, 0x00, 0x00, 0x00 },	// U+222A (∪)
 	{ 0x00, 0x08, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x02, 0x00 },	// U+222B (∫)
 	{ 0x00, 0x14, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x05, 0x00 },	// U+222C (∬)
-}; // 45
-
-static const unsigned char tewi_block96[][13] = {
 	{ 0x00, 0x08, 0x04, 0x04, 0x04, 0x0e, 0x15, 0x0e, 0x04, 0x04, 0x04, 0x02, 0x00 },	// U+222E (∮)
 	{ 0x00, 0x14, 0x0a, 0x0a, 0x0a, 0x0e, 0x1b, 0x0e, 0x0a, 0x0a, 0x0a, 0x05, 0x00 },	// U+222F (∯)
-}; // 2
-
-static const unsigned char tewi_block97[][13] = {
 	{ 0x00, 0x08, 0x04, 0x04, 0x04, 0x2e, 0x35, 0x3c, 0x04, 0x04, 0x04, 0x02, 0x00 },	// U+2231 (∱)
 	{ 0x00, 0x08, 0x04, 0x04, 0x04, 0x2e, 0x35, 0x3e, 0x04, 0x04, 0x04, 0x02, 0x00 },	// U+2232 (∲)
 	{ 0x00, 0x08, 0x04, 0x04, 0x04, 0x3e, 0x35, 0x2e, 0x04, 0x04, 0x04, 0x02, 0x00 },	// U+2233 (∳)
@@ -2290,9 +2002,6 @@ static const unsigned char tewi_block97[][13] = {
 	{ 0x00, 0x00, 0x0a, 0x04, 0x00, 0x1f, 0x00, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+225A (≚)
 	{ 0x00, 0x15, 0x0e, 0x15, 0x00, 0x1f, 0x00, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+225B (≛)
 	{ 0x00, 0x04, 0x0a, 0x1f, 0x00, 0x1f, 0x00, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+225C (≜)
-}; // 44
-
-static const unsigned char tewi_block98[][13] = {
 	{ 0x00, 0x00, 0x0f, 0x15, 0x00, 0x1f, 0x00, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+225E (≞)
 	{ 0x00, 0x04, 0x08, 0x04, 0x00, 0x04, 0x1f, 0x00, 0x1f, 0x00, 0x00, 0x00, 0x00 },	// U+225F (≟)
 	{ 0x00, 0x00, 0x00, 0x00, 0x08, 0x1f, 0x04, 0x1f, 0x02, 0x00, 0x00, 0x00, 0x00 },	// U+2260 (≠)
@@ -2353,13 +2062,7 @@ static const unsigned char tewi_block98[][13] = {
 	{ 0x00, 0x00, 0x00, 0x00, 0x0e, 0x1b, 0x15, 0x1b, 0x0e, 0x00, 0x00, 0x00, 0x00 },	// U+2297 (⊗)
 	{ 0x00, 0x00, 0x00, 0x00, 0x0e, 0x19, 0x15, 0x13, 0x0e, 0x00, 0x00, 0x00, 0x00 },	// U+2298 (⊘)
 	{ 0x00, 0x00, 0x00, 0x00, 0x0e, 0x11, 0x15, 0x11, 0x0e, 0x00, 0x00, 0x00, 0x00 },	// U+2299 (⊙)
-}; // 60
-
-static const unsigned char tewi_block99[][13] = {
 	{ 0x00, 0x00, 0x00, 0x00, 0x0e, 0x11, 0x15, 0x11, 0x0e, 0x00, 0x00, 0x00, 0x00 },	// U+229B (⊛)
-}; // 1
-
-static const unsigned char tewi_block100[][13] = {
 	{ 0x00, 0x00, 0x00, 0x00, 0x0e, 0x11, 0x1f, 0x11, 0x0e, 0x00, 0x00, 0x00, 0x00 },	// U+229D (⊝)
 	{ 0x00, 0x00, 0x00, 0x00, 0x1f, 0x15, 0x1f, 0x15, 0x1f, 0x00, 0x00, 0x00, 0x00 },	// U+229E (⊞)
 	{ 0x00, 0x00, 0x00, 0x00, 0x1f, 0x11, 0x1f, 0x11, 0x1f, 0x00, 0x00, 0x00, 0x00 },	// U+229F (⊟)
@@ -2492,9 +2195,6 @@ static const unsigned char tewi_block100[][13] = {
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x07, 0x00, 0x00, 0x00 },	// U+231E (⌞)
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x10, 0x1c, 0x00, 0x00, 0x00 },	// U+231F (⌟)
 	{ 0x00, 0x00, 0x08, 0x14, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x00 },	// U+2320 (⌠)
-}; // 132
-
-static const unsigned char tewi_block101[][13] = {
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0c, 0x12, 0x21, 0x00, 0x00, 0x00, 0x00 },	// U+2322 (⌢)
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x21, 0x21, 0x1e, 0x00, 0x00, 0x00, 0x00 },	// U+2323 (⌣)
 	{ 0x00, 0x00, 0x1b, 0x04, 0x0a, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+2324 (⌤)
@@ -2502,17 +2202,8 @@ static const unsigned char tewi_block101[][13] = {
 	{ 0x00, 0x00, 0x00, 0x00, 0x0f, 0x1b, 0x25, 0x1b, 0x0f, 0x00, 0x00, 0x00, 0x00 },	// U+2326 (⌦)
 	{ 0x00, 0x00, 0x00, 0x00, 0x3f, 0x33, 0x2d, 0x33, 0x3f, 0x00, 0x00, 0x00, 0x00 },	// U+2327 (⌧)
 	{ 0x00, 0x00, 0x00, 0x3e, 0x26, 0x3a, 0x37, 0x3a, 0x36, 0x2a, 0x3e, 0x00, 0x00 },	// U+2328 (⌨)
-}; // 7
-
-static const unsigned char tewi_block102[][13] = {
 	{ 0x00, 0x00, 0x00, 0x00, 0x3c, 0x36, 0x29, 0x36, 0x3c, 0x00, 0x00, 0x00, 0x00 },	// U+232B (⌫)
-}; // 1
-
-static const unsigned char tewi_block103[][13] = {
 	{ 0x00, 0x00, 0x20, 0x10, 0x08, 0x0c, 0x32, 0x13, 0x0c, 0x04, 0x02, 0x01, 0x00 },	// U+232D (⌭)
-}; // 1
-
-static const unsigned char tewi_block104[][13] = {
 	{ 0x00, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x3f, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x00 },	// U+232F (⌯)
 	{ 0x00, 0x00, 0x00, 0x12, 0x3f, 0x12, 0x12, 0x09, 0x09, 0x0f, 0x00, 0x00, 0x00 },	// U+2330 (⌰)
 	{ 0x00, 0x00, 0x00, 0x00, 0x0e, 0x15, 0x3d, 0x15, 0x0e, 0x00, 0x00, 0x00, 0x00 },	// U+2331 (⌱)
@@ -2593,28 +2284,13 @@ static const unsigned char tewi_block104[][13] = {
 	{ 0x00, 0x00, 0x0a, 0x06, 0x02, 0x03, 0x06, 0x0a, 0x1e, 0x05, 0x03, 0x07, 0x00 },	// U+237C (⍼)
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1b, 0x0a, 0x0e, 0x00, 0x00, 0x00 },	// U+237D (⍽)
 	{ 0x00, 0x00, 0x00, 0x0e, 0x11, 0x11, 0x1f, 0x0a, 0x0a, 0x1b, 0x00, 0x00, 0x00 },	// U+237E (⍾)
-}; // 80
-
-static const unsigned char tewi_block105[][13] = {
 	{ 0x00, 0x1e, 0x11, 0x11, 0x19, 0x16, 0x00, 0x11, 0x0a, 0x0a, 0x04, 0x04, 0x00 },	// U+2380 (⎀)
-}; // 1
-
-static const unsigned char tewi_block106[][13] = {
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x0e, 0x1f, 0x0e, 0x15, 0x00, 0x00, 0x00 },	// U+2388 (⎈)
-}; // 1
-
-static const unsigned char tewi_block107[][13] = {
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x0b, 0x13, 0x14, 0x11, 0x0e, 0x00, 0x00, 0x00 },	// U+238B (⎋)
-}; // 1
-
-static const unsigned char tewi_block108[][13] = {
 	{ 0x00, 0x00, 0x3f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+23BA (⎺)
 	{ 0x00, 0x00, 0x00, 0x00, 0x3f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+23BB (⎻)
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3f, 0x00, 0x00, 0x00 },	// U+23BC (⎼)
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3f, 0x00 },	// U+23BD (⎽)
-}; // 4
-
-static const unsigned char tewi_block109[][13] = {
 	{ 0x00, 0x00, 0x00, 0x00, 0x09, 0x1b, 0x3f, 0x1b, 0x09, 0x00, 0x00, 0x00, 0x00 },	// U+23E9 (⏩)
 	{ 0x00, 0x00, 0x00, 0x00, 0x24, 0x36, 0x3f, 0x36, 0x24, 0x00, 0x00, 0x00, 0x00 },	// U+23EA (⏪)
 	{ 0x00, 0x00, 0x00, 0x00, 0x04, 0x0e, 0x1f, 0x04, 0x0e, 0x1f, 0x00, 0x00, 0x00 },	// U+23EB (⏫)
@@ -2622,9 +2298,6 @@ static const unsigned char tewi_block109[][13] = {
 	{ 0x00, 0x00, 0x00, 0x00, 0x29, 0x3b, 0x3f, 0x3b, 0x29, 0x00, 0x00, 0x00, 0x00 },	// U+23ED (⏭)
 	{ 0x00, 0x00, 0x00, 0x00, 0x25, 0x37, 0x3f, 0x37, 0x25, 0x00, 0x00, 0x00, 0x00 },	// U+23EE (⏮)
 	{ 0x00, 0x00, 0x00, 0x00, 0x29, 0x2b, 0x2f, 0x2b, 0x29, 0x00, 0x00, 0x00, 0x00 },	// U+23EF (⏯)
-}; // 7
-
-static const unsigned char tewi_block110[][13] = {
 	{ 0x00, 0x00, 0x03, 0x05, 0x03, 0x05, 0x03, 0x1c, 0x0c, 0x10, 0x1c, 0x00, 0x00 },	// U+2408 (␈)
 	{ 0x00, 0x00, 0x05, 0x07, 0x05, 0x05, 0x00, 0x1c, 0x08, 0x08, 0x08, 0x00, 0x00 },	// U+2409 (␉)
 	{ 0x00, 0x00, 0x01, 0x01, 0x01, 0x07, 0x00, 0x1c, 0x04, 0x0c, 0x04, 0x00, 0x00 },	// U+240A (␊)
@@ -2633,16 +2306,10 @@ static const unsigned char tewi_block110[][13] = {
 	{ 0x00, 0x00, 0x06, 0x01, 0x01, 0x06, 0x00, 0x0c, 0x14, 0x0c, 0x14, 0x00, 0x00 },	// U+240D (␍)
 	{ 0x00, 0x00, 0x07, 0x02, 0x04, 0x03, 0x00, 0x1c, 0x08, 0x10, 0x0c, 0x00, 0x00 },	// U+240E (␎)
 	{ 0x00, 0x00, 0x07, 0x02, 0x04, 0x03, 0x00, 0x08, 0x08, 0x08, 0x08, 0x00, 0x00 },	// U+240F (␏)
-}; // 8
-
-static const unsigned char tewi_block111[][13] = {
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x11, 0x1f, 0x00, 0x00 },	// U+2423 (␣)
 	{ 0x00, 0x00, 0x09, 0x0b, 0x0d, 0x09, 0x00, 0x04, 0x04, 0x04, 0x1c, 0x00, 0x00 },	// U+2424 (␤)
 	{ 0x00, 0x00, 0x24, 0x12, 0x09, 0x24, 0x12, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+2425 (␥)
 	{ 0x00, 0x00, 0x0e, 0x11, 0x01, 0x02, 0x04, 0x04, 0x00, 0x04, 0x00, 0x00, 0x00 },	// U+2426 (␦)
-}; // 4
-
-static const unsigned char tewi_block112[][13] = {
 	{ 0x00, 0x00, 0x00, 0x1c, 0x14, 0x14, 0x04, 0x05, 0x05, 0x07, 0x00, 0x00, 0x00 },	// U+2440 (⑀)
 	{ 0x00, 0x00, 0x00, 0x10, 0x10, 0x10, 0x1f, 0x11, 0x11, 0x11, 0x00, 0x00, 0x00 },	// U+2441 (⑁)
 	{ 0x00, 0x00, 0x00, 0x11, 0x11, 0x11, 0x1f, 0x04, 0x04, 0x04, 0x00, 0x00, 0x00 },	// U+2442 (⑂)
@@ -2654,9 +2321,6 @@ static const unsigned char tewi_block112[][13] = {
 	{ 0x00, 0x00, 0x00, 0x30, 0x35, 0x35, 0x35, 0x05, 0x05, 0x05, 0x00, 0x00, 0x00 },	// U+2448 (⑈)
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x2b, 0x2b, 0x2b, 0x2b, 0x00, 0x00, 0x00, 0x00 },	// U+2449 (⑉)
 	{ 0x00, 0x08, 0x18, 0x14, 0x0c, 0x0a, 0x06, 0x05, 0x03, 0x02, 0x00, 0x00, 0x00 },	// U+244A (⑊)
-}; // 11
-
-static const unsigned char tewi_block113[][13] = {
 	{ 0x00, 0x00, 0x0e, 0x11, 0x15, 0x17, 0x15, 0x15, 0x1f, 0x11, 0x0e, 0x00, 0x00 },	// U+2460 (①)
 	{ 0x00, 0x00, 0x0e, 0x11, 0x15, 0x1b, 0x19, 0x15, 0x1f, 0x11, 0x0e, 0x00, 0x00 },	// U+2461 (②)
 	{ 0x00, 0x00, 0x0e, 0x11, 0x17, 0x19, 0x15, 0x19, 0x17, 0x11, 0x0e, 0x00, 0x00 },	// U+2462 (③)
@@ -2743,9 +2407,6 @@ static const unsigned char tewi_block113[][13] = {
 	{ 0x00, 0x00, 0x0a, 0x11, 0x11, 0x11, 0x1b, 0x15, 0x1b, 0x11, 0x0a, 0x00, 0x00 },	// U+24B3 (⒳)
 	{ 0x00, 0x00, 0x0a, 0x11, 0x11, 0x11, 0x1b, 0x15, 0x15, 0x13, 0x0a, 0x00, 0x00 },	// U+24B4 (⒴)
 	{ 0x00, 0x00, 0x0a, 0x11, 0x11, 0x1f, 0x19, 0x13, 0x1f, 0x11, 0x0a, 0x00, 0x00 },	// U+24B5 (⒵)
-}; // 86
-
-static const unsigned char tewi_block114[][13] = {
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+2500 (─)
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x3f, 0x3f, 0x3f, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+2501 (━)
 	{ 0x00, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04 },	// U+2502 (│)
@@ -3012,27 +2673,12 @@ static const unsigned char tewi_block114[][13] = {
 	{ 0x00, 0x00, 0x00, 0x08, 0x04, 0x02, 0x01, 0x0a, 0x0c, 0x0e, 0x00, 0x00, 0x00 },	// U+2607 (☇)
 	{ 0x00, 0x00, 0x00, 0x1f, 0x11, 0x09, 0x05, 0x15, 0x19, 0x1d, 0x00, 0x00, 0x00 },	// U+2608 (☈)
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x0e, 0x11, 0x15, 0x11, 0x0e, 0x00, 0x00, 0x00 },	// U+2609 (☉)
-}; // 266
-
-static const unsigned char tewi_block115[][13] = {
 	{ 0x00, 0x00, 0x00, 0x00, 0x3f, 0x21, 0x21, 0x21, 0x21, 0x3f, 0x00, 0x00, 0x00 },	// U+2610 (☐)
 	{ 0x00, 0x00, 0x00, 0x00, 0x3f, 0x31, 0x29, 0x2b, 0x25, 0x3f, 0x00, 0x00, 0x00 },	// U+2611 (☑)
-}; // 2
-
-static const unsigned char tewi_block116[][13] = {
 	{ 0x00, 0x04, 0x15, 0x11, 0x0e, 0x1f, 0x04, 0x04, 0x04, 0x02, 0x00, 0x00, 0x00 },	// U+2614 (☔)
-}; // 1
-
-static const unsigned char tewi_block117[][13] = {
 	{ 0x00, 0x00, 0x00, 0x04, 0x0a, 0x11, 0x11, 0x11, 0x11, 0x1f, 0x00, 0x00, 0x00 },	// U+2616 (☖)
 	{ 0x00, 0x00, 0x00, 0x04, 0x0e, 0x1f, 0x1f, 0x1f, 0x1f, 0x1f, 0x00, 0x00, 0x00 },	// U+2617 (☗)
-}; // 2
-
-static const unsigned char tewi_block118[][13] = {
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1f, 0x0b, 0x0b, 0x07, 0x00, 0x00, 0x00 },	// U+261E (☞)
-}; // 1
-
-static const unsigned char tewi_block119[][13] = {
 	{ 0x00, 0x00, 0x1f, 0x1f, 0x00, 0x1f, 0x1f, 0x00, 0x1f, 0x1f, 0x00, 0x00, 0x00 },	// U+2630 (☰)
 	{ 0x00, 0x00, 0x1b, 0x1b, 0x00, 0x1f, 0x1f, 0x00, 0x1f, 0x1f, 0x00, 0x00, 0x00 },	// U+2631 (☱)
 	{ 0x00, 0x00, 0x1f, 0x1f, 0x00, 0x1b, 0x1b, 0x00, 0x1f, 0x1f, 0x00, 0x00, 0x00 },	// U+2632 (☲)
@@ -3041,22 +2687,13 @@ static const unsigned char tewi_block119[][13] = {
 	{ 0x00, 0x00, 0x1b, 0x1b, 0x00, 0x1f, 0x1f, 0x00, 0x1b, 0x1b, 0x00, 0x00, 0x00 },	// U+2635 (☵)
 	{ 0x00, 0x00, 0x1f, 0x1f, 0x00, 0x1b, 0x1b, 0x00, 0x1b, 0x1b, 0x00, 0x00, 0x00 },	// U+2636 (☶)
 	{ 0x00, 0x00, 0x1b, 0x1b, 0x00, 0x1b, 0x1b, 0x00, 0x1b, 0x1b, 0x00, 0x00, 0x00 },	// U+2637 (☷)
-}; // 8
-
-static const unsigned char tewi_block120[][13] = {
 	{ 0x00, 0x00, 0x00, 0x0e, 0x11, 0x1b, 0x11, 0x1b, 0x15, 0x0e, 0x00, 0x00, 0x00 },	// U+263A (☺)
 	{ 0x00, 0x00, 0x00, 0x0e, 0x1f, 0x15, 0x1f, 0x15, 0x1b, 0x0e, 0x00, 0x00, 0x00 },	// U+263B (☻)
 	{ 0x00, 0x00, 0x00, 0x04, 0x15, 0x0a, 0x11, 0x0a, 0x15, 0x04, 0x00, 0x00, 0x00 },	// U+263C (☼)
-}; // 3
-
-static const unsigned char tewi_block121[][13] = {
 	{ 0x00, 0x00, 0x00, 0x00, 0x11, 0x0e, 0x11, 0x11, 0x11, 0x0e, 0x04, 0x0e, 0x04 },	// U+263F (☿)
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x0e, 0x11, 0x11, 0x11, 0x0e, 0x04, 0x0e, 0x04 },	// U+2640 (♀)
 	{ 0x00, 0x00, 0x04, 0x0e, 0x04, 0x0e, 0x11, 0x11, 0x11, 0x0e, 0x00, 0x00, 0x00 },	// U+2641 (♁)
 	{ 0x00, 0x00, 0x00, 0x38, 0x30, 0x2e, 0x11, 0x11, 0x11, 0x0e, 0x00, 0x00, 0x00 },	// U+2642 (♂)
-}; // 4
-
-static const unsigned char tewi_block122[][13] = {
 	{ 0x00, 0x00, 0x00, 0x04, 0x04, 0x0e, 0x1f, 0x1f, 0x0e, 0x04, 0x0e, 0x00, 0x00 },	// U+2660 (♠)
 	{ 0x00, 0x00, 0x00, 0x00, 0x0a, 0x15, 0x11, 0x0a, 0x04, 0x00, 0x00, 0x00, 0x00 },	// U+2661 (♡)
 	{ 0x00, 0x00, 0x00, 0x00, 0x04, 0x0a, 0x11, 0x11, 0x0a, 0x04, 0x00, 0x00, 0x00 },	// U+2662 (♢)
@@ -3073,9 +2710,6 @@ static const unsigned char tewi_block122[][13] = {
 	{ 0x00, 0x00, 0x00, 0x02, 0x02, 0x0a, 0x16, 0x12, 0x0a, 0x06, 0x00, 0x00, 0x00 },	// U+266D (♭)
 	{ 0x00, 0x00, 0x00, 0x02, 0x12, 0x1a, 0x16, 0x1a, 0x16, 0x12, 0x10, 0x00, 0x00 },	// U+266E (♮)
 	{ 0x00, 0x00, 0x00, 0x08, 0x1a, 0x0e, 0x0b, 0x1a, 0x0e, 0x0b, 0x02, 0x00, 0x00 },	// U+266F (♯)
-}; // 16
-
-static const unsigned char tewi_block123[][13] = {
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x0e, 0x15, 0x15, 0x0e, 0x0a, 0x1f, 0x0a, 0x00 },	// U+26A2 (⚢)
 	{ 0x00, 0x00, 0x00, 0x0c, 0x08, 0x36, 0x29, 0x15, 0x12, 0x0c, 0x00, 0x00, 0x00 },	// U+26A3 (⚣)
 	{ 0x00, 0x00, 0x38, 0x30, 0x2c, 0x12, 0x15, 0x09, 0x06, 0x02, 0x07, 0x02, 0x00 },	// U+26A4 (⚤)
@@ -3084,22 +2718,13 @@ static const unsigned char tewi_block123[][13] = {
 	{ 0x00, 0x03, 0x37, 0x32, 0x1d, 0x22, 0x22, 0x22, 0x1c, 0x08, 0x1c, 0x08, 0x00 },	// U+26A7 (⚧)
 	{ 0x00, 0x04, 0x0e, 0x04, 0x0e, 0x04, 0x0e, 0x11, 0x11, 0x11, 0x0e, 0x00, 0x00 },	// U+26A8 (⚨)
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x15, 0x3d, 0x15, 0x02, 0x00, 0x00, 0x00 },	// U+26A9 (⚩)
-}; // 8
-
-static const unsigned char tewi_block124[][13] = {
 	{ 0x00, 0x00, 0x00, 0x00, 0x04, 0x0d, 0x3f, 0x0d, 0x04, 0x00, 0x00, 0x00, 0x00 },	// U+2708 (✈)
-}; // 1
-
-static const unsigned char tewi_block125[][13] = {
 	{ 0x00, 0x00, 0x00, 0x10, 0x08, 0x08, 0x05, 0x05, 0x02, 0x02, 0x00, 0x00, 0x00 },	// U+2713 (✓)
 	{ 0x00, 0x00, 0x00, 0x20, 0x30, 0x10, 0x1b, 0x0a, 0x0e, 0x04, 0x00, 0x00, 0x00 },	// U+2714 (✔)
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x0a, 0x04, 0x0a, 0x11, 0x00, 0x00, 0x00 },	// U+2715 (✕)
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x1b, 0x0a, 0x04, 0x0a, 0x1b, 0x00, 0x00, 0x00 },	// U+2716 (✖)
 	{ 0x00, 0x00, 0x00, 0x10, 0x12, 0x0a, 0x04, 0x0a, 0x09, 0x01, 0x00, 0x00, 0x00 },	// U+2717 (✗)
 	{ 0x00, 0x00, 0x00, 0x10, 0x1a, 0x0e, 0x04, 0x0e, 0x0b, 0x01, 0x00, 0x00, 0x00 },	// U+2718 (✘)
-}; // 6
-
-static const unsigned char tewi_block126[][13] = {
 	{ 0x00, 0x00, 0x00, 0x00, 0x0c, 0x0c, 0x3f, 0x3f, 0x0c, 0x0c, 0x00, 0x00, 0x00 },	// U+271A (✚)
 	{ 0x00, 0x00, 0x00, 0x00, 0x04, 0x04, 0x1b, 0x04, 0x04, 0x00, 0x00, 0x00, 0x00 },	// U+271B (✛)
 	{ 0x00, 0x00, 0x00, 0x00, 0x0c, 0x0c, 0x33, 0x33, 0x0c, 0x0c, 0x00, 0x00, 0x00 },	// U+271C (✜)
@@ -3108,69 +2733,36 @@ static const unsigned char tewi_block126[][13] = {
 	{ 0x00, 0x00, 0x00, 0x0e, 0x1b, 0x11, 0x1b, 0x0a, 0x0a, 0x0e, 0x00, 0x00, 0x00 },	// U+271F (✟)
 	{ 0x00, 0x00, 0x00, 0x00, 0x0e, 0x04, 0x15, 0x1f, 0x15, 0x04, 0x0e, 0x00, 0x00 },	// U+2720 (✠)
 	{ 0x00, 0x00, 0x00, 0x00, 0x04, 0x1f, 0x0a, 0x0a, 0x1f, 0x04, 0x00, 0x00, 0x00 },	// U+2721 (✡)
-}; // 8
-
-static const unsigned char tewi_block127[][13] = {
 	{ 0x00, 0x00, 0x00, 0x0c, 0x1e, 0x0c, 0x3f, 0x3f, 0x0c, 0x1e, 0x0c, 0x00, 0x00 },	// U+2724 (✤)
 	{ 0x00, 0x00, 0x00, 0x00, 0x04, 0x0e, 0x15, 0x1f, 0x15, 0x0e, 0x04, 0x00, 0x00 },	// U+2725 (✥)
 	{ 0x00, 0x00, 0x00, 0x00, 0x04, 0x0e, 0x1f, 0x0e, 0x04, 0x00, 0x00, 0x00, 0x00 },	// U+2726 (✦)
 	{ 0x00, 0x00, 0x00, 0x00, 0x04, 0x0a, 0x11, 0x0a, 0x04, 0x00, 0x00, 0x00, 0x00 },	// U+2727 (✧)
-}; // 4
-
-static const unsigned char tewi_block128[][13] = {
 	{ 0x00, 0x00, 0x00, 0x00, 0x04, 0x04, 0x1b, 0x0e, 0x11, 0x00, 0x00, 0x00, 0x00 },	// U+2729 (✩)
 	{ 0x00, 0x00, 0x00, 0x00, 0x0e, 0x1b, 0x11, 0x1b, 0x15, 0x0e, 0x00, 0x00, 0x00 },	// U+272A (✪)
 	{ 0x00, 0x00, 0x00, 0x00, 0x04, 0x04, 0x1b, 0x0e, 0x11, 0x00, 0x00, 0x00, 0x00 },	// U+272B (✫)
-}; // 3
-
-static const unsigned char tewi_block129[][13] = {
 	{ 0x00, 0x00, 0x00, 0x04, 0x15, 0x0e, 0x1f, 0x0e, 0x15, 0x04, 0x00, 0x00, 0x00 },	// U+2733 (✳)
-}; // 1
-
-static const unsigned char tewi_block130[][13] = {
 	{ 0x00, 0x00, 0x00, 0x00, 0x04, 0x15, 0x0e, 0x0e, 0x15, 0x04, 0x00, 0x00, 0x00 },	// U+2736 (✶)
-}; // 1
-
-static const unsigned char tewi_block131[][13] = {
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x1b, 0x1f, 0x0a, 0x1f, 0x1b, 0x00, 0x00, 0x00 },	// U+273F (✿)
-}; // 1
-
-static const unsigned char tewi_block132[][13] = {
 	{ 0x00, 0x00, 0x00, 0x00, 0x15, 0x0e, 0x1b, 0x0e, 0x15, 0x00, 0x00, 0x00, 0x00 },	// U+2741 (❁)
-}; // 1
-
-static const unsigned char tewi_block133[][13] = {
 	{ 0x00, 0x00, 0x00, 0x1f, 0x31, 0x31, 0x31, 0x3f, 0x3e, 0x00, 0x00, 0x00, 0x00 },	// U+274F (❏)
 	{ 0x00, 0x00, 0x00, 0x3e, 0x3f, 0x31, 0x31, 0x31, 0x1f, 0x00, 0x00, 0x00, 0x00 },	// U+2750 (❐)
 	{ 0x00, 0x00, 0x00, 0x1f, 0x31, 0x31, 0x31, 0x3f, 0x3e, 0x00, 0x00, 0x00, 0x00 },	// U+2751 (❑)
 	{ 0x00, 0x00, 0x00, 0x3e, 0x3f, 0x31, 0x31, 0x31, 0x1f, 0x00, 0x00, 0x00, 0x00 },	// U+2752 (❒)
-}; // 4
-
-static const unsigned char tewi_block134[][13] = {
 	{ 0x00, 0x00, 0x00, 0x08, 0x04, 0x0c, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+275B (❛)
 	{ 0x00, 0x00, 0x0c, 0x0c, 0x08, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+275C (❜)
 	{ 0x00, 0x00, 0x00, 0x12, 0x09, 0x1b, 0x1b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+275D (❝)
 	{ 0x00, 0x00, 0x1b, 0x1b, 0x12, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+275E (❞)
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x03, 0x02, 0x01, 0x00 },	// U+275F (❟)
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1b, 0x1b, 0x12, 0x09, 0x00 },	// U+2760 (❠)
-}; // 6
-
-static const unsigned char tewi_block135[][13] = {
 	{ 0x00, 0x00, 0x00, 0x00, 0x0a, 0x1f, 0x1f, 0x0e, 0x04, 0x00, 0x00, 0x00, 0x00 },	// U+2764 (❤)
 	{ 0x00, 0x00, 0x00, 0x00, 0x06, 0x0f, 0x1e, 0x0f, 0x06, 0x00, 0x00, 0x00, 0x00 },	// U+2765 (❥)
 	{ 0x00, 0x00, 0x26, 0x1d, 0x04, 0x1b, 0x1f, 0x0f, 0x27, 0x1e, 0x00, 0x00, 0x00 },	// U+2766 (❦)
-}; // 3
-
-static const unsigned char tewi_block136[][13] = {
 	{ 0x00, 0x00, 0x00, 0x18, 0x0c, 0x06, 0x03, 0x06, 0x0c, 0x18, 0x00, 0x00, 0x00 },	// U+276C (❬)
 	{ 0x00, 0x00, 0x00, 0x03, 0x06, 0x0c, 0x18, 0x0c, 0x06, 0x03, 0x00, 0x00, 0x00 },	// U+276D (❭)
 	{ 0x00, 0x00, 0x00, 0x38, 0x1c, 0x0e, 0x07, 0x07, 0x0e, 0x1c, 0x38, 0x00, 0x00 },	// U+276E (❮)
 	{ 0x00, 0x00, 0x00, 0x07, 0x0e, 0x1c, 0x38, 0x38, 0x1c, 0x0e, 0x07, 0x00, 0x00 },	// U+276F (❯)
 	{ 0x00, 0x00, 0x00, 0x3c, 0x1e, 0x0f, 0x07, 0x0f, 0x1e, 0x3c, 0x00, 0x00, 0x00 },	// U+2770 (❰)
 	{ 0x00, 0x00, 0x00, 0x0f, 0x1e, 0x3c, 0x38, 0x3c, 0x1e, 0x0f, 0x00, 0x00, 0x00 },	// U+2771 (❱)
-}; // 6
-
-static const unsigned char tewi_block137[][13] = {
 	{ 0x00, 0x00, 0x00, 0x1e, 0x33, 0x37, 0x37, 0x37, 0x37, 0x23, 0x1e, 0x00, 0x00 },	// U+278A (➊)
 	{ 0x00, 0x00, 0x00, 0x1e, 0x33, 0x2d, 0x2f, 0x37, 0x3b, 0x21, 0x1e, 0x00, 0x00 },	// U+278B (➋)
 	{ 0x00, 0x00, 0x00, 0x1e, 0x31, 0x2f, 0x33, 0x2f, 0x2f, 0x31, 0x1e, 0x00, 0x00 },	// U+278C (➌)
@@ -3189,29 +2781,14 @@ static const unsigned char tewi_block137[][13] = {
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x1f, 0x08, 0x00, 0x00, 0x00, 0x00 },	// U+2799 (➙)
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x1c, 0x18, 0x14, 0x02, 0x01, 0x00, 0x00, 0x00 },	// U+279A (➚)
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x0c, 0x3f, 0x0c, 0x02, 0x00, 0x00, 0x00 },	// U+279B (➛)
-}; // 18
-
-static const unsigned char tewi_block138[][13] = {
 	{ 0x00, 0x00, 0x08, 0x08, 0x04, 0x04, 0x02, 0x02, 0x04, 0x04, 0x08, 0x08, 0x00 },	// U+27E8 (⟨)
 	{ 0x00, 0x00, 0x04, 0x04, 0x08, 0x08, 0x10, 0x10, 0x08, 0x08, 0x04, 0x04, 0x00 },	// U+27E9 (⟩)
-}; // 2
-
-static const unsigned char tewi_block139[][13] = {
 	{ 0x00, 0x00, 0x00, 0x0e, 0x11, 0x11, 0x15, 0x06, 0x07, 0x00, 0x00, 0x00, 0x00 },	// U+27F2 (⟲)
 	{ 0x00, 0x00, 0x00, 0x0e, 0x11, 0x11, 0x15, 0x0c, 0x1c, 0x00, 0x00, 0x00, 0x00 },	// U+27F3 (⟳)
-}; // 2
-
-static const unsigned char tewi_block140[][13] = {
 	{ 0x00, 0x00, 0x00, 0x00, 0x04, 0x02, 0x3f, 0x02, 0x04, 0x00, 0x00, 0x00, 0x00 },	// U+27F5 (⟵)
 	{ 0x00, 0x00, 0x00, 0x00, 0x08, 0x10, 0x3f, 0x10, 0x08, 0x00, 0x00, 0x00, 0x00 },	// U+27F6 (⟶)
-}; // 2
-
-static const unsigned char tewi_block141[][13] = {
 	{ 0x00, 0x00, 0x00, 0x00, 0x04, 0x3e, 0x01, 0x3e, 0x04, 0x00, 0x00, 0x00, 0x00 },	// U+27F8 (⟸)
 	{ 0x00, 0x00, 0x00, 0x00, 0x08, 0x1f, 0x20, 0x1f, 0x08, 0x00, 0x00, 0x00, 0x00 },	// U+27F9 (⟹)
-}; // 2
-
-static const unsigned char tewi_block142[][13] = {
 	{ 0x00, 0x00, 0x00, 0x00, 0x24, 0x22, 0x3f, 0x22, 0x24, 0x00, 0x00, 0x00, 0x00 },	// U+27FB (⟻)
 	{ 0x00, 0x00, 0x00, 0x00, 0x09, 0x11, 0x3f, 0x11, 0x09, 0x00, 0x00, 0x00, 0x00 },	// U+27FC (⟼)
 	{ 0x00, 0x00, 0x00, 0x00, 0x24, 0x3e, 0x21, 0x3e, 0x24, 0x00, 0x00, 0x00, 0x00 },	// U+27FD (⟽)
@@ -3473,51 +3050,30 @@ static const unsigned char tewi_block142[][13] = {
 	{ 0x00, 0x1b, 0x1b, 0x00, 0x18, 0x18, 0x00, 0x1b, 0x1b, 0x00, 0x1b, 0x1b, 0x00 },	// U+28FD (⣽)
 	{ 0x00, 0x18, 0x18, 0x00, 0x1b, 0x1b, 0x00, 0x1b, 0x1b, 0x00, 0x1b, 0x1b, 0x00 },	// U+28FE (⣾)
 	{ 0x00, 0x1b, 0x1b, 0x00, 0x1b, 0x1b, 0x00, 0x1b, 0x1b, 0x00, 0x1b, 0x1b, 0x00 },	// U+28FF (⣿)
-}; // 261
-
-static const unsigned char tewi_block143[][13] = {
 	{ 0x00, 0x00, 0x00, 0x00, 0x14, 0x3e, 0x11, 0x3e, 0x14, 0x00, 0x00, 0x00, 0x00 },	// U+2902 (⤂)
 	{ 0x00, 0x00, 0x00, 0x00, 0x0a, 0x1f, 0x22, 0x1f, 0x0a, 0x00, 0x00, 0x00, 0x00 },	// U+2903 (⤃)
-}; // 2
-
-static const unsigned char tewi_block144[][13] = {
 	{ 0x00, 0x00, 0x00, 0x00, 0x14, 0x1e, 0x11, 0x1e, 0x14, 0x00, 0x00, 0x00, 0x00 },	// U+2906 (⤆)
 	{ 0x00, 0x00, 0x00, 0x00, 0x05, 0x0f, 0x11, 0x0f, 0x05, 0x00, 0x00, 0x00, 0x00 },	// U+2907 (⤇)
 	{ 0x00, 0x00, 0x00, 0x04, 0x1f, 0x04, 0x15, 0x0e, 0x04, 0x00, 0x00, 0x00, 0x00 },	// U+2908 (⤈)
 	{ 0x00, 0x00, 0x00, 0x04, 0x0e, 0x15, 0x04, 0x1f, 0x04, 0x00, 0x00, 0x00, 0x00 },	// U+2909 (⤉)
-}; // 4
-
-static const unsigned char tewi_block145[][13] = {
 	{ 0x00, 0x00, 0x00, 0x00, 0x04, 0x02, 0x37, 0x02, 0x04, 0x00, 0x00, 0x00, 0x00 },	// U+290C (⤌)
 	{ 0x00, 0x00, 0x00, 0x00, 0x08, 0x10, 0x3b, 0x10, 0x08, 0x00, 0x00, 0x00, 0x00 },	// U+290D (⤍)
 	{ 0x00, 0x00, 0x00, 0x00, 0x04, 0x02, 0x2b, 0x02, 0x04, 0x00, 0x00, 0x00, 0x00 },	// U+290E (⤎)
 	{ 0x00, 0x00, 0x00, 0x00, 0x08, 0x10, 0x35, 0x10, 0x08, 0x00, 0x00, 0x00, 0x00 },	// U+290F (⤏)
-}; // 4
-
-static const unsigned char tewi_block146[][13] = {
 	{ 0x00, 0x00, 0x00, 0x00, 0x1f, 0x0e, 0x15, 0x04, 0x04, 0x00, 0x00, 0x00, 0x00 },	// U+2912 (⤒)
 	{ 0x00, 0x00, 0x00, 0x00, 0x04, 0x04, 0x15, 0x0e, 0x1f, 0x00, 0x00, 0x00, 0x00 },	// U+2913 (⤓)
-}; // 2
-
-static const unsigned char tewi_block147[][13] = {
 	{ 0x00, 0x00, 0x00, 0x00, 0x10, 0x08, 0x07, 0x08, 0x10, 0x00, 0x00, 0x00, 0x00 },	// U+2919 (⤙)
 	{ 0x00, 0x00, 0x00, 0x00, 0x01, 0x02, 0x1c, 0x02, 0x01, 0x00, 0x00, 0x00, 0x00 },	// U+291A (⤚)
 	{ 0x00, 0x00, 0x00, 0x00, 0x28, 0x14, 0x0f, 0x14, 0x28, 0x00, 0x00, 0x00, 0x00 },	// U+291B (⤛)
 	{ 0x00, 0x00, 0x00, 0x00, 0x05, 0x0a, 0x3c, 0x0a, 0x05, 0x00, 0x00, 0x00, 0x00 },	// U+291C (⤜)
 	{ 0x00, 0x00, 0x00, 0x00, 0x10, 0x0a, 0x3f, 0x0a, 0x10, 0x00, 0x00, 0x00, 0x00 },	// U+291D (⤝)
 	{ 0x00, 0x00, 0x00, 0x00, 0x02, 0x14, 0x3f, 0x14, 0x02, 0x00, 0x00, 0x00, 0x00 },	// U+291E (⤞)
-}; // 6
-
-static const unsigned char tewi_block148[][13] = {
 	{ 0x00, 0x00, 0x00, 0x00, 0x07, 0x03, 0x15, 0x18, 0x1c, 0x00, 0x00, 0x00, 0x00 },	// U+2921 (⤡)
 	{ 0x00, 0x00, 0x00, 0x00, 0x1c, 0x18, 0x15, 0x03, 0x07, 0x00, 0x00, 0x00, 0x00 },	// U+2922 (⤢)
 	{ 0x00, 0x00, 0x00, 0x00, 0x07, 0x03, 0x05, 0x08, 0x0a, 0x04, 0x00, 0x00, 0x00 },	// U+2923 (⤣)
 	{ 0x00, 0x00, 0x00, 0x00, 0x1c, 0x18, 0x14, 0x02, 0x0a, 0x04, 0x00, 0x00, 0x00 },	// U+2924 (⤤)
 	{ 0x00, 0x00, 0x00, 0x04, 0x0a, 0x02, 0x14, 0x18, 0x1c, 0x00, 0x00, 0x00, 0x00 },	// U+2925 (⤥)
 	{ 0x00, 0x00, 0x00, 0x04, 0x0a, 0x08, 0x05, 0x03, 0x07, 0x00, 0x00, 0x00, 0x00 },	// U+2926 (⤦)
-}; // 6
-
-static const unsigned char tewi_block149[][13] = {
 	{ 0x00, 0x00, 0x00, 0x00, 0x08, 0x16, 0x39, 0x10, 0x08, 0x00, 0x00, 0x00, 0x00 },	// U+2933 (⤳)
 	{ 0x00, 0x00, 0x00, 0x08, 0x1c, 0x2a, 0x08, 0x04, 0x03, 0x00, 0x00, 0x00, 0x00 },	// U+2934 (⤴)
 	{ 0x00, 0x00, 0x00, 0x03, 0x04, 0x08, 0x2a, 0x1c, 0x08, 0x00, 0x00, 0x00, 0x00 },	// U+2935 (⤵)
@@ -3538,21 +3094,12 @@ static const unsigned char tewi_block149[][13] = {
 	{ 0x00, 0x00, 0x04, 0x08, 0x1c, 0x08, 0x04, 0x02, 0x1f, 0x02, 0x04, 0x00, 0x00 },	// U+2944 (⥄)
 	{ 0x00, 0x00, 0x00, 0x00, 0x04, 0x08, 0x1f, 0x0a, 0x07, 0x02, 0x00, 0x00, 0x00 },	// U+2945 (⥅)
 	{ 0x00, 0x00, 0x00, 0x00, 0x04, 0x02, 0x1f, 0x0a, 0x1c, 0x08, 0x00, 0x00, 0x00 },	// U+2946 (⥆)
-}; // 20
-
-static const unsigned char tewi_block150[][13] = {
 	{ 0x00, 0x00, 0x00, 0x04, 0x0e, 0x15, 0x0e, 0x15, 0x04, 0x0a, 0x04, 0x00, 0x00 },	// U+2949 (⥉)
 	{ 0x00, 0x00, 0x00, 0x00, 0x04, 0x02, 0x1f, 0x08, 0x04, 0x00, 0x00, 0x00, 0x00 },	// U+294A (⥊)
 	{ 0x00, 0x00, 0x00, 0x00, 0x04, 0x08, 0x1f, 0x02, 0x04, 0x00, 0x00, 0x00, 0x00 },	// U+294B (⥋)
 	{ 0x00, 0x00, 0x00, 0x04, 0x0c, 0x14, 0x05, 0x06, 0x04, 0x00, 0x00, 0x00, 0x00 },	// U+294C (⥌)
 	{ 0x00, 0x00, 0x00, 0x04, 0x06, 0x05, 0x14, 0x0c, 0x04, 0x00, 0x00, 0x00, 0x00 },	// U+294D (⥍)
-}; // 5
-
-static const unsigned char tewi_block151[][13] = {
 	{ 0x00, 0x00, 0x00, 0x04, 0x0c, 0x14, 0x04, 0x14, 0x0c, 0x04, 0x00, 0x00, 0x00 },	// U+294F (⥏)
-}; // 1
-
-static const unsigned char tewi_block152[][13] = {
 	{ 0x00, 0x00, 0x00, 0x04, 0x06, 0x05, 0x04, 0x05, 0x06, 0x04, 0x00, 0x00, 0x00 },	// U+2951 (⥑)
 	{ 0x00, 0x00, 0x00, 0x00, 0x05, 0x03, 0x1f, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00 },	// U+2952 (⥒)
 	{ 0x00, 0x00, 0x00, 0x00, 0x14, 0x18, 0x1f, 0x10, 0x10, 0x00, 0x00, 0x00, 0x00 },	// U+2953 (⥓)
@@ -3591,9 +3138,6 @@ static const unsigned char tewi_block152[][13] = {
 	{ 0x00, 0x00, 0x00, 0x00, 0x04, 0x08, 0x1f, 0x08, 0x0e, 0x05, 0x00, 0x00, 0x00 },	// U+2974 (⥴)
 	{ 0x00, 0x00, 0x00, 0x00, 0x04, 0x08, 0x1f, 0x08, 0x0e, 0x05, 0x0a, 0x05, 0x00 },	// U+2975 (⥵)
 	{ 0x00, 0x00, 0x18, 0x06, 0x01, 0x06, 0x1c, 0x02, 0x1f, 0x02, 0x04, 0x00, 0x00 },	// U+2976 (⥶)
-}; // 38
-
-static const unsigned char tewi_block153[][13] = {
 	{ 0x00, 0x00, 0x03, 0x0c, 0x10, 0x0c, 0x07, 0x08, 0x1f, 0x08, 0x04, 0x00, 0x00 },	// U+2978 (⥸)
 	{ 0x00, 0x00, 0x1e, 0x01, 0x01, 0x1e, 0x04, 0x08, 0x1f, 0x08, 0x04, 0x00, 0x00 },	// U+2979 (⥹)
 	{ 0x00, 0x00, 0x00, 0x00, 0x34, 0x0a, 0x3f, 0x0a, 0x34, 0x00, 0x00, 0x00, 0x00 },	// U+297A (⥺)
@@ -3602,16 +3146,10 @@ static const unsigned char tewi_block153[][13] = {
 	{ 0x00, 0x00, 0x00, 0x08, 0x10, 0x08, 0x07, 0x08, 0x10, 0x08, 0x00, 0x00, 0x00 },	// U+297D (⥽)
 	{ 0x00, 0x00, 0x00, 0x00, 0x0a, 0x15, 0x04, 0x04, 0x04, 0x00, 0x00, 0x00, 0x00 },	// U+297E (⥾)
 	{ 0x00, 0x00, 0x00, 0x00, 0x04, 0x04, 0x04, 0x15, 0x0a, 0x00, 0x00, 0x00, 0x00 },	// U+297F (⥿)
-}; // 8
-
-static const unsigned char tewi_block154[][13] = {
 	{ 0x00, 0x00, 0x00, 0x00, 0x1e, 0x14, 0x1a, 0x15, 0x02, 0x00, 0x00, 0x00, 0x00 },	// U+2B00 (⬀)
 	{ 0x00, 0x00, 0x00, 0x00, 0x0f, 0x05, 0x0b, 0x15, 0x08, 0x00, 0x00, 0x00, 0x00 },	// U+2B01 (⬁)
 	{ 0x00, 0x00, 0x00, 0x00, 0x02, 0x15, 0x1a, 0x14, 0x1e, 0x00, 0x00, 0x00, 0x00 },	// U+2B02 (⬂)
 	{ 0x00, 0x00, 0x00, 0x00, 0x08, 0x15, 0x0b, 0x05, 0x0f, 0x00, 0x00, 0x00, 0x00 },	// U+2B03 (⬃)
-}; // 4
-
-static const unsigned char tewi_block155[][13] = {
 	{ 0x00, 0x00, 0x00, 0x00, 0x04, 0x1e, 0x1f, 0x1e, 0x04, 0x00, 0x00, 0x00, 0x00 },	// U+2B05 (⬅)
 	{ 0x00, 0x00, 0x00, 0x00, 0x04, 0x0e, 0x1f, 0x0e, 0x0e, 0x00, 0x00, 0x00, 0x00 },	// U+2B06 (⬆)
 	{ 0x00, 0x00, 0x00, 0x00, 0x0e, 0x0e, 0x1f, 0x0e, 0x04, 0x00, 0x00, 0x00, 0x00 },	// U+2B07 (⬇)
@@ -3619,9 +3157,6 @@ static const unsigned char tewi_block155[][13] = {
 	{ 0x00, 0x00, 0x00, 0x00, 0x0f, 0x07, 0x0f, 0x1d, 0x18, 0x10, 0x00, 0x00, 0x00 },	// U+2B09 (⬉)
 	{ 0x00, 0x00, 0x00, 0x01, 0x03, 0x17, 0x1e, 0x1c, 0x1e, 0x00, 0x00, 0x00, 0x00 },	// U+2B0A (⬊)
 	{ 0x00, 0x00, 0x00, 0x10, 0x18, 0x1d, 0x0f, 0x07, 0x0f, 0x00, 0x00, 0x00, 0x00 },	// U+2B0B (⬋)
-}; // 7
-
-static const unsigned char tewi_block156[][13] = {
 	{ 0x00, 0x00, 0x00, 0x04, 0x0e, 0x1f, 0x0e, 0x1f, 0x0e, 0x04, 0x00, 0x00, 0x00 },	// U+2B0D (⬍)
 	{ 0x00, 0x00, 0x00, 0x00, 0x0f, 0x08, 0x2a, 0x1c, 0x08, 0x00, 0x00, 0x00, 0x00 },	// U+2B0E (⬎)
 	{ 0x00, 0x00, 0x00, 0x00, 0x08, 0x1c, 0x2a, 0x08, 0x0f, 0x00, 0x00, 0x00, 0x00 },	// U+2B0F (⬏)
@@ -3660,13 +3195,7 @@ static const unsigned char tewi_block156[][13] = {
 	{ 0x00, 0x00, 0x00, 0x00, 0x04, 0x12, 0x2f, 0x12, 0x04, 0x00, 0x00, 0x00, 0x00 },	// U+2B30 (⬰)
 	{ 0x00, 0x00, 0x04, 0x02, 0x1f, 0x02, 0x1f, 0x02, 0x1f, 0x02, 0x04, 0x00, 0x00 },	// U+2B31 (⬱)
 	{ 0x00, 0x00, 0x00, 0x00, 0x04, 0x12, 0x2f, 0x02, 0x04, 0x00, 0x00, 0x00, 0x00 },	// U+2B32 (⬲)
-}; // 38
-
-static const unsigned char tewi_block157[][13] = {
 	{ 0x00, 0x00, 0x00, 0x00, 0x04, 0x02, 0x2b, 0x02, 0x04, 0x00, 0x00, 0x00, 0x00 },	// U+2B38 (⬸)
-}; // 1
-
-static const unsigned char tewi_block158[][13] = {
 	{ 0x00, 0x00, 0x00, 0x00, 0x04, 0x1a, 0x27, 0x02, 0x04, 0x00, 0x00, 0x00, 0x00 },	// U+2B3F (⬿)
 	{ 0x00, 0x00, 0x30, 0x00, 0x34, 0x02, 0x3f, 0x02, 0x04, 0x00, 0x00, 0x00, 0x00 },	// U+2B40 (⭀)
 	{ 0x00, 0x00, 0x00, 0x14, 0x2c, 0x02, 0x3f, 0x02, 0x04, 0x00, 0x00, 0x00, 0x00 },	// U+2B41 (⭁)
@@ -3690,13 +3219,7 @@ static const unsigned char tewi_block158[][13] = {
 	{ 0x00, 0x00, 0x00, 0x00, 0x06, 0x0f, 0x1f, 0x0f, 0x06, 0x00, 0x00, 0x00, 0x00 },	// U+2B53 (⭓)
 	{ 0x00, 0x00, 0x00, 0x00, 0x06, 0x09, 0x11, 0x09, 0x06, 0x00, 0x00, 0x00, 0x00 },	// U+2B54 (⭔)
 	{ 0x00, 0x00, 0x00, 0x00, 0x0e, 0x11, 0x11, 0x11, 0x0e, 0x00, 0x00, 0x00, 0x00 },	// U+2B55 (⭕)
-}; // 23
-
-static const unsigned char tewi_block159[][13] = {
 	{ 0x00, 0x00, 0x00, 0x00, 0x0e, 0x11, 0x11, 0x11, 0x0e, 0x00, 0x00, 0x00, 0x00 },	// U+2B58 (⭘)
-}; // 1
-
-static const unsigned char tewi_block160[][13] = {
 	{ 0x00, 0x00, 0x1c, 0x22, 0x2a, 0x1a, 0x3a, 0x01, 0x01, 0x01, 0x00, 0x00, 0x00 },	// U+2B5A (⭚)
 	{ 0x00, 0x00, 0x00, 0x02, 0x05, 0x05, 0x08, 0x2a, 0x1c, 0x08, 0x00, 0x00, 0x00 },	// U+2B5B (⭛)
 	{ 0x00, 0x00, 0x08, 0x1c, 0x2a, 0x08, 0x04, 0x04, 0x04, 0x03, 0x00, 0x00, 0x00 },	// U+2B5C (⭜)
@@ -3707,9 +3230,6 @@ static const unsigned char tewi_block160[][13] = {
 	{ 0x00, 0x00, 0x00, 0x00, 0x04, 0x0e, 0x1f, 0x04, 0x04, 0x00, 0x00, 0x00, 0x00 },	// U+2B61 (⭡)
 	{ 0x00, 0x00, 0x00, 0x00, 0x04, 0x0c, 0x1f, 0x0c, 0x04, 0x00, 0x00, 0x00, 0x00 },	// U+2B62 (⭢)
 	{ 0x00, 0x00, 0x00, 0x00, 0x04, 0x04, 0x1f, 0x0e, 0x04, 0x00, 0x00, 0x00, 0x00 },	// U+2B63 (⭣)
-}; // 10
-
-static const unsigned char tewi_block161[][13] = {
 	{ 0x00, 0x00, 0x00, 0x04, 0x0e, 0x1f, 0x04, 0x1f, 0x0e, 0x04, 0x00, 0x00, 0x00 },	// U+2B65 (⭥)
 	{ 0x00, 0x00, 0x00, 0x00, 0x0f, 0x07, 0x07, 0x09, 0x10, 0x00, 0x00, 0x00, 0x00 },	// U+2B66 (⭦)
 	{ 0x00, 0x00, 0x00, 0x00, 0x1e, 0x1c, 0x1c, 0x12, 0x01, 0x00, 0x00, 0x00, 0x00 },	// U+2B67 (⭧)
@@ -3725,28 +3245,13 @@ static const unsigned char tewi_block161[][13] = {
 	{ 0x00, 0x00, 0x00, 0x00, 0x1f, 0x0e, 0x1f, 0x04, 0x04, 0x00, 0x00, 0x00, 0x00 },	// U+2B71 (⭱)
 	{ 0x00, 0x00, 0x00, 0x00, 0x14, 0x1c, 0x1f, 0x1c, 0x14, 0x00, 0x00, 0x00, 0x00 },	// U+2B72 (⭲)
 	{ 0x00, 0x00, 0x00, 0x00, 0x04, 0x04, 0x1f, 0x0e, 0x1f, 0x00, 0x00, 0x00, 0x00 },	// U+2B73 (⭳)
-}; // 15
-
-static const unsigned char tewi_block162[][13] = {
 	{ 0x00, 0x00, 0x0f, 0x00, 0x0f, 0x07, 0x07, 0x09, 0x10, 0x00, 0x00, 0x00, 0x00 },	// U+2B76 (⭶)
 	{ 0x00, 0x00, 0x1e, 0x00, 0x1e, 0x1c, 0x1c, 0x12, 0x01, 0x00, 0x00, 0x00, 0x00 },	// U+2B77 (⭷)
 	{ 0x00, 0x00, 0x01, 0x12, 0x1c, 0x1c, 0x1e, 0x00, 0x1e, 0x00, 0x00, 0x00, 0x00 },	// U+2B78 (⭸)
 	{ 0x00, 0x00, 0x10, 0x09, 0x07, 0x07, 0x0f, 0x00, 0x0f, 0x00, 0x00, 0x00, 0x00 },	// U+2B79 (⭹)
-}; // 4
-
-static const unsigned char tewi_block163[][13] = {
 	{ 0x00, 0x00, 0x05, 0x07, 0x1f, 0x07, 0x15, 0x1c, 0x1f, 0x1c, 0x14, 0x00, 0x00 },	// U+2B7E (⭾)
-}; // 1
-
-static const unsigned char tewi_block164[][13] = {
 	{ 0x00, 0x00, 0x04, 0x06, 0x1f, 0x06, 0x04, 0x0c, 0x1f, 0x0c, 0x04, 0x00, 0x00 },	// U+2B80 (⮀)
-}; // 1
-
-static const unsigned char tewi_block165[][13] = {
 	{ 0x00, 0x00, 0x04, 0x0c, 0x1f, 0x0c, 0x04, 0x06, 0x1f, 0x06, 0x04, 0x00, 0x00 },	// U+2B82 (⮂)
-}; // 1
-
-static const unsigned char tewi_block166[][13] = {
 	{ 0x00, 0x00, 0x00, 0x00, 0x0e, 0x1d, 0x00, 0x1d, 0x0e, 0x00, 0x00, 0x00, 0x00 },	// U+2B88 (⮈)
 	{ 0x00, 0x00, 0x00, 0x00, 0x0a, 0x11, 0x1b, 0x1b, 0x0a, 0x00, 0x00, 0x00, 0x00 },	// U+2B89 (⮉)
 	{ 0x00, 0x00, 0x00, 0x00, 0x0e, 0x17, 0x00, 0x17, 0x0e, 0x00, 0x00, 0x00, 0x00 },	// U+2B8A (⮊)
@@ -3759,13 +3264,7 @@ static const unsigned char tewi_block166[][13] = {
 	{ 0x00, 0x00, 0x00, 0x00, 0x03, 0x09, 0x19, 0x3e, 0x18, 0x08, 0x00, 0x00, 0x00 },	// U+2B91 (⮑)
 	{ 0x00, 0x00, 0x00, 0x33, 0x20, 0x28, 0x2c, 0x3f, 0x0c, 0x08, 0x00, 0x00, 0x00 },	// U+2B92 (⮒)
 	{ 0x00, 0x00, 0x00, 0x33, 0x01, 0x05, 0x0d, 0x3f, 0x0c, 0x04, 0x00, 0x00, 0x00 },	// U+2B93 (⮓)
-}; // 12
-
-static const unsigned char tewi_block167[][13] = {
 	{ 0x00, 0x00, 0x00, 0x00, 0x04, 0x0f, 0x1f, 0x0f, 0x04, 0x00, 0x00, 0x00, 0x00 },	// U+2B95 (⮕)
-}; // 1
-
-static const unsigned char tewi_block168[][13] = {
 	{ 0x00, 0x00, 0x00, 0x00, 0x24, 0x26, 0x3f, 0x06, 0x04, 0x00, 0x00, 0x00, 0x00 },	// U+2BA0 (⮠)
 	{ 0x00, 0x00, 0x00, 0x00, 0x09, 0x19, 0x3f, 0x18, 0x08, 0x00, 0x00, 0x00, 0x00 },	// U+2BA1 (⮡)
 	{ 0x00, 0x00, 0x00, 0x00, 0x04, 0x06, 0x3f, 0x26, 0x24, 0x00, 0x00, 0x00, 0x00 },	// U+2BA2 (⮢)
@@ -3782,42 +3281,24 @@ static const unsigned char tewi_block168[][13] = {
 	{ 0x00, 0x00, 0x00, 0x04, 0x0e, 0x1f, 0x0e, 0x0e, 0x07, 0x00, 0x00, 0x00, 0x00 },	// U+2BAD (⮭)
 	{ 0x00, 0x00, 0x00, 0x1c, 0x0e, 0x0e, 0x1f, 0x0e, 0x04, 0x00, 0x00, 0x00, 0x00 },	// U+2BAE (⮮)
 	{ 0x00, 0x00, 0x00, 0x07, 0x0e, 0x0e, 0x1f, 0x0e, 0x04, 0x00, 0x00, 0x00, 0x00 },	// U+2BAF (⮯)
-}; // 16
-
-static const unsigned char tewi_block169[][13] = {
 	{ 0x00, 0x00, 0x04, 0x0a, 0x1f, 0x0a, 0x0e, 0x00, 0x0e, 0x0a, 0x0e, 0x00, 0x00 },	// U+2BB8 (⮸)
-}; // 1
-
-static const unsigned char tewi_block170[][13] = {
 	{ 0x00, 0x00, 0x00, 0x00, 0x1f, 0x1f, 0x1f, 0x1f, 0x1f, 0x00, 0x00, 0x00, 0x00 },	// U+2BC0 (⯀)
 	{ 0x00, 0x00, 0x00, 0x00, 0x04, 0x0e, 0x1f, 0x0e, 0x04, 0x00, 0x00, 0x00, 0x00 },	// U+2BC1 (⯁)
 	{ 0x00, 0x00, 0x00, 0x00, 0x0e, 0x1f, 0x1f, 0x0e, 0x04, 0x00, 0x00, 0x00, 0x00 },	// U+2BC2 (⯂)
-}; // 3
-
-static const unsigned char tewi_block171[][13] = {
 	{ 0x00, 0x00, 0x00, 0x00, 0x04, 0x04, 0x0e, 0x0e, 0x1f, 0x1f, 0x00, 0x00, 0x00 },	// U+2BC5 (⯅)
 	{ 0x00, 0x00, 0x00, 0x00, 0x1f, 0x1f, 0x0e, 0x0e, 0x04, 0x04, 0x00, 0x00, 0x00 },	// U+2BC6 (⯆)
 	{ 0x00, 0x00, 0x00, 0x00, 0x18, 0x1e, 0x1f, 0x1e, 0x18, 0x00, 0x00, 0x00, 0x00 },	// U+2BC7 (⯇)
 	{ 0x00, 0x00, 0x00, 0x00, 0x03, 0x0f, 0x1f, 0x0f, 0x03, 0x00, 0x00, 0x00, 0x00 },	// U+2BC8 (⯈)
-}; // 4
-
-static const unsigned char tewi_block172[][13] = {
 	{ 0x00, 0x00, 0x00, 0x00, 0x0e, 0x1f, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+2BCA (⯊)
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1f, 0x1f, 0x0e, 0x00, 0x00, 0x00, 0x00 },	// U+2BCB (⯋)
 	{ 0x00, 0x00, 0x00, 0x04, 0x04, 0x0e, 0x1f, 0x0e, 0x04, 0x04, 0x00, 0x00, 0x00 },	// U+2BCC (⯌)
 	{ 0x00, 0x00, 0x00, 0x00, 0x11, 0x0e, 0x0e, 0x0e, 0x11, 0x00, 0x00, 0x00, 0x00 },	// U+2BCD (⯍)
 	{ 0x00, 0x00, 0x00, 0x04, 0x04, 0x0a, 0x11, 0x0a, 0x04, 0x04, 0x00, 0x00, 0x00 },	// U+2BCE (⯎)
 	{ 0x00, 0x00, 0x00, 0x00, 0x11, 0x0e, 0x0a, 0x0e, 0x11, 0x00, 0x00, 0x00, 0x00 },	// U+2BCF (⯏)
-}; // 6
-
-static const unsigned char tewi_block173[][13] = {
 	{ 0x00, 0x00, 0x00, 0x00, 0x14, 0x1e, 0x3f, 0x1e, 0x14, 0x00, 0x00, 0x00, 0x00 },	// U+2BEC (⯬)
 	{ 0x00, 0x00, 0x00, 0x04, 0x0e, 0x1f, 0x04, 0x0e, 0x1f, 0x04, 0x00, 0x00, 0x00 },	// U+2BED (⯭)
 	{ 0x00, 0x00, 0x00, 0x00, 0x0a, 0x1e, 0x3f, 0x1e, 0x0a, 0x00, 0x00, 0x00, 0x00 },	// U+2BEE (⯮)
 	{ 0x00, 0x00, 0x00, 0x04, 0x1f, 0x0e, 0x04, 0x1f, 0x0e, 0x04, 0x00, 0x00, 0x00 },	// U+2BEF (⯯)
-}; // 4
-
-static const unsigned char tewi_block174[][13] = {
 	{ 0x00, 0x00, 0x00, 0x02, 0x02, 0x07, 0x02, 0x07, 0x02, 0x1e, 0x00, 0x00, 0x00 },	// U+2C60 (Ⱡ)
 	{ 0x00, 0x00, 0x00, 0x06, 0x04, 0x0e, 0x04, 0x0e, 0x04, 0x0c, 0x00, 0x00, 0x00 },	// U+2C61 (ⱡ)
 	{ 0x00, 0x00, 0x00, 0x02, 0x02, 0x16, 0x0b, 0x02, 0x02, 0x1e, 0x00, 0x00, 0x00 },	// U+2C62 (Ɫ)
@@ -3850,9 +3331,6 @@ static const unsigned char tewi_block174[][13] = {
 	{ 0x00, 0x00, 0x00, 0x11, 0x11, 0x0a, 0x0a, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+2C7D (ⱽ)
 	{ 0x00, 0x00, 0x00, 0x0e, 0x11, 0x01, 0x0e, 0x10, 0x11, 0x0e, 0x02, 0x0c, 0x00 },	// U+2C7E (Ȿ)
 	{ 0x00, 0x00, 0x00, 0x1f, 0x10, 0x08, 0x04, 0x02, 0x01, 0x03, 0x24, 0x18, 0x00 },	// U+2C7F (Ɀ)
-}; // 32
-
-static const unsigned char tewi_block175[][13] = {
 	{ 0x00, 0x00, 0x0e, 0x02, 0x02, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+2E00 (⸀)
 	{ 0x00, 0x00, 0x0e, 0x02, 0x0a, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+2E01 (⸁)
 	{ 0x00, 0x00, 0x0c, 0x02, 0x02, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+2E02 (⸂)
@@ -3867,9 +3345,6 @@ static const unsigned char tewi_block175[][13] = {
 	{ 0x00, 0x00, 0x1e, 0x12, 0x12, 0x1e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+2E0B (⸋)
 	{ 0x00, 0x00, 0x02, 0x04, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+2E0C (⸌)
 	{ 0x00, 0x00, 0x08, 0x04, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+2E0D (⸍)
-}; // 14
-
-static const unsigned char tewi_block176[][13] = {
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3f, 0x00, 0x00, 0x00 },	// U+2E0F (⸏)
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3f, 0x02, 0x01, 0x00 },	// U+2E10 (⸐)
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3f, 0x10, 0x20, 0x00 },	// U+2E11 (⸑)
@@ -3880,9 +3355,6 @@ static const unsigned char tewi_block176[][13] = {
 	{ 0x00, 0x00, 0x00, 0x12, 0x04, 0x08, 0x10, 0x08, 0x04, 0x12, 0x00, 0x00, 0x00 },	// U+2E16 (⸖)
 	{ 0x00, 0x00, 0x00, 0x00, 0x18, 0x06, 0x00, 0x18, 0x06, 0x00, 0x00, 0x00, 0x00 },	// U+2E17 (⸗)
 	{ 0x00, 0x00, 0x00, 0x04, 0x00, 0x04, 0x0c, 0x14, 0x15, 0x0e, 0x00, 0x00, 0x00 },	// U+2E18 (⸘)
-}; // 10
-
-static const unsigned char tewi_block177[][13] = {
 	{ 0x00, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00, 0x0e, 0x00, 0x00, 0x00, 0x00 },	// U+2E1A (⸚)
 	{ 0x00, 0x00, 0x00, 0x04, 0x0a, 0x04, 0x00, 0x16, 0x0d, 0x00, 0x00, 0x00, 0x00 },	// U+2E1B (⸛)
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x04, 0x08, 0x00 },	// U+2E1C (⸜)
@@ -3922,15 +3394,9 @@ static const unsigned char tewi_block177[][13] = {
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x0f, 0x00, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+2E3E (⸾)
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0c, 0x04, 0x08, 0x00 },	// U+2E3F (⸿)
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1e, 0x0a, 0x14, 0x00 },	// U+2E40 (⹀)
-}; // 39
-
-static const unsigned char tewi_block178[][13] = {
 	{ 0x00, 0x00, 0x03, 0x13, 0x3b, 0x13, 0x13, 0x0b, 0x07, 0x03, 0x03, 0x00, 0x00 },	// U+E0A0 ()
 	{ 0x00, 0x00, 0x00, 0x06, 0x06, 0x1e, 0x00, 0x16, 0x1e, 0x1a, 0x00, 0x00, 0x00 },	// U+E0A1 ()
 	{ 0x00, 0x00, 0x00, 0x0c, 0x12, 0x12, 0x3f, 0x33, 0x3f, 0x1e, 0x00, 0x00, 0x00 },	// U+E0A2 ()
-}; // 3
-
-static const unsigned char tewi_block179[][13] = {
 	{ 0x00, 0x00, 0x00, 0x00, 0x15, 0x15, 0x15, 0x00, 0x1b, 0x00, 0x00, 0x00, 0x00 },	// U+E0A5 ()
 	{ 0x00, 0x00, 0x00, 0x00, 0x1d, 0x01, 0x1c, 0x01, 0x1d, 0x00, 0x00, 0x00, 0x00 },	// U+E0A6 ()
 	{ 0x00, 0x00, 0x00, 0x00, 0x0f, 0x1f, 0x13, 0x13, 0x1e, 0x00, 0x00, 0x00, 0x00 },	// U+E0A7 ()
@@ -3939,23 +3405,14 @@ static const unsigned char tewi_block179[][13] = {
 	{ 0x00, 0x00, 0x00, 0x00, 0x1f, 0x1f, 0x1f, 0x00, 0x17, 0x00, 0x00, 0x00, 0x00 },	// U+E0AA ()
 	{ 0x00, 0x00, 0x00, 0x00, 0x1d, 0x1d, 0x1d, 0x1c, 0x1d, 0x00, 0x00, 0x00, 0x00 },	// U+E0AB ()
 	{ 0x00, 0x00, 0x00, 0x00, 0x17, 0x17, 0x17, 0x07, 0x17, 0x00, 0x00, 0x00, 0x00 },	// U+E0AC ()
-}; // 8
-
-static const unsigned char tewi_block180[][13] = {
 	{ 0x00, 0x01, 0x03, 0x07, 0x0f, 0x1f, 0x3f, 0x1f, 0x0f, 0x07, 0x03, 0x01, 0x00 },	// U+E0B0 ()
 	{ 0x00, 0x01, 0x02, 0x04, 0x08, 0x10, 0x20, 0x10, 0x08, 0x04, 0x02, 0x01, 0x00 },	// U+E0B1 ()
 	{ 0x00, 0x20, 0x30, 0x38, 0x3c, 0x3e, 0x3f, 0x3e, 0x3c, 0x38, 0x30, 0x20, 0x00 },	// U+E0B2 ()
 	{ 0x00, 0x20, 0x10, 0x08, 0x04, 0x02, 0x01, 0x02, 0x04, 0x08, 0x10, 0x20, 0x00 },	// U+E0B3 ()
-}; // 4
-
-static const unsigned char tewi_block181[][13] = {
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3f, 0x3f, 0x3f, 0x3f, 0x00, 0x00, 0x00 },	// U+E0B5 ()
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x2a, 0x15, 0x2a, 0x00, 0x00, 0x00 },	// U+E0B6 ()
 	{ 0x00, 0x00, 0x00, 0x00, 0x09, 0x1b, 0x3f, 0x1b, 0x09, 0x00, 0x00, 0x00, 0x00 },	// U+E0B7 ()
 	{ 0x00, 0x00, 0x00, 0x00, 0x1e, 0x1f, 0x19, 0x19, 0x0f, 0x00, 0x00, 0x00, 0x00 },	// U+E0B8 ()
-}; // 4
-
-static const unsigned char tewi_block182[][13] = {
 	{ 0x00, 0x00, 0x00, 0x0c, 0x12, 0x21, 0x21, 0x12, 0x0c, 0x00, 0x00, 0x00, 0x00 },	// U+E0C0 ()
 	{ 0x00, 0x00, 0x00, 0x0c, 0x16, 0x23, 0x23, 0x16, 0x0c, 0x00, 0x00, 0x00, 0x00 },	// U+E0C1 ()
 	{ 0x00, 0x00, 0x00, 0x0c, 0x16, 0x27, 0x27, 0x16, 0x0c, 0x00, 0x00, 0x00, 0x00 },	// U+E0C2 ()
@@ -3964,14 +3421,88 @@ static const unsigned char tewi_block182[][13] = {
 	{ 0x00, 0x00, 0x00, 0x0c, 0x1a, 0x3d, 0x3d, 0x1a, 0x0c, 0x00, 0x00, 0x00, 0x00 },	// U+E0C5 ()
 	{ 0x00, 0x00, 0x00, 0x0c, 0x1a, 0x39, 0x39, 0x1a, 0x0c, 0x00, 0x00, 0x00, 0x00 },	// U+E0C6 ()
 	{ 0x00, 0x00, 0x00, 0x0c, 0x1a, 0x31, 0x31, 0x1a, 0x0c, 0x00, 0x00, 0x00, 0x00 },	// U+E0C7 ()
-}; // 8
-
-static const unsigned char tewi_block183[][13] = {
 	{ 0x00, 0x00, 0x00, 0x0c, 0x12, 0x02, 0x17, 0x12, 0x12, 0x12, 0x00, 0x00, 0x00 },	// U+FB01 (ﬁ)
 	{ 0x00, 0x00, 0x00, 0x1c, 0x12, 0x12, 0x17, 0x12, 0x12, 0x32, 0x00, 0x00, 0x00 },	// U+FB02 (ﬂ)
-}; // 2
-
-static const unsigned char tewi_block184[][13] = {
 	{ 0x00, 0x00, 0x04, 0x0e, 0x1b, 0x15, 0x17, 0x1b, 0x1f, 0x1b, 0x0e, 0x04, 0x00 },	// U+FFFD (�)
-}; // 1
-
+}; // 3419
+
+static const uint8_t tewi_page_index[] = {
+	0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x00, 0x08, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0a, 0x0b,
+	0x0c, 0x0d, 0x0e, 0x0f, 0x10, 0x11, 0x12, 0x13, 0x14, 0x15, 0x00, 0x16, 0x17, 0x00, 0x18, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x19, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1a, 0x00, 0x00, 0x00, 0x1b,
+}; // 256
+
+static const uint32_t tewi_page_bits[][8] = {
+	{ 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000 },	// Empty
+	{ 0x00000000, 0xffffffff, 0xffffffff, 0x7fffffff, 0x00000000, 0xffffdffe, 0xffffffff, 0xffffffff },	// U+00xx
+	{ 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff },	// U+01xx
+	{ 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0x3fffffff, 0x7f030ffc, 0x00004011 },	// U+02xx
+	{ 0x943f7fff, 0x1e011431, 0x10000018, 0xfcff0002, 0xffffd7f0, 0xfffffffb, 0xffffffff, 0xffffffff },	// U+03xx
+	{ 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xfffffc7f, 0xffffffff, 0xffffffff, 0xffffffff },	// U+04xx
+	{ 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x40000000, 0xffff0049, 0x0000ffff },	// U+05xx
+	{ 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000001, 0x00000000, 0x00000000 },	// U+0Cxx
+	{ 0x00000000, 0x80000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000 },	// U+0Exx
+	{ 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00001f6d, 0x00000000, 0x00000000 },	// U+16xx
+	{ 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffeffbff, 0xffffffef, 0xffffffff },	// U+1Exx
+	{ 0x3f3fffff, 0xffffffff, 0xaaff3f3f, 0x3fffffff, 0xffffffff, 0xffdfffff, 0xefcfffdc, 0x7fdcffff },	// U+1Fxx
+	{ 0xfffd0000, 0xf7fd00ff, 0x7f7fffff, 0xfff30000, 0x1fff7fff, 0x376eff7f, 0x00000000, 0x00000000 },	// U+20xx
+	{ 0x00c00fff, 0x00188ce4, 0x00000000, 0xff7fff7f, 0xffef0009, 0xffff9fff, 0xffefbfff, 0x65feffff },	// U+21xx
+	{ 0xffffffff, 0xfffedfff, 0xdfffffff, 0xffffffff, 0xebffffff, 0xffffffff, 0xffffffff, 0xffffffff },	// U+22xx
+	{ 0xffffffff, 0xffffa9fd, 0xffffffff, 0x7fffffff, 0x00000901, 0x3c000000, 0x00000000, 0x0000fe00 },	// U+23xx
+	{ 0x0000ff00, 0x00000078, 0x000007ff, 0xffffffff, 0xffffffff, 0x003fffff, 0x00000000, 0x00000000 },	// U+24xx
+	{ 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff },	// U+25xx
+	{ 0x40d303ff, 0x9cff0000, 0x00000007, 0x0000ffff, 0x00000000, 0x000003fc, 0x00000000, 0x00000000 },	// U+26xx
+	{ 0xfdf80100, 0x80480ef3, 0xf8078002, 0x0003f071, 0x0ffffc00, 0x00000000, 0x00000000, 0xfb6c0300 },	// U+27xx
+	{ 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff },	// U+28xx
+	{ 0x7e0cf3cc, 0xfff8007e, 0xfffebe7f, 0xff7fffff, 0x00000000, 0x00000000, 0x00000000, 0x00000000 },	// U+29xx
+	{ 0xffffefef, 0x8107ffff, 0xfd3fffff, 0x43cfffef, 0x002fff05, 0x0100ffff, 0x0000fde7, 0x0000f000 },	// U+2Bxx
+	{ 0x00000000, 0x00000000, 0x00000000, 0xffffffff, 0x00000000, 0x00000000, 0x00000000, 0x00000000 },	// U+2Cxx
+	{ 0xfdffbfff, 0xffffffff, 0x00000001, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000 },	// U+2Exx
+	{ 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x01ef1fe7, 0x000000ff, 0x00000000 },	// U+E0xx
+	{ 0x00000006, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000 },	// U+FBxx
+	{ 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x20000000 },	// U+FFxx
+}; // 28
+
+static const uint16_t tewi_page_base[][8] = {
+	{ 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000 },	// Empty
+	{ 0x0000, 0x0000, 0x0020, 0x0040, 0x005f, 0x005f, 0x007d, 0x009d },	// U+00xx
+	{ 0x00bd, 0x00dd, 0x00fd, 0x011d, 0x013d, 0x015d, 0x017d, 0x019d },	// U+01xx
+	{ 0x01bd, 0x01dd, 0x01fd, 0x021d, 0x023d, 0x025d, 0x027b, 0x028e },	// U+02xx
+	{ 0x0291, 0x02a9, 0x02b3, 0x02b6, 0x02c5, 0x02df, 0x02fe, 0x031e },	// U+03xx
+	{ 0x033e, 0x035e, 0x037e, 0x039e, 0x03be, 0x03db, 0x03fb, 0x041b },	// U+04xx
+	{ 0x043b, 0x043b, 0x043b, 0x043b, 0x043b, 0x043b, 0x043c, 0x044f },	// U+05xx
+	{ 0x045f, 0x045f, 0x045f, 0x045f, 0x045f, 0x045f, 0x0460, 0x0460 },	// U+0Cxx
+	{ 0x0460, 0x0460, 0x0461, 0x0461, 0x0461, 0x0461, 0x0461, 0x0461 },	// U+0Exx
+	{ 0x0461, 0x0461, 0x0461, 0x0461, 0x0461, 0x0461, 0x046b, 0x046b },	// U+16xx
+	{ 0x046b, 0x048b, 0x04ab, 0x04cb, 0x04eb, 0x050b, 0x0529, 0x0548 },	// U+1Exx
+	{ 0x0568, 0x0584, 0x05a4, 0x05bc, 0x05da, 0x05fa, 0x0619, 0x0633 },	// U+1Fxx
+	{ 0x064f, 0x065e, 0x0674, 0x0692, 0x06a0, 0x06bc, 0x06d5, 0x06d5 },	// U+20xx
+	{ 0x06d5, 0x06e3, 0x06ec, 0x06ec, 0x070a, 0x071b, 0x0739, 0x0757 },	// U+21xx
+	{ 0x0772, 0x0792, 0x07b0, 0x07cf, 0x07ef, 0x080d, 0x082d, 0x084d },	// U+22xx
+	{ 0x086d, 0x088d, 0x08a8, 0x08c8, 0x08e7, 0x08ea, 0x08ee, 0x08ee },	// U+23xx
+	{ 0x08f5, 0x08fd, 0x0901, 0x090c, 0x092c, 0x094c, 0x0962, 0x0962 },	// U+24xx
+	{ 0x0962, 0x0982, 0x09a2, 0x09c2, 0x09e2, 0x0a02, 0x0a22, 0x0a42 },	// U+25xx
+	{ 0x0a62, 0x0a72, 0x0a7e, 0x0a81, 0x0a91, 0x0a91, 0x0a99, 0x0a99 },	// U+26xx
+	{ 0x0a99, 0x0aa6, 0x0ab2, 0x0abc, 0x0ac6, 0x0ad8, 0x0ad8, 0x0ad8 },	// U+27xx
+	{ 0x0ae5, 0x0b05, 0x0b25, 0x0b45, 0x0b65, 0x0b85, 0x0ba5, 0x0bc5 },	// U+28xx
+	{ 0x0be5, 0x0bf7, 0x0c0a, 0x0c26, 0x0c45, 0x0c45, 0x0c45, 0x0c45 },	// U+29xx
+	{ 0x0c45, 0x0c63, 0x0c78, 0x0c95, 0x0cad, 0x0cbc, 0x0ccd, 0x0cda },	// U+2Bxx
+	{ 0x0cde, 0x0cde, 0x0cde, 0x0cde, 0x0cfe, 0x0cfe, 0x0cfe, 0x0cfe },	// U+2Cxx
+	{ 0x0cfe, 0x0d1c, 0x0d3c, 0x0d3d, 0x0d3d, 0x0d3d, 0x0d3d, 0x0d3d },	// U+2Exx
+	{ 0x0d3d, 0x0d3d, 0x0d3d, 0x0d3d, 0x0d3d, 0x0d3d, 0x0d50, 0x0d58 },	// U+E0xx
+	{ 0x0d58, 0x0d5a, 0x0d5a, 0x0d5a, 0x0d5a, 0x0d5a, 0x0d5a, 0x0d5a },	// U+FBxx
+	{ 0x0d5a, 0x0d5a, 0x0d5a, 0x0d5a, 0x0d5a, 0x0d5a, 0x0d5a, 0x0d5a },	// U+FFxx
+}; // 28
@@ -4,7 +4,7 @@
 * With FBInk's tools/hextoc.py
 */
 
-static const unsigned char tewib_block1[][13] = {
+static const unsigned char tewib_glyphs[][13] = {
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+0020 ( )
 	{ 0x00, 0x00, 0x00, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x00, 0x0c, 0x00, 0x00, 0x00 },	// U+0021 (!)
 	{ 0x00, 0x00, 0x1b, 0x1b, 0x1b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+0022 (")
@@ -100,9 +100,6 @@ static const unsigned char tewib_block1[][13] = {
 	{ 0x00, 0x00, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x00 },	// U+007C (|)
 	{ 0x00, 0x00, 0x03, 0x06, 0x06, 0x06, 0x1c, 0x06, 0x06, 0x06, 0x03, 0x00, 0x00 },	// U+007D (})
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x16, 0x0d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+007E (~)
-}; // 95
-
-static const unsigned char tewib_block2[][13] = {
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+00A0 ( )
 	{ 0x00, 0x00, 0x00, 0x0c, 0x00, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x00, 0x00, 0x00 },	// U+00A1 (¡)
 	{ 0x00, 0x00, 0x00, 0x00, 0x04, 0x0e, 0x17, 0x07, 0x17, 0x0e, 0x04, 0x00, 0x00 },	// U+00A2 (¢)
@@ -249,9 +246,6 @@ static const unsigned char tewib_block2[][13] = {
 	{ 0x00, 0x00, 0x00, 0x0c, 0x00, 0x0e, 0x0c, 0x0c, 0x0c, 0x1c, 0x06, 0x0c, 0x00 },	// U+012F (į)
 	{ 0x00, 0x0c, 0x00, 0x1e, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x1e, 0x00, 0x00, 0x00 },	// U+0130 (İ)
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x0e, 0x0c, 0x0c, 0x0c, 0x1c, 0x00, 0x00, 0x00 },	// U+0131 (ı)
-}; // 146
-
-static const unsigned char tewib_block3[][13] = {
 	{ 0x00, 0x04, 0x0a, 0x18, 0x18, 0x18, 0x18, 0x1b, 0x1b, 0x0e, 0x00, 0x00, 0x00 },	// U+0134 (Ĵ)
 	{ 0x00, 0x00, 0x04, 0x0a, 0x00, 0x0e, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x07, 0x00 },	// U+0135 (ĵ)
 	{ 0x00, 0x00, 0x00, 0x1b, 0x0f, 0x07, 0x03, 0x07, 0x0f, 0x1b, 0x0c, 0x06, 0x00 },	// U+0136 (Ķ)
@@ -379,5 +373,20 @@ static const unsigned char tewib_block3[][13] = {
 	{ 0x00, 0x00, 0x00, 0x20, 0x20, 0x1b, 0x1b, 0x1b, 0x1b, 0x16, 0x00, 0x00, 0x00 },	// U+01B0 (ư)
 	{ 0x00, 0x00, 0x00, 0x1f, 0x0e, 0x1b, 0x1b, 0x1b, 0x1b, 0x0e, 0x00, 0x00, 0x00 },	// U+01B1 (Ʊ)
 	{ 0x00, 0x00, 0x0c, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x0e, 0x00, 0x00, 0x00 },	// U+01B2 (Ʋ)
-}; // 127
+}; // 368
+
+static const uint8_t tewib_page_index[] = {
+	0x01, 0x02,
+}; // 2
+
+static const uint32_t tewib_page_bits[][8] = {
+	{ 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000 },	// Empty
+	{ 0x00000000, 0xffffffff, 0xffffffff, 0x7fffffff, 0x00000000, 0xffffffff, 0xffffffff, 0xffffffff },	// U+00xx
+	{ 0xffffffff, 0xfff3ffff, 0xffffffff, 0xffffffff, 0xffffffff, 0x0007ffff, 0x00000000, 0x00000000 },	// U+01xx
+}; // 3
 
+static const uint16_t tewib_page_base[][8] = {
+	{ 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000 },	// Empty
+	{ 0x0000, 0x0000, 0x0020, 0x0040, 0x005f, 0x005f, 0x007f, 0x009f },	// U+00xx
+	{ 0x00bf, 0x00df, 0x00fd, 0x011d, 0x013d, 0x015d, 0x0170, 0x0170 },	// U+01xx
+}; // 3
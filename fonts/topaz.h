@@ -4,7 +4,7 @@
 * With FBInk's tools/hextoc.py
 */
 
-static const unsigned char topaz_block1[][16] = {
+static const unsigned char topaz_glyphs[][16] = {
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+0000 (ESC)
 	{ 0xc1, 0xc1, 0x9c, 0x9c, 0x84, 0x84, 0x94, 0x94, 0x84, 0x84, 0xfc, 0xfc, 0xe1, 0xe1, 0xff, 0xff },	// U+0001 (ESC)
 	{ 0xc3, 0xc3, 0x99, 0x99, 0x99, 0x99, 0x81, 0x81, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0xff, 0xff },	// U+0002 (ESC)
@@ -263,3 +263,16 @@ static const unsigned char topaz_block1[][16] = {
 	{ 0x00, 0x00, 0x66, 0x66, 0x00, 0x00, 0x66, 0x66, 0x66, 0x66, 0x3c, 0x3c, 0x18, 0x18, 0x0c, 0x0c },	// U+00FF (ÿ)
 }; // 256
 
+static const uint8_t topaz_page_index[] = {
+	0x01,
+}; // 1
+
+static const uint32_t topaz_page_bits[][8] = {
+	{ 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000 },	// Empty
+	{ 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff },	// U+00xx
+}; // 2
+
+static const uint16_t topaz_page_base[][8] = {
+	{ 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000 },	// Empty
+	{ 0x0000, 0x0020, 0x0040, 0x0060, 0x0080, 0x00a0, 0x00c0, 0x00e0 },	// U+00xx
+}; // 2
@@ -4,7 +4,7 @@
 * With FBInk's tools/hextoc.py
 */
 
-static const unsigned char veggie_block1[][16] = {
+static const unsigned char veggie_glyphs[][16] = {
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+0020 ( )
 	{ 0x00, 0x00, 0x00, 0x00, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x00, 0x18, 0x18, 0x00, 0x00, 0x00 },	// U+0021 (!)
 	{ 0x00, 0x00, 0x6c, 0x6c, 0x6c, 0x6c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+0022 (")
@@ -100,9 +100,6 @@ static const unsigned char veggie_block1[][16] = {
 	{ 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18 },	// U+007C (|)
 	{ 0x00, 0x0c, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x70, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x0c },	// U+007D (})
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xcc, 0xd6, 0x66, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+007E (~)
-}; // 95
-
-static const unsigned char veggie_block2[][16] = {
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+00A0 ( )
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x18, 0x00, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x00 },	// U+00A1 (¡)
 	{ 0x00, 0x00, 0x00, 0x00, 0x60, 0x60, 0xfc, 0x06, 0x06, 0x06, 0x06, 0x06, 0xfc, 0x18, 0x18, 0x00 },	// U+00A2 (¢)
@@ -219,9 +216,6 @@ static const unsigned char veggie_block2[][16] = {
 	{ 0x00, 0x00, 0xc0, 0xf8, 0xc0, 0xc0, 0xfc, 0xc6, 0xc6, 0xc6, 0xc6, 0xc6, 0xfc, 0x00, 0x00, 0x00 },	// U+0111 (đ)
 	{ 0x00, 0x00, 0x7c, 0x00, 0xfe, 0x06, 0x06, 0x06, 0x3e, 0x06, 0x06, 0x06, 0xfe, 0x00, 0x00, 0x00 },	// U+0112 (Ē)
 	{ 0x00, 0x00, 0x00, 0x00, 0x7c, 0x00, 0x7c, 0xc6, 0xc6, 0xfe, 0x06, 0x06, 0x7c, 0x00, 0x00, 0x00 },	// U+0113 (ē)
-}; // 116
-
-static const unsigned char veggie_block3[][16] = {
 	{ 0x00, 0x30, 0x30, 0x00, 0xfe, 0x06, 0x06, 0x06, 0x3e, 0x06, 0x06, 0x06, 0xfe, 0x00, 0x00, 0x00 },	// U+0116 (Ė)
 	{ 0x00, 0x00, 0x00, 0x30, 0x30, 0x00, 0x7c, 0xc6, 0xc6, 0xfe, 0x06, 0x06, 0x7c, 0x00, 0x00, 0x00 },	// U+0117 (ė)
 	{ 0x00, 0x00, 0x00, 0x00, 0xfe, 0x06, 0x06, 0x06, 0x3e, 0x06, 0x06, 0x06, 0xfe, 0x60, 0x60, 0xc0 },	// U+0118 (Ę)
@@ -244,16 +238,10 @@ static const unsigned char veggie_block3[][16] = {
 	{ 0x00, 0x00, 0xcc, 0xd6, 0x66, 0x00, 0x38, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x00, 0x00, 0x00 },	// U+0129 (ĩ)
 	{ 0x00, 0x00, 0x7e, 0x00, 0x3c, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x3c, 0x00, 0x00, 0x00 },	// U+012A (Ī)
 	{ 0x00, 0x00, 0x00, 0x00, 0x7c, 0x00, 0x38, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x00, 0x00, 0x00 },	// U+012B (ī)
-}; // 22
-
-static const unsigned char veggie_block4[][16] = {
 	{ 0x00, 0x00, 0x00, 0x00, 0x3c, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x3c, 0x18, 0x18, 0x30 },	// U+012E (Į)
 	{ 0x00, 0x00, 0x00, 0x30, 0x30, 0x00, 0x38, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x60 },	// U+012F (į)
 	{ 0x00, 0x18, 0x18, 0x00, 0x3c, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x3c, 0x00, 0x00, 0x00 },	// U+0130 (İ)
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x38, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x00, 0x00, 0x00 },	// U+0131 (ı)
-}; // 4
-
-static const unsigned char veggie_block5[][16] = {
 	{ 0x30, 0x78, 0xcc, 0x00, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc6, 0x7c, 0x00, 0x00, 0x00 },	// U+0134 (Ĵ)
 	{ 0x00, 0x10, 0x38, 0x6c, 0xc6, 0x00, 0x38, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x18 },	// U+0135 (ĵ)
 	{ 0x00, 0x00, 0x00, 0x00, 0xc6, 0x66, 0x36, 0x1e, 0x0e, 0x1e, 0x36, 0x66, 0xd6, 0x30, 0x60, 0x3c },	// U+0136 (Ķ)
@@ -265,9 +253,6 @@ static const unsigned char veggie_block5[][16] = {
 	{ 0x00, 0x00, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x78, 0x38, 0x60, 0x3c },	// U+013C (ļ)
 	{ 0x00, 0x00, 0x60, 0x60, 0x66, 0x36, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0xfe, 0x00, 0x00, 0x00 },	// U+013D (Ľ)
 	{ 0x00, 0xc0, 0xcc, 0xcc, 0x6c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x78, 0x00, 0x00, 0x00 },	// U+013E (ľ)
-}; // 11
-
-static const unsigned char veggie_block6[][16] = {
 	{ 0x00, 0x00, 0x00, 0x00, 0x06, 0x36, 0x1e, 0x0e, 0x06, 0x07, 0x06, 0x06, 0xfe, 0x00, 0x00, 0x00 },	// U+0141 (Ł)
 	{ 0x00, 0x00, 0x0c, 0x0c, 0x6c, 0x3c, 0x1c, 0x0c, 0x0e, 0x0f, 0x0c, 0x0c, 0x78, 0x00, 0x00, 0x00 },	// U+0142 (ł)
 	{ 0x60, 0x30, 0x18, 0x00, 0xc6, 0xc6, 0xce, 0xde, 0xfe, 0xf6, 0xe6, 0xc6, 0xc6, 0x00, 0x00, 0x00 },	// U+0143 (Ń)
@@ -276,16 +261,10 @@ static const unsigned char veggie_block6[][16] = {
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7e, 0xc6, 0xc6, 0xc6, 0xc6, 0xc6, 0xd6, 0x30, 0x60, 0x3c },	// U+0146 (ņ)
 	{ 0xc6, 0x6c, 0x38, 0x00, 0xc6, 0xc6, 0xce, 0xde, 0xfe, 0xf6, 0xe6, 0xc6, 0xc6, 0x00, 0x00, 0x00 },	// U+0147 (Ň)
 	{ 0x00, 0xc6, 0x6c, 0x38, 0x10, 0x00, 0x7e, 0xc6, 0xc6, 0xc6, 0xc6, 0xc6, 0xc6, 0x00, 0x00, 0x00 },	// U+0148 (ň)
-}; // 8
-
-static const unsigned char veggie_block7[][16] = {
 	{ 0x00, 0x00, 0x00, 0x00, 0xc6, 0xc6, 0xce, 0xde, 0xfe, 0xf6, 0xe6, 0xc6, 0xc6, 0xc0, 0xc0, 0x60 },	// U+014A (Ŋ)
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7e, 0xc6, 0xc6, 0xc6, 0xc6, 0xc6, 0xc6, 0xc0, 0xc0, 0x60 },	// U+014B (ŋ)
 	{ 0x00, 0x00, 0x7c, 0x00, 0x7c, 0xc6, 0xc6, 0xc6, 0xc6, 0xc6, 0xc6, 0xc6, 0x7c, 0x00, 0x00, 0x00 },	// U+014C (Ō)
 	{ 0x00, 0x00, 0x00, 0x00, 0x7c, 0x00, 0x7c, 0xc6, 0xc6, 0xc6, 0xc6, 0xc6, 0x7c, 0x00, 0x00, 0x00 },	// U+014D (ō)
-}; // 4
-
-static const unsigned char veggie_block8[][16] = {
 	{ 0xd8, 0x6c, 0x36, 0x00, 0x7c, 0xc6, 0xc6, 0xc6, 0xc6, 0xc6, 0xc6, 0xc6, 0x7c, 0x00, 0x00, 0x00 },	// U+0150 (Ő)
 	{ 0x00, 0x00, 0xd8, 0x6c, 0x36, 0x00, 0x7c, 0xc6, 0xc6, 0xc6, 0xc6, 0xc6, 0x7c, 0x00, 0x00, 0x00 },	// U+0151 (ő)
 	{ 0x00, 0x00, 0x00, 0x00, 0xfe, 0x33, 0x33, 0x33, 0x73, 0x33, 0x33, 0x33, 0xfe, 0x00, 0x00, 0x00 },	// U+0152 (Œ)
@@ -333,61 +312,25 @@ static const unsigned char veggie_block8[][16] = {
 	{ 0x00, 0x00, 0x00, 0x18, 0x18, 0x00, 0xfe, 0x60, 0x30, 0x18, 0x0c, 0x06, 0xfe, 0x00, 0x00, 0x00 },	// U+017C (ż)
 	{ 0xc6, 0x6c, 0x38, 0x00, 0xfe, 0xc0, 0x60, 0x30, 0x18, 0x0c, 0x06, 0x06, 0xfe, 0x00, 0x00, 0x00 },	// U+017D (Ž)
 	{ 0x00, 0xc6, 0x6c, 0x38, 0x10, 0x00, 0xfe, 0x60, 0x30, 0x18, 0x0c, 0x06, 0xfe, 0x00, 0x00, 0x00 },	// U+017E (ž)
-}; // 47
-
-static const unsigned char veggie_block9[][16] = {
 	{ 0x00, 0x00, 0x78, 0x0c, 0x0c, 0x0c, 0x1c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x07, 0x00 },	// U+0192 (ƒ)
-}; // 1
-
-static const unsigned char veggie_block10[][16] = {
 	{ 0x00, 0x00, 0x00, 0x00, 0xfc, 0x06, 0x06, 0x06, 0x7c, 0xc0, 0xc0, 0xc0, 0x7e, 0x18, 0x18, 0x0c },	// U+0218 (Ș)
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfc, 0x06, 0x06, 0x7c, 0xc0, 0xc0, 0x7e, 0x18, 0x18, 0x0c },	// U+0219 (ș)
 	{ 0x00, 0x00, 0x00, 0x00, 0x7e, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x0c },	// U+021A (Ț)
 	{ 0x00, 0x00, 0x18, 0x18, 0x18, 0x18, 0x3c, 0x18, 0x18, 0x18, 0x18, 0x18, 0x70, 0x30, 0x30, 0x18 },	// U+021B (ț)
-}; // 4
-
-static const unsigned char veggie_block11[][16] = {
 	{ 0x6c, 0x38, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+02C7 (ˇ)
-}; // 1
-
-static const unsigned char veggie_block12[][16] = {
 	{ 0xc6, 0xc6, 0x7c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+02D8 (˘)
 	{ 0x00, 0x18, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+02D9 (˙)
-}; // 2
-
-static const unsigned char veggie_block13[][16] = {
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0x30, 0x60 },	// U+02DB (˛)
-}; // 1
-
-static const unsigned char veggie_block14[][16] = {
 	{ 0xd8, 0x6c, 0x36, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+02DD (˝)
-}; // 1
-
-static const unsigned char veggie_block15[][16] = {
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x18, 0x18 },	// U+037A (ͺ)
-}; // 1
-
-static const unsigned char veggie_block16[][16] = {
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x18, 0x00, 0x00, 0x00, 0x18, 0x18, 0x0c, 0x00, 0x00 },	// U+037E (;)
-}; // 1
-
-static const unsigned char veggie_block17[][16] = {
 	{ 0x60, 0x30, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+0384 (΄)
 	{ 0x18, 0x18, 0xdb, 0xc3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+0385 (΅)
 	{ 0x00, 0x00, 0x03, 0x03, 0x7b, 0xcc, 0xcc, 0xcc, 0xcc, 0xfc, 0xcc, 0xcc, 0xcc, 0x00, 0x00, 0x00 },	// U+0386 (Ά)
-}; // 3
-
-static const unsigned char veggie_block18[][16] = {
 	{ 0x00, 0x00, 0x03, 0x03, 0xff, 0x0c, 0x0c, 0x0c, 0x3c, 0x0c, 0x0c, 0x0c, 0xfc, 0x00, 0x00, 0x00 },	// U+0388 (Έ)
 	{ 0x00, 0x00, 0x03, 0x03, 0xcf, 0xcc, 0xcc, 0xcc, 0xfc, 0xcc, 0xcc, 0xcc, 0xcc, 0x00, 0x00, 0x00 },	// U+0389 (Ή)
 	{ 0x00, 0x00, 0x03, 0x03, 0x7b, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x78, 0x00, 0x00, 0x00 },	// U+038A (Ί)
-}; // 3
-
-static const unsigned char veggie_block19[][16] = {
 	{ 0x00, 0x00, 0x03, 0x03, 0x7b, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0x78, 0x00, 0x00, 0x00 },	// U+038C (Ό)
-}; // 1
-
-static const unsigned char veggie_block20[][16] = {
 	{ 0x00, 0x00, 0x03, 0x03, 0xcf, 0xcc, 0xcc, 0x78, 0x70, 0x30, 0x30, 0x18, 0x18, 0x00, 0x00, 0x00 },	// U+038E (Ύ)
 	{ 0x00, 0x00, 0x03, 0x03, 0x7b, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0x78, 0xcc, 0x00, 0x00, 0x00 },	// U+038F (Ώ)
 	{ 0x60, 0x30, 0x18, 0x66, 0x66, 0x00, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x30, 0x00, 0x00, 0x00 },	// U+0390 (ΐ)
@@ -408,9 +351,6 @@ static const unsigned char veggie_block20[][16] = {
 	{ 0x00, 0x00, 0x00, 0x00, 0x7c, 0xc6, 0xc6, 0xc6, 0xc6, 0xc6, 0xc6, 0xc6, 0x7c, 0x00, 0x00, 0x00 },	// U+039F (Ο)
 	{ 0x00, 0x00, 0x00, 0x00, 0xfe, 0xc6, 0xc6, 0xc6, 0xc6, 0xc6, 0xc6, 0xc6, 0xc6, 0x00, 0x00, 0x00 },	// U+03A0 (Π)
 	{ 0x00, 0x00, 0x00, 0x00, 0x7e, 0xc6, 0xc6, 0xc6, 0xc6, 0x7e, 0x06, 0x06, 0x06, 0x00, 0x00, 0x00 },	// U+03A1 (Ρ)
-}; // 20
-
-static const unsigned char veggie_block21[][16] = {
 	{ 0x00, 0x00, 0x00, 0x00, 0xfe, 0x06, 0x0c, 0x18, 0x30, 0x18, 0x0c, 0x06, 0xfe, 0x00, 0x00, 0x00 },	// U+03A3 (Σ)
 	{ 0x00, 0x00, 0x00, 0x00, 0x7e, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x00, 0x00, 0x00 },	// U+03A4 (Τ)
 	{ 0x00, 0x00, 0x00, 0x00, 0xc6, 0xc6, 0xc6, 0x6c, 0x78, 0x30, 0x30, 0x18, 0x18, 0x00, 0x00, 0x00 },	// U+03A5 (Υ)
@@ -455,9 +395,6 @@ static const unsigned char veggie_block21[][16] = {
 	{ 0x00, 0x00, 0x60, 0x30, 0x18, 0x00, 0x7c, 0xc6, 0xc6, 0xc6, 0xc6, 0xc6, 0x7c, 0x00, 0x00, 0x00 },	// U+03CC (ό)
 	{ 0x00, 0x00, 0x60, 0x30, 0x18, 0x00, 0xc6, 0xc6, 0xc6, 0xc6, 0xc6, 0xc6, 0x7c, 0x00, 0x00, 0x00 },	// U+03CD (ύ)
 	{ 0x00, 0x00, 0x60, 0x30, 0x18, 0x00, 0x6c, 0xc6, 0xd6, 0xd6, 0xd6, 0xd6, 0x6c, 0x00, 0x00, 0x00 },	// U+03CE (ώ)
-}; // 44
-
-static const unsigned char veggie_block22[][16] = {
 	{ 0x00, 0x6c, 0x6c, 0x00, 0xfe, 0x06, 0x06, 0x06, 0x3e, 0x06, 0x06, 0x06, 0xfe, 0x00, 0x00, 0x00 },	// U+0401 (Ё)
 	{ 0x00, 0x00, 0x00, 0x00, 0x3f, 0x06, 0x06, 0x06, 0x7e, 0xc6, 0xc6, 0xc6, 0xc6, 0x70, 0x00, 0x00 },	// U+0402 (Ђ)
 	{ 0x60, 0x30, 0x18, 0x00, 0xfe, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x00, 0x00, 0x00 },	// U+0403 (Ѓ)
@@ -537,9 +474,6 @@ static const unsigned char veggie_block22[][16] = {
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7e, 0xc0, 0xc0, 0xf8, 0xc0, 0xc0, 0x7e, 0x00, 0x00, 0x00 },	// U+044D (э)
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x76, 0xde, 0xde, 0xde, 0xde, 0xde, 0x76, 0x00, 0x00, 0x00 },	// U+044E (ю)
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfc, 0xc6, 0xc6, 0xfc, 0xd8, 0xcc, 0xc6, 0x00, 0x00, 0x00 },	// U+044F (я)
-}; // 79
-
-static const unsigned char veggie_block23[][16] = {
 	{ 0x00, 0x00, 0x00, 0x6c, 0x6c, 0x00, 0x7c, 0xc6, 0xc6, 0xfe, 0x06, 0x06, 0x7c, 0x00, 0x00, 0x00 },	// U+0451 (ё)
 	{ 0x00, 0x00, 0x06, 0x3f, 0x06, 0x06, 0x7e, 0xc6, 0xc6, 0xc6, 0xc6, 0xc6, 0xc6, 0xc0, 0xc0, 0x60 },	// U+0452 (ђ)
 	{ 0x00, 0x00, 0x60, 0x30, 0x18, 0x00, 0xfe, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x00, 0x00, 0x00 },	// U+0453 (ѓ)
@@ -555,72 +489,33 @@ static const unsigned char veggie_block23[][16] = {
 	{ 0x00, 0x00, 0x0c, 0x18, 0x30, 0x00, 0xc6, 0xc6, 0xe6, 0xf6, 0xde, 0xce, 0xc6, 0x00, 0x00, 0x00 },	// U+045D (ѝ)
 	{ 0x00, 0x00, 0x00, 0x6c, 0x38, 0x00, 0xc6, 0xc6, 0xc6, 0xc6, 0xc6, 0xc6, 0xfc, 0xc0, 0xc0, 0x78 },	// U+045E (ў)
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc6, 0xc6, 0xc6, 0xc6, 0xc6, 0xc6, 0xfe, 0x10, 0x10, 0x10 },	// U+045F (џ)
-}; // 15
-
-static const unsigned char veggie_block24[][16] = {
 	{ 0x00, 0x00, 0xc0, 0xc0, 0xfe, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x00, 0x00, 0x00 },	// U+0490 (Ґ)
 	{ 0x00, 0x00, 0x00, 0x00, 0xc0, 0xc0, 0xfe, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x00, 0x00, 0x00 },	// U+0491 (ґ)
-}; // 2
-
-static const unsigned char veggie_block25[][16] = {
 	{ 0x00, 0x18, 0x18, 0x00, 0x7e, 0xc6, 0xc6, 0xc6, 0x7e, 0xc6, 0xc6, 0xc6, 0x7e, 0x00, 0x00, 0x00 },	// U+1E02 (Ḃ)
 	{ 0x06, 0x06, 0x00, 0x06, 0x06, 0x06, 0x7e, 0xc6, 0xc6, 0xc6, 0xc6, 0xc6, 0x7e, 0x00, 0x00, 0x00 },	// U+1E03 (ḃ)
-}; // 2
-
-static const unsigned char veggie_block26[][16] = {
 	{ 0x00, 0x18, 0x18, 0x00, 0x7e, 0xc6, 0xc6, 0xc6, 0xc6, 0xc6, 0xc6, 0xc6, 0x7e, 0x00, 0x00, 0x00 },	// U+1E0A (Ḋ)
 	{ 0xc0, 0xc0, 0x00, 0xc0, 0xc0, 0xc0, 0xfc, 0xc6, 0xc6, 0xc6, 0xc6, 0xc6, 0xfc, 0x00, 0x00, 0x00 },	// U+1E0B (ḋ)
-}; // 2
-
-static const unsigned char veggie_block27[][16] = {
 	{ 0x00, 0x18, 0x18, 0x00, 0xfe, 0x06, 0x06, 0x06, 0x3e, 0x06, 0x06, 0x06, 0x06, 0x00, 0x00, 0x00 },	// U+1E1E (Ḟ)
 	{ 0x30, 0x30, 0x00, 0x78, 0x0c, 0x0c, 0x1c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x00, 0x00, 0x00 },	// U+1E1F (ḟ)
-}; // 2
-
-static const unsigned char veggie_block28[][16] = {
 	{ 0x00, 0x30, 0x30, 0x00, 0xc6, 0xee, 0xfe, 0xd6, 0xc6, 0xc6, 0xc6, 0xc6, 0xc6, 0x00, 0x00, 0x00 },	// U+1E40 (Ṁ)
 	{ 0x00, 0x00, 0x00, 0x30, 0x30, 0x00, 0x6e, 0xd6, 0xd6, 0xd6, 0xd6, 0xd6, 0xc6, 0x00, 0x00, 0x00 },	// U+1E41 (ṁ)
-}; // 2
-
-static const unsigned char veggie_block29[][16] = {
 	{ 0x00, 0x18, 0x18, 0x00, 0x7e, 0xc6, 0xc6, 0xc6, 0xc6, 0x7e, 0x06, 0x06, 0x06, 0x00, 0x00, 0x00 },	// U+1E56 (Ṗ)
 	{ 0x00, 0x00, 0x00, 0x18, 0x18, 0x00, 0x7e, 0xc6, 0xc6, 0xc6, 0xc6, 0xc6, 0x7e, 0x06, 0x06, 0x06 },	// U+1E57 (ṗ)
-}; // 2
-
-static const unsigned char veggie_block30[][16] = {
 	{ 0x00, 0x30, 0x30, 0x00, 0xfc, 0x06, 0x06, 0x06, 0x7c, 0xc0, 0xc0, 0xc0, 0x7e, 0x00, 0x00, 0x00 },	// U+1E60 (Ṡ)
 	{ 0x00, 0x00, 0x00, 0x30, 0x30, 0x00, 0xfc, 0x06, 0x06, 0x7c, 0xc0, 0xc0, 0x7e, 0x00, 0x00, 0x00 },	// U+1E61 (ṡ)
-}; // 2
-
-static const unsigned char veggie_block31[][16] = {
 	{ 0x00, 0x18, 0x18, 0x00, 0x7e, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x00, 0x00, 0x00 },	// U+1E6A (Ṫ)
 	{ 0x18, 0x18, 0x00, 0x18, 0x18, 0x18, 0x3c, 0x18, 0x18, 0x18, 0x18, 0x18, 0x70, 0x00, 0x00, 0x00 },	// U+1E6B (ṫ)
-}; // 2
-
-static const unsigned char veggie_block32[][16] = {
 	{ 0x0c, 0x18, 0x30, 0x00, 0xc6, 0xc6, 0xc6, 0xc6, 0xc6, 0xd6, 0xfe, 0xee, 0xc6, 0x00, 0x00, 0x00 },	// U+1E80 (Ẁ)
 	{ 0x00, 0x00, 0x0c, 0x18, 0x30, 0x00, 0xc6, 0xc6, 0xc6, 0xd6, 0xfe, 0xee, 0xc6, 0x00, 0x00, 0x00 },	// U+1E81 (ẁ)
 	{ 0x60, 0x30, 0x18, 0x00, 0xc6, 0xc6, 0xc6, 0xc6, 0xc6, 0xd6, 0xfe, 0xee, 0xc6, 0x00, 0x00, 0x00 },	// U+1E82 (Ẃ)
 	{ 0x00, 0x00, 0x60, 0x30, 0x18, 0x00, 0xc6, 0xc6, 0xc6, 0xd6, 0xfe, 0xee, 0xc6, 0x00, 0x00, 0x00 },	// U+1E83 (ẃ)
 	{ 0x00, 0x6c, 0x6c, 0x00, 0xc6, 0xc6, 0xc6, 0xc6, 0xc6, 0xd6, 0xfe, 0xee, 0xc6, 0x00, 0x00, 0x00 },	// U+1E84 (Ẅ)
 	{ 0x00, 0x00, 0x00, 0x6c, 0x6c, 0x00, 0xc6, 0xc6, 0xc6, 0xd6, 0xfe, 0xee, 0xc6, 0x00, 0x00, 0x00 },	// U+1E85 (ẅ)
-}; // 6
-
-static const unsigned char veggie_block33[][16] = {
 	{ 0x0c, 0x18, 0x30, 0x00, 0xc6, 0xc6, 0xc6, 0x6c, 0x78, 0x30, 0x30, 0x18, 0x18, 0x00, 0x00, 0x00 },	// U+1EF2 (Ỳ)
 	{ 0x00, 0x00, 0x0c, 0x18, 0x30, 0x00, 0xc6, 0xc6, 0xc6, 0xc6, 0xc6, 0xc6, 0xfc, 0xc0, 0xc0, 0x78 },	// U+1EF3 (ỳ)
-}; // 2
-
-static const unsigned char veggie_block34[][16] = {
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+2015 (―)
-}; // 1
-
-static const unsigned char veggie_block35[][16] = {
 	{ 0x00, 0x00, 0x30, 0x18, 0x18, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+2018 (‘)
 	{ 0x00, 0x00, 0x30, 0x30, 0x30, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+2019 (’)
-}; // 2
-
-static const unsigned char veggie_block36[][16] = {
 	{ 0x00, 0x00, 0x18, 0x18, 0x18, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+201B (‛)
 	{ 0x00, 0x00, 0x6c, 0x36, 0x36, 0x36, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+201C (“)
 	{ 0x00, 0x00, 0x6c, 0x6c, 0x6c, 0x36, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+201D (”)
@@ -629,148 +524,49 @@ static const unsigned char veggie_block36[][16] = {
 	{ 0x00, 0x00, 0x00, 0x00, 0x18, 0x18, 0x18, 0x7e, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x00 },	// U+2020 (†)
 	{ 0x00, 0x00, 0x00, 0x00, 0x18, 0x18, 0x18, 0x7e, 0x18, 0x18, 0x18, 0x7e, 0x18, 0x18, 0x18, 0x00 },	// U+2021 (‡)
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x3c, 0x3c, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+2022 (•)
-}; // 8
-
-static const unsigned char veggie_block37[][16] = {
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xdb, 0xdb, 0x00, 0x00, 0x00 },	// U+2026 (…)
-}; // 1
-
-static const unsigned char veggie_block38[][16] = {
 	{ 0x00, 0x00, 0x00, 0x00, 0x0e, 0x1b, 0xee, 0x78, 0x1e, 0x07, 0x6c, 0xd6, 0x6c, 0x00, 0x00, 0x00 },	// U+2030 (‰)
-}; // 1
-
-static const unsigned char veggie_block39[][16] = {
 	{ 0x00, 0x00, 0x00, 0x00, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x00, 0x6c, 0x6c, 0x00, 0x00, 0x00 },	// U+203C (‼)
 	{ 0x00, 0x00, 0x00, 0x00, 0x7e, 0xd8, 0xd8, 0x78, 0x38, 0x18, 0x00, 0x18, 0x18, 0x00, 0x00, 0x00 },	// U+203D (‽)
-}; // 2
-
-static const unsigned char veggie_block40[][16] = {
 	{ 0x00, 0x00, 0x00, 0x00, 0x7e, 0xc6, 0xc6, 0xc6, 0xc6, 0xc6, 0xc6, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+207F (ⁿ)
-}; // 1
-
-static const unsigned char veggie_block41[][16] = {
 	{ 0x00, 0x00, 0x60, 0x60, 0x6f, 0x7b, 0xfb, 0x7b, 0x7b, 0x6f, 0x63, 0x63, 0xc3, 0x00, 0x00, 0x00 },	// U+20A7 (₧)
-}; // 1
-
-static const unsigned char veggie_block42[][16] = {
 	{ 0x00, 0x00, 0x00, 0x00, 0xf8, 0x0c, 0x0c, 0x7e, 0x0c, 0x3e, 0x0c, 0x0c, 0xf8, 0x00, 0x00, 0x00 },	// U+20AC (€)
-}; // 1
-
-static const unsigned char veggie_block43[][16] = {
 	{ 0x00, 0x00, 0x00, 0x00, 0x0f, 0x1b, 0x7b, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0x7f, 0x18, 0x18, 0x18 },	// U+20AF (₯)
-}; // 1
-
-static const unsigned char veggie_block44[][16] = {
 	{ 0x00, 0x00, 0x00, 0x00, 0x19, 0x1b, 0x7b, 0xdf, 0xdf, 0xdf, 0x7b, 0x1b, 0xf3, 0x00, 0x00, 0x00 },	// U+2116 (№)
-}; // 1
-
-static const unsigned char veggie_block45[][16] = {
 	{ 0x00, 0x9f, 0xf6, 0xf6, 0xf6, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+2122 (™)
-}; // 1
-
-static const unsigned char veggie_block46[][16] = {
 	{ 0x00, 0x00, 0x00, 0x00, 0x08, 0x0c, 0x0e, 0xff, 0xff, 0x0e, 0x0c, 0x08, 0x00, 0x00, 0x00, 0x00 },	// U+2190 (←)
 	{ 0x00, 0x00, 0x00, 0x10, 0x38, 0x7c, 0xfe, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x00, 0x00, 0x00 },	// U+2191 (↑)
 	{ 0x00, 0x00, 0x00, 0x00, 0x10, 0x30, 0x70, 0xff, 0xff, 0x70, 0x30, 0x10, 0x00, 0x00, 0x00, 0x00 },	// U+2192 (→)
 	{ 0x00, 0x00, 0x00, 0x00, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0xfe, 0x7c, 0x38, 0x10, 0x00, 0x00 },	// U+2193 (↓)
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x24, 0x66, 0xff, 0xff, 0x66, 0x24, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+2194 (↔)
 	{ 0x00, 0x00, 0x00, 0x10, 0x38, 0x7c, 0xfe, 0x38, 0x38, 0x38, 0xfe, 0x7c, 0x38, 0x10, 0x00, 0x00 },	// U+2195 (↕)
-}; // 6
-
-static const unsigned char veggie_block47[][16] = {
 	{ 0x00, 0x00, 0x00, 0x10, 0x38, 0x7c, 0xfe, 0x38, 0x38, 0x38, 0xfe, 0x7c, 0x38, 0xfe, 0x00, 0x00 },	// U+21A8 (↨)
-}; // 1
-
-static const unsigned char veggie_block48[][16] = {
 	{ 0x00, 0x00, 0x00, 0x00, 0xc0, 0xc0, 0xc8, 0xcc, 0xce, 0x7f, 0x0e, 0x0c, 0x08, 0x00, 0x00, 0x00 },	// U+21B5 (↵)
-}; // 1
-
-static const unsigned char veggie_block49[][16] = {
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x38, 0x38, 0x38, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+2219 (∙)
 	{ 0x00, 0x00, 0x00, 0x00, 0xc0, 0xc0, 0x60, 0x60, 0x30, 0x30, 0x1b, 0x1e, 0x0c, 0x00, 0x00, 0x00 },	// U+221A (√)
-}; // 2
-
-static const unsigned char veggie_block50[][16] = {
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x66, 0xdb, 0xdb, 0xdb, 0x66, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+221E (∞)
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0xfe, 0x00, 0x00, 0x00 },	// U+221F (∟)
-}; // 2
-
-static const unsigned char veggie_block51[][16] = {
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7c, 0xc6, 0xc6, 0xc6, 0xc6, 0xc6, 0xc6, 0x00, 0x00, 0x00 },	// U+2229 (∩)
-}; // 1
-
-static const unsigned char veggie_block52[][16] = {
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0c, 0x92, 0x6c, 0x92, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+2248 (≈)
-}; // 1
-
-static const unsigned char veggie_block53[][16] = {
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0xc0, 0x60, 0xfe, 0x38, 0xfe, 0x0c, 0x06, 0x00, 0x00, 0x00, 0x00 },	// U+2260 (≠)
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfe, 0x00, 0xfe, 0x00, 0xfe, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+2261 (≡)
-}; // 2
-
-static const unsigned char veggie_block54[][16] = {
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0xe0, 0x38, 0x0e, 0x38, 0xe0, 0x00, 0xfe, 0x00, 0x00, 0x00, 0x00 },	// U+2264 (≤)
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x0e, 0x38, 0xe0, 0x38, 0x0e, 0x00, 0xfe, 0x00, 0x00, 0x00, 0x00 },	// U+2265 (≥)
-}; // 2
-
-static const unsigned char veggie_block55[][16] = {
 	{ 0x00, 0x00, 0x00, 0x00, 0x10, 0x38, 0x6c, 0xc6, 0xc6, 0xc6, 0xc6, 0xc6, 0xfe, 0x00, 0x00, 0x00 },	// U+2302 (⌂)
-}; // 1
-
-static const unsigned char veggie_block56[][16] = {
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfe, 0x06, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+2310 (⌐)
-}; // 1
-
-static const unsigned char veggie_block57[][16] = {
 	{ 0x00, 0xf0, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18 },	// U+2320 (⌠)
 	{ 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x0f, 0x00 },	// U+2321 (⌡)
-}; // 2
-
-static const unsigned char veggie_block58[][16] = {
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+2500 (─)
-}; // 1
-
-static const unsigned char veggie_block59[][16] = {
 	{ 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18 },	// U+2502 (│)
-}; // 1
-
-static const unsigned char veggie_block60[][16] = {
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf0, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18 },	// U+250C (┌)
-}; // 1
-
-static const unsigned char veggie_block61[][16] = {
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0f, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18 },	// U+2510 (┐)
-}; // 1
-
-static const unsigned char veggie_block62[][16] = {
 	{ 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0xf0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+2514 (└)
-}; // 1
-
-static const unsigned char veggie_block63[][16] = {
 	{ 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+2518 (┘)
-}; // 1
-
-static const unsigned char veggie_block64[][16] = {
 	{ 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0xf8, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18 },	// U+251C (├)
-}; // 1
-
-static const unsigned char veggie_block65[][16] = {
 	{ 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x1f, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18 },	// U+2524 (┤)
-}; // 1
-
-static const unsigned char veggie_block66[][16] = {
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18 },	// U+252C (┬)
-}; // 1
-
-static const unsigned char veggie_block67[][16] = {
 	{ 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+2534 (┴)
-}; // 1
-
-static const unsigned char veggie_block68[][16] = {
 	{ 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0xff, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18 },	// U+253C (┼)
-}; // 1
-
-static const unsigned char veggie_block69[][16] = {
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x00, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+2550 (═)
 	{ 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c },	// U+2551 (║)
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf0, 0x18, 0xf8, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18 },	// U+2552 (╒)
@@ -800,114 +596,96 @@ static const unsigned char veggie_block69[][16] = {
 	{ 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0xff, 0x00, 0xff, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18 },	// U+256A (╪)
 	{ 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0xef, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c },	// U+256B (╫)
 	{ 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0xc7, 0x00, 0xc7, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c },	// U+256C (╬)
-}; // 29
-
-static const unsigned char veggie_block70[][16] = {
 	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+2580 (▀)
-}; // 1
-
-static const unsigned char veggie_block71[][16] = {
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },	// U+2584 (▄)
-}; // 1
-
-static const unsigned char veggie_block72[][16] = {
 	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },	// U+2588 (█)
-}; // 1
-
-static const unsigned char veggie_block73[][16] = {
 	{ 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f },	// U+258C (▌)
-}; // 1
-
-static const unsigned char veggie_block74[][16] = {
 	{ 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0 },	// U+2590 (▐)
 	{ 0x00, 0x49, 0x00, 0x92, 0x00, 0x24, 0x00, 0x49, 0x00, 0x92, 0x00, 0x24, 0x00, 0x49, 0x00, 0x92 },	// U+2591 (░)
 	{ 0x55, 0xaa, 0x55, 0xaa, 0x55, 0xaa, 0x55, 0xaa, 0x55, 0xaa, 0x55, 0xaa, 0x55, 0xaa, 0x55, 0xaa },	// U+2592 (▒)
 	{ 0xff, 0xb6, 0xff, 0x6d, 0xff, 0xdb, 0xff, 0xb6, 0xff, 0x6d, 0xff, 0xdb, 0xff, 0xb6, 0xff, 0x6d },	// U+2593 (▓)
-}; // 4
-
-static const unsigned char veggie_block75[][16] = {
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+25A0 (■)
-}; // 1
-
-static const unsigned char veggie_block76[][16] = {
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfe, 0xfe, 0xfe, 0x00, 0x00, 0x00 },	// U+25AC (▬)
-}; // 1
-
-static const unsigned char veggie_block77[][16] = {
 	{ 0x18, 0x18, 0x18, 0x18, 0x3c, 0x3c, 0x3c, 0x3c, 0x7e, 0x7e, 0x7e, 0x7e, 0xff, 0xff, 0xff, 0xff },	// U+25B2 (▲)
-}; // 1
-
-static const unsigned char veggie_block78[][16] = {
 	{ 0x01, 0x03, 0x07, 0x0f, 0x1f, 0x3f, 0x7f, 0xff, 0xff, 0x7f, 0x3f, 0x1f, 0x0f, 0x07, 0x03, 0x01 },	// U+25B6 (▶)
-}; // 1
-
-static const unsigned char veggie_block79[][16] = {
 	{ 0xff, 0xff, 0xff, 0xff, 0x7e, 0x7e, 0x7e, 0x7e, 0x3c, 0x3c, 0x3c, 0x3c, 0x18, 0x18, 0x18, 0x18 },	// U+25BC (▼)
-}; // 1
-
-static const unsigned char veggie_block80[][16] = {
 	{ 0x80, 0xc0, 0xe0, 0xf0, 0xf8, 0xfc, 0xfe, 0xff, 0xff, 0xfe, 0xfc, 0xf8, 0xf0, 0xe0, 0xc0, 0x80 },	// U+25C0 (◀)
-}; // 1
-
-static const unsigned char veggie_block81[][16] = {
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x24, 0x42, 0x42, 0x24, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+25CB (○)
-}; // 1
-
-static const unsigned char veggie_block82[][16] = {
 	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe7, 0xc3, 0xc3, 0xe7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },	// U+25D8 (◘)
 	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xe7, 0xdb, 0xbd, 0xbd, 0xdb, 0xe7, 0xff, 0xff, 0xff, 0xff, 0xff },	// U+25D9 (◙)
-}; // 2
-
-static const unsigned char veggie_block83[][16] = {
 	{ 0x00, 0x00, 0x00, 0x00, 0x6c, 0x6c, 0x00, 0x00, 0x00, 0x00, 0xc6, 0xc6, 0x7c, 0x00, 0x00, 0x00 },	// U+263A (☺)
 	{ 0x00, 0x00, 0x7c, 0xfe, 0x92, 0x92, 0xfe, 0xfe, 0xfe, 0xfe, 0x38, 0x38, 0x82, 0xfe, 0x7c, 0x00 },	// U+263B (☻)
 	{ 0x00, 0x00, 0x00, 0x00, 0x48, 0x29, 0x1a, 0xe4, 0x27, 0x58, 0x94, 0x12, 0x00, 0x00, 0x00, 0x00 },	// U+263C (☼)
-}; // 3
-
-static const unsigned char veggie_block84[][16] = {
 	{ 0x00, 0x00, 0x00, 0x7c, 0xc6, 0xc6, 0xc6, 0xc6, 0x7c, 0x10, 0x7c, 0x10, 0x10, 0x00, 0x00, 0x00 },	// U+2640 (♀)
-}; // 1
-
-static const unsigned char veggie_block85[][16] = {
 	{ 0x00, 0x00, 0x00, 0xf8, 0xe0, 0xf0, 0xd8, 0x7c, 0xc6, 0xc6, 0xc6, 0xc6, 0x7c, 0x00, 0x00, 0x00 },	// U+2642 (♂)
-}; // 1
-
-static const unsigned char veggie_block86[][16] = {
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x38, 0x7c, 0xfe, 0xfe, 0x6c, 0x10, 0x38, 0x00, 0x00, 0x00 },	// U+2660 (♠)
-}; // 1
-
-static const unsigned char veggie_block87[][16] = {
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x38, 0x38, 0x6c, 0xfe, 0x6c, 0x10, 0x38, 0x00, 0x00, 0x00 },	// U+2663 (♣)
-}; // 1
-
-static const unsigned char veggie_block88[][16] = {
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x6c, 0xfe, 0xfe, 0xfe, 0xfe, 0x7c, 0x38, 0x10, 0x00, 0x00, 0x00 },	// U+2665 (♥)
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x38, 0x7c, 0xfe, 0xfe, 0x7c, 0x38, 0x10, 0x00, 0x00, 0x00 },	// U+2666 (♦)
-}; // 2
-
-static const unsigned char veggie_block89[][16] = {
 	{ 0x00, 0x00, 0x00, 0x00, 0x18, 0x38, 0x78, 0xd8, 0xd8, 0x78, 0x1c, 0x1e, 0x0c, 0x00, 0x00, 0x00 },	// U+266A (♪)
 	{ 0x00, 0x00, 0x00, 0x00, 0x0c, 0xfc, 0xcc, 0xcc, 0xcc, 0xcc, 0xce, 0xef, 0xf6, 0xe0, 0x00, 0x00 },	// U+266B (♫)
-}; // 2
-
-static const unsigned char veggie_block90[][16] = {
 	{ 0x06, 0x06, 0x06, 0x06, 0x06, 0x30, 0x78, 0xfc, 0x30, 0x30, 0x18, 0x0c, 0x06, 0x06, 0x06, 0x06 },	// U+E0A0 ()
 	{ 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x7e, 0xcc, 0xcc, 0xdc, 0xdc, 0xec, 0xec, 0xcc, 0xcc },	// U+E0A1 ()
 	{ 0x00, 0x38, 0x6c, 0x6c, 0x6c, 0x6c, 0xfe, 0xfe, 0xee, 0xee, 0xee, 0xfe, 0xfe, 0xfe, 0x7c, 0x00 },	// U+E0A2 ()
-}; // 3
-
-static const unsigned char veggie_block91[][16] = {
 	{ 0x01, 0x03, 0x07, 0x0f, 0x1f, 0x3f, 0x7f, 0xff, 0xff, 0x7f, 0x3f, 0x1f, 0x0f, 0x07, 0x03, 0x01 },	// U+E0B0 ()
 	{ 0x01, 0x03, 0x06, 0x0c, 0x18, 0x30, 0x60, 0xc0, 0xc0, 0x60, 0x30, 0x18, 0x0c, 0x06, 0x03, 0x01 },	// U+E0B1 ()
 	{ 0x80, 0xc0, 0xe0, 0xf0, 0xf8, 0xfc, 0xfe, 0xff, 0xff, 0xfe, 0xfc, 0xf8, 0xf0, 0xe0, 0xc0, 0x80 },	// U+E0B2 ()
 	{ 0x80, 0xc0, 0x60, 0x30, 0x18, 0x0c, 0x06, 0x03, 0x03, 0x06, 0x0c, 0x18, 0x30, 0x60, 0xc0, 0x80 },	// U+E0B3 ()
-}; // 4
-
-static const unsigned char veggie_block92[][16] = {
 	{ 0x00, 0x00, 0x10, 0x38, 0x7c, 0xc2, 0x9e, 0x9e, 0xce, 0xfe, 0xe6, 0xe6, 0x7c, 0x38, 0x10, 0x00 },	// U+FFFD (�)
-}; // 1
-
-static const unsigned char veggie_block93[][16] = {
 	{ 0x00, 0x00, 0xfe, 0xc6, 0xc6, 0xee, 0xee, 0xd6, 0xee, 0xee, 0xc6, 0xc6, 0xfe, 0x00, 0x00, 0x00 },	// U+FFFF (￿)
-}; // 1
+}; // 628
+
+static const uint8_t veggie_page_index[] = {
+	0x01, 0x02, 0x03, 0x04, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x00,
+	0x07, 0x08, 0x09, 0x0a, 0x00, 0x0b, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x0d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0e,
+}; // 256
+
+static const uint32_t veggie_page_bits[][8] = {
+	{ 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000 },	// Empty
+	{ 0x00000000, 0xffffffff, 0xffffffff, 0x7fffffff, 0x00000000, 0xffffffff, 0xffffffff, 0xffffffff },	// U+00xx
+	{ 0xffcfffff, 0x7ff3cfff, 0xffff3dfe, 0x7fffffff, 0x00040000, 0x00000000, 0x00000000, 0x00000000 },	// U+01xx
+	{ 0x0f000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x2b000080, 0x00000000 },	// U+02xx
+	{ 0x00000000, 0x00000000, 0x00000000, 0x44000000, 0xffffd770, 0xfffffffb, 0x00007fff, 0x00000000 },	// U+03xx
+	{ 0xfffffffe, 0xffffffff, 0xfffeffff, 0x00000000, 0x00030000, 0x00000000, 0x00000000, 0x00000000 },	// U+04xx
+	{ 0xc0000c0c, 0x00000000, 0x00c00003, 0x00000c03, 0x0000003f, 0x00000000, 0x00000000, 0x000c0000 },	// U+1Exx
+	{ 0xfb200000, 0x30010047, 0x00000000, 0x80000000, 0x00000000, 0x00009080, 0x00000000, 0x00000000 },	// U+20xx
+	{ 0x00400000, 0x00000004, 0x00000000, 0x00000000, 0x003f0000, 0x00200100, 0x00000000, 0x00000000 },	// U+21xx
+	{ 0xc6000000, 0x00000200, 0x00000100, 0x00000033, 0x00000000, 0x00000000, 0x00000000, 0x00000000 },	// U+22xx
+	{ 0x00010004, 0x00000003, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000 },	// U+23xx
+	{ 0x11111005, 0x10101010, 0xffff0000, 0x00001fff, 0x000f1111, 0x10441001, 0x03000801, 0x00000000 },	// U+25xx
+	{ 0x00000000, 0x1c000000, 0x00000005, 0x00000c69, 0x00000000, 0x00000000, 0x00000000, 0x00000000 },	// U+26xx
+	{ 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x000f0007, 0x00000000, 0x00000000 },	// U+E0xx
+	{ 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xa0000000 },	// U+FFxx
+}; // 15
 
+static const uint16_t veggie_page_base[][8] = {
+	{ 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000 },	// Empty
+	{ 0x0000, 0x0000, 0x0020, 0x0040, 0x005f, 0x005f, 0x007f, 0x009f },	// U+00xx
+	{ 0x00bf, 0x00dd, 0x00f8, 0x0114, 0x0133, 0x0134, 0x0134, 0x0134 },	// U+01xx
+	{ 0x0134, 0x0138, 0x0138, 0x0138, 0x0138, 0x0138, 0x0138, 0x013d },	// U+02xx
+	{ 0x013d, 0x013d, 0x013d, 0x013d, 0x013f, 0x0158, 0x0177, 0x0186 },	// U+03xx
+	{ 0x0186, 0x01a5, 0x01c5, 0x01e4, 0x01e4, 0x01e6, 0x01e6, 0x01e6 },	// U+04xx
+	{ 0x01e6, 0x01ec, 0x01ec, 0x01f0, 0x01f4, 0x01fa, 0x01fa, 0x01fa },	// U+1Exx
+	{ 0x01fc, 0x0204, 0x020b, 0x020b, 0x020c, 0x020c, 0x020f, 0x020f },	// U+20xx
+	{ 0x020f, 0x0210, 0x0211, 0x0211, 0x0211, 0x0217, 0x0219, 0x0219 },	// U+21xx
+	{ 0x0219, 0x021d, 0x021e, 0x021f, 0x0223, 0x0223, 0x0223, 0x0223 },	// U+22xx
+	{ 0x0223, 0x0225, 0x0227, 0x0227, 0x0227, 0x0227, 0x0227, 0x0227 },	// U+23xx
+	{ 0x0227, 0x022e, 0x0232, 0x0242, 0x024f, 0x0257, 0x025c, 0x0260 },	// U+25xx
+	{ 0x0260, 0x0260, 0x0263, 0x0265, 0x026b, 0x026b, 0x026b, 0x026b },	// U+26xx
+	{ 0x026b, 0x026b, 0x026b, 0x026b, 0x026b, 0x026b, 0x0272, 0x0272 },	// U+E0xx
+	{ 0x0272, 0x0272, 0x0272, 0x0272, 0x0272, 0x0272, 0x0272, 0x0272 },	// U+FFxx
+}; // 15
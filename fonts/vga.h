@@ -4,7 +4,7 @@
 * With FBInk's tools/hextoc.py
 */
 
-static const unsigned char vga_block1[][16] = {
+static const unsigned char vga_glyphs[][16] = {
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+0000 (ESC)
 	{ 0x00, 0x00, 0x7e, 0x81, 0xa5, 0x81, 0x81, 0xbd, 0x99, 0x81, 0x81, 0x7e, 0x00, 0x00, 0x00, 0x00 },	// U+0001 (ESC)
 	{ 0x00, 0x00, 0x7e, 0xff, 0xdb, 0xff, 0xff, 0xc3, 0xe7, 0xff, 0xff, 0x7e, 0x00, 0x00, 0x00, 0x00 },	// U+0002 (ESC)
@@ -133,9 +133,6 @@ static const unsigned char vga_block1[][16] = {
 	{ 0x00, 0x00, 0x0e, 0x18, 0x18, 0x18, 0x70, 0x18, 0x18, 0x18, 0x18, 0x0e, 0x00, 0x00, 0x00, 0x00 },	// U+007D (})
 	{ 0x00, 0x00, 0x6e, 0x3b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+007E (~)
 	{ 0x00, 0x00, 0x00, 0x00, 0x08, 0x1c, 0x36, 0x63, 0x63, 0x63, 0x7f, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+007F ()
-}; // 128
-
-static const unsigned char vga_block2[][16] = {
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+00A0 ( )
 	{ 0x00, 0x00, 0x18, 0x18, 0x00, 0x18, 0x18, 0x18, 0x3c, 0x3c, 0x3c, 0x18, 0x00, 0x00, 0x00, 0x00 },	// U+00A1 (¡)
 	{ 0x00, 0x18, 0x18, 0x3c, 0x66, 0x06, 0x06, 0x06, 0x66, 0x3c, 0x18, 0x18, 0x00, 0x00, 0x00, 0x00 },	// U+00A2 (¢)
@@ -360,67 +357,31 @@ static const unsigned char vga_block2[][16] = {
 	{ 0x36, 0x1c, 0x00, 0x7f, 0x63, 0x31, 0x18, 0x0c, 0x06, 0x43, 0x63, 0x7f, 0x00, 0x00, 0x00, 0x00 },	// U+017D (Ž)
 	{ 0x00, 0x00, 0x36, 0x1c, 0x00, 0x7f, 0x33, 0x18, 0x0c, 0x06, 0x63, 0x7f, 0x00, 0x00, 0x00, 0x00 },	// U+017E (ž)
 	{ 0x00, 0x00, 0x38, 0x6c, 0x4c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x1e, 0x00, 0x00, 0x00, 0x00 },	// U+017F (ſ)
-}; // 224
-
-static const unsigned char vga_block3[][16] = {
 	{ 0x00, 0x70, 0xd8, 0x18, 0x18, 0x18, 0x7e, 0x18, 0x18, 0x18, 0x18, 0x18, 0x1b, 0x0e, 0x00, 0x00 },	// U+0192 (ƒ)
-}; // 1
-
-static const unsigned char vga_block4[][16] = {
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x7e, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x0e, 0x00, 0x00, 0x00, 0x00 },	// U+01A1 (ơ)
-}; // 1
-
-static const unsigned char vga_block5[][16] = {
 	{ 0x00, 0x00, 0x7f, 0x63, 0x30, 0x18, 0x3c, 0x60, 0x60, 0x60, 0x63, 0x3e, 0x00, 0x00, 0x00, 0x00 },	// U+01B7 (Ʒ)
-}; // 1
-
-static const unsigned char vga_block6[][16] = {
 	{ 0x5c, 0x36, 0x1c, 0x00, 0x1c, 0x36, 0x63, 0x63, 0x7f, 0x63, 0x63, 0x63, 0x00, 0x00, 0x00, 0x00 },	// U+01FA (Ǻ)
 	{ 0x30, 0x1c, 0x36, 0x1c, 0x00, 0x1e, 0x30, 0x3e, 0x33, 0x33, 0x33, 0x6e, 0x00, 0x00, 0x00, 0x00 },	// U+01FB (ǻ)
 	{ 0x30, 0x18, 0x00, 0x7c, 0x36, 0x33, 0x33, 0x7f, 0x33, 0x33, 0x33, 0x73, 0x00, 0x00, 0x00, 0x00 },	// U+01FC (Ǽ)
 	{ 0x00, 0x30, 0x18, 0x0c, 0x00, 0x33, 0x6e, 0x6c, 0x7e, 0x1b, 0x1b, 0x76, 0x00, 0x00, 0x00, 0x00 },	// U+01FD (ǽ)
 	{ 0x18, 0x0c, 0x20, 0x3e, 0x73, 0x73, 0x6b, 0x6b, 0x6b, 0x67, 0x67, 0x3e, 0x02, 0x00, 0x00, 0x00 },	// U+01FE (Ǿ)
 	{ 0x00, 0x18, 0x0c, 0x06, 0x00, 0x3e, 0x73, 0x7b, 0x6f, 0x67, 0x63, 0x3e, 0x00, 0x00, 0x00, 0x00 },	// U+01FF (ǿ)
-}; // 6
-
-static const unsigned char vga_block7[][16] = {
 	{ 0x00, 0x00, 0x3e, 0x63, 0x63, 0x06, 0x1c, 0x30, 0x60, 0x63, 0x63, 0x3e, 0x00, 0x18, 0x0c, 0x00 },	// U+0218 (Ș)
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x3e, 0x63, 0x06, 0x1c, 0x30, 0x63, 0x3e, 0x00, 0x18, 0x0c, 0x00 },	// U+0219 (ș)
 	{ 0x00, 0x00, 0x7e, 0x7e, 0x5a, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x3c, 0x00, 0x18, 0x0c, 0x00 },	// U+021A (Ț)
 	{ 0x00, 0x00, 0x08, 0x0c, 0x0c, 0x3f, 0x0c, 0x0c, 0x0c, 0x0c, 0x6c, 0x38, 0x00, 0x18, 0x0c, 0x00 },	// U+021B (ț)
-}; // 4
-
-static const unsigned char vga_block8[][16] = {
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x6e, 0x3b, 0x1b, 0x1b, 0x1b, 0x3b, 0x6e, 0x00, 0x00, 0x00, 0x00 },	// U+0251 (ɑ)
-}; // 1
-
-static const unsigned char vga_block9[][16] = {
 	{ 0x00, 0x00, 0x00, 0x7e, 0x18, 0x3c, 0x66, 0x66, 0x66, 0x3c, 0x18, 0x7e, 0x00, 0x00, 0x00, 0x00 },	// U+0278 (ɸ)
-}; // 1
-
-static const unsigned char vga_block10[][16] = {
 	{ 0x00, 0x08, 0x1c, 0x36, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+02C6 (ˆ)
 	{ 0x00, 0x36, 0x1c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+02C7 (ˇ)
-}; // 2
-
-static const unsigned char vga_block11[][16] = {
 	{ 0x00, 0x3e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+02C9 (ˉ)
-}; // 1
-
-static const unsigned char vga_block12[][16] = {
 	{ 0x00, 0x63, 0x3e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+02D8 (˘)
 	{ 0x00, 0x18, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+02D9 (˙)
 	{ 0x00, 0x1c, 0x36, 0x36, 0x1c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+02DA (˚)
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0c, 0x06, 0x3c, 0x00 },	// U+02DB (˛)
 	{ 0x00, 0x6e, 0x3b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+02DC (˜)
 	{ 0x00, 0x6c, 0x36, 0x1b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+02DD (˝)
-}; // 6
-
-static const unsigned char vga_block13[][16] = {
 	{ 0x00, 0x00, 0x00, 0x00, 0x18, 0x18, 0x00, 0x00, 0x00, 0x18, 0x18, 0x0c, 0x00, 0x00, 0x00, 0x00 },	// U+037E (;)
-}; // 1
-
-static const unsigned char vga_block14[][16] = {
 	{ 0x30, 0x18, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+0384 (΄)
 	{ 0x18, 0x0c, 0x00, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+0385 (΅)
 	{ 0x06, 0x03, 0x08, 0x1c, 0x36, 0x63, 0x63, 0x7f, 0x63, 0x63, 0x63, 0x63, 0x00, 0x00, 0x00, 0x00 },	// U+0386 (Ά)
@@ -428,13 +389,7 @@ static const unsigned char vga_block14[][16] = {
 	{ 0x06, 0x03, 0x00, 0x7f, 0x66, 0x46, 0x16, 0x1e, 0x16, 0x46, 0x66, 0x7f, 0x00, 0x00, 0x00, 0x00 },	// U+0388 (Έ)
 	{ 0x06, 0x03, 0x00, 0x63, 0x63, 0x63, 0x63, 0x7f, 0x63, 0x63, 0x63, 0x63, 0x00, 0x00, 0x00, 0x00 },	// U+0389 (Ή)
 	{ 0x06, 0x03, 0x00, 0x3c, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x3c, 0x00, 0x00, 0x00, 0x00 },	// U+038A (Ί)
-}; // 7
-
-static const unsigned char vga_block15[][16] = {
 	{ 0x06, 0x03, 0x00, 0x3e, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x3e, 0x00, 0x00, 0x00, 0x00 },	// U+038C (Ό)
-}; // 1
-
-static const unsigned char vga_block16[][16] = {
 	{ 0x06, 0x03, 0x00, 0x66, 0x66, 0x66, 0x66, 0x3c, 0x18, 0x18, 0x18, 0x3c, 0x00, 0x00, 0x00, 0x00 },	// U+038E (Ύ)
 	{ 0x06, 0x03, 0x00, 0x1c, 0x36, 0x63, 0x63, 0x63, 0x63, 0x36, 0x36, 0x77, 0x00, 0x00, 0x00, 0x00 },	// U+038F (Ώ)
 	{ 0x18, 0x0c, 0x00, 0x33, 0x00, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x2c, 0x18, 0x00, 0x00, 0x00, 0x00 },	// U+0390 (ΐ)
@@ -455,9 +410,6 @@ static const unsigned char vga_block16[][16] = {
 	{ 0x00, 0x00, 0x3e, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x3e, 0x00, 0x00, 0x00, 0x00 },	// U+039F (Ο)
 	{ 0x00, 0x00, 0x7f, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x00, 0x00, 0x00, 0x00 },	// U+03A0 (Π)
 	{ 0x00, 0x00, 0x3f, 0x66, 0x66, 0x66, 0x3e, 0x06, 0x06, 0x06, 0x06, 0x0f, 0x00, 0x00, 0x00, 0x00 },	// U+03A1 (Ρ)
-}; // 20
-
-static const unsigned char vga_block17[][16] = {
 	{ 0x00, 0x00, 0x7f, 0x63, 0x46, 0x0c, 0x18, 0x18, 0x0c, 0x46, 0x63, 0x7f, 0x00, 0x00, 0x00, 0x00 },	// U+03A3 (Σ)
 	{ 0x00, 0x00, 0x7e, 0x7e, 0x5a, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x3c, 0x00, 0x00, 0x00, 0x00 },	// U+03A4 (Τ)
 	{ 0x00, 0x00, 0x66, 0x66, 0x66, 0x66, 0x3c, 0x18, 0x18, 0x18, 0x18, 0x3c, 0x00, 0x00, 0x00, 0x00 },	// U+03A5 (Υ)
@@ -502,17 +454,8 @@ static const unsigned char vga_block17[][16] = {
 	{ 0x00, 0x00, 0x30, 0x18, 0x00, 0x3e, 0x63, 0x63, 0x63, 0x63, 0x63, 0x3e, 0x00, 0x00, 0x00, 0x00 },	// U+03CC (ό)
 	{ 0x00, 0x00, 0x30, 0x18, 0x00, 0x73, 0x33, 0x33, 0x33, 0x33, 0x33, 0x1e, 0x00, 0x00, 0x00, 0x00 },	// U+03CD (ύ)
 	{ 0x00, 0x00, 0x30, 0x18, 0x00, 0x22, 0x63, 0x63, 0x6b, 0x6b, 0x6b, 0x36, 0x00, 0x00, 0x00, 0x00 },	// U+03CE (ώ)
-}; // 44
-
-static const unsigned char vga_block18[][16] = {
 	{ 0x00, 0x00, 0x1e, 0x33, 0x33, 0x33, 0x1b, 0x33, 0x63, 0x63, 0x63, 0x33, 0x00, 0x00, 0x00, 0x00 },	// U+03D0 (ϐ)
-}; // 1
-
-static const unsigned char vga_block19[][16] = {
 	{ 0x00, 0x00, 0x00, 0x1c, 0x36, 0x63, 0x63, 0x7f, 0x63, 0x63, 0x36, 0x1c, 0x00, 0x00, 0x00, 0x00 },	// U+03F4 (ϴ)
-}; // 1
-
-static const unsigned char vga_block20[][16] = {
 	{ 0x0c, 0x18, 0x00, 0x7f, 0x66, 0x46, 0x16, 0x1e, 0x16, 0x46, 0x66, 0x7f, 0x00, 0x00, 0x00, 0x00 },	// U+0400 (Ѐ)
 	{ 0x00, 0x63, 0x00, 0x7f, 0x66, 0x46, 0x16, 0x1e, 0x16, 0x46, 0x66, 0x7f, 0x00, 0x00, 0x00, 0x00 },	// U+0401 (Ё)
 	{ 0x00, 0x00, 0x3f, 0x26, 0x06, 0x36, 0x6e, 0x66, 0x66, 0x66, 0x66, 0x67, 0x30, 0x00, 0x00, 0x00 },	// U+0402 (Ђ)
@@ -609,18 +552,9 @@ static const unsigned char vga_block20[][16] = {
 	{ 0x00, 0x06, 0x0c, 0x18, 0x00, 0x63, 0x63, 0x73, 0x7b, 0x6f, 0x67, 0x63, 0x00, 0x00, 0x00, 0x00 },	// U+045D (ѝ)
 	{ 0x00, 0x00, 0x36, 0x1c, 0x00, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x7e, 0x60, 0x30, 0x1f, 0x00 },	// U+045E (ў)
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x77, 0x36, 0x36, 0x36, 0x36, 0x36, 0x7f, 0x08, 0x08, 0x00, 0x00 },	// U+045F (џ)
-}; // 96
-
-static const unsigned char vga_block21[][16] = {
 	{ 0x40, 0x60, 0x7f, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x0f, 0x00, 0x00, 0x00, 0x00 },	// U+0490 (Ґ)
 	{ 0x00, 0x00, 0x00, 0x40, 0x60, 0x7f, 0x06, 0x06, 0x06, 0x06, 0x06, 0x0f, 0x00, 0x00, 0x00, 0x00 },	// U+0491 (ґ)
-}; // 2
-
-static const unsigned char vga_block22[][16] = {
 	{ 0x00, 0x00, 0x00, 0x00, 0x7e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+05BE (־)
-}; // 1
-
-static const unsigned char vga_block23[][16] = {
 	{ 0x00, 0x00, 0x00, 0x00, 0x63, 0x63, 0x66, 0x6e, 0x3b, 0x33, 0x63, 0x63, 0x00, 0x00, 0x00, 0x00 },	// U+05D0 (א)
 	{ 0x00, 0x00, 0x00, 0x00, 0x1f, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x7f, 0x00, 0x00, 0x00, 0x00 },	// U+05D1 (ב)
 	{ 0x00, 0x00, 0x00, 0x00, 0x1c, 0x30, 0x30, 0x30, 0x30, 0x38, 0x6c, 0x67, 0x00, 0x00, 0x00, 0x00 },	// U+05D2 (ג)
@@ -648,58 +582,28 @@ static const unsigned char vga_block23[][16] = {
 	{ 0x00, 0x00, 0x00, 0x00, 0x3f, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x00, 0x00, 0x00, 0x00 },	// U+05E8 (ר)
 	{ 0x00, 0x00, 0x00, 0x00, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6f, 0x63, 0x3e, 0x00, 0x00, 0x00, 0x00 },	// U+05E9 (ש)
 	{ 0x00, 0x00, 0x00, 0x00, 0x3f, 0x66, 0x66, 0x66, 0x66, 0x66, 0x67, 0x67, 0x00, 0x00, 0x00, 0x00 },	// U+05EA (ת)
-}; // 27
-
-static const unsigned char vga_block24[][16] = {
 	{ 0x00, 0x00, 0x00, 0x00, 0x33, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x00, 0x00, 0x00, 0x00 },	// U+05F0 (װ)
 	{ 0x00, 0x00, 0x00, 0x00, 0x33, 0x66, 0x66, 0x66, 0x60, 0x60, 0x60, 0x60, 0x00, 0x00, 0x00, 0x00 },	// U+05F1 (ױ)
 	{ 0x00, 0x00, 0x00, 0x00, 0x33, 0x66, 0x66, 0x66, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+05F2 (ײ)
 	{ 0x00, 0x00, 0x00, 0x18, 0x18, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+05F3 (׳)
 	{ 0x00, 0x00, 0x00, 0x66, 0x66, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+05F4 (״)
-}; // 5
-
-static const unsigned char vga_block25[][16] = {
 	{ 0x00, 0x00, 0x00, 0x00, 0x6e, 0x3b, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x00, 0x00, 0x00, 0x00 },	// U+1D1B (ᴛ)
-}; // 1
-
-static const unsigned char vga_block26[][16] = {
 	{ 0x00, 0x00, 0x7f, 0x63, 0x63, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x00, 0x00, 0x00, 0x00 },	// U+1D26 (ᴦ)
-}; // 1
-
-static const unsigned char vga_block27[][16] = {
 	{ 0x00, 0x00, 0x00, 0x00, 0x7f, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x00, 0x00, 0x00, 0x00 },	// U+1D28 (ᴨ)
-}; // 1
-
-static const unsigned char vga_block28[][16] = {
 	{ 0x0c, 0x18, 0x00, 0x63, 0x63, 0x63, 0x6b, 0x6b, 0x6b, 0x7f, 0x77, 0x36, 0x00, 0x00, 0x00, 0x00 },	// U+1E80 (Ẁ)
 	{ 0x00, 0x06, 0x0c, 0x18, 0x00, 0x63, 0x63, 0x6b, 0x6b, 0x6b, 0x7f, 0x36, 0x00, 0x00, 0x00, 0x00 },	// U+1E81 (ẁ)
 	{ 0x18, 0x0c, 0x00, 0x63, 0x63, 0x63, 0x6b, 0x6b, 0x6b, 0x7f, 0x77, 0x36, 0x00, 0x00, 0x00, 0x00 },	// U+1E82 (Ẃ)
 	{ 0x00, 0x18, 0x0c, 0x06, 0x00, 0x63, 0x63, 0x6b, 0x6b, 0x6b, 0x7f, 0x36, 0x00, 0x00, 0x00, 0x00 },	// U+1E83 (ẃ)
 	{ 0x00, 0x63, 0x00, 0x63, 0x63, 0x63, 0x6b, 0x6b, 0x6b, 0x7f, 0x77, 0x36, 0x00, 0x00, 0x00, 0x00 },	// U+1E84 (Ẅ)
 	{ 0x00, 0x00, 0x63, 0x00, 0x00, 0x63, 0x63, 0x6b, 0x6b, 0x6b, 0x7f, 0x36, 0x00, 0x00, 0x00, 0x00 },	// U+1E85 (ẅ)
-}; // 6
-
-static const unsigned char vga_block29[][16] = {
 	{ 0x00, 0x00, 0x78, 0x0c, 0x18, 0x30, 0x7c, 0x66, 0x66, 0x66, 0x66, 0x3c, 0x00, 0x00, 0x00, 0x00 },	// U+1E9F (ẟ)
-}; // 1
-
-static const unsigned char vga_block30[][16] = {
 	{ 0x0c, 0x18, 0x00, 0x66, 0x66, 0x66, 0x66, 0x3c, 0x18, 0x18, 0x18, 0x3c, 0x00, 0x00, 0x00, 0x00 },	// U+1EF2 (Ỳ)
 	{ 0x00, 0x06, 0x0c, 0x18, 0x00, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x7e, 0x60, 0x30, 0x1f, 0x00 },	// U+1EF3 (ỳ)
-}; // 2
-
-static const unsigned char vga_block31[][16] = {
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+2010 (‐)
-}; // 1
-
-static const unsigned char vga_block32[][16] = {
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+2012 (‒)
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+2013 (–)
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+2014 (—)
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+2015 (―)
-}; // 4
-
-static const unsigned char vga_block33[][16] = {
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x00, 0xff, 0x00 },	// U+2017 (‗)
 	{ 0x00, 0x18, 0x0c, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+2018 (‘)
 	{ 0x00, 0x18, 0x18, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+2019 (’)
@@ -712,50 +616,20 @@ static const unsigned char vga_block33[][16] = {
 	{ 0x00, 0x18, 0x18, 0x18, 0x18, 0x7e, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x00, 0x00 },	// U+2020 (†)
 	{ 0x00, 0x18, 0x18, 0x18, 0x18, 0x7e, 0x18, 0x18, 0x18, 0x7e, 0x18, 0x18, 0x18, 0x18, 0x00, 0x00 },	// U+2021 (‡)
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x3c, 0x3c, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+2022 (•)
-}; // 12
-
-static const unsigned char vga_block34[][16] = {
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xdb, 0xdb, 0x00, 0x00, 0x00, 0x00 },	// U+2026 (…)
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+2027 (‧)
-}; // 2
-
-static const unsigned char vga_block35[][16] = {
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x63, 0x33, 0x18, 0x0c, 0x06, 0xdb, 0xd8, 0x00, 0x00, 0x00, 0x00 },	// U+2030 (‰)
-}; // 1
-
-static const unsigned char vga_block36[][16] = {
 	{ 0x00, 0x30, 0x18, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+2032 (′)
 	{ 0x00, 0x6c, 0x36, 0x1b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+2033 (″)
-}; // 2
-
-static const unsigned char vga_block37[][16] = {
 	{ 0x00, 0x0c, 0x18, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+2035 (‵)
-}; // 1
-
-static const unsigned char vga_block38[][16] = {
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0x18, 0x0c, 0x18, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+2039 (‹)
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x0c, 0x18, 0x30, 0x18, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+203A (›)
-}; // 2
-
-static const unsigned char vga_block39[][16] = {
 	{ 0x00, 0x00, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x00, 0x66, 0x66, 0x00, 0x00, 0x00, 0x00 },	// U+203C (‼)
-}; // 1
-
-static const unsigned char vga_block40[][16] = {
 	{ 0x00, 0x7e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+203E (‾)
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x63, 0x3e, 0x00 },	// U+203F (‿)
 	{ 0x00, 0x3e, 0x63, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+2040 (⁀)
-}; // 3
-
-static const unsigned char vga_block41[][16] = {
 	{ 0x00, 0x00, 0x00, 0x00, 0x40, 0x60, 0x30, 0x18, 0x0c, 0x06, 0x03, 0x01, 0x00, 0x00, 0x00, 0x00 },	// U+2044 (⁄)
-}; // 1
-
-static const unsigned char vga_block42[][16] = {
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3e, 0x63, 0x00 },	// U+2054 (⁔)
-}; // 1
-
-static const unsigned char vga_block43[][16] = {
 	{ 0x00, 0x18, 0x1c, 0x1a, 0x1f, 0x18, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+2074 (⁴)
 	{ 0x00, 0x1f, 0x03, 0x0f, 0x18, 0x18, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+2075 (⁵)
 	{ 0x00, 0x0e, 0x03, 0x0f, 0x1b, 0x1b, 0x0e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+2076 (⁶)
@@ -764,13 +638,7 @@ static const unsigned char vga_block43[][16] = {
 	{ 0x00, 0x0e, 0x1b, 0x1b, 0x1e, 0x18, 0x0e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+2079 (⁹)
 	{ 0x00, 0x0c, 0x0c, 0x3f, 0x0c, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+207A (⁺)
 	{ 0x00, 0x00, 0x00, 0x3e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+207B (⁻)
-}; // 8
-
-static const unsigned char vga_block44[][16] = {
 	{ 0x00, 0x1b, 0x36, 0x36, 0x36, 0x36, 0x36, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+207F (ⁿ)
-}; // 1
-
-static const unsigned char vga_block45[][16] = {
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0c, 0x0e, 0x0c, 0x0c, 0x0c, 0x1e, 0x00 },	// U+2081 (₁)
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0e, 0x1b, 0x0c, 0x06, 0x13, 0x1f, 0x00 },	// U+2082 (₂)
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0f, 0x18, 0x0e, 0x18, 0x18, 0x0f, 0x00 },	// U+2083 (₃)
@@ -782,55 +650,19 @@ static const unsigned char vga_block45[][16] = {
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0e, 0x1b, 0x1b, 0x1e, 0x18, 0x0e, 0x00 },	// U+2089 (₉)
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0c, 0x0c, 0x3f, 0x0c, 0x0c, 0x00 },	// U+208A (₊)
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3e, 0x00, 0x00, 0x00 },	// U+208B (₋)
-}; // 11
-
-static const unsigned char vga_block46[][16] = {
 	{ 0x00, 0x00, 0x7f, 0x66, 0x46, 0x16, 0x1e, 0x16, 0x06, 0x0f, 0x06, 0x0f, 0x00, 0x00, 0x00, 0x00 },	// U+20A3 (₣)
 	{ 0x00, 0x1c, 0x36, 0x26, 0x06, 0x0f, 0x06, 0x0f, 0x06, 0x06, 0x67, 0x3f, 0x00, 0x00, 0x00, 0x00 },	// U+20A4 (₤)
-}; // 2
-
-static const unsigned char vga_block47[][16] = {
 	{ 0x00, 0x1f, 0x33, 0x33, 0x1f, 0x23, 0x33, 0x7b, 0x33, 0x33, 0x33, 0x63, 0x00, 0x00, 0x00, 0x00 },	// U+20A7 (₧)
-}; // 1
-
-static const unsigned char vga_block48[][16] = {
 	{ 0x00, 0x00, 0x00, 0x00, 0x5f, 0x51, 0x55, 0x55, 0x55, 0x45, 0x7d, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+20AA (₪)
-}; // 1
-
-static const unsigned char vga_block49[][16] = {
 	{ 0x00, 0x00, 0x00, 0x38, 0x6c, 0x06, 0x3f, 0x06, 0x1f, 0x06, 0x6c, 0x38, 0x00, 0x00, 0x00, 0x00 },	// U+20AC (€)
-}; // 1
-
-static const unsigned char vga_block50[][16] = {
 	{ 0x00, 0x06, 0x0b, 0x43, 0x6b, 0x36, 0x18, 0x0c, 0x06, 0x3b, 0x6d, 0x6c, 0x6c, 0x38, 0x00, 0x00 },	// U+2105 (℅)
-}; // 1
-
-static const unsigned char vga_block51[][16] = {
 	{ 0x00, 0x00, 0x08, 0x1c, 0x36, 0x36, 0x36, 0x36, 0x1c, 0x0c, 0x5a, 0x30, 0x00, 0x00, 0x00, 0x00 },	// U+2113 (ℓ)
-}; // 1
-
-static const unsigned char vga_block52[][16] = {
 	{ 0x00, 0x00, 0xf1, 0xb3, 0xb7, 0xff, 0x3f, 0xfb, 0x33, 0x33, 0x33, 0x33, 0x00, 0x00, 0x00, 0x00 },	// U+2116 (№)
-}; // 1
-
-static const unsigned char vga_block53[][16] = {
 	{ 0x00, 0x8f, 0xda, 0xaa, 0x8a, 0x8a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+2122 (™)
-}; // 1
-
-static const unsigned char vga_block54[][16] = {
 	{ 0x00, 0x00, 0x1c, 0x36, 0x63, 0x63, 0x63, 0x36, 0x36, 0x36, 0x36, 0x77, 0x00, 0x00, 0x00, 0x00 },	// U+2126 (Ω)
-}; // 1
-
-static const unsigned char vga_block55[][16] = {
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x3e, 0x63, 0x7f, 0x03, 0x03, 0x63, 0x3e, 0x00, 0x00, 0x00, 0x00 },	// U+212E (℮)
-}; // 1
-
-static const unsigned char vga_block56[][16] = {
 	{ 0x00, 0x03, 0x03, 0x43, 0x63, 0x33, 0x18, 0x0c, 0x06, 0x7b, 0x61, 0x30, 0x18, 0x18, 0x00, 0x00 },	// U+2150 (⅐)
 	{ 0x00, 0x03, 0x03, 0x43, 0x63, 0x33, 0x18, 0x0c, 0x06, 0x3b, 0x6d, 0x78, 0x60, 0x38, 0x00, 0x00 },	// U+2151 (⅑)
-}; // 2
-
-static const unsigned char vga_block57[][16] = {
 	{ 0x00, 0x03, 0x03, 0x43, 0x63, 0x33, 0x18, 0x0c, 0x06, 0x3b, 0x61, 0x38, 0x60, 0x38, 0x00, 0x00 },	// U+2153 (⅓)
 	{ 0x00, 0x07, 0x0c, 0x46, 0x63, 0x3f, 0x18, 0x0c, 0x06, 0x3b, 0x61, 0x38, 0x60, 0x38, 0x00, 0x00 },	// U+2154 (⅔)
 	{ 0x00, 0x03, 0x03, 0x43, 0x63, 0x33, 0x18, 0x0c, 0x06, 0x7b, 0x19, 0x38, 0x60, 0x38, 0x00, 0x00 },	// U+2155 (⅕)
@@ -843,145 +675,49 @@ static const unsigned char vga_block57[][16] = {
 	{ 0x00, 0x07, 0x0c, 0x47, 0x6c, 0x37, 0x18, 0x0c, 0x06, 0x3b, 0x6d, 0x38, 0x6c, 0x38, 0x00, 0x00 },	// U+215C (⅜)
 	{ 0x00, 0x0f, 0x03, 0x47, 0x6c, 0x37, 0x18, 0x0c, 0x06, 0x3b, 0x6d, 0x38, 0x6c, 0x38, 0x00, 0x00 },	// U+215D (⅝)
 	{ 0x00, 0x0f, 0x0c, 0x46, 0x63, 0x33, 0x18, 0x0c, 0x06, 0x3b, 0x6d, 0x38, 0x6c, 0x38, 0x00, 0x00 },	// U+215E (⅞)
-}; // 12
-
-static const unsigned char vga_block58[][16] = {
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x0c, 0x06, 0x7f, 0x06, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+2190 (←)
 	{ 0x00, 0x00, 0x18, 0x3c, 0x7e, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x00, 0x00, 0x00, 0x00 },	// U+2191 (↑)
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x30, 0x7f, 0x30, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+2192 (→)
 	{ 0x00, 0x00, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x7e, 0x3c, 0x18, 0x00, 0x00, 0x00, 0x00 },	// U+2193 (↓)
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x14, 0x36, 0x7f, 0x36, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+2194 (↔)
 	{ 0x00, 0x00, 0x18, 0x3c, 0x7e, 0x18, 0x18, 0x18, 0x7e, 0x3c, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+2195 (↕)
-}; // 6
-
-static const unsigned char vga_block59[][16] = {
 	{ 0x00, 0x00, 0x18, 0x3c, 0x7e, 0x18, 0x18, 0x18, 0x7e, 0x3c, 0x18, 0x7e, 0x00, 0x00, 0x00, 0x00 },	// U+21A8 (↨)
-}; // 1
-
-static const unsigned char vga_block60[][16] = {
 	{ 0x00, 0x00, 0x1c, 0x36, 0x60, 0x60, 0x7c, 0x66, 0x63, 0x63, 0x33, 0x1e, 0x00, 0x00, 0x00, 0x00 },	// U+2202 (∂)
-}; // 1
-
-static const unsigned char vga_block61[][16] = {
 	{ 0x00, 0x00, 0x00, 0xc0, 0x60, 0x7e, 0xdb, 0xdb, 0xcf, 0x7e, 0x06, 0x03, 0x00, 0x00, 0x00, 0x00 },	// U+2205 (∅)
 	{ 0x00, 0x00, 0x00, 0x08, 0x1c, 0x36, 0x63, 0x63, 0x63, 0x63, 0x7f, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+2206 (∆)
-}; // 2
-
-static const unsigned char vga_block62[][16] = {
 	{ 0x00, 0x00, 0x38, 0x0c, 0x06, 0x06, 0x3e, 0x06, 0x06, 0x06, 0x0c, 0x38, 0x00, 0x00, 0x00, 0x00 },	// U+2208 (∈)
-}; // 1
-
-static const unsigned char vga_block63[][16] = {
 	{ 0x00, 0x00, 0x7f, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x00, 0x00 },	// U+220F (∏)
-}; // 1
-
-static const unsigned char vga_block64[][16] = {
 	{ 0x00, 0x00, 0x00, 0x7f, 0x63, 0x06, 0x0c, 0x18, 0x0c, 0x06, 0x63, 0x7f, 0x00, 0x00, 0x00, 0x00 },	// U+2211 (∑)
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+2212 (−)
-}; // 2
-
-static const unsigned char vga_block65[][16] = {
 	{ 0x00, 0x00, 0x00, 0x00, 0x40, 0x60, 0x30, 0x18, 0x0c, 0x06, 0x03, 0x01, 0x00, 0x00, 0x00, 0x00 },	// U+2215 (∕)
-}; // 1
-
-static const unsigned char vga_block66[][16] = {
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+2219 (∙)
 	{ 0x00, 0xf0, 0x30, 0x30, 0x30, 0x30, 0x30, 0x37, 0x36, 0x36, 0x3c, 0x38, 0x00, 0x00, 0x00, 0x00 },	// U+221A (√)
-}; // 2
-
-static const unsigned char vga_block67[][16] = {
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x7e, 0xdb, 0xdb, 0xdb, 0x7e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+221E (∞)
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x03, 0x03, 0x7f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+221F (∟)
-}; // 2
-
-static const unsigned char vga_block68[][16] = {
 	{ 0x00, 0x00, 0x00, 0x3e, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x00, 0x00, 0x00, 0x00 },	// U+2229 (∩)
-}; // 1
-
-static const unsigned char vga_block69[][16] = {
 	{ 0x70, 0xd8, 0xd8, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x1b, 0x1b, 0x1b, 0x0e },	// U+222B (∫)
-}; // 1
-
-static const unsigned char vga_block70[][16] = {
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x6e, 0x3b, 0x00, 0x6e, 0x3b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+2248 (≈)
-}; // 1
-
-static const unsigned char vga_block71[][16] = {
 	{ 0x00, 0x00, 0x00, 0x60, 0x30, 0x7f, 0x18, 0x0c, 0x7f, 0x06, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+2260 (≠)
 	{ 0x00, 0x00, 0x00, 0x00, 0x7f, 0x00, 0x00, 0x7f, 0x00, 0x00, 0x7f, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+2261 (≡)
-}; // 2
-
-static const unsigned char vga_block72[][16] = {
 	{ 0x00, 0x00, 0x00, 0x30, 0x18, 0x0c, 0x06, 0x0c, 0x18, 0x30, 0x00, 0x7e, 0x00, 0x00, 0x00, 0x00 },	// U+2264 (≤)
 	{ 0x00, 0x00, 0x00, 0x0c, 0x18, 0x30, 0x60, 0x30, 0x18, 0x0c, 0x00, 0x7e, 0x00, 0x00, 0x00, 0x00 },	// U+2265 (≥)
-}; // 2
-
-static const unsigned char vga_block73[][16] = {
 	{ 0x00, 0x00, 0x3e, 0x63, 0x63, 0x63, 0x6b, 0x6b, 0x63, 0x63, 0x63, 0x3e, 0x00, 0x00, 0x00, 0x00 },	// U+2299 (⊙)
-}; // 1
-
-static const unsigned char vga_block74[][16] = {
 	{ 0x00, 0x00, 0x3e, 0x63, 0x63, 0x73, 0x7b, 0x6f, 0x67, 0x63, 0x63, 0x3e, 0x00, 0x00, 0x00, 0x00 },	// U+2300 (⌀)
-}; // 1
-
-static const unsigned char vga_block75[][16] = {
 	{ 0x00, 0x00, 0x00, 0x00, 0x08, 0x1c, 0x36, 0x63, 0x63, 0x63, 0x7f, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+2302 (⌂)
-}; // 1
-
-static const unsigned char vga_block76[][16] = {
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7f, 0x03, 0x03, 0x03, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+2310 (⌐)
-}; // 1
-
-static const unsigned char vga_block77[][16] = {
 	{ 0x00, 0x00, 0x70, 0xd8, 0xd8, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18 },	// U+2320 (⌠)
 	{ 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x1b, 0x1b, 0x1b, 0x0e, 0x00, 0x00, 0x00, 0x00 },	// U+2321 (⌡)
-}; // 2
-
-static const unsigned char vga_block78[][16] = {
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+2500 (─)
-}; // 1
-
-static const unsigned char vga_block79[][16] = {
 	{ 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18 },	// U+2502 (│)
-}; // 1
-
-static const unsigned char vga_block80[][16] = {
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf8, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18 },	// U+250C (┌)
-}; // 1
-
-static const unsigned char vga_block81[][16] = {
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1f, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18 },	// U+2510 (┐)
-}; // 1
-
-static const unsigned char vga_block82[][16] = {
 	{ 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0xf8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+2514 (└)
-}; // 1
-
-static const unsigned char vga_block83[][16] = {
 	{ 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+2518 (┘)
-}; // 1
-
-static const unsigned char vga_block84[][16] = {
 	{ 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0xf8, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18 },	// U+251C (├)
-}; // 1
-
-static const unsigned char vga_block85[][16] = {
 	{ 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x1f, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18 },	// U+2524 (┤)
-}; // 1
-
-static const unsigned char vga_block86[][16] = {
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18 },	// U+252C (┬)
-}; // 1
-
-static const unsigned char vga_block87[][16] = {
 	{ 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+2534 (┴)
-}; // 1
-
-static const unsigned char vga_block88[][16] = {
 	{ 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0xff, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18 },	// U+253C (┼)
-}; // 1
-
-static const unsigned char vga_block89[][16] = {
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x00, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+2550 (═)
 	{ 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c },	// U+2551 (║)
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0xf8, 0x18, 0xf8, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18 },	// U+2552 (╒)
@@ -1011,9 +747,6 @@ static const unsigned char vga_block89[][16] = {
 	{ 0x18, 0x18, 0x18, 0x18, 0x18, 0xff, 0x18, 0xff, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18 },	// U+256A (╪)
 	{ 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0xff, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c },	// U+256B (╫)
 	{ 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0xef, 0x00, 0xef, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c },	// U+256C (╬)
-}; // 29
-
-static const unsigned char vga_block90[][16] = {
 	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+2580 (▀)
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff },	// U+2581 (▁)
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff },	// U+2582 (▂)
@@ -1048,90 +781,93 @@ static const unsigned char vga_block90[][16] = {
 	{ 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },	// U+259F (▟)
 	{ 0x00, 0x00, 0x00, 0x00, 0x3e, 0x3e, 0x3e, 0x3e, 0x3e, 0x3e, 0x3e, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+25A0 (■)
 	{ 0x00, 0x00, 0x00, 0x00, 0x7e, 0x66, 0x66, 0x66, 0x66, 0x66, 0x7e, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+25A1 (□)
-}; // 34
-
-static const unsigned char vga_block91[][16] = {
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3e, 0x3e, 0x3e, 0x3e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+25AA (▪)
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3e, 0x36, 0x36, 0x3e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+25AB (▫)
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7f, 0x7f, 0x7f, 0x7f, 0x00, 0x00, 0x00, 0x00 },	// U+25AC (▬)
-}; // 3
-
-static const unsigned char vga_block92[][16] = {
 	{ 0x00, 0x00, 0x00, 0x00, 0x08, 0x1c, 0x1c, 0x3e, 0x3e, 0x7f, 0x7f, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+25B2 (▲)
-}; // 1
-
-static const unsigned char vga_block93[][16] = {
 	{ 0x00, 0x01, 0x03, 0x07, 0x0f, 0x1f, 0x7f, 0x1f, 0x0f, 0x07, 0x03, 0x01, 0x00, 0x00, 0x00, 0x00 },	// U+25BA (►)
-}; // 1
-
-static const unsigned char vga_block94[][16] = {
 	{ 0x00, 0x00, 0x00, 0x00, 0x7f, 0x7f, 0x3e, 0x3e, 0x1c, 0x1c, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+25BC (▼)
-}; // 1
-
-static const unsigned char vga_block95[][16] = {
 	{ 0x00, 0x40, 0x60, 0x70, 0x78, 0x7c, 0x7f, 0x7c, 0x78, 0x70, 0x60, 0x40, 0x00, 0x00, 0x00, 0x00 },	// U+25C4 (◄)
-}; // 1
-
-static const unsigned char vga_block96[][16] = {
 	{ 0x00, 0x00, 0x00, 0x00, 0x08, 0x1c, 0x36, 0x63, 0x36, 0x1c, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+25CA (◊)
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x3c, 0x66, 0x42, 0x42, 0x66, 0x3c, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+25CB (○)
-}; // 2
-
-static const unsigned char vga_block97[][16] = {
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x3c, 0x7e, 0x7e, 0x7e, 0x7e, 0x3c, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+25CF (●)
-}; // 1
-
-static const unsigned char vga_block98[][16] = {
 	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe7, 0xc3, 0xc3, 0xe7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },	// U+25D8 (◘)
 	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xc3, 0x99, 0xbd, 0xbd, 0x99, 0xc3, 0xff, 0xff, 0xff, 0xff, 0xff },	// U+25D9 (◙)
-}; // 2
-
-static const unsigned char vga_block99[][16] = {
 	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1c, 0x36, 0x36, 0x1c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+25E6 (◦)
-}; // 1
-
-static const unsigned char vga_block100[][16] = {
 	{ 0x00, 0x00, 0x7e, 0x81, 0xa5, 0x81, 0x81, 0xbd, 0x99, 0x81, 0x81, 0x7e, 0x00, 0x00, 0x00, 0x00 },	// U+263A (☺)
 	{ 0x00, 0x00, 0x7e, 0xff, 0xdb, 0xff, 0xff, 0xc3, 0xe7, 0xff, 0xff, 0x7e, 0x00, 0x00, 0x00, 0x00 },	// U+263B (☻)
 	{ 0x00, 0x00, 0x00, 0x18, 0x18, 0xdb, 0x3c, 0xe7, 0x3c, 0xdb, 0x18, 0x18, 0x00, 0x00, 0x00, 0x00 },	// U+263C (☼)
-}; // 3
-
-static const unsigned char vga_block101[][16] = {
 	{ 0x00, 0x00, 0x3c, 0x66, 0x66, 0x66, 0x66, 0x3c, 0x18, 0x7e, 0x18, 0x18, 0x00, 0x00, 0x00, 0x00 },	// U+2640 (♀)
-}; // 1
-
-static const unsigned char vga_block102[][16] = {
 	{ 0x00, 0x00, 0x78, 0x70, 0x58, 0x4c, 0x1e, 0x33, 0x33, 0x33, 0x33, 0x1e, 0x00, 0x00, 0x00, 0x00 },	// U+2642 (♂)
-}; // 1
-
-static const unsigned char vga_block103[][16] = {
 	{ 0x00, 0x00, 0x00, 0x18, 0x3c, 0x7e, 0xff, 0xff, 0x7e, 0x18, 0x18, 0x3c, 0x00, 0x00, 0x00, 0x00 },	// U+2660 (♠)
-}; // 1
-
-static const unsigned char vga_block104[][16] = {
 	{ 0x00, 0x00, 0x00, 0x18, 0x3c, 0x3c, 0xe7, 0xe7, 0xe7, 0x18, 0x18, 0x3c, 0x00, 0x00, 0x00, 0x00 },	// U+2663 (♣)
-}; // 1
-
-static const unsigned char vga_block105[][16] = {
 	{ 0x00, 0x00, 0x00, 0x00, 0x36, 0x7f, 0x7f, 0x7f, 0x7f, 0x3e, 0x1c, 0x08, 0x00, 0x00, 0x00, 0x00 },	// U+2665 (♥)
 	{ 0x00, 0x00, 0x00, 0x00, 0x08, 0x1c, 0x3e, 0x7f, 0x3e, 0x1c, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+2666 (♦)
-}; // 2
-
-static const unsigned char vga_block106[][16] = {
 	{ 0x00, 0x00, 0xfc, 0xcc, 0xfc, 0x0c, 0x0c, 0x0c, 0x0c, 0x0e, 0x0f, 0x07, 0x00, 0x00, 0x00, 0x00 },	// U+266A (♪)
 	{ 0x00, 0x00, 0xfe, 0xc6, 0xfe, 0xc6, 0xc6, 0xc6, 0xc6, 0xe6, 0xe7, 0x67, 0x03, 0x00, 0x00, 0x00 },	// U+266B (♫)
-}; // 2
-
-static const unsigned char vga_block107[][16] = {
 	{ 0x00, 0x60, 0x60, 0x60, 0x30, 0x30, 0x30, 0x30, 0x19, 0x1b, 0x1e, 0x0c, 0x00, 0x00, 0x00, 0x00 },	// U+2713 (✓)
-}; // 1
-
-static const unsigned char vga_block108[][16] = {
 	{ 0x00, 0x00, 0x7c, 0x66, 0x06, 0x06, 0x7f, 0x66, 0x66, 0x66, 0x66, 0xef, 0x00, 0x00, 0x00, 0x00 },	// U+FB01 (ﬁ)
 	{ 0x00, 0x00, 0x7c, 0x66, 0x66, 0x66, 0x6f, 0x66, 0x66, 0x66, 0x66, 0xef, 0x00, 0x00, 0x00, 0x00 },	// U+FB02 (ﬂ)
-}; // 2
-
-static const unsigned char vga_block109[][16] = {
 	{ 0xff, 0xff, 0xc1, 0x9c, 0x9c, 0xcf, 0xe7, 0xe7, 0xe7, 0xff, 0xe7, 0xe7, 0xff, 0xff, 0xff, 0xff },	// U+FFFD (�)
-}; // 1
-
+}; // 804
+
+static const uint8_t vga_page_index[] = {
+	0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x08, 0x00,
+	0x09, 0x0a, 0x0b, 0x0c, 0x00, 0x0d, 0x0e, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x11,
+}; // 256
+
+static const uint32_t vga_page_bits[][8] = {
+	{ 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000 },	// Empty
+	{ 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0x00000000, 0xffffffff, 0xffffffff, 0xffffffff },	// U+00xx
+	{ 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0x00040000, 0x00800002, 0x00000000, 0xfc000000 },	// U+01xx
+	{ 0x0f000000, 0x00000000, 0x00020000, 0x01000000, 0x00000000, 0x00000000, 0x3f0002c0, 0x00000000 },	// U+02xx
+	{ 0x00000000, 0x00000000, 0x00000000, 0x40000000, 0xffffd7f0, 0xfffffffb, 0x00017fff, 0x00100000 },	// U+03xx
+	{ 0xffffffff, 0xffffffff, 0xffffffff, 0x00000000, 0x00030000, 0x00000000, 0x00000000, 0x00000000 },	// U+04xx
+	{ 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x40000000, 0xffff0000, 0x001f07ff },	// U+05xx
+	{ 0x08000000, 0x00000140, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000 },	// U+1Dxx
+	{ 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x8000003f, 0x00000000, 0x00000000, 0x000c0000 },	// U+1Exx
+	{ 0xffbd0000, 0xd62d00c7, 0x00100011, 0x8ff00000, 0x00000ffe, 0x00001498, 0x00000000, 0x00000000 },	// U+20xx
+	{ 0x00480020, 0x00004044, 0x7ffb0000, 0x00000000, 0x003f0000, 0x00000100, 0x00000000, 0x00000000 },	// U+21xx
+	{ 0xc6268164, 0x00000a00, 0x00000100, 0x00000033, 0x02000000, 0x00000000, 0x00000000, 0x00000000 },	// U+22xx
+	{ 0x00010005, 0x00000003, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000 },	// U+23xx
+	{ 0x11111005, 0x10101010, 0xffff0000, 0x00001fff, 0xffffffff, 0x14041c03, 0x03008c10, 0x00000040 },	// U+25xx
+	{ 0x00000000, 0x1c000000, 0x00000005, 0x00000c69, 0x00000000, 0x00000000, 0x00000000, 0x00000000 },	// U+26xx
+	{ 0x00080000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000 },	// U+27xx
+	{ 0x00000006, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000 },	// U+FBxx
+	{ 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x20000000 },	// U+FFxx
+}; // 18
+
+static const uint16_t vga_page_base[][8] = {
+	{ 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000 },	// Empty
+	{ 0x0000, 0x0020, 0x0040, 0x0060, 0x0080, 0x0080, 0x00a0, 0x00c0 },	// U+00xx
+	{ 0x00e0, 0x0100, 0x0120, 0x0140, 0x0160, 0x0161, 0x0163, 0x0163 },	// U+01xx
+	{ 0x0169, 0x016d, 0x016d, 0x016e, 0x016f, 0x016f, 0x016f, 0x0178 },	// U+02xx
+	{ 0x0178, 0x0178, 0x0178, 0x0178, 0x0179, 0x0193, 0x01b2, 0x01c2 },	// U+03xx
+	{ 0x01c3, 0x01e3, 0x0203, 0x0223, 0x0223, 0x0225, 0x0225, 0x0225 },	// U+04xx
+	{ 0x0225, 0x0225, 0x0225, 0x0225, 0x0225, 0x0225, 0x0226, 0x0236 },	// U+05xx
+	{ 0x0246, 0x0247, 0x0249, 0x0249, 0x0249, 0x0249, 0x0249, 0x0249 },	// U+1Dxx
+	{ 0x0249, 0x0249, 0x0249, 0x0249, 0x0249, 0x0250, 0x0250, 0x0250 },	// U+1Exx
+	{ 0x0252, 0x0260, 0x026e, 0x0271, 0x027a, 0x0285, 0x028a, 0x028a },	// U+20xx
+	{ 0x028a, 0x028d, 0x0290, 0x029e, 0x029e, 0x02a4, 0x02a5, 0x02a5 },	// U+21xx
+	{ 0x02a5, 0x02b1, 0x02b3, 0x02b4, 0x02b8, 0x02b9, 0x02b9, 0x02b9 },	// U+22xx
+	{ 0x02b9, 0x02bc, 0x02be, 0x02be, 0x02be, 0x02be, 0x02be, 0x02be },	// U+23xx
+	{ 0x02be, 0x02c5, 0x02c9, 0x02d9, 0x02e6, 0x0306, 0x030e, 0x0314 },	// U+25xx
+	{ 0x0315, 0x0315, 0x0318, 0x031a, 0x0320, 0x0320, 0x0320, 0x0320 },	// U+26xx
+	{ 0x0320, 0x0321, 0x0321, 0x0321, 0x0321, 0x0321, 0x0321, 0x0321 },	// U+27xx
+	{ 0x0321, 0x0323, 0x0323, 0x0323, 0x0323, 0x0323, 0x0323, 0x0323 },	// U+FBxx
+	{ 0x0323, 0x0323, 0x0323, 0x0323, 0x0323, 0x0323, 0x0323, 0x0323 },	// U+FFxx
+}; // 18
@@ -41,8 +41,11 @@
 #include "qimagescale_p.h"
 #include "qrgb.h"
 
+#include <pthread.h>
+#include <signal.h>
 #include <stdio.h>
 #include <stdlib.h>
+#include <string.h>
 
 #ifndef FBINK_QIS_NO_SIMD
 #	if defined(__ARM_NEON__)
@@ -108,6 +111,17 @@ static int*                   qimageCalcXPoints(int sw, int dw);
 static int*                   qimageCalcApoints(int s, int d, int up);
 static QImageScaleInfo*       qimageFreeScaleInfo(QImageScaleInfo* isi);
 static QImageScaleInfo* qimageCalcScaleInfo(const unsigned char* img, int sw, int sh, int sn, int dw, int dh, char aa);
+#if !defined(FBINK_QIS_NO_SIMD) && (defined(__SSE4_1__) || defined(__ARM_NEON__))
+static void qimageCalcXSimd(QImageScaleInfo* isi, int sw, int dw);
+
+// Past that many taps per destination pixel (i.e., downscaling by more than ~30x), leave it to the scalar kernels
+#	define QIS_MAX_XSPAN 32
+#endif
+
+// Don't bother spinning up a thread for less rows than that
+#define QIS_BAND_MIN_ROWS 32
+// Never split a job across more threads than that
+#define QIS_MAX_THREADS 16
 
 //
 // Code ported from Imlib...
@@ -290,6 +304,7 @@ static QImageScaleInfo*
 		free(isi->ypoints_y8a);
 		free(isi->xapoints);
 		free(isi->yapoints);
+		free(isi->xweights);
 		free(isi);
 	}
 	return NULL;
@@ -352,10 +367,69 @@ static QImageScaleInfo*
 		isi->yapoints = qimageCalcApoints(sh, sch, isi->xup_yup & 2);
 		if (!isi->yapoints)
 			return qimageFreeScaleInfo(isi);
+#if !defined(FBINK_QIS_NO_SIMD) && (defined(__SSE4_1__) || defined(__ARM_NEON__))
+		// NOTE: There's no Y8/Y8A SIMD kernel for upscaling in both directions.
+		if (sn <= 2 && isi->xup_yup != 3)
+			qimageCalcXSimd(isi, sw, scw);
+#endif
 	}
 	return isi;
 }
 
+#if !defined(FBINK_QIS_NO_SIMD) && (defined(__SSE4_1__) || defined(__ARM_NEON__))
+// Compute what the Y8 & Y8A SIMD kernels need (c.f., QImageScaleInfo)
+// NOTE: If anything goes wrong, xsimd is left at 0, and the scalar kernels do all the work.
+static void
+    qimageCalcXSimd(QImageScaleInfo* isi, int sw, int dw)
+{
+	if (isi->xup_yup & 1) {
+		/* scaling up: we interpolate between two source pixels */
+		isi->xspan = 2;
+	} else {
+		/* scaling down: flatten the weights used by the scalar helper, padded to a multiple of 4 taps */
+		int xspan = 0;
+		for (int x = 0; x < dw; x++) {
+			int Cx  = isi->xapoints[x] >> 16;
+			int xap = isi->xapoints[x] & 0xffff;
+			int n   = 2;
+			for (int j = (1 << 14) - xap; j > Cx; j -= Cx)
+				n++;
+			xspan = qMax(xspan, n);
+		}
+		xspan = (xspan + 3) & ~3;
+		if (xspan > QIS_MAX_XSPAN)
+			return;
+
+		void* ptr;
+		if (posix_memalign(&ptr, 16, (size_t) dw * (size_t) xspan * sizeof(*isi->xweights)) != 0)
+			return;
+		isi->xweights = (unsigned short*) ptr;
+
+		for (int x = 0; x < dw; x++) {
+			unsigned short* w   = isi->xweights + (x * xspan);
+			int             Cx  = isi->xapoints[x] >> 16;
+			int             xap = isi->xapoints[x] & 0xffff;
+			int             k   = 0;
+			w[k++]              = (unsigned short) xap;
+			int j;
+			for (j = (1 << 14) - xap; j > Cx; j -= Cx)
+				w[k++] = (unsigned short) Cx;
+			w[k++] = (unsigned short) j;
+			while (k < xspan)
+				w[k++] = 0U;
+		}
+		isi->xspan = xspan;
+	}
+
+	/* find the destination pixels for which we can read xspan source pixels without going past the end of the line,
+	   in groups of 4 */
+	int xsimd = dw;
+	while (xsimd > 0 && isi->xpoints[xsimd - 1] + isi->xspan > sw)
+		xsimd--;
+	isi->xsimd = xsimd & ~3;
+}
+#endif
+
 #if defined(FBINK_QIS_NO_SIMD) || !(defined(__SSE4_1__) || defined(__ARM_NEON__))
 static void qt_qimageScaleAARGBA_up_x_down_y(QImageScaleInfo* isi, unsigned int* dest, int dw, int dh, int dow, int sow);
 
@@ -403,6 +477,44 @@ inline static void qt_qimageScaleAARGB_down_xy_sse4(QImageScaleInfo* isi,
 						    int              dh,
 						    int              dow,
 						    int              sow);
+
+inline static void qt_qimageScaleAAY8_up_x_down_y_sse4(QImageScaleInfo* isi,
+						       unsigned char*   dest,
+						       int              dw,
+						       int              dh,
+						       int              dow,
+						       int              sow);
+inline static void qt_qimageScaleAAY8_down_x_up_y_sse4(QImageScaleInfo* isi,
+						       unsigned char*   dest,
+						       int              dw,
+						       int              dh,
+						       int              dow,
+						       int              sow);
+inline static void qt_qimageScaleAAY8_down_xy_sse4(QImageScaleInfo* isi,
+						   unsigned char*   dest,
+						   int              dw,
+						   int              dh,
+						   int              dow,
+						   int              sow);
+
+inline static void qt_qimageScaleAAY8A_up_x_down_y_sse4(QImageScaleInfo* isi,
+							unsigned short*  dest,
+							int              dw,
+							int              dh,
+							int              dow,
+							int              sow);
+inline static void qt_qimageScaleAAY8A_down_x_up_y_sse4(QImageScaleInfo* isi,
+							unsigned short*  dest,
+							int              dw,
+							int              dh,
+							int              dow,
+							int              sow);
+inline static void qt_qimageScaleAAY8A_down_xy_sse4(QImageScaleInfo* isi,
+						    unsigned short*  dest,
+						    int              dw,
+						    int              dh,
+						    int              dow,
+						    int              sow);
 #	endif
 
 #	if defined(__ARM_NEON__)
@@ -443,6 +555,44 @@ inline static void qt_qimageScaleAARGB_down_xy_neon(QImageScaleInfo* isi,
 						    int              dh,
 						    int              dow,
 						    int              sow);
+
+inline static void qt_qimageScaleAAY8_up_x_down_y_neon(QImageScaleInfo* isi,
+						       unsigned char*   dest,
+						       int              dw,
+						       int              dh,
+						       int              dow,
+						       int              sow);
+inline static void qt_qimageScaleAAY8_down_x_up_y_neon(QImageScaleInfo* isi,
+						       unsigned char*   dest,
+						       int              dw,
+						       int              dh,
+						       int              dow,
+						       int              sow);
+inline static void qt_qimageScaleAAY8_down_xy_neon(QImageScaleInfo* isi,
+						   unsigned char*   dest,
+						   int              dw,
+						   int              dh,
+						   int              dow,
+						   int              sow);
+
+inline static void qt_qimageScaleAAY8A_up_x_down_y_neon(QImageScaleInfo* isi,
+							unsigned short*  dest,
+							int              dw,
+							int              dh,
+							int              dow,
+							int              sow);
+inline static void qt_qimageScaleAAY8A_down_x_up_y_neon(QImageScaleInfo* isi,
+							unsigned short*  dest,
+							int              dw,
+							int              dh,
+							int              dow,
+							int              sow);
+inline static void qt_qimageScaleAAY8A_down_xy_neon(QImageScaleInfo* isi,
+						    unsigned short*  dest,
+						    int              dw,
+						    int              dh,
+						    int              dow,
+						    int              sow);
 #	endif
 #endif
 
@@ -1049,6 +1199,36 @@ static void
 static void
     qt_qimageScaleAAY8(QImageScaleInfo* isi, unsigned char* dest, int dw, int dh, int dow, int sow)
 {
+#if !defined(FBINK_QIS_NO_SIMD) && (defined(__SSE4_1__) || defined(__ARM_NEON__))
+	// NOTE: The SIMD kernels handle the first xsimd columns, we then let the scalar ones take care of the rest.
+	QImageScaleInfo tail;
+	if (isi->xsimd > 0) {
+#	if defined(__SSE4_1__)
+		if (isi->xup_yup == 1)
+			qt_qimageScaleAAY8_up_x_down_y_sse4(isi, dest, isi->xsimd, dh, dow, sow);
+		else if (isi->xup_yup == 2)
+			qt_qimageScaleAAY8_down_x_up_y_sse4(isi, dest, isi->xsimd, dh, dow, sow);
+		else
+			qt_qimageScaleAAY8_down_xy_sse4(isi, dest, isi->xsimd, dh, dow, sow);
+#	elif defined(__ARM_NEON__)
+		if (isi->xup_yup == 1)
+			qt_qimageScaleAAY8_up_x_down_y_neon(isi, dest, isi->xsimd, dh, dow, sow);
+		else if (isi->xup_yup == 2)
+			qt_qimageScaleAAY8_down_x_up_y_neon(isi, dest, isi->xsimd, dh, dow, sow);
+		else
+			qt_qimageScaleAAY8_down_xy_neon(isi, dest, isi->xsimd, dh, dow, sow);
+#	endif
+		tail = *isi;
+		tail.xpoints += isi->xsimd;
+		tail.xapoints += isi->xsimd;
+		dest += isi->xsimd;
+		dw -= isi->xsimd;
+		isi = &tail;
+		if (dw == 0)
+			return;
+	}
+#endif
+
 	if (isi->xup_yup == 3)
 		qt_qimageScaleAAY8_up_xy(isi, dest, dw, dh, dow, sow);
 	else if (isi->xup_yup == 1)
@@ -1234,6 +1414,36 @@ static void
 static void
     qt_qimageScaleAAY8A(QImageScaleInfo* isi, unsigned short* dest, int dw, int dh, int dow, int sow)
 {
+#if !defined(FBINK_QIS_NO_SIMD) && (defined(__SSE4_1__) || defined(__ARM_NEON__))
+	// NOTE: The SIMD kernels handle the first xsimd columns, we then let the scalar ones take care of the rest.
+	QImageScaleInfo tail;
+	if (isi->xsimd > 0) {
+#	if defined(__SSE4_1__)
+		if (isi->xup_yup == 1)
+			qt_qimageScaleAAY8A_up_x_down_y_sse4(isi, dest, isi->xsimd, dh, dow, sow);
+		else if (isi->xup_yup == 2)
+			qt_qimageScaleAAY8A_down_x_up_y_sse4(isi, dest, isi->xsimd, dh, dow, sow);
+		else
+			qt_qimageScaleAAY8A_down_xy_sse4(isi, dest, isi->xsimd, dh, dow, sow);
+#	elif defined(__ARM_NEON__)
+		if (isi->xup_yup == 1)
+			qt_qimageScaleAAY8A_up_x_down_y_neon(isi, dest, isi->xsimd, dh, dow, sow);
+		else if (isi->xup_yup == 2)
+			qt_qimageScaleAAY8A_down_x_up_y_neon(isi, dest, isi->xsimd, dh, dow, sow);
+		else
+			qt_qimageScaleAAY8A_down_xy_neon(isi, dest, isi->xsimd, dh, dow, sow);
+#	endif
+		tail = *isi;
+		tail.xpoints += isi->xsimd;
+		tail.xapoints += isi->xsimd;
+		dest += isi->xsimd;
+		dw -= isi->xsimd;
+		isi = &tail;
+		if (dw == 0)
+			return;
+	}
+#endif
+
 	if (isi->xup_yup == 3)
 		qt_qimageScaleAAY8A_up_xy(isi, dest, dw, dh, dow, sow);
 	else if (isi->xup_yup == 1)
@@ -1244,60 +1454,136 @@ static void
 		qt_qimageScaleAAY8A_down_xy(isi, dest, dw, dh, dow, sow);
 }
 
-unsigned char*
-    qSmoothScaleImage(const unsigned char* src, int sw, int sh, int sn, bool ignore_alpha, int dw, int dh)
+// Scale a band of destination rows
+static void
+    qt_qimageScaleAA(QImageScaleBand* band)
 {
-	unsigned char* buffer = NULL;
-	if (src == NULL || dw <= 0 || dh <= 0)
-		return buffer;
-
-	QImageScaleInfo* scaleinfo = qimageCalcScaleInfo(src, sw, sh, sn, dw, dh, true);
-	if (!scaleinfo)
-		return buffer;
+	QImageScaleInfo* isi  = &band->isi;
+	unsigned char*   dest = band->dest;
+	int              dw   = band->dw;
+	int              dh   = band->dh;
+	int              sw   = band->sw;
 
-	// NOTE: For RGB/RGBA input, output format is always RGBA!
-	//       In case our input was RGB, we've already ensured that our input buffer is already 32bpp,
-	//       c.f., comments below.
-	// SSE/NEON friendly alignment, just in case...
-	void* ptr;
-	if (posix_memalign(&ptr, 16, (size_t)(dw * dh * sn)) != 0) {
-		fprintf(stderr, "qSmoothScaleImage: out of memory, returning null!\n");
-		qimageFreeScaleInfo(scaleinfo);
-		return NULL;
-	} else {
-		buffer = (unsigned char*) ptr;
-	}
-
-	// NOTE: In the same way, we enforce 32bpp input buffers for RGB,
+	// NOTE: Much like for the output, we enforce 32bpp input buffers for RGB,
 	//       because that's what Qt uses, even for RGB with no alpha.
 	//       (the pixelformat constant is helpfully named RGB32 to remind you of that ;)).
 	//       This is why we'll never get sn == 3 here, FBInk takes care of never allowing that to happen.
 	// NOTE: See comment in qimageCalcScaleInfo regarding our simplification of using sw directly.
-	switch (sn) {
+	switch (band->sn) {
 		case 4:
-			if (ignore_alpha) {
+			if (band->ignore_alpha) {
 				// NOTE: Input buffer is still 32bpp, we just skip *processing* of the alpha channel.
 #pragma GCC diagnostic push
 #pragma GCC diagnostic ignored "-Wcast-align"
-				qt_qimageScaleAARGB(scaleinfo, (unsigned int*) buffer, dw, dh, dw, sw);
+				qt_qimageScaleAARGB(isi, (unsigned int*) dest, dw, dh, dw, sw);
 #pragma GCC diagnostic pop
 			} else {
 #pragma GCC diagnostic push
 #pragma GCC diagnostic ignored "-Wcast-align"
-				qt_qimageScaleAARGBA(scaleinfo, (unsigned int*) buffer, dw, dh, dw, sw);
+				qt_qimageScaleAARGBA(isi, (unsigned int*) dest, dw, dh, dw, sw);
 #pragma GCC diagnostic pop
 			}
 			break;
 		case 2:
 #pragma GCC diagnostic push
 #pragma GCC diagnostic ignored "-Wcast-align"
-			qt_qimageScaleAAY8A(scaleinfo, (unsigned short*) buffer, dw, dh, dw, sw);
+			qt_qimageScaleAAY8A(isi, (unsigned short*) dest, dw, dh, dw, sw);
 #pragma GCC diagnostic pop
 			break;
 		case 1:
-			qt_qimageScaleAAY8(scaleinfo, (unsigned char*) buffer, dw, dh, dw, sw);
+			qt_qimageScaleAAY8(isi, dest, dw, dh, dw, sw);
 			break;
 	}
+}
+
+static void*
+    qt_qimageScaleAAThread(void* arg)
+{
+	qt_qimageScaleAA((QImageScaleBand*) arg);
+	return NULL;
+}
+
+// NOTE: threads is the maximum amount of threads (including the caller's) the job may be split across,
+//       by bands of destination rows. The results are identical no matter how it's split.
+unsigned char*
+    qSmoothScaleImage(const unsigned char* src, int sw, int sh, int sn, bool ignore_alpha, int dw, int dh, int threads)
+{
+	unsigned char* buffer = NULL;
+	if (src == NULL || dw <= 0 || dh <= 0)
+		return buffer;
+
+	QImageScaleInfo* scaleinfo = qimageCalcScaleInfo(src, sw, sh, sn, dw, dh, true);
+	if (!scaleinfo)
+		return buffer;
+
+	// NOTE: For RGB/RGBA input, output format is always RGBA!
+	//       In case our input was RGB, we've already ensured that our input buffer is already 32bpp,
+	//       c.f., comments in qt_qimageScaleAA.
+	// SSE/NEON friendly alignment, just in case...
+	void* ptr;
+	if (posix_memalign(&ptr, 16, (size_t)(dw * dh * sn)) != 0) {
+		fprintf(stderr, "qSmoothScaleImage: out of memory, returning null!\n");
+		qimageFreeScaleInfo(scaleinfo);
+		return NULL;
+	} else {
+		buffer = (unsigned char*) ptr;
+	}
+
+	int bands = qMin(threads, QIS_MAX_THREADS);
+	bands     = qMin(bands, dh / QIS_BAND_MIN_ROWS);
+	if (bands <= 1) {
+		QImageScaleBand band = { .isi          = *scaleinfo,
+					 .dest         = buffer,
+					 .sn           = sn,
+					 .ignore_alpha = ignore_alpha,
+					 .dw           = dw,
+					 .dh           = dh,
+					 .sw           = sw };
+		qt_qimageScaleAA(&band);
+	} else {
+		QImageScaleBand jobs[QIS_MAX_THREADS];
+		pthread_t       workers[QIS_MAX_THREADS];
+		bool            started[QIS_MAX_THREADS] = { false };
+
+		// Each band gets a copy of the scale info, offset to its first row
+		for (int i = 0; i < bands; i++) {
+			const int first = (int) ((qint64) dh * i / bands);
+			const int last  = (int) ((qint64) dh * (i + 1) / bands);
+			jobs[i]         = (QImageScaleBand){ .isi          = *scaleinfo,
+                                                     .dest         = buffer + ((size_t) first * (size_t) (dw * sn)),
+                                                     .sn           = sn,
+                                                     .ignore_alpha = ignore_alpha,
+                                                     .dw           = dw,
+                                                     .dh           = last - first,
+                                                     .sw           = sw };
+			if (jobs[i].isi.ypoints)
+				jobs[i].isi.ypoints += first;
+			if (jobs[i].isi.ypoints_y8)
+				jobs[i].isi.ypoints_y8 += first;
+			if (jobs[i].isi.ypoints_y8a)
+				jobs[i].isi.ypoints_y8a += first;
+			jobs[i].isi.yapoints += first;
+		}
+
+		// NOTE: Keep signals out of the workers' way, they're the application's business.
+		sigset_t all_signals;
+		sigset_t old_signals;
+		sigfillset(&all_signals);
+		pthread_sigmask(SIG_SETMASK, &all_signals, &old_signals);
+		for (int i = 1; i < bands; i++) {
+			started[i] = (pthread_create(&workers[i], NULL, &qt_qimageScaleAAThread, &jobs[i]) == 0);
+		}
+		pthread_sigmask(SIG_SETMASK, &old_signals, NULL);
+
+		// Don't just sit there, help! (We'll also pick up the bands we failed to spawn a thread for).
+		qt_qimageScaleAA(&jobs[0]);
+		for (int i = 1; i < bands; i++) {
+			if (started[i])
+				pthread_join(workers[i], NULL);
+			else
+				qt_qimageScaleAA(&jobs[i]);
+		}
+	}
 
 	qimageFreeScaleInfo(scaleinfo);
 	return buffer;
@@ -298,4 +298,370 @@ static inline void
 	}
 }
 
+// NOTE: Unlike the RGBA ones, the Y8 & Y8A kernels work on 4 destination pixels at a time,
+//       and only handle the first isi->xsimd destination pixels (the scalar kernels take care of the rest).
+//       When scaling down horizontally, they use the flattened weights from isi->xweights,
+//       which add up to the exact same sums as the scalar helpers, so the results are identical.
+
+// Load 4 Y8 source pixels as 16-bit integers
+static inline __attribute__((always_inline)) uint16x4_t
+    qt_qimageScaleAAY8_load4_neon(const unsigned char* pix)
+{
+	uint32_t v;
+	memcpy(&v, pix, sizeof(v));
+	return vget_low_u16(vmovl_u8(vreinterpret_u8_u32(vmov_n_u32(v))));
+}
+
+// Horizontal sums of 4 destination pixels
+static inline __attribute__((always_inline)) uint32x4_t
+    qt_qimageScaleAAY8_helper_neon(const unsigned char*  sptr,
+				   const int*            xpoints,
+				   const unsigned short* xweights,
+				   int                   xspan)
+{
+	uint32x2_t vx[4];
+	for (int i = 0; i < 4; i++) {
+		const unsigned char*  pix = sptr + xpoints[i];
+		const unsigned short* w   = xweights + (i * xspan);
+		uint32x4_t            vs  = vmull_u16(qt_qimageScaleAAY8_load4_neon(pix), vld1_u16(w));
+		for (int k = 4; k < xspan; k += 4) {
+			vs = vmlal_u16(vs, qt_qimageScaleAAY8_load4_neon(pix + k), vld1_u16(w + k));
+		}
+		vx[i] = vadd_u32(vget_low_u32(vs), vget_high_u32(vs));
+	}
+	return vcombine_u32(vpadd_u32(vx[0], vx[1]), vpadd_u32(vx[2], vx[3]));
+}
+
+// Ditto, for both components of Y8A pixels
+static inline __attribute__((always_inline)) void
+    qt_qimageScaleAAY8A_helper_neon(const unsigned short* sptr,
+				    const int*            xpoints,
+				    const unsigned short* xweights,
+				    int                   xspan,
+				    uint32x4_t*           vy,
+				    uint32x4_t*           va)
+{
+	uint32x2_t vyx[4];
+	uint32x2_t vax[4];
+	for (int i = 0; i < 4; i++) {
+		const unsigned short* pix = sptr + xpoints[i];
+		const unsigned short* w   = xweights + (i * xspan);
+		uint32x4_t            vys = vdupq_n_u32(0U);
+		uint32x4_t            vas = vdupq_n_u32(0U);
+		for (int k = 0; k < xspan; k += 4) {
+			// 4 Y8A pixels, sorted as 4 Y in val[0], and 4 A in val[1]
+			const uint8x8_t   vpix = vld1_u8((const uint8_t*) (pix + k));
+			const uint8x8x2_t vya  = vuzp_u8(vpix, vpix);
+			const uint16x4_t  vw   = vld1_u16(w + k);
+			vys                    = vmlal_u16(vys, vget_low_u16(vmovl_u8(vya.val[0])), vw);
+			vas                    = vmlal_u16(vas, vget_low_u16(vmovl_u8(vya.val[1])), vw);
+		}
+		vyx[i] = vadd_u32(vget_low_u32(vys), vget_high_u32(vys));
+		vax[i] = vadd_u32(vget_low_u32(vas), vget_high_u32(vas));
+	}
+	*vy = vcombine_u32(vpadd_u32(vyx[0], vyx[1]), vpadd_u32(vyx[2], vyx[3]));
+	*va = vcombine_u32(vpadd_u32(vax[0], vax[1]), vpadd_u32(vax[2], vax[3]));
+}
+
+// Interpolate the two neighboring source pixels of 4 destination pixels
+static inline __attribute__((always_inline)) uint32x4_t
+    qt_qimageScaleAAY8_pairs_neon(const unsigned char* sptr, const int* xpoints, uint16x4_t vinvxap, uint16x4_t vxap)
+{
+	const uint16_t l[4] = { sptr[xpoints[0]], sptr[xpoints[1]], sptr[xpoints[2]], sptr[xpoints[3]] };
+	const uint16_t r[4] = { sptr[xpoints[0] + 1], sptr[xpoints[1] + 1], sptr[xpoints[2] + 1], sptr[xpoints[3] + 1] };
+	return vmlal_u16(vmull_u16(vld1_u16(l), vinvxap), vld1_u16(r), vxap);
+}
+
+// Ditto, for both components of Y8A pixels
+static inline __attribute__((always_inline)) void
+    qt_qimageScaleAAY8A_pairs_neon(const unsigned short* sptr,
+				   const int*            xpoints,
+				   uint16x4_t            vinvxap,
+				   uint16x4_t            vxap,
+				   uint32x4_t*           vy,
+				   uint32x4_t*           va)
+{
+	uint16_t yl[4], yr[4], al[4], ar[4];
+	for (int i = 0; i < 4; i++) {
+		const unsigned short* pix = sptr + xpoints[i];
+		yl[i]                     = (uint16_t) qY(pix[0]);
+		yr[i]                     = (uint16_t) qY(pix[1]);
+		al[i]                     = (uint16_t) qA(pix[0]);
+		ar[i]                     = (uint16_t) qA(pix[1]);
+	}
+	*vy = vmlal_u16(vmull_u16(vld1_u16(yl), vinvxap), vld1_u16(yr), vxap);
+	*va = vmlal_u16(vmull_u16(vld1_u16(al), vinvxap), vld1_u16(ar), vxap);
+}
+
+// Store 4 Y8 pixels
+static inline __attribute__((always_inline)) void
+    qt_qimageScaleAAY8_store_neon(unsigned char* dptr, uint32x4_t vx)
+{
+	const uint16x4_t vx16 = vqmovn_u32(vx);
+	const uint8x8_t  vx8  = vqmovn_u16(vcombine_u16(vx16, vx16));
+	const uint32_t   v    = vget_lane_u32(vreinterpret_u32_u8(vx8), 0);
+	memcpy(dptr, &v, sizeof(v));
+}
+
+// Store 4 Y8A pixels
+static inline __attribute__((always_inline)) void
+    qt_qimageScaleAAY8A_store_neon(unsigned short* dptr, uint32x4_t vy, uint32x4_t va)
+{
+	vst1_u16(dptr, vmovn_u32(vorrq_u32(vy, vshlq_n_u32(va, 8))));
+}
+
+static inline void
+    qt_qimageScaleAAY8_up_x_down_y_neon(QImageScaleInfo* isi, unsigned char* dest, int dw, int dh, int dow, int sow)
+{
+	const unsigned char** ypoints  = isi->ypoints_y8;
+	int*                  xpoints  = isi->xpoints;
+	int*                  xapoints = isi->xapoints;
+	int*                  yapoints = isi->yapoints;
+
+	/* go through every scanline in the output buffer */
+	for (int y = 0; y < dh; y++) {
+		int Cy  = yapoints[y] >> 16;
+		int yap = yapoints[y] & 0xffff;
+
+		unsigned char* dptr = dest + (y * dow);
+		for (int x = 0; x < dw; x += 4) {
+			// NOTE: We interpolate horizontally first, which is fine, since nothing is rounded until the end
+			//       (when xap is 0, that's a multiplication by 256, which the final shift takes care of).
+			const int*       xp      = xpoints + x;
+			const uint16_t   xap[4]  = { (uint16_t) xapoints[x],
+                                                  (uint16_t) xapoints[x + 1],
+                                                  (uint16_t) xapoints[x + 2],
+                                                  (uint16_t) xapoints[x + 3] };
+			const uint16x4_t vxap    = vld1_u16(xap);
+			const uint16x4_t vinvxap = vsub_u16(vdup_n_u16(256U), vxap);
+
+			const unsigned char* sptr = ypoints[y];
+			uint32x4_t           vr   = qt_qimageScaleAAY8_pairs_neon(sptr, xp, vinvxap, vxap);
+			uint32x4_t           vx   = vmulq_n_u32(vr, (uint32_t) yap);
+
+			int j;
+			for (j = (1 << 14) - yap; j > Cy; j -= Cy) {
+				sptr += sow;
+				vr = qt_qimageScaleAAY8_pairs_neon(sptr, xp, vinvxap, vxap);
+				vx = vmlaq_n_u32(vx, vr, (uint32_t) Cy);
+			}
+			sptr += sow;
+			vr = qt_qimageScaleAAY8_pairs_neon(sptr, xp, vinvxap, vxap);
+			vx = vmlaq_n_u32(vx, vr, (uint32_t) j);
+
+			vx = vshrq_n_u32(vx, 8 + 14);
+			qt_qimageScaleAAY8_store_neon(dptr, vx);
+			dptr += 4;
+		}
+	}
+}
+
+static inline void
+    qt_qimageScaleAAY8_down_x_up_y_neon(QImageScaleInfo* isi, unsigned char* dest, int dw, int dh, int dow, int sow)
+{
+	const unsigned char** ypoints  = isi->ypoints_y8;
+	int*                  xpoints  = isi->xpoints;
+	int*                  yapoints = isi->yapoints;
+	const unsigned short* xweights = isi->xweights;
+	const int             xspan    = isi->xspan;
+
+	/* go through every scanline in the output buffer */
+	for (int y = 0; y < dh; y++) {
+		const unsigned char* sptr = ypoints[y];
+		int                  yap  = yapoints[y];
+
+		unsigned char* dptr = dest + (y * dow);
+		for (int x = 0; x < dw; x += 4) {
+			const unsigned short* w  = xweights + (x * xspan);
+			uint32x4_t            vx = qt_qimageScaleAAY8_helper_neon(sptr, xpoints + x, w, xspan);
+
+			if (yap > 0) {
+				uint32x4_t vr = qt_qimageScaleAAY8_helper_neon(sptr + sow, xpoints + x, w, xspan);
+
+				vx = vmulq_n_u32(vx, (uint32_t) (256 - yap));
+				vr = vmulq_n_u32(vr, (uint32_t) yap);
+				vx = vaddq_u32(vx, vr);
+				vx = vshrq_n_u32(vx, 8);
+			}
+			vx = vshrq_n_u32(vx, 14);
+			qt_qimageScaleAAY8_store_neon(dptr, vx);
+			dptr += 4;
+		}
+	}
+}
+
+static inline void
+    qt_qimageScaleAAY8_down_xy_neon(QImageScaleInfo* isi, unsigned char* dest, int dw, int dh, int dow, int sow)
+{
+	const unsigned char** ypoints  = isi->ypoints_y8;
+	int*                  xpoints  = isi->xpoints;
+	int*                  yapoints = isi->yapoints;
+	const unsigned short* xweights = isi->xweights;
+	const int             xspan    = isi->xspan;
+
+	const uint32x4_t v128 = vdupq_n_u32(128U);
+
+	for (int y = 0; y < dh; y++) {
+		int Cy  = yapoints[y] >> 16;
+		int yap = yapoints[y] & 0xffff;
+
+		unsigned char* dptr = dest + (y * dow);
+		for (int x = 0; x < dw; x += 4) {
+			const int*            xp   = xpoints + x;
+			const unsigned short* w    = xweights + (x * xspan);
+			const unsigned char*  sptr = ypoints[y];
+			uint32x4_t            vx   = qt_qimageScaleAAY8_helper_neon(sptr, xp, w, xspan);
+			uint32x4_t            vr   = vmulq_n_u32(vshrq_n_u32(vx, 6), (uint32_t) yap);
+
+			int j;
+			for (j = (1 << 14) - yap; j > Cy; j -= Cy) {
+				sptr += sow;
+				vx = qt_qimageScaleAAY8_helper_neon(sptr, xp, w, xspan);
+				vr = vmlaq_n_u32(vr, vshrq_n_u32(vx, 6), (uint32_t) Cy);
+			}
+			sptr += sow;
+			vx = qt_qimageScaleAAY8_helper_neon(sptr, xp, w, xspan);
+			vr = vmlaq_n_u32(vr, vshrq_n_u32(vx, 6), (uint32_t) j);
+
+			// DIV255(vr >> 14)
+			vr = vaddq_u32(vshrq_n_u32(vr, 14), v128);
+			vr = vshrq_n_u32(vsraq_n_u32(vr, vr, 8), 8);
+			qt_qimageScaleAAY8_store_neon(dptr, vr);
+			dptr += 4;
+		}
+	}
+}
+
+static inline void
+    qt_qimageScaleAAY8A_up_x_down_y_neon(QImageScaleInfo* isi, unsigned short* dest, int dw, int dh, int dow, int sow)
+{
+	const unsigned short** ypoints  = isi->ypoints_y8a;
+	int*                   xpoints  = isi->xpoints;
+	int*                   xapoints = isi->xapoints;
+	int*                   yapoints = isi->yapoints;
+
+	/* go through every scanline in the output buffer */
+	for (int y = 0; y < dh; y++) {
+		int Cy  = yapoints[y] >> 16;
+		int yap = yapoints[y] & 0xffff;
+
+		unsigned short* dptr = dest + (y * dow);
+		for (int x = 0; x < dw; x += 4) {
+			// NOTE: Same idea as the Y8 variant.
+			const int*       xp      = xpoints + x;
+			const uint16_t   xap[4]  = { (uint16_t) xapoints[x],
+                                                  (uint16_t) xapoints[x + 1],
+                                                  (uint16_t) xapoints[x + 2],
+                                                  (uint16_t) xapoints[x + 3] };
+			const uint16x4_t vxap    = vld1_u16(xap);
+			const uint16x4_t vinvxap = vsub_u16(vdup_n_u16(256U), vxap);
+
+			const unsigned short* sptr = ypoints[y];
+			uint32x4_t            vyx, vax;
+			qt_qimageScaleAAY8A_pairs_neon(sptr, xp, vinvxap, vxap, &vyx, &vax);
+			uint32x4_t vy = vmulq_n_u32(vyx, (uint32_t) yap);
+			uint32x4_t va = vmulq_n_u32(vax, (uint32_t) yap);
+
+			int j;
+			for (j = (1 << 14) - yap; j > Cy; j -= Cy) {
+				sptr += sow;
+				qt_qimageScaleAAY8A_pairs_neon(sptr, xp, vinvxap, vxap, &vyx, &vax);
+				vy = vmlaq_n_u32(vy, vyx, (uint32_t) Cy);
+				va = vmlaq_n_u32(va, vax, (uint32_t) Cy);
+			}
+			sptr += sow;
+			qt_qimageScaleAAY8A_pairs_neon(sptr, xp, vinvxap, vxap, &vyx, &vax);
+			vy = vmlaq_n_u32(vy, vyx, (uint32_t) j);
+			va = vmlaq_n_u32(va, vax, (uint32_t) j);
+
+			qt_qimageScaleAAY8A_store_neon(dptr, vshrq_n_u32(vy, 8 + 14), vshrq_n_u32(va, 8 + 14));
+			dptr += 4;
+		}
+	}
+}
+
+static inline void
+    qt_qimageScaleAAY8A_down_x_up_y_neon(QImageScaleInfo* isi, unsigned short* dest, int dw, int dh, int dow, int sow)
+{
+	const unsigned short** ypoints  = isi->ypoints_y8a;
+	int*                   xpoints  = isi->xpoints;
+	int*                   yapoints = isi->yapoints;
+	const unsigned short*  xweights = isi->xweights;
+	const int              xspan    = isi->xspan;
+
+	/* go through every scanline in the output buffer */
+	for (int y = 0; y < dh; y++) {
+		const unsigned short* sptr = ypoints[y];
+		int                   yap  = yapoints[y];
+
+		unsigned short* dptr = dest + (y * dow);
+		for (int x = 0; x < dw; x += 4) {
+			const unsigned short* w = xweights + (x * xspan);
+			uint32x4_t            vy, va;
+			qt_qimageScaleAAY8A_helper_neon(sptr, xpoints + x, w, xspan, &vy, &va);
+
+			if (yap > 0) {
+				uint32x4_t vyy, vaa;
+				qt_qimageScaleAAY8A_helper_neon(sptr + sow, xpoints + x, w, xspan, &vyy, &vaa);
+
+				vy = vmlaq_n_u32(vmulq_n_u32(vy, (uint32_t) (256 - yap)), vyy, (uint32_t) yap);
+				va = vmlaq_n_u32(vmulq_n_u32(va, (uint32_t) (256 - yap)), vaa, (uint32_t) yap);
+				vy = vshrq_n_u32(vy, 8);
+				va = vshrq_n_u32(va, 8);
+			}
+			qt_qimageScaleAAY8A_store_neon(dptr, vshrq_n_u32(vy, 14), vshrq_n_u32(va, 14));
+			dptr += 4;
+		}
+	}
+}
+
+static inline void
+    qt_qimageScaleAAY8A_down_xy_neon(QImageScaleInfo* isi, unsigned short* dest, int dw, int dh, int dow, int sow)
+{
+	const unsigned short** ypoints  = isi->ypoints_y8a;
+	int*                   xpoints  = isi->xpoints;
+	int*                   yapoints = isi->yapoints;
+	const unsigned short*  xweights = isi->xweights;
+	const int              xspan    = isi->xspan;
+
+	const uint32x4_t v128 = vdupq_n_u32(128U);
+	const uint32x4_t v255 = vdupq_n_u32(255U);
+
+	for (int y = 0; y < dh; y++) {
+		int Cy  = yapoints[y] >> 16;
+		int yap = yapoints[y] & 0xffff;
+
+		unsigned short* dptr = dest + (y * dow);
+		for (int x = 0; x < dw; x += 4) {
+			const int*            xp   = xpoints + x;
+			const unsigned short* w    = xweights + (x * xspan);
+			const unsigned short* sptr = ypoints[y];
+			uint32x4_t            vyx, vax;
+			qt_qimageScaleAAY8A_helper_neon(sptr, xp, w, xspan, &vyx, &vax);
+			uint32x4_t vy = vmulq_n_u32(vshrq_n_u32(vyx, 6), (uint32_t) yap);
+			uint32x4_t va = vmulq_n_u32(vshrq_n_u32(vax, 6), (uint32_t) yap);
+
+			int j;
+			for (j = (1 << 14) - yap; j > Cy; j -= Cy) {
+				sptr += sow;
+				qt_qimageScaleAAY8A_helper_neon(sptr, xp, w, xspan, &vyx, &vax);
+				vy = vmlaq_n_u32(vy, vshrq_n_u32(vyx, 6), (uint32_t) Cy);
+				va = vmlaq_n_u32(va, vshrq_n_u32(vax, 6), (uint32_t) Cy);
+			}
+			sptr += sow;
+			qt_qimageScaleAAY8A_helper_neon(sptr, xp, w, xspan, &vyx, &vax);
+			vy = vmlaq_n_u32(vy, vshrq_n_u32(vyx, 6), (uint32_t) j);
+			va = vmlaq_n_u32(va, vshrq_n_u32(vax, 6), (uint32_t) j);
+
+			// DIV255(v >> 14), clamped
+			vy = vaddq_u32(vshrq_n_u32(vy, 14), v128);
+			vy = vminq_u32(vshrq_n_u32(vsraq_n_u32(vy, vy, 8), 8), v255);
+			va = vaddq_u32(vshrq_n_u32(va, 14), v128);
+			va = vminq_u32(vshrq_n_u32(vsraq_n_u32(va, va, 8), 8), v255);
+			qt_qimageScaleAAY8A_store_neon(dptr, vy, va);
+			dptr += 4;
+		}
+	}
+}
+
 #endif
@@ -52,7 +52,14 @@
 
 #include <stdbool.h>
 
-unsigned char* qSmoothScaleImage(const unsigned char* src, int sw, int sh, int sn, bool ignore_alpha, int dw, int dh);
+unsigned char* qSmoothScaleImage(const unsigned char* src,
+				 int                  sw,
+				 int                  sh,
+				 int                  sn,
+				 bool                 ignore_alpha,
+				 int                  dw,
+				 int                  dh,
+				 int                  threads);
 
 typedef struct
 {
@@ -63,6 +70,26 @@ typedef struct
 	int*                   xapoints;
 	int*                   yapoints;
 	int                    xup_yup;
+	// NOTE: Only used by the Y8 & Y8A SIMD kernels.
+	//       When downscaling, xweights holds the xspan horizontal weights of each destination pixel.
+	//       The SIMD kernels only handle the first xsimd destination pixels
+	//       (i.e., the ones for which they can read xspan source pixels without going past the end of the line),
+	//       the scalar ones take care of the rest.
+	unsigned short* xweights;
+	int             xspan;
+	int             xsimd;
 } QImageScaleInfo;
 
+// A band of destination rows, scaled in its own thread
+typedef struct
+{
+	QImageScaleInfo isi;
+	unsigned char*  dest;
+	int             sn;
+	bool            ignore_alpha;
+	int             dw;
+	int             dh;
+	int             sw;
+} QImageScaleBand;
+
 #endif
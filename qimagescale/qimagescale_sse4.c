@@ -322,4 +322,402 @@ static inline void
 	}
 }
 
+// NOTE: Unlike the RGBA ones, the Y8 & Y8A kernels work on 4 destination pixels at a time,
+//       and only handle the first isi->xsimd destination pixels (the scalar kernels take care of the rest).
+//       When scaling down horizontally, they use the flattened weights from isi->xweights,
+//       which add up to the exact same sums as the scalar helpers, so the results are identical.
+
+// Load 4 Y8 source pixels as 16-bit integers
+static inline __attribute__((always_inline)) __m128i Q_DECL_VECTORCALL
+    qt_qimageScaleAAY8_load4_sse4(const unsigned char* pix)
+{
+	int v;
+	memcpy(&v, pix, sizeof(v));
+	return _mm_cvtepu8_epi16(_mm_cvtsi32_si128(v));
+}
+
+// Horizontal sums of 4 destination pixels
+static inline __attribute__((always_inline)) __m128i Q_DECL_VECTORCALL
+    qt_qimageScaleAAY8_helper_sse4(const unsigned char*  sptr,
+				   const int*            xpoints,
+				   const unsigned short* xweights,
+				   int                   xspan)
+{
+	// NOTE: Two destination pixels per register, so that a single madd covers 4 taps of each.
+	__m128i vx[2];
+	for (int i = 0; i < 2; i++) {
+		const unsigned char*  pixl = sptr + xpoints[2 * i];
+		const unsigned char*  pixr = sptr + xpoints[2 * i + 1];
+		const unsigned short* wl   = xweights + (2 * i * xspan);
+		const unsigned short* wr   = wl + xspan;
+		vx[i]                      = _mm_setzero_si128();
+		for (int k = 0; k < xspan; k += 4) {
+			const __m128i vpix = _mm_unpacklo_epi64(qt_qimageScaleAAY8_load4_sse4(pixl + k),
+								qt_qimageScaleAAY8_load4_sse4(pixr + k));
+			const __m128i vw   = _mm_unpacklo_epi64(_mm_loadl_epi64((const __m128i*) (wl + k)),
+							      _mm_loadl_epi64((const __m128i*) (wr + k)));
+			vx[i]              = _mm_add_epi32(vx[i], _mm_madd_epi16(vpix, vw));
+		}
+	}
+	return _mm_hadd_epi32(vx[0], vx[1]);
+}
+
+// Ditto, for both components of Y8A pixels
+static inline __attribute__((always_inline)) void
+    qt_qimageScaleAAY8A_helper_sse4(const unsigned short* sptr,
+				    const int*            xpoints,
+				    const unsigned short* xweights,
+				    int                   xspan,
+				    __m128i*              vy,
+				    __m128i*              va)
+{
+	// Sort 4 Y8A pixels as 4 Y, then 4 A (so the Y sums end up in the low half, and the A sums in the high half)
+	const __m128i vsort = _mm_setr_epi8(0, 2, 4, 6, 1, 3, 5, 7, -1, -1, -1, -1, -1, -1, -1, -1);
+	__m128i       vx[4];
+	for (int i = 0; i < 4; i++) {
+		const unsigned short* pix = sptr + xpoints[i];
+		const unsigned short* w   = xweights + (i * xspan);
+		vx[i]                     = _mm_setzero_si128();
+		for (int k = 0; k < xspan; k += 4) {
+			const __m128i vpix = _mm_shuffle_epi8(_mm_loadl_epi64((const __m128i*) (pix + k)), vsort);
+			const __m128i vw   = _mm_loadl_epi64((const __m128i*) (w + k));
+			// Same weights for both halves
+			const __m128i vww = _mm_unpacklo_epi64(vw, vw);
+			vx[i]             = _mm_add_epi32(vx[i], _mm_madd_epi16(_mm_cvtepu8_epi16(vpix), vww));
+		}
+	}
+	// Y, A, Y, A
+	const __m128 vx01 = _mm_castsi128_ps(_mm_hadd_epi32(vx[0], vx[1]));
+	const __m128 vx23 = _mm_castsi128_ps(_mm_hadd_epi32(vx[2], vx[3]));
+	*vy               = _mm_castps_si128(_mm_shuffle_ps(vx01, vx23, _MM_SHUFFLE(2, 0, 2, 0)));
+	*va               = _mm_castps_si128(_mm_shuffle_ps(vx01, vx23, _MM_SHUFFLE(3, 1, 3, 1)));
+}
+
+// The horizontal interpolation weights of 4 destination pixels, as 16-bit (256 - xap, xap) pairs
+static inline __attribute__((always_inline)) __m128i Q_DECL_VECTORCALL
+    qt_qimageScaleAAY8_xap_sse4(const int* xapoints)
+{
+	return _mm_setr_epi16((short) (256 - xapoints[0]),
+			      (short) xapoints[0],
+			      (short) (256 - xapoints[1]),
+			      (short) xapoints[1],
+			      (short) (256 - xapoints[2]),
+			      (short) xapoints[2],
+			      (short) (256 - xapoints[3]),
+			      (short) xapoints[3]);
+}
+
+// Interpolate the two neighboring source pixels of 4 destination pixels
+static inline __attribute__((always_inline)) __m128i Q_DECL_VECTORCALL
+    qt_qimageScaleAAY8_pairs_sse4(const unsigned char* sptr, const int* xpoints, const __m128i vxap)
+{
+	const __m128i vpix = _mm_setr_epi16(sptr[xpoints[0]],
+					    sptr[xpoints[0] + 1],
+					    sptr[xpoints[1]],
+					    sptr[xpoints[1] + 1],
+					    sptr[xpoints[2]],
+					    sptr[xpoints[2] + 1],
+					    sptr[xpoints[3]],
+					    sptr[xpoints[3] + 1]);
+	return _mm_madd_epi16(vpix, vxap);
+}
+
+// Ditto, for both components of Y8A pixels
+static inline __attribute__((always_inline)) void
+    qt_qimageScaleAAY8A_pairs_sse4(const unsigned short* sptr,
+				   const int*            xpoints,
+				   const __m128i         vxap,
+				   __m128i*              vy,
+				   __m128i*              va)
+{
+	// Sort 4 pairs of Y8A pixels as 4 pairs of Y, then 4 pairs of A
+	const __m128i vsort = _mm_setr_epi8(0, 2, 4, 6, 8, 10, 12, 14, 1, 3, 5, 7, 9, 11, 13, 15);
+	int           pairs[4];
+	for (int i = 0; i < 4; i++) {
+		memcpy(&pairs[i], sptr + xpoints[i], sizeof(*pairs));
+	}
+	const __m128i vpix = _mm_shuffle_epi8(_mm_setr_epi32(pairs[0], pairs[1], pairs[2], pairs[3]), vsort);
+	*vy                = _mm_madd_epi16(_mm_cvtepu8_epi16(vpix), vxap);
+	*va                = _mm_madd_epi16(_mm_cvtepu8_epi16(_mm_srli_si128(vpix, 8)), vxap);
+}
+
+static inline void
+    qt_qimageScaleAAY8_up_x_down_y_sse4(QImageScaleInfo* isi, unsigned char* dest, int dw, int dh, int dow, int sow)
+{
+	const unsigned char** ypoints  = isi->ypoints_y8;
+	int*                  xpoints  = isi->xpoints;
+	int*                  xapoints = isi->xapoints;
+	int*                  yapoints = isi->yapoints;
+
+	/* go through every scanline in the output buffer */
+	for (int y = 0; y < dh; y++) {
+		int           Cy   = yapoints[y] >> 16;
+		int           yap  = yapoints[y] & 0xffff;
+		const __m128i vCy  = _mm_set1_epi32(Cy);
+		const __m128i vyap = _mm_set1_epi32(yap);
+
+		unsigned char* dptr = dest + (y * dow);
+		for (int x = 0; x < dw; x += 4) {
+			// NOTE: We interpolate horizontally first, which is fine, since nothing is rounded until the end
+			//       (when xap is 0, that's a multiplication by 256, which the final shift takes care of).
+			const int*           xp   = xpoints + x;
+			const __m128i        vxap = qt_qimageScaleAAY8_xap_sse4(xapoints + x);
+			const unsigned char* sptr = ypoints[y];
+			__m128i              vr   = qt_qimageScaleAAY8_pairs_sse4(sptr, xp, vxap);
+			__m128i              vx   = _mm_mullo_epi32(vr, vyap);
+
+			int j;
+			for (j = (1 << 14) - yap; j > Cy; j -= Cy) {
+				sptr += sow;
+				vr = qt_qimageScaleAAY8_pairs_sse4(sptr, xp, vxap);
+				vx = _mm_add_epi32(vx, _mm_mullo_epi32(vr, vCy));
+			}
+			sptr += sow;
+			vr = qt_qimageScaleAAY8_pairs_sse4(sptr, xp, vxap);
+			vx = _mm_add_epi32(vx, _mm_mullo_epi32(vr, _mm_set1_epi32(j)));
+
+			vx          = _mm_srli_epi32(vx, 8 + 14);
+			vx          = _mm_packus_epi32(vx, _mm_setzero_si128());
+			vx          = _mm_packus_epi16(vx, _mm_setzero_si128());
+			const int v = _mm_cvtsi128_si32(vx);
+			memcpy(dptr, &v, sizeof(v));
+			dptr += 4;
+		}
+	}
+}
+
+static inline void
+    qt_qimageScaleAAY8_down_x_up_y_sse4(QImageScaleInfo* isi, unsigned char* dest, int dw, int dh, int dow, int sow)
+{
+	const unsigned char** ypoints  = isi->ypoints_y8;
+	int*                  xpoints  = isi->xpoints;
+	int*                  yapoints = isi->yapoints;
+	const unsigned short* xweights = isi->xweights;
+	const int             xspan    = isi->xspan;
+
+	const __m128i v256 = _mm_set1_epi32(256);
+
+	/* go through every scanline in the output buffer */
+	for (int y = 0; y < dh; y++) {
+		const unsigned char* sptr    = ypoints[y];
+		int                  yap     = yapoints[y];
+		const __m128i        vyap    = _mm_set1_epi32(yap);
+		const __m128i        vinvyap = _mm_sub_epi32(v256, vyap);
+
+		unsigned char* dptr = dest + (y * dow);
+		for (int x = 0; x < dw; x += 4) {
+			const unsigned short* w  = xweights + (x * xspan);
+			__m128i               vx = qt_qimageScaleAAY8_helper_sse4(sptr, xpoints + x, w, xspan);
+
+			if (yap > 0) {
+				__m128i vr = qt_qimageScaleAAY8_helper_sse4(sptr + sow, xpoints + x, w, xspan);
+
+				vx = _mm_mullo_epi32(vx, vinvyap);
+				vr = _mm_mullo_epi32(vr, vyap);
+				vx = _mm_add_epi32(vx, vr);
+				vx = _mm_srli_epi32(vx, 8);
+			}
+			vx          = _mm_srli_epi32(vx, 14);
+			vx          = _mm_packus_epi32(vx, _mm_setzero_si128());
+			vx          = _mm_packus_epi16(vx, _mm_setzero_si128());
+			const int v = _mm_cvtsi128_si32(vx);
+			memcpy(dptr, &v, sizeof(v));
+			dptr += 4;
+		}
+	}
+}
+
+static inline void
+    qt_qimageScaleAAY8_down_xy_sse4(QImageScaleInfo* isi, unsigned char* dest, int dw, int dh, int dow, int sow)
+{
+	const unsigned char** ypoints  = isi->ypoints_y8;
+	int*                  xpoints  = isi->xpoints;
+	int*                  yapoints = isi->yapoints;
+	const unsigned short* xweights = isi->xweights;
+	const int             xspan    = isi->xspan;
+
+	const __m128i v128 = _mm_set1_epi32(128);
+
+	for (int y = 0; y < dh; y++) {
+		int           Cy   = yapoints[y] >> 16;
+		int           yap  = yapoints[y] & 0xffff;
+		const __m128i vCy  = _mm_set1_epi32(Cy);
+		const __m128i vyap = _mm_set1_epi32(yap);
+
+		unsigned char* dptr = dest + (y * dow);
+		for (int x = 0; x < dw; x += 4) {
+			const int*            xp   = xpoints + x;
+			const unsigned short* w    = xweights + (x * xspan);
+			const unsigned char*  sptr = ypoints[y];
+			__m128i               vx   = qt_qimageScaleAAY8_helper_sse4(sptr, xp, w, xspan);
+			__m128i               vr   = _mm_mullo_epi32(_mm_srli_epi32(vx, 6), vyap);
+
+			int j;
+			for (j = (1 << 14) - yap; j > Cy; j -= Cy) {
+				sptr += sow;
+				vx = qt_qimageScaleAAY8_helper_sse4(sptr, xp, w, xspan);
+				vr = _mm_add_epi32(vr, _mm_mullo_epi32(_mm_srli_epi32(vx, 6), vCy));
+			}
+			sptr += sow;
+			vx = qt_qimageScaleAAY8_helper_sse4(sptr, xp, w, xspan);
+			vr = _mm_add_epi32(vr, _mm_mullo_epi32(_mm_srli_epi32(vx, 6), _mm_set1_epi32(j)));
+
+			// DIV255(vr >> 14)
+			vr          = _mm_add_epi32(_mm_srli_epi32(vr, 14), v128);
+			vr          = _mm_srli_epi32(_mm_add_epi32(_mm_srli_epi32(vr, 8), vr), 8);
+			vr          = _mm_packus_epi32(vr, _mm_setzero_si128());
+			vr          = _mm_packus_epi16(vr, _mm_setzero_si128());
+			const int v = _mm_cvtsi128_si32(vr);
+			memcpy(dptr, &v, sizeof(v));
+			dptr += 4;
+		}
+	}
+}
+
+static inline void
+    qt_qimageScaleAAY8A_up_x_down_y_sse4(QImageScaleInfo* isi, unsigned short* dest, int dw, int dh, int dow, int sow)
+{
+	const unsigned short** ypoints  = isi->ypoints_y8a;
+	int*                   xpoints  = isi->xpoints;
+	int*                   xapoints = isi->xapoints;
+	int*                   yapoints = isi->yapoints;
+
+	/* go through every scanline in the output buffer */
+	for (int y = 0; y < dh; y++) {
+		int           Cy   = yapoints[y] >> 16;
+		int           yap  = yapoints[y] & 0xffff;
+		const __m128i vCy  = _mm_set1_epi32(Cy);
+		const __m128i vyap = _mm_set1_epi32(yap);
+
+		unsigned short* dptr = dest + (y * dow);
+		for (int x = 0; x < dw; x += 4) {
+			// NOTE: Same idea as the Y8 variant.
+			const int*            xp   = xpoints + x;
+			const __m128i         vxap = qt_qimageScaleAAY8_xap_sse4(xapoints + x);
+			const unsigned short* sptr = ypoints[y];
+			__m128i               vyx, vax;
+			qt_qimageScaleAAY8A_pairs_sse4(sptr, xp, vxap, &vyx, &vax);
+			__m128i vy = _mm_mullo_epi32(vyx, vyap);
+			__m128i va = _mm_mullo_epi32(vax, vyap);
+
+			int j;
+			for (j = (1 << 14) - yap; j > Cy; j -= Cy) {
+				sptr += sow;
+				qt_qimageScaleAAY8A_pairs_sse4(sptr, xp, vxap, &vyx, &vax);
+				vy = _mm_add_epi32(vy, _mm_mullo_epi32(vyx, vCy));
+				va = _mm_add_epi32(va, _mm_mullo_epi32(vax, vCy));
+			}
+			sptr += sow;
+			const __m128i vj = _mm_set1_epi32(j);
+			qt_qimageScaleAAY8A_pairs_sse4(sptr, xp, vxap, &vyx, &vax);
+			vy = _mm_add_epi32(vy, _mm_mullo_epi32(vyx, vj));
+			va = _mm_add_epi32(va, _mm_mullo_epi32(vax, vj));
+
+			vy = _mm_srli_epi32(vy, 8 + 14);
+			va = _mm_srli_epi32(va, 8 + 14);
+			vy = _mm_or_si128(vy, _mm_slli_epi32(va, 8));
+			vy = _mm_packus_epi32(vy, _mm_setzero_si128());
+			_mm_storel_epi64((__m128i*) dptr, vy);
+			dptr += 4;
+		}
+	}
+}
+
+static inline void
+    qt_qimageScaleAAY8A_down_x_up_y_sse4(QImageScaleInfo* isi, unsigned short* dest, int dw, int dh, int dow, int sow)
+{
+	const unsigned short** ypoints  = isi->ypoints_y8a;
+	int*                   xpoints  = isi->xpoints;
+	int*                   yapoints = isi->yapoints;
+	const unsigned short*  xweights = isi->xweights;
+	const int              xspan    = isi->xspan;
+
+	const __m128i v256 = _mm_set1_epi32(256);
+
+	/* go through every scanline in the output buffer */
+	for (int y = 0; y < dh; y++) {
+		const unsigned short* sptr    = ypoints[y];
+		int                   yap     = yapoints[y];
+		const __m128i         vyap    = _mm_set1_epi32(yap);
+		const __m128i         vinvyap = _mm_sub_epi32(v256, vyap);
+
+		unsigned short* dptr = dest + (y * dow);
+		for (int x = 0; x < dw; x += 4) {
+			const unsigned short* w = xweights + (x * xspan);
+			__m128i               vy, va;
+			qt_qimageScaleAAY8A_helper_sse4(sptr, xpoints + x, w, xspan, &vy, &va);
+
+			if (yap > 0) {
+				__m128i vyy, vaa;
+				qt_qimageScaleAAY8A_helper_sse4(sptr + sow, xpoints + x, w, xspan, &vyy, &vaa);
+
+				vy = _mm_add_epi32(_mm_mullo_epi32(vy, vinvyap), _mm_mullo_epi32(vyy, vyap));
+				va = _mm_add_epi32(_mm_mullo_epi32(va, vinvyap), _mm_mullo_epi32(vaa, vyap));
+				vy = _mm_srli_epi32(vy, 8);
+				va = _mm_srli_epi32(va, 8);
+			}
+			vy = _mm_srli_epi32(vy, 14);
+			va = _mm_srli_epi32(va, 14);
+			vy = _mm_or_si128(vy, _mm_slli_epi32(va, 8));
+			vy = _mm_packus_epi32(vy, _mm_setzero_si128());
+			_mm_storel_epi64((__m128i*) dptr, vy);
+			dptr += 4;
+		}
+	}
+}
+
+static inline void
+    qt_qimageScaleAAY8A_down_xy_sse4(QImageScaleInfo* isi, unsigned short* dest, int dw, int dh, int dow, int sow)
+{
+	const unsigned short** ypoints  = isi->ypoints_y8a;
+	int*                   xpoints  = isi->xpoints;
+	int*                   yapoints = isi->yapoints;
+	const unsigned short*  xweights = isi->xweights;
+	const int              xspan    = isi->xspan;
+
+	const __m128i v128 = _mm_set1_epi32(128);
+	const __m128i v255 = _mm_set1_epi32(255);
+
+	for (int y = 0; y < dh; y++) {
+		int           Cy   = yapoints[y] >> 16;
+		int           yap  = yapoints[y] & 0xffff;
+		const __m128i vCy  = _mm_set1_epi32(Cy);
+		const __m128i vyap = _mm_set1_epi32(yap);
+
+		unsigned short* dptr = dest + (y * dow);
+		for (int x = 0; x < dw; x += 4) {
+			const int*            xp   = xpoints + x;
+			const unsigned short* w    = xweights + (x * xspan);
+			const unsigned short* sptr = ypoints[y];
+			__m128i               vyx, vax;
+			qt_qimageScaleAAY8A_helper_sse4(sptr, xp, w, xspan, &vyx, &vax);
+			__m128i vy = _mm_mullo_epi32(_mm_srli_epi32(vyx, 6), vyap);
+			__m128i va = _mm_mullo_epi32(_mm_srli_epi32(vax, 6), vyap);
+
+			int j;
+			for (j = (1 << 14) - yap; j > Cy; j -= Cy) {
+				sptr += sow;
+				qt_qimageScaleAAY8A_helper_sse4(sptr, xp, w, xspan, &vyx, &vax);
+				vy = _mm_add_epi32(vy, _mm_mullo_epi32(_mm_srli_epi32(vyx, 6), vCy));
+				va = _mm_add_epi32(va, _mm_mullo_epi32(_mm_srli_epi32(vax, 6), vCy));
+			}
+			sptr += sow;
+			const __m128i vj = _mm_set1_epi32(j);
+			qt_qimageScaleAAY8A_helper_sse4(sptr, xp, w, xspan, &vyx, &vax);
+			vy = _mm_add_epi32(vy, _mm_mullo_epi32(_mm_srli_epi32(vyx, 6), vj));
+			va = _mm_add_epi32(va, _mm_mullo_epi32(_mm_srli_epi32(vax, 6), vj));
+
+			// DIV255(v >> 14), clamped
+			vy = _mm_add_epi32(_mm_srli_epi32(vy, 14), v128);
+			vy = _mm_min_epi32(_mm_srli_epi32(_mm_add_epi32(_mm_srli_epi32(vy, 8), vy), 8), v255);
+			va = _mm_add_epi32(_mm_srli_epi32(va, 14), v128);
+			va = _mm_min_epi32(_mm_srli_epi32(_mm_add_epi32(_mm_srli_epi32(va, 8), va), 8), v255);
+			vy = _mm_or_si128(vy, _mm_slli_epi32(va, 8));
+			vy = _mm_packus_epi32(vy, _mm_setzero_si128());
+			_mm_storel_epi64((__m128i*) dptr, vy);
+			dptr += 4;
+		}
+	}
+}
+
 #endif
@@ -14,6 +14,15 @@
 #       the uint64_t codepath is currently commented out, since it's unneeded with our current font panel).
 #       As for the conversion process itself, FontForge + gbdfed + a text editor should handle most common cases just fine ;).
 #       In case that wasn't clear, width of intermediary values are supported, it's just a bit of a waste of memory ;).
+# NOTE: Glyphs are stored in a single dense array, in codepoint order, and we generate a two-level lookup table alongside it:
+#       the codepoint's high byte picks a page in the page index, and its low byte a bit in that page's bitmap,
+#       which is set if that codepoint has a glyph.
+#       Since glyphs are in codepoint order, a glyph's index in the glyph array is simply the index of the first glyph
+#       of its 32 codepoints word (which we store alongside the bitmap), plus the amount of bits set before it in that word.
+#       Pages without any glyphs in them all share the same (empty) page, so codepoints in there get the first glyph.
+#       That one doubles as our fallback glyph (like the first glyph of the first block did with our previous if ladders).
+#       This means looking up any codepoint only costs us a few loads & a popcount, instead of a linear search,
+#       and a page only costs us 48 bytes, instead of one 16-bit glyph index per codepoint ;).
 #
 ##
 
@@ -21,7 +30,7 @@
 import re
 import sys
 
-# We'll send the C header to stdout, but our C if/else snippet to stderr... ;).
+# We'll send the C header to stdout, but our C lookup function to stderr... ;).
 # And then use your shell to handle the I/O redirections, because I'm lazy :D.
 # ./hextoc.py unscii > ../fonts/unscii.h 2>> ../fbink_unscii.c
 def eprint(*args, **kwargs):
@@ -110,11 +119,17 @@ def hex2f64(v):
 print("*/")
 print("")
 
-blocknum = 0
-blockcount = 1
-blockcp = 0x0
-cp = 0x0
-prevcp = 0x0
+if fontwidth <= 8:
+	ctype = "unsigned char"
+elif fontwidth <= 16:
+	ctype = "uint16_t"
+elif fontwidth <= 32:
+	ctype = "uint32_t"
+elif fontwidth <= 64:
+	ctype = "uint64_t"
+else:
+	print("Unsupported font width (Must be <= 64)!")
+	exit(-1)
 
 pat_cp = "([0-9a-fA-F]{4})"
 if fontwidth <= 8:
@@ -123,71 +138,21 @@ def hex2f64(v):
 	pat_rows = "([0-9a-fA-F]{4})" * fontheight
 elif fontwidth <= 32:
 	pat_rows = "([0-9a-fA-F]{8})" * fontheight
-elif fontwidth <= 64:
-	pat_rows = "([0-9a-fA-F]{16})" * fontheight
 else:
-	print("Unsupported font width (Must be <= 64)!")
-	exit(-1)
+	pat_rows = "([0-9a-fA-F]{16})" * fontheight
 fmt = re.compile(r"{}:{}".format(pat_cp, pat_rows))
 
+# Codepoint -> index in the glyph array
+glyphs = {}
+
+print("static const {} {}_glyphs[][{}] = {{".format(ctype, fontname, fontheight))
 with open(fontfile, "r") as f:
 	for line in f:
 		m = fmt.match(line)
 		if m:
 			cp = m.group(1)
 			hcp = int(cp, base=16)
-			if hcp == prevcp + 0x1:
-				blockcount += 1
-			else:
-				if blocknum > 0:
-					print("}}; // {}".format(blockcount))
-					print("")
-					if blocknum == 1:
-						if fontwidth <= 8:
-							eprint("static const unsigned char*")
-						elif fontwidth <= 16:
-							eprint("static const uint16_t*")
-						elif fontwidth <= 32:
-							eprint("static const uint32_t*")
-						elif fontwidth <= 64:
-							eprint("static const uint64_t*")
-						else:
-							exit(-1)
-						eprint("    {}_get_bitmap(uint32_t codepoint)".format(fontname))
-						eprint("{")
-						if blockcp > 0 :
-							if blockcp == prevcp:
-								eprint("\tif (codepoint == {:#04x}u) {{".format(blockcp))
-								eprint("\t\treturn {}_block{}[0];".format(fontname, blocknum))
-							else:
-								eprint("\tif (codepoint >= {:#04x}u && codepoint <= {:#04x}u) {{".format(blockcp, prevcp))
-								eprint("\t\treturn {}_block{}[codepoint - {:#04x}u];".format(fontname, blocknum, blockcp))
-						else:
-							if prevcp == 0:
-								eprint("\tif (codepoint == {:#04x}u) {{".format(prevcp))
-							else:
-								eprint("\tif (codepoint <= {:#04x}u) {{".format(prevcp))
-							eprint("\t\treturn {}_block{}[codepoint];".format(fontname, blocknum))
-					else:
-						if blockcp == prevcp:
-							eprint("\t}} else if (codepoint == {:#04x}u) {{".format(blockcp))
-							eprint("\t\treturn {}_block{}[0];".format(fontname, blocknum))
-						else:
-							eprint("\t}} else if (codepoint >= {:#04x}u && codepoint <= {:#04x}u) {{".format(blockcp, prevcp))
-							eprint("\t\treturn {}_block{}[codepoint - {:#04x}u];".format(fontname, blocknum, blockcp))
-				blocknum += 1
-				blockcount = 1
-				blockcp = hcp
-				if fontwidth <= 8:
-					print("static const unsigned char {}_block{}[][{}] = {{".format(fontname, blocknum, fontheight))
-				elif fontwidth <= 16:
-					print("static const uint16_t {}_block{}[][{}] = {{".format(fontname, blocknum, fontheight))
-				elif fontwidth <= 32:
-					print("static const uint32_t {}_block{}[][{}] = {{".format(fontname, blocknum, fontheight))
-				elif fontwidth <= 64:
-					print("static const uint64_t {}_block{}[][{}] = {{".format(fontname, blocknum, fontheight))
-				else:
-					exit(-1)
+			glyphs[hcp] = len(glyphs)
 
 			print(u"\t{", end='')
 			if fontwidth <= 8:
@@ -199,55 +164,68 @@ def hex2f64(v):
 			elif fontwidth <= 32:
 				for i in range(fontheight):
 					print(u" {:#010x}".format(hex2f32(m.group(i+2))), end='' if i+1 == fontheight else ',')
-			elif fontwidth <= 64:
+			else:
 				for i in range(fontheight):
 					print(u" {:#018x}".format(hex2f64(m.group(i+2))), end='' if i+1 == fontheight else ',')
-			else:
-				exit(-1)
 			print(u" }},\t// U+{} ({})".format(cp, chr(hcp) if hcp >= 0x20 else "ESC"))
-			prevcp = hcp
-print("}}; // {}".format(blockcount))
+print("}}; // {}".format(len(glyphs)))
 print("")
 
-# Handle single block fonts
-if blocknum == 1:
-	if fontwidth <= 8:
-		eprint("static const unsigned char*")
-	elif fontwidth <= 16:
-		eprint("static const uint16_t*")
-	elif fontwidth <= 32:
-		eprint("static const uint32_t*")
-	elif fontwidth <= 64:
-		eprint("static const uint64_t*")
-	else:
-		exit(-1)
-	eprint("    {}_get_bitmap(uint32_t codepoint)".format(fontname))
-	eprint("{")
-	if blockcp > 0:
-		if blockcp == prevcp:
-			eprint("\tif (codepoint == {:#04x}u) {{".format(blockcp))
-			eprint("\t\treturn {}_block{}[0];".format(fontname, blocknum))
-		else:
-			eprint("\tif (codepoint >= {:#04x}u && codepoint <= {:#04x}u) {{".format(blockcp, prevcp))
-			eprint("\t\treturn {}_block{}[codepoint - {:#04x}u];".format(fontname, blocknum, blockcp))
+if len(glyphs) > 0xFFFF:
+	print("Too many glyphs (Must be <= 65535)!")
+	exit(-1)
+
+# Build the page index: page 0 is the shared empty page
+lastpage = max(glyphs.keys()) >> 8
+used_pages = sorted(set(cp >> 8 for cp in glyphs.keys()))
+if len(used_pages) >= 0xFF:
+	print("Too many pages (Must be < 255)!")
+	exit(-1)
+page_slots = {page: i + 1 for i, page in enumerate(used_pages)}
+
+print("static const uint8_t {}_page_index[] = {{".format(fontname))
+for i in range(0, lastpage + 1, 16):
+	print("\t" + ", ".join("{:#04x}".format(page_slots.get(page, 0)) for page in range(i, min(i + 16, lastpage + 1))) + ",")
+print("}}; // {}".format(lastpage + 1))
+print("")
+
+# For each page, one bit per codepoint, set if it has a glyph, in 32 codepoints words
+print("static const uint32_t {}_page_bits[][8] = {{".format(fontname))
+for page in [None] + used_pages:
+	if page is None:
+		words = [0] * 8
 	else:
-		if prevcp == 0:
-			eprint("\tif (codepoint == {:#04x}u) {{".format(prevcp))
-		else:
-			eprint("\tif (codepoint <= {:#04x}u) {{".format(prevcp))
-		eprint("\t\treturn {}_block{}[codepoint];".format(fontname, blocknum))
-else:
-	# Otherwise, don't forget the final block ;)
-	if blockcp == prevcp:
-		eprint("\t}} else if (codepoint == {:#04x}u) {{".format(blockcp))
-		eprint("\t\treturn {}_block{}[0];".format(fontname, blocknum))
+		words = [sum(1 << b for b in range(32) if ((page << 8) | (w << 5) | b) in glyphs) for w in range(8)]
+	print("\t{ " + ", ".join("{:#010x}".format(v) for v in words) + " },", end='')
+	print("\t// Empty" if page is None else "\t// U+{:02X}xx".format(page))
+print("}}; // {}".format(len(used_pages) + 1))
+print("")
+
+# And the index of the first glyph of each of those words in the glyph array
+print("static const uint16_t {}_page_base[][8] = {{".format(fontname))
+for page in [None] + used_pages:
+	if page is None:
+		bases = [0] * 8
 	else:
-		eprint("\t}} else if (codepoint >= {:#04x}u && codepoint <= {:#04x}u) {{".format(blockcp, prevcp))
-		eprint("\t\treturn {}_block{}[codepoint - {:#04x}u];".format(fontname, blocknum, blockcp))
+		bases = [sum(1 for cp in glyphs.keys() if cp < ((page << 8) | (w << 5))) for w in range(8)]
+	print("\t{ " + ", ".join("{:#06x}".format(v) for v in bases) + " },", end='')
+	print("\t// Empty" if page is None else "\t// U+{:02X}xx".format(page))
+print("}}; // {}".format(len(used_pages) + 1))
+print("")
 
-eprint("\t} else {")
+eprint("static const {}*".format(ctype))
+eprint("    {}_get_bitmap(uint32_t codepoint)".format(fontname))
+eprint("{")
+eprint("\tconst uint32_t page = codepoint >> 8U;")
+eprint("\tconst uint8_t  slot = page <= {:#04x}u ? {}_page_index[page] : 0U;".format(lastpage, fontname))
+eprint("\tconst uint32_t word = (codepoint >> 5U) & 0x07U;")
+eprint("\tconst uint32_t bit  = 1U << (codepoint & 0x1FU);")
+eprint("\tconst uint32_t bits = {}_page_bits[slot][word];".format(fontname))
+eprint("\tif (!(bits & bit)) {")
 eprint('\t\tWARN("Codepoint U+%04X (%s) is not covered by this font", codepoint, u8_cp_to_utf8(codepoint));')
-eprint("\t\treturn {}_block1[0];".format(fontname))
+eprint("\t\treturn {}_glyphs[0];".format(fontname))
 eprint("\t}")
+eprint("\tconst uint32_t glyph = {}_page_base[slot][word] + (uint32_t) __builtin_popcount(bits & (bit - 1U));".format(fontname))
+eprint("\treturn {}_glyphs[glyph];".format(fontname))
 eprint("}")
 eprint("")
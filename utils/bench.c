@@ -0,0 +1,520 @@
+/*
+	FBInk: FrameBuffer eInker, a tool to print text & images on eInk devices (Kobo/Kindle)
+	Copyright (C) 2018-2020 NiLuJe <ninuje@gmail.com>
+	SPDX-License-Identifier: GPL-3.0-or-later
+
+	----
+
+	This program is free software: you can redistribute it and/or modify
+	it under the terms of the GNU General Public License as published by
+	the Free Software Foundation, either version 3 of the License, or
+	(at your option) any later version.
+
+	This program is distributed in the hope that it will be useful,
+	but WITHOUT ANY WARRANTY; without even the implied warranty of
+	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+	GNU General Public License for more details.
+
+	You should have received a copy of the GNU General Public License
+	along with this program.  If not, see <https://www.gnu.org/licenses/>.
+*/
+
+// NOTE: Times the rendering hot paths against an off-screen canvas (c.f., fbink_open_canvas),
+//       for every supported bitdepth, in both Portrait & Landscape layouts,
+//       so it runs just fine on a box without a framebuffer ;).
+//       Refreshes are only recorded on a canvas, so this measures rendering, and rendering alone.
+
+// Because we're pretty much Linux-bound ;).
+#ifndef _GNU_SOURCE
+#	define _GNU_SOURCE
+#endif
+
+#include "../fbink.h"
+#include <errno.h>
+#include <getopt.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <strings.h>
+#include <time.h>
+
+// We want to return negative values on failure, always
+#define ERRCODE(e) (-(e))
+
+// Everything a benchmark needs to do its thing
+typedef struct
+{
+	int            fbfd;
+	FBInkConfig    fbink_cfg;
+	uint32_t       width;
+	uint32_t       height;
+	unsigned char* img_y8;
+	unsigned char* img_ya;
+	unsigned char* img_rgb;
+	unsigned char* img_rgba;
+	FBInkDump      dump;
+	float          param;    // Current BenchCase's param
+} BenchContext;
+
+// A single benchmark: returns the amount of pixels it touched via pixels, or a negative value on failure
+typedef int (*bench_fx)(BenchContext* restrict, size_t, uint64_t* restrict);
+
+typedef struct
+{
+	const char* name;
+	bench_fx    fx;
+	uint8_t     fontmult;    // For draw, needs an fbink_init
+	bool        needs_font;  // For fbink_print_ot, needs an OT font
+	float       param;       // Benchmark-specific
+} BenchCase;
+
+#define IMG_W 400
+#define IMG_H 300
+
+static const char* font_path = NULL;
+
+// Helpers
+static uint64_t
+    now_ns(void)
+{
+	struct timespec ts;
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return (uint64_t) ts.tv_sec * 1000000000U + (uint64_t) ts.tv_nsec;
+}
+
+static int
+    cmp_u64(const void* a, const void* b)
+{
+	const uint64_t x = *(const uint64_t*) a;
+	const uint64_t y = *(const uint64_t*) b;
+	return (x > y) - (x < y);
+}
+
+static double
+    percentile_us(const uint64_t* sorted, size_t n, unsigned int pct)
+{
+	size_t idx = (n * pct) / 100U;
+	if (idx >= n) {
+		idx = n - 1U;
+	}
+	return (double) sorted[idx] / 1000.0;
+}
+
+static uint64_t
+    last_rect_area(void)
+{
+	const FBInkRect rect = fbink_get_last_rect();
+	return (uint64_t) rect.width * rect.height;
+}
+
+// The benchmarks themselves
+static int
+    bench_fill_rect(BenchContext* restrict ctx, size_t i, uint64_t* restrict pixels)
+{
+	const FBInkRect rect = {
+		.left   = (unsigned short int) ((i * 37U) % (ctx->width - 200U)),
+		.top    = (unsigned short int) ((i * 53U) % (ctx->height - 200U)),
+		.width  = 200U,
+		.height = 200U,
+	};
+	ctx->fbink_cfg.is_inverted = (i & 1U);
+	int rv                     = fbink_cls(ctx->fbfd, &ctx->fbink_cfg, &rect);
+	ctx->fbink_cfg.is_inverted = false;
+	*pixels                    = (uint64_t) rect.width * rect.height;
+	return rv;
+}
+
+static int
+    bench_clear_screen(BenchContext* restrict ctx, size_t i __attribute__((unused)), uint64_t* restrict pixels)
+{
+	*pixels = (uint64_t) ctx->width * ctx->height;
+	return fbink_cls(ctx->fbfd, &ctx->fbink_cfg, NULL);
+}
+
+static int
+    bench_draw(BenchContext* restrict ctx, size_t i, uint64_t* restrict pixels)
+{
+	ctx->fbink_cfg.row = (short int) (i % 8U);
+	int rv             = fbink_print(ctx->fbfd, "The quick brown fox jumps over", &ctx->fbink_cfg);
+	ctx->fbink_cfg.row = 0;
+	*pixels            = last_rect_area();
+	return (rv < 0) ? rv : 0;
+}
+
+static int
+    bench_print_ot(BenchContext* restrict ctx, size_t i, uint64_t* restrict pixels, const char* string, float size_px)
+{
+	FBInkOTConfig ot_cfg = { 0 };
+	ot_cfg.size_px       = (unsigned short int) size_px;
+	ot_cfg.margins.top   = (short int) ((i % 4U) * 64U);
+	int rv               = fbink_print_ot(ctx->fbfd, string, &ot_cfg, &ctx->fbink_cfg, NULL);
+	*pixels              = last_rect_area();
+	return (rv < 0) ? rv : 0;
+}
+
+static int
+    bench_print_ot_short(BenchContext* restrict ctx, size_t i, uint64_t* restrict pixels)
+{
+	return bench_print_ot(ctx, i, pixels, "Hello, world!", ctx->param);
+}
+
+static int
+    bench_print_ot_long(BenchContext* restrict ctx, size_t i, uint64_t* restrict pixels)
+{
+	return bench_print_ot(
+	    ctx,
+	    i,
+	    pixels,
+	    "Lorem ipsum dolor sit amet, consectetur adipiscing elit, sed do eiusmod tempor incididunt ut labore et dolore "
+	    "magna aliqua. Ut enim ad minim veniam, quis nostrud exercitation ullamco laboris nisi ut aliquip ex ea commodo.",
+	    ctx->param);
+}
+
+static int
+    bench_image(BenchContext* restrict ctx, size_t i, uint64_t* restrict pixels, unsigned char* data, size_t bpp)
+{
+	const short int x_off = (short int) ((i * 31U) % (ctx->width / 2U));
+	const short int y_off = (short int) ((i * 17U) % (ctx->height / 2U));
+	int             rv    = fbink_print_raw_data(
+            ctx->fbfd, data, IMG_W, IMG_H, (size_t) IMG_W * IMG_H * bpp, x_off, y_off, &ctx->fbink_cfg);
+	*pixels = last_rect_area();
+	return rv;
+}
+
+static int
+    bench_image_y8(BenchContext* restrict ctx, size_t i, uint64_t* restrict pixels)
+{
+	return bench_image(ctx, i, pixels, ctx->img_y8, 1U);
+}
+
+static int
+    bench_image_ya(BenchContext* restrict ctx, size_t i, uint64_t* restrict pixels)
+{
+	return bench_image(ctx, i, pixels, ctx->img_ya, 2U);
+}
+
+static int
+    bench_image_rgb(BenchContext* restrict ctx, size_t i, uint64_t* restrict pixels)
+{
+	return bench_image(ctx, i, pixels, ctx->img_rgb, 3U);
+}
+
+static int
+    bench_image_rgba(BenchContext* restrict ctx, size_t i, uint64_t* restrict pixels)
+{
+	return bench_image(ctx, i, pixels, ctx->img_rgba, 4U);
+}
+
+static int
+    bench_image_rgba_flat(BenchContext* restrict ctx, size_t i, uint64_t* restrict pixels)
+{
+	ctx->fbink_cfg.ignore_alpha = true;
+	int rv                      = bench_image(ctx, i, pixels, ctx->img_rgba, 4U);
+	ctx->fbink_cfg.ignore_alpha = false;
+	return rv;
+}
+
+static int
+    bench_image_dithered(BenchContext* restrict ctx, size_t i, uint64_t* restrict pixels)
+{
+	ctx->fbink_cfg.sw_dithering = true;
+	int rv                      = bench_image(ctx, i, pixels, ctx->img_rgb, 3U);
+	ctx->fbink_cfg.sw_dithering = false;
+	return rv;
+}
+
+static int
+    bench_image_scaled(BenchContext* restrict ctx, size_t i, uint64_t* restrict pixels)
+{
+	ctx->fbink_cfg.scaled_width  = (short int) (IMG_W * 2);
+	ctx->fbink_cfg.scaled_height = (short int) (IMG_H * 2);
+	int rv                       = bench_image(ctx, i, pixels, ctx->img_rgba, 4U);
+	ctx->fbink_cfg.scaled_width  = 0;
+	ctx->fbink_cfg.scaled_height = 0;
+	return rv;
+}
+
+static int
+    bench_region_dump(BenchContext* restrict ctx, size_t i, uint64_t* restrict pixels)
+{
+	const short int x_off = (short int) ((i * 31U) % (ctx->width / 2U));
+	const short int y_off = (short int) ((i * 17U) % (ctx->height / 2U));
+	int rv = fbink_region_dump(ctx->fbfd, x_off, y_off, IMG_W, IMG_H, &ctx->fbink_cfg, &ctx->dump);
+	*pixels = (uint64_t) IMG_W * IMG_H;
+	return rv;
+}
+
+static int
+    bench_restore(BenchContext* restrict ctx, size_t i __attribute__((unused)), uint64_t* restrict pixels)
+{
+	*pixels = (uint64_t) ctx->dump.area.width * ctx->dump.area.height;
+	return fbink_restore(ctx->fbfd, &ctx->fbink_cfg, &ctx->dump);
+}
+
+static const BenchCase bench_cases[] = {
+	{ "fill_rect_200x200", &bench_fill_rect, 0U, false, 0.0f },
+	{ "clear_screen", &bench_clear_screen, 0U, false, 0.0f },
+	{ "draw_fontmult_1", &bench_draw, 1U, false, 0.0f },
+	{ "draw_fontmult_2", &bench_draw, 2U, false, 0.0f },
+	{ "draw_fontmult_4", &bench_draw, 4U, false, 0.0f },
+	{ "draw_fontmult_8", &bench_draw, 8U, false, 0.0f },
+	{ "print_ot_12px_short", &bench_print_ot_short, 0U, true, 12.0f },
+	{ "print_ot_12px_long", &bench_print_ot_long, 0U, true, 12.0f },
+	{ "print_ot_24px_short", &bench_print_ot_short, 0U, true, 24.0f },
+	{ "print_ot_24px_long", &bench_print_ot_long, 0U, true, 24.0f },
+	{ "print_ot_48px_short", &bench_print_ot_short, 0U, true, 48.0f },
+	{ "print_ot_48px_long", &bench_print_ot_long, 0U, true, 48.0f },
+	{ "image_y8", &bench_image_y8, 0U, false, 0.0f },
+	{ "image_ya", &bench_image_ya, 0U, false, 0.0f },
+	{ "image_rgb", &bench_image_rgb, 0U, false, 0.0f },
+	{ "image_rgba", &bench_image_rgba, 0U, false, 0.0f },
+	{ "image_rgba_ignore_alpha", &bench_image_rgba_flat, 0U, false, 0.0f },
+	{ "image_rgb_sw_dithering", &bench_image_dithered, 0U, false, 0.0f },
+	{ "image_rgba_scaled_2x", &bench_image_scaled, 0U, false, 0.0f },
+	{ "region_dump", &bench_region_dump, 0U, false, 0.0f },
+	{ "restore", &bench_restore, 0U, false, 0.0f },
+};
+
+// Run a single benchmark, and report its numbers
+static int
+    run_case(BenchContext* restrict ctx, const BenchCase* restrict bc, size_t iterations, uint64_t* restrict samples)
+{
+	// Warm up (caches, lazy allocations, and the like), and check that it's actually supported by this build
+	uint64_t pixels = 0U;
+	int      rv     = bc->fx(ctx, 0U, &pixels);
+	if (rv == ERRCODE(ENOSYS)) {
+		printf("%-28s %10s\n", bc->name, "(n/a)");
+		return EXIT_SUCCESS;
+	} else if (rv < 0) {
+		fprintf(stderr, "Benchmark %s failed (%d)!\n", bc->name, rv);
+		return ERRCODE(EXIT_FAILURE);
+	}
+
+	uint64_t total_px = 0U;
+	uint64_t total_ns = 0U;
+	for (size_t i = 0U; i < iterations; i++) {
+		const uint64_t start = now_ns();
+		rv                   = bc->fx(ctx, i, &pixels);
+		samples[i]           = now_ns() - start;
+		if (rv < 0) {
+			fprintf(stderr, "Benchmark %s failed (%d) at iteration %zu!\n", bc->name, rv, i);
+			return ERRCODE(EXIT_FAILURE);
+		}
+		total_px += pixels;
+		total_ns += samples[i];
+	}
+
+	qsort(samples, iterations, sizeof(*samples), &cmp_u64);
+	printf("%-28s %10.1f %10.1f %10.1f %10.1f %12.2f\n",
+	       bc->name,
+	       percentile_us(samples, iterations, 50U),
+	       percentile_us(samples, iterations, 90U),
+	       percentile_us(samples, iterations, 99U),
+	       percentile_us(samples, iterations, 100U),
+	       total_ns ? ((double) total_px * 1000.0) / (double) total_ns : 0.0);
+
+	return EXIT_SUCCESS;
+}
+
+// Run every benchmark against a canvas at a specific bitdepth & layout
+// NOTE: Canvases are always upright, so Landscape is simply a canvas with width & height swapped,
+//       which changes the line length & the aspect ratio the renderers have to deal with.
+static int
+    run_suite(uint32_t           width,
+	      uint32_t           height,
+	      uint8_t            bpp,
+	      bool               landscape,
+	      size_t             iterations,
+	      uint64_t* restrict samples)
+{
+	BenchContext ctx = { 0 };
+	ctx.width        = landscape ? height : width;
+	ctx.height       = landscape ? width : height;
+
+	ctx.fbfd = fbink_open_canvas(ctx.width, ctx.height, bpp, 0U);
+	if (ctx.fbfd < 0 && ctx.fbfd != FBFD_CANVAS) {
+		fprintf(stderr, "Failed to open a %ux%u @ %hhubpp canvas!\n", ctx.width, ctx.height, bpp);
+		return ERRCODE(EXIT_FAILURE);
+	}
+	ctx.fbink_cfg.is_quiet = true;
+
+	// Synthetic gradients, with a varying alpha where there's an alpha channel
+	const size_t px_count = (size_t) IMG_W * IMG_H;
+	ctx.img_y8            = malloc(px_count);
+	ctx.img_ya            = malloc(px_count * 2U);
+	ctx.img_rgb           = malloc(px_count * 3U);
+	ctx.img_rgba          = malloc(px_count * 4U);
+	int rv                = EXIT_SUCCESS;
+	if (!ctx.img_y8 || !ctx.img_ya || !ctx.img_rgb || !ctx.img_rgba) {
+		fprintf(stderr, "Failed to allocate image buffers!\n");
+		rv = ERRCODE(ENOMEM);
+		goto cleanup;
+	}
+	for (size_t j = 0U; j < IMG_H; j++) {
+		for (size_t k = 0U; k < IMG_W; k++) {
+			const size_t  idx = j * IMG_W + k;
+			const uint8_t v   = (uint8_t) ((k * 255U) / (IMG_W - 1U));
+			const uint8_t a   = (uint8_t) ((j * 255U) / (IMG_H - 1U));
+			ctx.img_y8[idx]   = v;
+			ctx.img_ya[idx * 2U]       = v;
+			ctx.img_ya[idx * 2U + 1U]  = a;
+			ctx.img_rgb[idx * 3U]      = v;
+			ctx.img_rgb[idx * 3U + 1U] = (uint8_t) (255U - v);
+			ctx.img_rgb[idx * 3U + 2U] = a;
+			ctx.img_rgba[idx * 4U]      = v;
+			ctx.img_rgba[idx * 4U + 1U] = (uint8_t) (255U - v);
+			ctx.img_rgba[idx * 4U + 2U] = a;
+			ctx.img_rgba[idx * 4U + 3U] = a;
+		}
+	}
+
+	printf("\n## %ux%u @ %hhubpp, %s\n", ctx.width, ctx.height, bpp, landscape ? "Landscape" : "Portrait");
+	printf("%-28s %10s %10s %10s %10s %12s\n", "benchmark", "p50 (us)", "p90 (us)", "p99 (us)", "max (us)", "Mpx/s");
+
+	uint8_t fontmult = UINT8_MAX;
+	for (size_t c = 0U; c < sizeof(bench_cases) / sizeof(*bench_cases); c++) {
+		const BenchCase* bc = &bench_cases[c];
+		if (bc->needs_font && !font_path) {
+			continue;
+		}
+		// Font scaling is applied at init time
+		if (bc->fontmult != fontmult) {
+			ctx.fbink_cfg.fontmult = bc->fontmult;
+			if (fbink_init(ctx.fbfd, &ctx.fbink_cfg) < 0) {
+				fprintf(stderr, "Failed to initialize FBInk!\n");
+				rv = ERRCODE(EXIT_FAILURE);
+				goto cleanup;
+			}
+			fontmult = bc->fontmult;
+		}
+		ctx.param = bc->param;
+		if (run_case(&ctx, bc, iterations, samples) != EXIT_SUCCESS) {
+			rv = ERRCODE(EXIT_FAILURE);
+		}
+	}
+
+cleanup:
+	fbink_free_dump_data(&ctx.dump);
+	free(ctx.img_y8);
+	free(ctx.img_ya);
+	free(ctx.img_rgb);
+	free(ctx.img_rgba);
+	fbink_close(FBFD_CANVAS);
+
+	return rv;
+}
+
+static void
+    show_helpmsg(void)
+{
+	printf(
+	    "\n"
+	    "FBInk Bench %s\n"
+	    "\n"
+	    "Usage: bench [-i iterations] [-s WxH] [-b bpp] [-o orientation] [-f font]\n"
+	    "\n"
+	    "Times FBInk's rendering hot paths against an off-screen canvas, for every supported bitdepth,\n"
+	    "in both Portrait & Landscape layouts.\n"
+	    "\n"
+	    "OPTIONS:\n"
+	    "\t-i, --iterations N\tAmount of timed calls per benchmark (defaults to 200).\n"
+	    "\t-s, --size WxH\t\tSize of the canvas, in Portrait (defaults to 1072x1448).\n"
+	    "\t-b, --bpp BPP\t\tOnly run at this bitdepth (4, 8, 16, 24 or 32).\n"
+	    "\t-o, --orientation O\tOnly run in this layout (portrait or landscape).\n"
+	    "\t-f, --font FILE\t\tAlso benchmark fbink_print_ot, with this OpenType font.\n"
+	    "\n"
+	    "Latencies are per call, throughput is in millions of pixels drawn per second.\n"
+	    "\n",
+	    fbink_version());
+}
+
+int
+    main(int argc, char* argv[])
+{
+	static const struct option opts[] = {
+		{ "iterations", required_argument, NULL, 'i' }, { "size", required_argument, NULL, 's' },
+		{ "bpp", required_argument, NULL, 'b' },        { "orientation", required_argument, NULL, 'o' },
+		{ "font", required_argument, NULL, 'f' },       { "help", no_argument, NULL, 'h' },
+		{ NULL, 0, NULL, 0 }
+	};
+
+	size_t   iterations = 200U;
+	uint32_t width      = 1072U;
+	uint32_t height     = 1448U;
+	int      only_bpp   = -1;
+	int      only_land  = -1;
+	int      opt;
+	int      opt_index;
+	while ((opt = getopt_long(argc, argv, "i:s:b:o:f:h", opts, &opt_index)) != -1) {
+		switch (opt) {
+			case 'i':
+				iterations = strtoul(optarg, NULL, 10);
+				break;
+			case 's':
+				if (sscanf(optarg, "%ux%u", &width, &height) != 2) {
+					fprintf(stderr, "Invalid size '%s'!\n", optarg);
+					return ERRCODE(EXIT_FAILURE);
+				}
+				break;
+			case 'b':
+				only_bpp = atoi(optarg);
+				break;
+			case 'o':
+				if (strcasecmp(optarg, "portrait") == 0) {
+					only_land = 0;
+				} else if (strcasecmp(optarg, "landscape") == 0) {
+					only_land = 1;
+				} else {
+					fprintf(stderr, "Invalid orientation '%s'!\n", optarg);
+					return ERRCODE(EXIT_FAILURE);
+				}
+				break;
+			case 'f':
+				font_path = optarg;
+				break;
+			case 'h':
+			default:
+				show_helpmsg();
+				return (opt == 'h') ? EXIT_SUCCESS : ERRCODE(EXIT_FAILURE);
+		}
+	}
+	if (iterations == 0U || width < IMG_W * 2U || height < IMG_W * 2U) {
+		fprintf(stderr, "Need at least one iteration, and a canvas of at least %ux%u!\n", IMG_W * 2U, IMG_W * 2U);
+		return ERRCODE(EXIT_FAILURE);
+	}
+
+	if (font_path && fbink_add_ot_font(font_path, FNT_REGULAR) != EXIT_SUCCESS) {
+		fprintf(stderr, "Failed to load font '%s', skipping the OpenType benchmarks.\n", font_path);
+		font_path = NULL;
+	}
+
+	uint64_t* samples = calloc(iterations, sizeof(*samples));
+	if (!samples) {
+		perror("calloc");
+		return ERRCODE(ENOMEM);
+	}
+
+	printf("# FBInk %s, %zu iterations per benchmark\n", fbink_version(), iterations);
+	static const uint8_t bpps[] = { 4U, 8U, 16U, 24U, 32U };
+	int                  rv     = EXIT_SUCCESS;
+	for (size_t b = 0U; b < sizeof(bpps); b++) {
+		if (only_bpp != -1 && only_bpp != bpps[b]) {
+			continue;
+		}
+		for (int land = 0; land < 2; land++) {
+			if (only_land != -1 && only_land != land) {
+				continue;
+			}
+			if (run_suite(width, height, bpps[b], land == 1, iterations, samples) != EXIT_SUCCESS) {
+				rv = ERRCODE(EXIT_FAILURE);
+			}
+		}
+	}
+
+	free(samples);
+	if (font_path) {
+		fbink_free_ot_fonts();
+	}
+
+	return rv;
+}